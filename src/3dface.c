@@ -40,6 +40,7 @@
 
 
 #include "3dface.h"
+#include "util.h"
 
 
 /*!
@@ -181,8 +182,7 @@ dxf_3dface_read
 #ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -191,25 +191,23 @@ dxf_3dface_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (face == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 face = dxf_3dface_init (face);
         }
         if (face->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                face->binary_graphics_data = dxf_binary_data_init (face->binary_graphics_data);
+                face->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (face->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -220,12 +218,11 @@ dxf_3dface_read
         }
         if (face->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p0 = dxf_point_init (face->p0);
+                face->p0 = dxf_point_init (dxf_point_new ());
                 if (face->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -236,12 +233,11 @@ dxf_3dface_read
         }
         if (face->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p1 = dxf_point_init (face->p1);
+                face->p1 = dxf_point_init (dxf_point_new ());
                 if (face->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -252,12 +248,11 @@ dxf_3dface_read
         }
         if (face->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p2 = dxf_point_init (face->p2);
+                face->p2 = dxf_point_init (dxf_point_new ());
                 if (face->p2 == NULL)
                 {
                         fprintf (stderr,
@@ -268,12 +263,11 @@ dxf_3dface_read
         }
         if (face->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                face->p3 = dxf_point_init (face->p3);
+                face->p3 = dxf_point_init (dxf_point_new ());
                 if (face->p3 == NULL)
                 {
                         fprintf (stderr,
@@ -282,19 +276,16 @@ dxf_3dface_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) face->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -309,14 +300,12 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->linetype);
+                        dxf_read_string (&face->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->layer);
+                        dxf_read_string (&face->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -462,12 +451,12 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbFace") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -490,10 +479,8 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, face->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -501,15 +488,13 @@ dxf_3dface_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->dictionary_owner_soft);
+                                dxf_read_string (&face->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->object_owner_soft);
+                                dxf_read_string (&face->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -517,15 +502,13 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->material);
+                        dxf_read_string (&face->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->dictionary_owner_hard);
+                        dxf_read_string (&face->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -538,8 +521,7 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, face->plot_style_name);
+                        dxf_read_string (&face->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -551,8 +533,7 @@ dxf_3dface_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", face->color_name);
+                        dxf_read_string (&face->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -564,16 +545,20 @@ dxf_3dface_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (face->linetype, "") == 0)
@@ -584,8 +569,6 @@ dxf_3dface_read
         {
                 face->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -742,13 +725,7 @@ dxf_3dface_write
 #endif
                 if (face->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) face->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, face->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -837,7 +814,10 @@ dxf_3dface_free
         }
         free (face->linetype);
         free (face->layer);
-        dxf_binary_data_free_list (face->binary_graphics_data);
+        if (face->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (face->binary_graphics_data);
+        }
         free (face->dictionary_owner_soft);
         free (face->object_owner_soft);
         free (face->material);
@@ -884,6 +864,7 @@ dxf_3dface_free_list
         while (faces != NULL)
         {
                 Dxf3dface *iter = (Dxf3dface *) faces->next;
+                faces->next = NULL;
                 dxf_3dface_free (faces);
                 faces = (Dxf3dface *) iter;
         }
@@ -5057,9 +5038,6 @@ dxf_3dface_get_last
         }
         if (face->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((Dxf3dface *) face);
         }
         Dxf3dface *iter = (Dxf3dface *) face->next;
@@ -43,6 +43,7 @@
 
 
 #include "3dline.h"
+#include "util.h"
 
 
 /*!
@@ -184,8 +185,7 @@ dxf_3dline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -194,25 +194,23 @@ dxf_3dline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_3dline_init (line);
         }
         if (line->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                line->binary_graphics_data = dxf_binary_data_init (line->binary_graphics_data);
+                line->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (line->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -223,12 +221,11 @@ dxf_3dline_read
         }
         if (line->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p0 = dxf_point_init (line->p0);
+                line->p0 = dxf_point_init (dxf_point_new ());
                 if (line->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -239,12 +236,11 @@ dxf_3dline_read
         }
         if (line->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p1 = dxf_point_init (line->p1);
+                line->p1 = dxf_point_init (dxf_point_new ());
                 if (line->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -253,11 +249,10 @@ dxf_3dline_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) line->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -265,8 +260,6 @@ dxf_3dline_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -280,14 +273,12 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
+                        dxf_read_string (&line->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
+                        dxf_read_string (&line->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -384,12 +375,12 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbLine") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -433,10 +424,8 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, line->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -444,15 +433,13 @@ dxf_3dline_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
+                                dxf_read_string (&line->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
+                                dxf_read_string (&line->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -460,15 +447,13 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
+                        dxf_read_string (&line->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
+                        dxf_read_string (&line->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -481,8 +466,7 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
+                        dxf_read_string (&line->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -494,8 +478,7 @@ dxf_3dline_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
+                        dxf_read_string (&line->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -507,16 +490,20 @@ dxf_3dline_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
@@ -527,8 +514,6 @@ dxf_3dline_read
         {
                 line->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -702,13 +687,7 @@ dxf_3dline_write
 #endif
                 if (line->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter310;
-                        iter310 = (DxfBinaryData *) line->binary_graphics_data;
-                        while (iter310 != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                                iter310 = (DxfBinaryData *) iter310->next;
-                        }
+                        dxf_binary_data_write (fp, line->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -791,7 +770,10 @@ dxf_3dline_free
         }
         free (line->linetype);
         free (line->layer);
-        dxf_binary_data_free_list (line->binary_graphics_data);
+        if (line->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (line->binary_graphics_data);
+        }
         free (line->dictionary_owner_soft);
         free (line->object_owner_soft);
         free (line->material);
@@ -836,6 +818,7 @@ dxf_3dline_free_list
         while (lines != NULL)
         {
                 Dxf3dline *iter = (Dxf3dline *) lines->next;
+                lines->next = NULL;
                 dxf_3dline_free (lines);
                 lines = (Dxf3dline *) iter;
         }
@@ -4143,9 +4126,6 @@ dxf_3dline_get_last
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((Dxf3dline *) line);
         }
         Dxf3dline *iter = (Dxf3dline *) line->next;
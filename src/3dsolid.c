@@ -49,6 +49,7 @@
 
 
 #include "3dsolid.h"
+#include "util.h"
 
 
 /*!
@@ -144,8 +145,7 @@ dxf_3dsolid_init
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         solid->binary_graphics_data = NULL;
-        solid->proprietary_data = NULL;
-        solid->additional_proprietary_data = NULL;
+        solid->acis_data = NULL;
         solid->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -177,11 +177,9 @@ dxf_3dsolid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
-
-        int i;
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -189,65 +187,58 @@ dxf_3dsolid_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (solid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 solid = dxf_3dsolid_init (solid);
         }
-        iter310 = (DxfBinaryData *) solid->binary_graphics_data;
-        i = 1;
-        solid->proprietary_data->order = 0;
-        solid->additional_proprietary_data->order = 0;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->proprietary_data->data_line);
-                        solid->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->proprietary_data->next);
-                        solid->proprietary_data = (DxfBinaryData *) solid->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->additional_proprietary_data->data_line);
-                        solid->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) solid->additional_proprietary_data->next);
-                        solid->additional_proprietary_data = (DxfBinaryData *) solid->additional_proprietary_data->next;
+                         * data, group code 3 lines continue the
+                         * previous line. */
+                        group_code = (temp_string[0] == '1') ? 1 : 3;
+                        dxf_read_value_line (temp_string, fp);
+                        if (solid->acis_data == NULL)
+                        {
+                                solid->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                                if (solid->acis_data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                        }
+                        dxf_acis_data_append_line (solid->acis_data, group_code, temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -258,14 +249,12 @@ dxf_3dsolid_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->linetype);
+                        dxf_read_string (&solid->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->layer);
+                        dxf_read_string (&solid->layer, fp);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -327,12 +316,13 @@ dxf_3dsolid_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbModelerGeometry") != 0)
-                          || (strcmp (temp_string, "AcDb3dSolid") != 0))
+                        dxf_read_line (temp_string, fp);
+                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                          && (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                          && (strcmp (temp_string, "AcDb3dSolid") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -355,10 +345,19 @@ dxf_3dsolid_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        if (solid->binary_graphics_data == NULL)
+                        {
+                                solid->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                                if (solid->binary_graphics_data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                        }
+                        dxf_binary_data_append_hex (fp, solid->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -366,15 +365,13 @@ dxf_3dsolid_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_soft);
+                                dxf_read_string (&solid->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->object_owner_soft);
+                                dxf_read_string (&solid->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -382,22 +379,19 @@ dxf_3dsolid_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->material);
+                        dxf_read_string (&solid->material, fp);
                 }
                 else if (strcmp (temp_string, "350") == 0)
                 {
                         /* Now follows a string containing a handle to a
                          * history object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->history);
+                        dxf_read_string (&solid->history, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->dictionary_owner_hard);
+                        dxf_read_string (&solid->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -410,8 +404,7 @@ dxf_3dsolid_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->plot_style_name);
+                        dxf_read_string (&solid->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -423,8 +416,7 @@ dxf_3dsolid_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, solid->color_name);
+                        dxf_read_string (&solid->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -436,16 +428,20 @@ dxf_3dsolid_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (solid->linetype, "") == 0)
@@ -456,8 +452,6 @@ dxf_3dsolid_read
         {
                 solid->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -484,9 +478,6 @@ dxf_3dsolid_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("3DSOLID");
-        DxfBinaryData *iter = NULL;
-        DxfBinaryData *additional_iter = NULL;
-        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -534,7 +525,6 @@ dxf_3dsolid_write
                 solid->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        i = 1;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         if (solid->id_code != -1)
         {
@@ -622,13 +612,7 @@ dxf_3dsolid_write
 #endif
                 if (solid->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) solid->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, solid->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -654,25 +638,10 @@ dxf_3dsolid_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", solid->modeler_format_version_number);
         }
-        if ((solid->proprietary_data != NULL) || (solid->additional_proprietary_data != NULL))
+        if ((solid->acis_data != NULL)
+          && (dxf_acis_data_get_number_of_lines (solid->acis_data) > 0))
         {
-                iter = (DxfBinaryData *) solid->proprietary_data;
-                additional_iter = (DxfBinaryData *) solid->additional_proprietary_data;
-                while ((iter != NULL) || (additional_iter != NULL))
-                {
-                        if (iter->order == i)
-                        {
-                                fprintf (fp->fp, "  1\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                                i++;
-                        }
-                        if (additional_iter->order == i)
-                        {
-                                fprintf (fp->fp, "  3\n%s\n", additional_iter->data_line);
-                                additional_iter = (DxfBinaryData *) additional_iter->next;
-                                i++;
-                        }
-                }
+                dxf_acis_data_write (fp, solid->acis_data);
         }
         else
         {
@@ -728,15 +697,20 @@ dxf_3dsolid_free
         }
         free (solid->linetype);
         free (solid->layer);
-        dxf_binary_data_free_list (solid->binary_graphics_data);
+        if (solid->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (solid->binary_graphics_data);
+        }
         free (solid->dictionary_owner_soft);
         free (solid->object_owner_soft);
         free (solid->material);
         free (solid->dictionary_owner_hard);
         free (solid->plot_style_name);
         free (solid->color_name);
-        dxf_binary_data_free_list (solid->proprietary_data);
-        dxf_binary_data_free_list (solid->additional_proprietary_data);
+        if (solid->acis_data != NULL)
+        {
+                dxf_acis_data_free (solid->acis_data);
+        }
         free (solid->history);
         free (solid);
         solid = NULL;
@@ -771,6 +745,7 @@ dxf_3dsolid_free_list
         while (solids != NULL)
         {
                 Dxf3dsolid *iter = (Dxf3dsolid *) solids->next;
+                solids->next = NULL;
                 dxf_3dsolid_free (solids);
                 solids = (Dxf3dsolid *) iter;
         }
@@ -2396,15 +2371,14 @@ dxf_3dsolid_set_transparency
 
 
 /*!
- * \brief Get the pointer to the \c proprietary_data from a DXF 
+ * \brief Get the pointer to the proprietary (ACIS) data from a DXF
  * \c 3DSOLID entity.
  *
- * \return pointer to the \c proprietary_data.
- *
- * \warning No checks are performed on the returned pointer.
+ * \return pointer to the \c acis_data, \c NULL when the entity has no
+ * proprietary data or an error occurred.
  */
-DxfBinaryData *
-dxf_3dsolid_get_proprietary_data
+DxfAcisData *
+dxf_3dsolid_get_acis_data
 (
         Dxf3dsolid *solid
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
@@ -2421,30 +2395,111 @@ dxf_3dsolid_get_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->proprietary_data == NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (solid->acis_data);
+}
+
+
+/*!
+ * \brief Set the pointer to the proprietary (ACIS) data for a DXF
+ * \c 3DSOLID entity.
+ */
+Dxf3dsolid *
+dxf_3dsolid_set_acis_data
+(
+        Dxf3dsolid *solid,
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data to be set for
+                 * the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (solid == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        solid->acis_data = acis_data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (solid);
+}
+
+
+/*!
+ * \brief Get the \c proprietary_data from a DXF \c 3DSOLID entity.
+ *
+ * The group code 1 lines of the proprietary (ACIS) data are
+ * returned.
+ *
+ * \return a newly allocated list with the \c proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_proprietary_data_free_list ().
+ */
+DxfProprietaryData *
+dxf_3dsolid_get_proprietary_data
+(
+        Dxf3dsolid *solid
+                /*!< a pointer to a DXF \c 3DSOLID entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (solid == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (solid->acis_data == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) solid->proprietary_data);
+        return (dxf_acis_data_get_lines (solid->acis_data, 1));
 }
 
 
 /*!
  * \brief Set the \c proprietary_data for a DXF \c 3DSOLID entity.
+ *
+ * The group code 1 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c proprietary_data.
  */
 Dxf3dsolid *
 dxf_3dsolid_set_proprietary_data
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        DxfBinaryData *proprietary_data
-                /*!< the \c proprietary_data to be set for the entity. */
+        DxfProprietaryData *proprietary_data
+                /*!< a pointer to a single linked list with the
+                 * \c proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2465,15 +2520,10 @@ dxf_3dsolid_set_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->proprietary_data == NULL)
+        if (solid->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                solid->proprietary_data = dxf_binary_data_init (solid->proprietary_data);
-                if (solid->proprietary_data == NULL)
+                solid->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (solid->acis_data == NULL)
                 {
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
@@ -2481,7 +2531,10 @@ dxf_3dsolid_set_proprietary_data
                         return (NULL);
                 }
         }
-        solid->proprietary_data = proprietary_data;
+        if (dxf_acis_data_set_lines (solid->acis_data, 1, proprietary_data) == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2490,14 +2543,18 @@ dxf_3dsolid_set_proprietary_data
 
 
 /*!
- * \brief Get the pointer to the \c additional_proprietary_data from a
- * DXF \c 3DSOLID entity.
+ * \brief Get the \c additional_proprietary_data from a DXF \c 3DSOLID entity.
  *
- * \return pointer to the \c additional_proprietary_data.
+ * The group code 3 lines of the proprietary (ACIS) data are
+ * returned.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return a newly allocated list with the \c additional_proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_proprietary_data_free_list ().
  */
-DxfBinaryData *
+DxfProprietaryData *
 dxf_3dsolid_get_additional_proprietary_data
 (
         Dxf3dsolid *solid
@@ -2515,31 +2572,34 @@ dxf_3dsolid_get_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->additional_proprietary_data == NULL)
+        if (solid->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) solid->additional_proprietary_data);
+        return (dxf_acis_data_get_lines (solid->acis_data, 3));
 }
 
 
 /*!
- * \brief Set the \c additional_proprietary_data for a DXF \c 3DSOLID
- * entity.
+ * \brief Set the \c additional_proprietary_data for a DXF \c 3DSOLID entity.
+ *
+ * The group code 3 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c additional_proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c additional_proprietary_data.
  */
 Dxf3dsolid *
 dxf_3dsolid_set_additional_proprietary_data
 (
         Dxf3dsolid *solid,
                 /*!< a pointer to a DXF \c 3DSOLID entity. */
-        DxfBinaryData *additional_proprietary_data
-                /*!< the \c additional_proprietary_data to be set for the entity. */
+        DxfProprietaryData *additional_proprietary_data
+                /*!< a pointer to a single linked list with the
+                 * \c additional_proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2560,15 +2620,10 @@ dxf_3dsolid_set_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (solid->additional_proprietary_data == NULL)
+        if (solid->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                solid->additional_proprietary_data = dxf_binary_data_init (solid->additional_proprietary_data);
-                if (solid->additional_proprietary_data == NULL)
+                solid->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (solid->acis_data == NULL)
                 {
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
@@ -2576,7 +2631,10 @@ dxf_3dsolid_set_additional_proprietary_data
                         return (NULL);
                 }
         }
-        solid->additional_proprietary_data = additional_proprietary_data;
+        if (dxf_acis_data_set_lines (solid->acis_data, 3, additional_proprietary_data) == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2856,9 +2914,6 @@ dxf_3dsolid_get_last
         }
         if (solid->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((Dxf3dsolid *) solid);
         }
         Dxf3dsolid *iter = (Dxf3dsolid *) solid->next;
@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "acis_data.h"
 #include "binary_data.h"
 
 
@@ -189,15 +190,10 @@ dxf_3dsolid_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF 3D solid. */
-        DxfBinaryData *proprietary_data;
-                /*!< Proprietary data (multiple lines < 255 characters
-                 * each).\n
-                 * Group code = 1. */
-        DxfBinaryData *additional_proprietary_data;
-                /*!< Additional lines of proprietary data if previous
-                 * group 1 string is greater than 255 characters
-                 * (optional).\n
-                 * Group code = 3. */
+        DxfAcisData *acis_data;
+                /*!< Proprietary (ACIS) data, kept as read from the DXF
+                 * file and only decoded on request.\n
+                 * Group codes = 1 and 3. */
         int16_t modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -259,10 +255,12 @@ char *dxf_3dsolid_get_color_name (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_color_name (Dxf3dsolid *solid, char *color_name);
 int32_t dxf_3dsolid_get_transparency (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_transparency (Dxf3dsolid *solid, int32_t transparency);
-DxfBinaryData *dxf_3dsolid_get_proprietary_data (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_proprietary_data (Dxf3dsolid *solid, DxfBinaryData *proprietary_data);
-DxfBinaryData *dxf_3dsolid_get_additional_proprietary_data (Dxf3dsolid *solid);
-Dxf3dsolid *dxf_3dsolid_set_additional_proprietary_data (Dxf3dsolid *solid, DxfBinaryData *additional_proprietary_data);
+DxfAcisData *dxf_3dsolid_get_acis_data (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_acis_data (Dxf3dsolid *solid, DxfAcisData *acis_data);
+DxfProprietaryData *dxf_3dsolid_get_proprietary_data (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_proprietary_data (Dxf3dsolid *solid, DxfProprietaryData *proprietary_data);
+DxfProprietaryData *dxf_3dsolid_get_additional_proprietary_data (Dxf3dsolid *solid);
+Dxf3dsolid *dxf_3dsolid_set_additional_proprietary_data (Dxf3dsolid *solid, DxfProprietaryData *additional_proprietary_data);
 int16_t dxf_3dsolid_get_modeler_format_version_number (Dxf3dsolid *solid);
 Dxf3dsolid *dxf_3dsolid_set_modeler_format_version_number (Dxf3dsolid *solid, int16_t modeler_format_version_number);
 char *dxf_3dsolid_get_history (Dxf3dsolid *solid);
@@ -53,6 +53,7 @@
 
 
 #include "acad_proxy_entity.h"
+#include "util.h"
 
 
 /*!
@@ -151,9 +152,6 @@ dxf_acad_proxy_entity_init
         acad_proxy_entity->graphics_data_size = 0;
         acad_proxy_entity->entity_data_size = 0;
         acad_proxy_entity->object_drawing_format = 0;
-        acad_proxy_entity->object_id->group_code = 0;
-        acad_proxy_entity->object_id->data = strdup ("");
-        acad_proxy_entity->object_id->length = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         acad_proxy_entity->binary_graphics_data = NULL;
@@ -191,8 +189,8 @@ dxf_acad_proxy_entity_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfBinaryData *data310;
         int iter330;
         int i; /* flags whether group code 330, 340, 350 or 360 has been
                 * parsed for a first time. */
@@ -203,31 +201,30 @@ dxf_acad_proxy_entity_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (!acad_proxy_entity)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 acad_proxy_entity = dxf_acad_proxy_entity_init (acad_proxy_entity);
         }
         if (acad_proxy_entity->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                acad_proxy_entity->binary_graphics_data = dxf_binary_data_init (acad_proxy_entity->binary_graphics_data);
+                acad_proxy_entity->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (acad_proxy_entity->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -238,12 +235,11 @@ dxf_acad_proxy_entity_read
         }
         if (acad_proxy_entity->binary_entity_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                acad_proxy_entity->binary_entity_data = dxf_binary_data_init (acad_proxy_entity->binary_entity_data);
+                acad_proxy_entity->binary_entity_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (acad_proxy_entity->binary_entity_data == NULL)
                 {
                         fprintf (stderr,
@@ -252,20 +248,35 @@ dxf_acad_proxy_entity_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
         iter330 = 0;
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        /* Group code 310 lines following group code 93 contain entity
+         * data. */
+        data310 = acad_proxy_entity->binary_graphics_data;
+        if (acad_proxy_entity->object_id == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                acad_proxy_entity->object_id = dxf_object_id_init (dxf_object_id_new ());
+                if (acad_proxy_entity->object_id == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -280,15 +291,13 @@ dxf_acad_proxy_entity_read
                 {
                         /* Now follows a string containing the linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->linetype);
+                        dxf_read_string (&acad_proxy_entity->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing the layer
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->layer);
+                        dxf_read_string (&acad_proxy_entity->layer, fp);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -337,7 +346,8 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%hd\n", &acad_proxy_entity->original_custom_object_data_format);
                         if (acad_proxy_entity->original_custom_object_data_format != 1)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_ERROR,
+                                  DXF_DIAGNOSTIC_INVALID_ENTITY,
                                   (_("Error in %s () found a bad original custom object data format value in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -350,7 +360,8 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->proxy_entity_class_id);
                         if (acad_proxy_entity->proxy_entity_class_id != DXF_DEFAULT_PROXY_ENTITY_ID)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_INVALID_ENTITY,
                                   (_("Warning in %s () found a bad proxy entity class ID in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -363,7 +374,8 @@ dxf_acad_proxy_entity_read
                         fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->application_entity_class_id);
                         if (acad_proxy_entity->application_entity_class_id < 500)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_INVALID_ENTITY,
                                   (_("Warning in %s () found a bad value in application entity class ID in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -381,6 +393,7 @@ dxf_acad_proxy_entity_read
                          * data size value (bits). */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%" PRIi32 "\n", &acad_proxy_entity->entity_data_size);
+                        data310 = acad_proxy_entity->binary_entity_data;
                 }
                 else if ((fp->acad_version_number >= AutoCAD_2000)
                   && (strcmp (temp_string, "95") == 0))
@@ -395,13 +408,13 @@ dxf_acad_proxy_entity_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                           && ((strcmp (temp_string, "AcDbZombieEntity") != 0))
                           && ((strcmp (temp_string, "AcDbProxyEntity") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -416,11 +429,9 @@ dxf_acad_proxy_entity_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                         * graphics data or binary entity data. */
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, data310, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -428,15 +439,13 @@ dxf_acad_proxy_entity_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->dictionary_owner_soft);
+                                dxf_read_string (&acad_proxy_entity->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->object_owner_soft);
+                                dxf_read_string (&acad_proxy_entity->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -449,17 +458,23 @@ dxf_acad_proxy_entity_read
                         {
                                 dxf_object_id_set_group_code (acad_proxy_entity->object_id, atoi (temp_string));
                                 /* Now follows a string containing an object id line of data. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->object_id->data);
+                                dxf_read_string (&acad_proxy_entity->object_id->data, fp);
                         }
                         else /* For following object_id's. */
                         {
                                 DxfObjectId *iter = dxf_object_id_get_last ((DxfObjectId *) acad_proxy_entity->object_id);
-                                iter = dxf_object_id_init ((DxfObjectId *) iter->next);
+                                iter->next = (struct DxfObjectId *) dxf_object_id_init (dxf_object_id_new ());
+                                iter = (DxfObjectId *) iter->next;
+                                if (iter == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
                                 dxf_object_id_set_group_code (iter, atoi (temp_string));
                                 /* Now follows a string containing an object id line of data. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->data);
+                                dxf_read_string (&iter->data, fp);
                         }
                         i++;
                 }
@@ -467,15 +482,13 @@ dxf_acad_proxy_entity_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->material);
+                        dxf_read_string (&acad_proxy_entity->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->dictionary_owner_hard);
+                        dxf_read_string (&acad_proxy_entity->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -488,8 +501,7 @@ dxf_acad_proxy_entity_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->plot_style_name);
+                        dxf_read_string (&acad_proxy_entity->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -501,8 +513,7 @@ dxf_acad_proxy_entity_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, acad_proxy_entity->color_name);
+                        dxf_read_string (&acad_proxy_entity->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -514,19 +525,21 @@ dxf_acad_proxy_entity_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         fprintf (stderr,
           (_("Information from %s() read %d object_id's from %s.\n")),
@@ -732,24 +745,12 @@ dxf_acad_proxy_entity_write
 #endif
                 if (acad_proxy_entity->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter310a;
-                        iter310a = (DxfBinaryData *) acad_proxy_entity->binary_graphics_data;
-                        while (iter310a != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310a->data_line);
-                                iter310a = (DxfBinaryData *) iter310a->next;
-                        }
+                        dxf_binary_data_write (fp, acad_proxy_entity->binary_graphics_data);
                 }
                 fprintf (fp->fp, " 93\n%" PRIi32 "\n", acad_proxy_entity->entity_data_size);
                 if (acad_proxy_entity->binary_entity_data != NULL)
                 {
-                        DxfBinaryData *iter310b;
-                        iter310b = (DxfBinaryData *) acad_proxy_entity->binary_entity_data;
-                        while (iter310b != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter310b->data_line);
-                                iter310b = (DxfBinaryData *) iter310b->next;
-                        }
+                        dxf_binary_data_write (fp, acad_proxy_entity->binary_entity_data);
                 }
         }
         DxfObjectId *iter330;
@@ -817,8 +818,14 @@ dxf_acad_proxy_entity_free
         free (acad_proxy_entity->dictionary_owner_hard);
         free (acad_proxy_entity->plot_style_name);
         free (acad_proxy_entity->color_name);
-        dxf_binary_data_free_list (acad_proxy_entity->binary_graphics_data);
-        dxf_binary_data_free_list (acad_proxy_entity->binary_entity_data);
+        if (acad_proxy_entity->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (acad_proxy_entity->binary_graphics_data);
+        }
+        if (acad_proxy_entity->binary_entity_data != NULL)
+        {
+                dxf_binary_data_free_list (acad_proxy_entity->binary_entity_data);
+        }
         dxf_object_id_free_list (acad_proxy_entity->object_id);
         free (acad_proxy_entity);
         acad_proxy_entity = NULL;
@@ -853,6 +860,7 @@ dxf_acad_proxy_entity_free_list
         while (acad_proxy_entities != NULL)
         {
                 DxfAcadProxyEntity *iter = (DxfAcadProxyEntity *) acad_proxy_entities->next;
+                acad_proxy_entities->next = NULL;
                 dxf_acad_proxy_entity_free (acad_proxy_entities);
                 acad_proxy_entities = (DxfAcadProxyEntity *) iter;
         }
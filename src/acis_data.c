@@ -0,0 +1,731 @@
+/*!
+ * \file acis_data.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for DXF proprietary (ACIS) data of modeler geometry
+ * entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "acis_data.h"
+
+
+/*!
+ * \brief Allocate memory for a DXF proprietary (ACIS) data object.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfAcisData *
+dxf_acis_data_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfAcisData *acis_data = NULL;
+        size_t size;
+
+        size = sizeof (DxfAcisData);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((acis_data = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                acis_data = NULL;
+        }
+        else
+        {
+                memset (acis_data, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis_data);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a DXF
+ * proprietary (ACIS) data object.
+ * 
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfAcisData *
+dxf_acis_data_init
+(
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                acis_data = dxf_acis_data_new ();
+        }
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        acis_data->data = NULL;
+        acis_data->length = 0;
+        acis_data->size = 0;
+        acis_data->number_of_lines = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis_data);
+}
+
+
+/*!
+ * \brief Write DXF output to fp for a DXF proprietary (ACIS) data
+ * object.
+ *
+ * The group code 1 and 3 lines are written as they were read.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_data_write
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((fp == NULL) || (acis_data == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((acis_data->length > 0)
+          && (fwrite (acis_data->data, 1, (size_t) acis_data->length, fp->fp) != (size_t) acis_data->length))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () while writing to: %s.\n")),
+                  __FUNCTION__, fp->filename);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a DXF proprietary (ACIS) data
+ * object and all it's data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_data_free
+(
+        DxfAcisData *acis_data
+                /*!< a pointer to the memory occupied by the proprietary
+                 * data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (acis_data->data);
+        free (acis_data);
+        acis_data = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make room for \c length more characters in a DXF proprietary
+ * (ACIS) data object.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_acis_data_reserve
+(
+        DxfAcisData *acis_data,
+        int length
+)
+{
+        char *data;
+        int size;
+
+        if (length > INT_MAX - acis_data->length - 1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid length was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        length += acis_data->length + 1;
+        if (length <= acis_data->size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        size = (acis_data->size > 0) ? acis_data->size : 4096;
+        while ((size < length) && (size <= INT_MAX / 2))
+        {
+                size *= 2;
+        }
+        if (size < length)
+        {
+                size = length;
+        }
+        data = realloc (acis_data->data, (size_t) size);
+        if (data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        acis_data->data = data;
+        acis_data->size = size;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a line of proprietary data as read from a DXF file to
+ * a DXF proprietary (ACIS) data object.
+ *
+ * The line is stored as is, it is not decoded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_data_append_line
+(
+        DxfAcisData *acis_data,
+                /*!< a pointer to the proprietary data object. */
+        int group_code,
+                /*!< Group code of the line, \c 1 for the start of a
+                 * record, \c 3 for a continuation of a record. */
+        const char *line
+                /*!< Line of proprietary data. */
+)
+{
+        int length;
+
+        /* Do some basic checks. */
+        if ((acis_data == NULL) || (line == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((group_code != 1) && (group_code != 3))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid group code was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        length = (int) strlen (line);
+        if (dxf_acis_data_reserve (acis_data, length + 5) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        acis_data->length += sprintf (acis_data->data + acis_data->length,
+          "%3d\n%s\n", group_code, line);
+        acis_data->number_of_lines++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the SAT text from a DXF proprietary (ACIS) data object.
+ *
+ * The lines are decoded: a space is kept, the sequence "^ " is an
+ * \c A, and any other character \c c is <tt>159 - c</tt>.\n
+ * Group code 3 lines are joined with the preceding line.
+ *
+ * \return a newly allocated string with the SAT text, each record
+ * terminated by a newline, or \c NULL when an error occurred.
+ */
+char *
+dxf_acis_data_get_sat
+(
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const char *p;
+        const char *end;
+        char *sat;
+        int group_code;
+        int number_of_records;
+        int length;
+
+        /* Do some basic checks. */
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        /* The decoded text is never longer than the stored lines. */
+        sat = malloc ((size_t) acis_data->length + 1);
+        if (sat == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        length = 0;
+        number_of_records = 0;
+        p = acis_data->data;
+        end = p + acis_data->length;
+        while (p < end)
+        {
+                group_code = (int) strtol (p, (char **) &p, 10);
+                p++;
+                if (group_code == 1)
+                {
+                        if (number_of_records > 0)
+                        {
+                                sat[length++] = '\n';
+                        }
+                        number_of_records++;
+                }
+                for (; *p != '\n'; p++)
+                {
+                        if (*p == ' ')
+                        {
+                                sat[length++] = ' ';
+                        }
+                        else if ((*p == '^') && (p[1] == ' '))
+                        {
+                                sat[length++] = 'A';
+                                p++;
+                        }
+                        else
+                        {
+                                sat[length++] = (char) (159 - (unsigned char) *p);
+                        }
+                }
+                p++;
+        }
+        if (number_of_records > 0)
+        {
+                sat[length++] = '\n';
+        }
+        sat[length] = '\0';
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (sat);
+}
+
+
+/*!
+ * \brief Set the SAT text for a DXF proprietary (ACIS) data object.
+ *
+ * The text is encoded and split in group code 1 lines, one for each
+ * record, followed by group code 3 lines for the remainder of records
+ * longer than \c DXF_ACIS_DATA_LINE_LENGTH characters.\n
+ * Any previous data is replaced.
+ *
+ * \return a pointer to \c acis_data, or \c NULL when an error occurred.
+ */
+DxfAcisData *
+dxf_acis_data_set_sat
+(
+        DxfAcisData *acis_data,
+                /*!< a pointer to the proprietary data object. */
+        const char *sat
+                /*!< SAT text, records separated by newlines. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char line[DXF_ACIS_DATA_LINE_LENGTH + 2];
+        int group_code;
+        int n;
+
+        /* Do some basic checks. */
+        if ((acis_data == NULL) || (sat == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        acis_data->length = 0;
+        acis_data->number_of_lines = 0;
+        while (*sat != '\0')
+        {
+                group_code = 1;
+                n = 0;
+                for (; (*sat != '\0') && (*sat != '\n'); sat++)
+                {
+                        if (n >= DXF_ACIS_DATA_LINE_LENGTH - 1)
+                        {
+                                line[n] = '\0';
+                                if (dxf_acis_data_append_line (acis_data, group_code, line) == EXIT_FAILURE)
+                                {
+                                        return (NULL);
+                                }
+                                group_code = 3;
+                                n = 0;
+                        }
+                        if (*sat == ' ')
+                        {
+                                line[n++] = ' ';
+                        }
+                        else if (*sat == 'A')
+                        {
+                                line[n++] = '^';
+                                line[n++] = ' ';
+                        }
+                        else
+                        {
+                                line[n++] = (char) (159 - (unsigned char) *sat);
+                        }
+                }
+                line[n] = '\0';
+                if (dxf_acis_data_append_line (acis_data, group_code, line) == EXIT_FAILURE)
+                {
+                        return (NULL);
+                }
+                if (*sat == '\n')
+                {
+                        sat++;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis_data);
+}
+
+
+/*!
+ * \brief Append the lines with group code \c group_code from a buffer
+ * of proprietary data lines to a DXF proprietary (ACIS) data object.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_acis_data_append_group
+(
+        DxfAcisData *acis_data,
+        char *data,
+        int length,
+        int group_code
+)
+{
+        char *p;
+        char *end;
+        char *eol;
+        int line_group_code;
+        int result;
+
+        p = data;
+        end = data + length;
+        while (p < end)
+        {
+                line_group_code = (int) strtol (p, &p, 10);
+                p++;
+                eol = strchr (p, '\n');
+                if (line_group_code == group_code)
+                {
+                        *eol = '\0';
+                        result = dxf_acis_data_append_line (acis_data, group_code, p);
+                        *eol = '\n';
+                        if (result == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                p = eol + 1;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the lines with group code \c group_code from a DXF
+ * proprietary (ACIS) data object.
+ *
+ * \return a newly allocated single linked list of
+ * \c DxfProprietaryData objects, or \c NULL when there are no such
+ * lines or an error occurred.
+ *
+ * \warning The caller owns the returned list and frees it with
+ * dxf_proprietary_data_free_list ().
+ */
+DxfProprietaryData *
+dxf_acis_data_get_lines
+(
+        DxfAcisData *acis_data,
+                /*!< a pointer to the proprietary data object. */
+        int group_code
+                /*!< Group code of the lines, \c 1 or \c 3. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryData *lines = NULL;
+        DxfProprietaryData *last = NULL;
+        DxfProprietaryData *iter;
+        const char *p;
+        const char *end;
+        const char *eol;
+        int line_group_code;
+        int order;
+
+        /* Do some basic checks. */
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        order = 0;
+        p = acis_data->data;
+        end = p + acis_data->length;
+        while (p < end)
+        {
+                line_group_code = (int) strtol (p, (char **) &p, 10);
+                p++;
+                eol = strchr (p, '\n');
+                if (line_group_code == group_code)
+                {
+                        iter = dxf_proprietary_data_new ();
+                        if (iter != NULL)
+                        {
+                                iter->line = strndup (p, (size_t) (eol - p));
+                        }
+                        if ((iter == NULL) || (iter->line == NULL))
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                free (iter);
+                                if (lines != NULL)
+                                {
+                                        dxf_proprietary_data_free_list (lines);
+                                }
+                                return (NULL);
+                        }
+                        iter->order = order++;
+                        iter->length = (int) (eol - p);
+                        if (last == NULL)
+                        {
+                                lines = iter;
+                        }
+                        else
+                        {
+                                last->next = (struct DxfProprietaryData *) iter;
+                        }
+                        last = iter;
+                }
+                p = eol + 1;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (lines);
+}
+
+
+/*!
+ * \brief Set the lines with group code \c group_code for a DXF
+ * proprietary (ACIS) data object.
+ *
+ * Any previous lines with group code \c group_code are replaced, the
+ * lines with the other group code are kept.\n
+ * The group code 1 lines are stored before the group code 3 lines, the
+ * order in which the separate lists were written before both were kept
+ * in one buffer.
+ *
+ * \return a pointer to \c acis_data, or \c NULL when an error occurred.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c lines.
+ */
+DxfAcisData *
+dxf_acis_data_set_lines
+(
+        DxfAcisData *acis_data,
+                /*!< a pointer to the proprietary data object. */
+        int group_code,
+                /*!< Group code of the lines, \c 1 or \c 3. */
+        DxfProprietaryData *lines
+                /*!< a pointer to a single linked list of
+                 * \c DxfProprietaryData objects. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfProprietaryData *iter;
+        char *data;
+        int length;
+        int size;
+        int number_of_lines;
+        int result;
+
+        /* Do some basic checks. */
+        if ((acis_data == NULL) || (lines == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((group_code != 1) && (group_code != 3))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid group code was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        /* Keep the previous lines aside until the new buffer is built. */
+        data = acis_data->data;
+        length = acis_data->length;
+        size = acis_data->size;
+        number_of_lines = acis_data->number_of_lines;
+        acis_data->data = NULL;
+        acis_data->length = 0;
+        acis_data->size = 0;
+        acis_data->number_of_lines = 0;
+        result = EXIT_SUCCESS;
+        if (group_code == 3)
+        {
+                result = dxf_acis_data_append_group (acis_data, data, length, 1);
+        }
+        for (iter = lines; (iter != NULL) && (result == EXIT_SUCCESS); iter = (DxfProprietaryData *) iter->next)
+        {
+                if (iter->line != NULL)
+                {
+                        result = dxf_acis_data_append_line (acis_data, group_code, iter->line);
+                }
+        }
+        if ((group_code == 1) && (result == EXIT_SUCCESS))
+        {
+                result = dxf_acis_data_append_group (acis_data, data, length, 3);
+        }
+        if (result == EXIT_FAILURE)
+        {
+                free (acis_data->data);
+                acis_data->data = data;
+                acis_data->length = length;
+                acis_data->size = size;
+                acis_data->number_of_lines = number_of_lines;
+                return (NULL);
+        }
+        free (data);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis_data);
+}
+
+
+/*!
+ * \brief Get the number of group code 1 and 3 lines from a DXF
+ * proprietary (ACIS) data object.
+ *
+ * \return the number of lines, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_acis_data_get_number_of_lines
+(
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (acis_data->number_of_lines);
+}
+
+
+/* EOF */
@@ -0,0 +1,102 @@
+/*!
+ * \file acis_data.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for DXF proprietary (ACIS) data of modeler geometry
+ * entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_ACIS_DATA_H
+#define LIBDXF_SRC_ACIS_DATA_H
+
+
+#include "global.h"
+#include "proprietary_data.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_ACIS_DATA_LINE_LENGTH 255
+        /*!< \brief Maximum number of characters in a group code 1 or 3
+         * line of proprietary data. */
+
+
+/*!
+ * \brief DXF definition of the proprietary (ACIS) data of a modeler
+ * geometry entity.
+ *
+ * The group code 1 and group code 3 lines of the \c 3DSOLID, \c BODY,
+ * \c REGION and \c SURFACE entities are kept as read, group codes
+ * included, in one buffer.\n
+ * The data is written back verbatim, the SAT text is only decoded when
+ * requested by dxf_acis_data_get_sat ().
+ */
+typedef struct
+dxf_acis_data_struct
+{
+        char *data;
+                /*!< Group code and value lines of the proprietary data
+                 * as written in the DXF file.\n
+                 * Group codes = 1 and 3. */
+        int length;
+                /*!< Number of characters in the \c data member. */
+        int size;
+                /*!< Number of characters allocated for the \c data
+                 * member. */
+        int number_of_lines;
+                /*!< Number of group code 1 and 3 lines in the \c data
+                 * member. */
+} DxfAcisData;
+
+
+DxfAcisData *dxf_acis_data_new ();
+DxfAcisData *dxf_acis_data_init (DxfAcisData *acis_data);
+int dxf_acis_data_write (DxfFile *fp, DxfAcisData *acis_data);
+int dxf_acis_data_free (DxfAcisData *acis_data);
+int dxf_acis_data_append_line (DxfAcisData *acis_data, int group_code, const char *line);
+char *dxf_acis_data_get_sat (DxfAcisData *acis_data);
+DxfAcisData *dxf_acis_data_set_sat (DxfAcisData *acis_data, const char *sat);
+DxfProprietaryData *dxf_acis_data_get_lines (DxfAcisData *acis_data, int group_code);
+DxfAcisData *dxf_acis_data_set_lines (DxfAcisData *acis_data, int group_code, DxfProprietaryData *lines);
+int dxf_acis_data_get_number_of_lines (DxfAcisData *acis_data);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_ACIS_DATA_H */
+
+
+/* EOF */
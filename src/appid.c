@@ -57,6 +57,7 @@
 
 
 #include "appid.h"
+#include "util.h"
 
 
 /*!
@@ -164,7 +165,7 @@ dxf_appid_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -173,21 +174,20 @@ dxf_appid_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (appid == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 appid = dxf_appid_init (appid);
         }
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -195,8 +195,6 @@ dxf_appid_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -210,8 +208,7 @@ dxf_appid_read
                 {
                         /* Now follows a string containing an application
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->application_name);
+                        dxf_read_string (&appid->application_name, fp);
                 }
                 else if (strcmp (temp_string, "70") == 0)
                 {
@@ -226,15 +223,13 @@ dxf_appid_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->dictionary_owner_soft);
+                                dxf_read_string (&appid->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->object_owner_soft);
+                                dxf_read_string (&appid->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -242,25 +237,26 @@ dxf_appid_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, appid->dictionary_owner_hard);
+                        dxf_read_string (&appid->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -443,6 +439,7 @@ dxf_appid_free_list
         while (appids != NULL)
         {
                 DxfAppid *iter = (DxfAppid *) appids->next;
+                appids->next = NULL;
                 dxf_appid_free (appids);
                 appids = (DxfAppid *) iter;
         }
@@ -1175,9 +1172,6 @@ dxf_appid_get_last
         }
         if (appid->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfAppid *) appid);
         }
         DxfAppid *iter = (DxfAppid *) appid->next;
@@ -39,7 +39,12 @@
  */
 
 
+/* The checked getters are defined here, also for trusted input. */
+#define DXF_CHECKED_GETTERS 1
+
+
 #include "arc.h"
+#include "util.h"
 
 
 /*!
@@ -139,9 +144,6 @@ dxf_arc_init
         arc->color_value = 0;
         arc->color_name = strdup ("");
         arc->transparency = 0;
-        arc->p0->x0 = 0.0;
-        arc->p0->y0 = 0.0;
-        arc->p0->z0 = 0.0;
         arc->radius = 0.0;
         arc->start_angle = 0.0;
         arc->end_angle = 0.0;
@@ -186,8 +188,7 @@ dxf_arc_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -196,25 +197,23 @@ dxf_arc_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (arc == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 arc = dxf_arc_init (arc);
         }
         if (arc->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                arc->binary_graphics_data = dxf_binary_data_init (arc->binary_graphics_data);
+                arc->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (arc->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -225,12 +224,11 @@ dxf_arc_read
         }
         if (arc->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                arc->p0 = dxf_point_init (arc->p0);
+                arc->p0 = dxf_point_init (dxf_point_new ());
                 if (arc->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -239,11 +237,10 @@ dxf_arc_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) arc->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -251,8 +248,6 @@ dxf_arc_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -266,14 +261,12 @@ dxf_arc_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->linetype);
+                        dxf_read_string (&arc->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->layer);
+                        dxf_read_string (&arc->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -372,12 +365,12 @@ dxf_arc_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbCircle") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -421,10 +414,8 @@ dxf_arc_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, arc->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -432,15 +423,13 @@ dxf_arc_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_soft);
+                                dxf_read_string (&arc->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->object_owner_soft);
+                                dxf_read_string (&arc->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -448,15 +437,13 @@ dxf_arc_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->material);
+                        dxf_read_string (&arc->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->dictionary_owner_hard);
+                        dxf_read_string (&arc->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -469,8 +456,7 @@ dxf_arc_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->plot_style_name);
+                        dxf_read_string (&arc->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -482,8 +468,7 @@ dxf_arc_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, arc->color_name);
+                        dxf_read_string (&arc->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -495,16 +480,20 @@ dxf_arc_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (arc->linetype, "") == 0)
@@ -515,8 +504,6 @@ dxf_arc_read
         {
                 arc->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -731,13 +718,7 @@ dxf_arc_write
 #endif
                 if (arc->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) arc->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, arc->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -825,7 +806,10 @@ dxf_arc_free
         }
         free (arc->linetype);
         free (arc->layer);
-        dxf_binary_data_free (arc->binary_graphics_data);
+        if (arc->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (arc->binary_graphics_data);
+        }
         free (arc->dictionary_owner_soft);
         free (arc->object_owner_soft);
         free (arc->material);
@@ -869,6 +853,7 @@ dxf_arc_free_list
         while (arcs != NULL)
         {
                 DxfArc *iter = (DxfArc *) arcs->next;
+                arcs->next = NULL;
                 dxf_arc_free (arcs);
                 arcs = (DxfArc *) iter;
         }
@@ -3814,9 +3799,6 @@ dxf_arc_get_last
         }
         if (arc->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfArc *) arc);
         }
         DxfArc *iter = (DxfArc *) arc->next;
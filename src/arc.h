@@ -295,6 +295,106 @@ DxfArc *dxf_arc_set_next (DxfArc *arc, DxfArc *next);
 DxfArc *dxf_arc_get_last (DxfArc *arc);
 
 
+/*!
+ * \name Unchecked getters.
+ *
+ * Inline getters without checks for use in hot loops, on a \c ARC
+ * entity which passed \c dxf_entities_validate ().
+ */
+/*! \{ */
+
+
+static inline DxfPoint *
+dxf_arc_get_p0_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->p0);
+}
+
+
+static inline double
+dxf_arc_get_x0_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->p0->x0);
+}
+
+
+static inline double
+dxf_arc_get_y0_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->p0->y0);
+}
+
+
+static inline double
+dxf_arc_get_z0_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->p0->z0);
+}
+
+
+static inline double
+dxf_arc_get_radius_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->radius);
+}
+
+
+static inline double
+dxf_arc_get_start_angle_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->start_angle);
+}
+
+
+static inline double
+dxf_arc_get_end_angle_unchecked
+(
+        DxfArc *arc
+                /*!< a pointer to a DXF \c ARC entity. */
+)
+{
+        return (arc->end_angle);
+}
+
+
+/*! \} */
+
+
+#if DXF_TRUSTED_INPUT && !defined (DXF_CHECKED_GETTERS)
+#  define dxf_arc_get_p0(arc) dxf_arc_get_p0_unchecked (arc)
+#  define dxf_arc_get_x0(arc) dxf_arc_get_x0_unchecked (arc)
+#  define dxf_arc_get_y0(arc) dxf_arc_get_y0_unchecked (arc)
+#  define dxf_arc_get_z0(arc) dxf_arc_get_z0_unchecked (arc)
+#  define dxf_arc_get_radius(arc) dxf_arc_get_radius_unchecked (arc)
+#  define dxf_arc_get_start_angle(arc) dxf_arc_get_start_angle_unchecked (arc)
+#  define dxf_arc_get_end_angle(arc) dxf_arc_get_end_angle_unchecked (arc)
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -40,6 +40,7 @@
 
 
 #include "attdef.h"
+#include "util.h"
 
 
 /*!
@@ -181,8 +182,7 @@ dxf_attdef_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -191,13 +191,12 @@ dxf_attdef_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attdef == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attdef = dxf_attdef_init (attdef);
@@ -211,12 +210,11 @@ dxf_attdef_read
         }
         if (attdef->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                attdef->binary_graphics_data = dxf_binary_data_init (attdef->binary_graphics_data);
+                attdef->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (attdef->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -227,12 +225,11 @@ dxf_attdef_read
         }
         if (attdef->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attdef->p0 = dxf_point_init (attdef->p0);
+                attdef->p0 = dxf_point_init (dxf_point_new ());
                 if (attdef->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -243,12 +240,11 @@ dxf_attdef_read
         }
         if (attdef->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attdef->p1 = dxf_point_init (attdef->p1);
+                attdef->p1 = dxf_point_init (dxf_point_new ());
                 if (attdef->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -257,11 +253,10 @@ dxf_attdef_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) attdef->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -269,29 +264,24 @@ dxf_attdef_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing the attribute
                          * default value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->default_value);
+                        dxf_read_string (&attdef->default_value, fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a tag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->tag_value);
+                        dxf_read_string (&attdef->tag_value, fp);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a prompt
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->prompt_value);
+                        dxf_read_string (&attdef->prompt_value, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -304,20 +294,17 @@ dxf_attdef_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->linetype);
+                        dxf_read_string (&attdef->linetype, fp);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->text_style);
+                        dxf_read_string (&attdef->text_style, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->layer);
+                        dxf_read_string (&attdef->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -486,13 +473,13 @@ dxf_attdef_read
                          * version should probably be added here.
                          * Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbText") != 0)
                         && (strcmp (temp_string, "AcDbAttributeDefinition") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -536,10 +523,8 @@ dxf_attdef_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, attdef->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -547,15 +532,13 @@ dxf_attdef_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->dictionary_owner_soft);
+                                dxf_read_string (&attdef->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->object_owner_soft);
+                                dxf_read_string (&attdef->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -563,15 +546,13 @@ dxf_attdef_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->material);
+                        dxf_read_string (&attdef->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->dictionary_owner_hard);
+                        dxf_read_string (&attdef->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -584,8 +565,7 @@ dxf_attdef_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->plot_style_name);
+                        dxf_read_string (&attdef->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -597,8 +577,7 @@ dxf_attdef_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attdef->color_name);
+                        dxf_read_string (&attdef->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -610,16 +589,20 @@ dxf_attdef_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attdef->linetype, "") == 0)
@@ -630,8 +613,6 @@ dxf_attdef_read
         {
                 attdef->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -816,13 +797,7 @@ dxf_attdef_write
 #endif
                 if (attdef->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) attdef->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, attdef->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -954,7 +929,10 @@ dxf_attdef_free
         }
         free (attdef->linetype);
         free (attdef->layer);
-        dxf_binary_data_free_list (attdef->binary_graphics_data);
+        if (attdef->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (attdef->binary_graphics_data);
+        }
         free (attdef->dictionary_owner_soft);
         free (attdef->object_owner_soft);
         free (attdef->material);
@@ -1000,6 +978,7 @@ dxf_attdef_free_list
         while (attdefs != NULL)
         {
                 DxfAttdef *iter = (DxfAttdef *) attdefs->next;
+                attdefs->next = NULL;
                 dxf_attdef_free (attdefs);
                 attdefs = (DxfAttdef *) iter;
         }
@@ -4885,9 +4864,6 @@ dxf_attdef_get_last
         }
         if (attdef->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfAttdef *) attdef);
         }
         DxfAttdef *iter = (DxfAttdef *) attdef->next;
@@ -40,6 +40,7 @@
 
 
 #include "attrib.h"
+#include "util.h"
 
 
 /*!
@@ -181,8 +182,7 @@ dxf_attrib_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -191,13 +191,12 @@ dxf_attrib_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (attrib == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 attrib = dxf_attrib_init (attrib);
@@ -211,12 +210,11 @@ dxf_attrib_read
         }
         if (attrib->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                attrib->binary_graphics_data = dxf_binary_data_init (attrib->binary_graphics_data);
+                attrib->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (attrib->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -227,12 +225,11 @@ dxf_attrib_read
         }
         if (attrib->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attrib->p0 = dxf_point_init (attrib->p0);
+                attrib->p0 = dxf_point_init (dxf_point_new ());
                 if (attrib->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -243,12 +240,11 @@ dxf_attrib_read
         }
         if (attrib->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                attrib->p1 = dxf_point_init (attrib->p1);
+                attrib->p1 = dxf_point_init (dxf_point_new ());
                 if (attrib->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -257,11 +253,10 @@ dxf_attrib_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) attrib->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -269,22 +264,18 @@ dxf_attrib_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing the attribute
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->default_value);
+                        dxf_read_string (&attrib->default_value, fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a tag value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->tag_value);
+                        dxf_read_string (&attrib->tag_value, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -297,20 +288,17 @@ dxf_attrib_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->linetype);
+                        dxf_read_string (&attrib->linetype, fp);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->text_style);
+                        dxf_read_string (&attrib->text_style, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->layer);
+                        dxf_read_string (&attrib->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -479,13 +467,13 @@ dxf_attrib_read
                          * version should probably be added here.
                          * Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbText") != 0)
                         && (strcmp (temp_string, "AcDbAttribute") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -529,10 +517,8 @@ dxf_attrib_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, attrib->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -540,15 +526,13 @@ dxf_attrib_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->dictionary_owner_soft);
+                                dxf_read_string (&attrib->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->object_owner_soft);
+                                dxf_read_string (&attrib->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -556,15 +540,13 @@ dxf_attrib_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->material);
+                        dxf_read_string (&attrib->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->dictionary_owner_hard);
+                        dxf_read_string (&attrib->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -577,8 +559,7 @@ dxf_attrib_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->plot_style_name);
+                        dxf_read_string (&attrib->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -590,8 +571,7 @@ dxf_attrib_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, attrib->color_name);
+                        dxf_read_string (&attrib->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -603,16 +583,20 @@ dxf_attrib_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (attrib->linetype, "") == 0)
@@ -623,12 +607,10 @@ dxf_attrib_read
         {
                 attrib->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (attrib);
 }
 
 
@@ -824,13 +806,7 @@ dxf_attrib_write
 #endif
                 if (attrib->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) attrib->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, attrib->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -964,7 +940,10 @@ dxf_attrib_free
         }
         free (attrib->linetype);
         free (attrib->layer);
-        dxf_binary_data_free_list (attrib->binary_graphics_data);
+        if (attrib->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (attrib->binary_graphics_data);
+        }
         free (attrib->dictionary_owner_soft);
         free (attrib->object_owner_soft);
         free (attrib->material);
@@ -1009,6 +988,7 @@ dxf_attrib_free_list
         while (attribs != NULL)
         {
                 DxfAttrib *iter = (DxfAttrib *) attribs->next;
+                attribs->next = NULL;
                 dxf_attrib_free (attribs);
                 attribs = (DxfAttrib *) iter;
         }
@@ -4806,9 +4786,6 @@ dxf_attrib_get_last
         }
         if (attrib->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfAttrib *) attrib);
         }
         DxfAttrib *iter = (DxfAttrib *) attrib->next;
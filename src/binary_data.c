@@ -34,6 +34,7 @@
 
 
 #include "binary_data.h"
+#include "simd.h"
 
 
 /*!
@@ -104,8 +105,9 @@ dxf_binary_data_init
                 return (NULL);
         }
         data->order = 0;
-        data->data_line = strdup ("");
+        data->data = NULL;
         data->length = 0;
+        data->size = 0;
         data->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -117,6 +119,8 @@ dxf_binary_data_init
 /*!
  * \brief Write DXF output to fp for a binary data object.
  *
+ * The data is written in binary chunk records (group code 310).
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
  */
@@ -128,12 +132,41 @@ dxf_binary_data_write
         DxfBinaryData *data
                 /*!< a pointer to the binary data object. */
 )
+{
+        return (dxf_binary_data_write_chunks (fp, 310, data));
+}
+
+
+/*!
+ * \brief Write DXF output to fp for a binary data object, in records
+ * with the given group code.
+ *
+ * Every record holds \c DXF_BINARY_DATA_CHUNK_SIZE bytes in
+ * hexadecimal digits, the last record holds the remaining bytes.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_write_chunks
+(
+        DxfFile *fp,
+                /*!< file pointer to output file (or device). */
+        int group_code,
+                /*!< Group code of the records. */
+        DxfBinaryData *data
+                /*!< a pointer to the binary data object. */
+)
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        char line[2 * DXF_BINARY_DATA_CHUNK_SIZE + 1];
+        int n;
+        int i;
+
         /* Do some basic checks. */
-        if (fp == NULL)
+        if ((fp == NULL) || (data == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
@@ -141,7 +174,16 @@ dxf_binary_data_write
                 return (EXIT_FAILURE);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "310\n%s\n", data->data_line);
+        for (i = 0; i < data->length; i += DXF_BINARY_DATA_CHUNK_SIZE)
+        {
+                n = data->length - i;
+                if (n > DXF_BINARY_DATA_CHUNK_SIZE)
+                {
+                        n = DXF_BINARY_DATA_CHUNK_SIZE;
+                }
+                dxf_binary_data_encode_hex (data->data + i, n, line);
+                fprintf (fp->fp, "%3d\n%s\n", group_code, line);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -182,7 +224,7 @@ dxf_binary_data_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (data->data_line);
+        free (data->data);
         free (data);
         data = NULL;
 #if DEBUG
@@ -204,7 +246,7 @@ dxf_binary_data_free_list
                  * data objects. */
 )
 {
-#ifdef DEBUG
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -217,6 +259,7 @@ dxf_binary_data_free_list
         while (data != NULL)
         {
                 DxfBinaryData *iter = (DxfBinaryData *) data->next;
+                data->next = NULL;
                 dxf_binary_data_free (data);
                 data = (DxfBinaryData *) iter;
         }
@@ -226,6 +269,372 @@ dxf_binary_data_free_list
 }
 
 
+/*!
+ * \brief Values of the hexadecimal digits plus one, \c 0 for other
+ * characters.
+ */
+static const unsigned char dxf_binary_data_hex_table[256] =
+{
+        ['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5,
+        ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+        ['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16,
+        ['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16
+};
+
+
+/*!
+ * \brief Portable hexadecimal decoder.
+ */
+static int
+dxf_binary_data_decode_hex_scalar
+(
+        const unsigned char *s,
+        unsigned char *bytes,
+        int length
+)
+{
+        int high;
+        int low;
+        int i;
+
+        for (i = 0; i < length; i++)
+        {
+                high = dxf_binary_data_hex_table[s[2 * i]];
+                if (high == 0)
+                {
+                        break;
+                }
+                low = dxf_binary_data_hex_table[s[2 * i + 1]];
+                if (low == 0)
+                {
+                        break;
+                }
+                bytes[i] = (unsigned char) (((high - 1) << 4) | (low - 1));
+        }
+        return (i);
+}
+
+
+#ifdef DXF_SIMD_X86
+/*!
+ * \brief SSE2 hexadecimal decoder, 16 digits per iteration.
+ *
+ * A block holding another character than a hexadecimal digit is left
+ * to the scalar decoder, which stops at that character.
+ */
+__attribute__ ((target ("sse2")))
+static int
+dxf_binary_data_decode_hex_sse2
+(
+        const unsigned char *s,
+        unsigned char *bytes,
+        int length
+)
+{
+        __m128i c;
+        __m128i lower;
+        __m128i digit;
+        __m128i alpha;
+        __m128i nibbles;
+        __m128i pairs;
+        int i;
+
+        for (i = 0; i + 8 <= length; i += 8)
+        {
+                c = _mm_loadu_si128 ((const __m128i *) (s + 2 * i));
+                lower = _mm_or_si128 (c, _mm_set1_epi8 (0x20));
+                digit = _mm_and_si128 (_mm_cmpgt_epi8 (c, _mm_set1_epi8 ('0' - 1)),
+                  _mm_cmplt_epi8 (c, _mm_set1_epi8 ('9' + 1)));
+                alpha = _mm_and_si128 (_mm_cmpgt_epi8 (lower, _mm_set1_epi8 ('a' - 1)),
+                  _mm_cmplt_epi8 (lower, _mm_set1_epi8 ('f' + 1)));
+                if (_mm_movemask_epi8 (_mm_or_si128 (digit, alpha)) != 0xFFFF)
+                {
+                        break;
+                }
+                nibbles = _mm_or_si128
+                  (_mm_and_si128 (digit, _mm_sub_epi8 (c, _mm_set1_epi8 ('0'))),
+                  _mm_and_si128 (alpha, _mm_sub_epi8 (lower, _mm_set1_epi8 ('a' - 10))));
+                /* The high nibble is the even (low) byte of each
+                 * 16 bit word, the low nibble the odd (high) byte. */
+                pairs = _mm_or_si128
+                  (_mm_slli_epi16 (_mm_and_si128 (nibbles, _mm_set1_epi16 (0x00FF)), 4),
+                  _mm_srli_epi16 (nibbles, 8));
+                _mm_storel_epi64 ((__m128i *) (bytes + i), _mm_packus_epi16 (pairs, pairs));
+        }
+        return (i + dxf_binary_data_decode_hex_scalar (s + 2 * i,
+          bytes + i, length - i));
+}
+
+
+/*!
+ * \brief AVX2 hexadecimal decoder, 32 digits per iteration.
+ *
+ * A block holding another character than a hexadecimal digit is left
+ * to the scalar decoder, which stops at that character.
+ */
+__attribute__ ((target ("avx2")))
+static int
+dxf_binary_data_decode_hex_avx2
+(
+        const unsigned char *s,
+        unsigned char *bytes,
+        int length
+)
+{
+        __m256i c;
+        __m256i lower;
+        __m256i digit;
+        __m256i alpha;
+        __m256i nibbles;
+        __m256i pairs;
+        int i;
+
+        for (i = 0; i + 16 <= length; i += 16)
+        {
+                c = _mm256_loadu_si256 ((const __m256i *) (s + 2 * i));
+                lower = _mm256_or_si256 (c, _mm256_set1_epi8 (0x20));
+                digit = _mm256_andnot_si256 (_mm256_cmpgt_epi8 (c, _mm256_set1_epi8 ('9')),
+                  _mm256_cmpgt_epi8 (c, _mm256_set1_epi8 ('0' - 1)));
+                alpha = _mm256_andnot_si256 (_mm256_cmpgt_epi8 (lower, _mm256_set1_epi8 ('f')),
+                  _mm256_cmpgt_epi8 (lower, _mm256_set1_epi8 ('a' - 1)));
+                if (_mm256_movemask_epi8 (_mm256_or_si256 (digit, alpha)) != -1)
+                {
+                        break;
+                }
+                nibbles = _mm256_or_si256
+                  (_mm256_and_si256 (digit, _mm256_sub_epi8 (c, _mm256_set1_epi8 ('0'))),
+                  _mm256_and_si256 (alpha, _mm256_sub_epi8 (lower, _mm256_set1_epi8 ('a' - 10))));
+                pairs = _mm256_or_si256
+                  (_mm256_slli_epi16 (_mm256_and_si256 (nibbles, _mm256_set1_epi16 (0x00FF)), 4),
+                  _mm256_srli_epi16 (nibbles, 8));
+                /* Packing works per 128 bit lane, gather the low
+                 * halves of both lanes. */
+                pairs = _mm256_permute4x64_epi64 (_mm256_packus_epi16 (pairs, pairs), 0x08);
+                _mm_storeu_si128 ((__m128i *) (bytes + i), _mm256_castsi256_si128 (pairs));
+        }
+        return (i + dxf_binary_data_decode_hex_sse2 (s + 2 * i,
+          bytes + i, length - i));
+}
+#endif
+
+
+/*!
+ * \brief Decode at most \c length bytes from a string of hexadecimal
+ * digits.
+ *
+ * Decoding stops at the first character which is no hexadecimal digit,
+ * a trailing odd digit is ignored.\n
+ * \c hex must hold at least 2 * \c length characters, the SIMD
+ * instruction set selected with dxf_simd_set () is used for
+ * long strings.
+ *
+ * \return the number of decoded bytes.
+ */
+int
+dxf_binary_data_decode_hex
+(
+        const char *hex,
+                /*!< String of hexadecimal digits. */
+        unsigned char *bytes,
+                /*!< Buffer receiving the bytes. */
+        int length
+                /*!< Size of \c bytes. */
+)
+{
+        const unsigned char *s = (const unsigned char *) hex;
+
+        switch (dxf_simd_get ())
+        {
+#ifdef DXF_SIMD_X86
+                case DXF_SIMD_AVX2:
+                        return (dxf_binary_data_decode_hex_avx2 (s, bytes, length));
+                case DXF_SIMD_SSE2:
+                        return (dxf_binary_data_decode_hex_sse2 (s, bytes, length));
+#endif
+                default:
+                        return (dxf_binary_data_decode_hex_scalar (s, bytes, length));
+        }
+}
+
+
+/*!
+ * \brief Encode bytes in a string of upper case hexadecimal digits.
+ *
+ * \c hex must hold \c 2 * \c length + 1 characters.
+ */
+void
+dxf_binary_data_encode_hex
+(
+        const unsigned char *bytes,
+                /*!< Bytes to be encoded. */
+        int length,
+                /*!< Number of bytes. */
+        char *hex
+                /*!< Buffer receiving the string. */
+)
+{
+        static const char digits[] = "0123456789ABCDEF";
+        int i;
+
+        for (i = 0; i < length; i++)
+        {
+                hex[2 * i] = digits[bytes[i] >> 4];
+                hex[2 * i + 1] = digits[bytes[i] & 15];
+        }
+        hex[2 * length] = '\0';
+}
+
+
+/*!
+ * \brief Make room for \c length bytes in a binary data object.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_binary_data_reserve
+(
+        DxfBinaryData *data,
+        int length
+)
+{
+        unsigned char *bytes;
+        int size;
+
+        if (length <= data->size)
+        {
+                return (EXIT_SUCCESS);
+        }
+        size = (data->size > 0) ? data->size : 256;
+        while ((size < length) && (size <= INT_MAX / 2))
+        {
+                size *= 2;
+        }
+        if (size < length)
+        {
+                size = length;
+        }
+        bytes = realloc (data->data, (size_t) size);
+        if (bytes == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        data->data = bytes;
+        data->size = size;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append bytes to a binary data object.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_binary_data_append
+(
+        DxfBinaryData *data,
+                /*!< a pointer to a binary data object. */
+        const unsigned char *bytes,
+                /*!< Bytes to be appended. */
+        int length
+                /*!< Number of bytes. */
+)
+{
+        /* Do some basic checks. */
+        if ((data == NULL) || ((bytes == NULL) && (length > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((length < 0) || (length > INT_MAX - data->length))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid length was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_binary_data_reserve (data, data->length + length) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (length > 0)
+        {
+                memcpy (data->data + data->length, bytes, (size_t) length);
+        }
+        data->length += length;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the bytes of a binary chunk record, a string of
+ * hexadecimal digits, to a binary data object.
+ *
+ * A record holding other characters than hexadecimal digits is
+ * reported to the diagnostics sink of \c fp, the bytes before the
+ * invalid character are appended.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * string holds other characters than hexadecimal digits or an error
+ * occurred.
+ */
+int
+dxf_binary_data_append_hex
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to the input file (or device) the
+                 * record was read from, may be \c NULL. */
+        DxfBinaryData *data,
+                /*!< a pointer to a binary data object. */
+        const char *hex
+                /*!< String of hexadecimal digits. */
+)
+{
+        int length;
+        int position;
+        int n;
+
+        /* Do some basic checks. */
+        if ((data == NULL) || (hex == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        length = (int) strlen (hex);
+        if (dxf_binary_data_reserve (data, data->length + length / 2) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        n = dxf_binary_data_decode_hex (hex, data->data + data->length, length / 2);
+        data->length += n;
+        if ((n != length / 2) || (length % 2))
+        {
+                /* Find the invalid character, or the odd last digit. */
+                position = 2 * n;
+                if ((n < length / 2)
+                  && (dxf_binary_data_hex_table[(unsigned char) hex[position]] != 0))
+                {
+                        position++;
+                }
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_INVALID_BINARY_DATA,
+                  (_("Warning in %s () invalid hexadecimal data at character %d of a binary chunk record.\n")),
+                  __FUNCTION__, position + 1);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Get the \c order from a binary data object.
  *
@@ -303,9 +712,81 @@ dxf_binary_data_set_order
 
 
 /*!
- * \brief Get the data_line from a binary data object.
+ * \brief Get the \c data from a binary data object.
+ *
+ * \return the \c length bytes of \c data, \c NULL when there is no
+ * data or an error occurred.
+ */
+unsigned char *
+dxf_binary_data_get_data
+(
+        DxfBinaryData *data
+                /*!< a pointer to a binary data object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data->data);
+}
+
+
+/*!
+ * \brief Set the \c data for a binary data object.
+ *
+ * The bytes are copied, replacing the previous data.
+ */
+DxfBinaryData *
+dxf_binary_data_set_data
+(
+        DxfBinaryData *data,
+                /*!< a pointer to a binary data object. */
+        const unsigned char *bytes,
+                /*!< Bytes to be set for the object. */
+        int length
+                /*!< Number of bytes. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        data->length = 0;
+        if (dxf_binary_data_append (data, bytes, length) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (data);
+}
+
+
+/*!
+ * \brief Get the \c data from a binary data object as a string of
+ * hexadecimal digits.
  *
- * \return \c data_line when sucessful, \c NULL when an error occurred.
+ * \return a newly allocated string when sucessful, \c NULL when an
+ * error occurred.
  */
 char *
 dxf_binary_data_get_data_line
@@ -317,6 +798,8 @@ dxf_binary_data_get_data_line
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        char *data_line;
+
         /* Do some basic checks. */
         if (data == NULL)
         {
@@ -325,22 +808,25 @@ dxf_binary_data_get_data_line
                   __FUNCTION__);
                 return (NULL);
         }
-        if (data->data_line ==  NULL)
+        data_line = malloc (2 * (size_t) data->length + 1);
+        if (data_line == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_binary_data_encode_hex (data->data, data->length, data_line);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (strdup (data->data_line));
+        return (data_line);
 }
 
 
 /*!
- * \brief Set the \c data_line for a binary data object.
+ * \brief Set the \c data for a binary data object from a string of
+ * hexadecimal digits.
  */
 DxfBinaryData *
 dxf_binary_data_set_data_line
@@ -348,8 +834,8 @@ dxf_binary_data_set_data_line
         DxfBinaryData *data,
                 /*!< a pointer to a binary data object. */
         char *data_line
-                /*!< a string containing the \c data_line for the
-                 * entity. */
+                /*!< a string of hexadecimal digits containing the
+                 * \c data for the entity. */
 )
 {
 #if DEBUG
@@ -370,7 +856,14 @@ dxf_binary_data_set_data_line
                   __FUNCTION__);
                 return (NULL);
         }
-        data->data_line = strdup (data_line);
+        data->length = 0;
+        if (dxf_binary_data_append_hex (NULL, data, data_line) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () invalid hexadecimal data was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -381,7 +874,8 @@ dxf_binary_data_set_data_line
 /*!
  * \brief Get the \c length from a binary data object.
  *
- * \return \c length.
+ * \return \c length, the number of decoded bytes, which is half the
+ * number of hexadecimal digits of the binary chunk records.
  */
 int
 dxf_binary_data_get_length
@@ -417,6 +911,8 @@ dxf_binary_data_get_length
 /*!
  * \brief Set the \c length for a binary data object.
  *
+ * The data is truncated, or extended with zero bytes.
+ *
  * \return a pointer to \c data when sucessful, \c NULL when an error
  * occurred.
  */
@@ -443,8 +939,17 @@ dxf_binary_data_set_length
         if (length < 0)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
+                  (_("Error in %s () a negative value was passed.\n")),
                   __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_binary_data_reserve (data, length) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        if (length > data->length)
+        {
+                memset (data->data + data->length, 0, (size_t) (length - data->length));
         }
         data->length = length;
 #if DEBUG
@@ -562,9 +1067,6 @@ dxf_binary_data_get_last
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfBinaryData *) data);
         }
         DxfBinaryData *iter = (DxfBinaryData *) data->next;
@@ -45,22 +45,36 @@ extern "C" {
 #endif
 
 
+#define DXF_BINARY_DATA_CHUNK_SIZE 127
+        /*!< \brief Number of bytes written in a binary chunk record. */
+
+
 /*!
  * \brief DXF definition of an AutoCAD binary data object.
+ *
+ * The binary chunk records (group code 310) of a blob are decoded once
+ * into one buffer, and encoded in chunks of
+ * \c DXF_BINARY_DATA_CHUNK_SIZE bytes when written.
  */
 typedef struct
 dxf_binary_data_struct
 {
         int order;
                 /*!< Incremental counter for storing order of data
-                 * lines. */
-        char *data_line;
-                /*!< Binary entity data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
+                 * objects. */
+        unsigned char *data;
+                /*!< Binary data, decoded from multiple lines of 256
+                 * hexadecimal digits maximum per line (optional).\n
                  * Group code = 310. */
         int length;
-                /*!< Length of the \c data_line member. */
+                /*!< Number of bytes in the \c data member.\n
+                 * This is a count of decoded bytes, not of the
+                 * hexadecimal characters in the group code 310 lines,
+                 * so dxf_binary_data_get_length () returns half the
+                 * number of digits read. */
+        int size;
+                /*!< Number of bytes allocated for the \c data
+                 * member. */
         struct DxfBinaryData *next;
                 /*!< Pointer to the next DxfBinaryData.\n
                  * \c NULL if the last DxfBinaryData. */
@@ -70,10 +84,17 @@ dxf_binary_data_struct
 DxfBinaryData *dxf_binary_data_new ();
 DxfBinaryData *dxf_binary_data_init (DxfBinaryData *data);
 int dxf_binary_data_write (DxfFile *fp, DxfBinaryData *data);
+int dxf_binary_data_write_chunks (DxfFile *fp, int group_code, DxfBinaryData *data);
 int dxf_binary_data_free (DxfBinaryData *data);
 void dxf_binary_data_free_list (DxfBinaryData *data);
+int dxf_binary_data_decode_hex (const char *hex, unsigned char *bytes, int length);
+void dxf_binary_data_encode_hex (const unsigned char *bytes, int length, char *hex);
+int dxf_binary_data_append (DxfBinaryData *data, const unsigned char *bytes, int length);
+int dxf_binary_data_append_hex (DxfFile *fp, DxfBinaryData *data, const char *hex);
 int dxf_binary_data_get_order (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_order (DxfBinaryData *data, int order);
+unsigned char *dxf_binary_data_get_data (DxfBinaryData *data);
+DxfBinaryData *dxf_binary_data_set_data (DxfBinaryData *data, const unsigned char *bytes, int length);
 char *dxf_binary_data_get_data_line (DxfBinaryData *data);
 DxfBinaryData *dxf_binary_data_set_data_line (DxfBinaryData *data, char *data_line);
 int dxf_binary_data_get_length (DxfBinaryData *data);
@@ -33,91 +33,43 @@
  */
 
 
+
 #include "binary_entity_data.h"
 
 
 /*!
  * \brief Allocate memory for a binary entity data object.
  *
- * Fill the memory contents with zeros.
+ * \deprecated Use dxf_binary_data_new ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_new ()
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        DxfBinaryEntityData *data = NULL;
-        size_t size;
-
-        size = sizeof (DxfBinaryEntityData);
-        /* avoid malloc of 0 bytes */
-        if (size == 0) size = 1;
-        if ((data = malloc (size)) == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () could not allocate memory.\n")),
-                  __FUNCTION__);
-                data = NULL;
-        }
-        else
-        {
-                memset (data, 0, size);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (data);
+        return (dxf_binary_data_new ());
 }
 
 
 /*!
- * \brief Allocate memory and initialize data fields in a binary
- * entity data entity.
- * 
- * \return \c NULL when no memory was allocated, a pointer to the
- * allocated memory when successful.
+ * \brief Allocate memory and initialize data fields in a binary entity data
+ * object.
+ *
+ * \deprecated Use dxf_binary_data_init ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_init
 (
         DxfBinaryEntityData *data
-                /*!< a pointer to the binary entity data object. */
+                /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                data = dxf_binary_entity_data_new ();
-        }
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () could not allocate memory.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        data->data_line = strdup ("");
-        data->length = 0;
-        data->next = NULL;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (data);
+        return (dxf_binary_data_init (data));
 }
 
 
 /*!
  * \brief Write DXF output to fp for a binary entity data object.
  *
- * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
- * occurred.
+ * \deprecated Use dxf_binary_data_write ().
  */
 int
 dxf_binary_entity_data_write
@@ -125,110 +77,51 @@ dxf_binary_entity_data_write
         DxfFile *fp,
                 /*!< file pointer to output file (or device). */
         DxfBinaryEntityData *data
-                /*!< a pointer to the binary entity data object. */
+                /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (fp == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        /* Start writing output. */
-        fprintf (fp->fp, "310\n%s\n", data->data_line);
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (EXIT_SUCCESS);
+        return (dxf_binary_data_write (fp, data));
 }
 
 
 /*!
- * \brief Free the allocated memory for a binary entity data object
- * and all it's data fields.
+ * \brief Free the allocated memory for a binary entity data object and all
+ * its data fields.
  *
- * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
- * occurred.
+ * \deprecated Use dxf_binary_data_free ().
  */
 int
 dxf_binary_entity_data_free
 (
         DxfBinaryEntityData *data
-                /*!< Pointer to the memory occupied by the binary
-                 * entity data entity. */
+                /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (data->next != NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () pointer to next was not NULL.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        free (data->data_line);
-        free (data);
-        data = NULL;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (EXIT_SUCCESS);
+        return (dxf_binary_data_free (data));
 }
 
 
 /*!
  * \brief Free the allocated memory for a single linked list of binary
  * entity data objects and all their data fields.
+ *
+ * \deprecated Use dxf_binary_data_free_list ().
  */
 void
 dxf_binary_entity_data_free_list
 (
         DxfBinaryEntityData *data
-                /*!< pointer to the single linked list of DXF binary
-                 * entity data objects. */
+                /*!< a pointer to a binary entity data object. */
 )
 {
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-        }
-        while (data != NULL)
-        {
-                DxfBinaryEntityData *iter = (DxfBinaryEntityData *) data->next;
-                dxf_binary_entity_data_free (data);
-                data = (DxfBinaryEntityData *) iter;
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
+        dxf_binary_data_free_list (data);
 }
 
 
 /*!
  * \brief Get the data_line from a binary entity data object.
  *
- * \return data_line when sucessful, \c NULL when an error occurred.
+ * \deprecated Use dxf_binary_data_get_data_line ().
  */
 char *
 dxf_binary_entity_data_get_data_line
@@ -237,33 +130,14 @@ dxf_binary_entity_data_get_data_line
                 /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (data->data_line ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (strdup (data->data_line));
+        return (dxf_binary_data_get_data_line (data));
 }
 
 
 /*!
  * \brief Set the data_line for a binary entity data object.
+ *
+ * \deprecated Use dxf_binary_data_set_data_line ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_set_data_line
@@ -271,39 +145,17 @@ dxf_binary_entity_data_set_data_line
         DxfBinaryEntityData *data,
                 /*!< a pointer to a binary entity data object. */
         char *data_line
-                /*!< a string containing the data_line for the entity. */
+                /*!< a string containing the hexadecimal data_line. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (data_line == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        data->data_line = strdup (data_line);
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (data);
+        return (dxf_binary_data_set_data_line (data, data_line));
 }
 
 
 /*!
  * \brief Get the \c length from a binary entity data object.
  *
- * \return \c length.
+ * \deprecated Use dxf_binary_data_get_length ().
  */
 int
 dxf_binary_entity_data_get_length
@@ -312,35 +164,14 @@ dxf_binary_entity_data_get_length
                 /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (data->length < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (data->length);
+        return (dxf_binary_data_get_length (data));
 }
 
 
 /*!
  * \brief Set the \c length for a binary entity data object.
  *
- * \return a pointer to \c data when sucessful, \c NULL when an error
- * occurred.
+ * \deprecated Use dxf_binary_data_set_length ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_set_length
@@ -348,31 +179,10 @@ dxf_binary_entity_data_set_length
         DxfBinaryEntityData *data,
                 /*!< a pointer to a binary entity data object. */
         int length
-                /*!< Length to be set for the entity. */
+                /*!< the number of bytes. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (length < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-        }
-        data->length = length;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (data);
+        return (dxf_binary_data_set_length (data, length));
 }
 
 
@@ -380,9 +190,7 @@ dxf_binary_entity_data_set_length
  * \brief Get the pointer to the next binary entity data object from a
  * binary entity data object.
  *
- * \return pointer to the next binary entity data object.
- *
- * \warning No checks are performed on the returned pointer.
+ * \deprecated Use dxf_binary_data_get_next ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_get_next
@@ -391,34 +199,15 @@ dxf_binary_entity_data_get_next
                 /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (data->next == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return ((DxfBinaryEntityData *) data->next);
+        return (dxf_binary_data_get_next (data));
 }
 
 
 /*!
- * \brief Set the pointer to the next binary entity data for a binary
- * entity data entity.
+ * \brief Set the pointer to the next binary entity data object for a
+ * binary entity data object.
+ *
+ * \deprecated Use dxf_binary_data_set_next ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_set_next
@@ -426,33 +215,10 @@ dxf_binary_entity_data_set_next
         DxfBinaryEntityData *data,
                 /*!< a pointer to a binary entity data object. */
         DxfBinaryEntityData *next
-                /*!< a pointer to the next binary entity data for the
-                 * entity. */
+                /*!< a pointer to the next binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (next == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        data->next = (struct DxfBinaryEntityData *) next;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (data);
+        return (dxf_binary_data_set_next (data, next));
 }
 
 
@@ -460,9 +226,7 @@ dxf_binary_entity_data_set_next
  * \brief Get the pointer to the last binary entity data object from a
  * linked list of binary entity data objects.
  *
- * \return pointer to the last binary entity data object.
- *
- * \warning No checks are performed on the returned pointer.
+ * \deprecated Use dxf_binary_data_get_last ().
  */
 DxfBinaryEntityData *
 dxf_binary_entity_data_get_last
@@ -471,33 +235,7 @@ dxf_binary_entity_data_get_last
                 /*!< a pointer to a binary entity data object. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (data->next == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return ((DxfBinaryEntityData *) data);
-        }
-        DxfBinaryEntityData *iter = (DxfBinaryEntityData *) data->next;
-        while (iter->next != NULL)
-        {
-                iter = (DxfBinaryEntityData *) iter->next;
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return ((DxfBinaryEntityData *) data->next);
+        return (dxf_binary_data_get_last (data));
 }
 
 
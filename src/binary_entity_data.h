@@ -38,6 +38,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 
 
 #ifdef __cplusplus
@@ -47,21 +48,12 @@ extern "C" {
 
 /*!
  * \brief DXF definition of an AutoCAD binary entity data object.
+ *
+ * \deprecated The group code 310 records are kept in a
+ * \c DxfBinaryData object, this type is an alias for it and the
+ * functions below call the dxf_binary_data_* () functions.
  */
-typedef struct
-dxf_binary_entity_data_struct
-{
-        char *data_line;
-                /*!< Binary entity data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310. */
-        int length;
-                /*!< Length of the data_line member. */
-        struct DxfBinaryEntityData *next;
-                /*!< Pointer to the next DxfBinaryEntityData.\n
-                 * \c NULL if the last DxfBinaryEntityData. */
-} DxfBinaryEntityData;
+typedef DxfBinaryData DxfBinaryEntityData;
 
 
 DxfBinaryEntityData *dxf_binary_entity_data_new ();
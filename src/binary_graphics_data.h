@@ -37,6 +37,7 @@
 
 
 #include "global.h"
+#include "binary_data.h"
 
 
 #ifdef __cplusplus
@@ -46,84 +47,26 @@ extern "C" {
 
 /*!
  * \brief DXF definition of an AutoCAD binary graphics data object.
+ *
+ * \deprecated The group code 310 records are kept in a
+ * \c DxfBinaryData object, this type is an alias for it and the
+ * functions below call the dxf_binary_data_* () functions.
  */
-typedef struct
-dxf_binary_graphics_data_struct
-{
-        char *data_line;
-                /*!< Binary graphics data.\n
-                 * Multiple lines of 256 characters maximum per line
-                 * (optional).\n
-                 * Group code = 310. */
-        int length;
-                /*!< Length of the data_line member. */
-        struct DxfBinaryGraphicsData *next;
-                /*!< Pointer to the next DxfBinaryGraphicsData.\n
-                 * \c NULL if the last DxfBinaryGraphicsData. */
-} DxfBinaryGraphicsData;
-
-
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_new ();
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_init
-(
-        DxfBinaryGraphicsData *data
-);
-int
-dxf_binary_graphics_data_write
-(
-        DxfFile *fp,
-        DxfBinaryGraphicsData *data
-);
-int
-dxf_binary_graphics_data_free
-(
-        DxfBinaryGraphicsData *data
-);
-void
-dxf_binary_graphics_data_free_list
-(
-        DxfBinaryGraphicsData *data
-);
-char *
-dxf_binary_graphics_data_get_data_line
-(
-        DxfBinaryGraphicsData *data
-);
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_set_data_line
-(
-        DxfBinaryGraphicsData *data,
-        char *data_line
-);
-int
-dxf_binary_graphics_data_get_length
-(
-        DxfBinaryGraphicsData *data
-);
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_set_length
-(
-        DxfBinaryGraphicsData *data,
-        int length
-);
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_get_next
-(
-        DxfBinaryGraphicsData *data
-);
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_set_next
-(
-        DxfBinaryGraphicsData *data,
-        DxfBinaryGraphicsData *next
-);
-DxfBinaryGraphicsData *
-dxf_binary_graphics_data_get_last
-(
-        DxfBinaryGraphicsData *data
-);
+typedef DxfBinaryData DxfBinaryGraphicsData;
+
+
+DxfBinaryGraphicsData *dxf_binary_graphics_data_new ();
+DxfBinaryGraphicsData *dxf_binary_graphics_data_init (DxfBinaryGraphicsData *data);
+int dxf_binary_graphics_data_write (DxfFile *fp, DxfBinaryGraphicsData *data);
+int dxf_binary_graphics_data_free (DxfBinaryGraphicsData *data);
+void dxf_binary_graphics_data_free_list (DxfBinaryGraphicsData *data);
+char *dxf_binary_graphics_data_get_data_line (DxfBinaryGraphicsData *data);
+DxfBinaryGraphicsData *dxf_binary_graphics_data_set_data_line (DxfBinaryGraphicsData *data, char *data_line);
+int dxf_binary_graphics_data_get_length (DxfBinaryGraphicsData *data);
+DxfBinaryGraphicsData *dxf_binary_graphics_data_set_length (DxfBinaryGraphicsData *data, int length);
+DxfBinaryGraphicsData *dxf_binary_graphics_data_get_next (DxfBinaryGraphicsData *data);
+DxfBinaryGraphicsData *dxf_binary_graphics_data_set_next (DxfBinaryGraphicsData *data, DxfBinaryGraphicsData *next);
+DxfBinaryGraphicsData *dxf_binary_graphics_data_get_last (DxfBinaryGraphicsData *data);
 
 
 #ifdef __cplusplus
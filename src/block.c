@@ -42,6 +42,7 @@
 
 
 #include "block.h"
+#include "entities.h"
 
 
 /*!
@@ -119,15 +120,13 @@ dxf_block_init
         block->description = strdup ("");
         block->id_code = 0;
         block->layer = strdup (DXF_DEFAULT_LAYER);
-        block->p0->x0 = 0.0;
-        block->p0->y0 = 0.0;
-        block->p0->z0 = 0.0;
         block->block_type = 0; /* 0 = invalid type */
         block->extr_x0 = 0.0;
         block->extr_y0 = 0.0;
         block->extr_z0 = 0.0;
         block->object_owner_soft = strdup ("");
-        block->endblk = (struct DxfEndblk *) dxf_endblk_new ();
+        block->endblk = (struct DxfEndblk *) dxf_endblk_init (dxf_endblk_new ());
+        block->entities = NULL;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         block->p0 = NULL;
@@ -145,16 +144,14 @@ dxf_block_init
  *
  * The last line read from file contained the string "BLOCK". \n
  * Now follows some data for the \c BLOCK, to be terminated with a "  0"
- * string announcing the following entity, or the end of the \c ENTITY
- * section marker \c ENDSEC. \n
+ * string announcing the first entity of the block definition. \n
+ * The entities up to the \c ENDBLK marker are read with
+ * dxf_entities_read () into the \c entities member, the \c ENDBLK
+ * marker is read into the \c endblk member, up to and including the
+ * "  0" string announcing the following entity. \n
  * While parsing the DXF file store data in \c dxf_block. \n
  *
  * \return a pointer to \c block.
- *
- * \todo After reading information from the \c BLOCK entity up until the
- * closing Group code 0, the pointer to the following \c ENDBLK entity
- * needs to be stored in the current (last) \c DxfBlock struct member
- * \c endblk.
  */
 DxfBlock *
 dxf_block_read
@@ -168,7 +165,8 @@ dxf_block_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfEntities *entities = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -176,25 +174,23 @@ dxf_block_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (block == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block = dxf_block_init (block);
         }
         if (block->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                block->p0 = dxf_point_init (block->p0);
+                block->p0 = dxf_point_init (dxf_point_new ());
                 if (block->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -205,11 +201,10 @@ dxf_block_read
         }
         if (block->endblk == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfEndblk.\n")));
                 block->endblk = (DxfEndblk *) dxf_endblk_init ((DxfEndblk *) block->endblk);
                 if (block->endblk == NULL)
                 {
@@ -219,8 +214,9 @@ dxf_block_read
                         return (NULL);
                 }
         }
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -228,30 +224,28 @@ dxf_block_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a external
                          * reference name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->xref_name);
+                        dxf_read_string (&block->xref_name, fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->block_name);
+                        dxf_read_string (&block->block_name, fp);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a block name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->block_name_additional);
+                        dxf_read_string (&block->block_name_additional, fp);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing a description. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->description);
+                        dxf_read_string (&block->description, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -262,7 +256,7 @@ dxf_block_read
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->layer);
+                        dxf_read_string (&block->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -284,7 +278,7 @@ dxf_block_read
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
-                        && (block->p0->z0 = 0.0))
+                        && (block->p0->z0 == 0.0))
                 {
                         /* Elevation is a pre AutoCAD R11 variable
                          * so additional testing for the version should
@@ -304,11 +298,12 @@ dxf_block_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbBlockBegin") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -335,45 +330,63 @@ dxf_block_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner object. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block->object_owner_soft);
+                        dxf_read_string (&block->object_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
+                }
+                dxf_read_line (temp_string, fp);
+        }
+        /* Now follow the entities of the block definition, up to and
+         * including the ENDBLK marker. */
+        entities = dxf_entities_read (fp, dxf_entities_new ());
+        if ((entities != NULL)
+          && (entities->number_of_sequence_items > 0))
+        {
+                if (block->entities != NULL)
+                {
+                        dxf_entities_free ((DxfEntities *) block->entities);
                 }
+                block->entities = (struct DxfEntities *) entities;
+        }
+        else if (entities != NULL)
+        {
+                dxf_entities_free (entities);
         }
+        dxf_endblk_read (fp, (DxfEndblk *) block->endblk);
         /* Handle omitted members and/or illegal values. */
-        /*!
-         * \todo Resolve this quick hack for preventing an empty block
-         * name string in a more elegant manner.
-         */
         if (strcmp (block->block_name, "") == 0)
         {
-                sprintf (block->block_name, "%i", block->id_code);
+                snprintf (temp_string, sizeof (temp_string), "%i", block->id_code);
+                free (block->block_name);
+                block->block_name = strdup (temp_string);
         }
         if (strcmp (block->layer, "") == 0)
         {
+                free (block->layer);
                 block->layer = strdup (DXF_DEFAULT_LAYER);
         }
         if (block->block_type == 0)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () illegal block type value found while reading from: %s in line: %d.\n")),
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_INVALID_ENTITY,
+                  (_("Warning in %s () illegal block type value found while reading from: %s in line: %d, the block type value is reset to 1.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
-                  (_("\tblock type value is reset to 1.\n")));
                 block->block_type = 1;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -381,6 +394,87 @@ dxf_block_read
 }
 
 
+/*!
+ * \brief Read the block definitions of the \c BLOCKS section of a DXF
+ * file into a single linked list of \c DxfBlock.
+ *
+ * The last line read from file contained the string "BLOCKS". \n
+ * Every \c BLOCK is read with dxf_block_read () including it's entities
+ * and \c ENDBLK marker, reading stops at the \c ENDSEC marker.
+ *
+ * \return a pointer to the first block definition, or \c NULL when the
+ * section holds no block definitions or an error occurred.
+ */
+DxfBlock *
+dxf_block_read_table
+(
+        DxfFile *fp
+                /*!< DXF file handle of input file (or device). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfBlock *blocks = NULL;
+        DxfBlock *last = NULL;
+        DxfBlock *block;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        if (strcmp (temp_string, "0") != 0)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                  (_("Warning in %s () unexpected string encountered while reading line %d from: %s.\n")),
+                  __FUNCTION__, fp->line_number, fp->filename);
+                return (NULL);
+        }
+        /* Every reader consumes the group code 0 of the following
+         * entity, now follows the name of that entity. */
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "BLOCK") == 0)
+          && (!feof (fp->fp)))
+        {
+                block = dxf_block_read (fp, dxf_block_init (dxf_block_new ()));
+                if (block == NULL)
+                {
+                        break;
+                }
+                if (last == NULL)
+                {
+                        blocks = block;
+                }
+                else
+                {
+                        last->next = (struct DxfBlock *) block;
+                }
+                last = block;
+                dxf_read_line (temp_string, fp);
+        }
+        if ((strcmp (temp_string, "ENDSEC") != 0)
+          && (!feof (fp->fp)))
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                  (_("Warning in %s () unexpected string %s encountered while reading line %d from: %s.\n")),
+                  __FUNCTION__, temp_string, fp->line_number, fp->filename);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (blocks);
+}
+
+
 /*!
  * \brief Write DXF output for a DXF \c BLOCK entity.
  *
@@ -618,6 +712,18 @@ dxf_block_free
         free (block->description);
         free (block->layer);
         free (block->object_owner_soft);
+        if (block->p0 != NULL)
+        {
+                dxf_point_free (block->p0);
+        }
+        if (block->endblk != NULL)
+        {
+                dxf_endblk_free ((DxfEndblk *) block->endblk);
+        }
+        if (block->entities != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) block->entities);
+        }
         free (block);
         block = NULL;
 #if DEBUG
@@ -651,6 +757,7 @@ dxf_block_free_list
         while (blocks != NULL)
         {
                 DxfBlock *iter = (DxfBlock *) blocks->next;
+                blocks->next = NULL;
                 dxf_block_free (blocks);
                 blocks = (DxfBlock *) iter;
         }
@@ -2195,6 +2302,80 @@ dxf_block_set_endblk
 }
 
 
+/*!
+ * \brief Get the pointer to the entities of the block definition of a
+ * DXF \c BLOCK entity.
+ *
+ * \return pointer to the entities, \c NULL when the block definition
+ * has no entities.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+struct DxfEntities *
+dxf_block_get_entities
+(
+        DxfBlock *block
+                /*!< a pointer to a DXF \c BLOCK entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((struct DxfEntities *) block->entities);
+}
+
+
+/*!
+ * \brief Set the pointer to the entities of the block definition of a
+ * DXF \c BLOCK entity.
+ *
+ * The block takes ownership of \c entities, previously set entities
+ * are freed.
+ */
+DxfBlock *
+dxf_block_set_entities
+(
+        DxfBlock *block,
+                /*!< a pointer to a DXF \c BLOCK entity. */
+        struct DxfEntities *entities
+                /*!< a pointer to the entities of the block definition,
+                 * \c NULL for an empty block definition. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (block == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((block->entities != NULL) && (block->entities != entities))
+        {
+                dxf_entities_free ((DxfEntities *) block->entities);
+        }
+        block->entities = entities;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block);
+}
+
+
 /*!
  * \brief Get the pointer to the next DXF \c BLOCK entity from a DXF 
  * \c BLOCK entity.
@@ -2302,9 +2483,6 @@ dxf_block_get_last
         }
         if (block->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfBlock *) block);
         }
         DxfBlock *iter = (DxfBlock *) block->next;
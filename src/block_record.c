@@ -43,6 +43,7 @@
 
 
 #include "block_record.h"
+#include "util.h"
 
 
 /*!
@@ -161,8 +162,7 @@ dxf_block_record_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -171,25 +171,23 @@ dxf_block_record_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (block_record == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 block_record = dxf_block_record_init (block_record);
         }
         if (block_record->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                block_record->binary_graphics_data = dxf_binary_data_init (block_record->binary_graphics_data);
+                block_record->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (block_record->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -198,11 +196,10 @@ dxf_block_record_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) block_record->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -210,8 +207,6 @@ dxf_block_record_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -225,8 +220,7 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing an application
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->block_name);
+                        dxf_read_string (&block_record->block_name, fp);
                 }
 /*! \todo Implement Group Code = 70 in a proper way. */
                 else if (strcmp (temp_string, "70") == 0)
@@ -254,10 +248,8 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, block_record->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -265,15 +257,13 @@ dxf_block_record_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->dictionary_owner_soft);
+                                dxf_read_string (&block_record->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->object_owner_soft);
+                                dxf_read_string (&block_record->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -281,32 +271,30 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing Hard-pointer
                          * ID/handle to associated LAYOUT object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->associated_layout_hard);
+                        dxf_read_string (&block_record->associated_layout_hard, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->dictionary_owner_hard);
+                        dxf_read_string (&block_record->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else if (strcmp (temp_string, "1000") == 0)
                 {
                         /* Now follows a string containing the Xdata
                          * string data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->xdata_string_data);
+                        dxf_read_string (&block_record->xdata_string_data, fp);
                         if (strcmp (block_record->xdata_string_data, "DesignCenter Data") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                                   (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -315,11 +303,11 @@ dxf_block_record_read
                 {
                         /* Now follows a string containing the Xdata
                          * application name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, block_record->xdata_application_name);
+                        dxf_read_string (&block_record->xdata_application_name, fp);
                         if (strcmp (block_record->xdata_application_name, "ACAD") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                                   (_("Warning in %s () unfamiliar string found while reading from: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -327,13 +315,15 @@ dxf_block_record_read
 /*! \todo Implement Group Code = 1070 in a proper way. */
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -455,13 +445,7 @@ dxf_block_record_write
         {
                 if (block_record->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) block_record->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, block_record->binary_graphics_data);
                 }
                 if (block_record->xdata_application_name != NULL)
                 {
@@ -517,7 +501,10 @@ dxf_block_record_free
                 return (EXIT_FAILURE);
         }
         free (block_record->block_name);
-        dxf_binary_data_free_list (block_record->binary_graphics_data);
+        if (block_record->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (block_record->binary_graphics_data);
+        }
         free (block_record->dictionary_owner_soft);
         free (block_record->dictionary_owner_hard);
         free (block_record);
@@ -1993,9 +1980,6 @@ dxf_block_record_get_last
         }
         if (block_record->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfBlockRecord *) block_record);
         }
         DxfBlockRecord *iter = (DxfBlockRecord *) block_record->next;
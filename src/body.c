@@ -42,6 +42,7 @@
 
 
 #include "body.h"
+#include "util.h"
 
 
 /*!
@@ -134,8 +135,7 @@ dxf_body_init
         body->modeler_format_version_number = 1;
         /* Initialize new structs for members. */
         body->binary_graphics_data = NULL;
-        body->proprietary_data = NULL;
-        body->additional_proprietary_data = NULL;
+        body->acis_data = NULL;
         body->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -167,9 +167,8 @@ dxf_body_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        int i;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
         int iter330;
 
         /* Do some basic checks. */
@@ -178,25 +177,23 @@ dxf_body_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (body == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 body = dxf_body_init (body);
         }
         if (body->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->binary_graphics_data = dxf_binary_data_init (body->binary_graphics_data);
+                body->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (body->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -205,50 +202,17 @@ dxf_body_read
                         return (NULL);
                 }
         }
-        if (body->proprietary_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->proprietary_data = dxf_binary_data_init (body->proprietary_data);
-                if (body->proprietary_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        if (body->additional_proprietary_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->additional_proprietary_data = dxf_binary_data_init (body->additional_proprietary_data);
-                if (body->additional_proprietary_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
         if (fp->acad_version_number < AutoCAD_13)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        i = 0;
-        iter310 = (DxfBinaryData *) body->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -256,33 +220,30 @@ dxf_body_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->proprietary_data->data_line);
-                        body->proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->proprietary_data->next);
-                        body->proprietary_data = (DxfBinaryData *) body->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->additional_proprietary_data->data_line);
-                        body->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_binary_data_init ((DxfBinaryData *) body->additional_proprietary_data->next);
-                        body->additional_proprietary_data = (DxfBinaryData *) body->additional_proprietary_data->next;
+                         * data, group code 3 lines continue the
+                         * previous line. */
+                        group_code = (temp_string[0] == '1') ? 1 : 3;
+                        dxf_read_value_line (temp_string, fp);
+                        if (body->acis_data == NULL)
+                        {
+                                body->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                                if (body->acis_data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                        }
+                        dxf_acis_data_append_line (body->acis_data, group_code, temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -293,14 +254,12 @@ dxf_body_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->linetype);
+                        dxf_read_string (&body->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->layer);
+                        dxf_read_string (&body->layer, fp);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                   && DXF_FLATLAND
@@ -359,12 +318,14 @@ dxf_body_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                        dxf_read_line (temp_string, fp);
+                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                          && (strcmp (temp_string, "AcDbModelerGeometry") != 0))
                         {
-                                fprintf (stderr, "Warning in dxf_body_read () found a bad subclass marker in: %s in line: %d.\n",
-                                        fp->filename, fp->line_number);
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
+                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
                 else if (strcmp (temp_string, "160") == 0)
@@ -385,10 +346,8 @@ dxf_body_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, body->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -396,15 +355,13 @@ dxf_body_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_soft);
+                                dxf_read_string (&body->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->object_owner_soft);
+                                dxf_read_string (&body->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -412,15 +369,13 @@ dxf_body_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->material);
+                        dxf_read_string (&body->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->dictionary_owner_hard);
+                        dxf_read_string (&body->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -433,8 +388,7 @@ dxf_body_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->plot_style_name);
+                        dxf_read_string (&body->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -446,8 +400,7 @@ dxf_body_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, body->color_name);
+                        dxf_read_string (&body->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -459,16 +412,20 @@ dxf_body_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (body->linetype, "") == 0)
@@ -481,15 +438,12 @@ dxf_body_read
         }
         if (body->modeler_format_version_number == 0)
         {
-                fprintf (stderr,
-                  (_("Warning: in %s () illegal modeler format version number found while reading from: %s in line: %d.\n")),
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_INVALID_ENTITY,
+                  (_("Warning in %s () illegal modeler format version number found while reading from: %s in line: %d, the modeler format version number is reset to 1.\n")),
                   __FUNCTION__, fp->filename, fp->line_number);
-                fprintf (stderr,
-                  (_("\tmodeler format version number is reset to 1.\n")));
                 body->modeler_format_version_number = 1;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -516,9 +470,6 @@ dxf_body_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("BODY");
-        DxfProprietaryData *iter = NULL;
-        DxfProprietaryData *additional_iter = NULL;
-        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -566,7 +517,6 @@ dxf_body_write
                 body->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        i = 1;
         fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
         if (body->id_code != -1)
         {
@@ -650,13 +600,7 @@ dxf_body_write
 #endif
                 if (body->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) body->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, body->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -678,22 +622,9 @@ dxf_body_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", body->modeler_format_version_number);
         }
-        iter = (DxfProprietaryData *) body->proprietary_data;
-        additional_iter = (DxfProprietaryData *) body->additional_proprietary_data;
-        while ((iter != NULL) || (additional_iter != NULL))
+        if (body->acis_data != NULL)
         {
-                if (iter->order == i)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter->line);
-                        iter = (DxfProprietaryData *) iter->next;
-                        i++;
-                }
-                if (additional_iter->order == i)
-                {
-                        fprintf (fp->fp, "  3\n%s\n", additional_iter->line);
-                        additional_iter = (DxfProprietaryData *) additional_iter->next;
-                        i++;
-                }
+                dxf_acis_data_write (fp, body->acis_data);
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -739,15 +670,20 @@ dxf_body_free
         }
         free (body->linetype);
         free (body->layer);
-        dxf_binary_data_free_list (body->binary_graphics_data);
+        if (body->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (body->binary_graphics_data);
+        }
         free (body->dictionary_owner_soft);
         free (body->object_owner_soft);
         free (body->material);
         free (body->dictionary_owner_hard);
         free (body->plot_style_name);
         free (body->color_name);
-        dxf_binary_data_free_list (body->proprietary_data);
-        dxf_binary_data_free_list (body->additional_proprietary_data);
+        if (body->acis_data != NULL)
+        {
+                dxf_acis_data_free (body->acis_data);
+        }
         free (body);
         body = NULL;
 #if DEBUG
@@ -781,6 +717,7 @@ dxf_body_free_list
         while (bodies != NULL)
         {
                 DxfBody *iter = (DxfBody *) bodies->next;
+                bodies->next = NULL;
                 dxf_body_free (bodies);
                 bodies = (DxfBody *) iter;
         }
@@ -2426,15 +2363,14 @@ dxf_body_set_transparency
 
 
 /*!
- * \brief Get the pointer to the \c proprietary_data from a DXF \c BODY
- * entity.
- *
- * \return pointer to the \c proprietary_data.
+ * \brief Get the pointer to the proprietary (ACIS) data from a DXF
+ * \c BODY entity.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return pointer to the \c acis_data, \c NULL when the entity has no
+ * proprietary data or an error occurred.
  */
-DxfBinaryData *
-dxf_body_get_proprietary_data
+DxfAcisData *
+dxf_body_get_acis_data
 (
         DxfBody *body
                 /*!< a pointer to a DXF \c BODY entity. */
@@ -2451,31 +2387,111 @@ dxf_body_get_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->proprietary_data ==  NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (body->acis_data);
+}
+
+
+/*!
+ * \brief Set the pointer to the proprietary (ACIS) data for a DXF
+ * \c BODY entity.
+ */
+DxfBody *
+dxf_body_set_acis_data
+(
+        DxfBody *body,
+                /*!< a pointer to a DXF \c BODY entity. */
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data to be set for
+                 * the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (body == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        body->acis_data = acis_data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) body->proprietary_data);
+        return (body);
 }
 
 
 /*!
- * \brief Set the proprietary data for a DXF \c BODY entity.
+ * \brief Get the \c proprietary_data from a DXF \c BODY entity.
+ *
+ * The group code 1 lines of the proprietary (ACIS) data are
+ * returned.
+ *
+ * \return a newly allocated list with the \c proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_proprietary_data_free_list ().
+ */
+DxfProprietaryData *
+dxf_body_get_proprietary_data
+(
+        DxfBody *body
+                /*!< a pointer to a DXF \c BODY entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (body == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (body->acis_data == NULL)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_acis_data_get_lines (body->acis_data, 1));
+}
+
+
+/*!
+ * \brief Set the \c proprietary_data for a DXF \c BODY entity.
+ *
+ * The group code 1 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c proprietary_data.
  */
 DxfBody *
 dxf_body_set_proprietary_data
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        DxfBinaryData *proprietary_data
-                /*!< a pointer to a linked list containing the
-                 * \c proprietary_data for the entity. */
+        DxfProprietaryData *proprietary_data
+                /*!< a pointer to a single linked list with the
+                 * \c proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2496,15 +2512,10 @@ dxf_body_set_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->proprietary_data == NULL)
+        if (body->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->proprietary_data = dxf_binary_data_init (body->proprietary_data);
-                if (body->proprietary_data == NULL)
+                body->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (body->acis_data == NULL)
                 {
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
@@ -2512,7 +2523,10 @@ dxf_body_set_proprietary_data
                         return (NULL);
                 }
         }
-        body->proprietary_data = proprietary_data;
+        if (dxf_acis_data_set_lines (body->acis_data, 1, proprietary_data) == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2523,11 +2537,16 @@ dxf_body_set_proprietary_data
 /*!
  * \brief Get the \c additional_proprietary_data from a DXF \c BODY entity.
  *
- * \return pointer to the \c additional_proprietary_data.
+ * The group code 3 lines of the proprietary (ACIS) data are
+ * returned.
  *
- * \warning No checks are performed on the returned pointer (string).
+ * \return a newly allocated list with the \c additional_proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_proprietary_data_free_list ().
  */
-DxfBinaryData *
+DxfProprietaryData *
 dxf_body_get_additional_proprietary_data
 (
         DxfBody *body
@@ -2545,32 +2564,34 @@ dxf_body_get_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->additional_proprietary_data ==  NULL)
+        if (body->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfBinaryData *) body->additional_proprietary_data);
+        return (dxf_acis_data_get_lines (body->acis_data, 3));
 }
 
 
 /*!
- * \brief Set the pointer to the additional proprietary data for a DXF
- * \c BODY entity.
+ * \brief Set the \c additional_proprietary_data for a DXF \c BODY entity.
+ *
+ * The group code 3 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c additional_proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c additional_proprietary_data.
  */
 DxfBody *
 dxf_body_set_additional_proprietary_data
 (
         DxfBody *body,
                 /*!< a pointer to a DXF \c BODY entity. */
-        DxfBinaryData *additional_proprietary_data
-                /*!< an array containing the additional proprietary data
-                 * for the entity. */
+        DxfProprietaryData *additional_proprietary_data
+                /*!< a pointer to a single linked list with the
+                 * \c additional_proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2584,22 +2605,17 @@ dxf_body_set_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (additional_proprietary_data ==  NULL)
+        if (additional_proprietary_data == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (body->additional_proprietary_data == NULL)
+        if (body->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                body->additional_proprietary_data = dxf_binary_data_init (body->additional_proprietary_data);
-                if (body->additional_proprietary_data == NULL)
+                body->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (body->acis_data == NULL)
                 {
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
@@ -2607,7 +2623,10 @@ dxf_body_set_additional_proprietary_data
                         return (NULL);
                 }
         }
-        body->additional_proprietary_data = additional_proprietary_data;
+        if (dxf_acis_data_set_lines (body->acis_data, 3, additional_proprietary_data) == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2797,9 +2816,6 @@ dxf_body_get_last
         }
         if (body->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfBody *) body);
         }
         DxfBody *iter = (DxfBody *) body->next;
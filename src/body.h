@@ -44,8 +44,8 @@
 
 
 #include "global.h"
+#include "acis_data.h"
 #include "binary_data.h"
-#include "proprietary_data.h"
 
 
 #ifdef __cplusplus
@@ -190,15 +190,10 @@ dxf_body_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF body. */
-        DxfBinaryData *proprietary_data;
-                /*!< group code = 1\n
-                 * Proprietary data (multiple lines < 255 characters
-                 * each).*/
-        DxfBinaryData *additional_proprietary_data;
-                /*!< group code = 3\n
-                 * Additional lines of proprietary data if previous
-                 * group 1 string is greater than 255 characters
-                 * (optional).*/
+        DxfAcisData *acis_data;
+                /*!< group code = 1 and 3\n
+                 * Proprietary (ACIS) data, kept as read from the DXF
+                 * file and only decoded on request.*/
         int16_t modeler_format_version_number;
                 /*!< group code = 70\n
                  * Modeler format version number (currently = 1).\n */
@@ -256,10 +251,12 @@ char *dxf_body_get_color_name (DxfBody *body);
 DxfBody *dxf_body_set_color_name (DxfBody *body, char *color_name);
 int32_t dxf_body_get_transparency (DxfBody *body);
 DxfBody *dxf_body_set_transparency (DxfBody *body, int32_t transparency);
-DxfBinaryData *dxf_body_get_proprietary_data (DxfBody *body);
-DxfBody *dxf_body_set_proprietary_data (DxfBody *body, DxfBinaryData *proprietary_data);
-DxfBinaryData *dxf_body_get_additional_proprietary_data (DxfBody *body);
-DxfBody *dxf_body_set_additional_proprietary_data (DxfBody *body, DxfBinaryData *additional_proprietary_data);
+DxfAcisData *dxf_body_get_acis_data (DxfBody *body);
+DxfBody *dxf_body_set_acis_data (DxfBody *body, DxfAcisData *acis_data);
+DxfProprietaryData *dxf_body_get_proprietary_data (DxfBody *body);
+DxfBody *dxf_body_set_proprietary_data (DxfBody *body, DxfProprietaryData *proprietary_data);
+DxfProprietaryData *dxf_body_get_additional_proprietary_data (DxfBody *body);
+DxfBody *dxf_body_set_additional_proprietary_data (DxfBody *body, DxfProprietaryData *additional_proprietary_data);
 int16_t dxf_body_get_modeler_format_version_number (DxfBody *body);
 DxfBody *dxf_body_set_modeler_format_version_number (DxfBody *body, int16_t modeler_format_version_number);
 DxfBody *dxf_body_get_next (DxfBody *body);
@@ -41,7 +41,12 @@
  */
 
 
+/* The checked getters are defined here, also for trusted input. */
+#define DXF_CHECKED_GETTERS 1
+
+
 #include "circle.h"
+#include "util.h"
 
 
 /*!
@@ -138,9 +143,6 @@ dxf_circle_init
         circle->color_value = 0;
         circle->color_name = strdup ("");
         circle->transparency = 0;
-        circle->p0->x0 = 0.0;
-        circle->p0->y0 = 0.0;
-        circle->p0->z0 = 0.0;
         circle->radius = 0.0;
         circle->extr_x0 = 0.0;
         circle->extr_y0 = 0.0;
@@ -183,8 +185,7 @@ dxf_circle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -193,25 +194,23 @@ dxf_circle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (circle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 circle = dxf_circle_init (circle);
         }
         if (circle->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                circle->binary_graphics_data = dxf_binary_data_init (circle->binary_graphics_data);
+                circle->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (circle->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -222,12 +221,11 @@ dxf_circle_read
         }
         if (circle->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                circle->p0 = dxf_point_init (circle->p0);
+                circle->p0 = dxf_point_init (dxf_point_new ());
                 if (circle->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -236,11 +234,10 @@ dxf_circle_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) circle->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -248,8 +245,6 @@ dxf_circle_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -263,14 +258,12 @@ dxf_circle_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->linetype);
+                        dxf_read_string (&circle->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->layer);
+                        dxf_read_string (&circle->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -356,12 +349,12 @@ dxf_circle_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbCircle") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -405,10 +398,8 @@ dxf_circle_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, circle->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -416,15 +407,13 @@ dxf_circle_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_soft);
+                                dxf_read_string (&circle->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->object_owner_soft);
+                                dxf_read_string (&circle->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -432,15 +421,13 @@ dxf_circle_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->material);
+                        dxf_read_string (&circle->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->dictionary_owner_hard);
+                        dxf_read_string (&circle->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -453,8 +440,7 @@ dxf_circle_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->plot_style_name);
+                        dxf_read_string (&circle->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -466,8 +452,7 @@ dxf_circle_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, circle->color_name);
+                        dxf_read_string (&circle->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -479,16 +464,20 @@ dxf_circle_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (circle->linetype, "") == 0)
@@ -499,8 +488,6 @@ dxf_circle_read
         {
                 circle->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -651,13 +638,7 @@ dxf_circle_write
 #endif
                 if (circle->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) circle->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, circle->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -744,7 +725,10 @@ dxf_circle_free
         }
         free (circle->linetype);
         free (circle->layer);
-        dxf_binary_data_free (circle->binary_graphics_data);
+        if (circle->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (circle->binary_graphics_data);
+        }
         free (circle->dictionary_owner_soft);
         free (circle->dictionary_owner_hard);
         free (circle);
@@ -783,6 +767,7 @@ dxf_circle_free_list
         while (circles != NULL)
         {
                 DxfCircle *iter = (DxfCircle *) circles->next;
+                circles->next = NULL;
                 dxf_circle_free (circles);
                 circles = (DxfCircle *) iter;
         }
@@ -3577,9 +3562,6 @@ dxf_circle_get_last
         }
         if (circle->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfCircle *) circle);
         }
         DxfCircle *iter = (DxfCircle *) circle->next;
@@ -289,6 +289,101 @@ DxfCircle *dxf_circle_set_next (DxfCircle *circle, DxfCircle *next);
 DxfCircle *dxf_circle_get_last (DxfCircle *circle);
 
 
+/*!
+ * \name Unchecked getters.
+ *
+ * Inline getters without checks for use in hot loops, on a \c CIRCLE
+ * entity which passed \c dxf_entities_validate ().
+ */
+/*! \{ */
+
+
+static inline DxfPoint *
+dxf_circle_get_p0_unchecked
+(
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        return (circle->p0);
+}
+
+
+static inline double
+dxf_circle_get_x0_unchecked
+(
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        return (circle->p0->x0);
+}
+
+
+static inline double
+dxf_circle_get_y0_unchecked
+(
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        return (circle->p0->y0);
+}
+
+
+static inline double
+dxf_circle_get_z0_unchecked
+(
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        return (circle->p0->z0);
+}
+
+
+static inline double
+dxf_circle_get_radius_unchecked
+(
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        return (circle->radius);
+}
+
+
+static inline int
+dxf_circle_test_point_in_circle_unchecked
+(
+        DxfPoint *point,
+                /*!< a pointer to a DXF \c POINT entity. */
+        DxfCircle *circle
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+)
+{
+        double dx = circle->p0->x0 - point->x0;
+        double dy = circle->p0->y0 - point->y0;
+        double d = dx * dx + dy * dy;
+        double r = circle->radius * circle->radius;
+
+        return ((d < r) ? INSIDE : ((d > r) ? OUTSIDE : ON_EDGE));
+}
+
+
+/*! \} */
+
+
+#if DXF_TRUSTED_INPUT && !defined (DXF_CHECKED_GETTERS)
+#  define dxf_circle_get_p0(circle) dxf_circle_get_p0_unchecked (circle)
+#  define dxf_circle_get_x0(circle) dxf_circle_get_x0_unchecked (circle)
+#  define dxf_circle_get_y0(circle) dxf_circle_get_y0_unchecked (circle)
+#  define dxf_circle_get_z0(circle) dxf_circle_get_z0_unchecked (circle)
+#  define dxf_circle_get_radius(circle) dxf_circle_get_radius_unchecked (circle)
+#  define dxf_circle_test_point_in_circle(point, circle) dxf_circle_test_point_in_circle_unchecked (point, circle)
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
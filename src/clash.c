@@ -0,0 +1,1215 @@
+/*!
+ * \file clash.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Batch point classification and distance kernels (clash checks).
+ *
+ * Points are passed as flat coordinate arrays and tested against many
+ * circles, arcs or line segments at once, using SSE2 or AVX2 when the
+ * processor supports them.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "clash.h"
+
+
+/*!
+ * \brief Classification of a point from the results of the "inside"
+ * and "outside" comparisons, indexed by <tt>inside | (outside << 1)</tt>.
+ */
+static const char dxf_clash_class[4] =
+{
+        ON_EDGE,
+        INSIDE,
+        OUTSIDE,
+        OUTSIDE
+};
+
+
+/*!
+ * \brief Parameters of a circle, arc or segment prepared for the
+ * kernels.
+ */
+typedef struct
+dxf_clash_shape_struct
+{
+        double x0;
+                /*!< Center of a circle or arc, start point of a
+                 * segment. */
+        double y0;
+        double x1;
+                /*!< End point of a segment or arc. */
+        double y1;
+        double dx;
+                /*!< Direction of a segment, start direction of an
+                 * arc. */
+        double dy;
+        double ex;
+                /*!< End direction of an arc. */
+        double ey;
+        double radius;
+                /*!< Radius of a circle or arc, inverse squared length
+                 * of a segment. */
+        double inner;
+                /*!< Squared distance below which a point is inside. */
+        double outer;
+                /*!< Squared distance above which a point is outside. */
+        int sweep;
+                /*!< Arc sweep: \c 0 full circle, \c 1 at most 180
+                 * degrees, \c 2 more than 180 degrees. */
+} DxfClashShape;
+
+
+/*!
+ * \brief Squared distance limits for a radius and tolerance.
+ */
+static void
+dxf_clash_limits
+(
+        DxfClashShape *shape,
+        double radius,
+        double tolerance
+)
+{
+        tolerance = fabs (tolerance);
+        shape->inner = (radius > tolerance)
+          ? (radius - tolerance) * (radius - tolerance)
+          : -1.0;
+        shape->outer = (radius + tolerance) * (radius + tolerance);
+}
+
+
+/*!
+ * \brief Scalar circle kernel, any of \c results and \c distances may
+ * be \c NULL.
+ */
+static void
+dxf_clash_circle_scalar
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        double dx;
+        double dy;
+        double d2;
+        int i;
+
+        for (i = 0; i < n; i++)
+        {
+                dx = x[i] - shape->x0;
+                dy = y[i] - shape->y0;
+                d2 = dx * dx + dy * dy;
+                if (results != NULL)
+                {
+                        results[i] = dxf_clash_class[(d2 < shape->inner)
+                          | ((d2 > shape->outer) << 1)];
+                }
+                if (distances != NULL)
+                {
+                        distances[i] = sqrt (d2) - shape->radius;
+                }
+        }
+}
+
+
+/*!
+ * \brief Scalar segment kernel, any of \c results and \c distances may
+ * be \c NULL.
+ */
+static void
+dxf_clash_segment_scalar
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        double px;
+        double py;
+        double t;
+        double d2;
+        int i;
+
+        for (i = 0; i < n; i++)
+        {
+                px = x[i] - shape->x0;
+                py = y[i] - shape->y0;
+                t = (px * shape->dx + py * shape->dy) * shape->radius;
+                t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+                px -= t * shape->dx;
+                py -= t * shape->dy;
+                d2 = px * px + py * py;
+                if (results != NULL)
+                {
+                        results[i] = (d2 > shape->outer) ? OUTSIDE : ON_EDGE;
+                }
+                if (distances != NULL)
+                {
+                        distances[i] = sqrt (d2);
+                }
+        }
+}
+
+
+/*!
+ * \brief Scalar arc kernel, any of \c results and \c distances may be
+ * \c NULL.
+ *
+ * The sweep is tested with cross products against the start and end
+ * directions, so no trigonometry is done per point.
+ */
+static void
+dxf_clash_arc_scalar
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        double vx;
+        double vy;
+        double d;
+        double d2;
+        double e2;
+        double a;
+        double b;
+        int in_sweep;
+        int i;
+
+        for (i = 0; i < n; i++)
+        {
+                vx = x[i] - shape->x0;
+                vy = y[i] - shape->y0;
+                a = shape->dx * vy - shape->dy * vx;
+                b = vx * shape->ey - vy * shape->ex;
+                if (shape->sweep == 0)
+                        in_sweep = 1;
+                else if (shape->sweep == 1)
+                        in_sweep = (a >= 0.0) && (b >= 0.0);
+                else
+                        in_sweep = (a >= 0.0) || (b >= 0.0);
+                if (in_sweep)
+                {
+                        d = sqrt (vx * vx + vy * vy) - shape->radius;
+                        d2 = d * d;
+                }
+                else
+                {
+                        /* Nearest to one of the end points. */
+                        d2 = (vx - shape->radius * shape->dx) * (vx - shape->radius * shape->dx)
+                          + (vy - shape->radius * shape->dy) * (vy - shape->radius * shape->dy);
+                        e2 = (x[i] - shape->x1) * (x[i] - shape->x1)
+                          + (y[i] - shape->y1) * (y[i] - shape->y1);
+                        if (e2 < d2)
+                                d2 = e2;
+                }
+                if (results != NULL)
+                {
+                        results[i] = (d2 > shape->outer) ? OUTSIDE : ON_EDGE;
+                }
+                if (distances != NULL)
+                {
+                        distances[i] = sqrt (d2);
+                }
+        }
+}
+
+
+#ifdef DXF_SIMD_X86
+/*!
+ * \brief SSE2 circle kernel.
+ */
+__attribute__ ((target ("sse2")))
+static void
+dxf_clash_circle_sse2
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        __m128d cx = _mm_set1_pd (shape->x0);
+        __m128d cy = _mm_set1_pd (shape->y0);
+        __m128d inner = _mm_set1_pd (shape->inner);
+        __m128d outer = _mm_set1_pd (shape->outer);
+        __m128d radius = _mm_set1_pd (shape->radius);
+        __m128d dx;
+        __m128d dy;
+        __m128d d2;
+        int lt;
+        int gt;
+        int i;
+
+        for (i = 0; i + 2 <= n; i += 2)
+        {
+                dx = _mm_sub_pd (_mm_loadu_pd (x + i), cx);
+                dy = _mm_sub_pd (_mm_loadu_pd (y + i), cy);
+                d2 = _mm_add_pd (_mm_mul_pd (dx, dx), _mm_mul_pd (dy, dy));
+                if (results != NULL)
+                {
+                        lt = _mm_movemask_pd (_mm_cmplt_pd (d2, inner));
+                        gt = _mm_movemask_pd (_mm_cmpgt_pd (d2, outer));
+                        results[i] = dxf_clash_class[(lt & 1) | ((gt & 1) << 1)];
+                        results[i + 1] = dxf_clash_class[(lt >> 1) | (gt & 2)];
+                }
+                if (distances != NULL)
+                {
+                        _mm_storeu_pd (distances + i, _mm_sub_pd (_mm_sqrt_pd (d2), radius));
+                }
+        }
+        dxf_clash_circle_scalar (x + i, y + i, n - i, shape,
+          (results != NULL) ? results + i : NULL,
+          (distances != NULL) ? distances + i : NULL);
+}
+
+
+/*!
+ * \brief SSE2 segment kernel.
+ */
+__attribute__ ((target ("sse2")))
+static void
+dxf_clash_segment_sse2
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        __m128d ax = _mm_set1_pd (shape->x0);
+        __m128d ay = _mm_set1_pd (shape->y0);
+        __m128d sx = _mm_set1_pd (shape->dx);
+        __m128d sy = _mm_set1_pd (shape->dy);
+        __m128d scale = _mm_set1_pd (shape->radius);
+        __m128d outer = _mm_set1_pd (shape->outer);
+        __m128d zero = _mm_setzero_pd ();
+        __m128d one = _mm_set1_pd (1.0);
+        __m128d px;
+        __m128d py;
+        __m128d t;
+        __m128d d2;
+        int gt;
+        int i;
+
+        for (i = 0; i + 2 <= n; i += 2)
+        {
+                px = _mm_sub_pd (_mm_loadu_pd (x + i), ax);
+                py = _mm_sub_pd (_mm_loadu_pd (y + i), ay);
+                t = _mm_mul_pd (_mm_add_pd (_mm_mul_pd (px, sx), _mm_mul_pd (py, sy)), scale);
+                t = _mm_min_pd (_mm_max_pd (t, zero), one);
+                px = _mm_sub_pd (px, _mm_mul_pd (t, sx));
+                py = _mm_sub_pd (py, _mm_mul_pd (t, sy));
+                d2 = _mm_add_pd (_mm_mul_pd (px, px), _mm_mul_pd (py, py));
+                if (results != NULL)
+                {
+                        gt = _mm_movemask_pd (_mm_cmpgt_pd (d2, outer));
+                        results[i] = (gt & 1) ? OUTSIDE : ON_EDGE;
+                        results[i + 1] = (gt & 2) ? OUTSIDE : ON_EDGE;
+                }
+                if (distances != NULL)
+                {
+                        _mm_storeu_pd (distances + i, _mm_sqrt_pd (d2));
+                }
+        }
+        dxf_clash_segment_scalar (x + i, y + i, n - i, shape,
+          (results != NULL) ? results + i : NULL,
+          (distances != NULL) ? distances + i : NULL);
+}
+
+
+/*!
+ * \brief SSE2 arc kernel.
+ */
+__attribute__ ((target ("sse2")))
+static void
+dxf_clash_arc_sse2
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        __m128d cx = _mm_set1_pd (shape->x0);
+        __m128d cy = _mm_set1_pd (shape->y0);
+        __m128d sx = _mm_set1_pd (shape->dx);
+        __m128d sy = _mm_set1_pd (shape->dy);
+        __m128d ex = _mm_set1_pd (shape->ex);
+        __m128d ey = _mm_set1_pd (shape->ey);
+        __m128d x1 = _mm_set1_pd (shape->x1);
+        __m128d y1 = _mm_set1_pd (shape->y1);
+        __m128d rx = _mm_set1_pd (shape->radius * shape->dx);
+        __m128d ry = _mm_set1_pd (shape->radius * shape->dy);
+        __m128d radius = _mm_set1_pd (shape->radius);
+        __m128d outer = _mm_set1_pd (shape->outer);
+        __m128d zero = _mm_setzero_pd ();
+        __m128d all = _mm_cmpeq_pd (zero, zero);
+        __m128d px;
+        __m128d py;
+        __m128d vx;
+        __m128d vy;
+        __m128d in_sweep;
+        __m128d d;
+        __m128d d2;
+        __m128d e2;
+        int gt;
+        int i;
+
+        for (i = 0; i + 2 <= n; i += 2)
+        {
+                px = _mm_loadu_pd (x + i);
+                py = _mm_loadu_pd (y + i);
+                vx = _mm_sub_pd (px, cx);
+                vy = _mm_sub_pd (py, cy);
+                if (shape->sweep == 0)
+                {
+                        in_sweep = all;
+                }
+                else
+                {
+                        d = _mm_cmpge_pd (_mm_sub_pd (_mm_mul_pd (sx, vy), _mm_mul_pd (sy, vx)), zero);
+                        e2 = _mm_cmpge_pd (_mm_sub_pd (_mm_mul_pd (vx, ey), _mm_mul_pd (vy, ex)), zero);
+                        in_sweep = (shape->sweep == 1) ? _mm_and_pd (d, e2) : _mm_or_pd (d, e2);
+                }
+                d = _mm_sub_pd (_mm_sqrt_pd (_mm_add_pd (_mm_mul_pd (vx, vx), _mm_mul_pd (vy, vy))), radius);
+                d = _mm_mul_pd (d, d);
+                /* Nearest to one of the end points. */
+                vx = _mm_sub_pd (vx, rx);
+                vy = _mm_sub_pd (vy, ry);
+                d2 = _mm_add_pd (_mm_mul_pd (vx, vx), _mm_mul_pd (vy, vy));
+                px = _mm_sub_pd (px, x1);
+                py = _mm_sub_pd (py, y1);
+                e2 = _mm_add_pd (_mm_mul_pd (px, px), _mm_mul_pd (py, py));
+                d2 = _mm_min_pd (e2, d2);
+                d2 = _mm_or_pd (_mm_and_pd (in_sweep, d), _mm_andnot_pd (in_sweep, d2));
+                if (results != NULL)
+                {
+                        gt = _mm_movemask_pd (_mm_cmpgt_pd (d2, outer));
+                        results[i] = (gt & 1) ? OUTSIDE : ON_EDGE;
+                        results[i + 1] = (gt & 2) ? OUTSIDE : ON_EDGE;
+                }
+                if (distances != NULL)
+                {
+                        _mm_storeu_pd (distances + i, _mm_sqrt_pd (d2));
+                }
+        }
+        dxf_clash_arc_scalar (x + i, y + i, n - i, shape,
+          (results != NULL) ? results + i : NULL,
+          (distances != NULL) ? distances + i : NULL);
+}
+
+
+/*!
+ * \brief AVX2 circle kernel.
+ */
+__attribute__ ((target ("avx2")))
+static void
+dxf_clash_circle_avx2
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        __m256d cx = _mm256_set1_pd (shape->x0);
+        __m256d cy = _mm256_set1_pd (shape->y0);
+        __m256d inner = _mm256_set1_pd (shape->inner);
+        __m256d outer = _mm256_set1_pd (shape->outer);
+        __m256d radius = _mm256_set1_pd (shape->radius);
+        __m256d dx;
+        __m256d dy;
+        __m256d d2;
+        int lt;
+        int gt;
+        int i;
+        int k;
+
+        for (i = 0; i + 4 <= n; i += 4)
+        {
+                dx = _mm256_sub_pd (_mm256_loadu_pd (x + i), cx);
+                dy = _mm256_sub_pd (_mm256_loadu_pd (y + i), cy);
+                d2 = _mm256_add_pd (_mm256_mul_pd (dx, dx), _mm256_mul_pd (dy, dy));
+                if (results != NULL)
+                {
+                        lt = _mm256_movemask_pd (_mm256_cmp_pd (d2, inner, _CMP_LT_OQ));
+                        gt = _mm256_movemask_pd (_mm256_cmp_pd (d2, outer, _CMP_GT_OQ));
+                        for (k = 0; k < 4; k++)
+                        {
+                                results[i + k] = dxf_clash_class[((lt >> k) & 1)
+                                  | (((gt >> k) & 1) << 1)];
+                        }
+                }
+                if (distances != NULL)
+                {
+                        _mm256_storeu_pd (distances + i, _mm256_sub_pd (_mm256_sqrt_pd (d2), radius));
+                }
+        }
+        dxf_clash_circle_scalar (x + i, y + i, n - i, shape,
+          (results != NULL) ? results + i : NULL,
+          (distances != NULL) ? distances + i : NULL);
+}
+
+
+/*!
+ * \brief AVX2 segment kernel.
+ */
+__attribute__ ((target ("avx2")))
+static void
+dxf_clash_segment_avx2
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        __m256d ax = _mm256_set1_pd (shape->x0);
+        __m256d ay = _mm256_set1_pd (shape->y0);
+        __m256d sx = _mm256_set1_pd (shape->dx);
+        __m256d sy = _mm256_set1_pd (shape->dy);
+        __m256d scale = _mm256_set1_pd (shape->radius);
+        __m256d outer = _mm256_set1_pd (shape->outer);
+        __m256d zero = _mm256_setzero_pd ();
+        __m256d one = _mm256_set1_pd (1.0);
+        __m256d px;
+        __m256d py;
+        __m256d t;
+        __m256d d2;
+        int gt;
+        int i;
+        int k;
+
+        for (i = 0; i + 4 <= n; i += 4)
+        {
+                px = _mm256_sub_pd (_mm256_loadu_pd (x + i), ax);
+                py = _mm256_sub_pd (_mm256_loadu_pd (y + i), ay);
+                t = _mm256_mul_pd (_mm256_add_pd (_mm256_mul_pd (px, sx), _mm256_mul_pd (py, sy)), scale);
+                t = _mm256_min_pd (_mm256_max_pd (t, zero), one);
+                px = _mm256_sub_pd (px, _mm256_mul_pd (t, sx));
+                py = _mm256_sub_pd (py, _mm256_mul_pd (t, sy));
+                d2 = _mm256_add_pd (_mm256_mul_pd (px, px), _mm256_mul_pd (py, py));
+                if (results != NULL)
+                {
+                        gt = _mm256_movemask_pd (_mm256_cmp_pd (d2, outer, _CMP_GT_OQ));
+                        for (k = 0; k < 4; k++)
+                        {
+                                results[i + k] = ((gt >> k) & 1) ? OUTSIDE : ON_EDGE;
+                        }
+                }
+                if (distances != NULL)
+                {
+                        _mm256_storeu_pd (distances + i, _mm256_sqrt_pd (d2));
+                }
+        }
+        dxf_clash_segment_scalar (x + i, y + i, n - i, shape,
+          (results != NULL) ? results + i : NULL,
+          (distances != NULL) ? distances + i : NULL);
+}
+
+
+/*!
+ * \brief AVX2 arc kernel.
+ */
+__attribute__ ((target ("avx2")))
+static void
+dxf_clash_arc_avx2
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        __m256d cx = _mm256_set1_pd (shape->x0);
+        __m256d cy = _mm256_set1_pd (shape->y0);
+        __m256d sx = _mm256_set1_pd (shape->dx);
+        __m256d sy = _mm256_set1_pd (shape->dy);
+        __m256d ex = _mm256_set1_pd (shape->ex);
+        __m256d ey = _mm256_set1_pd (shape->ey);
+        __m256d x1 = _mm256_set1_pd (shape->x1);
+        __m256d y1 = _mm256_set1_pd (shape->y1);
+        __m256d rx = _mm256_set1_pd (shape->radius * shape->dx);
+        __m256d ry = _mm256_set1_pd (shape->radius * shape->dy);
+        __m256d radius = _mm256_set1_pd (shape->radius);
+        __m256d outer = _mm256_set1_pd (shape->outer);
+        __m256d zero = _mm256_setzero_pd ();
+        __m256d all = _mm256_cmp_pd (zero, zero, _CMP_EQ_OQ);
+        __m256d px;
+        __m256d py;
+        __m256d vx;
+        __m256d vy;
+        __m256d in_sweep;
+        __m256d d;
+        __m256d d2;
+        __m256d e2;
+        int gt;
+        int i;
+        int k;
+
+        for (i = 0; i + 4 <= n; i += 4)
+        {
+                px = _mm256_loadu_pd (x + i);
+                py = _mm256_loadu_pd (y + i);
+                vx = _mm256_sub_pd (px, cx);
+                vy = _mm256_sub_pd (py, cy);
+                if (shape->sweep == 0)
+                {
+                        in_sweep = all;
+                }
+                else
+                {
+                        d = _mm256_cmp_pd (_mm256_sub_pd (_mm256_mul_pd (sx, vy), _mm256_mul_pd (sy, vx)), zero, _CMP_GE_OQ);
+                        e2 = _mm256_cmp_pd (_mm256_sub_pd (_mm256_mul_pd (vx, ey), _mm256_mul_pd (vy, ex)), zero, _CMP_GE_OQ);
+                        in_sweep = (shape->sweep == 1) ? _mm256_and_pd (d, e2) : _mm256_or_pd (d, e2);
+                }
+                d = _mm256_sub_pd (_mm256_sqrt_pd (_mm256_add_pd (_mm256_mul_pd (vx, vx), _mm256_mul_pd (vy, vy))), radius);
+                d = _mm256_mul_pd (d, d);
+                /* Nearest to one of the end points. */
+                vx = _mm256_sub_pd (vx, rx);
+                vy = _mm256_sub_pd (vy, ry);
+                d2 = _mm256_add_pd (_mm256_mul_pd (vx, vx), _mm256_mul_pd (vy, vy));
+                px = _mm256_sub_pd (px, x1);
+                py = _mm256_sub_pd (py, y1);
+                e2 = _mm256_add_pd (_mm256_mul_pd (px, px), _mm256_mul_pd (py, py));
+                d2 = _mm256_min_pd (e2, d2);
+                d2 = _mm256_blendv_pd (d2, d, in_sweep);
+                if (results != NULL)
+                {
+                        gt = _mm256_movemask_pd (_mm256_cmp_pd (d2, outer, _CMP_GT_OQ));
+                        for (k = 0; k < 4; k++)
+                        {
+                                results[i + k] = ((gt >> k) & 1) ? OUTSIDE : ON_EDGE;
+                        }
+                }
+                if (distances != NULL)
+                {
+                        _mm256_storeu_pd (distances + i, _mm256_sqrt_pd (d2));
+                }
+        }
+        dxf_clash_arc_scalar (x + i, y + i, n - i, shape,
+          (results != NULL) ? results + i : NULL,
+          (distances != NULL) ? distances + i : NULL);
+}
+#endif
+
+
+/*!
+ * \brief Run the circle kernel of the active instruction set.
+ */
+static void
+dxf_clash_circle
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        switch (dxf_simd_get ())
+        {
+#ifdef DXF_SIMD_X86
+                case DXF_SIMD_AVX2:
+                        dxf_clash_circle_avx2 (x, y, n, shape, results, distances);
+                        break;
+                case DXF_SIMD_SSE2:
+                        dxf_clash_circle_sse2 (x, y, n, shape, results, distances);
+                        break;
+#endif
+                default:
+                        dxf_clash_circle_scalar (x, y, n, shape, results, distances);
+                        break;
+        }
+}
+
+
+/*!
+ * \brief Run the segment kernel of the active instruction set.
+ */
+static void
+dxf_clash_segment
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        switch (dxf_simd_get ())
+        {
+#ifdef DXF_SIMD_X86
+                case DXF_SIMD_AVX2:
+                        dxf_clash_segment_avx2 (x, y, n, shape, results, distances);
+                        break;
+                case DXF_SIMD_SSE2:
+                        dxf_clash_segment_sse2 (x, y, n, shape, results, distances);
+                        break;
+#endif
+                default:
+                        dxf_clash_segment_scalar (x, y, n, shape, results, distances);
+                        break;
+        }
+}
+
+
+/*!
+ * \brief Run the arc kernel of the active instruction set.
+ */
+static void
+dxf_clash_arc
+(
+        const double *x,
+        const double *y,
+        int n,
+        const DxfClashShape *shape,
+        char *results,
+        double *distances
+)
+{
+        switch (dxf_simd_get ())
+        {
+#ifdef DXF_SIMD_X86
+                case DXF_SIMD_AVX2:
+                        dxf_clash_arc_avx2 (x, y, n, shape, results, distances);
+                        break;
+                case DXF_SIMD_SSE2:
+                        dxf_clash_arc_sse2 (x, y, n, shape, results, distances);
+                        break;
+#endif
+                default:
+                        dxf_clash_arc_scalar (x, y, n, shape, results, distances);
+                        break;
+        }
+}
+
+
+/*!
+ * \brief Prepare an arc for the arc kernel.
+ */
+static void
+dxf_clash_arc_setup
+(
+        DxfClashShape *shape,
+        double cx,
+        double cy,
+        double radius,
+        double start_angle,
+                /*!< Start angle in degrees. */
+        double end_angle,
+                /*!< End angle in degrees, counterclockwise from the
+                 * start angle. */
+        double tolerance
+)
+{
+        double sweep;
+
+        shape->x0 = cx;
+        shape->y0 = cy;
+        shape->radius = radius;
+        shape->dx = cos (start_angle * M_PI / 180.0);
+        shape->dy = sin (start_angle * M_PI / 180.0);
+        shape->ex = cos (end_angle * M_PI / 180.0);
+        shape->ey = sin (end_angle * M_PI / 180.0);
+        shape->x1 = cx + radius * shape->ex;
+        shape->y1 = cy + radius * shape->ey;
+        sweep = fmod (end_angle - start_angle, 360.0);
+        if (sweep < 0.0)
+                sweep += 360.0;
+        if (sweep == 0.0)
+                shape->sweep = 0;
+        else if (sweep <= 180.0)
+                shape->sweep = 1;
+        else
+                shape->sweep = 2;
+        tolerance = fabs (tolerance);
+        shape->inner = -1.0;
+        shape->outer = tolerance * tolerance;
+}
+
+
+/*!
+ * \brief Prepare a segment for the segment kernel.
+ */
+static void
+dxf_clash_segment_setup
+(
+        DxfClashShape *shape,
+        double x0,
+        double y0,
+        double x1,
+        double y1,
+        double tolerance
+)
+{
+        double length2;
+
+        shape->x0 = x0;
+        shape->y0 = y0;
+        shape->x1 = x1;
+        shape->y1 = y1;
+        shape->dx = x1 - x0;
+        shape->dy = y1 - y0;
+        length2 = shape->dx * shape->dx + shape->dy * shape->dy;
+        /* A degenerate segment is a point, the projection is clamped
+         * to the start point. */
+        shape->radius = (length2 > 0.0) ? 1.0 / length2 : 0.0;
+        tolerance = fabs (tolerance);
+        shape->inner = -1.0;
+        shape->outer = tolerance * tolerance;
+}
+
+
+/*!
+ * \brief Classify points against circles.
+ *
+ * Tests \c number_of_points points against \c number_of_circles
+ * circles given as flat coordinate arrays, the result for point \c i
+ * and circle \c j is stored in
+ * <tt>results[j * number_of_points + i]</tt>.\n
+ * A point within \c tolerance of the circumference is \c ON_EDGE, with a
+ * \c tolerance of \c 0.0 the test matches
+ * dxf_circle_test_point_in_circle ().\n
+ * The points are processed with the SIMD instruction set returned by
+ * dxf_simd_get ().
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_clash_classify_circles
+(
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        const double *cx,
+                /*!< X-values of the circle centers. */
+        const double *cy,
+                /*!< Y-values of the circle centers. */
+        const double *radius,
+                /*!< Radii of the circles. */
+        int number_of_circles,
+                /*!< Number of circles. */
+        double tolerance,
+                /*!< Distance from the circumference within which a
+                 * point is \c ON_EDGE. */
+        char *results
+                /*!< Receives \c number_of_points * \c number_of_circles
+                 * results of \c INSIDE, \c OUTSIDE or \c ON_EDGE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClashShape shape;
+        int j;
+
+        /* Do some basic checks. */
+        if ((x == NULL) || (y == NULL) || (cx == NULL) || (cy == NULL)
+          || (radius == NULL) || (results == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (j = 0; j < number_of_circles; j++)
+        {
+                shape.x0 = cx[j];
+                shape.y0 = cy[j];
+                shape.radius = radius[j];
+                dxf_clash_limits (&shape, radius[j], tolerance);
+                dxf_clash_circle (x, y, number_of_points, &shape,
+                  results + (size_t) j * number_of_points, NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the distances of points to circles.
+ *
+ * The signed distance of point \c i to the circumference of circle \c j
+ * is stored in <tt>distances[j * number_of_points + i]</tt>, negative
+ * for points inside the circle.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_clash_distance_circles
+(
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        const double *cx,
+                /*!< X-values of the circle centers. */
+        const double *cy,
+                /*!< Y-values of the circle centers. */
+        const double *radius,
+                /*!< Radii of the circles. */
+        int number_of_circles,
+                /*!< Number of circles. */
+        double *distances
+                /*!< Receives \c number_of_points * \c number_of_circles
+                 * distances. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClashShape shape;
+        int j;
+
+        /* Do some basic checks. */
+        if ((x == NULL) || (y == NULL) || (cx == NULL) || (cy == NULL)
+          || (radius == NULL) || (distances == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (j = 0; j < number_of_circles; j++)
+        {
+                shape.x0 = cx[j];
+                shape.y0 = cy[j];
+                shape.radius = radius[j];
+                dxf_clash_limits (&shape, radius[j], 0.0);
+                dxf_clash_circle (x, y, number_of_points, &shape,
+                  NULL, distances + (size_t) j * number_of_points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Classify points against arcs.
+ *
+ * An arc has no interior, a point within \c tolerance of the arc is
+ * \c ON_EDGE and any other point is \c OUTSIDE.\n
+ * The arcs run counterclockwise from \c start_angle to \c end_angle in
+ * degrees, as in a DXF \c ARC entity, equal angles give a full circle.\n
+ * The result for point \c i and arc \c j is stored in
+ * <tt>results[j * number_of_points + i]</tt>.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_clash_classify_arcs
+(
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        const double *cx,
+                /*!< X-values of the arc centers. */
+        const double *cy,
+                /*!< Y-values of the arc centers. */
+        const double *radius,
+                /*!< Radii of the arcs. */
+        const double *start_angle,
+                /*!< Start angles of the arcs in degrees. */
+        const double *end_angle,
+                /*!< End angles of the arcs in degrees. */
+        int number_of_arcs,
+                /*!< Number of arcs. */
+        double tolerance,
+                /*!< Distance from the arc within which a point is
+                 * \c ON_EDGE. */
+        char *results
+                /*!< Receives \c number_of_points * \c number_of_arcs
+                 * results of \c OUTSIDE or \c ON_EDGE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClashShape shape;
+        int j;
+
+        /* Do some basic checks. */
+        if ((x == NULL) || (y == NULL) || (cx == NULL) || (cy == NULL)
+          || (radius == NULL) || (start_angle == NULL)
+          || (end_angle == NULL) || (results == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (j = 0; j < number_of_arcs; j++)
+        {
+                dxf_clash_arc_setup (&shape, cx[j], cy[j], radius[j],
+                  start_angle[j], end_angle[j], tolerance);
+                dxf_clash_arc (x, y, number_of_points, &shape,
+                  results + (size_t) j * number_of_points, NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the distances of points to arcs.
+ *
+ * The distance of point \c i to arc \c j is stored in
+ * <tt>distances[j * number_of_points + i]</tt>.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_clash_distance_arcs
+(
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        const double *cx,
+                /*!< X-values of the arc centers. */
+        const double *cy,
+                /*!< Y-values of the arc centers. */
+        const double *radius,
+                /*!< Radii of the arcs. */
+        const double *start_angle,
+                /*!< Start angles of the arcs in degrees. */
+        const double *end_angle,
+                /*!< End angles of the arcs in degrees. */
+        int number_of_arcs,
+                /*!< Number of arcs. */
+        double *distances
+                /*!< Receives \c number_of_points * \c number_of_arcs
+                 * distances. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClashShape shape;
+        int j;
+
+        /* Do some basic checks. */
+        if ((x == NULL) || (y == NULL) || (cx == NULL) || (cy == NULL)
+          || (radius == NULL) || (start_angle == NULL)
+          || (end_angle == NULL) || (distances == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (j = 0; j < number_of_arcs; j++)
+        {
+                dxf_clash_arc_setup (&shape, cx[j], cy[j], radius[j],
+                  start_angle[j], end_angle[j], 0.0);
+                dxf_clash_arc (x, y, number_of_points, &shape,
+                  NULL, distances + (size_t) j * number_of_points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Classify points against line segments.
+ *
+ * A segment has no interior, a point within \c tolerance of the segment
+ * is \c ON_EDGE and any other point is \c OUTSIDE.\n
+ * The result for point \c i and segment \c j is stored in
+ * <tt>results[j * number_of_points + i]</tt>.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_clash_classify_segments
+(
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        const double *x0,
+                /*!< X-values of the segment start points. */
+        const double *y0,
+                /*!< Y-values of the segment start points. */
+        const double *x1,
+                /*!< X-values of the segment end points. */
+        const double *y1,
+                /*!< Y-values of the segment end points. */
+        int number_of_segments,
+                /*!< Number of segments. */
+        double tolerance,
+                /*!< Distance from the segment within which a point is
+                 * \c ON_EDGE. */
+        char *results
+                /*!< Receives \c number_of_points * \c number_of_segments
+                 * results of \c OUTSIDE or \c ON_EDGE. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClashShape shape;
+        int j;
+
+        /* Do some basic checks. */
+        if ((x == NULL) || (y == NULL) || (x0 == NULL) || (y0 == NULL)
+          || (x1 == NULL) || (y1 == NULL) || (results == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (j = 0; j < number_of_segments; j++)
+        {
+                dxf_clash_segment_setup (&shape, x0[j], y0[j], x1[j], y1[j], tolerance);
+                dxf_clash_segment (x, y, number_of_points, &shape,
+                  results + (size_t) j * number_of_points, NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the distances of points to line segments.
+ *
+ * The distance of point \c i to segment \c j is stored in
+ * <tt>distances[j * number_of_points + i]</tt>.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_clash_distance_segments
+(
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        const double *x0,
+                /*!< X-values of the segment start points. */
+        const double *y0,
+                /*!< Y-values of the segment start points. */
+        const double *x1,
+                /*!< X-values of the segment end points. */
+        const double *y1,
+                /*!< Y-values of the segment end points. */
+        int number_of_segments,
+                /*!< Number of segments. */
+        double *distances
+                /*!< Receives \c number_of_points * \c number_of_segments
+                 * distances. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfClashShape shape;
+        int j;
+
+        /* Do some basic checks. */
+        if ((x == NULL) || (y == NULL) || (x0 == NULL) || (y0 == NULL)
+          || (x1 == NULL) || (y1 == NULL) || (distances == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (j = 0; j < number_of_segments; j++)
+        {
+                dxf_clash_segment_setup (&shape, x0[j], y0[j], x1[j], y1[j], 0.0);
+                dxf_clash_segment (x, y, number_of_points, &shape,
+                  NULL, distances + (size_t) j * number_of_points);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,66 @@
+/*!
+ * \file clash.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for batch point classification and distance kernels
+ * (clash checks).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_CLASH_H
+#define LIBDXF_SRC_CLASH_H
+
+
+#include <math.h>
+#include "global.h"
+#include "simd.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+int dxf_clash_classify_circles (const double *x, const double *y, int number_of_points, const double *cx, const double *cy, const double *radius, int number_of_circles, double tolerance, char *results);
+int dxf_clash_distance_circles (const double *x, const double *y, int number_of_points, const double *cx, const double *cy, const double *radius, int number_of_circles, double *distances);
+int dxf_clash_classify_arcs (const double *x, const double *y, int number_of_points, const double *cx, const double *cy, const double *radius, const double *start_angle, const double *end_angle, int number_of_arcs, double tolerance, char *results);
+int dxf_clash_distance_arcs (const double *x, const double *y, int number_of_points, const double *cx, const double *cy, const double *radius, const double *start_angle, const double *end_angle, int number_of_arcs, double *distances);
+int dxf_clash_classify_segments (const double *x, const double *y, int number_of_points, const double *x0, const double *y0, const double *x1, const double *y1, int number_of_segments, double tolerance, char *results);
+int dxf_clash_distance_segments (const double *x, const double *y, int number_of_points, const double *x0, const double *y0, const double *x1, const double *y1, int number_of_segments, double *distances);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_CLASH_H */
+
+
+/* EOF */
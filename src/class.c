@@ -44,6 +44,7 @@
 
 
 #include "class.h"
+#include "util.h"
 
 
 /*!
@@ -151,7 +152,7 @@ dxf_class_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -159,20 +160,19 @@ dxf_class_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (class == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 class = dxf_class_init (class);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -180,8 +180,6 @@ dxf_class_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "0") == 0)
@@ -193,29 +191,25 @@ dxf_class_read
                          * and other \c class variables  will not be
                          * read. See the while condition above.
                          */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->record_type);
+                        dxf_read_string (&class->record_type, fp);
                 }
                 else if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a record
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->record_name);
+                        dxf_read_string (&class->record_name, fp);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a class name.
                          */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->class_name);
+                        dxf_read_string (&class->class_name, fp);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing the
                          * application name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, class->app_name);
+                        dxf_read_string (&class->app_name, fp);
                 }
                 else if (strcmp (temp_string, "90") == 0)
                 {
@@ -241,16 +235,20 @@ dxf_class_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (class->record_type, "") == 0)
@@ -275,8 +273,6 @@ dxf_class_read
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -485,6 +481,7 @@ dxf_class_free_list
         while (classes != NULL)
         {
                 DxfClass *iter = (DxfClass *) classes->next;
+                classes->next = NULL;
                 dxf_class_free (classes);
                 classes = (DxfClass *) iter;
         }
@@ -1610,9 +1607,6 @@ dxf_class_get_last
         }
         if (class->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfClass *) class);
         }
         DxfClass *iter = (DxfClass *) class->next;
@@ -2323,6 +2323,7 @@ dxf_RGB_color_free_list
         while (colors != NULL)
         {
                 DxfRGBColor *iter = (DxfRGBColor *) colors->next;
+                colors->next = NULL;
                 dxf_RGB_color_free (colors);
                 colors = (DxfRGBColor *) iter;
         }
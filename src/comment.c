@@ -235,6 +235,7 @@ dxf_comment_free_list
         while (comments != NULL)
         {
                 DxfComment *iter = (DxfComment *) comments->next;
+                comments->next = NULL;
                 dxf_comment_free (comments);
                 comments = (DxfComment *) iter;
         }
@@ -499,9 +500,6 @@ dxf_comment_get_last
         }
         if (comment->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfComment *) comment);
         }
         DxfComment *iter = (DxfComment *) comment->next;
@@ -0,0 +1,971 @@
+/*!
+ * \file descriptor.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF entity descriptors.
+ *
+ * An entity descriptor is a table of the fields of an entity type,
+ * driving one generic engine for reading, writing, freeing and copying
+ * entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "descriptor.h"
+#include "util.h"
+
+
+#define DXF_DESCRIPTOR_CONTEXT_APPLICATION -1
+        /*!< \brief Reading inside an application defined 102 group. */
+
+
+/*!
+ * \brief Get the address of the member of a field in an entity.
+ */
+static void *
+dxf_descriptor_member
+(
+        void *entity,
+                /*!< Pointer to the entity. */
+        const DxfFieldDescriptor *field
+                /*!< Field of the entity. */
+)
+{
+        return ((char *) entity + field->offset);
+}
+
+
+/*!
+ * \brief Get the point holding the coordinate of a field in an entity,
+ * allocating the point when it does not exist yet.
+ *
+ * The point only serves as a coordinate holder, so it is allocated
+ * with \c dxf_point_new () and not initialized as a \c POINT entity.
+ *
+ * \return a pointer to the point, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfPoint *
+dxf_descriptor_point
+(
+        void *entity,
+                /*!< Pointer to the entity. */
+        const DxfFieldDescriptor *field
+                /*!< Point coordinate field of the entity. */
+)
+{
+        DxfPoint **point = (DxfPoint **) dxf_descriptor_member (entity, field);
+
+        if (*point == NULL)
+        {
+                *point = dxf_point_new ();
+        }
+        return (*point);
+}
+
+
+/*!
+ * \brief Test if an earlier field of a descriptor refers to the same
+ * allocated member as \c field.
+ *
+ * Used to visit every allocated member only once when freeing or
+ * copying an entity.
+ */
+static int
+dxf_descriptor_is_alias
+(
+        DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        int field
+                /*!< Index of the field. */
+)
+{
+        int i;
+
+        for (i = 0; i < field; i++)
+        {
+                if ((descriptor->fields[i].offset == descriptor->fields[field].offset)
+                  && (descriptor->fields[i].type != DXF_FIELD_SUBCLASS))
+                {
+                        return (TRUE);
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Test if a field matches a group read from a DXF file.
+ */
+static int
+dxf_descriptor_field_matches
+(
+        const DxfFieldDescriptor *field,
+                /*!< Field of the entity. */
+        const char *value,
+                /*!< Value as read from the DXF file. */
+        int context
+                /*!< Group the value was read in. */
+)
+{
+        if (field->type == DXF_FIELD_SUBCLASS)
+        {
+                return (strcmp (field->default_string, value) == 0);
+        }
+        return ((field->flags & (DXF_FIELD_REACTORS | DXF_FIELD_XDICTIONARY)) == context);
+}
+
+
+/*!
+ * \brief Find the field of an entity descriptor for a group read from a
+ * DXF file.
+ *
+ * Uses the lookup tables when they are built, and falls back to a scan
+ * of all fields while another thread is still building them.
+ *
+ * \return the index of the field, or \c -1 when no field matches.
+ */
+static int
+dxf_descriptor_find_field
+(
+        const DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        int group_code,
+                /*!< Group code as read from the DXF file. */
+        const char *value,
+                /*!< Value as read from the DXF file. */
+        int context
+                /*!< Group the value was read in. */
+)
+{
+        int i;
+
+        if (__atomic_load_n (&descriptor->lookup_state, __ATOMIC_ACQUIRE)
+          != DXF_DESCRIPTOR_LOOKUP_BUILT)
+        {
+                for (i = 0; i < descriptor->number_of_fields; i++)
+                {
+                        if ((descriptor->fields[i].group_code == group_code)
+                          && (dxf_descriptor_field_matches (&descriptor->fields[i], value, context)))
+                        {
+                                return (i);
+                        }
+                }
+                return (-1);
+        }
+        if ((group_code <= 0) || (group_code > DXF_DESCRIPTOR_MAX_GROUP_CODE))
+        {
+                return (-1);
+        }
+        for (i = descriptor->lookup[group_code]; i >= 0; i = descriptor->next_field[i])
+        {
+                if (dxf_descriptor_field_matches (&descriptor->fields[i], value, context))
+                {
+                        return (i);
+                }
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Store a value read from a DXF file in the member of a field.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_descriptor_store
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to the input file (or device). */
+        void *entity,
+                /*!< Pointer to the entity. */
+        const DxfFieldDescriptor *field,
+                /*!< Field of the entity. */
+        const char *value
+                /*!< Value as read from the DXF file. */
+)
+{
+        void *member = dxf_descriptor_member (entity, field);
+        DxfPoint *point;
+
+        switch (field->type)
+        {
+                case DXF_FIELD_HANDLE:
+                        *(int *) member = (int) strtol (value, NULL, 16);
+                        break;
+                case DXF_FIELD_STRING:
+                        free (*(char **) member);
+                        *(char **) member = strdup (value);
+                        break;
+                case DXF_FIELD_INT16:
+                        *(int16_t *) member = (int16_t) strtol (value, NULL, 10);
+                        break;
+                case DXF_FIELD_INT32:
+                        *(int32_t *) member = (int32_t) strtol (value, NULL, 10);
+                        break;
+                case DXF_FIELD_DOUBLE:
+                        *(double *) member = strtod (value, NULL);
+                        break;
+                case DXF_FIELD_POINT_X:
+                case DXF_FIELD_POINT_Y:
+                case DXF_FIELD_POINT_Z:
+                        point = dxf_descriptor_point (entity, field);
+                        if (point == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        if (field->type == DXF_FIELD_POINT_X)
+                                point->x0 = strtod (value, NULL);
+                        else if (field->type == DXF_FIELD_POINT_Y)
+                                point->y0 = strtod (value, NULL);
+                        else
+                                point->z0 = strtod (value, NULL);
+                        break;
+                case DXF_FIELD_BINARY_DATA:
+                        /* Consecutive data lines are decoded into one
+                         * buffer. */
+                        if (*(DxfBinaryData **) member == NULL)
+                        {
+                                *(DxfBinaryData **) member = dxf_binary_data_init (dxf_binary_data_new ());
+                                if (*(DxfBinaryData **) member == NULL)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                        dxf_binary_data_append_hex (fp, *(DxfBinaryData **) member, value);
+                        break;
+                case DXF_FIELD_SUBCLASS:
+                        break;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the group code lookup tables of an entity descriptor.
+ *
+ * The tables let dxf_descriptor_read () find the field of a group
+ * without scanning all fields, dxf_descriptor_read () builds them on
+ * first use.\n
+ * Only the first caller builds the tables, callers racing with it
+ * return at once and their readers scan the fields until the tables
+ * are published.  Building the tables of a descriptor that has them
+ * already does nothing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_descriptor_build_lookup
+(
+        DxfEntityDescriptor *descriptor
+                /*!< Entity descriptor. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int16_t *lookup;
+        int16_t *next_field;
+        int state = DXF_DESCRIPTOR_LOOKUP_NONE;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if (descriptor == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!__atomic_compare_exchange_n (&descriptor->lookup_state,
+          &state, DXF_DESCRIPTOR_LOOKUP_BUILDING, FALSE,
+          __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+                /* Built, or being built by another thread. */
+                return (EXIT_SUCCESS);
+        }
+        lookup = malloc ((DXF_DESCRIPTOR_MAX_GROUP_CODE + 1) * sizeof (int16_t));
+        next_field = malloc ((descriptor->number_of_fields + 1) * sizeof (int16_t));
+        if ((lookup == NULL) || (next_field == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (lookup);
+                free (next_field);
+                __atomic_store_n (&descriptor->lookup_state,
+                  DXF_DESCRIPTOR_LOOKUP_NONE, __ATOMIC_RELEASE);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i <= DXF_DESCRIPTOR_MAX_GROUP_CODE; i++)
+        {
+                lookup[i] = -1;
+        }
+        /* Chain the fields with the same group code in table order. */
+        for (i = descriptor->number_of_fields - 1; i >= 0; i--)
+        {
+                j = descriptor->fields[i].group_code;
+                next_field[i] = lookup[j];
+                lookup[j] = i;
+        }
+        descriptor->next_field = next_field;
+        descriptor->lookup = lookup;
+        __atomic_store_n (&descriptor->lookup_state,
+          DXF_DESCRIPTOR_LOOKUP_BUILT, __ATOMIC_RELEASE);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for an entity described by an entity
+ * descriptor.
+ *
+ * Fill the memory contents with zeros.
+ */
+void *
+dxf_descriptor_new
+(
+        DxfEntityDescriptor *descriptor
+                /*!< Entity descriptor. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        void *entity = NULL;
+        size_t size;
+
+        /* Do some basic checks. */
+        if (descriptor == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        size = descriptor->size;
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((entity = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                entity = NULL;
+        }
+        else
+        {
+                memset (entity, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entity);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize the fields of an entity
+ * described by an entity descriptor with their default values.
+ *
+ * Points are allocated for point coordinate fields, binary data lists
+ * are left empty.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+void *
+dxf_descriptor_init
+(
+        DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        void *entity
+                /*!< Pointer to the entity, \c NULL allocates a new
+                 * entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfFieldDescriptor *field;
+        void *member;
+        DxfPoint *point;
+        int i;
+
+        /* Do some basic checks. */
+        if (descriptor == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (entity == NULL)
+        {
+                entity = dxf_descriptor_new (descriptor);
+        }
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        for (i = 0; i < descriptor->number_of_fields; i++)
+        {
+                field = &descriptor->fields[i];
+                member = dxf_descriptor_member (entity, field);
+                switch (field->type)
+                {
+                        case DXF_FIELD_HANDLE:
+                                *(int *) member = (int) field->default_value;
+                                break;
+                        case DXF_FIELD_STRING:
+                                if (dxf_descriptor_is_alias (descriptor, i))
+                                {
+                                        break;
+                                }
+                                *(char **) member = strdup
+                                  ((field->default_string != NULL) ? field->default_string : "");
+                                break;
+                        case DXF_FIELD_INT16:
+                                *(int16_t *) member = (int16_t) field->default_value;
+                                break;
+                        case DXF_FIELD_INT32:
+                                *(int32_t *) member = (int32_t) field->default_value;
+                                break;
+                        case DXF_FIELD_DOUBLE:
+                                *(double *) member = field->default_value;
+                                break;
+                        case DXF_FIELD_POINT_X:
+                        case DXF_FIELD_POINT_Y:
+                        case DXF_FIELD_POINT_Z:
+                                point = dxf_descriptor_point (entity, field);
+                                if (point == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (field->type == DXF_FIELD_POINT_X)
+                                        point->x0 = field->default_value;
+                                else if (field->type == DXF_FIELD_POINT_Y)
+                                        point->y0 = field->default_value;
+                                else
+                                        point->z0 = field->default_value;
+                                break;
+                        case DXF_FIELD_BINARY_DATA:
+                                *(DxfBinaryData **) member = NULL;
+                                break;
+                        case DXF_FIELD_SUBCLASS:
+                                break;
+                }
+        }
+        *(void **) ((char *) entity + descriptor->next_offset) = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entity);
+}
+
+
+/*!
+ * \brief Read data from a DXF file into an entity described by an
+ * entity descriptor.
+ *
+ * The last line read from file contained the string with the entity
+ * name.\n
+ * Now follows some data for the entity, to be terminated with a "  0"
+ * string announcing the following entity, or the end of the section
+ * marker \c ENDSEC.\n
+ * Group codes are looked up in the tables of
+ * dxf_descriptor_build_lookup (), built on the first call, so the cost
+ * of a group does not depend on the number of fields of the entity.\n
+ * Data of application defined 102 groups is skipped.
+ *
+ * \return a pointer to \c entity, or \c NULL when an error occurred.
+ */
+void *
+dxf_descriptor_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        void *entity
+                /*!< Pointer to the entity, \c NULL allocates and
+                 * initializes a new entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char group_code_string[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int group_code;
+        int context;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (descriptor == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (entity == NULL)
+        {
+                entity = dxf_descriptor_init (descriptor, NULL);
+                if (entity == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        /* Without tables the fields are scanned. */
+        dxf_descriptor_build_lookup (descriptor);
+        context = 0;
+        while (dxf_read_line (group_code_string, fp) == EXIT_SUCCESS)
+        {
+                group_code = (int) strtol (group_code_string, NULL, 10);
+                if (group_code == 0)
+                {
+#if DEBUG
+                        DXF_DEBUG_END
+#endif
+                        return (entity);
+                }
+                if (dxf_read_value_line (value, fp) == EXIT_FAILURE)
+                {
+                        break;
+                }
+                if (group_code == 999)
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", value);
+                        continue;
+                }
+                if (group_code == 102)
+                {
+                        if (strcmp (value, "{ACAD_REACTORS") == 0)
+                                context = DXF_FIELD_REACTORS;
+                        else if (strcmp (value, "{ACAD_XDICTIONARY") == 0)
+                                context = DXF_FIELD_XDICTIONARY;
+                        else if (value[0] == '{')
+                                context = DXF_DESCRIPTOR_CONTEXT_APPLICATION;
+                        else
+                                context = 0;
+                        continue;
+                }
+                if (context == DXF_DESCRIPTOR_CONTEXT_APPLICATION)
+                {
+                        continue;
+                }
+                i = dxf_descriptor_find_field (descriptor, group_code, value, context);
+                if (i >= 0)
+                {
+                        if (dxf_descriptor_store (fp, entity, &descriptor->fields[i], value) == EXIT_FAILURE)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                }
+                else if (group_code == 100)
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
+                          (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                }
+                else
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                }
+        }
+        fprintf (stderr,
+          (_("Error in %s () while reading from: %s in line: %d.\n")),
+          __FUNCTION__, fp->filename, fp->line_number);
+        return (NULL);
+}
+
+
+/*!
+ * \brief Write DXF output to fp for an entity described by an entity
+ * descriptor.
+ *
+ * Fields are written in table order, when the \c acad_version_number
+ * of \c fp lies within the version range of the field.\n
+ * Optional fields with their default value are omitted.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occured.
+ */
+int
+dxf_descriptor_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfFieldDescriptor *field;
+        const char *string;
+        DxfBinaryData *data;
+        DxfPoint *point;
+        void *member;
+        double number;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((descriptor == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Start writing output. */
+        fprintf (fp->fp, "  0\n%s\n", descriptor->name);
+        for (i = 0; i < descriptor->number_of_fields; i++)
+        {
+                field = &descriptor->fields[i];
+                if ((field->flags & DXF_FIELD_READ_ONLY)
+                  || (fp->acad_version_number < field->min_version)
+                  || ((field->max_version > 0)
+                  && (fp->acad_version_number > field->max_version))
+                  || ((field->flags & DXF_FIELD_FLATLAND) && !DXF_FLATLAND))
+                {
+                        continue;
+                }
+                member = dxf_descriptor_member (entity, field);
+                string = NULL;
+                number = 0.0;
+                switch (field->type)
+                {
+                        case DXF_FIELD_HANDLE:
+                                if (*(int *) member == -1)
+                                {
+                                        continue;
+                                }
+                                number = *(int *) member;
+                                break;
+                        case DXF_FIELD_STRING:
+                                string = *(char **) member;
+                                if (string == NULL)
+                                {
+                                        string = (field->default_string != NULL) ? field->default_string : "";
+                                }
+                                if ((field->flags & DXF_FIELD_OPTIONAL)
+                                  && (strcmp (string, (field->default_string != NULL) ? field->default_string : "") == 0))
+                                {
+                                        continue;
+                                }
+                                break;
+                        case DXF_FIELD_INT16:
+                                number = *(int16_t *) member;
+                                break;
+                        case DXF_FIELD_INT32:
+                                number = *(int32_t *) member;
+                                break;
+                        case DXF_FIELD_DOUBLE:
+                                number = *(double *) member;
+                                break;
+                        case DXF_FIELD_POINT_X:
+                        case DXF_FIELD_POINT_Y:
+                        case DXF_FIELD_POINT_Z:
+                                point = *(DxfPoint **) member;
+                                if (point == NULL)
+                                        number = field->default_value;
+                                else if (field->type == DXF_FIELD_POINT_X)
+                                        number = point->x0;
+                                else if (field->type == DXF_FIELD_POINT_Y)
+                                        number = point->y0;
+                                else
+                                        number = point->z0;
+                                break;
+                        case DXF_FIELD_BINARY_DATA:
+                                data = *(DxfBinaryData **) member;
+                                if (data != NULL)
+                                {
+                                        dxf_binary_data_write_chunks (fp,
+                                          field->group_code, data);
+                                }
+                                continue;
+                        case DXF_FIELD_SUBCLASS:
+                                string = field->default_string;
+                                break;
+                }
+                if ((string == NULL)
+                  && (field->type != DXF_FIELD_HANDLE)
+                  && (field->flags & DXF_FIELD_OPTIONAL)
+                  && (number == field->default_value))
+                {
+                        continue;
+                }
+                if (field->flags & DXF_FIELD_REACTORS)
+                {
+                        fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
+                }
+                else if (field->flags & DXF_FIELD_XDICTIONARY)
+                {
+                        fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
+                }
+                if (string != NULL)
+                        fprintf (fp->fp, "%3d\n%s\n", field->group_code, string);
+                else if (field->type == DXF_FIELD_HANDLE)
+                        fprintf (fp->fp, "%3d\n%X\n", field->group_code, (int) number);
+                else if ((field->type == DXF_FIELD_INT16)
+                  || (field->type == DXF_FIELD_INT32))
+                        fprintf (fp->fp, "%3d\n%d\n", field->group_code, (int) number);
+                else
+                        fprintf (fp->fp, "%3d\n%f\n", field->group_code, number);
+                if (field->flags & (DXF_FIELD_REACTORS | DXF_FIELD_XDICTIONARY))
+                {
+                        fprintf (fp->fp, "102\n}\n");
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for an entity described by an
+ * entity descriptor and all it's data fields.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_descriptor_free
+(
+        DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        void *entity
+                /*!< Pointer to the memory occupied by the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfFieldDescriptor *field;
+        void *member;
+        int i;
+
+        /* Do some basic checks. */
+        if ((descriptor == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (*(void **) ((char *) entity + descriptor->next_offset) != NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () pointer to next was not NULL.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < descriptor->number_of_fields; i++)
+        {
+                field = &descriptor->fields[i];
+                member = dxf_descriptor_member (entity, field);
+                switch (field->type)
+                {
+                        case DXF_FIELD_STRING:
+                                free (*(char **) member);
+                                *(char **) member = NULL;
+                                break;
+                        case DXF_FIELD_POINT_X:
+                        case DXF_FIELD_POINT_Y:
+                        case DXF_FIELD_POINT_Z:
+                                if (*(DxfPoint **) member != NULL)
+                                {
+                                        dxf_point_free (*(DxfPoint **) member);
+                                        *(DxfPoint **) member = NULL;
+                                }
+                                break;
+                        case DXF_FIELD_BINARY_DATA:
+                                if (*(DxfBinaryData **) member != NULL)
+                                {
+                                        dxf_binary_data_free_list (*(DxfBinaryData **) member);
+                                        *(DxfBinaryData **) member = NULL;
+                                }
+                                break;
+                        default:
+                                break;
+                }
+        }
+        free (entity);
+        entity = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Make a deep copy of an entity described by an entity
+ * descriptor.
+ *
+ * The \c next member of the copy is \c NULL.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+void *
+dxf_descriptor_copy
+(
+        DxfEntityDescriptor *descriptor,
+                /*!< Entity descriptor. */
+        void *entity
+                /*!< Pointer to the entity to be copied. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const DxfFieldDescriptor *field;
+        DxfBinaryData *data;
+        DxfPoint *point;
+        void *member;
+        void *copy;
+        int i;
+
+        /* Do some basic checks. */
+        if ((descriptor == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = dxf_descriptor_new (descriptor);
+        if (copy == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memcpy (copy, entity, descriptor->size);
+        *(void **) ((char *) copy + descriptor->next_offset) = NULL;
+        for (i = 0; i < descriptor->number_of_fields; i++)
+        {
+                field = &descriptor->fields[i];
+                if (dxf_descriptor_is_alias (descriptor, i))
+                {
+                        continue;
+                }
+                member = dxf_descriptor_member (copy, field);
+                switch (field->type)
+                {
+                        case DXF_FIELD_STRING:
+                                if (*(char **) member != NULL)
+                                {
+                                        *(char **) member = strdup (*(char **) member);
+                                }
+                                break;
+                        case DXF_FIELD_POINT_X:
+                        case DXF_FIELD_POINT_Y:
+                        case DXF_FIELD_POINT_Z:
+                                point = *(DxfPoint **) member;
+                                *(DxfPoint **) member = NULL;
+                                if (point != NULL)
+                                {
+                                        *(DxfPoint **) member = dxf_descriptor_point (copy, field);
+                                        if (*(DxfPoint **) member == NULL)
+                                        {
+                                                break;
+                                        }
+                                        (*(DxfPoint **) member)->x0 = point->x0;
+                                        (*(DxfPoint **) member)->y0 = point->y0;
+                                        (*(DxfPoint **) member)->z0 = point->z0;
+                                }
+                                break;
+                        case DXF_FIELD_BINARY_DATA:
+                                data = *(DxfBinaryData **) member;
+                                *(DxfBinaryData **) member = NULL;
+                                if (data != NULL)
+                                {
+                                        *(DxfBinaryData **) member = dxf_binary_data_set_data
+                                          (dxf_binary_data_init (dxf_binary_data_new ()),
+                                          data->data, data->length);
+                                }
+                                break;
+                        default:
+                                break;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/* EOF */
@@ -0,0 +1,192 @@
+/*!
+ * \file descriptor.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF entity descriptors.
+ *
+ * An entity descriptor is a table of the fields of an entity type,
+ * driving one generic engine for reading, writing, freeing and copying
+ * entities.\n
+ * The \c LINE entity is the pilot of the engine, the other entity types
+ * keep their hand written functions until they are ported.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DESCRIPTOR_H
+#define LIBDXF_SRC_DESCRIPTOR_H
+
+
+#include <stddef.h>
+#include "global.h"
+#include "binary_data.h"
+#include "point.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_DESCRIPTOR_MAX_GROUP_CODE 1071
+        /*!< \brief Highest DXF group code. */
+
+
+#define DXF_DESCRIPTOR_LOOKUP_NONE 0
+        /*!< \brief The lookup tables of a descriptor are not built. */
+#define DXF_DESCRIPTOR_LOOKUP_BUILDING 1
+        /*!< \brief A thread builds the lookup tables of a descriptor. */
+#define DXF_DESCRIPTOR_LOOKUP_BUILT 2
+        /*!< \brief The lookup tables of a descriptor are built. */
+
+
+/*!
+ * \brief Value types of the fields of a libDXF entity descriptor.
+ */
+typedef enum
+dxf_field_type
+{
+        DXF_FIELD_HANDLE,
+                /*!< \c int written as hexadecimal, omitted when -1. */
+        DXF_FIELD_STRING,
+                /*!< \c char pointer to an allocated string. */
+        DXF_FIELD_INT16,
+                /*!< \c int16_t. */
+        DXF_FIELD_INT32,
+                /*!< \c int32_t. */
+        DXF_FIELD_DOUBLE,
+                /*!< \c double. */
+        DXF_FIELD_POINT_X,
+                /*!< X-value of a \c DxfPoint pointer member. */
+        DXF_FIELD_POINT_Y,
+                /*!< Y-value of a \c DxfPoint pointer member. */
+        DXF_FIELD_POINT_Z,
+                /*!< Z-value of a \c DxfPoint pointer member. */
+        DXF_FIELD_BINARY_DATA,
+                /*!< \c DxfBinaryData pointer to a list of data lines,
+                 * one group per data line. */
+        DXF_FIELD_SUBCLASS
+                /*!< Subclass marker, the marker is the default string,
+                 * no member is stored. */
+} DxfFieldType;
+
+
+#define DXF_FIELD_OPTIONAL 1
+        /*!< \brief Field is not written when it has the default
+         * value. */
+#define DXF_FIELD_READ_ONLY 2
+        /*!< \brief Field is an alternative group code which is read
+         * but never written. */
+#define DXF_FIELD_REACTORS 4
+        /*!< \brief Field lives in the {ACAD_REACTORS group. */
+#define DXF_FIELD_XDICTIONARY 8
+        /*!< \brief Field lives in the {ACAD_XDICTIONARY group. */
+#define DXF_FIELD_FLATLAND 16
+        /*!< \brief Field is only written when \c DXF_FLATLAND is
+         * set. */
+
+
+/*!
+ * \brief libDXF definition of a field of an entity descriptor.
+ */
+typedef struct
+dxf_field_descriptor_struct
+{
+        int group_code;
+                /*!< DXF group code of the field. */
+        DxfFieldType type;
+                /*!< Value type of the field. */
+        size_t offset;
+                /*!< Offset of the member in the entity struct. */
+        int min_version;
+                /*!< First \c acad_version_number in which the field is
+                 * written. */
+        int max_version;
+                /*!< Last \c acad_version_number in which the field is
+                 * written, \c 0 for no limit. */
+        int flags;
+                /*!< Bitwise or of the \c DXF_FIELD_* flags. */
+        const char *default_string;
+                /*!< Default value of string fields, the marker of
+                 * subclass fields. */
+        double default_value;
+                /*!< Default value of numeric fields. */
+} DxfFieldDescriptor;
+
+
+/*!
+ * \brief libDXF definition of an entity descriptor.
+ *
+ * An entity descriptor lists the fields of an entity type in the order
+ * in which they are written, and drives the generic init, read, write,
+ * free and copy functions of the \c dxf_descriptor_* engine.
+ */
+typedef struct
+dxf_entity_descriptor_struct
+{
+        const char *name;
+                /*!< DXF name of the entity type. */
+        size_t size;
+                /*!< Size of the entity struct. */
+        size_t next_offset;
+                /*!< Offset of the \c next member in the entity
+                 * struct. */
+        const DxfFieldDescriptor *fields;
+                /*!< Fields in the order in which they are written. */
+        int number_of_fields;
+                /*!< Number of fields. */
+        int16_t *lookup;
+                /*!< Index of the first field for every group code,
+                 * built by dxf_descriptor_build_lookup (). */
+        int16_t *next_field;
+                /*!< Index of the next field with the same group code,
+                 * built by dxf_descriptor_build_lookup (). */
+        int lookup_state;
+                /*!< One of the \c DXF_DESCRIPTOR_LOOKUP_* states of the
+                 * lookup tables, accessed atomically. */
+} DxfEntityDescriptor;
+
+
+int dxf_descriptor_build_lookup (DxfEntityDescriptor *descriptor);
+void *dxf_descriptor_new (DxfEntityDescriptor *descriptor);
+void *dxf_descriptor_init (DxfEntityDescriptor *descriptor, void *entity);
+void *dxf_descriptor_read (DxfFile *fp, DxfEntityDescriptor *descriptor, void *entity);
+int dxf_descriptor_write (DxfFile *fp, DxfEntityDescriptor *descriptor, void *entity);
+int dxf_descriptor_free (DxfEntityDescriptor *descriptor, void *entity);
+void *dxf_descriptor_copy (DxfEntityDescriptor *descriptor, void *entity);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DESCRIPTOR_H */
+
+
+/* EOF */
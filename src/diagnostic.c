@@ -0,0 +1,577 @@
+/*!
+ * \file diagnostic.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF diagnostics.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "diagnostic.h"
+
+
+#define DXF_DIAGNOSTICS_DEFAULT_MAX_REPORTS_PER_CODE 10
+        /*!< \brief Default maximum number of diagnostics passed to the
+         * callback for every code. */
+
+
+/*!
+ * \brief Allocate memory for a libDXF diagnostics sink.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfDiagnostics *
+dxf_diagnostics_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfDiagnostics *diagnostics = NULL;
+        size_t size;
+
+        size = sizeof (DxfDiagnostics);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((diagnostics = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                diagnostics = NULL;
+        }
+        else
+        {
+                memset (diagnostics, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in a libDXF
+ * diagnostics sink.
+ *
+ * The initialized sink counts diagnostics without a callback, and
+ * passes identical messages only once when a callback is set.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfDiagnostics *
+dxf_diagnostics_init
+(
+        DxfDiagnostics *diagnostics
+                /*!< libDXF diagnostics sink. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                diagnostics = dxf_diagnostics_new ();
+        }
+        if (diagnostics == NULL)
+        {
+              fprintf (stderr,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        diagnostics->callback = NULL;
+        diagnostics->data = NULL;
+        diagnostics->max_reports_per_code = DXF_DIAGNOSTICS_DEFAULT_MAX_REPORTS_PER_CODE;
+        diagnostics->deduplicate = TRUE;
+        dxf_diagnostics_reset_counts (diagnostics);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a libDXF diagnostics sink.
+ *
+ * The \c data member is owned by the caller and is not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_diagnostics_free
+(
+        DxfDiagnostics *diagnostics
+                /*!< Pointer to the memory occupied by the libDXF
+                 * diagnostics sink. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (diagnostics);
+        diagnostics = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Set the callback for a libDXF diagnostics sink.
+ *
+ * \return a pointer to \c diagnostics when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfDiagnostics *
+dxf_diagnostics_set_callback
+(
+        DxfDiagnostics *diagnostics,
+                /*!< libDXF diagnostics sink. */
+        DxfDiagnosticCallback callback,
+                /*!< Callback, \c NULL for counting only. */
+        void *data
+                /*!< User data passed to \c callback. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        diagnostics->callback = callback;
+        diagnostics->data = data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Set the maximum number of diagnostics passed to the callback
+ * for every code.
+ *
+ * \return a pointer to \c diagnostics when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfDiagnostics *
+dxf_diagnostics_set_max_reports_per_code
+(
+        DxfDiagnostics *diagnostics,
+                /*!< libDXF diagnostics sink. */
+        int max_reports_per_code
+                /*!< Maximum number of diagnostics per code, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (max_reports_per_code < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        diagnostics->max_reports_per_code = max_reports_per_code;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Set the deduplication of identical messages for a libDXF
+ * diagnostics sink.
+ *
+ * \return a pointer to \c diagnostics when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfDiagnostics *
+dxf_diagnostics_set_deduplicate
+(
+        DxfDiagnostics *diagnostics,
+                /*!< libDXF diagnostics sink. */
+        int deduplicate
+                /*!< \c TRUE to pass identical messages to the callback
+                 * only once. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        diagnostics->deduplicate = deduplicate;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Get the number of identical messages which were not passed to
+ * the callback of a libDXF diagnostics sink.
+ *
+ * \return the number of duplicates, or \c 0 when an error occurred.
+ */
+int
+dxf_diagnostics_get_duplicates
+(
+        DxfDiagnostics *diagnostics
+                /*!< libDXF diagnostics sink. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics->duplicates);
+}
+
+
+/*!
+ * \brief Get the number of diagnostics reported for a code, including
+ * the diagnostics not passed to the callback.
+ *
+ * \return the number of diagnostics, or \c 0 when an error occurred.
+ */
+int
+dxf_diagnostics_get_count
+(
+        DxfDiagnostics *diagnostics,
+                /*!< libDXF diagnostics sink. */
+        DxfDiagnosticCode code
+                /*!< Diagnostic code. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+        if ((code < 0) || (code >= DXF_NUMBER_OF_DIAGNOSTIC_CODES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics->counts[code]);
+}
+
+
+/*!
+ * \brief Reset the diagnostic counts of a libDXF diagnostics sink.
+ *
+ * The messages already passed to the callback are forgotten too.
+ *
+ * \return a pointer to \c diagnostics when successful, or \c NULL when
+ * an error occurred.
+ */
+DxfDiagnostics *
+dxf_diagnostics_reset_counts
+(
+        DxfDiagnostics *diagnostics
+                /*!< libDXF diagnostics sink. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (diagnostics == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (diagnostics->counts, 0, sizeof (diagnostics->counts));
+        memset (diagnostics->reports, 0, sizeof (diagnostics->reports));
+        memset (diagnostics->message_hashes, 0, sizeof (diagnostics->message_hashes));
+        diagnostics->duplicates = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (diagnostics);
+}
+
+
+/*!
+ * \brief Register a libDXF diagnostics sink on a DXF file.
+ *
+ * The sink is owned by the caller and has to outlive the use of
+ * \c fp.\n
+ * Passing \c NULL removes a registered sink.
+ *
+ * \return a pointer to \c fp when successful, or \c NULL when an error
+ * occurred.
+ */
+DxfFile *
+dxf_diagnostics_register
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfDiagnostics *diagnostics
+                /*!< libDXF diagnostics sink. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        fp->diagnostics = (struct DxfDiagnostics *) diagnostics;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (fp);
+}
+
+
+/*!
+ * \brief Diagnostic callback printing diagnostics to \c stderr.
+ *
+ * Restores the behaviour of libDXF prior to diagnostics sinks, except
+ * for the rate limiting done by the sink.
+ */
+void
+dxf_diagnostics_print
+(
+        DxfDiagnosticSeverity severity,
+                /*!< Severity of the diagnostic. */
+        DxfDiagnosticCode code,
+                /*!< Diagnostic code. */
+        const char *filename,
+                /*!< Name of the file being read. */
+        int line_number,
+                /*!< Line number in the file being read. */
+        const char *message,
+                /*!< Diagnostic message. */
+        void *data
+                /*!< User data (unused). */
+)
+{
+        (void) severity;
+        (void) code;
+        (void) filename;
+        (void) line_number;
+        (void) data;
+        fprintf (stderr, "%s\n", message);
+}
+
+
+/*!
+ * \brief Test if a message was passed to the callback of a diagnostics
+ * sink before, and remember it when it was not.
+ *
+ * The messages are remembered by their FNV-1a hash in an open
+ * addressing hash table, when the table is full new messages are no
+ * longer remembered.
+ *
+ * \return \c TRUE when the message was passed before, \c FALSE when it
+ * was not.
+ */
+static int
+dxf_diagnostics_seen
+(
+        DxfDiagnostics *diagnostics,
+                /*!< libDXF diagnostics sink. */
+        DxfDiagnosticCode code,
+                /*!< Diagnostic code. */
+        const char *message
+                /*!< Diagnostic message. */
+)
+{
+        uint32_t hash = 2166136261u;
+        const unsigned char *p;
+        int slot;
+        int i;
+
+        hash = (hash ^ (uint32_t) code) * 16777619u;
+        for (p = (const unsigned char *) message; *p != '\0'; p++)
+        {
+                hash = (hash ^ *p) * 16777619u;
+        }
+        /* 0 marks an empty slot. */
+        if (hash == 0)
+        {
+                hash = 1;
+        }
+        slot = hash % DXF_DIAGNOSTICS_MESSAGE_HASHES;
+        for (i = 0; i < DXF_DIAGNOSTICS_MESSAGE_HASHES; i++)
+        {
+                if (diagnostics->message_hashes[slot] == hash)
+                {
+                        return (TRUE);
+                }
+                if (diagnostics->message_hashes[slot] == 0)
+                {
+                        diagnostics->message_hashes[slot] = hash;
+                        return (FALSE);
+                }
+                slot = (slot + 1) % DXF_DIAGNOSTICS_MESSAGE_HASHES;
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Report a diagnostic to the diagnostics sink registered on a
+ * DXF file.
+ *
+ * The diagnostic is discarded when no sink is registered, a \c code
+ * out of range is discarded with an error on \c stderr.\n
+ * The message is only formatted when it is passed to the callback.
+ */
+void
+dxf_diagnostic_report
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfDiagnosticSeverity severity,
+                /*!< Severity of the diagnostic. */
+        DxfDiagnosticCode code,
+                /*!< Diagnostic code. */
+        const char *format,
+                /*!< printf style format of the message. */
+        ...
+)
+{
+        DxfDiagnostics *diagnostics;
+        char message[DXF_MAX_STRING_LENGTH];
+        va_list arguments;
+        size_t length;
+
+        if ((fp == NULL) || (fp->diagnostics == NULL))
+        {
+                return;
+        }
+        if ((code < 0) || (code >= DXF_NUMBER_OF_DIAGNOSTIC_CODES))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+                return;
+        }
+        diagnostics = (DxfDiagnostics *) fp->diagnostics;
+        diagnostics->counts[code]++;
+        if ((diagnostics->callback == NULL)
+          || ((diagnostics->max_reports_per_code > 0)
+          && (diagnostics->reports[code] >= diagnostics->max_reports_per_code)))
+        {
+                return;
+        }
+        va_start (arguments, format);
+        vsnprintf (message, sizeof (message), format, arguments);
+        va_end (arguments);
+        /* Strip the trailing newline of the message. */
+        length = strlen (message);
+        if ((length > 0) && (message[length - 1] == '\n'))
+        {
+                message[length - 1] = '\0';
+        }
+        if ((diagnostics->deduplicate)
+          && (dxf_diagnostics_seen (diagnostics, code, message)))
+        {
+                diagnostics->duplicates++;
+                return;
+        }
+        diagnostics->reports[code]++;
+        diagnostics->callback (severity, code, fp->filename,
+          fp->line_number, message, diagnostics->data);
+}
+
+
+/* EOF */
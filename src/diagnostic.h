@@ -0,0 +1,176 @@
+/*!
+ * \file diagnostic.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF diagnostics.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_DIAGNOSTIC_H
+#define LIBDXF_SRC_DIAGNOSTIC_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Severity of a libDXF diagnostic.
+ */
+typedef enum
+dxf_diagnostic_severity
+{
+        DXF_DIAGNOSTIC_INFO,
+        DXF_DIAGNOSTIC_WARNING,
+        DXF_DIAGNOSTIC_ERROR
+} DxfDiagnosticSeverity;
+
+
+/*!
+ * \brief Codes of libDXF diagnostics.
+ */
+typedef enum
+dxf_diagnostic_code
+{
+        DXF_DIAGNOSTIC_NULL_POINTER,
+                /*!< A \c NULL pointer was passed, a new struct was
+                 * allocated. */
+        DXF_DIAGNOSTIC_MISSING_MEMBER,
+                /*!< A \c NULL member was found, a new struct was
+                 * allocated. */
+        DXF_DIAGNOSTIC_COMMENT,
+                /*!< A comment (group code 999) was read. */
+        DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                /*!< An unknown group code was read. */
+        DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
+                /*!< An unexpected subclass marker was read. */
+        DXF_DIAGNOSTIC_ILLEGAL_VERSION,
+                /*!< An entity or object was read which does not exist
+                 * in the DXF version of the file. */
+        DXF_DIAGNOSTIC_SKIPPED_ENTITY,
+                /*!< An entity was skipped while reading. */
+        DXF_DIAGNOSTIC_INVALID_ENTITY,
+                /*!< An entity with invalid values was found. */
+        DXF_DIAGNOSTIC_INVALID_BINARY_DATA,
+                /*!< A binary chunk record with other characters than
+                 * hexadecimal digits was read. */
+        DXF_NUMBER_OF_DIAGNOSTIC_CODES
+                /*!< Number of diagnostic codes, not a code. */
+} DxfDiagnosticCode;
+
+
+/*!
+ * \brief Diagnostic callback.
+ *
+ * \c message is only valid during the call.
+ */
+typedef void (*DxfDiagnosticCallback)
+(
+        DxfDiagnosticSeverity severity,
+        DxfDiagnosticCode code,
+        const char *filename,
+        int line_number,
+        const char *message,
+        void *data
+);
+
+
+#define DXF_DIAGNOSTICS_MESSAGE_HASHES 256
+        /*!< \brief Number of message hashes kept for the deduplication
+         * of messages. */
+
+
+/*!
+ * \brief libDXF definition of a diagnostics sink.
+ *
+ * A diagnostics sink registered on a \c DxfFile counts every diagnostic
+ * reported while reading the file, and passes the first
+ * \c max_reports_per_code diagnostics of every code to \c callback.\n
+ * When \c deduplicate is set a message identical to a message already
+ * passed to \c callback is counted only.\n
+ * Without a registered sink diagnostics are discarded at the cost of a
+ * single test.
+ */
+typedef struct
+dxf_diagnostics_struct
+{
+        DxfDiagnosticCallback callback;
+                /*!< Callback receiving the diagnostics, \c NULL only
+                 * counts the diagnostics. */
+        void *data;
+                /*!< User data passed to \c callback. */
+        int max_reports_per_code;
+                /*!< Maximum number of diagnostics passed to
+                 * \c callback for every code, \c 0 for no limit.\n
+                 * Further diagnostics with the same code are counted
+                 * only. */
+        int counts[DXF_NUMBER_OF_DIAGNOSTIC_CODES];
+                /*!< Number of diagnostics reported for every code. */
+        int reports[DXF_NUMBER_OF_DIAGNOSTIC_CODES];
+                /*!< Number of diagnostics passed to \c callback for
+                 * every code. */
+        int deduplicate;
+                /*!< \c TRUE when identical messages are passed to
+                 * \c callback only once. */
+        int duplicates;
+                /*!< Number of identical messages which were not passed
+                 * to \c callback. */
+        uint32_t message_hashes[DXF_DIAGNOSTICS_MESSAGE_HASHES];
+                /*!< Hash table of the messages passed to \c callback,
+                 * \c 0 marks an empty slot. */
+} DxfDiagnostics;
+
+
+DxfDiagnostics *dxf_diagnostics_new ();
+DxfDiagnostics *dxf_diagnostics_init (DxfDiagnostics *diagnostics);
+int dxf_diagnostics_free (DxfDiagnostics *diagnostics);
+DxfDiagnostics *dxf_diagnostics_set_callback (DxfDiagnostics *diagnostics, DxfDiagnosticCallback callback, void *data);
+DxfDiagnostics *dxf_diagnostics_set_max_reports_per_code (DxfDiagnostics *diagnostics, int max_reports_per_code);
+DxfDiagnostics *dxf_diagnostics_set_deduplicate (DxfDiagnostics *diagnostics, int deduplicate);
+int dxf_diagnostics_get_duplicates (DxfDiagnostics *diagnostics);
+int dxf_diagnostics_get_count (DxfDiagnostics *diagnostics, DxfDiagnosticCode code);
+DxfDiagnostics *dxf_diagnostics_reset_counts (DxfDiagnostics *diagnostics);
+DxfFile *dxf_diagnostics_register (DxfFile *fp, DxfDiagnostics *diagnostics);
+void dxf_diagnostics_print (DxfDiagnosticSeverity severity, DxfDiagnosticCode code, const char *filename, int line_number, const char *message, void *data);
+void dxf_diagnostic_report (DxfFile *fp, DxfDiagnosticSeverity severity, DxfDiagnosticCode code, const char *format, ...);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_DIAGNOSTIC_H */
+
+
+/* EOF */
@@ -41,6 +41,7 @@
 
 
 #include "dimension.h"
+#include "util.h"
 
 
 /*!
@@ -138,27 +139,6 @@ dxf_dimension_init
         dimension->dim_text = strdup ("");
         dimension->dimblock_name = strdup ("");
         dimension->dimstyle_name = strdup ("");
-        dimension->p0->x0 = 0.0;
-        dimension->p0->y0 = 0.0;
-        dimension->p0->z0 = 0.0;
-        dimension->p1->x0 = 0.0;
-        dimension->p1->y0 = 0.0;
-        dimension->p1->z0 = 0.0;
-        dimension->p2->x0 = 0.0;
-        dimension->p2->y0 = 0.0;
-        dimension->p2->z0 = 0.0;
-        dimension->p3->x0 = 0.0;
-        dimension->p3->y0 = 0.0;
-        dimension->p3->z0 = 0.0;
-        dimension->p4->x0 = 0.0;
-        dimension->p4->y0 = 0.0;
-        dimension->p4->z0 = 0.0;
-        dimension->p5->x0 = 0.0;
-        dimension->p5->y0 = 0.0;
-        dimension->p5->z0 = 0.0;
-        dimension->p6->x0 = 0.0;
-        dimension->p6->y0 = 0.0;
-        dimension->p6->z0 = 0.0;
         dimension->leader_length = 0.0;
         dimension->text_line_spacing_factor = 0.0;
         dimension->actual_measurement = 0.0;
@@ -214,8 +194,7 @@ dxf_dimension_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -224,25 +203,23 @@ dxf_dimension_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimension == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimension = dxf_dimension_init (dimension);
         }
         if (dimension->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                dimension->binary_graphics_data = dxf_binary_data_init (dimension->binary_graphics_data);
+                dimension->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (dimension->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -253,12 +230,11 @@ dxf_dimension_read
         }
         if (dimension->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p0 = dxf_point_init (dimension->p0);
+                dimension->p0 = dxf_point_init (dxf_point_new ());
                 if (dimension->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -269,12 +245,11 @@ dxf_dimension_read
         }
         if (dimension->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p1 = dxf_point_init (dimension->p1);
+                dimension->p1 = dxf_point_init (dxf_point_new ());
                 if (dimension->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -285,12 +260,11 @@ dxf_dimension_read
         }
         if (dimension->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p2 = dxf_point_init (dimension->p2);
+                dimension->p2 = dxf_point_init (dxf_point_new ());
                 if (dimension->p2 == NULL)
                 {
                         fprintf (stderr,
@@ -301,12 +275,11 @@ dxf_dimension_read
         }
         if (dimension->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p3 = dxf_point_init (dimension->p3);
+                dimension->p3 = dxf_point_init (dxf_point_new ());
                 if (dimension->p3 == NULL)
                 {
                         fprintf (stderr,
@@ -317,12 +290,11 @@ dxf_dimension_read
         }
         if (dimension->p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p4 = dxf_point_init (dimension->p4);
+                dimension->p4 = dxf_point_init (dxf_point_new ());
                 if (dimension->p4 == NULL)
                 {
                         fprintf (stderr,
@@ -333,12 +305,11 @@ dxf_dimension_read
         }
         if (dimension->p5 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p5 = dxf_point_init (dimension->p5);
+                dimension->p5 = dxf_point_init (dxf_point_new ());
                 if (dimension->p5 == NULL)
                 {
                         fprintf (stderr,
@@ -349,12 +320,11 @@ dxf_dimension_read
         }
         if (dimension->p6 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                dimension->p6 = dxf_point_init (dimension->p6);
+                dimension->p6 = dxf_point_init (dxf_point_new ());
                 if (dimension->p6 == NULL)
                 {
                         fprintf (stderr,
@@ -363,11 +333,10 @@ dxf_dimension_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) dimension->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -375,32 +344,27 @@ dxf_dimension_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * text string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dim_text);
+                        dxf_read_string (&dimension->dim_text, fp);
                 }
-                if (strcmp (temp_string, "2") == 0)
+                else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * block name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dimblock_name);
+                        dxf_read_string (&dimension->dimblock_name, fp);
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a dimension
                          * style name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dimstyle_name);
+                        dxf_read_string (&dimension->dimstyle_name, fp);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -411,14 +375,12 @@ dxf_dimension_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->linetype);
+                        dxf_read_string (&dimension->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->layer);
+                        dxf_read_string (&dimension->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -710,8 +672,7 @@ dxf_dimension_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                           && (strcmp (temp_string, "AcDbDimension") != 0)
                           && (strcmp (temp_string, "AcDbAlignedDimension") != 0)
@@ -721,7 +682,8 @@ dxf_dimension_read
                           && (strcmp (temp_string, "AcDbRadialDimension") != 0)
                           && (strcmp (temp_string, "AcDbOrdinateDimension") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -772,10 +734,8 @@ dxf_dimension_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, dimension->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -783,15 +743,13 @@ dxf_dimension_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dictionary_owner_soft);
+                                dxf_read_string (&dimension->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->object_owner_soft);
+                                dxf_read_string (&dimension->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -799,15 +757,13 @@ dxf_dimension_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->material);
+                        dxf_read_string (&dimension->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->dictionary_owner_hard);
+                        dxf_read_string (&dimension->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -820,8 +776,7 @@ dxf_dimension_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->plot_style_name);
+                        dxf_read_string (&dimension->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -833,8 +788,7 @@ dxf_dimension_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimension->color_name);
+                        dxf_read_string (&dimension->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -846,16 +800,20 @@ dxf_dimension_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_dimension_get_linetype (dimension), "") == 0)
@@ -866,8 +824,6 @@ dxf_dimension_read
         {
                 dxf_dimension_set_layer (dimension, strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1012,13 +968,7 @@ dxf_dimension_write
 #endif
                 if (dimension->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) dimension->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, dimension->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -1229,7 +1179,10 @@ dxf_dimension_free
         }
         free (dimension->linetype);
         free (dimension->layer);
-        dxf_binary_data_free_list (dimension->binary_graphics_data);
+        if (dimension->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (dimension->binary_graphics_data);
+        }
         free (dimension->dim_text);
         free (dimension->dimblock_name);
         free (dimension->dimstyle_name);
@@ -6823,9 +6776,6 @@ dxf_dimension_get_last
         }
         if (dimension->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfDimension *) dimension);
         }
         DxfDimension *iter = (DxfDimension *) dimension->next;
@@ -40,6 +40,7 @@
 
 
 #include "dimstyle.h"
+#include "util.h"
 
 
 /*!
@@ -188,7 +189,7 @@ dxf_dimstyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -197,29 +198,26 @@ dxf_dimstyle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (dimstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 dimstyle = dxf_dimstyle_init (dimstyle);
         }
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -227,38 +225,33 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing a dimension
                          * style name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimstyle_name);
+                        dxf_read_string (&dimstyle->dimstyle_name, fp);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a general
                          * dimensioning suffix. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimpost);
+                        dxf_read_string (&dimstyle->dimpost, fp);
                 }
                 else if (strcmp (temp_string, "4") == 0)
                 {
                         /* Now follows a string containing an alternate
                          * dimensioning suffix. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimapost);
+                        dxf_read_string (&dimstyle->dimapost, fp);
                 }
                 else if ((fp->acad_version_number < AutoCAD_2000)
                         && (strcmp (temp_string, "5") == 0))
                 {
                         /* Now follows a string containing an arrow
                          * block name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimblk);
+                        dxf_read_string (&dimstyle->dimblk, fp);
                 }
                 else if ((fp->acad_version_number < AutoCAD_2000)
                         && (strcmp (temp_string, "6") == 0))
                 {
                         /* Now follows a string containing a first arrow
                          * block name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimblk1);
+                        dxf_read_string (&dimstyle->dimblk1, fp);
                 }
 #if 0
 /*!
@@ -279,8 +272,7 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing a first arrow
                          * block name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimblk2);
+                        dxf_read_string (&dimstyle->dimblk2, fp);
                 }
 #if 0
 /*!
@@ -427,12 +419,12 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbSymbolTableRecord") != 0)
                         && (strcmp (temp_string, "AcDbDimStyleTableRecord") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -681,15 +673,13 @@ dxf_dimstyle_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dictionary_owner_soft);
+                                dxf_read_string (&dimstyle->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->object_owner_soft);
+                                dxf_read_string (&dimstyle->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -697,16 +687,24 @@ dxf_dimstyle_read
                 {
                         /* Now follows a string containing dimension
                          * text style. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dimtxsty);
+                        dxf_read_string (&dimstyle->dimtxsty, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, dimstyle->dictionary_owner_hard);
+                        dxf_read_string (&dimstyle->dictionary_owner_hard, fp);
+                }
+                else
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dimstyle->dimstyle_name, "") == 0)
@@ -714,12 +712,8 @@ dxf_dimstyle_read
                 fprintf (stderr,
                   (_("Error in %s () dimstyle_name value is empty.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1015,6 +1009,7 @@ dxf_dimstyle_free_list
         while (dimstyles != NULL)
         {
                 DxfDimStyle *iter = (DxfDimStyle *) dimstyles->next;
+                dimstyles->next = NULL;
                 dxf_dimstyle_free (dimstyles);
                 dimstyles = (DxfDimStyle *) iter;
         }
@@ -5844,9 +5839,6 @@ dxf_dimstyle_get_last
         }
         if (dimstyle->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfDimStyle *) dimstyle);
         }
         DxfDimStyle *iter = (DxfDimStyle *) dimstyle->next;
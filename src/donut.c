@@ -140,14 +140,12 @@ dxf_donut_init
         donut->color_name = strdup ("");
         donut->transparency = 0;
         /* Specific members for a libDXF donut. */
-        donut->p0->x0 = 0.0;
-        donut->p0->y0 = 0.0;
-        donut->p0->z0 = 0.0;
         donut->outside_diameter = 0.0;
         donut->inside_diameter = 0.0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         donut->binary_graphics_data = NULL;
+        donut->p0 = NULL;
         donut->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -392,6 +390,7 @@ dxf_donut_free_list
         while (donuts != NULL)
         {
                 DxfDonut *iter = (DxfDonut *) donuts->next;
+                donuts->next = NULL;
                 dxf_donut_free (donuts);
                 donuts = (DxfDonut *) iter;
         }
@@ -2541,9 +2540,6 @@ dxf_donut_get_last
         }
         if (donut->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfDonut *) donut);
         }
         DxfDonut *iter = (DxfDonut *) donut->next;
@@ -34,6 +34,7 @@
 
 
 #include "drawing.h"
+#include "file.h"
 
 
 /*!
@@ -115,6 +116,7 @@ dxf_drawing_init
         drawing->entities_list = NULL;
         drawing->object_list = NULL;
         drawing->thumbnail = NULL;
+        drawing->layer_index = NULL;
         drawing->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -159,9 +161,16 @@ dxf_drawing_free
         dxf_header_free ((DxfHeader *) drawing->header);
         dxf_class_free_list ((DxfClass *) drawing->class_list);
         dxf_block_free_list ((DxfBlock *) drawing->block_list);
-        //dxf_entities_free_list ((DxfEntities *) drawing->entities_list);
+        if (drawing->entities_list != NULL)
+        {
+                dxf_entities_free ((DxfEntities *) drawing->entities_list);
+        }
         dxf_object_free_list ((DxfObject *) drawing->object_list);
         dxf_thumbnail_free ((DxfThumbnail *) drawing->thumbnail);
+        if (drawing->layer_index != NULL)
+        {
+                dxf_layer_index_free ((DxfLayerIndex *) drawing->layer_index);
+        }
         free (drawing);
         drawing = NULL;
 #if DEBUG
@@ -747,6 +756,88 @@ dxf_drawing_set_thumbnail
 }
 
 
+/*!
+ * \brief Get the layer index from a libDXF drawing.
+ *
+ * \return \c layer_index when sucessful, \c NULL when an error occurred.
+ */
+DxfLayerIndex *
+dxf_drawing_get_layer_index
+(
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndex *result = NULL;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (drawing->layer_index ==  NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        result = (DxfLayerIndex *) drawing->layer_index;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Set the layer index for a libDXF drawing.
+ *
+ * \return a pointer to the libDXF drawing when OK, \c NULL when an
+ * error occurred.
+ */
+DxfDrawing *
+dxf_drawing_set_layer_index
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF drawing. */
+        DxfLayerIndex *layer_index
+                /*!< a pointer containing the layer index for the libDXF
+                 * drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (layer_index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        drawing->layer_index = (struct DxfLayerIndex *) layer_index;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
 /*!
  * \brief Get the pointer to the next \c DRAWING from a DXF 
  * \c DRAWING.
@@ -856,9 +947,6 @@ dxf_drawing_get_last
         }
         if (drawing->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfDrawing *) drawing);
         }
         DxfDrawing *iter = (DxfDrawing *) drawing->next;
@@ -873,4 +961,215 @@ dxf_drawing_get_last
 }
 
 
+/*!
+ * \brief Compute the extents of a libDXF drawing and store them in the
+ * \c $EXTMIN and \c $EXTMAX variables of it's header.
+ *
+ * The extents are the union of the bounding boxes of all entities in
+ * the Entities section, computed in a single pass over the entity
+ * sequence.\n
+ * When libDXF is built with OpenMP, large drawings are divided over
+ * the threads, every thread collects the extents of it's part of the
+ * sequence and the parts are merged at the end.\n
+ * Entities for which no bounding box can be computed are skipped.\n
+ * An \c INSERT contributes the extents of the block it references,
+ * nested blocks included, for every cell of a \c MINSERT array.\n
+ * The extents of every block are computed once, before the entities
+ * are divided over the threads.\n
+ * A drawing without extents gets the values AutoCAD writes for an
+ * empty drawing, 1e+20 for \c $EXTMIN and -1e+20 for \c $EXTMAX.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_drawing_compute_extents
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        DxfExtents *extents
+                /*!< Bounding box receiving the extents, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntities *entities;
+        DxfHeader *header;
+        DxfBlockExtents *block_extents;
+        DxfExtents drawing_extents;
+        DxfExtents thread_extents;
+        DxfExtents entity_extents;
+        int i;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_set_empty (&drawing_extents);
+        entities = (DxfEntities *) drawing->entities_list;
+        if (entities != NULL)
+        {
+                block_extents = dxf_block_extents_new ((DxfBlock *) drawing->block_list);
+                if (block_extents == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+#ifdef _OPENMP
+#pragma omp parallel private (thread_extents, entity_extents) \
+  if (entities->number_of_sequence_items >= DXF_DRAWING_PARALLEL_EXTENTS)
+#endif
+                {
+                        dxf_extents_set_empty (&thread_extents);
+#ifdef _OPENMP
+#pragma omp for schedule (static) nowait
+#endif
+                        for (i = 0; i < entities->number_of_sequence_items; i++)
+                        {
+                                if (dxf_entity_get_extents_with_blocks (entities->sequence[i].type,
+                                  entities->sequence[i].entity, block_extents,
+                                  &entity_extents) == EXIT_SUCCESS)
+                                {
+                                        dxf_extents_add_extents (&thread_extents, &entity_extents);
+                                }
+                        }
+#ifdef _OPENMP
+#pragma omp critical (dxf_drawing_compute_extents)
+#endif
+                        dxf_extents_add_extents (&drawing_extents, &thread_extents);
+                }
+                dxf_block_extents_free (block_extents);
+        }
+        header = (DxfHeader *) drawing->header;
+        if (header != NULL)
+        {
+                if (dxf_extents_is_empty (&drawing_extents))
+                {
+                        header->ExtMin.x0 = 1e+20;
+                        header->ExtMin.y0 = 1e+20;
+                        header->ExtMin.z0 = 1e+20;
+                        header->ExtMax.x0 = -1e+20;
+                        header->ExtMax.y0 = -1e+20;
+                        header->ExtMax.z0 = -1e+20;
+                }
+                else
+                {
+                        header->ExtMin.x0 = drawing_extents.min_x;
+                        header->ExtMin.y0 = drawing_extents.min_y;
+                        header->ExtMin.z0 = drawing_extents.min_z;
+                        header->ExtMax.x0 = drawing_extents.max_x;
+                        header->ExtMax.y0 = drawing_extents.max_y;
+                        header->ExtMax.z0 = drawing_extents.max_z;
+                }
+        }
+        if (extents != NULL)
+        {
+                *extents = drawing_extents;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read a DXF file into a libDXF drawing.
+ *
+ * When \c drawing is \c NULL a new drawing is allocated and
+ * initialized.\n
+ * The sections read from the file are handed over to the drawing,
+ * entities rejected by \c options are skipped.\n
+ * The entities are indexed per layer in the \c layer_index of the
+ * drawing, unless a layer index was passed in \c options, which is
+ * then filled while reading instead.
+ *
+ * \return a pointer to the drawing, or \c NULL when an error
+ * occurred.
+ */
+DxfDrawing *
+dxf_drawing_read
+(
+        char *filename,
+                /*!< filename of input file (or device). */
+        DxfLoadOptions *options,
+                /*!< load options, \c NULL loads all entities. */
+        DxfDrawing *drawing
+                /*!< a pointer to a libDXF \c DRAWING, or \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *fp = NULL;
+        DxfDrawing *new_drawing = NULL;
+        int result;
+
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not open file: %s.\n")),
+                  __FUNCTION__, filename);
+                return (NULL);
+        }
+        if (drawing == NULL)
+        {
+                new_drawing = dxf_drawing_init (dxf_drawing_new (), 0);
+                if (new_drawing == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_read_close (fp);
+                        return (NULL);
+                }
+                drawing = new_drawing;
+        }
+        fp->load_options = (struct DxfLoadOptions *) options;
+        if (options != NULL)
+        {
+                fp->diagnostics = options->diagnostics;
+        }
+        fp->drawing = (struct DxfDrawing *) drawing;
+        result = dxf_file_read_sections (fp);
+        dxf_read_close (fp);
+        if (result != EXIT_SUCCESS)
+        {
+                dxf_drawing_free (new_drawing);
+                return (NULL);
+        }
+        /* The entities were added to the layer index of the load
+         * options while reading, else index them here. */
+        if (((options == NULL) || (options->layer_index == NULL))
+          && (drawing->entities_list != NULL))
+        {
+                if (drawing->layer_index == NULL)
+                {
+                        drawing->layer_index = (struct DxfLayerIndex *)
+                          dxf_layer_index_init (dxf_layer_index_new ());
+                }
+                if ((drawing->layer_index == NULL)
+                  || (dxf_layer_index_build ((DxfLayerIndex *) drawing->layer_index,
+                  (DxfEntities *) drawing->entities_list) == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not build the layer index.\n")),
+                          __FUNCTION__);
+                        dxf_drawing_free (new_drawing);
+                        return (NULL);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (drawing);
+}
+
+
 /* EOF*/
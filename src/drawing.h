@@ -44,6 +44,9 @@
 #include "block.h"
 #include "global.h"
 #include "entities.h"
+#include "layer_index.h"
+#include "extents.h"
+#include "load_options.h"
 #include "object.h"
 #include "thumbnail.h"
 
@@ -53,6 +56,12 @@ extern "C" {
 #endif
 
 
+#define DXF_DRAWING_PARALLEL_EXTENTS 4096
+        /*!< \brief Number of entities from which
+         * dxf_drawing_compute_extents () divides the work over OpenMP
+         * threads. */
+
+
 /*!
  * \brief Definition of a DXF drawing.
  */
@@ -73,6 +82,9 @@ dxf_drawing_struct
         /*!< Objects section data (single linked list).*/
     struct DxfThumbnail *thumbnail;
         /*!< Thumbnail data.*/
+    struct DxfLayerIndex *layer_index;
+        /*!< Index of the entities per layer, built by
+         * dxf_drawing_read ().*/
     struct DxfDrawing *next;
                 /*!< Pointer to the next DxfDrawing.\n
                  * \c NULL in the last DxfDrawing. */
@@ -96,9 +108,13 @@ DxfObject *dxf_drawing_get_object_list (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_object_list (DxfDrawing *drawing, DxfObject *object_list);
 DxfThumbnail *dxf_drawing_get_thumbnail (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_thumbnail (DxfDrawing *drawing, DxfThumbnail *thumbnail);
+DxfLayerIndex *dxf_drawing_get_layer_index (DxfDrawing *drawing);
+DxfDrawing *dxf_drawing_set_layer_index (DxfDrawing *drawing, DxfLayerIndex *layer_index);
 DxfDrawing *dxf_drawing_get_next (DxfDrawing *drawing);
 DxfDrawing *dxf_drawing_set_next (DxfDrawing *drawing, DxfDrawing *next);
 DxfDrawing *dxf_drawing_get_last (DxfDrawing *drawing);
+int dxf_drawing_compute_extents (DxfDrawing *drawing, DxfExtents *extents);
+DxfDrawing *dxf_drawing_read (char *filename, DxfLoadOptions *options, DxfDrawing *drawing);
 
 
 #ifdef __cplusplus
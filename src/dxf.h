@@ -41,6 +41,7 @@
 #include "3dline.h"
 #include "3dsolid.h"
 #include "acad_proxy_entity.h"
+#include "acis_data.h"
 #include "appid.h"
 #include "arc.h"
 #include "attdef.h"
@@ -51,10 +52,13 @@
 #include "block_record.h"
 #include "body.h"
 #include "circle.h"
+#include "clash.h"
 #include "class.h"
 #include "color.h"
 #include "comment.h"
 #include "dbg.h"
+#include "descriptor.h"
+#include "diagnostic.h"
 #include "dictionary.h"
 #include "dictionaryvar.h"
 #include "dimension.h"
@@ -67,10 +71,14 @@
 #include "endtab.h"
 #include "entities.h"
 #include "entity.h"
+#include "explode.h"
+#include "extents.h"
+#include "face_soup.h"
 #include "file.h"
 #include "global.h"
 #include "group.h"
 #include "hatch.h"
+#include "hatch_fill.h"
 #include "header.h"
 #include "helix.h"
 #include "idbuffer.h"
@@ -78,15 +86,19 @@
 #include "imagedef.h"
 #include "imagedef_reactor.h"
 #include "insert.h"
+#include "instance.h"
 #include "layer.h"
 #include "layer_index.h"
 #include "layer_name.h"
 #include "leader.h"
 #include "light.h"
 #include "line.h"
+#include "load_options.h"
 #include "ltype.h"
 #include "lwpolyline.h"
+#include "measure.h"
 #include "mesh.h"
+#include "mesh_triangulate.h"
 #include "mleader.h"
 #include "mleaderstyle.h"
 #include "mline.h"
@@ -100,14 +112,17 @@
 #include "param.h"
 #include "point.h"
 #include "polyline.h"
+#include "polyline_mesh.h"
 #include "proprietary_data.h"
 #include "rastervariables.h"
 #include "ray.h"
 #include "region.h"
 #include "rtext.h"
+#include "rtree.h"
 #include "section.h"
 #include "seqend.h"
 #include "shape.h"
+#include "simd.h"
 #include "solid.h"
 #include "sortentstable.h"
 #include "spatial_filter.h"
@@ -117,6 +132,7 @@
 #include "sun.h"
 #include "table.h"
 #include "tables.h"
+#include "tessellate.h"
 #include "text.h"
 #include "thumbnail.h"
 #include "tolerance.h"
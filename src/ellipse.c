@@ -42,6 +42,7 @@
 
 
 #include "ellipse.h"
+#include "util.h"
 
 
 /*!
@@ -177,8 +178,7 @@ dxf_ellipse_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -187,25 +187,23 @@ dxf_ellipse_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ellipse == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ellipse = dxf_ellipse_init (ellipse);
         }
         if (ellipse->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                ellipse->binary_graphics_data = dxf_binary_data_init (ellipse->binary_graphics_data);
+                ellipse->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (ellipse->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -216,12 +214,11 @@ dxf_ellipse_read
         }
         if (ellipse->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                ellipse->p0 = dxf_point_init (ellipse->p0);
+                ellipse->p0 = dxf_point_init (dxf_point_new ());
                 if (ellipse->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -232,12 +229,11 @@ dxf_ellipse_read
         }
         if (ellipse->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                ellipse->p1 = dxf_point_init (ellipse->p1);
+                ellipse->p1 = dxf_point_init (dxf_point_new ());
                 if (ellipse->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -246,11 +242,10 @@ dxf_ellipse_read
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) ellipse->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -258,8 +253,6 @@ dxf_ellipse_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -273,14 +266,12 @@ dxf_ellipse_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->linetype);
+                        dxf_read_string (&ellipse->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->layer);
+                        dxf_read_string (&ellipse->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -407,12 +398,12 @@ dxf_ellipse_read
                          * version should probably be added here.
                          * Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbEllipse") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -456,10 +447,8 @@ dxf_ellipse_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, ellipse->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -467,15 +456,13 @@ dxf_ellipse_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_soft);
+                                dxf_read_string (&ellipse->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->object_owner_soft);
+                                dxf_read_string (&ellipse->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -483,15 +470,13 @@ dxf_ellipse_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->material);
+                        dxf_read_string (&ellipse->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->dictionary_owner_hard);
+                        dxf_read_string (&ellipse->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -504,8 +489,7 @@ dxf_ellipse_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->plot_style_name);
+                        dxf_read_string (&ellipse->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -517,8 +501,7 @@ dxf_ellipse_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ellipse->color_name);
+                        dxf_read_string (&ellipse->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -530,16 +513,20 @@ dxf_ellipse_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ellipse->linetype, "") == 0)
@@ -550,8 +537,6 @@ dxf_ellipse_read
         {
                 ellipse->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -734,13 +719,7 @@ dxf_ellipse_write
 #endif
                 if (ellipse->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) ellipse->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, ellipse->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -814,7 +793,10 @@ dxf_ellipse_free
         }
         free (ellipse->linetype);
         free (ellipse->layer);
-        dxf_binary_data_free_list (ellipse->binary_graphics_data);
+        if (ellipse->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (ellipse->binary_graphics_data);
+        }
         free (ellipse->dictionary_owner_soft);
         free (ellipse->object_owner_soft);
         free (ellipse->material);
@@ -856,6 +838,7 @@ dxf_ellipse_free_list
         while (ellipses != NULL)
         {
                 DxfEllipse *iter = (DxfEllipse *) ellipses->next;
+                ellipses->next = NULL;
                 dxf_ellipse_free (ellipses);
                 ellipses = (DxfEllipse *) iter;
         }
@@ -3867,9 +3850,6 @@ dxf_ellipse_get_last
         }
         if (ellipse->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfEllipse *) ellipse);
         }
         DxfEllipse *iter = (DxfEllipse *) ellipse->next;
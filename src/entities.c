@@ -53,6 +53,12 @@
 
 
 #include "entities.h"
+#include "endsec.h"
+#include "helix.h"
+#include "layer_index.h"
+#include "load_options.h"
+#include "seqend.h"
+#include "spline.h"
 
 
 /*!
@@ -123,7 +129,7 @@ dxf_entities_init
               return (NULL);
         }
         /* Initialize new structs for members. */
-        entities->dface_list = dxf_3dface_init (entities->dface_list);
+        entities->dface_list = (struct Dxf3dface *) dxf_3dface_init ((Dxf3dface *) entities->dface_list);
         if (entities->dface_list == NULL)
         {
               fprintf (stderr,
@@ -131,7 +137,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->dsolid_list = dxf_3dsolid_init (entities->dsolid_list);
+        entities->dsolid_list = (struct Dxf3dsolid *) dxf_3dsolid_init ((Dxf3dsolid *) entities->dsolid_list);
         if (entities->dsolid_list == NULL)
         {
               fprintf (stderr,
@@ -139,7 +145,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->acad_proxy_entity_list = dxf_acad_proxy_entity_init (entities->acad_proxy_entity_list);
+        entities->acad_proxy_entity_list = (struct DxfAcadProxyEntity *) dxf_acad_proxy_entity_init ((DxfAcadProxyEntity *) entities->acad_proxy_entity_list);
         if (entities->acad_proxy_entity_list == NULL)
         {
               fprintf (stderr,
@@ -147,7 +153,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->arc_list = dxf_arc_init (entities->arc_list);
+        entities->arc_list = (struct DxfArc *) dxf_arc_init ((DxfArc *) entities->arc_list);
         if (entities->arc_list == NULL)
         {
               fprintf (stderr,
@@ -155,7 +161,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->attdef_list = dxf_attdef_init (entities->attdef_list);
+        entities->attdef_list = (struct DxfAttdef *) dxf_attdef_init ((DxfAttdef *) entities->attdef_list);
         if (entities->attdef_list == NULL)
         {
               fprintf (stderr,
@@ -163,7 +169,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->attrib_list = dxf_attrib_init (entities->attrib_list);
+        entities->attrib_list = (struct DxfAttrib *) dxf_attrib_init ((DxfAttrib *) entities->attrib_list);
         if (entities->attrib_list == NULL)
         {
               fprintf (stderr,
@@ -171,7 +177,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->body_list = dxf_body_init (entities->body_list);
+        entities->body_list = (struct DxfBody *) dxf_body_init ((DxfBody *) entities->body_list);
         if (entities->body_list == NULL)
         {
               fprintf (stderr,
@@ -179,7 +185,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->circle_list = dxf_circle_init (entities->circle_list);
+        entities->circle_list = (struct DxfCircle *) dxf_circle_init ((DxfCircle *) entities->circle_list);
         if (entities->circle_list == NULL)
         {
               fprintf (stderr,
@@ -187,7 +193,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->dimension_list = dxf_dimension_init (entities->dimension_list);
+        entities->dimension_list = (struct DxfDimension *) dxf_dimension_init ((DxfDimension *) entities->dimension_list);
         if (entities->dimension_list == NULL)
         {
               fprintf (stderr,
@@ -195,7 +201,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->ellipse_list = dxf_ellipse_init (entities->ellipse_list);
+        entities->ellipse_list = (struct DxfEllipse *) dxf_ellipse_init ((DxfEllipse *) entities->ellipse_list);
         if (entities->ellipse_list == NULL)
         {
               fprintf (stderr,
@@ -203,7 +209,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->hatch_list = dxf_hatch_init (entities->hatch_list);
+        entities->hatch_list = (struct DxfHatch *) dxf_hatch_init ((DxfHatch *) entities->hatch_list);
         if (entities->hatch_list == NULL)
         {
               fprintf (stderr,
@@ -211,7 +217,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->helix_list = dxf_helix_init (entities->helix_list);
+        entities->helix_list = (struct DxfHelix *) dxf_helix_init ((DxfHelix *) entities->helix_list);
         if (entities->helix_list == NULL)
         {
               fprintf (stderr,
@@ -219,7 +225,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->image_list = dxf_image_init (entities->image_list);
+        entities->image_list = (struct DxfImage *) dxf_image_init ((DxfImage *) entities->image_list);
         if (entities->image_list == NULL)
         {
               fprintf (stderr,
@@ -227,7 +233,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->insert_list = dxf_insert_init (entities->insert_list);
+        entities->insert_list = (struct DxfInsert *) dxf_insert_init ((DxfInsert *) entities->insert_list);
         if (entities->insert_list == NULL)
         {
               fprintf (stderr,
@@ -235,7 +241,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->leader_list = dxf_leader_init (entities->leader_list);
+        entities->leader_list = (struct DxfLeader *) dxf_leader_init ((DxfLeader *) entities->leader_list);
         if (entities->leader_list == NULL)
         {
               fprintf (stderr,
@@ -243,7 +249,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->light_list = dxf_light_init (entities->light_list);
+        entities->light_list = (struct DxfLight *) dxf_light_init ((DxfLight *) entities->light_list);
         if (entities->light_list == NULL)
         {
               fprintf (stderr,
@@ -251,7 +257,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->line_list = dxf_line_init (entities->line_list);
+        entities->line_list = (struct DxfLine *) dxf_line_init ((DxfLine *) entities->line_list);
         if (entities->line_list == NULL)
         {
               fprintf (stderr,
@@ -259,7 +265,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->lw_polyline_list = dxf_lwpolyline_init (entities->lw_polyline_list);
+        entities->lw_polyline_list = (struct DxfLWPolyline *) dxf_lwpolyline_init ((DxfLWPolyline *) entities->lw_polyline_list);
         if (entities->lw_polyline_list == NULL)
         {
               fprintf (stderr,
@@ -267,8 +273,8 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        //entities->mesh_list = NULL;
-        entities->mline_list = dxf_mline_init (entities->mline_list);
+        entities->mesh_list = NULL;
+        entities->mline_list = (struct DxfMline *) dxf_mline_init ((DxfMline *) entities->mline_list);
         if (entities->mline_list == NULL)
         {
               fprintf (stderr,
@@ -278,7 +284,7 @@ dxf_entities_init
         }
         //entities->mleader_list = NULL;
         //entities->mleaderstyle_list = NULL;
-        entities->mtext_list = dxf_mtext_init (entities->mtext_list);
+        entities->mtext_list = (struct DxfMtext *) dxf_mtext_init ((DxfMtext *) entities->mtext_list);
         if (entities->mtext_list == NULL)
         {
               fprintf (stderr,
@@ -286,7 +292,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->oleframe_list = dxf_oleframe_init (entities->oleframe_list);
+        entities->oleframe_list = (struct DxfOleFrame *) dxf_oleframe_init ((DxfOleFrame *) entities->oleframe_list);
         if (entities->oleframe_list == NULL)
         {
               fprintf (stderr,
@@ -294,7 +300,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->ole2frame_list = dxf_ole2frame_init (entities->ole2frame_list);
+        entities->ole2frame_list = (struct DxfOle2Frame *) dxf_ole2frame_init ((DxfOle2Frame *) entities->ole2frame_list);
         if (entities->ole2frame_list == NULL)
         {
               fprintf (stderr,
@@ -302,7 +308,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->point_list = dxf_point_init (entities->point_list);
+        entities->point_list = (struct DxfPoint *) dxf_point_init ((DxfPoint *) entities->point_list);
         if (entities->point_list == NULL)
         {
               fprintf (stderr,
@@ -310,7 +316,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->polyline_list = dxf_polyline_init (entities->polyline_list);
+        entities->polyline_list = (struct DxfPolyline *) dxf_polyline_init ((DxfPolyline *) entities->polyline_list);
         if (entities->polyline_list == NULL)
         {
               fprintf (stderr,
@@ -318,7 +324,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->ray_list = dxf_ray_init (entities->ray_list);
+        entities->ray_list = (struct DxfRay *) dxf_ray_init ((DxfRay *) entities->ray_list);
         if (entities->ray_list == NULL)
         {
               fprintf (stderr,
@@ -326,7 +332,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->region_list = dxf_region_init (entities->region_list);
+        entities->region_list = (struct DxfRegion *) dxf_region_init ((DxfRegion *) entities->region_list);
         if (entities->region_list == NULL)
         {
               fprintf (stderr,
@@ -335,7 +341,7 @@ dxf_entities_init
               return (NULL);
         }
         //entities->section_list = NULL;
-        entities->shape_list = dxf_shape_init (entities->shape_list);
+        entities->shape_list = (struct DxfShape *) dxf_shape_init ((DxfShape *) entities->shape_list);
         if (entities->shape_list == NULL)
         {
               fprintf (stderr,
@@ -343,7 +349,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->solid_list = dxf_solid_init (entities->solid_list);
+        entities->solid_list = (struct DxfSolid *) dxf_solid_init ((DxfSolid *) entities->solid_list);
         if (entities->solid_list == NULL)
         {
               fprintf (stderr,
@@ -351,7 +357,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->spline_list = dxf_spline_init (entities->spline_list);
+        entities->spline_list = (struct DxfSpline *) dxf_spline_init ((DxfSpline *) entities->spline_list);
         if (entities->spline_list == NULL)
         {
               fprintf (stderr,
@@ -361,7 +367,7 @@ dxf_entities_init
         }
         //entities->sun_list = NULL;
         //entities->surface_list = NULL;
-        entities->table_list = dxf_table_init (entities->table_list);
+        entities->table_list = (struct DxfTable *) dxf_table_init ((DxfTable *) entities->table_list);
         if (entities->table_list == NULL)
         {
               fprintf (stderr,
@@ -369,7 +375,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->text_list = dxf_text_init (entities->text_list);
+        entities->text_list = (struct DxfText *) dxf_text_init ((DxfText *) entities->text_list);
         if (entities->text_list == NULL)
         {
               fprintf (stderr,
@@ -377,7 +383,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->tolerance_list = dxf_tolerance_init (entities->tolerance_list);
+        entities->tolerance_list = (struct DxfTolerance *) dxf_tolerance_init ((DxfTolerance *) entities->tolerance_list);
         if (entities->tolerance_list == NULL)
         {
               fprintf (stderr,
@@ -385,7 +391,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->trace_list = dxf_trace_init (entities->trace_list);
+        entities->trace_list = (struct DxfTrace *) dxf_trace_init ((DxfTrace *) entities->trace_list);
         if (entities->trace_list == NULL)
         {
               fprintf (stderr,
@@ -394,7 +400,7 @@ dxf_entities_init
               return (NULL);
         }
         //entities->underlay_list = NULL;
-        entities->vertex_list = dxf_vertex_init (entities->vertex_list);
+        entities->vertex_list = (struct DxfVertex *) dxf_vertex_init ((DxfVertex *) entities->vertex_list);
         if (entities->vertex_list == NULL)
         {
               fprintf (stderr,
@@ -402,7 +408,7 @@ dxf_entities_init
                 __FUNCTION__);
               return (NULL);
         }
-        entities->viewport_list = dxf_viewport_init (entities->viewport_list);
+        entities->viewport_list = (struct DxfViewport *) dxf_viewport_init ((DxfViewport *) entities->viewport_list);
         if (entities->viewport_list == NULL)
         {
               fprintf (stderr,
@@ -450,6 +456,9 @@ dxf_entities_read_table
 
 /*!
  * \brief Write DXF output to a file for a DXF \c ENTITIES table.
+ *
+ * \deprecated Use dxf_entities_write (), which writes the entities of
+ * a DXF entities section in file order.
  */
 int
 dxf_entities_write_table
@@ -471,6 +480,210 @@ dxf_entities_write_table
 }
 
 
+/*!
+ * \brief Write a \c POLYLINE entity with it's vertices followed by the
+ * \c SEQEND marker.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_entities_write_polyline
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfPolyline *polyline
+                /*!< DXF polyline entity. */
+)
+{
+        DxfSeqend *seqend;
+        int result;
+
+        if (dxf_polyline_write (fp, polyline) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        seqend = dxf_seqend_init (dxf_seqend_new ());
+        if (seqend == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (seqend->layer);
+        seqend->layer = strdup (polyline->layer);
+        result = dxf_seqend_write (fp, seqend);
+        dxf_seqend_free (seqend);
+        return (result);
+}
+
+
+/*!
+ * \brief Write a single entity of a known type to a DXF file.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * has no writer or an error occurred.
+ */
+static int
+dxf_entities_write_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntityType type,
+                /*!< Type of the entity to be written. */
+        void *entity
+                /*!< Entity to be written. */
+)
+{
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_3dface_write (fp, (Dxf3dface *) entity));
+                case DSOLID:
+                        return (dxf_3dsolid_write (fp, (Dxf3dsolid *) entity));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_write (fp, (DxfAcadProxyEntity *) entity));
+                case ARC:
+                        return (dxf_arc_write (fp, (DxfArc *) entity));
+                case ATTDEF:
+                        return (dxf_attdef_write (fp, (DxfAttdef *) entity));
+                case ATTRIB:
+                        return (dxf_attrib_write (fp, (DxfAttrib *) entity));
+                case BODY:
+                        return (dxf_body_write (fp, (DxfBody *) entity));
+                case CIRCLE:
+                        return (dxf_circle_write (fp, (DxfCircle *) entity));
+                case DIMENSION:
+                        return (dxf_dimension_write (fp, (DxfDimension *) entity));
+                case ELLIPSE:
+                        return (dxf_ellipse_write (fp, (DxfEllipse *) entity));
+                case HATCH:
+                        return (dxf_hatch_write (fp, (DxfHatch *) entity));
+                case HELIX:
+                        return (dxf_helix_write (fp, (DxfHelix *) entity));
+                case IMAGE:
+                        return (dxf_image_write (fp, (DxfImage *) entity));
+                case INSERT:
+                        return (dxf_insert_write (fp, (DxfInsert *) entity));
+                case LEADER:
+                        return (dxf_leader_write (fp, (DxfLeader *) entity));
+                case LIGHT:
+                        return (dxf_light_write (fp, (DxfLight *) entity));
+                case LINE:
+                        return (dxf_line_write (fp, (DxfLine *) entity));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_write (fp, (DxfLWPolyline *) entity));
+                case MESH:
+                        return (dxf_mesh_write (fp, (DxfMesh *) entity));
+                case MLINE:
+                        return (dxf_mline_write (fp, (DxfMline *) entity));
+                case MTEXT:
+                        return (dxf_mtext_write (fp, (DxfMtext *) entity));
+                case OLEFRAME:
+                        return (dxf_oleframe_write (fp, (DxfOleFrame *) entity));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_write (fp, (DxfOle2Frame *) entity));
+                case POINT:
+                        return (dxf_point_write (fp, (DxfPoint *) entity));
+                case POLYLINE:
+                        return (dxf_entities_write_polyline (fp, (DxfPolyline *) entity));
+                case RAY:
+                        return (dxf_ray_write (fp, (DxfRay *) entity));
+                case REGION:
+                        return (dxf_region_write (fp, (DxfRegion *) entity));
+                case SHAPE:
+                        return (dxf_shape_write (fp, (DxfShape *) entity));
+                case SOLID:
+                        return (dxf_solid_write (fp, (DxfSolid *) entity));
+                case SPLINE:
+                        return (dxf_spline_write (fp, (DxfSpline *) entity));
+                case TABLE:
+                        return (dxf_table_write (fp, (DxfTable *) entity));
+                case TEXT:
+                        return (dxf_text_write (fp, (DxfText *) entity));
+                case TOLERANCE:
+                        return (dxf_tolerance_write (fp, (DxfTolerance *) entity));
+                case TRACE:
+                        return (dxf_trace_write (fp, (DxfTrace *) entity));
+                case VERTEX:
+                        return (dxf_vertex_write (fp, (DxfVertex *) entity));
+                case VIEWPORT:
+                        return (dxf_viewport_write (fp, (DxfViewport *) entity));
+                default:
+                        /* No member list in DxfEntities for this type. */
+                        return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief Write DXF output to a file for the entities of a DXF entities
+ * section in file order.
+ *
+ * The entities are written in the order of the \c sequence array (the
+ * order in which they were read or appended, the draw order), enclosed
+ * in a \c SECTION \c ENTITIES and an \c ENDSEC marker.\n
+ * The vertices of a \c POLYLINE entity are followed by a \c SEQEND
+ * marker on the layer of the polyline.\n
+ * An entity which can not be written is left out, the entities
+ * following it are still written.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an entity
+ * was left out or an error occurred.
+ */
+int
+dxf_entities_write
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfEntitiesCursor cursor;
+        DxfEntityType type;
+        void *entity;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_section_write (fp, "ENTITIES");
+        dxf_entities_cursor_init (&cursor, entities);
+        while ((entity = dxf_entities_cursor_next (&cursor, &type)) != NULL)
+        {
+                if (dxf_entities_write_entity (fp, type, entity) == EXIT_FAILURE)
+                {
+                        fprintf (stderr,
+                          (_("Warning in %s () entity %d could not be written.\n")),
+                          __FUNCTION__, cursor.index - 1);
+                        result = EXIT_FAILURE;
+                }
+        }
+        dxf_endsec_write (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /*!
  * \brief Free the allocated memory for a DXF \c ENTITIES section and
  * all it's data fields.
@@ -515,6 +728,10 @@ dxf_entities_free
         dxf_line_free_list ((DxfLine *) entities->line_list);
         dxf_lwpolyline_free_list ((DxfLWPolyline *) entities->lw_polyline_list);
         //dxf_light_free_list ((DxfLight *) entities->light_list);
+        if (entities->mesh_list != NULL)
+        {
+                dxf_mesh_free_list ((DxfMesh *) entities->mesh_list);
+        }
         dxf_mline_free_list ((DxfMline *) entities->mline_list);
         //dxf_mleader_free_list ((DxfMLeader *) entities->mleader_list);
         //dxf_mleaderstyle_free_list ((DxfMLeaderStyle *) entities->mleaderstyle_list);
@@ -540,6 +757,7 @@ dxf_entities_free
         dxf_viewport_free_list ((DxfViewport *) entities->viewport_list);
         //dxf_wipeout_free_list (DxfWipeout *) entities->wipeout_list);
         //dxf_xline_free_list (DxfXLine *) entities->xline_list);
+        free (entities->sequence);
         free (entities);
         entities = NULL;
 #if DEBUG
@@ -549,4 +767,1033 @@ dxf_entities_free
 }
 
 
+/*!
+ * \brief Read a single entity of a known type from a DXF file.
+ *
+ * The last line read from file contained the name of the entity.
+ *
+ * \return a pointer to the newly allocated entity, or \c NULL when the
+ * type has no reader (yet) or an error occurred.
+ */
+static void *
+dxf_entities_read_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntityType type
+                /*!< Type of the entity to be read. */
+)
+{
+        switch (type)
+        {
+                case DFACE:
+                        return (dxf_3dface_read (fp, dxf_3dface_init (dxf_3dface_new ())));
+                case DSOLID:
+                        return (dxf_3dsolid_read (fp, dxf_3dsolid_init (dxf_3dsolid_new ())));
+                case ACADPROXYENTITY:
+                        return (dxf_acad_proxy_entity_read (fp, dxf_acad_proxy_entity_init (dxf_acad_proxy_entity_new ())));
+                case ARC:
+                        return (dxf_arc_read (fp, dxf_arc_init (dxf_arc_new ())));
+                case ATTDEF:
+                        return (dxf_attdef_read (fp, dxf_attdef_init (dxf_attdef_new ())));
+                case ATTRIB:
+                        return (dxf_attrib_read (fp, dxf_attrib_init (dxf_attrib_new ())));
+                case BODY:
+                        return (dxf_body_read (fp, dxf_body_init (dxf_body_new ())));
+                case CIRCLE:
+                        return (dxf_circle_read (fp, dxf_circle_init (dxf_circle_new ())));
+                case DIMENSION:
+                        return (dxf_dimension_read (fp, dxf_dimension_init (dxf_dimension_new ())));
+                case ELLIPSE:
+                        return (dxf_ellipse_read (fp, dxf_ellipse_init (dxf_ellipse_new ())));
+                case HATCH:
+                        return (dxf_hatch_read (fp, dxf_hatch_init (dxf_hatch_new ())));
+                case HELIX:
+                        return (dxf_helix_read (fp, dxf_helix_init (dxf_helix_new ())));
+                case IMAGE:
+                        return (dxf_image_read (fp, dxf_image_init (dxf_image_new ())));
+                case INSERT:
+                        return (dxf_insert_read (fp, dxf_insert_init (dxf_insert_new ())));
+                case LEADER:
+                        return (dxf_leader_read (fp, dxf_leader_init (dxf_leader_new ())));
+                case LIGHT:
+                        return (dxf_light_read (fp, dxf_light_init (dxf_light_new ())));
+                case LINE:
+                        return (dxf_line_read (fp, dxf_line_init (dxf_line_new ())));
+                case LWPOLYLINE:
+                        return (dxf_lwpolyline_read (fp, dxf_lwpolyline_init (dxf_lwpolyline_new ())));
+                case MESH:
+                        return (dxf_mesh_read (fp, dxf_mesh_init (dxf_mesh_new ())));
+                case MLINE:
+                        return (dxf_mline_read (fp, dxf_mline_init (dxf_mline_new ())));
+                case MTEXT:
+                        return (dxf_mtext_read (fp, dxf_mtext_init (dxf_mtext_new ())));
+                case OLEFRAME:
+                        return (dxf_oleframe_read (fp, dxf_oleframe_init (dxf_oleframe_new ())));
+                case OLE2FRAME:
+                        return (dxf_ole2frame_read (fp, dxf_ole2frame_init (dxf_ole2frame_new ())));
+                case POINT:
+                        return (dxf_point_read (fp, dxf_point_init (dxf_point_new ())));
+                case POLYLINE:
+                        return (dxf_polyline_read (fp, dxf_polyline_init (dxf_polyline_new ())));
+                case RAY:
+                        return (dxf_ray_read (fp, dxf_ray_init (dxf_ray_new ())));
+                case REGION:
+                        return (dxf_region_read (fp, dxf_region_init (dxf_region_new ())));
+                case SHAPE:
+                        return (dxf_shape_read (fp, dxf_shape_init (dxf_shape_new ())));
+                case SOLID:
+                        return (dxf_solid_read (fp, dxf_solid_init (dxf_solid_new ())));
+                case SPLINE:
+                        return (dxf_spline_read (fp, dxf_spline_init (dxf_spline_new ())));
+                case TABLE:
+                        return (dxf_table_read (fp, dxf_table_init (dxf_table_new ())));
+                case TEXT:
+                        return (dxf_text_read (fp, dxf_text_init (dxf_text_new ())));
+                case TOLERANCE:
+                        return (dxf_tolerance_read (fp, dxf_tolerance_init (dxf_tolerance_new ())));
+                case TRACE:
+                        return (dxf_trace_read (fp, dxf_trace_init (dxf_trace_new ())));
+                case VERTEX:
+                        return (dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ())));
+                case VIEWPORT:
+                        return (dxf_viewport_read (fp, dxf_viewport_init (dxf_viewport_new ())));
+                default:
+                        /* No member list in DxfEntities for this type. */
+                        return (NULL);
+        }
+}
+
+
+/*!
+ * \brief Append an entity to the tail of the single linked list for
+ * it's type.
+ *
+ * \c last holds the last entity of every list (indexed by entity type),
+ * so that appending does not have to walk the list.
+ */
+#define DXF_ENTITIES_LINK(list, Type) \
+        if (last[type] == NULL) \
+                entities->list = (struct Type *) entity; \
+        else \
+                ((Type *) last[type])->next = (struct Type *) entity; \
+        break;
+
+static int
+dxf_entities_link_entity
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity,
+                /*!< Entity to be appended. */
+        void **last
+                /*!< Last entity of every list, indexed by type. */
+)
+{
+        switch (type)
+        {
+                case DFACE: DXF_ENTITIES_LINK (dface_list, Dxf3dface)
+                case DSOLID: DXF_ENTITIES_LINK (dsolid_list, Dxf3dsolid)
+                case ACADPROXYENTITY: DXF_ENTITIES_LINK (acad_proxy_entity_list, DxfAcadProxyEntity)
+                case ARC: DXF_ENTITIES_LINK (arc_list, DxfArc)
+                case ATTDEF: DXF_ENTITIES_LINK (attdef_list, DxfAttdef)
+                case ATTRIB: DXF_ENTITIES_LINK (attrib_list, DxfAttrib)
+                case BODY: DXF_ENTITIES_LINK (body_list, DxfBody)
+                case CIRCLE: DXF_ENTITIES_LINK (circle_list, DxfCircle)
+                case DIMENSION: DXF_ENTITIES_LINK (dimension_list, DxfDimension)
+                case ELLIPSE: DXF_ENTITIES_LINK (ellipse_list, DxfEllipse)
+                case HATCH: DXF_ENTITIES_LINK (hatch_list, DxfHatch)
+                case HELIX: DXF_ENTITIES_LINK (helix_list, DxfHelix)
+                case IMAGE: DXF_ENTITIES_LINK (image_list, DxfImage)
+                case INSERT: DXF_ENTITIES_LINK (insert_list, DxfInsert)
+                case LEADER: DXF_ENTITIES_LINK (leader_list, DxfLeader)
+                case LIGHT: DXF_ENTITIES_LINK (light_list, DxfLight)
+                case LINE: DXF_ENTITIES_LINK (line_list, DxfLine)
+                case LWPOLYLINE: DXF_ENTITIES_LINK (lw_polyline_list, DxfLWPolyline)
+                case MESH: DXF_ENTITIES_LINK (mesh_list, DxfMesh)
+                case MLINE: DXF_ENTITIES_LINK (mline_list, DxfMline)
+                case MTEXT: DXF_ENTITIES_LINK (mtext_list, DxfMtext)
+                case OLEFRAME: DXF_ENTITIES_LINK (oleframe_list, DxfOleFrame)
+                case OLE2FRAME: DXF_ENTITIES_LINK (ole2frame_list, DxfOle2Frame)
+                case POINT: DXF_ENTITIES_LINK (point_list, DxfPoint)
+                case POLYLINE: DXF_ENTITIES_LINK (polyline_list, DxfPolyline)
+                case RAY: DXF_ENTITIES_LINK (ray_list, DxfRay)
+                case REGION: DXF_ENTITIES_LINK (region_list, DxfRegion)
+                case SHAPE: DXF_ENTITIES_LINK (shape_list, DxfShape)
+                case SOLID: DXF_ENTITIES_LINK (solid_list, DxfSolid)
+                case SPLINE: DXF_ENTITIES_LINK (spline_list, DxfSpline)
+                case TABLE: DXF_ENTITIES_LINK (table_list, DxfTable)
+                case TEXT: DXF_ENTITIES_LINK (text_list, DxfText)
+                case TOLERANCE: DXF_ENTITIES_LINK (tolerance_list, DxfTolerance)
+                case TRACE: DXF_ENTITIES_LINK (trace_list, DxfTrace)
+                case VERTEX: DXF_ENTITIES_LINK (vertex_list, DxfVertex)
+                case VIEWPORT: DXF_ENTITIES_LINK (viewport_list, DxfViewport)
+                default:
+                        return (EXIT_FAILURE);
+        }
+        last[type] = entity;
+        return (EXIT_SUCCESS);
+}
+
+#undef DXF_ENTITIES_LINK
+
+
+/*!
+ * \brief Get the layer name of an entity.
+ *
+ * \return the layer name, or \c NULL when the entity type is not
+ * supported or an error occurred.
+ */
+#define DXF_ENTITIES_LAYER(Type) \
+        return (((Type *) entity)->layer);
+
+char *
+dxf_entity_get_layer
+(
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        switch (type)
+        {
+                case DFACE: DXF_ENTITIES_LAYER (Dxf3dface)
+                case DSOLID: DXF_ENTITIES_LAYER (Dxf3dsolid)
+                case ACADPROXYENTITY: DXF_ENTITIES_LAYER (DxfAcadProxyEntity)
+                case ARC: DXF_ENTITIES_LAYER (DxfArc)
+                case ATTDEF: DXF_ENTITIES_LAYER (DxfAttdef)
+                case ATTRIB: DXF_ENTITIES_LAYER (DxfAttrib)
+                case BODY: DXF_ENTITIES_LAYER (DxfBody)
+                case CIRCLE: DXF_ENTITIES_LAYER (DxfCircle)
+                case DIMENSION: DXF_ENTITIES_LAYER (DxfDimension)
+                case ELLIPSE: DXF_ENTITIES_LAYER (DxfEllipse)
+                case HATCH: DXF_ENTITIES_LAYER (DxfHatch)
+                case HELIX: DXF_ENTITIES_LAYER (DxfHelix)
+                case IMAGE: DXF_ENTITIES_LAYER (DxfImage)
+                case INSERT: DXF_ENTITIES_LAYER (DxfInsert)
+                case LEADER: DXF_ENTITIES_LAYER (DxfLeader)
+                case LIGHT: DXF_ENTITIES_LAYER (DxfLight)
+                case LINE: DXF_ENTITIES_LAYER (DxfLine)
+                case LWPOLYLINE: DXF_ENTITIES_LAYER (DxfLWPolyline)
+                case MESH: DXF_ENTITIES_LAYER (DxfMesh)
+                case MLINE: DXF_ENTITIES_LAYER (DxfMline)
+                case MTEXT: DXF_ENTITIES_LAYER (DxfMtext)
+                case OLEFRAME: DXF_ENTITIES_LAYER (DxfOleFrame)
+                case OLE2FRAME: DXF_ENTITIES_LAYER (DxfOle2Frame)
+                case POINT: DXF_ENTITIES_LAYER (DxfPoint)
+                case POLYLINE: DXF_ENTITIES_LAYER (DxfPolyline)
+                case RAY: DXF_ENTITIES_LAYER (DxfRay)
+                case REGION: DXF_ENTITIES_LAYER (DxfRegion)
+                case SHAPE: DXF_ENTITIES_LAYER (DxfShape)
+                case SOLID: DXF_ENTITIES_LAYER (DxfSolid)
+                case SPLINE: DXF_ENTITIES_LAYER (DxfSpline)
+                case TABLE: DXF_ENTITIES_LAYER (DxfTable)
+                case TEXT: DXF_ENTITIES_LAYER (DxfText)
+                case TOLERANCE: DXF_ENTITIES_LAYER (DxfTolerance)
+                case TRACE: DXF_ENTITIES_LAYER (DxfTrace)
+                case VERTEX: DXF_ENTITIES_LAYER (DxfVertex)
+                case VIEWPORT: DXF_ENTITIES_LAYER (DxfViewport)
+                default:
+                        return (NULL);
+        }
+}
+
+#undef DXF_ENTITIES_LAYER
+
+
+/*!
+ * \brief Get the identification number (handle) of an entity.
+ *
+ * \return the id code, or \c -1 when the entity type is not supported
+ * or an error occurred.
+ */
+#define DXF_ENTITIES_ID_CODE(Type) \
+        return (((Type *) entity)->id_code);
+
+int
+dxf_entity_get_id_code
+(
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+        /* Do some basic checks. */
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        switch (type)
+        {
+                case DFACE: DXF_ENTITIES_ID_CODE (Dxf3dface)
+                case DSOLID: DXF_ENTITIES_ID_CODE (Dxf3dsolid)
+                case ACADPROXYENTITY: DXF_ENTITIES_ID_CODE (DxfAcadProxyEntity)
+                case ARC: DXF_ENTITIES_ID_CODE (DxfArc)
+                case ATTDEF: DXF_ENTITIES_ID_CODE (DxfAttdef)
+                case ATTRIB: DXF_ENTITIES_ID_CODE (DxfAttrib)
+                case BODY: DXF_ENTITIES_ID_CODE (DxfBody)
+                case CIRCLE: DXF_ENTITIES_ID_CODE (DxfCircle)
+                case DIMENSION: DXF_ENTITIES_ID_CODE (DxfDimension)
+                case ELLIPSE: DXF_ENTITIES_ID_CODE (DxfEllipse)
+                case HATCH: DXF_ENTITIES_ID_CODE (DxfHatch)
+                case HELIX: DXF_ENTITIES_ID_CODE (DxfHelix)
+                case IMAGE: DXF_ENTITIES_ID_CODE (DxfImage)
+                case INSERT: DXF_ENTITIES_ID_CODE (DxfInsert)
+                case LEADER: DXF_ENTITIES_ID_CODE (DxfLeader)
+                case LIGHT: DXF_ENTITIES_ID_CODE (DxfLight)
+                case LINE: DXF_ENTITIES_ID_CODE (DxfLine)
+                case LWPOLYLINE: DXF_ENTITIES_ID_CODE (DxfLWPolyline)
+                case MESH: DXF_ENTITIES_ID_CODE (DxfMesh)
+                case MLINE: DXF_ENTITIES_ID_CODE (DxfMline)
+                case MTEXT: DXF_ENTITIES_ID_CODE (DxfMtext)
+                case OLEFRAME: DXF_ENTITIES_ID_CODE (DxfOleFrame)
+                case OLE2FRAME: DXF_ENTITIES_ID_CODE (DxfOle2Frame)
+                case POINT: DXF_ENTITIES_ID_CODE (DxfPoint)
+                case POLYLINE: DXF_ENTITIES_ID_CODE (DxfPolyline)
+                case RAY: DXF_ENTITIES_ID_CODE (DxfRay)
+                case REGION: DXF_ENTITIES_ID_CODE (DxfRegion)
+                case SHAPE: DXF_ENTITIES_ID_CODE (DxfShape)
+                case SOLID: DXF_ENTITIES_ID_CODE (DxfSolid)
+                case SPLINE: DXF_ENTITIES_ID_CODE (DxfSpline)
+                case TABLE: DXF_ENTITIES_ID_CODE (DxfTable)
+                case TEXT: DXF_ENTITIES_ID_CODE (DxfText)
+                case TOLERANCE: DXF_ENTITIES_ID_CODE (DxfTolerance)
+                case TRACE: DXF_ENTITIES_ID_CODE (DxfTrace)
+                case VERTEX: DXF_ENTITIES_ID_CODE (DxfVertex)
+                case VIEWPORT: DXF_ENTITIES_ID_CODE (DxfViewport)
+                default:
+                        return (-1);
+        }
+}
+
+#undef DXF_ENTITIES_ID_CODE
+
+
+/*!
+ * \brief Skip the group code / value pairs of an entity until the group
+ * code 0 of the next entity.
+ */
+static void
+dxf_entities_skip_entity
+(
+        DxfFile *fp
+                /*!< DXF file pointer to an input file (or device). */
+)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+
+        memset (temp_string, 0, sizeof (temp_string));
+        while (!feof (fp->fp))
+        {
+                dxf_read_line (temp_string, fp);
+                if (strcmp (temp_string, "0") == 0)
+                {
+                        break;
+                }
+                /* Skip the value belonging to the group code. */
+                dxf_read_line (temp_string, fp);
+        }
+}
+
+
+/*!
+ * \brief Buffer the group code / value pairs of an entity up to and
+ * including the group code 0 of the next entity, and pick up the layer
+ * name (group code 8) on the way.
+ *
+ * Every line is kept as read by dxf_read_value_line (), so that the
+ * entity readers get the same values when the buffer is replayed.\n
+ * \c layer is set to \c DXF_DEFAULT_LAYER when the entity has no
+ * layer name.
+ *
+ * \return the number of buffered characters, or \c -1 when no memory
+ * could be allocated.
+ */
+static long
+dxf_entities_buffer_entity
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        char **buffer,
+                /*!< Buffer owned by the caller, grown as needed. */
+        size_t *size,
+                /*!< Size of \c buffer. */
+        char *layer
+                /*!< Buffer of \c DXF_MAX_STRING_LENGTH chars receiving
+                 * the layer name. */
+)
+{
+        char line[DXF_MAX_STRING_LENGTH];
+        char *new_buffer;
+        char *end;
+        size_t new_size;
+        size_t length = 0;
+        size_t n;
+        long group_code = -1;
+        int is_group_code = TRUE;
+
+        strcpy (layer, DXF_DEFAULT_LAYER);
+        while (dxf_read_value_line (line, fp) == EXIT_SUCCESS)
+        {
+                n = strlen (line);
+                if (length + n + 2 > *size)
+                {
+                        new_size = (*size > 0) ? 2 * *size : 4096;
+                        while (length + n + 2 > new_size)
+                        {
+                                new_size *= 2;
+                        }
+                        new_buffer = realloc (*buffer, new_size);
+                        if (new_buffer == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (-1);
+                        }
+                        *buffer = new_buffer;
+                        *size = new_size;
+                }
+                memcpy (*buffer + length, line, n);
+                length += n;
+                (*buffer)[length++] = '\n';
+                if (is_group_code)
+                {
+                        group_code = strtol (line, &end, 10);
+                        if (end == line)
+                        {
+                                group_code = -1;
+                        }
+                        if (group_code == 0)
+                        {
+                                break;
+                        }
+                }
+                else if (group_code == 8)
+                {
+                        strcpy (layer, line);
+                }
+                is_group_code = !is_group_code;
+        }
+        return ((long) length);
+}
+
+
+/*!
+ * \brief Test if the entity following in the DXF file is rejected by
+ * the layer filter of the load options.
+ *
+ * The group code / value pairs of the entity are buffered while the
+ * layer name is looked up, so the input does not have to be seekable
+ * (e.g. a pipe).\n
+ * When the entity is accepted \c fp reads the buffered pairs first:
+ * \c *input receives the file pointer of the input file, which is
+ * given back with dxf_entities_end_replay () once the entity is read.\n
+ * When the entity is rejected it is skipped up to and including the
+ * group code 0 of the next entity.
+ *
+ * \return \c TRUE when the entity was rejected and skipped, \c FALSE
+ * when the entity is to be read.
+ */
+static int
+dxf_entities_skip_layer
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        char **buffer,
+                /*!< Buffer owned by the caller, grown as needed. */
+        size_t *size,
+                /*!< Size of \c buffer. */
+        FILE **input
+                /*!< Receives the input file while the buffer is
+                 * replayed, \c NULL otherwise. */
+)
+{
+        char layer[DXF_MAX_STRING_LENGTH];
+        FILE *replay;
+        long length;
+        int line_number;
+
+        *input = NULL;
+        if ((options == NULL) || (options->layer_filter == NULL))
+        {
+                return (FALSE);
+        }
+        line_number = fp->line_number;
+        length = dxf_entities_buffer_entity (fp, buffer, size, layer);
+        if (length <= 0)
+        {
+                return (length < 0);
+        }
+        if (!dxf_load_options_accept_layer (options, layer))
+        {
+                return (TRUE);
+        }
+#ifdef _WIN32
+        /* No fmemopen (), spool the entity to a temporary file. */
+        replay = tmpfile ();
+        if ((replay != NULL)
+          && ((fwrite (*buffer, 1, length, replay) != (size_t) length)
+          || (fseek (replay, 0L, SEEK_SET) != 0)))
+        {
+                fclose (replay);
+                replay = NULL;
+        }
+#else
+        replay = fmemopen (*buffer, length, "r");
+#endif
+        if (replay == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not replay: %s from line: %d.\n")),
+                  __FUNCTION__, fp->filename, line_number);
+                return (TRUE);
+        }
+        *input = fp->fp;
+        fp->fp = replay;
+        fp->line_number = line_number;
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Give the input file back to \c fp after the buffered pairs of
+ * an entity accepted by dxf_entities_skip_layer () were read.
+ */
+static void
+dxf_entities_end_replay
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        FILE *input
+                /*!< Input file, \c NULL when nothing was replayed. */
+)
+{
+        if (input == NULL)
+        {
+                return;
+        }
+        fclose (fp->fp);
+        fp->fp = input;
+}
+
+
+/*!
+ * \brief Read and parse the entities from the \c ENTITIES section of a
+ * DXF file into a DXF entities section.
+ *
+ * The last line read from file contained the string "ENTITIES", or
+ * the group code 0 announcing the first entity when a preceding reader
+ * already consumed it, as dxf_block_read () does; the name of the first
+ * entity is then the first line read.\n
+ * Every entity is appended to the single linked list for it's type and
+ * to the \c sequence array, which keeps the order in which the entities
+ * were read (the draw order).\n
+ * \c VERTEX entities following a \c POLYLINE entity are appended to the
+ * vertices of that polyline up to the \c SEQEND marker.\n
+ * Entities without a member list in \c DxfEntities are skipped.\n
+ * Entities rejected by the \c load_options of \c fp are skipped
+ * without allocating memory or converting their values (a rejected
+ * \c POLYLINE is skipped including it's vertices).\n
+ * When the \c load_options of \c fp hold a layer index every loaded
+ * entity is added to the bucket of it's layer.\n
+ * Reading stops at the \c ENDSEC marker, or at the \c ENDBLK marker
+ * when reading the entities of a block definition (the group codes of
+ * the \c ENDBLK marker are left to the caller).
+ *
+ * Unless libDXF is built with \c DXF_TRUSTED_INPUT the entities are
+ * checked with dxf_entities_validate () once all are read, invalid
+ * entities are reported to the diagnostics sink of \c fp.
+ *
+ * \note Entities already present in \c entities are expected to be
+ * present in the \c sequence array too.
+ *
+ * \return a pointer to \c entities, or \c NULL when an error occurred.
+ */
+DxfEntities *
+dxf_entities_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        void *last[DXF_NUMBER_OF_ENTITY_TYPES];
+        DxfLoadOptions *options;
+        DxfPolyline *polyline = NULL;
+        DxfVertex *last_vertex = NULL;
+        int skip_vertices = FALSE;
+        int have_name;
+        DxfEntityType type;
+        void *entity;
+        char *buffer = NULL;
+        size_t buffer_size = 0;
+        FILE *input;
+        int i;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (entities == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                entities = dxf_entities_new ();
+                if (entities == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        options = (DxfLoadOptions *) fp->load_options;
+        /* Find the tails of the lists from the sequence, the last
+         * occurrence of a type is the tail of it's list. */
+        memset (last, 0, sizeof (last));
+        for (i = 0; i < entities->number_of_sequence_items; i++)
+        {
+                last[entities->sequence[i].type] = entities->sequence[i].entity;
+        }
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        /* Any other line is the name of the first entity. */
+        have_name = (strcmp (temp_string, "0") != 0);
+        while ((have_name) || (!feof (fp->fp)))
+        {
+                /* Now follows a string containing the entity name, the
+                 * readers consume all lines up to and including the
+                 * group code 0 of the next entity. */
+                if (!have_name)
+                {
+                        dxf_read_line (temp_string, fp);
+                }
+                have_name = FALSE;
+                if ((strcmp (temp_string, "ENDSEC") == 0)
+                  || (strcmp (temp_string, "ENDBLK") == 0))
+                {
+                        break;
+                }
+                if (strcmp (temp_string, "SEQEND") == 0)
+                {
+                        /* The end of sequence marker carries no data
+                         * worth keeping. */
+                        dxf_entities_skip_entity (fp);
+                        polyline = NULL;
+                        last_vertex = NULL;
+                        skip_vertices = FALSE;
+                        continue;
+                }
+                type = dxf_entity_get_type_from_name (temp_string);
+                if ((type == VERTEX) && (skip_vertices))
+                {
+                        dxf_entities_skip_entity (fp);
+                        continue;
+                }
+                if ((type == VERTEX) && (polyline != NULL))
+                {
+                        DxfVertex *vertex = dxf_vertex_read (fp, dxf_vertex_init (dxf_vertex_new ()));
+                        if (vertex == NULL)
+                        {
+                                continue;
+                        }
+                        if (last_vertex == NULL)
+                        {
+                                polyline->vertices = vertex;
+                        }
+                        else
+                        {
+                                last_vertex->next = (struct DxfVertex *) vertex;
+                        }
+                        last_vertex = vertex;
+                        continue;
+                }
+                if ((!dxf_load_options_accept_entity_type (options, type))
+                  && (type != UNKNOWN_ENTITY))
+                {
+                        dxf_entities_skip_entity (fp);
+                        skip_vertices = (type == POLYLINE);
+                        continue;
+                }
+                input = NULL;
+                if ((type != UNKNOWN_ENTITY)
+                  && (dxf_entities_skip_layer (fp, options, &buffer,
+                  &buffer_size, &input)))
+                {
+                        skip_vertices = (type == POLYLINE);
+                        continue;
+                }
+                entity = dxf_entities_read_entity (fp, type);
+                if (entity == NULL)
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_SKIPPED_ENTITY,
+                          (_("Warning in %s () skipping %s entity in: %s in line: %d.\n")),
+                          __FUNCTION__, temp_string, fp->filename, fp->line_number);
+                        /* A replayed entity ends in the buffer. */
+                        dxf_entities_skip_entity (fp);
+                        dxf_entities_end_replay (fp, input);
+                        continue;
+                }
+                dxf_entities_end_replay (fp, input);
+                dxf_entities_link_entity (entities, type, entity, last);
+                if (dxf_entities_append_sequence_item (entities, type, entity) == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (buffer);
+                        return (NULL);
+                }
+                if ((options != NULL) && (options->layer_index != NULL))
+                {
+                        dxf_layer_index_add_entity (options->layer_index, type, entity);
+                }
+                if (type == POLYLINE)
+                {
+                        polyline = (DxfPolyline *) entity;
+                        last_vertex = (DxfVertex *) polyline->vertices;
+                        while ((last_vertex != NULL)
+                          && (last_vertex->next != NULL))
+                        {
+                                last_vertex = (DxfVertex *) last_vertex->next;
+                        }
+                }
+        }
+        free (buffer);
+#if !DXF_TRUSTED_INPUT
+        if (dxf_entities_validate (fp, entities) < 0)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_ERROR,
+                  DXF_DIAGNOSTIC_INVALID_ENTITY,
+                  (_("Error in %s () could not validate the entities read from: %s.\n")),
+                  __FUNCTION__, fp->filename);
+                return (NULL);
+        }
+#endif
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities);
+}
+
+
+/*!
+ * \brief Validate the geometry of the entities in a DXF entities
+ * section in a single pass.
+ *
+ * Missing points of \c LINE, \c CIRCLE and \c ARC entities are
+ * allocated and initialized, after this pass the unchecked getters
+ * of these entities can be used without dereferencing \c NULL
+ * pointers.\n
+ * \c CIRCLE and \c ARC entities with a radius which is not positive
+ * can not be repaired and are counted as invalid.\n
+ * Every repaired or invalid entity is reported to the diagnostics sink
+ * of \c fp.
+ *
+ * \return the number of invalid entities, \c 0 when all entities can
+ * be used with the unchecked getters, or \c -1 when an error occurred.
+ */
+int
+dxf_entities_validate
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device),
+                 * may be \c NULL. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPoint **points[2];
+        double radius;
+        int number_of_points;
+        int invalid;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        invalid = 0;
+        for (i = 0; i < entities->number_of_sequence_items; i++)
+        {
+                void *entity = entities->sequence[i].entity;
+
+                number_of_points = 0;
+                radius = 1.0;
+                switch (entities->sequence[i].type)
+                {
+                        case LINE:
+                                points[number_of_points++] = &((DxfLine *) entity)->p0;
+                                points[number_of_points++] = &((DxfLine *) entity)->p1;
+                                break;
+                        case CIRCLE:
+                                points[number_of_points++] = &((DxfCircle *) entity)->p0;
+                                radius = ((DxfCircle *) entity)->radius;
+                                break;
+                        case ARC:
+                                points[number_of_points++] = &((DxfArc *) entity)->p0;
+                                radius = ((DxfArc *) entity)->radius;
+                                break;
+                        default:
+                                continue;
+                }
+                for (j = 0; j < number_of_points; j++)
+                {
+                        if (*points[j] != NULL)
+                        {
+                                continue;
+                        }
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_MISSING_MEMBER,
+                          (_("Warning in %s () a NULL pointer was found in entity %d.\n")),
+                          __FUNCTION__, i);
+                        *points[j] = dxf_point_init (dxf_point_new ());
+                        if (*points[j] == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (-1);
+                        }
+                }
+                if (radius <= 0.0)
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_ERROR,
+                          DXF_DIAGNOSTIC_INVALID_ENTITY,
+                          (_("Error in %s () a radius which is not positive was found in entity %d.\n")),
+                          __FUNCTION__, i);
+                        invalid++;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (invalid);
+}
+
+
+/*!
+ * \brief Append an entity to the file order sequence of a DXF entities
+ * section.
+ *
+ * The entity is not added to the single linked list for it's type,
+ * this is left to the caller, as is adding the entity to a spatial
+ * index with dxf_spatial_index_insert_entity ().\n
+ * The sequence grows by doubling it's size, so appending is amortized
+ * O(1).
+ *
+ * \return a pointer to \c entities, or \c NULL when an error occurred.
+ */
+DxfEntities *
+dxf_entities_append_sequence_item
+(
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Pointer to the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (entity == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (entities->number_of_sequence_items >= entities->sequence_size)
+        {
+                DxfEntitiesSequenceItem *sequence;
+                int size;
+
+                size = (entities->sequence_size > 0) ? 2 * entities->sequence_size : 64;
+                sequence = realloc (entities->sequence, size * sizeof (DxfEntitiesSequenceItem));
+                if (sequence == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                entities->sequence = sequence;
+                entities->sequence_size = size;
+        }
+        entities->sequence[entities->number_of_sequence_items].type = type;
+        entities->sequence[entities->number_of_sequence_items].entity = entity;
+        entities->number_of_sequence_items++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities);
+}
+
+
+/*!
+ * \brief Get the number of entities in the file order sequence of a DXF
+ * entities section.
+ *
+ * \return the number of entities, or \c 0 when an error occurred.
+ */
+int
+dxf_entities_get_number_of_sequence_items
+(
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (entities->number_of_sequence_items);
+}
+
+
+/*!
+ * \brief Initialize a cursor for traversing the entities of a DXF
+ * entities section in file order.
+ *
+ * The cursor is not allocated, pass the address of a cursor on the
+ * stack (or embedded in another struct).
+ *
+ * \return a pointer to the cursor, or \c NULL when an error occurred.
+ */
+DxfEntitiesCursor *
+dxf_entities_cursor_init
+(
+        DxfEntitiesCursor *cursor,
+                /*!< Cursor, may be allocated on the stack. */
+        DxfEntities *entities
+                /*!< DXF entities section to be traversed. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (entities == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (cursor == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cursor->entities = (struct DxfEntities *) entities;
+        cursor->index = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cursor);
+}
+
+
+/*!
+ * \brief Get the next entity from a cursor traversing a DXF entities
+ * section in file order.
+ *
+ * The type of the returned entity is stored in \c type (if not
+ * \c NULL).
+ *
+ * \return a pointer to the next entity, or \c NULL when the end of the
+ * sequence was reached or an error occurred.
+ */
+void *
+dxf_entities_cursor_next
+(
+        DxfEntitiesCursor *cursor,
+                /*!< Cursor initialized by \c dxf_entities_cursor_init. */
+        DxfEntityType *type
+                /*!< Type of the returned entity (may be \c NULL). */
+)
+{
+        DxfEntities *entities;
+
+        /* Do some basic checks. */
+        if ((cursor == NULL) || (cursor->entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        entities = (DxfEntities *) cursor->entities;
+        if (cursor->index >= entities->number_of_sequence_items)
+        {
+                return (NULL);
+        }
+        if (type != NULL)
+        {
+                *type = entities->sequence[cursor->index].type;
+        }
+        return (entities->sequence[cursor->index++].entity);
+}
+
+
 /* EOF */
@@ -76,7 +76,7 @@
 #include "light.h"
 #include "line.h"
 #include "lwpolyline.h"
-//#include "mesh.h"
+#include "mesh.h"
 #include "mline.h"
 //#include "mleader.h"
 #include "mtext.h"
@@ -107,6 +107,21 @@ extern "C" {
 #endif
 
 
+/*!
+ * \brief Definition of an item in the file order sequence of a DXF
+ * entity container.
+ */
+typedef struct
+dxf_entities_sequence_item_struct
+{
+        DxfEntityType type;
+                /*!< Type of the entity, tells how to cast \c entity. */
+        void *entity;
+                /*!< Pointer to the entity, this entity is also a member
+                 * of the single linked list for it's type. */
+} DxfEntitiesSequenceItem;
+
+
 /*!
  * \brief Definition of a DXF entity container.
  */
@@ -131,7 +146,7 @@ dxf_entities_struct
     struct DxfLight *light_list;
     struct DxfLine *line_list;
     struct DxfLWPolyline *lw_polyline_list;
-    //struct DxfMesh *mesh_list;
+    struct DxfMesh *mesh_list;
     struct DxfMline *mline_list;
     //struct DxfMleader *mleader_list;
     //struct DxfMLeaderStyle *mleaderstyle_list;
@@ -157,14 +172,44 @@ dxf_entities_struct
     struct DxfViewport *viewport_list;
     //struct DxfWipeout *wipeout_list;
     //struct DxfXLine *xline_list;
+    DxfEntitiesSequenceItem *sequence;
+        /*!< All entities in the order they were read from file (or
+         * appended), one compact array for single pass traversals. */
+    int number_of_sequence_items;
+        /*!< Number of used items in \c sequence. */
+    int sequence_size;
+        /*!< Number of allocated items in \c sequence. */
 } DxfEntities;
 
 
+/*!
+ * \brief Definition of a cursor for traversing the file order sequence
+ * of a DXF entity container.
+ */
+typedef struct
+dxf_entities_cursor_struct
+{
+        struct DxfEntities *entities;
+                /*!< Pointer to the entity container being traversed. */
+        int index;
+                /*!< Index of the next item to be returned. */
+} DxfEntitiesCursor;
+
+
 DxfEntities *dxf_entities_new ();
 DxfEntities *dxf_entities_init (DxfEntities *entities);
 int dxf_entities_read_table (char *filename, FILE *fp, int line_number, char *dxf_entities_list, int acad_version_number);
 int dxf_entities_write_table (char *dxf_entities_list, int acad_version_number);
 int dxf_entities_free (DxfEntities *entities);
+DxfEntities *dxf_entities_read (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_write (DxfFile *fp, DxfEntities *entities);
+int dxf_entities_validate (DxfFile *fp, DxfEntities *entities);
+DxfEntities *dxf_entities_append_sequence_item (DxfEntities *entities, DxfEntityType type, void *entity);
+char *dxf_entity_get_layer (DxfEntityType type, void *entity);
+int dxf_entity_get_id_code (DxfEntityType type, void *entity);
+int dxf_entities_get_number_of_sequence_items (DxfEntities *entities);
+DxfEntitiesCursor *dxf_entities_cursor_init (DxfEntitiesCursor *cursor, DxfEntities *entities);
+void *dxf_entities_cursor_next (DxfEntitiesCursor *cursor, DxfEntityType *type);
 
 
 #ifdef __cplusplus
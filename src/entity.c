@@ -78,4 +78,107 @@ dxf_entity_skip
 }
 
 
+/*!
+ * \brief Lookup table for DXF entity names and their types.
+ */
+static const struct
+{
+        const char *name;
+                /*!< Entity name as found after a group code 0. */
+        DxfEntityType type;
+                /*!< Entity type. */
+}
+dxf_entity_names[] =
+{
+        {"3DFACE", DFACE},
+        {"3DSOLID", DSOLID},
+        {"ACAD_PROXY_ENTITY", ACADPROXYENTITY},
+        {"ACAD_TABLE", TABLE},
+        {"ARC", ARC},
+        {"ATTDEF", ATTDEF},
+        {"ATTRIB", ATTRIB},
+        {"BODY", BODY},
+        {"CIRCLE", CIRCLE},
+        {"DIMENSION", DIMENSION},
+        {"ELLIPSE", ELLIPSE},
+        {"HATCH", HATCH},
+        {"HELIX", HELIX},
+        {"IMAGE", IMAGE},
+        {"INSERT", INSERT},
+        {"LEADER", LEADER},
+        {"LIGHT", LIGHT},
+        {"LINE", LINE},
+        {"LWPOLYLINE", LWPOLYLINE},
+        {"MESH", MESH},
+        {"MLEADER", MLEADER},
+        {"MLEADERSTYLE", MLEADERSTYLE},
+        {"MLINE", MLINE},
+        {"MTEXT", MTEXT},
+        {"OLEFRAME", OLEFRAME},
+        {"OLE2FRAME", OLE2FRAME},
+        {"POINT", POINT},
+        {"POLYLINE", POLYLINE},
+        {"RAY", RAY},
+        {"REGION", REGION},
+        {"SECTION", SECTION},
+        {"SHAPE", SHAPE},
+        {"SOLID", SOLID},
+        {"SPLINE", SPLINE},
+        {"SUN", SUN},
+        {"SURFACE", SURFACE},
+        {"TEXT", TEXT},
+        {"TOLERANCE", TOLERANCE},
+        {"TRACE", TRACE},
+        {"UNDERLAY", UNDERLAY},
+        {"VERTEX", VERTEX},
+        {"VIEWPORT", VIEWPORT},
+        {"WIPEOUT", WIPEOUT},
+        {"XLINE", XLINE},
+        {NULL, UNKNOWN_ENTITY}
+};
+
+
+/*!
+ * \brief Get the entity type belonging to an entity name as found in a
+ * DXF file after a group code 0.
+ *
+ * \return the entity type, or \c UNKNOWN_ENTITY when the name is not
+ * known or an error occurred.
+ */
+DxfEntityType
+dxf_entity_get_type_from_name
+(
+        const char *dxf_entity_name
+                /*!< Name of the entity, for example "LINE". */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        if (dxf_entity_name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (UNKNOWN_ENTITY);
+        }
+        for (i = 0; dxf_entity_names[i].name != NULL; i++)
+        {
+                if (strcmp (dxf_entity_name, dxf_entity_names[i].name) == 0)
+                {
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+                        return (dxf_entity_names[i].type);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (UNKNOWN_ENTITY);
+}
+
+
 /* EOF */
@@ -72,6 +72,7 @@ dxf_entity_type
         MESH,
         MLEADER,
         MLEADERSTYLE,
+        MLINE,
         MTEXT,
         OLEFRAME,
         OLE2FRAME,
@@ -97,7 +98,12 @@ dxf_entity_type
 } DxfEntityType;
 
 
+#define DXF_NUMBER_OF_ENTITY_TYPES (XLINE + 1)
+        /*!< \brief Number of entity types in \c DxfEntityType. */
+
+
 int dxf_entity_skip (char *dxf_entity_name);
+DxfEntityType dxf_entity_get_type_from_name (const char *dxf_entity_name);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,820 @@
+/*!
+ * \file explode.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for exploding DXF block references (\c INSERT entities).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "explode.h"
+
+
+/*!
+ * \brief Compute the hash of a block name, block names are case
+ * insensitive.
+ */
+static unsigned int
+dxf_explode_hash
+(
+        const char *block_name
+                /*!< Name of the block. */
+)
+{
+        unsigned int hash = 2166136261u;
+
+        while (*block_name != '\0')
+        {
+                hash ^= (unsigned int) toupper ((unsigned char) *block_name);
+                hash *= 16777619u;
+                block_name++;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Find the index of a block in an explode context.
+ *
+ * \return the index of the block, or \c -1 when there is no block with
+ * that name.
+ */
+static int
+dxf_explode_find_index
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        const char *block_name
+                /*!< Name of the block. */
+)
+{
+        unsigned int mask;
+        unsigned int slot;
+
+        mask = (unsigned int) explode->lookup_size - 1;
+        slot = dxf_explode_hash (block_name) & mask;
+        while (explode->lookup[slot] != -1)
+        {
+                if (strcasecmp (explode->blocks[explode->lookup[slot]].block->block_name, block_name) == 0)
+                {
+                        return (explode->lookup[slot]);
+                }
+                slot = (slot + 1) & mask;
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Allocate memory for an explode context over a single linked
+ * list of DXF \c BLOCK entities.
+ *
+ * The blocks are not copied and have to outlive the context, when
+ * several blocks have the same name the first one is used.
+ *
+ * \return a pointer to the explode context, or \c NULL when no memory
+ * could be allocated.
+ */
+DxfExplode *
+dxf_explode_new
+(
+        DxfBlock *blocks,
+                /*!< a pointer to a single linked list of DXF \c BLOCK
+                 * entities, may be \c NULL. */
+        double tolerance,
+                /*!< Chord height tolerance of the block geometry,
+                 * \c 0.0 to only use \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per arc of the block
+                 * geometry, \c 0 for no limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExplode *explode = NULL;
+        DxfBlock *iter;
+        unsigned int mask;
+        unsigned int slot;
+        int n;
+        int i;
+
+        explode = calloc (1, sizeof (DxfExplode));
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        explode->tolerance = tolerance;
+        explode->max_segments = max_segments;
+        n = 0;
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                n++;
+        }
+        /* Keep the hash table at most half full. */
+        explode->lookup_size = 16;
+        while (explode->lookup_size < 2 * n)
+        {
+                explode->lookup_size *= 2;
+        }
+        explode->blocks = malloc ((n + 1) * sizeof (DxfExplodeBlock));
+        explode->lookup = malloc (explode->lookup_size * sizeof (int));
+        if ((explode->blocks == NULL) || (explode->lookup == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_explode_free (explode);
+                return (NULL);
+        }
+        for (i = 0; i < explode->lookup_size; i++)
+        {
+                explode->lookup[i] = -1;
+        }
+        mask = (unsigned int) explode->lookup_size - 1;
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                if ((iter->block_name == NULL)
+                  || (dxf_explode_find_index (explode, iter->block_name) != -1))
+                {
+                        continue;
+                }
+                i = explode->number_of_blocks;
+                explode->blocks[i].block = iter;
+                explode->blocks[i].geometry = NULL;
+                explode->blocks[i].visiting = FALSE;
+                slot = dxf_explode_hash (iter->block_name) & mask;
+                while (explode->lookup[slot] != -1)
+                {
+                        slot = (slot + 1) & mask;
+                }
+                explode->lookup[slot] = i;
+                explode->number_of_blocks++;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (explode);
+}
+
+
+/*!
+ * \brief Free the allocated memory for an explode context and the
+ * cached block geometry.
+ *
+ * The blocks themselves are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_free
+(
+        DxfExplode *explode
+                /*!< Explode context. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        if (explode == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < explode->number_of_blocks; i++)
+        {
+                if (explode->blocks[i].geometry != NULL)
+                {
+                        dxf_tessellation_free (explode->blocks[i].geometry);
+                }
+        }
+        free (explode->blocks);
+        free (explode->lookup);
+        free (explode);
+        explode = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find a block definition by name.
+ *
+ * \return a pointer to the block, or \c NULL when there is no block
+ * with that name.
+ */
+DxfBlock *
+dxf_explode_find_block
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        const char *block_name
+                /*!< Name of the block, case insensitive. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_explode_find_index (explode, block_name);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((i == -1) ? NULL : explode->blocks[i].block);
+}
+
+
+/*!
+ * \brief Find the index of a block definition by name.
+ *
+ * The index refers to the \c blocks array of the explode context.
+ *
+ * \return the index of the block, or \c -1 when there is no block with
+ * that name or an error occurred.
+ */
+int
+dxf_explode_find_block_index
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        const char *block_name
+                /*!< Name of the block, case insensitive. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((explode == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_explode_find_index (explode, block_name));
+}
+
+
+/*!
+ * \brief Get the cached geometry of the block with index \c i,
+ * tessellating the block on first use.
+ *
+ * Entities which can not be tessellated are skipped.
+ *
+ * \return the geometry, or \c NULL when no memory could be allocated.
+ */
+static DxfTessellation *
+dxf_explode_get_geometry
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        int i
+                /*!< Index of the block. */
+)
+{
+        DxfEntities *entities;
+        int j;
+
+        if (explode->blocks[i].geometry != NULL)
+        {
+                return (explode->blocks[i].geometry);
+        }
+        explode->blocks[i].geometry = dxf_tessellation_new ();
+        if (explode->blocks[i].geometry == NULL)
+        {
+                return (NULL);
+        }
+        entities = (DxfEntities *) explode->blocks[i].block->entities;
+        if (entities == NULL)
+        {
+                return (explode->blocks[i].geometry);
+        }
+        for (j = 0; j < entities->number_of_sequence_items; j++)
+        {
+                if (entities->sequence[j].type != INSERT)
+                {
+                        dxf_tessellation_add_entity (explode->blocks[i].geometry,
+                          entities->sequence[j].type,
+                          entities->sequence[j].entity,
+                          explode->tolerance, explode->max_segments);
+                }
+        }
+        return (explode->blocks[i].geometry);
+}
+
+
+/*!
+ * \brief Get the tessellated geometry of a block in block coordinates.
+ *
+ * The geometry excludes nested block references, it is computed on the
+ * first request and owned by the explode context.
+ *
+ * \return the geometry, or \c NULL when there is no block with that
+ * name or an error occurred.
+ */
+DxfTessellation *
+dxf_explode_get_block_geometry
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        const char *block_name
+                /*!< Name of the block, case insensitive. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_explode_find_index (explode, block_name);
+        if (i == -1)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_explode_get_geometry (explode, i));
+}
+
+
+/*!
+ * \brief Compute the matrix transforming block coordinates to the WCS
+ * for one cell of a block reference.
+ *
+ * The block is moved from it's base point to the origin, scaled, offset
+ * to the column and row of the cell, rotated, moved to the insertion
+ * point and transformed from the OCS of the insert to the WCS.\n
+ * A scale factor of zero is treated as unset.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_explode_get_insert_matrix
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfBlock *block,
+                /*!< a pointer to the DXF \c BLOCK referenced by the
+                 * insert, may be \c NULL for a base point at the
+                 * origin. */
+        int column,
+                /*!< Column of the cell, \c 0 for a plain insert. */
+        int row,
+                /*!< Row of the cell, \c 0 for a plain insert. */
+        double *matrix
+                /*!< Row major 3 x 4 matrix receiving the transform. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double base[3];
+        double scale[3];
+        double cos_rotation;
+        double sin_rotation;
+        double ox;
+        double oy;
+        double qx;
+        double qy;
+        double qz;
+        int i;
+
+        /* Do some basic checks. */
+        if ((insert == NULL) || (matrix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (insert->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((column < 0) || (row < 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative column or row was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_axes (insert->extr_x0, insert->extr_y0, insert->extr_z0, ax, ay, az);
+        base[0] = ((block != NULL) && (block->p0 != NULL)) ? block->p0->x0 : 0.0;
+        base[1] = ((block != NULL) && (block->p0 != NULL)) ? block->p0->y0 : 0.0;
+        base[2] = ((block != NULL) && (block->p0 != NULL)) ? block->p0->z0 : 0.0;
+        scale[0] = (insert->rel_x_scale != 0.0) ? insert->rel_x_scale : 1.0;
+        scale[1] = (insert->rel_y_scale != 0.0) ? insert->rel_y_scale : 1.0;
+        scale[2] = (insert->rel_z_scale != 0.0) ? insert->rel_z_scale : 1.0;
+        cos_rotation = cos (insert->rot_angle * M_PI / 180.0);
+        sin_rotation = sin (insert->rot_angle * M_PI / 180.0);
+        ox = column * insert->column_spacing;
+        oy = row * insert->row_spacing;
+        /* Insertion point of the cell in the OCS. */
+        qx = insert->p0->x0 + ox * cos_rotation - oy * sin_rotation;
+        qy = insert->p0->y0 + ox * sin_rotation + oy * cos_rotation;
+        qz = insert->p0->z0;
+        for (i = 0; i < 3; i++)
+        {
+                matrix[4 * i] = (ax[i] * cos_rotation + ay[i] * sin_rotation) * scale[0];
+                matrix[4 * i + 1] = (ay[i] * cos_rotation - ax[i] * sin_rotation) * scale[1];
+                matrix[4 * i + 2] = az[i] * scale[2];
+                matrix[4 * i + 3] = ax[i] * qx + ay[i] * qy + az[i] * qz
+                  - matrix[4 * i] * base[0]
+                  - matrix[4 * i + 1] * base[1]
+                  - matrix[4 * i + 2] * base[2];
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Multiply two row major 3 x 4 affine matrices.
+ *
+ * The result applies \c b first and \c a second, it may be stored in
+ * \c a or \c b.
+ */
+void
+dxf_explode_multiply_matrix
+(
+        const double *a,
+                /*!< Outer matrix. */
+        const double *b,
+                /*!< Inner matrix. */
+        double *matrix
+                /*!< Row major 3 x 4 matrix receiving the product. */
+)
+{
+        double m[12];
+        int i;
+
+        for (i = 0; i < 3; i++)
+        {
+                m[4 * i] = a[4 * i] * b[0] + a[4 * i + 1] * b[4] + a[4 * i + 2] * b[8];
+                m[4 * i + 1] = a[4 * i] * b[1] + a[4 * i + 1] * b[5] + a[4 * i + 2] * b[9];
+                m[4 * i + 2] = a[4 * i] * b[2] + a[4 * i + 1] * b[6] + a[4 * i + 2] * b[10];
+                m[4 * i + 3] = a[4 * i] * b[3] + a[4 * i + 1] * b[7] + a[4 * i + 2] * b[11] + a[4 * i + 3];
+        }
+        memcpy (matrix, m, sizeof (m));
+}
+
+
+/*!
+ * \brief Explode a block reference recursively, either into a
+ * tessellation or through a callback.
+ *
+ * References to unknown blocks, circular references and references
+ * nested too deep are reported and skipped, the other entities are
+ * still exploded.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a
+ * reference was skipped or an error occurred.
+ */
+static int
+dxf_explode_walk
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        DxfInsert *insert,
+                /*!< Block reference. */
+        const double *parent,
+                /*!< Matrix of the parent block, \c NULL for the
+                 * identity. */
+        int depth,
+                /*!< Nesting depth of the reference. */
+        DxfExplodeCallback callback,
+                /*!< Callback, used when \c tessellation is \c NULL. */
+        void *data,
+                /*!< User data passed to \c callback. */
+        DxfTessellation *tessellation,
+                /*!< Tessellation receiving the geometry, or \c NULL. */
+        int *stopped
+                /*!< Set when the callback stopped exploding. */
+)
+{
+        DxfExplodeBlock *entry;
+        DxfEntities *entities;
+        DxfTessellation *geometry = NULL;
+        double matrix[12];
+        int result = EXIT_SUCCESS;
+        int columns;
+        int rows;
+        int column;
+        int row;
+        int i;
+        int j;
+
+        if (insert->block_name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        i = dxf_explode_find_index (explode, insert->block_name);
+        if (i == -1)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block %s was not found.\n")),
+                  __FUNCTION__, insert->block_name);
+                return (EXIT_FAILURE);
+        }
+        entry = &explode->blocks[i];
+        if (entry->visiting)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block %s references itself.\n")),
+                  __FUNCTION__, insert->block_name);
+                return (EXIT_FAILURE);
+        }
+        if (depth >= DXF_EXPLODE_MAX_DEPTH)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block references are nested too deep.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tessellation != NULL)
+        {
+                geometry = dxf_explode_get_geometry (explode, i);
+                if (geometry == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        entities = (DxfEntities *) entry->block->entities;
+        columns = (insert->columns > 1) ? insert->columns : 1;
+        rows = (insert->rows > 1) ? insert->rows : 1;
+        entry->visiting = TRUE;
+        for (row = 0; (row < rows) && !*stopped; row++)
+        {
+                for (column = 0; (column < columns) && !*stopped; column++)
+                {
+                        if (dxf_explode_get_insert_matrix (insert,
+                          entry->block, column, row, matrix) == EXIT_FAILURE)
+                        {
+                                entry->visiting = FALSE;
+                                return (EXIT_FAILURE);
+                        }
+                        if (parent != NULL)
+                        {
+                                dxf_explode_multiply_matrix (parent, matrix, matrix);
+                        }
+                        if ((tessellation != NULL)
+                          && (dxf_tessellation_append (tessellation,
+                          geometry, matrix) == EXIT_FAILURE))
+                        {
+                                entry->visiting = FALSE;
+                                return (EXIT_FAILURE);
+                        }
+                        if (entities == NULL)
+                        {
+                                continue;
+                        }
+                        for (j = 0; (j < entities->number_of_sequence_items) && !*stopped; j++)
+                        {
+                                if (entities->sequence[j].type == INSERT)
+                                {
+                                        if (dxf_explode_walk (explode,
+                                          (DxfInsert *) entities->sequence[j].entity,
+                                          matrix, depth + 1, callback, data,
+                                          tessellation, stopped) == EXIT_FAILURE)
+                                        {
+                                                result = EXIT_FAILURE;
+                                        }
+                                }
+                                else if ((tessellation == NULL)
+                                  && (callback (entities->sequence[j].type,
+                                  entities->sequence[j].entity, matrix, data) != 0))
+                                {
+                                        *stopped = TRUE;
+                                }
+                        }
+                }
+        }
+        entry->visiting = FALSE;
+        return (result);
+}
+
+
+/*!
+ * \brief Explode a block reference, passing every entity of the
+ * referenced block with it's transform to a callback.
+ *
+ * Nested block references are exploded recursively, every cell of a
+ * \c MINSERT array is exploded separately.\n
+ * The entities are passed unchanged in block coordinates, together
+ * with the matrix transforming them to the WCS, so no entity is
+ * copied.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a nested
+ * reference could not be resolved or an error occurred.
+ */
+int
+dxf_explode_insert
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        const double *matrix,
+                /*!< Row major 3 x 4 matrix applied after the insert
+                 * transform, \c NULL for the identity. */
+        DxfExplodeCallback callback,
+                /*!< Callback receiving the entities. */
+        void *data
+                /*!< User data passed to \c callback. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int stopped = FALSE;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (insert == NULL) || (callback == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_explode_walk (explode, insert, matrix, 0,
+          callback, data, NULL, &stopped));
+}
+
+
+/*!
+ * \brief Explode a block reference into a tessellation in the WCS.
+ *
+ * The cached geometry of every referenced block is appended once per
+ * reference and per cell of a \c MINSERT array.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a nested
+ * reference could not be resolved or an error occurred.
+ */
+int
+dxf_explode_insert_geometry
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        const double *matrix,
+                /*!< Row major 3 x 4 matrix applied after the insert
+                 * transform, \c NULL for the identity. */
+        DxfTessellation *tessellation
+                /*!< Tessellation receiving the geometry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int stopped = FALSE;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (insert == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_explode_walk (explode, insert, matrix, 0,
+          NULL, NULL, tessellation, &stopped));
+}
+
+
+/*!
+ * \brief Tessellate all entities of a DXF entities section into the
+ * WCS, exploding block references.
+ *
+ * Entities which can not be tessellated are skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a block
+ * reference could not be resolved or an error occurred.
+ */
+int
+dxf_explode_entities_geometry
+(
+        DxfExplode *explode,
+                /*!< Explode context. */
+        DxfEntities *entities,
+                /*!< DXF entities section. */
+        DxfTessellation *tessellation
+                /*!< Tessellation receiving the geometry. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int result = EXIT_SUCCESS;
+        int i;
+
+        /* Do some basic checks. */
+        if ((explode == NULL) || (entities == NULL) || (tessellation == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < entities->number_of_sequence_items; i++)
+        {
+                if (entities->sequence[i].type == INSERT)
+                {
+                        if (dxf_explode_insert_geometry (explode,
+                          (DxfInsert *) entities->sequence[i].entity,
+                          NULL, tessellation) == EXIT_FAILURE)
+                        {
+                                result = EXIT_FAILURE;
+                        }
+                }
+                else
+                {
+                        dxf_tessellation_add_entity (tessellation,
+                          entities->sequence[i].type,
+                          entities->sequence[i].entity,
+                          explode->tolerance, explode->max_segments);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
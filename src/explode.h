@@ -0,0 +1,144 @@
+/*!
+ * \file explode.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for exploding DXF block references (\c INSERT entities).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_EXPLODE_H
+#define LIBDXF_SRC_EXPLODE_H
+
+
+#include <ctype.h>
+#include <math.h>
+#include <string.h>
+#include <strings.h>
+#include "global.h"
+#include "block.h"
+#include "entities.h"
+#include "entity.h"
+#include "insert.h"
+#include "tessellate.h"
+#include "util.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_EXPLODE_MAX_DEPTH 64
+        /*!< \brief Maximum nesting depth of block references. */
+
+
+/*!
+ * \brief A block definition known to an explode context.
+ */
+typedef struct
+dxf_explode_block_struct
+{
+        DxfBlock *block;
+                /*!< Block definition. */
+        DxfTessellation *geometry;
+                /*!< Tessellated curves of the block in block
+                 * coordinates, excluding nested block references,
+                 * \c NULL until first requested. */
+        int visiting;
+                /*!< Set while the block is being exploded, to detect
+                 * circular references. */
+} DxfExplodeBlock;
+
+
+/*!
+ * \brief Context for exploding block references.
+ *
+ * Blocks are looked up by name in a hash table, the tessellated
+ * geometry of every block is computed once and reused for all the
+ * references to it.
+ */
+typedef struct
+dxf_explode_struct
+{
+        DxfExplodeBlock *blocks;
+                /*!< Block definitions. */
+        int number_of_blocks;
+                /*!< Number of block definitions. */
+        int *lookup;
+                /*!< Open addressing hash table of indices into
+                 * \c blocks, \c -1 for an empty slot. */
+        int lookup_size;
+                /*!< Number of slots in \c lookup, a power of 2. */
+        double tolerance;
+                /*!< Chord height tolerance of the block geometry. */
+        int max_segments;
+                /*!< Maximum number of segments per arc of the block
+                 * geometry, \c 0 for no limit. */
+} DxfExplode;
+
+
+/*!
+ * \brief Callback receiving the entities of an exploded block
+ * reference.
+ *
+ * \c matrix is the row major 3 x 4 matrix transforming the block
+ * coordinates of \c entity to the WCS.
+ *
+ * \return \c 0 to continue, any other value to stop exploding.
+ */
+typedef int (*DxfExplodeCallback)
+(
+        DxfEntityType type,
+        void *entity,
+        const double *matrix,
+        void *data
+);
+
+
+DxfExplode *dxf_explode_new (DxfBlock *blocks, double tolerance, int max_segments);
+int dxf_explode_free (DxfExplode *explode);
+DxfBlock *dxf_explode_find_block (DxfExplode *explode, const char *block_name);
+int dxf_explode_find_block_index (DxfExplode *explode, const char *block_name);
+DxfTessellation *dxf_explode_get_block_geometry (DxfExplode *explode, const char *block_name);
+int dxf_explode_get_insert_matrix (DxfInsert *insert, DxfBlock *block, int column, int row, double *matrix);
+void dxf_explode_multiply_matrix (const double *a, const double *b, double *matrix);
+int dxf_explode_insert (DxfExplode *explode, DxfInsert *insert, const double *matrix, DxfExplodeCallback callback, void *data);
+int dxf_explode_insert_geometry (DxfExplode *explode, DxfInsert *insert, const double *matrix, DxfTessellation *tessellation);
+int dxf_explode_entities_geometry (DxfExplode *explode, DxfEntities *entities, DxfTessellation *tessellation);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_EXPLODE_H */
+
+
+/* EOF */
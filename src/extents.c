@@ -0,0 +1,1631 @@
+/*!
+ * \file extents.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF bounding boxes (extents).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <ctype.h>
+#include <strings.h>
+#include "extents.h"
+#include "3dface.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "entities.h"
+#include "hatch.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "mesh.h"
+#include "mtext.h"
+#include "point.h"
+#include "polyline.h"
+#include "solid.h"
+#include "spline.h"
+#include "text.h"
+#include "trace.h"
+#include "vertex.h"
+
+
+/*!
+ * \brief Make a bounding box empty.
+ *
+ * \return a pointer to \c extents, or \c NULL when an error occurred.
+ */
+DxfExtents *
+dxf_extents_set_empty
+(
+        DxfExtents *extents
+                /*!< Bounding box. */
+)
+{
+        /* Do some basic checks. */
+        if (extents == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        extents->min_x = DBL_MAX;
+        extents->min_y = DBL_MAX;
+        extents->min_z = DBL_MAX;
+        extents->max_x = -DBL_MAX;
+        extents->max_y = -DBL_MAX;
+        extents->max_z = -DBL_MAX;
+        return (extents);
+}
+
+
+/*!
+ * \brief Test if a bounding box is empty.
+ *
+ * \return \c TRUE when the box is empty or \c NULL, \c FALSE
+ * otherwise.
+ */
+int
+dxf_extents_is_empty
+(
+        DxfExtents *extents
+                /*!< Bounding box. */
+)
+{
+        if (extents == NULL)
+        {
+                return (TRUE);
+        }
+        return ((extents->min_x > extents->max_x)
+          || (extents->min_y > extents->max_y)
+          || (extents->min_z > extents->max_z));
+}
+
+
+/*!
+ * \brief Grow a bounding box to include a point.
+ *
+ * \return a pointer to \c extents, or \c NULL when an error occurred.
+ */
+DxfExtents *
+dxf_extents_add_point
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z
+                /*!< Z-value of the point. */
+)
+{
+        /* Do some basic checks. */
+        if (extents == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (x < extents->min_x) extents->min_x = x;
+        if (y < extents->min_y) extents->min_y = y;
+        if (z < extents->min_z) extents->min_z = z;
+        if (x > extents->max_x) extents->max_x = x;
+        if (y > extents->max_y) extents->max_y = y;
+        if (z > extents->max_z) extents->max_z = z;
+        return (extents);
+}
+
+
+/*!
+ * \brief Grow a bounding box to include another bounding box.
+ *
+ * \return a pointer to \c extents, or \c NULL when an error occurred.
+ */
+DxfExtents *
+dxf_extents_add_extents
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        DxfExtents *other
+                /*!< Bounding box to be included. */
+)
+{
+        /* Do some basic checks. */
+        if ((extents == NULL) || (other == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (dxf_extents_is_empty (other))
+        {
+                return (extents);
+        }
+        dxf_extents_add_point (extents, other->min_x, other->min_y, other->min_z);
+        dxf_extents_add_point (extents, other->max_x, other->max_y, other->max_z);
+        return (extents);
+}
+
+
+/*!
+ * \brief Test if two bounding boxes intersect, touching boxes
+ * intersect.
+ *
+ * \return \c TRUE when the boxes intersect, \c FALSE otherwise.
+ */
+int
+dxf_extents_intersect
+(
+        DxfExtents *a,
+                /*!< First bounding box. */
+        DxfExtents *b
+                /*!< Second bounding box. */
+)
+{
+        if ((a == NULL) || (b == NULL))
+        {
+                return (FALSE);
+        }
+        return ((a->min_x <= b->max_x) && (b->min_x <= a->max_x)
+          && (a->min_y <= b->max_y) && (b->min_y <= a->max_y)
+          && (a->min_z <= b->max_z) && (b->min_z <= a->max_z));
+}
+
+
+/*!
+ * \brief Grow a bounding box to include a point given in an OCS.
+ */
+static void
+dxf_extents_add_ocs_point
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double ax[3],
+                /*!< OCS X-axis in WCS. */
+        double ay[3],
+                /*!< OCS Y-axis in WCS. */
+        double az[3],
+                /*!< OCS Z-axis in WCS. */
+        double x,
+                /*!< X-value of the point in the OCS. */
+        double y,
+                /*!< Y-value of the point in the OCS. */
+        double z
+                /*!< Z-value of the point in the OCS. */
+)
+{
+        dxf_extents_add_point (extents,
+          x * ax[0] + y * ay[0] + z * az[0],
+          x * ax[1] + y * ay[1] + z * az[1],
+          x * ax[2] + y * ay[2] + z * az[2]);
+}
+
+
+/*!
+ * \brief Grow a bounding box to include an elliptical arc.
+ *
+ * The arc is the set of points <tt>c + cos (t) u + sin (t) v</tt> for
+ * \c t from \c start to <tt>start + sweep</tt>, all in WCS.\n
+ * Besides the end points only the parameters where a coordinate reaches
+ * an extreme value, <tt>t = atan2 (v[i], u[i])</tt> and that value plus
+ * pi, are evaluated.
+ */
+static void
+dxf_extents_add_elliptical_arc
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double c[3],
+                /*!< Center point in WCS. */
+        double u[3],
+                /*!< Vector from the center to the point at parameter
+                 * 0. */
+        double v[3],
+                /*!< Vector from the center to the point at parameter
+                 * pi / 2. */
+        double start,
+                /*!< Start parameter in radians. */
+        double sweep
+                /*!< Sweep in radians, in the range (0, 2 pi]. */
+)
+{
+        double t;
+        double dt;
+        int i;
+        int j;
+
+        dxf_extents_add_point (extents,
+          c[0] + cos (start) * u[0] + sin (start) * v[0],
+          c[1] + cos (start) * u[1] + sin (start) * v[1],
+          c[2] + cos (start) * u[2] + sin (start) * v[2]);
+        dxf_extents_add_point (extents,
+          c[0] + cos (start + sweep) * u[0] + sin (start + sweep) * v[0],
+          c[1] + cos (start + sweep) * u[1] + sin (start + sweep) * v[1],
+          c[2] + cos (start + sweep) * u[2] + sin (start + sweep) * v[2]);
+        for (i = 0; i < 3; i++)
+        {
+                if ((u[i] == 0.0) && (v[i] == 0.0))
+                {
+                        continue;
+                }
+                for (j = 0; j < 2; j++)
+                {
+                        t = atan2 (v[i], u[i]) + j * M_PI;
+                        dt = fmod (t - start, 2.0 * M_PI);
+                        if (dt < 0.0)
+                        {
+                                dt += 2.0 * M_PI;
+                        }
+                        if (dt <= sweep)
+                        {
+                                dxf_extents_add_point (extents,
+                                  c[0] + cos (t) * u[0] + sin (t) * v[0],
+                                  c[1] + cos (t) * u[1] + sin (t) * v[1],
+                                  c[2] + cos (t) * u[2] + sin (t) * v[2]);
+                        }
+                }
+        }
+}
+
+
+/*!
+ * \brief Grow a bounding box to include a circular arc lying in the XY
+ * plane of an OCS.
+ *
+ * Angles are in radians, the arc runs counterclockwise from
+ * \c start_angle to \c end_angle, equal angles describe a full circle.
+ */
+static void
+dxf_extents_add_ocs_arc
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double ax[3],
+                /*!< OCS X-axis in WCS. */
+        double ay[3],
+                /*!< OCS Y-axis in WCS. */
+        double az[3],
+                /*!< OCS Z-axis in WCS. */
+        double x,
+                /*!< X-value of the center point in the OCS. */
+        double y,
+                /*!< Y-value of the center point in the OCS. */
+        double z,
+                /*!< Z-value of the center point in the OCS. */
+        double radius,
+                /*!< Radius. */
+        double start_angle,
+                /*!< Start angle in radians. */
+        double end_angle
+                /*!< End angle in radians. */
+)
+{
+        double c[3];
+        double u[3];
+        double v[3];
+        double sweep;
+        int i;
+
+        for (i = 0; i < 3; i++)
+        {
+                c[i] = x * ax[i] + y * ay[i] + z * az[i];
+                u[i] = radius * ax[i];
+                v[i] = radius * ay[i];
+        }
+        sweep = fmod (end_angle - start_angle, 2.0 * M_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += 2.0 * M_PI;
+        }
+        dxf_extents_add_elliptical_arc (extents, c, u, v, start_angle, sweep);
+}
+
+
+/*!
+ * \brief Grow a bounding box to include a polyline segment with a
+ * bulge, lying in the XY plane of an OCS.
+ *
+ * The bulge is the tangent of a quarter of the included angle, a
+ * negative bulge runs clockwise, a zero bulge is a straight segment.
+ */
+static void
+dxf_extents_add_ocs_bulge
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double ax[3],
+                /*!< OCS X-axis in WCS. */
+        double ay[3],
+                /*!< OCS Y-axis in WCS. */
+        double az[3],
+                /*!< OCS Z-axis in WCS. */
+        double x0,
+                /*!< X-value of the start point in the OCS. */
+        double y0,
+                /*!< Y-value of the start point in the OCS. */
+        double x1,
+                /*!< X-value of the end point in the OCS. */
+        double y1,
+                /*!< Y-value of the end point in the OCS. */
+        double z,
+                /*!< Elevation in the OCS. */
+        double bulge
+                /*!< Bulge of the segment. */
+)
+{
+        double chord;
+        double sagitta_factor;
+        double radius;
+        double cx;
+        double cy;
+        double start_angle;
+        double end_angle;
+
+        dxf_extents_add_ocs_point (extents, ax, ay, az, x0, y0, z);
+        dxf_extents_add_ocs_point (extents, ax, ay, az, x1, y1, z);
+        chord = sqrt ((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0));
+        if ((bulge == 0.0) || (chord == 0.0))
+        {
+                return;
+        }
+        /* Distance from the chord midpoint to the center, relative to
+         * the half chord, is (1 - b^2) / (2 b). */
+        sagitta_factor = (1.0 - bulge * bulge) / (4.0 * bulge);
+        cx = 0.5 * (x0 + x1) - sagitta_factor * (y1 - y0);
+        cy = 0.5 * (y0 + y1) + sagitta_factor * (x1 - x0);
+        radius = chord * (1.0 + bulge * bulge) / (4.0 * fabs (bulge));
+        start_angle = atan2 (y0 - cy, x0 - cx);
+        end_angle = atan2 (y1 - cy, x1 - cx);
+        if (bulge > 0.0)
+        {
+                dxf_extents_add_ocs_arc (extents, ax, ay, az, cx, cy, z,
+                  radius, start_angle, end_angle);
+        }
+        else
+        {
+                dxf_extents_add_ocs_arc (extents, ax, ay, az, cx, cy, z,
+                  radius, end_angle, start_angle);
+        }
+}
+
+
+/*!
+ * \brief Grow a bounding box to include a rotated rectangle lying in the
+ * XY plane of an OCS.
+ *
+ * The rectangle spans \c (dx, dy) to <tt>(dx + width, dy + height)</tt>
+ * relative to the reference point before rotation.
+ */
+static void
+dxf_extents_add_ocs_rectangle
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double ax[3],
+                /*!< OCS X-axis in WCS. */
+        double ay[3],
+                /*!< OCS Y-axis in WCS. */
+        double az[3],
+                /*!< OCS Z-axis in WCS. */
+        double x,
+                /*!< X-value of the reference point in the OCS. */
+        double y,
+                /*!< Y-value of the reference point in the OCS. */
+        double z,
+                /*!< Z-value of the reference point in the OCS. */
+        double dx,
+                /*!< X-offset of the rectangle. */
+        double dy,
+                /*!< Y-offset of the rectangle. */
+        double width,
+                /*!< Width of the rectangle. */
+        double height,
+                /*!< Height of the rectangle. */
+        double rotation
+                /*!< Rotation angle in radians. */
+)
+{
+        double cos_rotation;
+        double sin_rotation;
+        double px;
+        double py;
+        int i;
+
+        cos_rotation = cos (rotation);
+        sin_rotation = sin (rotation);
+        for (i = 0; i < 4; i++)
+        {
+                px = dx + ((i & 1) ? width : 0.0);
+                py = dy + ((i & 2) ? height : 0.0);
+                dxf_extents_add_ocs_point (extents, ax, ay, az,
+                  x + px * cos_rotation - py * sin_rotation,
+                  y + px * sin_rotation + py * cos_rotation,
+                  z);
+        }
+}
+
+
+/*!
+ * \brief Grow a bounding box with the extrusion of it's content along
+ * the OCS Z-axis by a thickness.
+ */
+static void
+dxf_extents_add_thickness
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double az[3],
+                /*!< OCS Z-axis in WCS. */
+        double thickness
+                /*!< Thickness. */
+)
+{
+        DxfExtents extruded;
+
+        if ((thickness == 0.0) || dxf_extents_is_empty (extents))
+        {
+                return;
+        }
+        extruded.min_x = extents->min_x + thickness * az[0];
+        extruded.min_y = extents->min_y + thickness * az[1];
+        extruded.min_z = extents->min_z + thickness * az[2];
+        extruded.max_x = extents->max_x + thickness * az[0];
+        extruded.max_y = extents->max_y + thickness * az[1];
+        extruded.max_z = extents->max_z + thickness * az[2];
+        dxf_extents_add_extents (extents, &extruded);
+}
+
+
+/*!
+ * \brief Grow a bounding box with the vertices of a list of vertices
+ * with bulges, lying in the XY plane of an OCS.
+ */
+static void
+dxf_extents_add_ocs_vertices
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double ax[3],
+                /*!< OCS X-axis in WCS. */
+        double ay[3],
+                /*!< OCS Y-axis in WCS. */
+        double az[3],
+                /*!< OCS Z-axis in WCS. */
+        DxfVertex *vertices,
+                /*!< First vertex. */
+        double z,
+                /*!< Elevation in the OCS. */
+        int closed
+                /*!< The last vertex connects to the first vertex. */
+)
+{
+        DxfVertex *vertex;
+        DxfVertex *next;
+
+        for (vertex = vertices; vertex != NULL; vertex = next)
+        {
+                next = (DxfVertex *) vertex->next;
+                if (vertex->p0 == NULL)
+                {
+                        continue;
+                }
+                if ((next == NULL) && closed)
+                {
+                        next = vertices;
+                        if ((next != vertex) && (next->p0 != NULL))
+                        {
+                                dxf_extents_add_ocs_bulge (extents, ax, ay, az,
+                                  vertex->p0->x0, vertex->p0->y0,
+                                  next->p0->x0, next->p0->y0,
+                                  z, vertex->bulge);
+                        }
+                        break;
+                }
+                if ((next != NULL) && (next->p0 != NULL))
+                {
+                        dxf_extents_add_ocs_bulge (extents, ax, ay, az,
+                          vertex->p0->x0, vertex->p0->y0,
+                          next->p0->x0, next->p0->y0,
+                          z, vertex->bulge);
+                }
+                else
+                {
+                        dxf_extents_add_ocs_point (extents, ax, ay, az,
+                          vertex->p0->x0, vertex->p0->y0, z);
+                }
+        }
+}
+
+
+/*!
+ * \brief Grow a bounding box with the boundary paths of a \c HATCH
+ * entity.
+ *
+ * Arc and ellipse edges which are not counterclockwise have their
+ * angles mirrored, spline edges contribute their control points, the
+ * control polygon encloses the spline.
+ */
+static void
+dxf_extents_add_hatch
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        DxfHatch *hatch
+                /*!< DXF \c HATCH entity. */
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double c[3];
+        double u[3];
+        double v[3];
+        double minor[2];
+        double z;
+        double start_angle;
+        double end_angle;
+        double sweep;
+        int i;
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfHatchBoundaryPathEdgeSplineCp *control_point;
+
+        dxf_ocs_axes (hatch->extr_x0, hatch->extr_y0, hatch->extr_z0,
+          ax, ay, az);
+        z = (hatch->p0 != NULL) ? hatch->p0->z0 : hatch->elevation;
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+                {
+                        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices; vertex != NULL; vertex = next)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                                if ((next == NULL) && polyline->is_closed)
+                                {
+                                        next = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                                        dxf_extents_add_ocs_bulge (extents, ax, ay, az,
+                                          vertex->x0, vertex->y0, next->x0, next->y0,
+                                          z, vertex->bulge);
+                                        break;
+                                }
+                                if (next == NULL)
+                                {
+                                        dxf_extents_add_ocs_point (extents, ax, ay, az,
+                                          vertex->x0, vertex->y0, z);
+                                }
+                                else
+                                {
+                                        dxf_extents_add_ocs_bulge (extents, ax, ay, az,
+                                          vertex->x0, vertex->y0, next->x0, next->y0,
+                                          z, vertex->bulge);
+                                }
+                        }
+                }
+                for (edge = (DxfHatchBoundaryPathEdge *) path->edges; edge != NULL; edge = (DxfHatchBoundaryPathEdge *) edge->next)
+                {
+                        for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; line != NULL; line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                        {
+                                dxf_extents_add_ocs_point (extents, ax, ay, az, line->x0, line->y0, z);
+                                dxf_extents_add_ocs_point (extents, ax, ay, az, line->x1, line->y1, z);
+                        }
+                        for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; arc != NULL; arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                        {
+                                start_angle = arc->start_angle;
+                                end_angle = arc->end_angle;
+                                if (!arc->is_ccw)
+                                {
+                                        start_angle = -arc->end_angle;
+                                        end_angle = -arc->start_angle;
+                                }
+                                dxf_extents_add_ocs_arc (extents, ax, ay, az,
+                                  arc->x0, arc->y0, z, arc->radius,
+                                  start_angle * M_PI / 180.0,
+                                  end_angle * M_PI / 180.0);
+                        }
+                        for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; ellipse != NULL; ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                        {
+                                start_angle = ellipse->start_angle;
+                                end_angle = ellipse->end_angle;
+                                if (!ellipse->is_ccw)
+                                {
+                                        start_angle = -ellipse->end_angle;
+                                        end_angle = -ellipse->start_angle;
+                                }
+                                minor[0] = -ellipse->ratio * ellipse->y1;
+                                minor[1] = ellipse->ratio * ellipse->x1;
+                                for (i = 0; i < 3; i++)
+                                {
+                                        c[i] = ellipse->x0 * ax[i] + ellipse->y0 * ay[i] + z * az[i];
+                                        u[i] = ellipse->x1 * ax[i] + ellipse->y1 * ay[i];
+                                        v[i] = minor[0] * ax[i] + minor[1] * ay[i];
+                                }
+                                sweep = fmod ((end_angle - start_angle) * M_PI / 180.0, 2.0 * M_PI);
+                                if (sweep <= 0.0)
+                                {
+                                        sweep += 2.0 * M_PI;
+                                }
+                                dxf_extents_add_elliptical_arc (extents, c, u, v,
+                                  start_angle * M_PI / 180.0, sweep);
+                        }
+                        for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; spline != NULL; spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                        {
+                                for (control_point = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; control_point != NULL; control_point = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next)
+                                {
+                                        dxf_extents_add_ocs_point (extents, ax, ay, az,
+                                          control_point->x0, control_point->y0, z);
+                                }
+                        }
+                }
+        }
+}
+
+
+/*!
+ * \brief Grow a bounding box with the approximate box of a \c TEXT
+ * entity.
+ *
+ * Without font metrics every character is assumed to be as wide as
+ * the text height times the relative X scale factor, which encloses the
+ * text for the common fonts.
+ */
+static void
+dxf_extents_add_text
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        DxfText *text
+                /*!< DXF \c TEXT entity. */
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double width;
+        double height;
+        double x_scale;
+        double dx;
+        double dy;
+        DxfPoint *reference;
+
+        dxf_ocs_axes (text->extr_x0, text->extr_y0, text->extr_z0,
+          ax, ay, az);
+        height = text->height;
+        x_scale = (text->rel_x_scale > 0.0) ? text->rel_x_scale : 1.0;
+        width = (text->text_value != NULL)
+          ? strlen (text->text_value) * height * x_scale
+          : 0.0;
+        if ((text->hor_align == 3) || (text->hor_align == 5))
+        {
+                /* Aligned and fit text runs from the first to the
+                 * second alignment point. */
+                if (text->p1 != NULL)
+                {
+                        dxf_extents_add_ocs_rectangle (extents, ax, ay, az,
+                          text->p1->x0, text->p1->y0, text->p1->z0,
+                          0.0, 0.0, 0.0, height,
+                          atan2 (text->p1->y0 - text->p0->y0,
+                            text->p1->x0 - text->p0->x0));
+                }
+                dxf_extents_add_ocs_rectangle (extents, ax, ay, az,
+                  text->p0->x0, text->p0->y0, text->p0->z0,
+                  0.0, 0.0, 0.0, height,
+                  (text->p1 != NULL)
+                    ? atan2 (text->p1->y0 - text->p0->y0, text->p1->x0 - text->p0->x0)
+                    : text->rot_angle * M_PI / 180.0);
+                return;
+        }
+        switch (text->hor_align)
+        {
+                case 1:
+                case 4:
+                        dx = -0.5 * width;
+                        break;
+                case 2:
+                        dx = -width;
+                        break;
+                default:
+                        dx = 0.0;
+                        break;
+        }
+        switch (text->vert_align)
+        {
+                case 2:
+                        dy = -0.5 * height;
+                        break;
+                case 3:
+                        dy = -height;
+                        break;
+                default:
+                        dy = 0.0;
+                        break;
+        }
+        if (text->hor_align == 4)
+        {
+                dy = -0.5 * height;
+        }
+        /* Descenders reach below the baseline. */
+        if (dy == 0.0)
+        {
+                dy = -0.25 * height;
+                height *= 1.25;
+        }
+        reference = text->p0;
+        if (((text->hor_align != 0) || (text->vert_align != 0))
+          && (text->p1 != NULL))
+        {
+                reference = text->p1;
+        }
+        dxf_extents_add_ocs_rectangle (extents, ax, ay, az,
+          reference->x0, reference->y0, reference->z0,
+          dx, dy, width, height, text->rot_angle * M_PI / 180.0);
+}
+
+
+/*!
+ * \brief Grow a bounding box with the approximate box of a \c MTEXT
+ * entity.
+ *
+ * The width is the reference rectangle width when set, the height is
+ * the stored vertical height when set, otherwise both are estimated from
+ * the number and length of the paragraphs.
+ */
+static void
+dxf_extents_add_mtext
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        DxfMtext *mtext
+                /*!< DXF \c MTEXT entity. */
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double x_axis[3];
+        double y_axis[3];
+        double length;
+        double width;
+        double height;
+        double dx;
+        double dy;
+        double px;
+        double py;
+        int lines;
+        int column;
+        int longest;
+        int i;
+        const char *c;
+
+        dxf_ocs_axes (mtext->extr_x0, mtext->extr_y0, mtext->extr_z0,
+          ax, ay, az);
+        /* The insertion point and the X-axis direction are in WCS. */
+        if ((mtext->p1 != NULL)
+          && ((mtext->p1->x0 != 0.0) || (mtext->p1->y0 != 0.0) || (mtext->p1->z0 != 0.0)))
+        {
+                length = sqrt (mtext->p1->x0 * mtext->p1->x0
+                  + mtext->p1->y0 * mtext->p1->y0
+                  + mtext->p1->z0 * mtext->p1->z0);
+                x_axis[0] = mtext->p1->x0 / length;
+                x_axis[1] = mtext->p1->y0 / length;
+                x_axis[2] = mtext->p1->z0 / length;
+        }
+        else
+        {
+                for (i = 0; i < 3; i++)
+                {
+                        x_axis[i] = cos (mtext->rot_angle) * ax[i]
+                          + sin (mtext->rot_angle) * ay[i];
+                }
+        }
+        y_axis[0] = az[1] * x_axis[2] - az[2] * x_axis[1];
+        y_axis[1] = az[2] * x_axis[0] - az[0] * x_axis[2];
+        y_axis[2] = az[0] * x_axis[1] - az[1] * x_axis[0];
+        lines = 1;
+        column = 0;
+        longest = 0;
+        for (c = mtext->text_value; (c != NULL) && (*c != '\0'); c++)
+        {
+                if ((*c == '\\') && ((c[1] == 'P') || (c[1] == 'p')))
+                {
+                        lines++;
+                        column = 0;
+                        c++;
+                        continue;
+                }
+                column++;
+                if (column > longest)
+                {
+                        longest = column;
+                }
+        }
+        width = (mtext->rectangle_width > 0.0)
+          ? mtext->rectangle_width
+          : longest * mtext->height;
+        height = (mtext->rectangle_height > 0.0)
+          ? mtext->rectangle_height
+          : lines * mtext->height * 5.0 / 3.0;
+        switch ((mtext->attachment_point - 1) % 3)
+        {
+                case 1:
+                        dx = -0.5 * width;
+                        break;
+                case 2:
+                        dx = -width;
+                        break;
+                default:
+                        dx = 0.0;
+                        break;
+        }
+        switch ((mtext->attachment_point - 1) / 3)
+        {
+                case 1:
+                        dy = -0.5 * height;
+                        break;
+                case 2:
+                        dy = 0.0;
+                        break;
+                default:
+                        dy = -height;
+                        break;
+        }
+        for (i = 0; i < 4; i++)
+        {
+                px = dx + ((i & 1) ? width : 0.0);
+                py = dy + ((i & 2) ? height : 0.0);
+                dxf_extents_add_point (extents,
+                  mtext->p0->x0 + px * x_axis[0] + py * y_axis[0],
+                  mtext->p0->y0 + px * x_axis[1] + py * y_axis[1],
+                  mtext->p0->z0 + px * x_axis[2] + py * y_axis[2]);
+        }
+}
+
+
+/*!
+ * \brief Compute the hash of a block name, block names are case
+ * insensitive.
+ */
+static unsigned int
+dxf_block_extents_hash
+(
+        const char *block_name
+                /*!< Name of the block. */
+)
+{
+        unsigned int hash = 2166136261u;
+
+        while (*block_name != '\0')
+        {
+                hash ^= (unsigned int) toupper ((unsigned char) *block_name);
+                hash *= 16777619u;
+                block_name++;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Find the index of a block in a block extents cache.
+ *
+ * \return the index of the block, or \c -1 when there is no block with
+ * that name.
+ */
+static int
+dxf_block_extents_find_index
+(
+        DxfBlockExtents *block_extents,
+                /*!< Block extents cache. */
+        const char *block_name
+                /*!< Name of the block. */
+)
+{
+        unsigned int mask;
+        unsigned int slot;
+
+        mask = (unsigned int) block_extents->lookup_size - 1;
+        slot = dxf_block_extents_hash (block_name) & mask;
+        while (block_extents->lookup[slot] != -1)
+        {
+                if (strcasecmp (block_extents->blocks[block_extents->lookup[slot]].block->block_name, block_name) == 0)
+                {
+                        return (block_extents->lookup[slot]);
+                }
+                slot = (slot + 1) & mask;
+        }
+        return (-1);
+}
+
+
+/*!
+ * \brief Get the extents of the block with index \c i, computing them
+ * on first use.
+ *
+ * Nested block references are computed recursively, a block which is
+ * being computed is not entered again.
+ *
+ * \return the extents of the block, or \c NULL for a circular
+ * reference.
+ */
+static DxfExtents *
+dxf_block_extents_compute
+(
+        DxfBlockExtents *block_extents,
+                /*!< Block extents cache. */
+        int i
+                /*!< Index of the block. */
+)
+{
+        DxfBlockExtentsEntry *entry;
+        DxfEntities *entities;
+        DxfExtents entity_extents;
+        int j;
+
+        entry = &block_extents->blocks[i];
+        if (entry->state == 2)
+        {
+                return (&entry->extents);
+        }
+        if (entry->state == 1)
+        {
+                return (NULL);
+        }
+        entry->state = 1;
+        dxf_extents_set_empty (&entry->extents);
+        entities = (DxfEntities *) entry->block->entities;
+        if (entities != NULL)
+        {
+                for (j = 0; j < entities->number_of_sequence_items; j++)
+                {
+                        if (dxf_entity_get_extents_with_blocks (entities->sequence[j].type,
+                          entities->sequence[j].entity, block_extents,
+                          &entity_extents) == EXIT_SUCCESS)
+                        {
+                                dxf_extents_add_extents (&entry->extents, &entity_extents);
+                        }
+                }
+        }
+        entry->state = 2;
+        return (&entry->extents);
+}
+
+
+/*!
+ * \brief Compute the bounding box of an entity in world coordinates.
+ *
+ * Supported are \c 3DFACE, \c ARC, \c CIRCLE, \c ELLIPSE, \c HATCH,
+ * \c INSERT, \c LINE, \c LWPOLYLINE, \c MTEXT, \c POINT,
+ * \c POLYLINE, \c SOLID, \c SPLINE, \c TEXT and \c TRACE entities.\n
+ * Entities in an Object Coordinate System are transformed with the
+ * arbitrary axis algorithm and grown by their thickness.\n
+ * Arcs, bulges and ellipses yield tight boxes, a \c SPLINE yields the
+ * box of it's control points (or fit points), text yields an
+ * approximation.\n
+ * An \c INSERT yields only the extents of its insertion points, use
+ * dxf_entity_get_extents_with_blocks () to include the contents of the
+ * block.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * extents of the entity type can not be computed or an error occurred.
+ */
+int
+dxf_entity_get_extents
+(
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity,
+                /*!< Pointer to the entity. */
+        DxfExtents *extents
+                /*!< Bounding box receiving the extents. */
+)
+{
+        return (dxf_entity_get_extents_with_blocks (type, entity, NULL, extents));
+}
+
+
+/*!
+ * \brief Compute the bounding box of an entity in world coordinates,
+ * including the contents of the blocks referenced by an \c INSERT.
+ *
+ * As dxf_entity_get_extents (), an \c INSERT yields the extents of the
+ * referenced block from \c block_extents, transformed by the insert.\n
+ * An \c INSERT of an unknown block, or of a block which references
+ * itself, yields the extents of its insertion points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * extents of the entity type can not be computed or an error occurred.
+ */
+int
+dxf_entity_get_extents_with_blocks
+(
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity,
+                /*!< Pointer to the entity. */
+        DxfBlockExtents *block_extents,
+                /*!< Cache of the extents of the blocks, may be
+                 * \c NULL. */
+        DxfExtents *extents
+                /*!< Bounding box receiving the extents. */
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double c[3];
+        double u[3];
+        double v[3];
+        double sweep;
+        int i;
+        DxfPoint *point;
+        DxfPoint *corners[4];
+        DxfLine *line;
+        DxfCircle *circle;
+        DxfArc *arc;
+        DxfEllipse *ellipse;
+        DxfLWPolyline *lwpolyline;
+        DxfPolyline *polyline;
+        DxfVertex *vertex;
+        DxfSpline *spline;
+        DxfMesh *mesh;
+        DxfInsert *insert;
+        DxfBlock *block;
+        DxfExtents *contents;
+        DxfSolid *solid;
+        DxfTrace *trace;
+        Dxf3dface *dface;
+
+        /* Do some basic checks. */
+        if ((entity == NULL) || (extents == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_set_empty (extents);
+        switch (type)
+        {
+                case POINT:
+                        point = (DxfPoint *) entity;
+                        dxf_extents_add_point (extents, point->x0, point->y0, point->z0);
+                        break;
+                case LINE:
+                        line = (DxfLine *) entity;
+                        if ((line->p0 == NULL) || (line->p1 == NULL))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_extents_add_point (extents, line->p0->x0, line->p0->y0, line->p0->z0);
+                        dxf_extents_add_point (extents, line->p1->x0, line->p1->y0, line->p1->z0);
+                        dxf_ocs_axes (line->extr_x0, line->extr_y0, line->extr_z0, ax, ay, az);
+                        dxf_extents_add_thickness (extents, az, line->thickness);
+                        break;
+                case CIRCLE:
+                        circle = (DxfCircle *) entity;
+                        if (circle->p0 == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_ocs_axes (circle->extr_x0, circle->extr_y0, circle->extr_z0, ax, ay, az);
+                        dxf_extents_add_ocs_arc (extents, ax, ay, az,
+                          circle->p0->x0, circle->p0->y0, circle->p0->z0,
+                          circle->radius, 0.0, 0.0);
+                        dxf_extents_add_thickness (extents, az, circle->thickness);
+                        break;
+                case ARC:
+                        arc = (DxfArc *) entity;
+                        if (arc->p0 == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_ocs_axes (arc->extr_x0, arc->extr_y0, arc->extr_z0, ax, ay, az);
+                        dxf_extents_add_ocs_arc (extents, ax, ay, az,
+                          arc->p0->x0, arc->p0->y0, arc->p0->z0,
+                          arc->radius,
+                          arc->start_angle * M_PI / 180.0,
+                          arc->end_angle * M_PI / 180.0);
+                        dxf_extents_add_thickness (extents, az, arc->thickness);
+                        break;
+                case ELLIPSE:
+                        ellipse = (DxfEllipse *) entity;
+                        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        /* Center and major axis are in WCS, the minor
+                         * axis is the extrusion direction cross the
+                         * major axis. */
+                        dxf_ocs_axes (ellipse->extr_x0, ellipse->extr_y0, ellipse->extr_z0, ax, ay, az);
+                        c[0] = ellipse->p0->x0;
+                        c[1] = ellipse->p0->y0;
+                        c[2] = ellipse->p0->z0;
+                        u[0] = ellipse->p1->x0;
+                        u[1] = ellipse->p1->y0;
+                        u[2] = ellipse->p1->z0;
+                        v[0] = ellipse->ratio * (az[1] * u[2] - az[2] * u[1]);
+                        v[1] = ellipse->ratio * (az[2] * u[0] - az[0] * u[2]);
+                        v[2] = ellipse->ratio * (az[0] * u[1] - az[1] * u[0]);
+                        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+                        if (sweep <= 0.0)
+                        {
+                                sweep += 2.0 * M_PI;
+                        }
+                        dxf_extents_add_elliptical_arc (extents, c, u, v,
+                          ellipse->start_angle, sweep);
+                        break;
+                case LWPOLYLINE:
+                        lwpolyline = (DxfLWPolyline *) entity;
+                        dxf_ocs_axes (lwpolyline->extr_x0, lwpolyline->extr_y0, lwpolyline->extr_z0, ax, ay, az);
+                        dxf_extents_add_ocs_vertices (extents, ax, ay, az,
+                          (DxfVertex *) lwpolyline->vertices, lwpolyline->elevation,
+                          lwpolyline->flag & 1);
+                        dxf_extents_add_thickness (extents, az, lwpolyline->thickness);
+                        break;
+                case POLYLINE:
+                        polyline = (DxfPolyline *) entity;
+                        if (polyline->flag & (8 | 16 | 64))
+                        {
+                                /* 3D polylines and meshes have their
+                                 * vertices in WCS, polyface face
+                                 * records carry no coordinates. */
+                                for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+                                {
+                                        if ((vertex->p0 == NULL)
+                                          || ((vertex->flag & 128) && !(vertex->flag & 64)))
+                                        {
+                                                continue;
+                                        }
+                                        dxf_extents_add_point (extents,
+                                          vertex->p0->x0, vertex->p0->y0, vertex->p0->z0);
+                                }
+                        }
+                        else
+                        {
+                                dxf_ocs_axes (polyline->extr_x0, polyline->extr_y0, polyline->extr_z0, ax, ay, az);
+                                dxf_extents_add_ocs_vertices (extents, ax, ay, az,
+                                  polyline->vertices,
+                                  (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation,
+                                  polyline->flag & 1);
+                                dxf_extents_add_thickness (extents, az, polyline->thickness);
+                        }
+                        break;
+                case SPLINE:
+                        /* A B-spline lies within the convex hull of
+                         * it's control points. */
+                        spline = (DxfSpline *) entity;
+                        point = (spline->number_of_control_points > 0) ? spline->p0 : spline->p1;
+                        i = (spline->number_of_control_points > 0)
+                          ? spline->number_of_control_points
+                          : spline->number_of_fit_points;
+                        for (; (point != NULL) && (i > 0); point = (DxfPoint *) point->next, i--)
+                        {
+                                dxf_extents_add_point (extents, point->x0, point->y0, point->z0);
+                        }
+                        break;
+                case MESH:
+                        mesh = (DxfMesh *) entity;
+                        if (mesh->vertices == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        for (i = 0; i < mesh->vertex_count_level_0; i++)
+                        {
+                                dxf_extents_add_point (extents, mesh->vertices[3 * i],
+                                  mesh->vertices[3 * i + 1], mesh->vertices[3 * i + 2]);
+                        }
+                        break;
+                case INSERT:
+                        insert = (DxfInsert *) entity;
+                        block = NULL;
+                        contents = NULL;
+                        if ((block_extents != NULL) && (insert->block_name != NULL))
+                        {
+                                i = dxf_block_extents_find_index (block_extents, insert->block_name);
+                                if (i != -1)
+                                {
+                                        block = block_extents->blocks[i].block;
+                                        contents = dxf_block_extents_compute (block_extents, i);
+                                }
+                        }
+                        if (dxf_insert_get_extents (insert, block, contents, extents) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        break;
+                case TEXT:
+                        if (((DxfText *) entity)->p0 == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_extents_add_text (extents, (DxfText *) entity);
+                        break;
+                case MTEXT:
+                        if (((DxfMtext *) entity)->p0 == NULL)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_extents_add_mtext (extents, (DxfMtext *) entity);
+                        break;
+                case HATCH:
+                        dxf_extents_add_hatch (extents, (DxfHatch *) entity);
+                        break;
+                case SOLID:
+                        solid = (DxfSolid *) entity;
+                        corners[0] = solid->p0;
+                        corners[1] = solid->p1;
+                        corners[2] = solid->p2;
+                        corners[3] = solid->p3;
+                        dxf_ocs_axes (solid->extr_x0, solid->extr_y0, solid->extr_z0, ax, ay, az);
+                        for (i = 0; i < 4; i++)
+                        {
+                                if (corners[i] != NULL)
+                                {
+                                        dxf_extents_add_ocs_point (extents, ax, ay, az,
+                                          corners[i]->x0, corners[i]->y0, corners[i]->z0);
+                                }
+                        }
+                        dxf_extents_add_thickness (extents, az, solid->thickness);
+                        break;
+                case TRACE:
+                        trace = (DxfTrace *) entity;
+                        corners[0] = trace->p0;
+                        corners[1] = trace->p1;
+                        corners[2] = trace->p2;
+                        corners[3] = trace->p3;
+                        dxf_ocs_axes (trace->extr_x0, trace->extr_y0, trace->extr_z0, ax, ay, az);
+                        for (i = 0; i < 4; i++)
+                        {
+                                if (corners[i] != NULL)
+                                {
+                                        dxf_extents_add_ocs_point (extents, ax, ay, az,
+                                          corners[i]->x0, corners[i]->y0, corners[i]->z0);
+                                }
+                        }
+                        dxf_extents_add_thickness (extents, az, trace->thickness);
+                        break;
+                case DFACE:
+                        dface = (Dxf3dface *) entity;
+                        corners[0] = dface->p0;
+                        corners[1] = dface->p1;
+                        corners[2] = dface->p2;
+                        corners[3] = dface->p3;
+                        for (i = 0; i < 4; i++)
+                        {
+                                if (corners[i] != NULL)
+                                {
+                                        dxf_extents_add_point (extents,
+                                          corners[i]->x0, corners[i]->y0, corners[i]->z0);
+                                }
+                        }
+                        break;
+                default:
+                        return (EXIT_FAILURE);
+        }
+        if (dxf_extents_is_empty (extents))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the bounding box of an \c INSERT entity in world
+ * coordinates.
+ *
+ * The bounding box of the block contents, relative to the block base
+ * point, is scaled, rotated, moved to every insertion of the
+ * \c MINSERT array and transformed from the OCS of the insert.\n
+ * The array is affine, so only the corner cells of the array are
+ * evaluated.\n
+ * When \c block_extents is \c NULL (or empty) only the insertion points
+ * are included.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_insert_get_extents
+(
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        DxfBlock *block,
+                /*!< a pointer to the DXF \c BLOCK referenced by the
+                 * insert, may be \c NULL for a base point at the
+                 * origin. */
+        DxfExtents *block_extents,
+                /*!< Bounding box of the block contents in block
+                 * coordinates, may be \c NULL. */
+        DxfExtents *extents
+                /*!< Bounding box receiving the extents. */
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double base[3];
+        double scale[3];
+        double cos_rotation;
+        double sin_rotation;
+        double px;
+        double py;
+        double pz;
+        double ox;
+        double oy;
+        int columns;
+        int rows;
+        int cell;
+        int corner;
+        int has_block;
+
+        /* Do some basic checks. */
+        if ((insert == NULL) || (extents == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (insert->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_extents_set_empty (extents);
+        dxf_ocs_axes (insert->extr_x0, insert->extr_y0, insert->extr_z0, ax, ay, az);
+        has_block = ((block_extents != NULL) && !dxf_extents_is_empty (block_extents));
+        base[0] = ((block != NULL) && (block->p0 != NULL)) ? block->p0->x0 : 0.0;
+        base[1] = ((block != NULL) && (block->p0 != NULL)) ? block->p0->y0 : 0.0;
+        base[2] = ((block != NULL) && (block->p0 != NULL)) ? block->p0->z0 : 0.0;
+        /* A scale factor of zero is not valid, treat it as unset. */
+        scale[0] = (insert->rel_x_scale != 0.0) ? insert->rel_x_scale : 1.0;
+        scale[1] = (insert->rel_y_scale != 0.0) ? insert->rel_y_scale : 1.0;
+        scale[2] = (insert->rel_z_scale != 0.0) ? insert->rel_z_scale : 1.0;
+        cos_rotation = cos (insert->rot_angle * M_PI / 180.0);
+        sin_rotation = sin (insert->rot_angle * M_PI / 180.0);
+        columns = (insert->columns > 1) ? insert->columns : 1;
+        rows = (insert->rows > 1) ? insert->rows : 1;
+        for (cell = 0; cell < 4; cell++)
+        {
+                /* Offset of a corner cell of the array, before
+                 * rotation. */
+                ox = (cell & 1) ? (columns - 1) * insert->column_spacing : 0.0;
+                oy = (cell & 2) ? (rows - 1) * insert->row_spacing : 0.0;
+                for (corner = 0; corner < (has_block ? 8 : 1); corner++)
+                {
+                        if (has_block)
+                        {
+                                px = ((corner & 1) ? block_extents->max_x : block_extents->min_x) - base[0];
+                                py = ((corner & 2) ? block_extents->max_y : block_extents->min_y) - base[1];
+                                pz = ((corner & 4) ? block_extents->max_z : block_extents->min_z) - base[2];
+                                px = px * scale[0] + ox;
+                                py = py * scale[1] + oy;
+                                pz = pz * scale[2];
+                        }
+                        else
+                        {
+                                px = ox;
+                                py = oy;
+                                pz = 0.0;
+                        }
+                        dxf_extents_add_ocs_point (extents, ax, ay, az,
+                          insert->p0->x0 + px * cos_rotation - py * sin_rotation,
+                          insert->p0->y0 + px * sin_rotation + py * cos_rotation,
+                          insert->p0->z0 + pz);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Allocate memory for a cache of the extents of a single linked
+ * list of DXF \c BLOCK entities and compute the extents.
+ *
+ * The extents of all blocks are computed up front, so the cache can be
+ * shared by threads afterwards.\n
+ * The blocks are not copied and have to outlive the cache, when
+ * several blocks have the same name the first one is used.
+ *
+ * \return a pointer to the cache, or \c NULL when no memory could be
+ * allocated.
+ */
+DxfBlockExtents *
+dxf_block_extents_new
+(
+        DxfBlock *blocks
+                /*!< a pointer to a single linked list of DXF \c BLOCK
+                 * entities, may be \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfBlockExtents *block_extents = NULL;
+        DxfBlock *iter;
+        unsigned int mask;
+        unsigned int slot;
+        int n;
+        int i;
+
+        block_extents = calloc (1, sizeof (DxfBlockExtents));
+        if (block_extents == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        n = 0;
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                n++;
+        }
+        /* Keep the hash table at most half full. */
+        block_extents->lookup_size = 16;
+        while (block_extents->lookup_size < 2 * n)
+        {
+                block_extents->lookup_size *= 2;
+        }
+        block_extents->blocks = malloc ((n + 1) * sizeof (DxfBlockExtentsEntry));
+        block_extents->lookup = malloc (block_extents->lookup_size * sizeof (int));
+        if ((block_extents->blocks == NULL) || (block_extents->lookup == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_block_extents_free (block_extents);
+                return (NULL);
+        }
+        for (i = 0; i < block_extents->lookup_size; i++)
+        {
+                block_extents->lookup[i] = -1;
+        }
+        mask = (unsigned int) block_extents->lookup_size - 1;
+        for (iter = blocks; iter != NULL; iter = (DxfBlock *) iter->next)
+        {
+                if ((iter->block_name == NULL)
+                  || (dxf_block_extents_find_index (block_extents, iter->block_name) != -1))
+                {
+                        continue;
+                }
+                i = block_extents->number_of_blocks;
+                block_extents->blocks[i].block = iter;
+                block_extents->blocks[i].state = 0;
+                slot = dxf_block_extents_hash (iter->block_name) & mask;
+                while (block_extents->lookup[slot] != -1)
+                {
+                        slot = (slot + 1) & mask;
+                }
+                block_extents->lookup[slot] = i;
+                block_extents->number_of_blocks++;
+        }
+        for (i = 0; i < block_extents->number_of_blocks; i++)
+        {
+                dxf_block_extents_compute (block_extents, i);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (block_extents);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a cache of block extents.
+ *
+ * The blocks themselves are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_block_extents_free
+(
+        DxfBlockExtents *block_extents
+                /*!< Block extents cache. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (block_extents == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (block_extents->blocks);
+        free (block_extents->lookup);
+        free (block_extents);
+        block_extents = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the extents of a block definition by name.
+ *
+ * The extents are in block coordinates and include nested block
+ * references.
+ *
+ * \return a pointer to the extents owned by the cache, or \c NULL when
+ * there is no block with that name or an error occurred.
+ */
+DxfExtents *
+dxf_block_extents_get
+(
+        DxfBlockExtents *block_extents,
+                /*!< Block extents cache. */
+        const char *block_name,
+                /*!< Name of the block, case insensitive. */
+        DxfBlock **block
+                /*!< Receives the block definition when not \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((block_extents == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_block_extents_find_index (block_extents, block_name);
+        if (block != NULL)
+        {
+                *block = (i == -1) ? NULL : block_extents->blocks[i].block;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((i == -1) ? NULL : dxf_block_extents_compute (block_extents, i));
+}
+
+
+/* EOF */
@@ -0,0 +1,135 @@
+/*!
+ * \file extents.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF bounding boxes (extents).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_EXTENTS_H
+#define LIBDXF_SRC_EXTENTS_H
+
+
+#include <float.h>
+#include "global.h"
+#include "entity.h"
+#include "block.h"
+#include "insert.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief libDXF definition of an axis aligned bounding box.
+ *
+ * An empty box has minimum values larger than it's maximum values.
+ */
+typedef struct
+dxf_extents_struct
+{
+        double min_x;
+                /*!< Minimum X-value. */
+        double min_y;
+                /*!< Minimum Y-value. */
+        double min_z;
+                /*!< Minimum Z-value. */
+        double max_x;
+                /*!< Maximum X-value. */
+        double max_y;
+                /*!< Maximum Y-value. */
+        double max_z;
+                /*!< Maximum Z-value. */
+} DxfExtents;
+
+
+/*!
+ * \brief A block definition known to a block extents cache.
+ */
+typedef struct
+dxf_block_extents_entry_struct
+{
+        DxfBlock *block;
+                /*!< Block definition. */
+        DxfExtents extents;
+                /*!< Bounding box of the block contents in block
+                 * coordinates, nested block references included. */
+        int state;
+                /*!< \c 0 until the extents are computed, \c 1 while
+                 * they are being computed, to detect circular
+                 * references, \c 2 when \c extents is valid. */
+} DxfBlockExtentsEntry;
+
+
+/*!
+ * \brief Cache of the extents of block definitions.
+ *
+ * Blocks are looked up by name in a hash table, the extents of every
+ * block are computed once, when the cache is created, and reused for
+ * all the references to it.
+ */
+typedef struct
+dxf_block_extents_struct
+{
+        DxfBlockExtentsEntry *blocks;
+                /*!< Block definitions. */
+        int number_of_blocks;
+                /*!< Number of block definitions. */
+        int *lookup;
+                /*!< Open addressing hash table of indices into
+                 * \c blocks, \c -1 for an empty slot. */
+        int lookup_size;
+                /*!< Number of slots in \c lookup, a power of 2. */
+} DxfBlockExtents;
+
+
+DxfExtents *dxf_extents_set_empty (DxfExtents *extents);
+int dxf_extents_is_empty (DxfExtents *extents);
+DxfExtents *dxf_extents_add_point (DxfExtents *extents, double x, double y, double z);
+DxfExtents *dxf_extents_add_extents (DxfExtents *extents, DxfExtents *other);
+int dxf_extents_intersect (DxfExtents *a, DxfExtents *b);
+int dxf_entity_get_extents (DxfEntityType type, void *entity, DxfExtents *extents);
+int dxf_insert_get_extents (DxfInsert *insert, DxfBlock *block, DxfExtents *block_extents, DxfExtents *extents);
+DxfBlockExtents *dxf_block_extents_new (DxfBlock *blocks);
+int dxf_block_extents_free (DxfBlockExtents *block_extents);
+DxfExtents *dxf_block_extents_get (DxfBlockExtents *block_extents, const char *block_name, DxfBlock **block);
+int dxf_entity_get_extents_with_blocks (DxfEntityType type, void *entity, DxfBlockExtents *block_extents, DxfExtents *extents);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_EXTENTS_H */
+
+
+/* EOF */
@@ -0,0 +1,922 @@
+/*!
+ * \file face_soup.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the extraction of a triangle soup from \c 3DFACE,
+ * \c SOLID and \c TRACE entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "face_soup.h"
+
+
+/*!
+ * \brief Allocate memory for a face soup.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfFaceSoup *
+dxf_face_soup_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFaceSoup *soup = NULL;
+
+        soup = calloc (1, sizeof (DxfFaceSoup));
+        if (soup == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (soup);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a face soup.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_face_soup_free
+(
+        DxfFaceSoup *soup
+                /*!< Face soup. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (soup == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (soup->vertices);
+        free (soup->indices);
+        free (soup->invisible_edges);
+        free (soup->types);
+        free (soup->entities);
+        free (soup->hash_table);
+        free (soup);
+        soup = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all vertices and triangles from a face soup, keeping
+ * the allocated memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_face_soup_clear
+(
+        DxfFaceSoup *soup
+                /*!< Face soup. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        if (soup == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        soup->number_of_vertices = 0;
+        soup->number_of_triangles = 0;
+        for (i = 0; i < soup->hash_size; i++)
+        {
+                soup->hash_table[i] = -1;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Hash the coordinates of a vertex.
+ *
+ * Negative zero is hashed as zero, as it compares equal.
+ */
+static uint64_t
+dxf_face_soup_hash
+(
+        const double *p
+)
+{
+        double v[3];
+        uint64_t bits[3];
+        uint64_t hash;
+        int i;
+
+        v[0] = p[0] + 0.0;
+        v[1] = p[1] + 0.0;
+        v[2] = p[2] + 0.0;
+        memcpy (bits, v, sizeof (bits));
+        hash = UINT64_C (0xcbf29ce484222325);
+        for (i = 0; i < 3; i++)
+        {
+                hash = (hash ^ bits[i]) * UINT64_C (0x9e3779b97f4a7c15);
+                hash ^= hash >> 29;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Rebuild the hash table of a face soup with \c size slots.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_face_soup_rehash
+(
+        DxfFaceSoup *soup,
+        int size
+)
+{
+        int *table;
+        int slot;
+        int i;
+
+        table = malloc ((size_t) size * sizeof (int));
+        if (table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < size; i++)
+        {
+                table[i] = -1;
+        }
+        for (i = 0; i < soup->number_of_vertices; i++)
+        {
+                slot = (int) (dxf_face_soup_hash (soup->vertices + 3 * i) & (uint64_t) (size - 1));
+                while (table[slot] >= 0)
+                {
+                        slot = (slot + 1) & (size - 1);
+                }
+                table[slot] = i;
+        }
+        free (soup->hash_table);
+        soup->hash_table = table;
+        soup->hash_size = size;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Reserve memory in a face soup.
+ *
+ * Reserving the expected number of vertices and triangles up front
+ * avoids growing the arrays while adding entities.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_face_soup_reserve
+(
+        DxfFaceSoup *soup,
+                /*!< Face soup. */
+        int number_of_vertices,
+                /*!< Number of vertices to hold. */
+        int number_of_triangles
+                /*!< Number of triangles to hold. */
+)
+{
+        double *vertices;
+        int *indices;
+        unsigned char *flags;
+        DxfEntityType *types;
+        void **entities;
+        int size;
+
+        if (soup == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (number_of_vertices > soup->vertices_size)
+        {
+                vertices = realloc (soup->vertices, 3 * (size_t) number_of_vertices * sizeof (double));
+                if (vertices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                soup->vertices = vertices;
+                soup->vertices_size = number_of_vertices;
+        }
+        /* Keep the hash table at most half full. */
+        if (2 * soup->vertices_size > soup->hash_size)
+        {
+                size = 1024;
+                while (size < 2 * soup->vertices_size)
+                {
+                        size *= 2;
+                }
+                if (dxf_face_soup_rehash (soup, size) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (number_of_triangles > soup->triangles_size)
+        {
+                size = number_of_triangles;
+                indices = realloc (soup->indices, 3 * (size_t) size * sizeof (int));
+                if (indices != NULL)
+                {
+                        soup->indices = indices;
+                }
+                flags = realloc (soup->invisible_edges, (size_t) size);
+                if (flags != NULL)
+                {
+                        soup->invisible_edges = flags;
+                }
+                types = realloc (soup->types, (size_t) size * sizeof (DxfEntityType));
+                if (types != NULL)
+                {
+                        soup->types = types;
+                }
+                entities = realloc (soup->entities, (size_t) size * sizeof (void *));
+                if (entities != NULL)
+                {
+                        soup->entities = entities;
+                }
+                if ((indices == NULL) || (flags == NULL)
+                  || (types == NULL) || (entities == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                soup->triangles_size = size;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a vertex to a face soup, unless a vertex with the same
+ * coordinates is present.
+ *
+ * \return the index of the vertex, or \c -1 when an error occurred.
+ */
+int
+dxf_face_soup_add_vertex
+(
+        DxfFaceSoup *soup,
+                /*!< Face soup. */
+        double x,
+                /*!< X-value of the vertex. */
+        double y,
+                /*!< Y-value of the vertex. */
+        double z
+                /*!< Z-value of the vertex. */
+)
+{
+        double p[3];
+        double *q;
+        int slot;
+
+        if (soup == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((soup->number_of_vertices == soup->vertices_size)
+          && (dxf_face_soup_reserve (soup,
+          (soup->vertices_size > 0) ? 2 * soup->vertices_size : 256, 0) == EXIT_FAILURE))
+        {
+                return (-1);
+        }
+        p[0] = x;
+        p[1] = y;
+        p[2] = z;
+        slot = (int) (dxf_face_soup_hash (p) & (uint64_t) (soup->hash_size - 1));
+        while (soup->hash_table[slot] >= 0)
+        {
+                q = soup->vertices + 3 * soup->hash_table[slot];
+                if ((q[0] == x) && (q[1] == y) && (q[2] == z))
+                {
+                        return (soup->hash_table[slot]);
+                }
+                slot = (slot + 1) & (soup->hash_size - 1);
+        }
+        q = soup->vertices + 3 * soup->number_of_vertices;
+        q[0] = x;
+        q[1] = y;
+        q[2] = z;
+        soup->hash_table[slot] = soup->number_of_vertices;
+        return (soup->number_of_vertices++);
+}
+
+
+/*!
+ * \brief Add a triangle in the WCS to a face soup, unless it has no
+ * area relative to the length of it's edges.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_face_soup_add_triangle
+(
+        DxfFaceSoup *soup,
+        DxfEntityType type,
+        void *entity,
+        const double *p,
+        const double *q,
+        const double *r,
+        int invisible_edges
+)
+{
+        double u[3];
+        double v[3];
+        double n[3];
+        double scale;
+        int a;
+        int b;
+        int c;
+        int i;
+
+        for (i = 0; i < 3; i++)
+        {
+                u[i] = q[i] - p[i];
+                v[i] = r[i] - p[i];
+        }
+        n[0] = u[1] * v[2] - u[2] * v[1];
+        n[1] = u[2] * v[0] - u[0] * v[2];
+        n[2] = u[0] * v[1] - u[1] * v[0];
+        scale = DBL_EPSILON * (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]
+          + v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        if (n[0] * n[0] + n[1] * n[1] + n[2] * n[2] <= scale * scale)
+        {
+                return (EXIT_SUCCESS);
+        }
+        a = dxf_face_soup_add_vertex (soup, p[0], p[1], p[2]);
+        b = dxf_face_soup_add_vertex (soup, q[0], q[1], q[2]);
+        c = dxf_face_soup_add_vertex (soup, r[0], r[1], r[2]);
+        if ((a < 0) || (b < 0) || (c < 0))
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((soup->number_of_triangles == soup->triangles_size)
+          && (dxf_face_soup_reserve (soup, 0,
+          (soup->triangles_size > 0) ? 2 * soup->triangles_size : 256) == EXIT_FAILURE))
+        {
+                return (EXIT_FAILURE);
+        }
+        i = soup->number_of_triangles;
+        soup->indices[3 * i] = a;
+        soup->indices[3 * i + 1] = b;
+        soup->indices[3 * i + 2] = c;
+        soup->invisible_edges[i] = (unsigned char) (invisible_edges & 7);
+        soup->types[i] = type;
+        soup->entities[i] = entity;
+        soup->number_of_triangles++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a quadrilateral in the WCS to a face soup.
+ *
+ * Repeated corners are removed, a remaining quadrilateral is split
+ * along it's shorter diagonal.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_face_soup_add_quad
+(
+        DxfFaceSoup *soup,
+        DxfEntityType type,
+        void *entity,
+        double corners[4][3],
+        int invisible_edges
+)
+{
+        double *c[4];
+        double d02;
+        double d13;
+        int flags;
+        int k;
+        int i;
+
+        k = 0;
+        flags = 0;
+        for (i = 0; i < 4; i++)
+        {
+                if ((k > 0)
+                  && (corners[i][0] == c[k - 1][0])
+                  && (corners[i][1] == c[k - 1][1])
+                  && (corners[i][2] == c[k - 1][2]))
+                {
+                        /* The edge to a repeated corner vanishes, the
+                         * next edge keeps it's visibility. */
+                        flags = (flags & ~(1 << (k - 1))) | (((invisible_edges >> i) & 1) << (k - 1));
+                        continue;
+                }
+                c[k] = corners[i];
+                flags |= ((invisible_edges >> i) & 1) << k;
+                k++;
+        }
+        while ((k > 1)
+          && (c[k - 1][0] == c[0][0])
+          && (c[k - 1][1] == c[0][1])
+          && (c[k - 1][2] == c[0][2]))
+        {
+                flags = (flags & ~(1 << (k - 2))) | (((flags >> (k - 1)) & 1) << (k - 2));
+                flags &= ~(1 << (k - 1));
+                k--;
+        }
+        if (k < 3)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (k == 3)
+        {
+                return (dxf_face_soup_add_triangle (soup, type, entity,
+                  c[0], c[1], c[2], flags));
+        }
+        d02 = (c[2][0] - c[0][0]) * (c[2][0] - c[0][0])
+          + (c[2][1] - c[0][1]) * (c[2][1] - c[0][1])
+          + (c[2][2] - c[0][2]) * (c[2][2] - c[0][2]);
+        d13 = (c[3][0] - c[1][0]) * (c[3][0] - c[1][0])
+          + (c[3][1] - c[1][1]) * (c[3][1] - c[1][1])
+          + (c[3][2] - c[1][2]) * (c[3][2] - c[1][2]);
+        if (d02 <= d13)
+        {
+                if (dxf_face_soup_add_triangle (soup, type, entity,
+                  c[0], c[1], c[2], (flags & 3) | 4) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                return (dxf_face_soup_add_triangle (soup, type, entity,
+                  c[0], c[2], c[3], 1 | ((flags >> 1) & 6)));
+        }
+        if (dxf_face_soup_add_triangle (soup, type, entity,
+          c[1], c[2], c[3], ((flags >> 1) & 3) | 4) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        return (dxf_face_soup_add_triangle (soup, type, entity,
+          c[3], c[0], c[1], ((flags >> 3) & 1) | ((flags & 1) << 1) | 4));
+}
+
+
+/*!
+ * \brief Add the corners of a \c SOLID or \c TRACE entity to a face
+ * soup.
+ *
+ * The corners are given in the OCS in the order of the DXF file, the
+ * outline runs from the first via the second and fourth to the third
+ * corner.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_face_soup_add_ocs_quad
+(
+        DxfFaceSoup *soup,
+        DxfEntityType type,
+        void *entity,
+        DxfPoint *p[4],
+        double extr_x0,
+        double extr_y0,
+        double extr_z0
+)
+{
+        static const int order[4] = {0, 1, 3, 2};
+        double corners[4][3];
+        double ax[3];
+        double ay[3];
+        double az[3];
+        DxfPoint *point;
+        int i;
+        int j;
+
+        dxf_ocs_axes (extr_x0, extr_y0, extr_z0, ax, ay, az);
+        for (i = 0; i < 4; i++)
+        {
+                point = p[order[i]];
+                for (j = 0; j < 3; j++)
+                {
+                        corners[i][j] = point->x0 * ax[j] + point->y0 * ay[j] + point->z0 * az[j];
+                }
+        }
+        return (dxf_face_soup_add_quad (soup, type, entity, corners, 0));
+}
+
+
+/*!
+ * \brief Add the triangles of a \c 3DFACE, \c SOLID or \c TRACE entity
+ * to a face soup.
+ *
+ * A quadrilateral is split along it's shorter diagonal, which is
+ * marked as an invisible edge, the edge visibility of a \c 3DFACE is
+ * retained.\n
+ * Repeated corners are removed and triangles without area are
+ * dropped before their vertices are added.\n
+ * \c SOLID and \c TRACE entities are transformed from their OCS, their
+ * thickness is ignored.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * is not supported or an error occurred.
+ */
+int
+dxf_face_soup_add_entity
+(
+        DxfFaceSoup *soup,
+                /*!< Face soup. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Entity to be added. */
+)
+{
+        Dxf3dface *face;
+        DxfSolid *solid;
+        DxfTrace *trace;
+        DxfPoint *p[4];
+        double corners[4][3];
+        double extr[3];
+        int flags;
+        int i;
+
+        if ((soup == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        switch (type)
+        {
+                case DFACE:
+                        face = (Dxf3dface *) entity;
+                        p[0] = face->p0;
+                        p[1] = face->p1;
+                        p[2] = face->p2;
+                        p[3] = face->p3;
+                        extr[0] = 0.0;
+                        extr[1] = 0.0;
+                        extr[2] = 1.0;
+                        flags = face->flag & 15;
+                        break;
+                case SOLID:
+                        solid = (DxfSolid *) entity;
+                        p[0] = solid->p0;
+                        p[1] = solid->p1;
+                        p[2] = solid->p2;
+                        p[3] = solid->p3;
+                        extr[0] = solid->extr_x0;
+                        extr[1] = solid->extr_y0;
+                        extr[2] = solid->extr_z0;
+                        flags = -1;
+                        break;
+                case TRACE:
+                        trace = (DxfTrace *) entity;
+                        p[0] = trace->p0;
+                        p[1] = trace->p1;
+                        p[2] = trace->p2;
+                        p[3] = trace->p3;
+                        extr[0] = trace->extr_x0;
+                        extr[1] = trace->extr_y0;
+                        extr[2] = trace->extr_z0;
+                        flags = -1;
+                        break;
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () the entity type is not supported.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+        }
+        for (i = 0; i < 4; i++)
+        {
+                if (p[i] == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () a NULL pointer was found.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (flags < 0)
+        {
+                return (dxf_face_soup_add_ocs_quad (soup, type, entity, p,
+                  extr[0], extr[1], extr[2]));
+        }
+        for (i = 0; i < 4; i++)
+        {
+                corners[i][0] = p[i]->x0;
+                corners[i][1] = p[i]->y0;
+                corners[i][2] = p[i]->z0;
+        }
+        return (dxf_face_soup_add_quad (soup, type, entity, corners, flags));
+}
+
+
+/*!
+ * \brief Append the vertices and triangles of a face soup to another
+ * face soup.
+ *
+ * Vertices of \c other that are present in \c soup are shared, the
+ * triangles keep their order.\n
+ * Merging the soups of consecutive parts of the entities in order
+ * yields the same soup as adding all entities to one soup.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_face_soup_merge
+(
+        DxfFaceSoup *soup,
+                /*!< Face soup receiving the triangles. */
+        DxfFaceSoup *other
+                /*!< Face soup to be appended. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int *map;
+        double *p;
+        int i;
+        int j;
+        int k;
+
+        if ((soup == NULL) || (other == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (other->number_of_triangles == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_face_soup_reserve (soup,
+          soup->number_of_vertices + other->number_of_vertices,
+          soup->number_of_triangles + other->number_of_triangles) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        map = malloc ((size_t) other->number_of_vertices * sizeof (int));
+        if (map == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < other->number_of_vertices; i++)
+        {
+                p = other->vertices + 3 * i;
+                map[i] = dxf_face_soup_add_vertex (soup, p[0], p[1], p[2]);
+        }
+        for (i = 0; i < other->number_of_triangles; i++)
+        {
+                k = soup->number_of_triangles + i;
+                for (j = 0; j < 3; j++)
+                {
+                        soup->indices[3 * k + j] = map[other->indices[3 * i + j]];
+                }
+                soup->invisible_edges[k] = other->invisible_edges[i];
+                soup->types[k] = other->types[i];
+                soup->entities[k] = other->entities[i];
+        }
+        soup->number_of_triangles += other->number_of_triangles;
+        free (map);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the triangles of all \c 3DFACE, \c SOLID and \c TRACE
+ * entities in a DXF entities section to a face soup.
+ *
+ * The entity lists are walked once to collect the entities, the
+ * memory for the worst case is reserved, and the entities are added
+ * in list order, see dxf_face_soup_add_entity ().\n
+ * When libDXF is built with OpenMP and there are more than
+ * \c DXF_FACE_SOUP_CHUNK_SIZE entities, every chunk of that many
+ * entities is extracted into a soup of it's own in parallel, and the
+ * chunk soups are merged in order with dxf_face_soup_merge (), which
+ * gives the same soup as the sequential extraction.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_face_soup_add_entities
+(
+        DxfFaceSoup *soup,
+                /*!< Face soup. */
+        DxfEntities *entities
+                /*!< DXF entities section. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        Dxf3dface *face;
+        DxfSolid *solid;
+        DxfTrace *trace;
+        DxfEntityType *types;
+        void **items;
+        DxfFaceSoup **chunks;
+        int number_of_chunks;
+        int count;
+        int result;
+        int first;
+        int last;
+        int c;
+        int i;
+
+        if ((soup == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        count = 0;
+        for (face = (Dxf3dface *) entities->dface_list; face != NULL; face = (Dxf3dface *) face->next)
+        {
+                count++;
+        }
+        for (solid = (DxfSolid *) entities->solid_list; solid != NULL; solid = (DxfSolid *) solid->next)
+        {
+                count++;
+        }
+        for (trace = (DxfTrace *) entities->trace_list; trace != NULL; trace = (DxfTrace *) trace->next)
+        {
+                count++;
+        }
+        if (count == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        types = malloc ((size_t) count * sizeof (DxfEntityType));
+        items = malloc ((size_t) count * sizeof (void *));
+        number_of_chunks = (count + DXF_FACE_SOUP_CHUNK_SIZE - 1) / DXF_FACE_SOUP_CHUNK_SIZE;
+        chunks = calloc ((size_t) number_of_chunks, sizeof (DxfFaceSoup *));
+        if ((types == NULL) || (items == NULL) || (chunks == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (types);
+                free (items);
+                free (chunks);
+                return (EXIT_FAILURE);
+        }
+        i = 0;
+        for (face = (Dxf3dface *) entities->dface_list; face != NULL; face = (Dxf3dface *) face->next)
+        {
+                types[i] = DFACE;
+                items[i++] = face;
+        }
+        for (solid = (DxfSolid *) entities->solid_list; solid != NULL; solid = (DxfSolid *) solid->next)
+        {
+                types[i] = SOLID;
+                items[i++] = solid;
+        }
+        for (trace = (DxfTrace *) entities->trace_list; trace != NULL; trace = (DxfTrace *) trace->next)
+        {
+                types[i] = TRACE;
+                items[i++] = trace;
+        }
+        result = dxf_face_soup_reserve (soup, soup->number_of_vertices + 4 * count,
+          soup->number_of_triangles + 2 * count);
+        if ((number_of_chunks == 1) || (result == EXIT_FAILURE))
+        {
+                /* Add the entities directly. */
+                for (i = 0; (i < count) && (result == EXIT_SUCCESS); i++)
+                {
+                        result = dxf_face_soup_add_entity (soup, types[i], items[i]);
+                }
+                number_of_chunks = 0;
+        }
+#ifdef _OPENMP
+#pragma omp parallel for private (i, first, last) schedule (dynamic, 1)
+#endif
+        for (c = 0; c < number_of_chunks; c++)
+        {
+                first = c * DXF_FACE_SOUP_CHUNK_SIZE;
+                last = first + DXF_FACE_SOUP_CHUNK_SIZE;
+                if (last > count)
+                {
+                        last = count;
+                }
+                chunks[c] = dxf_face_soup_new ();
+                if ((chunks[c] == NULL)
+                  || (dxf_face_soup_reserve (chunks[c], 4 * (last - first),
+                  2 * (last - first)) == EXIT_FAILURE))
+                {
+                        continue;
+                }
+                for (i = first; i < last; i++)
+                {
+                        if (dxf_face_soup_add_entity (chunks[c], types[i], items[i]) == EXIT_FAILURE)
+                        {
+                                dxf_face_soup_free (chunks[c]);
+                                chunks[c] = NULL;
+                                break;
+                        }
+                }
+        }
+        /* Merge the chunks in order. */
+        for (c = 0; c < number_of_chunks; c++)
+        {
+                if ((chunks[c] == NULL)
+                  || ((result == EXIT_SUCCESS)
+                  && (dxf_face_soup_merge (soup, chunks[c]) == EXIT_FAILURE)))
+                {
+                        result = EXIT_FAILURE;
+                }
+                if (chunks[c] != NULL)
+                {
+                        dxf_face_soup_free (chunks[c]);
+                }
+        }
+        free (types);
+        free (items);
+        free (chunks);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,116 @@
+/*!
+ * \file face_soup.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the extraction of a triangle soup from \c 3DFACE,
+ * \c SOLID and \c TRACE entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_FACE_SOUP_H
+#define LIBDXF_SRC_FACE_SOUP_H
+
+
+#include <float.h>
+#include "global.h"
+#include "3dface.h"
+#include "entities.h"
+#include "solid.h"
+#include "trace.h"
+#include "util.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_FACE_SOUP_CHUNK_SIZE 16384
+        /*!< \brief Number of entities per chunk of
+         * dxf_face_soup_add_entities (). */
+
+
+/*!
+ * \brief Triangle soup of \c 3DFACE, \c SOLID and \c TRACE entities.
+ *
+ * Vertices with equal coordinates are stored once.\n
+ * Clearing the buffer keeps the allocated memory.
+ */
+typedef struct
+dxf_face_soup_struct
+{
+        double *vertices;
+                /*!< X-, Y- and Z-values of the vertices in the WCS. */
+        int number_of_vertices;
+                /*!< Number of vertices. */
+        int vertices_size;
+                /*!< Number of vertices allocated in \c vertices. */
+        int *indices;
+                /*!< Zero based indices of the vertices, 3 per
+                 * triangle. */
+        unsigned char *invisible_edges;
+                /*!< Invisible edges of every triangle, bit \c i is set
+                 * when the edge starting at corner \c i is invisible,
+                 * diagonals of split quadrilaterals are invisible. */
+        DxfEntityType *types;
+                /*!< Type of the entity of every triangle. */
+        void **entities;
+                /*!< Entity of every triangle. */
+        int number_of_triangles;
+                /*!< Number of triangles. */
+        int triangles_size;
+                /*!< Number of triangles allocated. */
+        int *hash_table;
+                /*!< Open addressing hash table of the vertices,
+                 * \c -1 for an empty slot. */
+        int hash_size;
+                /*!< Number of slots in \c hash_table, a power of
+                 * two. */
+} DxfFaceSoup;
+
+
+DxfFaceSoup *dxf_face_soup_new ();
+int dxf_face_soup_free (DxfFaceSoup *soup);
+int dxf_face_soup_clear (DxfFaceSoup *soup);
+int dxf_face_soup_reserve (DxfFaceSoup *soup, int number_of_vertices, int number_of_triangles);
+int dxf_face_soup_add_vertex (DxfFaceSoup *soup, double x, double y, double z);
+int dxf_face_soup_add_entity (DxfFaceSoup *soup, DxfEntityType type, void *entity);
+int dxf_face_soup_merge (DxfFaceSoup *soup, DxfFaceSoup *other);
+int dxf_face_soup_add_entities (DxfFaceSoup *soup, DxfEntities *entities);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_FACE_SOUP_H */
+
+
+/* EOF */
@@ -61,14 +61,31 @@ dxf_file_read
         char *filename
                 /*!< filename of input file (or device). */
 )
+{
+        return (dxf_file_read_with_options (filename, NULL));
+}
+
+
+/*!
+ * \brief Function reads the sections of an opened DXF file.
+ *
+ * The sections are handed over to the \c drawing of \c fp, or
+ * discarded when \c fp has no drawing.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_read_sections
+(
+        DxfFile *fp
+                /*!< DXF file handle of input file (or device). */
+)
 {
         char temp_string[DXF_MAX_STRING_LENGTH];
-        DxfFile *fp;
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /* open the file */
-        fp = dxf_read_init (filename);
         if (fp == NULL)
         {
                 fprintf (stderr,
@@ -76,18 +93,20 @@ dxf_file_read
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        while (fp)
+        while (!feof (fp->fp))
         {
                 memset(temp_string, 0, sizeof(temp_string));
                 dxf_read_line (temp_string, fp);
                 if (strcmp (temp_string, "999") == 0)
                 {
-                        /* Flush dxf comments to stdout as some apps put meta
-                         * data regarding the correct loading of libraries in
-                         * front of dxf data (sections, tables, entities etc.
+                        /* Pass dxf comments to the diagnostics sink as some
+                         * apps put meta data regarding the correct loading of
+                         * libraries in front of dxf data (sections, tables,
+                         * entities etc.
                          */
                         dxf_read_line (temp_string, fp);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else if (strcmp (temp_string, "0") == 0)
                 {
@@ -119,7 +138,6 @@ dxf_file_read
                         return (EXIT_FAILURE);
                 }
         }
-        dxf_read_close (fp);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -127,6 +145,57 @@ dxf_file_read
 }
 
 
+/*!
+ * \brief Function opens and reads a DXF file, skipping the entities
+ * rejected by \c options.
+ *
+ * Entities of a type not in the \c entity_types bitmask, or on a layer
+ * rejected by the \c layer_filter of \c options, are skipped by
+ * scanning to the next group code 0 without allocating memory for them
+ * or converting their values.\n
+ * Diagnostics while reading are passed to the \c diagnostics sink of
+ * \c options.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_file_read_with_options
+(
+        char *filename,
+                /*!< filename of input file (or device). */
+        DxfLoadOptions *options
+                /*!< load options, \c NULL loads all entities. */
+)
+{
+        DxfFile *fp;
+        int result;
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* open the file */
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        fp->load_options = (struct DxfLoadOptions *) options;
+        if (options != NULL)
+        {
+                fp->diagnostics = options->diagnostics;
+        }
+        result = dxf_file_read_sections (fp);
+        dxf_read_close (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
 /*!
  * \brief Function generates dxf output to a file for a complete DXF file.
  */
@@ -45,6 +45,7 @@
 #include "class.h"
 #include "entities.h"
 #include "header.h"
+#include "load_options.h"
 #include "object.h"
 #include "section.h"
 #include "table.h"
@@ -58,6 +59,8 @@ extern "C" {
 
 
 int dxf_file_read (char *filename);
+int dxf_file_read_sections (DxfFile *fp);
+int dxf_file_read_with_options (char *filename, DxfLoadOptions *options);
 int dxf_file_write (DxfFile *fp, DxfHeader dxf_header, DxfClass dxf_classes_list, DxfTable dxf_tables_list);
 int dxf_file_write_eof (DxfFile *fp);
 
@@ -141,6 +141,22 @@
          * If not already defined as a compiler directive the default value is
          * 0 (off). */
 
+#ifndef DXF_TRUSTED_INPUT
+#  define DXF_TRUSTED_INPUT 0
+        /*!< \brief Trusted input on/off toggle for applications.
+         *
+         * When on, the getters of the geometry of \c POINT, \c LINE,
+         * \c CIRCLE and \c ARC entities are replaced by their inline
+         * unchecked counterparts, to be used on entities which passed
+         * \c dxf_entities_validate ().\n
+         * When libDXF itself is built with this toggle on,
+         * \c dxf_entities_read () skips the validation pass, the
+         * checked getters remain available to applications built with
+         * the toggle off.\n
+         * If not already defined as a compiler directive the default value is
+         * 0 (off). */
+#endif
+
 #ifndef TRUE
 #  define TRUE 1
         /*!< \brief True is 1. */
@@ -206,6 +222,15 @@ dxf_file_struct
         /*!< AutoCAD version number. */
     int follow_strict_version_rules;
         /*!< follow strict rules when writing to file. */
+    struct DxfLoadOptions *load_options;
+        /*!< Options for skipping entities while reading, \c NULL
+         * loads all entities. */
+    struct DxfDiagnostics *diagnostics;
+        /*!< Sink for diagnostics while reading, \c NULL discards
+         * diagnostics. */
+    struct DxfDrawing *drawing;
+        /*!< Drawing receiving the sections while reading, \c NULL
+         * discards the sections. */
 } DxfFile;
 
 
@@ -605,6 +630,9 @@ dxf_int64_struct
          * symbol table entry. */
 
 
+#include "diagnostic.h"
+
+
 #endif /* LIBDXF_SRC_GLOBAL_H */
 
 
@@ -40,6 +40,7 @@
 
 
 #include "hatch.h"
+#include "util.h"
 
 
 /* dxf_hatch functions. */
@@ -163,8 +164,902 @@ dxf_hatch_init
 }
 
 
+/*!
+ * \brief Parts of a \c HATCH entity, the meaning of some group codes
+ * depends on the part which is being read.
+ */
+#define DXF_HATCH_READ_ENTITY 0
+        /*!< \brief Common members and the hatch header. */
+#define DXF_HATCH_READ_PATHS 1
+        /*!< \brief Boundary paths, following group code 91. */
+#define DXF_HATCH_READ_PATTERN 2
+        /*!< \brief Pattern definition lines, following group code 75. */
+#define DXF_HATCH_READ_SEED_POINTS 3
+        /*!< \brief Seed points, following group code 98. */
+
+
+/*!
+ * \brief Read data from a DXF file into a DXF \c HATCH entity.
+ *
+ * The last line read from file contained the string "HATCH".\n
+ * Now follows some data for the \c HATCH, to be terminated with a "  0"
+ * string announcing the following entity, or the end of the \c ENTITY
+ * section marker \c ENDSEC. \n
+ * Polyline boundary paths are read with their vertices, edge boundary
+ * paths are read with their line, arc and ellipse edges; the data of
+ * spline edges, source object handles and gradient fills is skipped.\n
+ * The closing vertex which dxf_hatch_boundary_path_polyline_write ()
+ * appends to a closed polyline beyond the number of vertices is
+ * skipped.
+ *
+ * \return a pointer to \c hatch, or \c NULL when an error occurred.
+ */
+DxfHatch *
+dxf_hatch_read
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an input file (or device). */
+        DxfHatch *hatch
+                /*!< DXF hatch entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfHatchBoundaryPath *path = NULL;
+        DxfHatchBoundaryPathPolyline *polyline = NULL;
+        DxfHatchBoundaryPathPolylineVertex *vertex = NULL;
+        DxfHatchBoundaryPathPolylineVertex surplus;
+        DxfHatchBoundaryPathEdge *edge = NULL;
+        DxfHatchBoundaryPathEdgeLine *edge_line = NULL;
+        DxfHatchBoundaryPathEdgeArc *edge_arc = NULL;
+        DxfHatchBoundaryPathEdgeEllipse *edge_ellipse = NULL;
+        DxfHatchPatternDefLine *def_line = NULL;
+        DxfHatchPatternDefLineDash *dash = NULL;
+        DxfHatchPatternSeedPoint *seed_point = NULL;
+        int32_t path_type;
+        int16_t edge_type = 0;
+        int number_of_vertices = 0;
+        int part = DXF_HATCH_READ_ENTITY;
+        int iter330 = 0;
+
+        /* Do some basic checks. */
+        if (fp == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL file pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (hatch == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                hatch = dxf_hatch_init (hatch);
+                if (hatch == NULL)
+                {
+                        return (NULL);
+                }
+        }
+        if (hatch->p0 == NULL)
+        {
+                hatch->p0 = dxf_point_init (dxf_point_new ());
+        }
+        if (hatch->binary_graphics_data == NULL)
+        {
+                hatch->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+        }
+        if ((hatch->p0 == NULL) || (hatch->binary_graphics_data == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        memset (&surplus, 0, sizeof (surplus));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
+        {
+                if (ferror (fp->fp))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        return (NULL);
+                }
+                if ((part == DXF_HATCH_READ_PATHS)
+                  && (strcmp (temp_string, "92") == 0))
+                {
+                        /* Now follows a string containing the boundary
+                         * path type flag, which starts a new boundary
+                         * path. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &path_type);
+                        if (path == NULL)
+                        {
+                                path = dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                                hatch->paths = (struct DxfHatchBoundaryPath *) path;
+                        }
+                        else
+                        {
+                                path->next = (struct DxfHatchBoundaryPath *) dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                                path = (DxfHatchBoundaryPath *) path->next;
+                        }
+                        if (path == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        path->type = path_type;
+                        polyline = NULL;
+                        vertex = NULL;
+                        edge = NULL;
+                        edge_line = NULL;
+                        edge_arc = NULL;
+                        edge_ellipse = NULL;
+                        edge_type = 0;
+                        number_of_vertices = 0;
+                        if (path_type & DXF_HATCH_BOUNDARY_PATH_POLYLINE)
+                        {
+                                polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+                                path->polylines = (struct DxfHatchBoundaryPathPolyline *) polyline;
+                        }
+                        else
+                        {
+                                edge = dxf_hatch_boundary_path_edge_init (dxf_hatch_boundary_path_edge_new ());
+                                path->edges = (struct DxfHatchBoundaryPathEdge *) edge;
+                        }
+                        if ((polyline == NULL) && (edge == NULL))
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                }
+                else if ((polyline != NULL)
+                  && (strcmp (temp_string, "10") == 0))
+                {
+                        /* Now follows a string containing the
+                         * X-coordinate of a boundary path polyline
+                         * vertex, which starts a new vertex. */
+                        if ((polyline->number_of_vertices > 0)
+                          && (number_of_vertices >= polyline->number_of_vertices))
+                        {
+                                vertex = &surplus;
+                        }
+                        else
+                        {
+                                DxfHatchBoundaryPathPolylineVertex *next;
+
+                                next = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+                                if (next == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (vertex == NULL)
+                                {
+                                        polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) next;
+                                }
+                                else
+                                {
+                                        vertex->next = (struct DxfHatchBoundaryPathPolylineVertex *) next;
+                                }
+                                vertex = next;
+                                number_of_vertices++;
+                        }
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &vertex->x0);
+                }
+                else if ((vertex != NULL)
+                  && (strcmp (temp_string, "20") == 0))
+                {
+                        /* Now follows a string containing the
+                         * Y-coordinate of a boundary path polyline
+                         * vertex. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &vertex->y0);
+                }
+                else if ((vertex != NULL)
+                  && (strcmp (temp_string, "42") == 0))
+                {
+                        /* Now follows a string containing the bulge of
+                         * a boundary path polyline vertex. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &vertex->bulge);
+                        vertex->has_bulge = 1;
+                }
+                else if ((polyline != NULL)
+                  && (strcmp (temp_string, "72") == 0))
+                {
+                        /* Now follows a string containing the has bulge
+                         * flag, of the polyline before the first vertex
+                         * and of the vertex after a vertex. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &surplus.has_bulge);
+                        if (vertex != NULL)
+                        {
+                                vertex->has_bulge = surplus.has_bulge;
+                        }
+                }
+                else if ((polyline != NULL)
+                  && (strcmp (temp_string, "73") == 0))
+                {
+                        /* Now follows a string containing the is closed
+                         * flag of a boundary path polyline. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &polyline->is_closed);
+                }
+                else if ((polyline != NULL)
+                  && (strcmp (temp_string, "93") == 0))
+                {
+                        /* Now follows a string containing the number of
+                         * vertices of a boundary path polyline. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &polyline->number_of_vertices);
+                }
+                else if ((edge != NULL)
+                  && (strcmp (temp_string, "72") == 0))
+                {
+                        /* Now follows a string containing the edge type,
+                         * which starts a new edge:\n
+                         * 1 = line, 2 = circular arc, 3 = elliptic arc,
+                         * 4 = spline. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &edge_type);
+                        if (edge_type == 1)
+                        {
+                                DxfHatchBoundaryPathEdgeLine *next;
+
+                                next = dxf_hatch_boundary_path_edge_line_init (dxf_hatch_boundary_path_edge_line_new ());
+                                if (next == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (edge_line == NULL)
+                                {
+                                        edge->lines = (struct DxfHatchBoundaryPathEdgeLine *) next;
+                                }
+                                else
+                                {
+                                        edge_line->next = (struct DxfHatchBoundaryPathEdgeLine *) next;
+                                }
+                                edge_line = next;
+                        }
+                        else if (edge_type == 2)
+                        {
+                                DxfHatchBoundaryPathEdgeArc *next;
+
+                                next = dxf_hatch_boundary_path_edge_arc_init (dxf_hatch_boundary_path_edge_arc_new ());
+                                if (next == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (edge_arc == NULL)
+                                {
+                                        edge->arcs = (struct DxfHatchBoundaryPathEdgeArc *) next;
+                                }
+                                else
+                                {
+                                        edge_arc->next = (struct DxfHatchBoundaryPathEdgeArc *) next;
+                                }
+                                edge_arc = next;
+                        }
+                        else if (edge_type == 3)
+                        {
+                                DxfHatchBoundaryPathEdgeEllipse *next;
+
+                                next = dxf_hatch_boundary_path_edge_ellipse_init (dxf_hatch_boundary_path_edge_ellipse_new ());
+                                if (next == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                if (edge_ellipse == NULL)
+                                {
+                                        edge->ellipses = (struct DxfHatchBoundaryPathEdgeEllipse *) next;
+                                }
+                                else
+                                {
+                                        edge_ellipse->next = (struct DxfHatchBoundaryPathEdgeEllipse *) next;
+                                }
+                                edge_ellipse = next;
+                        }
+                        else
+                        {
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_SKIPPED_ENTITY,
+                                  (_("Warning in %s () skipping a spline edge in: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                        }
+                }
+                else if ((edge != NULL)
+                  && (edge_type == 1)
+                  && ((strcmp (temp_string, "10") == 0)
+                  || (strcmp (temp_string, "20") == 0)
+                  || (strcmp (temp_string, "11") == 0)
+                  || (strcmp (temp_string, "21") == 0)))
+                {
+                        /* Now follows a string containing a coordinate
+                         * of the start point (10, 20) or the end point
+                         * (11, 21) of a line edge. */
+                        (fp->line_number)++;
+                        if (strcmp (temp_string, "10") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_line->x0);
+                        else if (strcmp (temp_string, "20") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_line->y0);
+                        else if (strcmp (temp_string, "11") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_line->x1);
+                        else
+                                fscanf (fp->fp, "%lf\n", &edge_line->y1);
+                }
+                else if ((edge != NULL)
+                  && (edge_type == 2)
+                  && ((strcmp (temp_string, "10") == 0)
+                  || (strcmp (temp_string, "20") == 0)
+                  || (strcmp (temp_string, "40") == 0)
+                  || (strcmp (temp_string, "50") == 0)
+                  || (strcmp (temp_string, "51") == 0)
+                  || (strcmp (temp_string, "73") == 0)))
+                {
+                        /* Now follows a string containing the center
+                         * point (10, 20), radius (40), start angle (50),
+                         * end angle (51) or counterclockwise flag (73)
+                         * of an arc edge. */
+                        (fp->line_number)++;
+                        if (strcmp (temp_string, "10") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_arc->x0);
+                        else if (strcmp (temp_string, "20") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_arc->y0);
+                        else if (strcmp (temp_string, "40") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_arc->radius);
+                        else if (strcmp (temp_string, "50") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_arc->start_angle);
+                        else if (strcmp (temp_string, "51") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_arc->end_angle);
+                        else
+                                fscanf (fp->fp, "%hd\n", &edge_arc->is_ccw);
+                }
+                else if ((edge != NULL)
+                  && (edge_type == 3)
+                  && ((strcmp (temp_string, "10") == 0)
+                  || (strcmp (temp_string, "20") == 0)
+                  || (strcmp (temp_string, "11") == 0)
+                  || (strcmp (temp_string, "21") == 0)
+                  || (strcmp (temp_string, "40") == 0)
+                  || (strcmp (temp_string, "50") == 0)
+                  || (strcmp (temp_string, "51") == 0)
+                  || (strcmp (temp_string, "73") == 0)))
+                {
+                        /* Now follows a string containing the center
+                         * point (10, 20), major axis end point (11, 21),
+                         * axis ratio (40), start angle (50), end angle
+                         * (51) or counterclockwise flag (73) of an
+                         * elliptic arc edge. */
+                        (fp->line_number)++;
+                        if (strcmp (temp_string, "10") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->x0);
+                        else if (strcmp (temp_string, "20") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->y0);
+                        else if (strcmp (temp_string, "11") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->x1);
+                        else if (strcmp (temp_string, "21") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->y1);
+                        else if (strcmp (temp_string, "40") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->ratio);
+                        else if (strcmp (temp_string, "50") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->start_angle);
+                        else if (strcmp (temp_string, "51") == 0)
+                                fscanf (fp->fp, "%lf\n", &edge_ellipse->end_angle);
+                        else
+                                fscanf (fp->fp, "%hd\n", &edge_ellipse->is_ccw);
+                }
+                else if ((part == DXF_HATCH_READ_PATHS)
+                  && (path != NULL)
+                  && (strcmp (temp_string, "75") != 0))
+                {
+                        /* Now follows a string containing the number of
+                         * edges (93), spline edge data or a source
+                         * object (97, 330), which are not kept. */
+                        dxf_read_value_line (temp_string, fp);
+                }
+                else if ((part == DXF_HATCH_READ_PATTERN)
+                  && (strcmp (temp_string, "53") == 0))
+                {
+                        /* Now follows a string containing the angle of
+                         * a pattern definition line, which starts a new
+                         * pattern definition line. */
+                        DxfHatchPatternDefLine *next;
+
+                        next = dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+                        if (next == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        if (def_line == NULL)
+                        {
+                                hatch->def_lines = (struct DxfHatchPatternDefLine *) next;
+                        }
+                        else
+                        {
+                                def_line->next = (struct DxfHatchPatternDefLine *) next;
+                        }
+                        def_line = next;
+                        dash = NULL;
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &def_line->angle);
+                }
+                else if ((def_line != NULL)
+                  && ((strcmp (temp_string, "43") == 0)
+                  || (strcmp (temp_string, "44") == 0)
+                  || (strcmp (temp_string, "45") == 0)
+                  || (strcmp (temp_string, "46") == 0)))
+                {
+                        /* Now follows a string containing the base point
+                         * (43, 44) or the offset (45, 46) of a pattern
+                         * definition line. */
+                        (fp->line_number)++;
+                        if (strcmp (temp_string, "43") == 0)
+                                fscanf (fp->fp, "%lf\n", &def_line->x0);
+                        else if (strcmp (temp_string, "44") == 0)
+                                fscanf (fp->fp, "%lf\n", &def_line->y0);
+                        else if (strcmp (temp_string, "45") == 0)
+                                fscanf (fp->fp, "%lf\n", &def_line->x1);
+                        else
+                                fscanf (fp->fp, "%lf\n", &def_line->y1);
+                }
+                else if ((def_line != NULL)
+                  && (strcmp (temp_string, "79") == 0))
+                {
+                        /* Now follows a string containing the number of
+                         * dash items of a pattern definition line. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &def_line->number_of_dash_items);
+                }
+                else if ((def_line != NULL)
+                  && (strcmp (temp_string, "49") == 0))
+                {
+                        /* Now follows a string containing the length of
+                         * a dash, which starts a new dash. */
+                        DxfHatchPatternDefLineDash *next;
+
+                        next = dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+                        if (next == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        if (dash == NULL)
+                        {
+                                def_line->dashes = (struct DxfHatchPatternDefLineDash *) next;
+                        }
+                        else
+                        {
+                                dash->next = (struct DxfHatchPatternDefLineDash *) next;
+                        }
+                        dash = next;
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &dash->length);
+                }
+                else if ((part == DXF_HATCH_READ_SEED_POINTS)
+                  && (strcmp (temp_string, "10") == 0))
+                {
+                        /* Now follows a string containing the
+                         * X-coordinate of a seed point, which starts a
+                         * new seed point. */
+                        DxfHatchPatternSeedPoint *next;
+
+                        next = dxf_hatch_pattern_seedpoint_init (dxf_hatch_pattern_seedpoint_new ());
+                        if (next == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        if (seed_point == NULL)
+                        {
+                                hatch->seed_points = (struct DxfHatchPatternSeedPoint *) next;
+                        }
+                        else
+                        {
+                                seed_point->next = (struct DxfHatchPatternSeedPoint *) next;
+                        }
+                        seed_point = next;
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &seed_point->x0);
+                }
+                else if ((seed_point != NULL)
+                  && (strcmp (temp_string, "20") == 0))
+                {
+                        /* Now follows a string containing the
+                         * Y-coordinate of a seed point. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &seed_point->y0);
+                }
+                else if (strcmp (temp_string, "2") == 0)
+                {
+                        /* Now follows a string containing the pattern
+                         * name. */
+                        dxf_read_string (&hatch->pattern_name, fp);
+                }
+                else if (strcmp (temp_string, "5") == 0)
+                {
+                        /* Now follows a string containing a sequential
+                         * id number. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%x\n", (uint *) &hatch->id_code);
+                }
+                else if (strcmp (temp_string, "6") == 0)
+                {
+                        /* Now follows a string containing a linetype
+                         * name. */
+                        dxf_read_string (&hatch->linetype, fp);
+                }
+                else if (strcmp (temp_string, "8") == 0)
+                {
+                        /* Now follows a string containing a layer name. */
+                        dxf_read_string (&hatch->layer, fp);
+                }
+                else if (strcmp (temp_string, "10") == 0)
+                {
+                        /* Now follows a string containing the
+                         * X-value of the elevation point. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->p0->x0);
+                }
+                else if (strcmp (temp_string, "20") == 0)
+                {
+                        /* Now follows a string containing the
+                         * Y-value of the elevation point. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->p0->y0);
+                }
+                else if (strcmp (temp_string, "30") == 0)
+                {
+                        /* Now follows a string containing the
+                         * Z-value of the elevation point. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->p0->z0);
+                }
+                else if (strcmp (temp_string, "38") == 0)
+                {
+                        /* Now follows a string containing the
+                         * elevation. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->elevation);
+                }
+                else if (strcmp (temp_string, "39") == 0)
+                {
+                        /* Now follows a string containing the
+                         * thickness. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->thickness);
+                }
+                else if (strcmp (temp_string, "41") == 0)
+                {
+                        /* Now follows a string containing the pattern
+                         * scale. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->pattern_scale);
+                }
+                else if (strcmp (temp_string, "47") == 0)
+                {
+                        /* Now follows a string containing the pixel
+                         * size. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->pixel_size);
+                }
+                else if (strcmp (temp_string, "48") == 0)
+                {
+                        /* Now follows a string containing the linetype
+                         * scale. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->linetype_scale);
+                }
+                else if (strcmp (temp_string, "52") == 0)
+                {
+                        /* Now follows a string containing the pattern
+                         * angle. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->pattern_angle);
+                }
+                else if (strcmp (temp_string, "60") == 0)
+                {
+                        /* Now follows a string containing the
+                         * visibility value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->visibility);
+                }
+                else if (strcmp (temp_string, "62") == 0)
+                {
+                        /* Now follows a string containing the
+                         * color value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->color);
+                }
+                else if (strcmp (temp_string, "67") == 0)
+                {
+                        /* Now follows a string containing the
+                         * paperspace value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->paperspace);
+                }
+                else if (strcmp (temp_string, "70") == 0)
+                {
+                        /* Now follows a string containing the solid
+                         * fill flag. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->solid_fill);
+                }
+                else if (strcmp (temp_string, "71") == 0)
+                {
+                        /* Now follows a string containing the
+                         * associativity flag. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->associative);
+                }
+                else if (strcmp (temp_string, "75") == 0)
+                {
+                        /* Now follows a string containing the hatch
+                         * style, the boundary paths are complete. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->hatch_style);
+                        part = DXF_HATCH_READ_PATTERN;
+                        polyline = NULL;
+                        vertex = NULL;
+                        edge = NULL;
+                }
+                else if (strcmp (temp_string, "76") == 0)
+                {
+                        /* Now follows a string containing the hatch
+                         * pattern type. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->hatch_pattern_type);
+                }
+                else if (strcmp (temp_string, "77") == 0)
+                {
+                        /* Now follows a string containing the pattern
+                         * double flag. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->pattern_double);
+                }
+                else if (strcmp (temp_string, "78") == 0)
+                {
+                        /* Now follows a string containing the number of
+                         * pattern definition lines. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->number_of_pattern_def_lines);
+                }
+                else if (strcmp (temp_string, "91") == 0)
+                {
+                        /* Now follows a string containing the number of
+                         * boundary paths, the boundary paths follow. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &hatch->number_of_boundary_paths);
+                        part = DXF_HATCH_READ_PATHS;
+                }
+                else if ((strcmp (temp_string, "92") == 0)
+                  || (strcmp (temp_string, "160") == 0))
+                {
+                        /* Now follows a string containing the
+                         * graphics data size value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &hatch->graphics_data_size);
+                }
+                else if (strcmp (temp_string, "98") == 0)
+                {
+                        /* Now follows a string containing the number of
+                         * seed points, the seed points follow. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &hatch->number_of_seed_points);
+                        part = DXF_HATCH_READ_SEED_POINTS;
+                        def_line = NULL;
+                }
+                else if ((strcmp (temp_string, "100") == 0)
+                  || (strcmp (temp_string, "102") == 0))
+                {
+                        /* Now follows a string containing a subclass
+                         * marker or the start or end of an application
+                         * defined group. */
+                        dxf_read_line (temp_string, fp);
+                }
+                else if (strcmp (temp_string, "210") == 0)
+                {
+                        /* Now follows a string containing the
+                         * X-value of the extrusion vector. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->extr_x0);
+                }
+                else if (strcmp (temp_string, "220") == 0)
+                {
+                        /* Now follows a string containing the
+                         * Y-value of the extrusion vector. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->extr_y0);
+                }
+                else if (strcmp (temp_string, "230") == 0)
+                {
+                        /* Now follows a string containing the
+                         * Z-value of the extrusion vector. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%lf\n", &hatch->extr_z0);
+                }
+                else if (strcmp (temp_string, "284") == 0)
+                {
+                        /* Now follows a string containing the shadow
+                         * mode value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->shadow_mode);
+                }
+                else if (strcmp (temp_string, "310") == 0)
+                {
+                        /* Now follows a string containing binary
+                         * graphics data. */
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, hatch->binary_graphics_data, temp_string);
+                }
+                else if (strcmp (temp_string, "330") == 0)
+                {
+                        if (iter330 == 0)
+                        {
+                                /* Now follows a string containing a soft-pointer
+                                 * ID/handle to owner dictionary. */
+                                dxf_read_string (&hatch->dictionary_owner_soft, fp);
+                        }
+                        else
+                        {
+                                /* Now follows a string containing a soft-pointer
+                                 * ID/handle to owner object. */
+                                dxf_read_string (&hatch->object_owner_soft, fp);
+                        }
+                        iter330++;
+                }
+                else if (strcmp (temp_string, "347") == 0)
+                {
+                        /* Now follows a string containing a
+                         * hard-pointer ID/handle to material object. */
+                        dxf_read_string (&hatch->material, fp);
+                }
+                else if (strcmp (temp_string, "360") == 0)
+                {
+                        /* Now follows a string containing Hard owner
+                         * ID/handle to owner dictionary. */
+                        dxf_read_string (&hatch->dictionary_owner_hard, fp);
+                }
+                else if (strcmp (temp_string, "370") == 0)
+                {
+                        /* Now follows a string containing the lineweight
+                         * value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%hd\n", &hatch->lineweight);
+                }
+                else if (strcmp (temp_string, "390") == 0)
+                {
+                        /* Now follows a string containing a plot style
+                         * name value. */
+                        dxf_read_string (&hatch->plot_style_name, fp);
+                }
+                else if (strcmp (temp_string, "420") == 0)
+                {
+                        /* Now follows a string containing a color value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &hatch->color_value);
+                }
+                else if (strcmp (temp_string, "430") == 0)
+                {
+                        /* Now follows a string containing a color
+                         * name value. */
+                        dxf_read_string (&hatch->color_name, fp);
+                }
+                else if (strcmp (temp_string, "440") == 0)
+                {
+                        /* Now follows a string containing a transparency
+                         * value. */
+                        (fp->line_number)++;
+                        fscanf (fp->fp, "%" PRIi32 "\n", &hatch->transparency);
+                }
+                else if ((atoi (temp_string) >= 450)
+                  && (atoi (temp_string) <= 470))
+                {
+                        /* Now follows a string containing gradient fill
+                         * data, which is not kept. */
+                        dxf_read_value_line (temp_string, fp);
+                }
+                else if (strcmp (temp_string, "999") == 0)
+                {
+                        /* Now follows a string containing a comment. */
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
+                }
+                else
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
+                }
+                dxf_read_line (temp_string, fp);
+        }
+        /* Handle omitted members and/or illegal values. */
+        if (strcmp (hatch->linetype, "") == 0)
+        {
+                free (hatch->linetype);
+                hatch->linetype = strdup (DXF_DEFAULT_LINETYPE);
+        }
+        if (strcmp (hatch->layer, "") == 0)
+        {
+                free (hatch->layer);
+                hatch->layer = strdup (DXF_DEFAULT_LAYER);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (hatch);
+}
+
+
+/*!
+ * \brief Test whether a list of \c HATCH boundary paths can be written.
+ *
+ * Edge boundary paths have no ordered edge list to write the edges
+ * from, only polyline boundary paths can be written.
+ *
+ * \return \c EXIT_SUCCESS when all boundary paths are polyline paths,
+ * or \c EXIT_FAILURE when a path has edges or no data.
+ */
+static int
+dxf_hatch_boundary_path_check
+(
+        DxfHatchBoundaryPath *path
+                /*!< Pointer to DXF Boundary paths (loops). */
+)
+{
+        while (path != NULL)
+        {
+                if ((path->edges != NULL) || (path->polylines == NULL))
+                {
+                        return (EXIT_FAILURE);
+                }
+                path = (DxfHatchBoundaryPath *) path->next;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Write DXF output to a file for a hatch entity (\c HATCH).
+ *
+ * The boundary path type flags are written as they are, the writer does
+ * not change the \c HATCH; mark the outermost boundary paths with
+ * dxf_hatch_fill_mark_outermost () before writing.\n
+ * A \c HATCH with edge boundary paths is discarded from output, only
+ * polyline boundary paths can be written.
  */
 int
 dxf_hatch_write
@@ -219,6 +1114,18 @@ dxf_hatch_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
+        if (dxf_hatch_boundary_path_check ((DxfHatchBoundaryPath *) hatch->paths) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () unsupported boundary path for the %s entity with id-code: %x\n")),
+                  __FUNCTION__, dxf_entity_name, hatch->id_code);
+                fprintf (stderr,
+                  (_("\t%s entity is discarded from output.\n")),
+                  dxf_entity_name);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
         if (strcmp (hatch->layer, "") == 0)
         {
                 fprintf (stderr,
@@ -327,13 +1234,7 @@ dxf_hatch_write
 #endif
                 if (hatch->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) hatch->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, hatch->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -428,8 +1329,12 @@ dxf_hatch_free
         }
         free (hatch->linetype);
         free (hatch->layer);
-        dxf_binary_data_free_list ((DxfBinaryData *) hatch->binary_graphics_data);
+        if (hatch->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (hatch->binary_graphics_data);
+        }
         free (hatch->dictionary_owner_soft);
+        free (hatch->object_owner_soft);
         free (hatch->material);
         free (hatch->dictionary_owner_hard);
         free (hatch->plot_style_name);
@@ -474,6 +1379,7 @@ dxf_hatch_free_list
         while (hatches != NULL)
         {
                 DxfHatch *iter = (DxfHatch *) hatches->next;
+                hatches->next = NULL;
                 dxf_hatch_free (hatches);
                 hatches = (DxfHatch *) iter;
         }
@@ -3508,9 +4414,6 @@ dxf_hatch_get_last
         }
         if (hatch->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatch *) hatch);
         }
         DxfHatch *iter = (DxfHatch *) hatch->next;
@@ -3680,6 +4583,7 @@ dxf_hatch_pattern_free_list
         while (patterns != NULL)
         {
                 DxfHatchPattern *iter = (DxfHatchPattern *) patterns->next;
+                patterns->next = NULL;
                 dxf_hatch_pattern_free (patterns);
                 patterns = (DxfHatchPattern *) iter;
         }
@@ -4180,9 +5084,6 @@ dxf_hatch_pattern_get_last
         }
         if (pattern->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchPattern *) pattern);
         }
         DxfHatchPattern *iter = (DxfHatchPattern *) pattern->next;
@@ -4338,6 +5239,7 @@ dxf_hatch_pattern_def_line_dash_free_list
         while (dashes != NULL)
         {
                 DxfHatchPatternDefLineDash *iter = (DxfHatchPatternDefLineDash *) dashes->next;
+                dashes->next = NULL;
                 dxf_hatch_pattern_def_line_dash_free (dashes);
                 dashes = (DxfHatchPatternDefLineDash *) iter;
         }
@@ -4517,9 +5419,6 @@ dxf_hatch_pattern_def_line_dash_get_last
         }
         if (dash->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchPatternDefLineDash *) dash);
         }
         DxfHatchPatternDefLineDash *iter = (DxfHatchPatternDefLineDash *) dash->next;
@@ -4739,6 +5638,10 @@ dxf_hatch_pattern_def_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        if (line->dashes != NULL)
+        {
+                dxf_hatch_pattern_def_line_dash_free_list ((DxfHatchPatternDefLineDash *) line->dashes);
+        }
         free (line);
         line = NULL;
 #if DEBUG
@@ -4773,6 +5676,7 @@ dxf_hatch_pattern_def_line_free_list
         while (lines != NULL)
         {
                 DxfHatchPatternDefLine *iter = (DxfHatchPatternDefLine *) lines->next;
+                lines->next = NULL;
                 dxf_hatch_pattern_def_line_free (lines);
                 lines = (DxfHatchPatternDefLine *) iter;
         }
@@ -5432,9 +6336,6 @@ dxf_hatch_pattern_def_line_get_last
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchPatternDefLine *) line);
         }
         DxfHatchPatternDefLine *iter = (DxfHatchPatternDefLine *) line->next;
@@ -5643,6 +6544,7 @@ dxf_hatch_pattern_seedpoint_free_list
         while (hatch_pattern_seed_points != NULL)
         {
                 DxfHatchPatternSeedPoint *iter = (DxfHatchPatternSeedPoint *) hatch_pattern_seed_points->next;
+                hatch_pattern_seed_points->next = NULL;
                 dxf_hatch_pattern_seedpoint_free (hatch_pattern_seed_points);
                 hatch_pattern_seed_points = (DxfHatchPatternSeedPoint *) iter;
         }
@@ -5957,9 +6859,6 @@ dxf_hatch_pattern_seedpoint_get_last
         }
         if (point->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchPatternSeedPoint *) point);
         }
         DxfHatchPatternSeedPoint *iter = (DxfHatchPatternSeedPoint *) point->next;
@@ -6045,6 +6944,7 @@ dxf_hatch_boundary_path_init
         }
         /* Assign initial values to members. */
         path->id_code = 0;
+        path->type = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
         path->edges = NULL;
@@ -6060,6 +6960,9 @@ dxf_hatch_boundary_path_init
 /*!
  * \brief Write DXF output to a file for hatch boundary entities.
  *
+ * All boundary paths in the list are written, each starting with it's
+ * type flag, with the \c DXF_HATCH_BOUNDARY_PATH_POLYLINE bit set.\n
+ * Edge boundary paths are refused before anything is written.\n
  * Requires AutoCAD version R14 or higher.
  */
 int
@@ -6091,49 +6994,29 @@ dxf_hatch_boundary_path_write
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
+        if (dxf_hatch_boundary_path_check (path) == EXIT_FAILURE)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () edge boundary paths can not be written.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
         /* Start writing output. */
-        for (;;)
+        while (path != NULL)
         {
-                if (path->next == NULL)
+                fprintf (fp->fp, " 92\n%" PRIi32 "\n",
+                  path->type | DXF_HATCH_BOUNDARY_PATH_POLYLINE);
+                iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
+                while (iter != NULL)
                 {
-                        fprintf (stderr,
-                          (_("Information from %s () last boundary path encountered.\n")),
-                          __FUNCTION__);
-                        break;
-                }
-                else
-                {
-                        /* Test for edge type or polylines type. */
-                        if (path->edges != NULL)
-                        {
-                                /*! \todo Write edges data. */
-                        }
-                        else if (path->polylines != NULL)
-                        {
-                                iter = dxf_hatch_boundary_path_polyline_new ();
-                                iter = (DxfHatchBoundaryPathPolyline *) path->polylines;
-                                for (;;)
-                                {
-                                        dxf_hatch_boundary_path_polyline_write
-                                        (
-                                                fp,
-                                                iter
-                                        );
-                                        iter = (DxfHatchBoundaryPathPolyline *) iter->next;
-                                        if (iter == NULL)
-                                        {
-                                                break;
-                                        }
-                                }
-                        }
-                        else
-                        {
-                                fprintf (stderr,
-                                  (_("Error in %s () unknown boundary path type encountered.\n")),
-                                  __FUNCTION__);
-                                return (EXIT_FAILURE);
-                        }
+                        dxf_hatch_boundary_path_polyline_write
+                        (
+                                fp,
+                                iter
+                        );
+                        iter = (DxfHatchBoundaryPathPolyline *) iter->next;
                 }
+                path = (DxfHatchBoundaryPath *) path->next;
         }
 #if DEBUG
         DXF_DEBUG_END
@@ -6175,8 +7058,14 @@ dxf_hatch_boundary_path_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (path->edges);
-        free (path->polylines);
+        if (path->edges != NULL)
+        {
+                dxf_hatch_boundary_path_edge_free_list ((DxfHatchBoundaryPathEdge *) path->edges);
+        }
+        if (path->polylines != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_free_list ((DxfHatchBoundaryPathPolyline *) path->polylines);
+        }
         free (path);
         path = NULL;
 #if DEBUG
@@ -6211,6 +7100,7 @@ dxf_hatch_boundary_path_free_list
         while (hatch_boundary_paths != NULL)
         {
                 DxfHatchBoundaryPath *iter = (DxfHatchBoundaryPath *) hatch_boundary_paths->next;
+                hatch_boundary_paths->next = NULL;
                 dxf_hatch_boundary_path_free (hatch_boundary_paths);
                 hatch_boundary_paths = (DxfHatchBoundaryPath *) iter;
         }
@@ -6221,12 +7111,87 @@ dxf_hatch_boundary_path_free_list
 
 
 /*!
- * \brief Get the ID code from a DXF \c HATCH boundary path.
+ * \brief Get the ID code from a DXF \c HATCH boundary path.
+ *
+ * \return ID code.
+ */
+int
+dxf_hatch_boundary_path_get_id_code
+(
+        DxfHatchBoundaryPath *path
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (path == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (path->id_code < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was found.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (path->id_code);
+}
+
+
+/*!
+ * \brief Set the ID code for a DXF \c HATCH boundary path.
+ */
+DxfHatchBoundaryPath *
+dxf_hatch_boundary_path_set_id_code
+(
+        DxfHatchBoundaryPath *path,
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+        int id_code
+                /*!< Identification number for the entity.\n
+                 * This is to be an unique (sequential) number in the DXF
+                 * file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (path == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (id_code < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+        }
+        path->id_code = id_code;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (path);
+}
+
+
+/*!
+ * \brief Get the type flag from a DXF \c HATCH boundary path.
  *
- * \return ID code.
+ * \return type flag.
  */
-int
-dxf_hatch_boundary_path_get_id_code
+int32_t
+dxf_hatch_boundary_path_get_type
 (
         DxfHatchBoundaryPath *path
                 /*!< a pointer to a DXF \c HATCH boundary path. */
@@ -6243,7 +7208,7 @@ dxf_hatch_boundary_path_get_id_code
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (path->id_code < 0)
+        if (path->type < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was found.\n")),
@@ -6252,22 +7217,24 @@ dxf_hatch_boundary_path_get_id_code
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (path->id_code);
+        return (path->type);
 }
 
 
 /*!
- * \brief Set the ID code for a DXF \c HATCH boundary path.
+ * \brief Set the type flag for a DXF \c HATCH boundary path.
+ *
+ * The \c DXF_HATCH_BOUNDARY_PATH_POLYLINE and
+ * \c DXF_HATCH_BOUNDARY_PATH_OUTERMOST bits are updated from the path
+ * itself when the \c HATCH is written.
  */
 DxfHatchBoundaryPath *
-dxf_hatch_boundary_path_set_id_code
+dxf_hatch_boundary_path_set_type
 (
         DxfHatchBoundaryPath *path,
                 /*!< a pointer to a DXF \c HATCH boundary path. */
-        int id_code
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
+        int32_t type
+                /*!< Boundary path type flag (bit coded). */
 )
 {
 #if DEBUG
@@ -6281,13 +7248,13 @@ dxf_hatch_boundary_path_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
+        if (type < 0)
         {
                 fprintf (stderr,
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
-        path->id_code = id_code;
+        path->type = type;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6557,9 +7524,6 @@ dxf_hatch_boundary_path_get_last
         }
         if (path->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPath *) path);
         }
         DxfHatchBoundaryPath *iter = (DxfHatchBoundaryPath *) path->next;
@@ -6760,7 +7724,10 @@ dxf_hatch_boundary_path_polyline_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (polyline->vertices);
+        if (polyline->vertices != NULL)
+        {
+                dxf_hatch_boundary_path_polyline_vertex_free_list ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        }
         free (polyline);
         polyline = NULL;
 #if DEBUG
@@ -6782,38 +7749,279 @@ dxf_hatch_boundary_path_polyline_free_list
                  * boundary path polylines. */
 )
 {
-#ifdef DEBUG
+#ifdef DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polylines == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+        }
+        while (polylines != NULL)
+        {
+                DxfHatchBoundaryPathPolyline *iter = (DxfHatchBoundaryPathPolyline *) polylines->next;
+                polylines->next = NULL;
+                dxf_hatch_boundary_path_polyline_free (polylines);
+                polylines = (DxfHatchBoundaryPathPolyline *) iter;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+}
+
+
+/*!
+ * \brief Get the ID code from a DXF \c HATCH boundary path polyline.
+ *
+ * \return ID code.
+ */
+int
+dxf_hatch_boundary_path_polyline_get_id_code
+(
+        DxfHatchBoundaryPathPolyline *polyline
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->id_code < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was found.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline->id_code);
+}
+
+
+/*!
+ * \brief Set the ID code for a DXF \c HATCH boundary path polyline.
+ */
+DxfHatchBoundaryPathPolyline *
+dxf_hatch_boundary_path_polyline_set_id_code
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+        int id_code
+                /*!< Identification number for the entity.\n
+                 * This is to be an unique (sequential) number in the DXF
+                 * file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (id_code < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+        }
+        polyline->id_code = id_code;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+/*!
+ * \brief Get the \c is_closed flag value from a DXF \c HATCH boundary
+ * path polyline.
+ *
+ * \return \c is_closed flag value.
+ */
+int16_t
+dxf_hatch_boundary_path_polyline_get_is_closed
+(
+        DxfHatchBoundaryPathPolyline *polyline
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->is_closed < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was found.\n")),
+                  __FUNCTION__);
+        }
+        if (polyline->is_closed > 1)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () an out of range value was found.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline->is_closed);
+}
+
+
+/*!
+ * \brief Set the \c is_closed flag value for a DXF \c HATCH boundary
+ * path polyline.
+ */
+DxfHatchBoundaryPathPolyline *
+dxf_hatch_boundary_path_polyline_set_is_closed
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+        int16_t is_closed
+                /*!< \c is_closed flag value. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (is_closed < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
+        }
+        if (is_closed > 1)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () an out of range value was passed.\n")),
+                  __FUNCTION__);
+        }
+        polyline->is_closed = is_closed;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+/*!
+ * \brief Get the \c number_of_vertices value from a DXF \c HATCH
+ * boundary path polyline.
+ *
+ * \return \c number_of_vertices value.
+ */
+int32_t
+dxf_hatch_boundary_path_polyline_get_number_of_vertices
+(
+        DxfHatchBoundaryPathPolyline *polyline
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->number_of_vertices < 0)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was found.\n")),
+                  __FUNCTION__);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline->number_of_vertices);
+}
+
+
+/*!
+ * \brief Set the \c number_of_vertices value for a DXF \c HATCH
+ * boundary path polyline.
+ */
+DxfHatchBoundaryPathPolyline *
+dxf_hatch_boundary_path_polyline_set_number_of_vertices
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+        int32_t number_of_vertices
+                /*!< \c number_of_vertices value. */
+)
+{
+#if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
-        if (polylines == NULL)
+        if (polyline == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
+                return (NULL);
         }
-        while (polylines != NULL)
+        if (number_of_vertices < 0)
         {
-                DxfHatchBoundaryPathPolyline *iter = (DxfHatchBoundaryPathPolyline *) polylines->next;
-                dxf_hatch_boundary_path_polyline_free (polylines);
-                polylines = (DxfHatchBoundaryPathPolyline *) iter;
+                fprintf (stderr,
+                  (_("Warning in %s () a negative value was passed.\n")),
+                  __FUNCTION__);
         }
+        polyline->number_of_vertices = number_of_vertices;
 #if DEBUG
         DXF_DEBUG_END
 #endif
+        return (polyline);
 }
 
 
 /*!
- * \brief Get the ID code from a DXF \c HATCH boundary path polyline.
+ * \brief Get the vertices from a DXF \c HATCH boundary path polyline.
  *
- * \return ID code.
+ * \return a pointer to the first vertex.
+ *
+ * \warning No low level copy is made of the series of vertices.
  */
-int
-dxf_hatch_boundary_path_polyline_get_id_code
+DxfHatchBoundaryPathPolylineVertex *
+dxf_hatch_boundary_path_polyline_get_vertices
 (
         DxfHatchBoundaryPathPolyline *polyline
-                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+                /*!< a pointer to a DXF \c HATCH boundary path edge
+                 * polyline. */
 )
 {
 #if DEBUG
@@ -6825,33 +8033,32 @@ dxf_hatch_boundary_path_polyline_get_id_code
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (EXIT_FAILURE);
+                return (NULL);
         }
-        if (polyline->id_code < 0)
+        if (polyline->vertices == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
+                  (_("Error in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
+                return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->id_code);
+        return ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
 }
 
 
 /*!
- * \brief Set the ID code for a DXF \c HATCH boundary path polyline.
+ * \brief Set the vertices for a DXF \c HATCH boundary path polyline.
  */
 DxfHatchBoundaryPathPolyline *
-dxf_hatch_boundary_path_polyline_set_id_code
+dxf_hatch_boundary_path_polyline_set_vertices
 (
         DxfHatchBoundaryPathPolyline *polyline,
                 /*!< a pointer to a DXF \c HATCH boundary path polyline. */
-        int id_code
-                /*!< Identification number for the entity.\n
-                 * This is to be an unique (sequential) number in the DXF
-                 * file. */
+        DxfHatchBoundaryPathPolylineVertex *vertices
+                /*!< a pointer to the first vertex. */
 )
 {
 #if DEBUG
@@ -6865,13 +8072,14 @@ dxf_hatch_boundary_path_polyline_set_id_code
                   __FUNCTION__);
                 return (NULL);
         }
-        if (id_code < 0)
+        if (vertices == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
+                return (NULL);
         }
-        polyline->id_code = id_code;
+        polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertices;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6880,16 +8088,17 @@ dxf_hatch_boundary_path_polyline_set_id_code
 
 
 /*!
- * \brief Get the \c is_closed flag value from a DXF \c HATCH boundary
- * path polyline.
+ * \brief Test if a hatch boundary polyline is closed and add the missing
+ * vertex.
  *
- * \return \c is_closed flag value.
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
-int16_t
-dxf_hatch_boundary_path_polyline_get_is_closed
+int
+dxf_hatch_boundary_path_polyline_close_polyline
 (
         DxfHatchBoundaryPathPolyline *polyline
-                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+                /*!< DXF hatch boundary path polyline entity. */
 )
 {
 #if DEBUG
@@ -6899,121 +8108,409 @@ dxf_hatch_boundary_path_polyline_get_is_closed
         if (polyline == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  (_("Error in %s () invalid pointer to polyline (NULL).\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->is_closed < 0)
+        if (polyline->is_closed == 0)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
+                /* iterate over all vertices until the last vertex,
+                 * append a new vertex with values of the first vertex,
+                 * and set the "is_closed" member to 1. */
+                DxfHatchBoundaryPathPolylineVertex *first;
+                DxfHatchBoundaryPathPolylineVertex *iter;
+                DxfHatchBoundaryPathPolylineVertex *next;
+                first = dxf_hatch_boundary_path_polyline_vertex_new ();
+                iter = dxf_hatch_boundary_path_polyline_vertex_new ();
+                next = dxf_hatch_boundary_path_polyline_vertex_new ();
+                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                iter = first;
+                for (;;)
+                {
+                        if (iter->next == NULL)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                                break;
+                        }
+                        iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                }
+                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                 /*! \todo How do we know what's the last id_code ?
+                  * This should be taken from a global id_code counter. */
+                next->id_code = iter->id_code + 1;
+                next->x0 = first->x0;
+                next->y0 = first->y0;
+                next->next = NULL;
+                iter->next = (struct DxfHatchBoundaryPathPolylineVertex *) next;
+                polyline->is_closed = 1;
         }
-        if (polyline->is_closed > 1)
+        else
         {
-                fprintf (stderr,
-                  (_("Warning in %s () an out of range value was found.\n")),
-                  __FUNCTION__);
+                /* iterate over all vertices until the last vertex,
+                 * test if the values of the last are identical with the
+                 * first vertex, if not: append a vertex with values of
+                 * the first vertex. */
+                DxfHatchBoundaryPathPolylineVertex *first;
+                DxfHatchBoundaryPathPolylineVertex *iter;
+                DxfHatchBoundaryPathPolylineVertex *next;
+                first = dxf_hatch_boundary_path_polyline_vertex_new ();
+                iter = dxf_hatch_boundary_path_polyline_vertex_new ();
+                next = dxf_hatch_boundary_path_polyline_vertex_new ();
+                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                iter = first;
+                for (;;)
+                {
+                        if (iter->next == NULL)
+                        {
+                                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                                break;
+                        }
+                        iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
+                }
+                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+                if (iter->x0 != first->x0 && iter->y0 != first->y0)
+                {
+                        /* the first vertex coordinates are identical to
+                         * the last vertex coordinates: do nothing and
+                         * leave. */
+                }
+                else
+                {
+                        /*! \todo How do we know what's the last id_code ?
+                         * This should be taken from a global id_code counter. */
+                        next->id_code = iter->id_code + 1;
+                        next->x0 = (double) first->x0;
+                        next->y0 = first->y0;
+                        next->next = NULL;
+                        iter->next = (struct DxfHatchBoundaryPathPolylineVertex *) next;
+                }
+                /*! \todo add code here ! */
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->is_closed);
+        return (EXIT_SUCCESS);
 }
 
 
 /*!
- * \brief Set the \c is_closed flag value for a DXF \c HATCH boundary
- * path polyline.
+ * \brief Set up a hatch boundary grid edge from two vertices and the
+ * bulge of the first vertex.
+ *
+ * The bounding box covers the arc of a bulged edge, grown by
+ * \c tolerance.
+ */
+static void
+dxf_hatch_boundary_grid_edge_setup
+(
+        DxfHatchBoundaryGridEdge *edge,
+                /*!< Edge to be set up. */
+        double x0,
+                /*!< X-value of the start point. */
+        double y0,
+                /*!< Y-value of the start point. */
+        double x1,
+                /*!< X-value of the end point. */
+        double y1,
+                /*!< Y-value of the end point. */
+        double bulge,
+                /*!< Bulge of the edge. */
+        double tolerance
+                /*!< Tolerance for points on the edge. */
+)
+{
+        double chord;
+        double factor;
+        double dx;
+        double dy;
+
+        edge->x0 = x0;
+        edge->y0 = y0;
+        edge->x1 = x1;
+        edge->y1 = y1;
+        edge->min_x = (x0 < x1) ? x0 : x1;
+        edge->max_x = (x0 < x1) ? x1 : x0;
+        edge->min_y = (y0 < y1) ? y0 : y1;
+        edge->max_y = (y0 < y1) ? y1 : y0;
+        dx = x1 - x0;
+        dy = y1 - y0;
+        chord = sqrt (dx * dx + dy * dy);
+        if ((bulge == 0.0) || (chord == 0.0))
+        {
+                edge->bulge = 0.0;
+                edge->cx = 0.0;
+                edge->cy = 0.0;
+                edge->radius = 0.0;
+        }
+        else
+        {
+                edge->bulge = bulge;
+                factor = (1.0 - bulge * bulge) / (4.0 * bulge);
+                edge->cx = 0.5 * (x0 + x1) - factor * dy;
+                edge->cy = 0.5 * (y0 + y1) + factor * dx;
+                edge->radius = chord * (1.0 + bulge * bulge) / (4.0 * fabs (bulge));
+                /* A positive bulge runs counterclockwise, the arc lies
+                 * on the right hand side of the chord.  An extreme
+                 * point of the circle belongs to the arc when it lies
+                 * on that side. */
+                if ((dx * (edge->cy - edge->radius - y0) - (edge->cx - x0) * dy) * bulge < 0.0)
+                        edge->min_y = edge->cy - edge->radius;
+                if ((dx * (edge->cy + edge->radius - y0) - (edge->cx - x0) * dy) * bulge < 0.0)
+                        edge->max_y = edge->cy + edge->radius;
+                if ((dx * (edge->cy - y0) - (edge->cx - edge->radius - x0) * dy) * bulge < 0.0)
+                        edge->min_x = edge->cx - edge->radius;
+                if ((dx * (edge->cy - y0) - (edge->cx + edge->radius - x0) * dy) * bulge < 0.0)
+                        edge->max_x = edge->cx + edge->radius;
+        }
+        edge->min_x -= tolerance;
+        edge->min_y -= tolerance;
+        edge->max_x += tolerance;
+        edge->max_y += tolerance;
+}
+
+
+/*!
+ * \brief Add the contribution of an edge to the winding number of a
+ * point.
+ *
+ * The winding number of the chord is counted with the crossing rules of
+ * Dan Sunday, which only need the sign of a cross product and are exact
+ * for points off the edge.\n
+ * A bulged edge adds the winding number of the closed loop made of it's
+ * arc and it's chord, which is the sign of the bulge for points inside
+ * the circular segment between the two, and zero elsewhere.\n
+ * A point on the chord of a bulged edge counts as lying on the side
+ * away from the arc.
+ *
+ * \return \c TRUE when the point lies on the edge within the tolerance,
+ * \c FALSE otherwise.
+ */
+static int
+dxf_hatch_boundary_grid_edge_winding
+(
+        const DxfHatchBoundaryGridEdge *edge,
+                /*!< Edge. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double tolerance,
+                /*!< Tolerance for points on the edge. */
+        int *winding
+                /*!< Winding number to be updated. */
+)
+{
+        double cross;
+        double dx;
+        double dy;
+        double t;
+        double distance;
+        int side;
+
+        dx = edge->x1 - edge->x0;
+        dy = edge->y1 - edge->y0;
+        cross = dx * (y - edge->y0) - (x - edge->x0) * dy;
+        side = (cross > 0.0) - (cross < 0.0);
+        if (edge->bulge == 0.0)
+        {
+                /* Straight edge, test for a point on the edge. */
+                if (tolerance > 0.0)
+                {
+                        t = dx * dx + dy * dy;
+                        t = (t > 0.0)
+                          ? ((x - edge->x0) * dx + (y - edge->y0) * dy) / t
+                          : 0.0;
+                        t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+                        distance = hypot (x - edge->x0 - t * dx, y - edge->y0 - t * dy);
+                        if (distance <= tolerance)
+                        {
+                                return (TRUE);
+                        }
+                }
+                else if ((side == 0)
+                  && (x >= edge->min_x) && (x <= edge->max_x)
+                  && (y >= edge->min_y) && (y <= edge->max_y))
+                {
+                        return (TRUE);
+                }
+        }
+        else
+        {
+                distance = hypot (x - edge->cx, y - edge->cy);
+                if ((fabs (distance - edge->radius) <= tolerance)
+                  && ((cross * edge->bulge <= 0.0)
+                  || (hypot (x - edge->x0, y - edge->y0) <= tolerance)
+                  || (hypot (x - edge->x1, y - edge->y1) <= tolerance)))
+                {
+                        return (TRUE);
+                }
+                if ((distance < edge->radius) && (cross * edge->bulge < 0.0))
+                {
+                        /* Inside the circular segment. */
+                        *winding += (edge->bulge > 0.0) ? 1 : -1;
+                }
+                if (side == 0)
+                {
+                        side = (edge->bulge > 0.0) ? 1 : -1;
+                }
+        }
+        if (edge->y0 <= y)
+        {
+                if ((edge->y1 > y) && (side > 0))
+                {
+                        /* Upward crossing with the point on the
+                         * left. */
+                        (*winding)++;
+                }
+        }
+        else if ((edge->y1 <= y) && (side < 0))
+        {
+                /* Downward crossing with the point on the right. */
+                (*winding)--;
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Test if a point is inside a \c HATCH boundary polyline.
+ *
+ * The winding number of the polyline around the point is computed
+ * without allocating memory, bulged edges are treated as exact arcs.\n
+ * The last vertex connects to the first vertex.
+ *
+ * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
+ * point, \c ON_EDGE if the point lies within \c tolerance of the
+ * polyline, or \c EXIT_FAILURE if an error occurred.
  */
-DxfHatchBoundaryPathPolyline *
-dxf_hatch_boundary_path_polyline_set_is_closed
+int
+dxf_hatch_boundary_path_polyline_classify_point
 (
         DxfHatchBoundaryPathPolyline *polyline,
-                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
-        int16_t is_closed
-                /*!< \c is_closed flag value. */
+                /*!< DXF hatch boundary path polyline entity. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double tolerance
+                /*!< Tolerance for points on the polyline, \c 0.0 for
+                 * exact tests. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
+        DxfHatchBoundaryPathPolylineVertex *first;
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        DxfHatchBoundaryGridEdge edge;
+        int winding;
+
         /* Do some basic checks. */
-        if (polyline == NULL)
+        if ((polyline == NULL) || (polyline->vertices == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
-        }
-        if (is_closed < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        if (is_closed > 1)
+        winding = 0;
+        first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        for (iter = first; iter != NULL; iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () an out of range value was passed.\n")),
-                  __FUNCTION__);
+                next = (iter->next != NULL)
+                  ? (DxfHatchBoundaryPathPolylineVertex *) iter->next
+                  : first;
+                dxf_hatch_boundary_grid_edge_setup (&edge,
+                  iter->x0, iter->y0, next->x0, next->y0,
+                  iter->bulge, tolerance);
+                if ((y < edge.min_y) || (y > edge.max_y) || (x > edge.max_x))
+                {
+                        /* The edge can not contain the point and
+                         * crossings are counted to the right only. */
+                        continue;
+                }
+                if (dxf_hatch_boundary_grid_edge_winding (&edge, x, y, tolerance, &winding))
+                {
+                        return (ON_EDGE);
+                }
         }
-        polyline->is_closed = is_closed;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (polyline);
+        return ((winding != 0) ? INSIDE : OUTSIDE);
 }
 
 
 /*!
- * \brief Get the \c number_of_vertices value from a DXF \c HATCH
- * boundary path polyline.
+ * \brief Classify an array of points against a \c HATCH boundary
+ * polyline.
  *
- * \return \c number_of_vertices value.
+ * See dxf_hatch_boundary_path_polyline_classify_point (), for many
+ * points against the same polyline a boundary grid built with
+ * dxf_hatch_boundary_grid_new () is faster.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
-int32_t
-dxf_hatch_boundary_path_polyline_get_number_of_vertices
+int
+dxf_hatch_boundary_path_polyline_classify_points
 (
-        DxfHatchBoundaryPathPolyline *polyline
-                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        double tolerance,
+                /*!< Tolerance for points on the polyline. */
+        int *results
+                /*!< Receives \c INSIDE, \c OUTSIDE or \c ON_EDGE for
+                 * every point. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
-        if (polyline == NULL)
+        if ((polyline == NULL) || (polyline->vertices == NULL)
+          || (x == NULL) || (y == NULL) || (results == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->number_of_vertices < 0)
+        for (i = 0; i < number_of_points; i++)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was found.\n")),
-                  __FUNCTION__);
+                results[i] = dxf_hatch_boundary_path_polyline_classify_point
+                  (polyline, x[i], y[i], tolerance);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline->number_of_vertices);
+        return (EXIT_SUCCESS);
 }
 
 
 /*!
- * \brief Set the \c number_of_vertices value for a DXF \c HATCH
- * boundary path polyline.
+ * \brief Test if a point is inside a \c HATCH boundary polyline.
+ *
+ * The winding number of the polyline around the point is computed with
+ * exact orientation tests, bulged edges are treated as arcs (see
+ * dxf_hatch_boundary_path_polyline_classify_point ()).\n
+ * A nonzero winding number is an interior point, so self intersecting
+ * polygons are filled with the nonzero rule.
+ *
+ * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
+ * point, \c ON_EDGE if the point lies on the polyline, or
+ * \c EXIT_FAILURE if an error occurred.
  */
-DxfHatchBoundaryPathPolyline *
-dxf_hatch_boundary_path_polyline_set_number_of_vertices
+int
+dxf_hatch_boundary_path_polyline_point_inside_polyline
 (
         DxfHatchBoundaryPathPolyline *polyline,
-                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
-        int32_t number_of_vertices
-                /*!< \c number_of_vertices value. */
+                /*!< DXF hatch boundary path polyline entity. */
+        DxfPoint *point
+                /*!< The point to be tested for. */
 )
 {
 #if DEBUG
@@ -7025,308 +8522,330 @@ dxf_hatch_boundary_path_polyline_set_number_of_vertices
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (EXIT_FAILURE);
         }
-        if (number_of_vertices < 0)
+        if (point == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->is_closed != 1)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () polyline is not a closed polygon.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
         }
-        polyline->number_of_vertices = number_of_vertices;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline);
+        return (dxf_hatch_boundary_path_polyline_classify_point
+          (polyline, point->x0, point->y0, 0.0));
 }
 
 
 /*!
- * \brief Get the vertices from a DXF \c HATCH boundary path polyline.
+ * \brief Get the band of a \c HATCH boundary grid holding a y-value,
+ * clamped to the bands of the grid.
+ */
+static int
+dxf_hatch_boundary_grid_band
+(
+        const DxfHatchBoundaryGrid *grid,
+                /*!< Boundary grid. */
+        double y
+                /*!< Y-value. */
+)
+{
+        int band;
+
+        band = (int) ((y - grid->min_y) / grid->band_height);
+        if (band < 0)
+                band = 0;
+        if (band >= grid->number_of_bands)
+                band = grid->number_of_bands - 1;
+        return (band);
+}
+
+
+/*!
+ * \brief Build a boundary grid for classifying many points against a
+ * \c HATCH boundary polyline.
  *
- * \return a pointer to the first vertex.
+ * The edges of the polyline are flattened into an array and bucketed
+ * into horizontal bands of equal height, a point is only tested against
+ * the edges whose bounding box overlaps it's band.
  *
- * \warning No low level copy is made of the series of vertices.
+ * \return a pointer to the grid, or \c NULL when an error occurred.
  */
-DxfHatchBoundaryPathPolylineVertex *
-dxf_hatch_boundary_path_polyline_get_vertices
+DxfHatchBoundaryGrid *
+dxf_hatch_boundary_grid_new
 (
-        DxfHatchBoundaryPathPolyline *polyline
-                /*!< a pointer to a DXF \c HATCH boundary path edge
-                 * polyline. */
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< DXF hatch boundary path polyline entity. */
+        int number_of_bands,
+                /*!< Number of bands, \c 0 for one band per edge. */
+        double tolerance
+                /*!< Tolerance for points on the polyline. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        DxfHatchBoundaryGrid *grid;
+        DxfHatchBoundaryPathPolylineVertex *first;
+        DxfHatchBoundaryPathPolylineVertex *iter;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        int number_of_edges;
+        int first_band;
+        int last_band;
+        int i;
+        int j;
+
         /* Do some basic checks. */
-        if (polyline == NULL)
+        if ((polyline == NULL) || (polyline->vertices == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (polyline->vertices == NULL)
+        first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        number_of_edges = 0;
+        for (iter = first; iter != NULL; iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                number_of_edges++;
+        }
+        if (number_of_bands <= 0)
+        {
+                number_of_bands = number_of_edges;
+        }
+        grid = calloc (1, sizeof (DxfHatchBoundaryGrid));
+        if (grid == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        grid->edges = malloc (number_of_edges * sizeof (DxfHatchBoundaryGridEdge));
+        grid->band_start = calloc (number_of_bands + 1, sizeof (int));
+        if ((grid->edges == NULL) || (grid->band_start == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_hatch_boundary_grid_free (grid);
+                return (NULL);
+        }
+        grid->number_of_edges = number_of_edges;
+        grid->number_of_bands = number_of_bands;
+        grid->tolerance = tolerance;
+        grid->min_y = DBL_MAX;
+        grid->max_y = -DBL_MAX;
+        i = 0;
+        for (iter = first; iter != NULL; iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next)
+        {
+                next = (iter->next != NULL)
+                  ? (DxfHatchBoundaryPathPolylineVertex *) iter->next
+                  : first;
+                dxf_hatch_boundary_grid_edge_setup (&grid->edges[i],
+                  iter->x0, iter->y0, next->x0, next->y0,
+                  iter->bulge, tolerance);
+                if (grid->edges[i].min_y < grid->min_y)
+                        grid->min_y = grid->edges[i].min_y;
+                if (grid->edges[i].max_y > grid->max_y)
+                        grid->max_y = grid->edges[i].max_y;
+                i++;
+        }
+        grid->band_height = (grid->max_y - grid->min_y) / number_of_bands;
+        if (grid->band_height <= 0.0)
+        {
+                grid->band_height = 1.0;
+        }
+        /* Count the edges per band, then fill the bands (counting
+         * sort). */
+        for (i = 0; i < number_of_edges; i++)
+        {
+                first_band = dxf_hatch_boundary_grid_band (grid, grid->edges[i].min_y);
+                last_band = dxf_hatch_boundary_grid_band (grid, grid->edges[i].max_y);
+                for (j = first_band; j <= last_band; j++)
+                {
+                        grid->band_start[j + 1]++;
+                }
+        }
+        for (j = 0; j < number_of_bands; j++)
+        {
+                grid->band_start[j + 1] += grid->band_start[j];
+        }
+        grid->band_edges = malloc ((grid->band_start[number_of_bands] + 1) * sizeof (int));
+        if (grid->band_edges == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
+                dxf_hatch_boundary_grid_free (grid);
                 return (NULL);
         }
+        for (i = 0; i < number_of_edges; i++)
+        {
+                first_band = dxf_hatch_boundary_grid_band (grid, grid->edges[i].min_y);
+                last_band = dxf_hatch_boundary_grid_band (grid, grid->edges[i].max_y);
+                for (j = first_band; j <= last_band; j++)
+                {
+                        grid->band_edges[grid->band_start[j]++] = i;
+                }
+        }
+        /* Filling advanced every start to the start of the next band,
+         * shift them back. */
+        for (j = number_of_bands; j > 0; j--)
+        {
+                grid->band_start[j] = grid->band_start[j - 1];
+        }
+        grid->band_start[0] = 0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        return (grid);
 }
 
 
 /*!
- * \brief Set the vertices for a DXF \c HATCH boundary path polyline.
+ * \brief Free the allocated memory for a \c HATCH boundary grid.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
-DxfHatchBoundaryPathPolyline *
-dxf_hatch_boundary_path_polyline_set_vertices
+int
+dxf_hatch_boundary_grid_free
 (
-        DxfHatchBoundaryPathPolyline *polyline,
-                /*!< a pointer to a DXF \c HATCH boundary path polyline. */
-        DxfHatchBoundaryPathPolylineVertex *vertices
-                /*!< a pointer to the first vertex. */
+        DxfHatchBoundaryGrid *grid
+                /*!< Pointer to the memory occupied by the grid. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
-        if (polyline == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (vertices == NULL)
+        if (grid == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (EXIT_FAILURE);
         }
-        polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertices;
+        free (grid->edges);
+        free (grid->band_start);
+        free (grid->band_edges);
+        free (grid);
+        grid = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (polyline);
+        return (EXIT_SUCCESS);
 }
 
 
 /*!
- * \brief Test if a hatch boundary polyline is closed and add the missing
- * vertex.
+ * \brief Classify a point against the polyline of a \c HATCH boundary
+ * grid.
  *
- * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
- * occurred.
+ * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
+ * point, \c ON_EDGE if the point lies within the tolerance of the grid
+ * of the polyline, or \c EXIT_FAILURE if an error occurred.
  */
 int
-dxf_hatch_boundary_path_polyline_close_polyline
+dxf_hatch_boundary_grid_classify_point
 (
-        DxfHatchBoundaryPathPolyline *polyline
-                /*!< DXF hatch boundary path polyline entity. */
+        DxfHatchBoundaryGrid *grid,
+                /*!< Boundary grid. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
+        const DxfHatchBoundaryGridEdge *edge;
+        int band;
+        int winding;
+        int i;
+
         /* Do some basic checks. */
-        if (polyline == NULL)
+        if (grid == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () invalid pointer to polyline (NULL).\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->is_closed == 0)
+        if ((y < grid->min_y) || (y > grid->max_y))
         {
-                /* iterate over all vertices until the last vertex,
-                 * append a new vertex with values of the first vertex,
-                 * and set the "is_closed" member to 1. */
-                DxfHatchBoundaryPathPolylineVertex *first;
-                DxfHatchBoundaryPathPolylineVertex *iter;
-                DxfHatchBoundaryPathPolylineVertex *next;
-                first = dxf_hatch_boundary_path_polyline_vertex_new ();
-                iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-                next = dxf_hatch_boundary_path_polyline_vertex_new ();
-                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-                iter = first;
-                for (;;)
-                {
-                        if (iter->next == NULL)
-                        {
-                                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                                break;
-                        }
-                        iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                }
-                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-                 /*! \todo How do we know what's the last id_code ?
-                  * This should be taken from a global id_code counter. */
-                next->id_code = iter->id_code + 1;
-                next->x0 = first->x0;
-                next->y0 = first->y0;
-                next->next = NULL;
-                iter->next = (struct DxfHatchBoundaryPathPolylineVertex *) next;
-                polyline->is_closed = 1;
+                return (OUTSIDE);
         }
-        else
+        band = dxf_hatch_boundary_grid_band (grid, y);
+        winding = 0;
+        for (i = grid->band_start[band]; i < grid->band_start[band + 1]; i++)
         {
-                /* iterate over all vertices until the last vertex,
-                 * test if the values of the last are identical with the
-                 * first vertex, if not: append a vertex with values of
-                 * the first vertex. */
-                DxfHatchBoundaryPathPolylineVertex *first;
-                DxfHatchBoundaryPathPolylineVertex *iter;
-                DxfHatchBoundaryPathPolylineVertex *next;
-                first = dxf_hatch_boundary_path_polyline_vertex_new ();
-                iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-                next = dxf_hatch_boundary_path_polyline_vertex_new ();
-                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-                iter = first;
-                for (;;)
-                {
-                        if (iter->next == NULL)
-                        {
-                                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                                break;
-                        }
-                        iter = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                }
-                first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-                if (iter->x0 != first->x0 && iter->y0 != first->y0)
+                edge = &grid->edges[grid->band_edges[i]];
+                if ((y < edge->min_y) || (y > edge->max_y) || (x > edge->max_x))
                 {
-                        /* the first vertex coordinates are identical to
-                         * the last vertex coordinates: do nothing and
-                         * leave. */
+                        continue;
                 }
-                else
+                if (dxf_hatch_boundary_grid_edge_winding (edge, x, y, grid->tolerance, &winding))
                 {
-                        /*! \todo How do we know what's the last id_code ?
-                         * This should be taken from a global id_code counter. */
-                        next->id_code = iter->id_code + 1;
-                        next->x0 = (double) first->x0;
-                        next->y0 = first->y0;
-                        next->next = NULL;
-                        iter->next = (struct DxfHatchBoundaryPathPolylineVertex *) next;
+                        return (ON_EDGE);
                 }
-                /*! \todo add code here ! */
         }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (EXIT_SUCCESS);
+        return ((winding != 0) ? INSIDE : OUTSIDE);
 }
 
 
 /*!
- * \brief Compute if the coordinates of a point \c p lie inside or
- * outside a DXF hatch boundary path polyline \c polyline entity.
- *
- * \author Paul Bourke <http://www.paulbourke.net/geometry/insidepoly/>\n
- * Adapted for libDXF by Bert Timmerman <bert.timmerman@xs4all.nl>
+ * \brief Classify an array of points against the polyline of a
+ * \c HATCH boundary grid.
  *
- * A solution by Philippe Reverdy is to compute the sum of the angles
- * made between the test point and each pair of points making up the
- * polygon.\n
- * If this sum is (\f$ 2\pi \f$) then the point is an interior point,
- * if 0 then the point is an exterior point.\n
- * This also works for polygons with holes given the polygon is defined
- * with a path made up of coincident edges into and out of the hole as
- * is common practice in many CAD packages.\n
- *
- * \note For most of the "point-in-polygon" algorithms there is a
- * pathological case if the point being queries lies exactly on a
- * vertex.\n
- * The easiest way to cope with this is to test that as a separate
- * process and make your own decision as to whether you want to consider
- * them inside or outside.
- *
- * \note It is assumed that the polygon is simple (does not intersect
- * itself).
- *
- * \return \c INSIDE if an interior point, \c OUTSIDE if an exterior
- * point, or \c EXIT_FAILURE if an error occurred.
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
  */
 int
-dxf_hatch_boundary_path_polyline_point_inside_polyline
+dxf_hatch_boundary_grid_classify_points
 (
-        DxfHatchBoundaryPathPolyline *polyline,
-                /*!< DXF hatch boundary path polyline entity. */
-        DxfPoint *point
-                /*!< The point to be tested for. */
+        DxfHatchBoundaryGrid *grid,
+                /*!< Boundary grid. */
+        const double *x,
+                /*!< X-values of the points. */
+        const double *y,
+                /*!< Y-values of the points. */
+        int number_of_points,
+                /*!< Number of points. */
+        int *results
+                /*!< Receives \c INSIDE, \c OUTSIDE or \c ON_EDGE for
+                 * every point. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        int i;
+
         /* Do some basic checks. */
-        if (polyline == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (point == NULL)
+        if ((grid == NULL) || (x == NULL) || (y == NULL) || (results == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        if (polyline->is_closed != 1)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () polyline is not a closed polygon.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        DxfHatchBoundaryPathPolylineVertex *p0;
-        DxfHatchBoundaryPathPolylineVertex *p1;
-        DxfHatchBoundaryPathPolylineVertex *iter;
-        DxfHatchBoundaryPathPolylineVertex *next;
-        double angle;
-        p0 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        p1 = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = dxf_hatch_boundary_path_polyline_vertex_new ();
-        next = dxf_hatch_boundary_path_polyline_vertex_new ();
-        iter = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
-        next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-        angle = 0;
-        for (;;)
+        for (i = 0; i < number_of_points; i++)
         {
-                if (next == NULL)
-                {
-                        /* iter is the last vertex, no use to continue. */
-                        break;
-                }
-                next = (DxfHatchBoundaryPathPolylineVertex *) iter->next;
-                p0->x0 = iter->x0 - point->x0;
-                p0->y0 = iter->y0 - point->y0;
-                p1->x0 = next->x0 - point->x0;
-                p1->y0 = next->y0 - point->y0;
-                angle += dxf_hatch_boundary_path_polyline_vertex_angle (iter, next);
-                iter = next;
+                results[i] = dxf_hatch_boundary_grid_classify_point (grid, x[i], y[i]);
         }
-        /* clean up. */
-        dxf_hatch_boundary_path_polyline_vertex_free (p0);
-        dxf_hatch_boundary_path_polyline_vertex_free (p1);
-        if (abs (angle) < M_PI)
-                return (OUTSIDE);
-        else
-                return (INSIDE);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        /*! \todo This is a dead code path. */
-        return (EXIT_FAILURE);
+        return (EXIT_SUCCESS);
 }
 
 
@@ -7438,9 +8957,6 @@ dxf_hatch_boundary_path_polyline_get_last
         }
         if (polyline->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathPolyline *) polyline);
         }
         DxfHatchBoundaryPathPolyline *iter = (DxfHatchBoundaryPathPolyline *) polyline->next;
@@ -7653,6 +9169,7 @@ dxf_hatch_boundary_path_polyline_vertex_free_list
         while (hatch_boundary_path_polyline_vertices != NULL)
         {
                 DxfHatchBoundaryPathPolylineVertex *iter = (DxfHatchBoundaryPathPolylineVertex *) hatch_boundary_path_polyline_vertices->next;
+                hatch_boundary_path_polyline_vertices->next = NULL;
                 dxf_hatch_boundary_path_polyline_vertex_free (hatch_boundary_path_polyline_vertices);
                 hatch_boundary_path_polyline_vertices = (DxfHatchBoundaryPathPolylineVertex *) iter;
         }
@@ -8209,9 +9726,6 @@ dxf_hatch_boundary_path_polyline_vertex_get_last
         }
         if (vertex->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathPolylineVertex *) vertex);
         }
         DxfHatchBoundaryPathPolylineVertex *iter = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
@@ -8344,10 +9858,22 @@ dxf_hatch_boundary_path_edge_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (edge->arcs);
-        free (edge->ellipses);
-        free (edge->lines);
-        free (edge->splines);
+        if (edge->arcs != NULL)
+        {
+                dxf_hatch_boundary_path_edge_arc_free_list ((DxfHatchBoundaryPathEdgeArc *) edge->arcs);
+        }
+        if (edge->ellipses != NULL)
+        {
+                dxf_hatch_boundary_path_edge_ellipse_free_list ((DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses);
+        }
+        if (edge->lines != NULL)
+        {
+                dxf_hatch_boundary_path_edge_line_free_list ((DxfHatchBoundaryPathEdgeLine *) edge->lines);
+        }
+        if (edge->splines != NULL)
+        {
+                dxf_hatch_boundary_path_edge_spline_free_list ((DxfHatchBoundaryPathEdgeSpline *) edge->splines);
+        }
         free (edge);
         edge = NULL;
 #if DEBUG
@@ -8382,6 +9908,7 @@ dxf_hatch_boundary_path_edge_free_list
         while (edges != NULL)
         {
                 DxfHatchBoundaryPathEdge *iter = (DxfHatchBoundaryPathEdge *) edges->next;
+                edges->next = NULL;
                 dxf_hatch_boundary_path_edge_free (edges);
                 edges = (DxfHatchBoundaryPathEdge *) iter;
         }
@@ -8886,9 +10413,6 @@ dxf_hatch_boundary_path_edge_get_last
         }
         if (edge->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdge *) edge);
         }
         DxfHatchBoundaryPathEdge *iter = (DxfHatchBoundaryPathEdge *) edge->next;
@@ -9057,6 +10581,7 @@ dxf_hatch_boundary_path_edge_arc_free_list
         while (hatch_boundary_path_edge_arcs != NULL)
         {
                 DxfHatchBoundaryPathEdgeArc *iter = (DxfHatchBoundaryPathEdgeArc *) hatch_boundary_path_edge_arcs->next;
+                hatch_boundary_path_edge_arcs->next = NULL;
                 dxf_hatch_boundary_path_edge_arc_free (hatch_boundary_path_edge_arcs);
                 hatch_boundary_path_edge_arcs = (DxfHatchBoundaryPathEdgeArc *) iter;
         }
@@ -9754,9 +11279,6 @@ dxf_hatch_boundary_path_edge_arc_get_last
         }
         if (arc->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeArc *) arc);
         }
         DxfHatchBoundaryPathEdgeArc *iter = (DxfHatchBoundaryPathEdgeArc *) arc->next;
@@ -9927,6 +11449,7 @@ dxf_hatch_boundary_path_edge_ellipse_free_list
         while (hatch_boundary_path_edge_ellipses != NULL)
         {
                 DxfHatchBoundaryPathEdgeEllipse *iter = (DxfHatchBoundaryPathEdgeEllipse *) hatch_boundary_path_edge_ellipses->next;
+                hatch_boundary_path_edge_ellipses->next = NULL;
                 dxf_hatch_boundary_path_edge_ellipse_free (hatch_boundary_path_edge_ellipses);
                 hatch_boundary_path_edge_ellipses = (DxfHatchBoundaryPathEdgeEllipse *) iter;
         }
@@ -10886,9 +12409,6 @@ dxf_hatch_boundary_path_edge_ellipse_get_last
         }
         if (ellipse->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeEllipse *) ellipse);
         }
         DxfHatchBoundaryPathEdgeEllipse *iter = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next;
@@ -11055,6 +12575,7 @@ dxf_hatch_boundary_path_edge_line_free_list
         while (hatch_boundary_path_edge_lines != NULL)
         {
                 DxfHatchBoundaryPathEdgeLine *iter = (DxfHatchBoundaryPathEdgeLine *) hatch_boundary_path_edge_lines->next;
+                hatch_boundary_path_edge_lines->next = NULL;
                 dxf_hatch_boundary_path_edge_line_free (hatch_boundary_path_edge_lines);
                 hatch_boundary_path_edge_lines = (DxfHatchBoundaryPathEdgeLine *) iter;
         }
@@ -11709,9 +13230,6 @@ dxf_hatch_boundary_path_edge_line_get_last
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeLine *) line);
         }
         DxfHatchBoundaryPathEdgeLine *iter = (DxfHatchBoundaryPathEdgeLine *) line->next;
@@ -11887,6 +13405,7 @@ dxf_hatch_boundary_path_edge_spline_free_list
         while (hatch_boundary_path_edge_splines != NULL)
         {
                 DxfHatchBoundaryPathEdgeSpline *iter = (DxfHatchBoundaryPathEdgeSpline *) hatch_boundary_path_edge_splines->next;
+                hatch_boundary_path_edge_splines->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_free (hatch_boundary_path_edge_splines);
                 hatch_boundary_path_edge_splines = (DxfHatchBoundaryPathEdgeSpline *) iter;
         }
@@ -13989,9 +15508,6 @@ dxf_hatch_boundary_path_edge_spline_get_last
         }
         if (spline->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeSpline *) spline);
         }
         DxfHatchBoundaryPathEdgeSpline *iter = (DxfHatchBoundaryPathEdgeSpline *) spline->next;
@@ -14159,6 +15675,7 @@ dxf_hatch_boundary_path_edge_spline_control_point_free_list
         while (hatch_boundary_path_edge_spline_control_points != NULL)
         {
                 DxfHatchBoundaryPathEdgeSplineCp *iter = (DxfHatchBoundaryPathEdgeSplineCp *) hatch_boundary_path_edge_spline_control_points->next;
+                hatch_boundary_path_edge_spline_control_points->next = NULL;
                 dxf_hatch_boundary_path_edge_spline_control_point_free (hatch_boundary_path_edge_spline_control_points);
                 hatch_boundary_path_edge_spline_control_points = (DxfHatchBoundaryPathEdgeSplineCp *) iter;
         }
@@ -14662,9 +16179,6 @@ dxf_hatch_boundary_path_edge_spline_cp_get_last
         }
         if (control_point->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHatchBoundaryPathEdgeSplineCp *) control_point);
         }
         DxfHatchBoundaryPathEdgeSplineCp *iter = (DxfHatchBoundaryPathEdgeSplineCp *) control_point->next;
@@ -43,6 +43,7 @@
 #define LIBDXF_SRC_HATCH_H
 
 
+#include <float.h>
 #include <math.h>
 
 #include "global.h"
@@ -308,6 +309,86 @@ dxf_hatch_boundary_path_polyline_struct
                  * \c NULL if the last DxfHatchBoundaryPathPolyline. */
 } DxfHatchBoundaryPathPolyline;
 
+/*!
+ * \brief DXF definition of an edge of a \c HATCH boundary grid.
+ *
+ * Bulged edges store the center and radius of their arc.
+ */
+typedef struct
+dxf_hatch_boundary_grid_edge_struct
+{
+        double x0;
+                /*!< X-value of the start point. */
+        double y0;
+                /*!< Y-value of the start point. */
+        double x1;
+                /*!< X-value of the end point. */
+        double y1;
+                /*!< Y-value of the end point. */
+        double bulge;
+                /*!< Bulge, \c 0.0 for a straight edge. */
+        double cx;
+                /*!< X-value of the arc center. */
+        double cy;
+                /*!< Y-value of the arc center. */
+        double radius;
+                /*!< Radius of the arc. */
+        double min_x;
+                /*!< Minimum X-value of the bounding box. */
+        double min_y;
+                /*!< Minimum Y-value of the bounding box. */
+        double max_x;
+                /*!< Maximum X-value of the bounding box. */
+        double max_y;
+                /*!< Maximum Y-value of the bounding box. */
+} DxfHatchBoundaryGridEdge;
+
+
+/*!
+ * \brief DXF definition of a \c HATCH boundary grid.
+ *
+ * The edges of a boundary polyline are bucketed into horizontal bands,
+ * the edges overlapping band \c i are
+ * <tt>band_edges[band_start[i]]</tt> up to
+ * <tt>band_edges[band_start[i + 1] - 1]</tt>.
+ */
+typedef struct
+dxf_hatch_boundary_grid_struct
+{
+        DxfHatchBoundaryGridEdge *edges;
+                /*!< Edges of the polyline. */
+        int number_of_edges;
+                /*!< Number of edges. */
+        double min_y;
+                /*!< Minimum Y-value of the polyline. */
+        double max_y;
+                /*!< Maximum Y-value of the polyline. */
+        int number_of_bands;
+                /*!< Number of bands. */
+        double band_height;
+                /*!< Height of a band. */
+        int *band_start;
+                /*!< Offset of the first edge of every band in
+                 * \c band_edges, \c number_of_bands + 1 entries. */
+        int *band_edges;
+                /*!< Edge indices of all bands. */
+        double tolerance;
+                /*!< Tolerance for points on the polyline. */
+} DxfHatchBoundaryGrid;
+
+
+#define DXF_HATCH_BOUNDARY_PATH_EXTERNAL 1
+        /*!< \brief Boundary path was picked from an external entity. */
+#define DXF_HATCH_BOUNDARY_PATH_POLYLINE 2
+        /*!< \brief Boundary path is a polyline. */
+#define DXF_HATCH_BOUNDARY_PATH_DERIVED 4
+        /*!< \brief Boundary path was derived. */
+#define DXF_HATCH_BOUNDARY_PATH_TEXTBOX 8
+        /*!< \brief Boundary path is a text box. */
+#define DXF_HATCH_BOUNDARY_PATH_OUTERMOST 16
+        /*!< \brief Boundary path is not contained by another boundary
+         * path. */
+
 
 /*!
  * \brief DXF definition of an AutoCAD hatch boundary path (or loop)
@@ -320,6 +401,15 @@ dxf_hatch_boundary_path_struct
                 /*!< Treat the boundary path as if it were a single
                  * (composite) entity.\n
                  * Group code = 5. */
+        int32_t type;
+                /*!< Boundary path type flag (bit coded):\n
+                 * 0 = default\n
+                 * 1 = external\n
+                 * 2 = polyline\n
+                 * 4 = derived\n
+                 * 8 = textbox\n
+                 * 16 = outermost.\n
+                 * Group code = 92. */
         struct DxfHatchBoundaryPathEdge *edges;
                 /*!< Pointer to the first DxfHatchBoundaryPathEdge.\n
                  * \c NULL if there is no DxfHatchBoundaryPathEdge in
@@ -641,6 +731,7 @@ dxf_hatch_struct
 /* dxf_hatch functions. */
 DxfHatch *dxf_hatch_new ();
 DxfHatch *dxf_hatch_init (DxfHatch *hatch);
+DxfHatch *dxf_hatch_read (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_write (DxfFile *fp, DxfHatch *hatch);
 int dxf_hatch_free (DxfHatch *hatch);
 void dxf_hatch_free_list (DxfHatch *hatches);
@@ -799,6 +890,8 @@ int dxf_hatch_boundary_path_free (DxfHatchBoundaryPath *path);
 void dxf_hatch_boundary_path_free_list (DxfHatchBoundaryPath *hatch_boundary_paths);
 int dxf_hatch_boundary_path_get_id_code (DxfHatchBoundaryPath *path);
 DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_id_code (DxfHatchBoundaryPath *path, int id_code);
+int32_t dxf_hatch_boundary_path_get_type (DxfHatchBoundaryPath *path);
+DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_type (DxfHatchBoundaryPath *path, int32_t type);
 DxfHatchBoundaryPathEdge *dxf_hatch_boundary_path_get_edges (DxfHatchBoundaryPath *path);
 DxfHatchBoundaryPath *dxf_hatch_boundary_path_set_edges (DxfHatchBoundaryPath *path, DxfHatchBoundaryPathEdge *edges);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_get_polylines (DxfHatchBoundaryPath *path);
@@ -821,10 +914,17 @@ DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_number_of_ver
 DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_get_vertices (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_vertices (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolylineVertex *vertices);
 int dxf_hatch_boundary_path_polyline_close_polyline (DxfHatchBoundaryPathPolyline *polyline);
+int dxf_hatch_boundary_path_polyline_classify_point (DxfHatchBoundaryPathPolyline *polyline, double x, double y, double tolerance);
+int dxf_hatch_boundary_path_polyline_classify_points (DxfHatchBoundaryPathPolyline *polyline, const double *x, const double *y, int number_of_points, double tolerance, int *results);
 int dxf_hatch_boundary_path_polyline_point_inside_polyline (DxfHatchBoundaryPathPolyline *polyline, DxfPoint *point);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_get_next (DxfHatchBoundaryPathPolyline *polyline);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_set_next (DxfHatchBoundaryPathPolyline *polyline, DxfHatchBoundaryPathPolyline *next);
 DxfHatchBoundaryPathPolyline *dxf_hatch_boundary_path_polyline_get_last (DxfHatchBoundaryPathPolyline *polyline);
+/* dxf_hatch_boundary_grid functions. */
+DxfHatchBoundaryGrid *dxf_hatch_boundary_grid_new (DxfHatchBoundaryPathPolyline *polyline, int number_of_bands, double tolerance);
+int dxf_hatch_boundary_grid_free (DxfHatchBoundaryGrid *grid);
+int dxf_hatch_boundary_grid_classify_point (DxfHatchBoundaryGrid *grid, double x, double y);
+int dxf_hatch_boundary_grid_classify_points (DxfHatchBoundaryGrid *grid, const double *x, const double *y, int number_of_points, int *results);
 /* dxf_hatch_boundary_pathPolyline_vertex functions. */
 DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_new ();
 DxfHatchBoundaryPathPolylineVertex *dxf_hatch_boundary_path_polyline_vertex_init (DxfHatchBoundaryPathPolylineVertex *vertex);
@@ -0,0 +1,2199 @@
+/*!
+ * \file hatch_fill.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for filling DXF \c HATCH boundaries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "hatch_fill.h"
+
+
+/*!
+ * \brief Allocate memory for an empty buffer of hatch segments.
+ *
+ * \return a pointer to the buffer, or \c NULL when no memory could be
+ * allocated.
+ */
+DxfHatchFillSegments *
+dxf_hatch_fill_segments_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillSegments *segments = NULL;
+
+        segments = calloc (1, sizeof (DxfHatchFillSegments));
+        if (segments == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (segments);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a buffer of hatch segments.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_segments_free
+(
+        DxfHatchFillSegments *segments
+                /*!< Buffer of hatch segments. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (segments == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (segments->points);
+        free (segments);
+        segments = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all segments from a buffer of hatch segments, keeping
+ * the allocated memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_segments_clear
+(
+        DxfHatchFillSegments *segments
+                /*!< Buffer of hatch segments. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (segments == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        segments->number_of_segments = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a segment in pattern line coordinates to a buffer,
+ * transformed back to the OCS.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_segment
+(
+        DxfHatchFillSegments *segments,
+        const double *frame,
+                /*!< Base point X and Y, direction X and Y of the
+                 * pattern line family. */
+        double u0,
+        double u1,
+        double v
+)
+{
+        double *points;
+        double *p;
+        int size;
+
+        if (segments->number_of_segments == segments->size)
+        {
+                size = (segments->size > 0) ? 2 * segments->size : 256;
+                points = realloc (segments->points, 6 * (size_t) size * sizeof (double));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                segments->points = points;
+                segments->size = size;
+        }
+        p = segments->points + 6 * (size_t) segments->number_of_segments;
+        p[0] = frame[0] + u0 * frame[2] - v * frame[3];
+        p[1] = frame[1] + u0 * frame[3] + v * frame[2];
+        p[2] = 0.0;
+        p[3] = frame[0] + u1 * frame[2] - v * frame[3];
+        p[4] = frame[1] + u1 * frame[3] + v * frame[2];
+        p[5] = 0.0;
+        segments->number_of_segments++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the dashes of a pattern line overlapping a filled
+ * interval.
+ *
+ * Positive lengths are dashes, negative lengths are gaps and zero
+ * lengths are dots (segments of zero length).\n
+ * A pattern line without dashes, or with a period too short to be
+ * resolved over the interval, is drawn continuous.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_dashes
+(
+        DxfHatchFillSegments *segments,
+        const double *frame,
+        const double *dashes,
+                /*!< Dash lengths. */
+        int number_of_dashes,
+        double period,
+                /*!< Sum of the absolute dash lengths. */
+        double phase,
+                /*!< U-value where the dash pattern of the line starts. */
+        double u0,
+                /*!< Start of the interval. */
+        double u1,
+                /*!< End of the interval. */
+        double v
+                /*!< V-value of the line. */
+)
+{
+        double start;
+        double end;
+        double a;
+        double b;
+        int i;
+
+        if ((number_of_dashes == 0) || (period <= 0.0)
+          || (period * 1.0e6 < u1 - u0))
+        {
+                return (dxf_hatch_fill_add_segment (segments, frame, u0, u1, v));
+        }
+        start = fmod (u0 - phase, period);
+        if (start < 0.0)
+        {
+                start += period;
+        }
+        start = u0 - start;
+        i = 0;
+        while (start <= u1)
+        {
+                end = start + fabs (dashes[i]);
+                if (dashes[i] > 0.0)
+                {
+                        a = (start > u0) ? start : u0;
+                        b = (end < u1) ? end : u1;
+                        if ((a < b)
+                          && (dxf_hatch_fill_add_segment (segments, frame, a, b, v) == EXIT_FAILURE))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+                else if ((dashes[i] == 0.0) && (start >= u0)
+                  && (dxf_hatch_fill_add_segment (segments, frame, start, start, v) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                start = end;
+                i = (i + 1) % number_of_dashes;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare boundary edges by their lowest V-value.
+ */
+static int
+dxf_hatch_fill_compare_edges
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfHatchFillEdge *ea = (const DxfHatchFillEdge *) a;
+        const DxfHatchFillEdge *eb = (const DxfHatchFillEdge *) b;
+
+        return ((ea->v_min < eb->v_min) ? -1 : (ea->v_min > eb->v_min) ? 1 : 0);
+}
+
+
+/*!
+ * \brief Sort the crossings of a scanline by their U-value.
+ *
+ * Insertion sort, the active edges keep their order between
+ * neighbouring scanlines so the crossings are nearly sorted.
+ */
+static void
+dxf_hatch_fill_sort_crossings
+(
+        double *u,
+        int *loop,
+        int n
+)
+{
+        double key;
+        int key_loop;
+        int i;
+        int j;
+
+        for (i = 1; i < n; i++)
+        {
+                key = u[i];
+                key_loop = loop[i];
+                for (j = i - 1; (j >= 0) && (u[j] > key); j--)
+                {
+                        u[j + 1] = u[j];
+                        loop[j + 1] = loop[j];
+                }
+                u[j + 1] = key;
+                loop[j + 1] = key_loop;
+        }
+}
+
+
+/*!
+ * \brief Build the edge table of boundary loops in the coordinates of
+ * a pattern line family.
+ *
+ * Horizontal edges never cross a pattern line and are left out.
+ *
+ * \return the number of edges.
+ */
+static int
+dxf_hatch_fill_build_edges
+(
+        DxfTessellation *loops,
+        const double *frame,
+                /*!< Base point X and Y, direction X and Y of the
+                 * pattern line family. */
+        DxfHatchFillEdge *edges,
+                /*!< Receives the edges. */
+        double *v_min,
+                /*!< Receives the lowest V-value. */
+        double *v_max
+                /*!< Receives the highest V-value. */
+)
+{
+        double ua;
+        double va;
+        double ub;
+        double vb;
+        double temp;
+        int number_of_edges;
+        int c;
+        int i;
+
+        number_of_edges = 0;
+        *v_min = DBL_MAX;
+        *v_max = -DBL_MAX;
+        for (c = 0; c < loops->number_of_curves; c++)
+        {
+                for (i = loops->offsets[c]; i < loops->offsets[c + 1] - 1; i++)
+                {
+                        ua = (loops->points[3 * i] - frame[0]) * frame[2] + (loops->points[3 * i + 1] - frame[1]) * frame[3];
+                        va = (loops->points[3 * i + 1] - frame[1]) * frame[2] - (loops->points[3 * i] - frame[0]) * frame[3];
+                        ub = (loops->points[3 * i + 3] - frame[0]) * frame[2] + (loops->points[3 * i + 4] - frame[1]) * frame[3];
+                        vb = (loops->points[3 * i + 4] - frame[1]) * frame[2] - (loops->points[3 * i + 3] - frame[0]) * frame[3];
+                        if (va == vb)
+                        {
+                                continue;
+                        }
+                        if (va > vb)
+                        {
+                                temp = ua;
+                                ua = ub;
+                                ub = temp;
+                                temp = va;
+                                va = vb;
+                                vb = temp;
+                        }
+                        edges[number_of_edges].u0 = ua;
+                        edges[number_of_edges].slope = (ub - ua) / (vb - va);
+                        edges[number_of_edges].v_min = va;
+                        edges[number_of_edges].v_max = vb;
+                        edges[number_of_edges].loop = c;
+                        number_of_edges++;
+                        *v_min = (va < *v_min) ? va : *v_min;
+                        *v_max = (vb > *v_max) ? vb : *v_max;
+                }
+        }
+        return (number_of_edges);
+}
+
+
+/*!
+ * \brief Generate the pattern lines of one pattern definition line
+ * family clipped to the boundary loops.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_hatch_fill_pattern_family
+(
+        DxfTessellation *loops,
+        int hatch_style,
+        DxfHatchPatternDefLine *def_line,
+        DxfHatchFillSegments *segments
+)
+{
+        DxfHatchPatternDefLineDash *dash;
+        DxfHatchFillEdge *edges = NULL;
+        int *active = NULL;
+        double *crossings = NULL;
+        int *crossing_loops = NULL;
+        char *inside = NULL;
+        double *dashes = NULL;
+        double frame[4];
+        double spacing;
+        double shift;
+        double period;
+        double v_min;
+        double v_max;
+        double u_start = 0.0;
+        double v;
+        long k;
+        long k_min;
+        long k_max;
+        int number_of_edges;
+        int number_of_active;
+        int number_of_dashes;
+        int next_edge;
+        int depth;
+        int filled;
+        int was_filled;
+        int result = EXIT_FAILURE;
+        int i;
+        int j;
+
+        frame[0] = def_line->x0;
+        frame[1] = def_line->y0;
+        frame[2] = cos (def_line->angle * M_PI / 180.0);
+        frame[3] = sin (def_line->angle * M_PI / 180.0);
+        /* The offset splits into the distance between the lines and
+         * the shift of the dash pattern along them. */
+        spacing = -def_line->x1 * frame[3] + def_line->y1 * frame[2];
+        shift = def_line->x1 * frame[2] + def_line->y1 * frame[3];
+        if (spacing < 0.0)
+        {
+                spacing = -spacing;
+                shift = -shift;
+        }
+        if (spacing < 1.0e-12)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () pattern definition line without spacing skipped.\n")),
+                  __FUNCTION__);
+                return (EXIT_SUCCESS);
+        }
+        number_of_dashes = 0;
+        for (dash = (DxfHatchPatternDefLineDash *) def_line->dashes; dash != NULL; dash = (DxfHatchPatternDefLineDash *) dash->next)
+        {
+                number_of_dashes++;
+        }
+        edges = malloc ((loops->number_of_points + 1) * sizeof (DxfHatchFillEdge));
+        active = malloc ((loops->number_of_points + 1) * sizeof (int));
+        crossings = malloc ((loops->number_of_points + 1) * sizeof (double));
+        crossing_loops = malloc ((loops->number_of_points + 1) * sizeof (int));
+        inside = calloc (loops->number_of_curves + 1, 1);
+        dashes = malloc ((number_of_dashes + 1) * sizeof (double));
+        if ((edges == NULL) || (active == NULL) || (crossings == NULL)
+          || (crossing_loops == NULL) || (inside == NULL) || (dashes == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                number_of_edges = -1;
+        }
+        else
+        {
+                period = 0.0;
+                i = 0;
+                for (dash = (DxfHatchPatternDefLineDash *) def_line->dashes; dash != NULL; dash = (DxfHatchPatternDefLineDash *) dash->next)
+                {
+                        dashes[i++] = dash->length;
+                        period += fabs (dash->length);
+                }
+                number_of_edges = dxf_hatch_fill_build_edges (loops, frame,
+                  edges, &v_min, &v_max);
+        }
+        if (number_of_edges == 0)
+        {
+                result = EXIT_SUCCESS;
+        }
+        else if (number_of_edges > 0)
+        {
+                k_min = (long) ceil (v_min / spacing);
+                k_max = (long) floor (v_max / spacing);
+                if (k_max - k_min >= DXF_HATCH_FILL_MAX_LINES)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () pattern is too dense for the boundary.\n")),
+                          __FUNCTION__);
+                }
+                else
+                {
+                        result = EXIT_SUCCESS;
+                        qsort (edges, number_of_edges, sizeof (DxfHatchFillEdge),
+                          dxf_hatch_fill_compare_edges);
+                }
+                number_of_active = 0;
+                next_edge = 0;
+                for (k = k_min; (k <= k_max) && (result == EXIT_SUCCESS); k++)
+                {
+                        v = k * spacing;
+                        /* Edges are active over [v_min, v_max), so a
+                         * scanline through a vertex crosses the
+                         * boundary once. */
+                        j = 0;
+                        for (i = 0; i < number_of_active; i++)
+                        {
+                                if (edges[active[i]].v_max > v)
+                                {
+                                        active[j++] = active[i];
+                                }
+                        }
+                        number_of_active = j;
+                        while ((next_edge < number_of_edges) && (edges[next_edge].v_min <= v))
+                        {
+                                if (edges[next_edge].v_max > v)
+                                {
+                                        active[number_of_active++] = next_edge;
+                                }
+                                next_edge++;
+                        }
+                        for (i = 0; i < number_of_active; i++)
+                        {
+                                crossings[i] = edges[active[i]].u0
+                                  + (v - edges[active[i]].v_min) * edges[active[i]].slope;
+                                crossing_loops[i] = edges[active[i]].loop;
+                        }
+                        dxf_hatch_fill_sort_crossings (crossings, crossing_loops, number_of_active);
+                        /* The depth counts the loops enclosing the
+                         * interval right of a crossing. */
+                        depth = 0;
+                        was_filled = FALSE;
+                        for (i = 0; (i < number_of_active) && (result == EXIT_SUCCESS); i++)
+                        {
+                                inside[crossing_loops[i]] = !inside[crossing_loops[i]];
+                                depth += inside[crossing_loops[i]] ? 1 : -1;
+                                switch (hatch_style)
+                                {
+                                        case 1:
+                                                /* Outer: outermost area
+                                                 * only. */
+                                                filled = (depth == 1);
+                                                break;
+                                        case 2:
+                                                /* Ignore: the entire
+                                                 * area. */
+                                                filled = (depth >= 1);
+                                                break;
+                                        default:
+                                                /* Normal: odd parity. */
+                                                filled = (depth & 1);
+                                                break;
+                                }
+                                if (filled && !was_filled)
+                                {
+                                        u_start = crossings[i];
+                                }
+                                else if (!filled && was_filled
+                                  && (crossings[i] > u_start))
+                                {
+                                        result = dxf_hatch_fill_add_dashes (segments,
+                                          frame, dashes, number_of_dashes,
+                                          period, k * shift, u_start,
+                                          crossings[i], v);
+                                }
+                                was_filled = filled;
+                        }
+                        /* Reset the state of unbalanced (open) loops. */
+                        memset (inside, 0, loops->number_of_curves);
+                }
+        }
+        free (edges);
+        free (active);
+        free (crossings);
+        free (crossing_loops);
+        free (inside);
+        free (dashes);
+        return (result);
+}
+
+
+/*!
+ * \brief Generate hatch pattern lines inside boundary loops.
+ *
+ * Every pattern definition line is swept across the loops with an
+ * active edge table scanline clipper, the filled intervals of every
+ * line follow from the hatch style:
+ * <ol>
+ * <li value = "0"> Normal: areas enclosed by an odd number of
+ * loops.</li>
+ * <li value = "1"> Outer: areas enclosed by exactly one loop.</li>
+ * <li value = "2"> Ignore: areas enclosed by any loop.</li>
+ * </ol>
+ * The dashes of the pattern definition line are applied to the filled
+ * intervals.\n
+ * The loops and the segments are 2D, in the OCS of the hatch.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_pattern_loops
+(
+        DxfTessellation *loops,
+                /*!< Closed boundary loops, each ending with it's first
+                 * point. */
+        int hatch_style,
+                /*!< Hatch style, \c 0, \c 1 or \c 2. */
+        DxfHatchPatternDefLine *def_lines,
+                /*!< Pattern definition lines. */
+        DxfHatchFillSegments *segments
+                /*!< Buffer the segments are appended to. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchPatternDefLine *def_line;
+
+        /* Do some basic checks. */
+        if ((loops == NULL) || (segments == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (def_line = def_lines; def_line != NULL; def_line = (DxfHatchPatternDefLine *) def_line->next)
+        {
+                if (dxf_hatch_fill_pattern_family (loops, hatch_style,
+                  def_line, segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Generate the pattern lines of a \c HATCH entity.
+ *
+ * The boundary paths are tessellated to the tolerance and the pattern
+ * definition lines of the hatch (which are stored scaled and rotated
+ * already) are clipped to them according to the hatch style, see
+ * dxf_hatch_fill_pattern_loops ().\n
+ * The segments are appended to \c segments in the WCS.\n
+ * Solid fills have no pattern lines.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_pattern
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        double tolerance,
+                /*!< Chord height tolerance of curved boundary edges,
+                 * \c 0.0 to only use \c max_segments. */
+        int max_segments,
+                /*!< Maximum number of segments per curved boundary
+                 * edge, \c 0 for no limit. */
+        DxfHatchFillSegments *segments
+                /*!< Buffer the segments are appended to. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellation *loops;
+        DxfHatchPatternDefLine *def_lines;
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double elevation;
+        double x;
+        double y;
+        double *p;
+        int first;
+        int i;
+        int k;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (segments == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        def_lines = (DxfHatchPatternDefLine *) hatch->def_lines;
+        if ((def_lines == NULL) && (hatch->patterns != NULL))
+        {
+                def_lines = (DxfHatchPatternDefLine *) ((DxfHatchPattern *) hatch->patterns)->def_lines;
+        }
+        if ((hatch->solid_fill) || (def_lines == NULL))
+        {
+                return (EXIT_SUCCESS);
+        }
+        loops = dxf_tessellation_new ();
+        if (loops == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        first = segments->number_of_segments;
+        if ((dxf_tessellation_add_hatch_boundary (loops, hatch, tolerance,
+          max_segments) == EXIT_FAILURE)
+          || (dxf_hatch_fill_pattern_loops (loops, hatch->hatch_style,
+          def_lines, segments) == EXIT_FAILURE))
+        {
+                dxf_tessellation_free (loops);
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_free (loops);
+        /* Transform the new segments from the OCS to the WCS. */
+        dxf_ocs_axes (hatch->extr_x0, hatch->extr_y0, hatch->extr_z0, ax, ay, az);
+        elevation = (hatch->p0 != NULL) ? hatch->p0->z0 : hatch->elevation;
+        for (i = 2 * first; i < 2 * segments->number_of_segments; i++)
+        {
+                p = segments->points + 3 * (size_t) i;
+                x = p[0];
+                y = p[1];
+                for (k = 0; k < 3; k++)
+                {
+                        p[k] = x * ax[k] + y * ay[k] + elevation * az[k];
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+
+/*!
+ * \brief Allocate memory for an empty buffer of hatch triangles.
+ *
+ * \return a pointer to the buffer, or \c NULL when no memory could be
+ * allocated.
+ */
+DxfHatchFillTriangles *
+dxf_hatch_fill_triangles_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillTriangles *triangles = NULL;
+
+        triangles = calloc (1, sizeof (DxfHatchFillTriangles));
+        if (triangles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (triangles);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a buffer of hatch triangles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_triangles_free
+(
+        DxfHatchFillTriangles *triangles
+                /*!< Buffer of hatch triangles. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (triangles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (triangles->vertices);
+        free (triangles->indices);
+        free (triangles);
+        triangles = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all vertices and triangles from a buffer of hatch
+ * triangles, keeping the allocated memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_triangles_clear
+(
+        DxfHatchFillTriangles *triangles
+                /*!< Buffer of hatch triangles. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (triangles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        triangles->number_of_vertices = 0;
+        triangles->number_of_triangles = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a triangle to a buffer of hatch triangles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_add_triangle
+(
+        DxfHatchFillTriangles *triangles,
+        int a,
+        int b,
+        int c
+)
+{
+        int *indices;
+        int size;
+
+        if (triangles->number_of_triangles == triangles->indices_size)
+        {
+                size = (triangles->indices_size > 0) ? 2 * triangles->indices_size : 256;
+                indices = realloc (triangles->indices, 3 * (size_t) size * sizeof (int));
+                if (indices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                triangles->indices = indices;
+                triangles->indices_size = size;
+        }
+        triangles->indices[3 * triangles->number_of_triangles] = a;
+        triangles->indices[3 * triangles->number_of_triangles + 1] = b;
+        triangles->indices[3 * triangles->number_of_triangles + 2] = c;
+        triangles->number_of_triangles++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Twice the signed area of the triangle \c a, \c b, \c c,
+ * positive when counterclockwise.
+ */
+static double
+dxf_hatch_fill_cross
+(
+        const DxfHatchFillNode *a,
+        const DxfHatchFillNode *b,
+        const DxfHatchFillNode *c
+)
+{
+        return ((b->x - a->x) * (c->y - a->y) - (b->y - a->y) * (c->x - a->x));
+}
+
+
+/*!
+ * \brief Test if two nodes are at the same position.
+ */
+static int
+dxf_hatch_fill_equal
+(
+        const DxfHatchFillNode *a,
+        const DxfHatchFillNode *b
+)
+{
+        return ((a->x == b->x) && (a->y == b->y));
+}
+
+
+/*!
+ * \brief Remove a node from it's circular list.
+ */
+static void
+dxf_hatch_fill_remove_node
+(
+        DxfHatchFillNode *nodes,
+        int i
+)
+{
+        nodes[nodes[i].prev].next = nodes[i].next;
+        nodes[nodes[i].next].prev = nodes[i].prev;
+}
+
+
+/*!
+ * \brief Test if the diagonal from node \c a to node \c b starts into
+ * the interior of the (counterclockwise) polygon at \c a.
+ */
+static int
+dxf_hatch_fill_locally_inside
+(
+        DxfHatchFillNode *nodes,
+        int a,
+        int b
+)
+{
+        DxfHatchFillNode *pa = &nodes[a];
+
+        if (dxf_hatch_fill_cross (&nodes[pa->prev], pa, &nodes[pa->next]) >= 0.0)
+        {
+                return ((dxf_hatch_fill_cross (pa, &nodes[pa->next], &nodes[b]) >= 0.0)
+                  && (dxf_hatch_fill_cross (pa, &nodes[b], &nodes[pa->prev]) >= 0.0));
+        }
+        return ((dxf_hatch_fill_cross (pa, &nodes[pa->next], &nodes[b]) >= 0.0)
+          || (dxf_hatch_fill_cross (pa, &nodes[b], &nodes[pa->prev]) >= 0.0));
+}
+
+
+/*!
+ * \brief Test if a point lies inside or on a counterclockwise
+ * triangle.
+ */
+static int
+dxf_hatch_fill_in_triangle
+(
+        const DxfHatchFillNode *a,
+        const DxfHatchFillNode *b,
+        const DxfHatchFillNode *c,
+        const DxfHatchFillNode *p
+)
+{
+        return ((dxf_hatch_fill_cross (a, b, p) >= 0.0)
+          && (dxf_hatch_fill_cross (b, c, p) >= 0.0)
+          && (dxf_hatch_fill_cross (c, a, p) >= 0.0));
+}
+
+
+/*!
+ * \brief Remove duplicate and collinear nodes from a circular list.
+ *
+ * \return a node still in the list, or \c -1 when less than 3 nodes
+ * are left.
+ */
+static int
+dxf_hatch_fill_filter_nodes
+(
+        DxfHatchFillNode *nodes,
+        int start
+)
+{
+        int p;
+        int end;
+        int again;
+
+        p = start;
+        end = start;
+        do
+        {
+                again = FALSE;
+                if ((nodes[p].next == p) || (nodes[nodes[p].next].next == p))
+                {
+                        return (-1);
+                }
+                if (dxf_hatch_fill_equal (&nodes[p], &nodes[nodes[p].next])
+                  || (dxf_hatch_fill_cross (&nodes[nodes[p].prev], &nodes[p], &nodes[nodes[p].next]) == 0.0))
+                {
+                        dxf_hatch_fill_remove_node (nodes, p);
+                        p = end = nodes[p].prev;
+                        again = TRUE;
+                }
+                else
+                {
+                        p = nodes[p].next;
+                }
+        }
+        while (again || (p != end));
+        return (end);
+}
+
+
+/*!
+ * \brief Test if the node \c ear cuts off a valid ear.
+ */
+static int
+dxf_hatch_fill_is_ear
+(
+        DxfHatchFillNode *nodes,
+        int ear
+)
+{
+        DxfHatchFillNode *a = &nodes[nodes[ear].prev];
+        DxfHatchFillNode *b = &nodes[ear];
+        DxfHatchFillNode *c = &nodes[nodes[ear].next];
+        DxfHatchFillNode *p;
+        int i;
+
+        if (dxf_hatch_fill_cross (a, b, c) <= 0.0)
+        {
+                /* Reflex or degenerate. */
+                return (FALSE);
+        }
+        /* Only reflex vertices can lie inside a convex corner, copies
+         * of the corners made by hole bridges are skipped. */
+        for (i = c->next; i != b->prev; i = nodes[i].next)
+        {
+                p = &nodes[i];
+                if (!dxf_hatch_fill_equal (p, a) && !dxf_hatch_fill_equal (p, b)
+                  && !dxf_hatch_fill_equal (p, c)
+                  && dxf_hatch_fill_in_triangle (a, b, c, p)
+                  && (dxf_hatch_fill_cross (&nodes[p->prev], p, &nodes[p->next]) <= 0.0))
+                {
+                        return (FALSE);
+                }
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Triangulate a simple counterclockwise polygon by ear clipping.
+ *
+ * When no ear can be found, duplicate and collinear nodes are removed
+ * first and the least reflex corner is cut off as a last resort, so
+ * self touching or near degenerate input always terminates.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_hatch_fill_clip_ears
+(
+        DxfHatchFillNode *nodes,
+        int ear,
+        DxfHatchFillTriangles *triangles
+)
+{
+        double cross;
+        double best_cross;
+        int stop;
+        int pass;
+        int best;
+        int prev;
+        int next;
+        int p;
+
+        ear = dxf_hatch_fill_filter_nodes (nodes, ear);
+        if (ear == -1)
+        {
+                return (EXIT_SUCCESS);
+        }
+        stop = ear;
+        pass = 0;
+        while (nodes[ear].prev != nodes[ear].next)
+        {
+                prev = nodes[ear].prev;
+                next = nodes[ear].next;
+                if (dxf_hatch_fill_is_ear (nodes, ear))
+                {
+                        if (dxf_hatch_fill_add_triangle (triangles,
+                          nodes[prev].index, nodes[ear].index,
+                          nodes[next].index) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        dxf_hatch_fill_remove_node (nodes, ear);
+                        ear = nodes[next].next;
+                        stop = ear;
+                        pass = 0;
+                        continue;
+                }
+                ear = next;
+                if (ear != stop)
+                {
+                        continue;
+                }
+                /* A full round without an ear. */
+                if (pass == 0)
+                {
+                        ear = dxf_hatch_fill_filter_nodes (nodes, ear);
+                        if (ear == -1)
+                        {
+                                return (EXIT_SUCCESS);
+                        }
+                        stop = ear;
+                        pass = 1;
+                        continue;
+                }
+                best = ear;
+                best_cross = -DBL_MAX;
+                p = ear;
+                do
+                {
+                        cross = dxf_hatch_fill_cross (&nodes[nodes[p].prev], &nodes[p], &nodes[nodes[p].next]);
+                        if (cross > best_cross)
+                        {
+                                best_cross = cross;
+                                best = p;
+                        }
+                        p = nodes[p].next;
+                }
+                while (p != ear);
+                prev = nodes[best].prev;
+                next = nodes[best].next;
+                if ((best_cross > 0.0)
+                  && (dxf_hatch_fill_add_triangle (triangles,
+                  nodes[prev].index, nodes[best].index,
+                  nodes[next].index) == EXIT_FAILURE))
+                {
+                        return (EXIT_FAILURE);
+                }
+                dxf_hatch_fill_remove_node (nodes, best);
+                ear = next;
+                stop = ear;
+                pass = 0;
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the node of the outer polygon to bridge a hole to.
+ *
+ * A ray is cast from the leftmost node of the hole to the left, the
+ * nearest edge it hits gives a candidate, which is replaced by the
+ * reflex node inside the triangle spanned by the hole node, the hit
+ * and the candidate with the smallest angle to the ray.
+ *
+ * \return the node, or \c -1 when the hole is outside the polygon.
+ */
+static int
+dxf_hatch_fill_find_bridge
+(
+        DxfHatchFillNode *nodes,
+        int hole,
+        int outer
+)
+{
+        DxfHatchFillNode *h = &nodes[hole];
+        DxfHatchFillNode hit;
+        DxfHatchFillNode *p;
+        DxfHatchFillNode *q;
+        double qx = -DBL_MAX;
+        double x;
+        double tan;
+        double tan_min;
+        int m = -1;
+        int i;
+
+        i = outer;
+        do
+        {
+                p = &nodes[i];
+                q = &nodes[p->next];
+                if ((p->y != q->y)
+                  && (((h->y <= p->y) && (h->y >= q->y)) || ((h->y >= p->y) && (h->y <= q->y))))
+                {
+                        x = p->x + (h->y - p->y) * (q->x - p->x) / (q->y - p->y);
+                        if ((x <= h->x) && (x > qx))
+                        {
+                                qx = x;
+                                m = (p->x < q->x) ? i : p->next;
+                                if (x == h->x)
+                                {
+                                        /* The hole touches the edge. */
+                                        return (m);
+                                }
+                        }
+                }
+                i = p->next;
+        }
+        while (i != outer);
+        if (m == -1)
+        {
+                return (-1);
+        }
+        hit.x = qx;
+        hit.y = h->y;
+        tan_min = DBL_MAX;
+        i = m;
+        q = &nodes[m];
+        x = q->x;
+        do
+        {
+                p = &nodes[i];
+                if ((h->x >= p->x) && (p->x >= x) && (h->x != p->x)
+                  && ((h->y < nodes[m].y)
+                  ? dxf_hatch_fill_in_triangle (h, q, &hit, p)
+                  : dxf_hatch_fill_in_triangle (h, &hit, q, p)))
+                {
+                        tan = fabs (h->y - p->y) / (h->x - p->x);
+                        if (dxf_hatch_fill_locally_inside (nodes, i, hole)
+                          && ((tan < tan_min) || ((tan == tan_min) && (p->x > nodes[m].x))))
+                        {
+                                m = i;
+                                tan_min = tan;
+                        }
+                }
+                i = p->next;
+        }
+        while (i != outer);
+        return (m);
+}
+
+
+/*!
+ * \brief Connect node \c a of the outer polygon and node \c b of a hole
+ * with a pair of coincident edges, copying both nodes.
+ */
+static void
+dxf_hatch_fill_split
+(
+        DxfHatchFillNode *nodes,
+        int *number_of_nodes,
+        int a,
+        int b
+)
+{
+        int a2 = (*number_of_nodes)++;
+        int b2 = (*number_of_nodes)++;
+        int an = nodes[a].next;
+        int bp = nodes[b].prev;
+
+        nodes[a2] = nodes[a];
+        nodes[b2] = nodes[b];
+        nodes[a].next = b;
+        nodes[b].prev = a;
+        nodes[a2].next = an;
+        nodes[an].prev = a2;
+        nodes[b2].next = a2;
+        nodes[a2].prev = b2;
+        nodes[bp].next = b2;
+        nodes[b2].prev = bp;
+}
+
+
+/*!
+ * \brief Link the points of a loop into a circular list of nodes.
+ *
+ * \return the first node, or \c -1 for an empty loop.
+ */
+static int
+dxf_hatch_fill_link_loop
+(
+        DxfTessellation *loops,
+        int loop,
+        int first_vertex,
+                /*!< Index of the output vertex of the first point. */
+        int counterclockwise,
+                /*!< Order the nodes counterclockwise. */
+        double area,
+                /*!< Signed area of the loop. */
+        DxfHatchFillNode *nodes,
+        int *number_of_nodes
+)
+{
+        const double *p;
+        int n;
+        int first;
+        int i;
+        int j;
+        int k;
+
+        n = loops->offsets[loop + 1] - loops->offsets[loop] - 1;
+        if (n < 3)
+        {
+                return (-1);
+        }
+        first = *number_of_nodes;
+        for (j = 0; j < n; j++)
+        {
+                i = ((area > 0.0) == (counterclockwise != 0)) ? j : n - 1 - j;
+                p = loops->points + 3 * (loops->offsets[loop] + i);
+                k = (*number_of_nodes)++;
+                nodes[k].x = p[0];
+                nodes[k].y = p[1];
+                nodes[k].index = first_vertex + i;
+                nodes[k].prev = (j == 0) ? first + n - 1 : k - 1;
+                nodes[k].next = (j == n - 1) ? first : k + 1;
+        }
+        return (first);
+}
+
+
+/*!
+ * \brief Triangulate the areas inside closed boundary loops.
+ *
+ * The loops are nested with dxf_hatch_fill_nest_loops (), the filled
+ * areas follow from the hatch style like in
+ * dxf_hatch_fill_pattern_loops ().
+ * Every filled outer loop is connected to it's holes with bridge edges
+ * and triangulated by ear clipping.\n
+ * The points of the loops (without their closing points) are appended
+ * to the vertices of \c triangles, in the OCS of the hatch, the
+ * triangles are counterclockwise.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_triangulate_loops
+(
+        DxfTessellation *loops,
+                /*!< Closed boundary loops, each ending with it's first
+                 * point. */
+        int hatch_style,
+                /*!< Hatch style, \c 0, \c 1 or \c 2. */
+        DxfHatchFillTriangles *triangles
+                /*!< Buffer the triangles are appended to. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillNode *nodes = NULL;
+        DxfHatchFillLoop *nesting = NULL;
+        int *first_vertex = NULL;
+        int *holes = NULL;
+        double *vertices;
+        double x;
+        int number_of_nodes;
+        int number_of_holes;
+        int result = EXIT_SUCCESS;
+        int outer;
+        int bridge;
+        int size;
+        int c;
+        int h;
+        int i;
+        int j;
+        int n;
+
+        /* Do some basic checks. */
+        if ((loops == NULL) || (triangles == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (loops->number_of_curves == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        /* Append the vertices. */
+        n = triangles->number_of_vertices + loops->number_of_points;
+        if (n > triangles->vertices_size)
+        {
+                size = (triangles->vertices_size > 0) ? triangles->vertices_size : 256;
+                while (size < n)
+                {
+                        size *= 2;
+                }
+                vertices = realloc (triangles->vertices, 3 * (size_t) size * sizeof (double));
+                if (vertices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                triangles->vertices = vertices;
+                triangles->vertices_size = size;
+        }
+        nodes = malloc ((loops->number_of_points + 2 * loops->number_of_curves) * sizeof (DxfHatchFillNode));
+        nesting = malloc (loops->number_of_curves * sizeof (DxfHatchFillLoop));
+        first_vertex = malloc (loops->number_of_curves * sizeof (int));
+        holes = malloc (loops->number_of_curves * sizeof (int));
+        if ((nodes == NULL) || (nesting == NULL) || (first_vertex == NULL)
+          || (holes == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                result = EXIT_FAILURE;
+        }
+        else
+        {
+                for (c = 0; c < loops->number_of_curves; c++)
+                {
+                        first_vertex[c] = triangles->number_of_vertices;
+                        for (i = loops->offsets[c]; i < loops->offsets[c + 1] - 1; i++)
+                        {
+                                memcpy (triangles->vertices + 3 * triangles->number_of_vertices,
+                                  loops->points + 3 * i, 3 * sizeof (double));
+                                triangles->vertices[3 * triangles->number_of_vertices + 2] = 0.0;
+                                triangles->number_of_vertices++;
+                        }
+                }
+                result = dxf_hatch_fill_nest_loops (loops, nesting);
+        }
+        for (c = 0; (c < loops->number_of_curves) && (result == EXIT_SUCCESS); c++)
+        {
+                if ((hatch_style == 0) ? (nesting[c].depth & 1) : (nesting[c].depth != 0))
+                {
+                        continue;
+                }
+                number_of_nodes = 0;
+                outer = dxf_hatch_fill_link_loop (loops, c, first_vertex[c],
+                  TRUE, nesting[c].area, nodes, &number_of_nodes);
+                if ((outer == -1) || (nesting[c].area == 0.0))
+                {
+                        continue;
+                }
+                /* Collect the holes with their leftmost nodes. */
+                number_of_holes = 0;
+                for (h = 0; (h < loops->number_of_curves) && (hatch_style != 2); h++)
+                {
+                        if (nesting[h].parent != c)
+                        {
+                                continue;
+                        }
+                        i = dxf_hatch_fill_link_loop (loops, h, first_vertex[h],
+                          FALSE, nesting[h].area, nodes, &number_of_nodes);
+                        if (i == -1)
+                        {
+                                continue;
+                        }
+                        for (j = nodes[i].next; j != i; j = nodes[j].next)
+                        {
+                                if ((nodes[j].x < nodes[i].x)
+                                  || ((nodes[j].x == nodes[i].x) && (nodes[j].y < nodes[i].y)))
+                                {
+                                        i = j;
+                                }
+                        }
+                        holes[number_of_holes++] = i;
+                }
+                /* Bridge the holes from left to right. */
+                for (i = 1; i < number_of_holes; i++)
+                {
+                        h = holes[i];
+                        x = nodes[h].x;
+                        for (j = i - 1; (j >= 0) && (nodes[holes[j]].x > x); j--)
+                        {
+                                holes[j + 1] = holes[j];
+                        }
+                        holes[j + 1] = h;
+                }
+                for (i = 0; i < number_of_holes; i++)
+                {
+                        bridge = dxf_hatch_fill_find_bridge (nodes, holes[i], outer);
+                        if (bridge == -1)
+                        {
+                                continue;
+                        }
+                        dxf_hatch_fill_split (nodes, &number_of_nodes, bridge, holes[i]);
+                        outer = bridge;
+                }
+                result = dxf_hatch_fill_clip_ears (nodes, outer, triangles);
+        }
+        free (nodes);
+        free (nesting);
+        free (first_vertex);
+        free (holes);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Triangulate the filled area of a \c HATCH entity.
+ *
+ * The boundary paths are tessellated to the tolerance and triangulated
+ * with their islands according to the hatch style, see
+ * dxf_hatch_fill_triangulate_loops ().\n
+ * The vertices are appended to \c triangles in the WCS.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_triangulate
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        double tolerance,
+                /*!< Chord height tolerance of curved boundary edges,
+                 * \c 0.0 to only use \c max_segments. */
+        int max_segments,
+                /*!< Maximum number of segments per curved boundary
+                 * edge, \c 0 for no limit. */
+        DxfHatchFillTriangles *triangles
+                /*!< Buffer the triangles are appended to. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellation *loops;
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double elevation;
+        double x;
+        double y;
+        double *p;
+        int first;
+        int i;
+        int k;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (triangles == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        loops = dxf_tessellation_new ();
+        if (loops == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        first = triangles->number_of_vertices;
+        if ((dxf_tessellation_add_hatch_boundary (loops, hatch, tolerance,
+          max_segments) == EXIT_FAILURE)
+          || (dxf_hatch_fill_triangulate_loops (loops, hatch->hatch_style,
+          triangles) == EXIT_FAILURE))
+        {
+                dxf_tessellation_free (loops);
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_free (loops);
+        /* Transform the new vertices from the OCS to the WCS. */
+        dxf_ocs_axes (hatch->extr_x0, hatch->extr_y0, hatch->extr_z0, ax, ay, az);
+        elevation = (hatch->p0 != NULL) ? hatch->p0->z0 : hatch->elevation;
+        for (i = first; i < triangles->number_of_vertices; i++)
+        {
+                p = triangles->vertices + 3 * (size_t) i;
+                x = p[0];
+                y = p[1];
+                for (k = 0; k < 3; k++)
+                {
+                        p[k] = x * ax[k] + y * ay[k] + elevation * az[k];
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare two loops by the left side of their bounding boxes.
+ */
+static int
+dxf_hatch_fill_compare_loops
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfHatchFillLoop *loop_a = *(DxfHatchFillLoop * const *) a;
+        const DxfHatchFillLoop *loop_b = *(DxfHatchFillLoop * const *) b;
+
+        if (loop_a->min_x < loop_b->min_x)
+        {
+                return (-1);
+        }
+        if (loop_a->min_x > loop_b->min_x)
+        {
+                return (1);
+        }
+        return (0);
+}
+
+
+/*!
+ * \brief Get the row or column of the grid holding a value.
+ */
+static int
+dxf_hatch_fill_grid_cell
+(
+        double value,
+        double min,
+        double cell_size,
+        int count
+)
+{
+        int cell;
+
+        cell = (int) ((value - min) / cell_size);
+        if (cell < 0)
+        {
+                cell = 0;
+        }
+        if (cell >= count)
+        {
+                cell = count - 1;
+        }
+        return (cell);
+}
+
+
+/*!
+ * \brief Add an edge to all cells of the grid it crosses.
+ *
+ * The edge is clipped to every row it spans, when \c cell_edges is
+ * still \c NULL only the edges per cell are counted.
+ */
+static void
+dxf_hatch_fill_grid_add_edge
+(
+        DxfHatchFillGrid *grid,
+        const double *p,
+                /*!< Start and end point of the edge. */
+        int edge
+                /*!< Index of the first point of the edge. */
+)
+{
+        double y_min = (p[1] < p[4]) ? p[1] : p[4];
+        double y_max = (p[1] < p[4]) ? p[4] : p[1];
+        double slope = (p[3] - p[0]) / (p[4] - p[1]);
+        double lo;
+        double hi;
+        double xa;
+        double xb;
+        int row;
+        int last_row;
+        int column;
+        int last_column;
+        int cell;
+
+        row = dxf_hatch_fill_grid_cell (y_min, grid->min_y, grid->cell_size, grid->rows);
+        last_row = dxf_hatch_fill_grid_cell (y_max, grid->min_y, grid->cell_size, grid->rows);
+        for (; row <= last_row; row++)
+        {
+                lo = grid->min_y + row * grid->cell_size;
+                hi = lo + grid->cell_size;
+                lo = (lo > y_min) ? lo : y_min;
+                hi = (hi < y_max) ? hi : y_max;
+                xa = p[0] + (lo - p[1]) * slope;
+                xb = p[0] + (hi - p[1]) * slope;
+                column = dxf_hatch_fill_grid_cell ((xa < xb) ? xa : xb,
+                  grid->min_x, grid->cell_size, grid->columns);
+                last_column = dxf_hatch_fill_grid_cell ((xa < xb) ? xb : xa,
+                  grid->min_x, grid->cell_size, grid->columns);
+                for (; column <= last_column; column++)
+                {
+                        cell = row * grid->columns + column;
+                        if (grid->cell_edges == NULL)
+                        {
+                                grid->cell_start[cell + 1]++;
+                        }
+                        else
+                        {
+                                grid->cell_edges[grid->cell_start[cell]++] = edge;
+                        }
+                }
+        }
+}
+
+
+/*!
+ * \brief Compute the orientation, bounding box and containment tree of
+ * closed boundary loops.
+ *
+ * The edges are put in a uniform grid and the loops are visited from
+ * left to right.
+ * A ray cast from the leftmost point of a loop to the left hits the
+ * nearest edge of another loop, this loop is the parent when the
+ * point lies on it's inner side, else a sibling sharing the parent.
+ * The ray walks the grid cells until a hit is found, so evenly spread
+ * loops take O(n log n) time instead of testing every pair of loops.\n
+ * Loops are expected not to cross each other.
+ * The \c path member of \c nesting is left untouched.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_nest_loops
+(
+        DxfTessellation *loops,
+                /*!< Closed boundary loops, each ending with it's first
+                 * point. */
+        DxfHatchFillLoop *nesting
+                /*!< Array of \c number_of_curves entries receiving the
+                 * nesting of every loop. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillGrid grid;
+        DxfHatchFillLoop **order = NULL;
+        DxfHatchFillLoop *loop;
+        const double *p;
+        double max_x = -DBL_MAX;
+        double max_y = -DBL_MAX;
+        double best;
+        double left;
+        double px;
+        double py;
+        double x;
+        int *point_loop = NULL;
+        int number_of_edges = 0;
+        int number_of_cells;
+        int row;
+        int column;
+        int cell;
+        int hit;
+        int up = FALSE;
+        int c;
+        int i;
+        int j;
+
+        /* Do some basic checks. */
+        if ((loops == NULL) || (nesting == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Orientation and bounding boxes. */
+        grid.min_x = DBL_MAX;
+        grid.min_y = DBL_MAX;
+        for (c = 0; c < loops->number_of_curves; c++)
+        {
+                loop = &nesting[c];
+                loop->area = 0.0;
+                loop->min_x = loop->min_y = 0.0;
+                loop->max_x = loop->max_y = 0.0;
+                loop->parent = -1;
+                loop->depth = 0;
+                if (loops->offsets[c + 1] == loops->offsets[c])
+                {
+                        continue;
+                }
+                p = loops->points + 3 * loops->offsets[c];
+                loop->min_x = loop->max_x = p[0];
+                loop->min_y = loop->max_y = p[1];
+                for (i = loops->offsets[c]; i < loops->offsets[c + 1]; i++)
+                {
+                        p = loops->points + 3 * i;
+                        loop->min_x = (p[0] < loop->min_x) ? p[0] : loop->min_x;
+                        loop->min_y = (p[1] < loop->min_y) ? p[1] : loop->min_y;
+                        loop->max_x = (p[0] > loop->max_x) ? p[0] : loop->max_x;
+                        loop->max_y = (p[1] > loop->max_y) ? p[1] : loop->max_y;
+                        if (i < loops->offsets[c + 1] - 1)
+                        {
+                                loop->area += p[0] * p[4] - p[3] * p[1];
+                                number_of_edges++;
+                        }
+                }
+                loop->area *= 0.5;
+                grid.min_x = (loop->min_x < grid.min_x) ? loop->min_x : grid.min_x;
+                grid.min_y = (loop->min_y < grid.min_y) ? loop->min_y : grid.min_y;
+                max_x = (loop->max_x > max_x) ? loop->max_x : max_x;
+                max_y = (loop->max_y > max_y) ? loop->max_y : max_y;
+        }
+        if (number_of_edges == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        /* Aim at about four edges per cell, without degenerating for
+         * flat extents. */
+        number_of_cells = number_of_edges / 4 + 1;
+        grid.cell_size = sqrt ((max_x - grid.min_x) * (max_y - grid.min_y) / number_of_cells);
+        x = (max_x - grid.min_x > max_y - grid.min_y)
+          ? (max_x - grid.min_x) : (max_y - grid.min_y);
+        if (grid.cell_size < x / number_of_cells)
+        {
+                grid.cell_size = x / number_of_cells;
+        }
+        if (!(grid.cell_size > 0.0))
+        {
+                grid.cell_size = 1.0;
+        }
+        grid.columns = (int) ((max_x - grid.min_x) / grid.cell_size) + 1;
+        grid.rows = (int) ((max_y - grid.min_y) / grid.cell_size) + 1;
+        number_of_cells = grid.columns * grid.rows;
+        grid.cell_edges = NULL;
+        grid.cell_start = calloc (number_of_cells + 1, sizeof (int));
+        order = malloc (loops->number_of_curves * sizeof (DxfHatchFillLoop *));
+        point_loop = malloc (loops->number_of_points * sizeof (int));
+        if ((grid.cell_start == NULL) || (order == NULL) || (point_loop == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (grid.cell_start);
+                free (order);
+                free (point_loop);
+                return (EXIT_FAILURE);
+        }
+        /* Count the edges per cell, horizontal edges are never hit. */
+        for (c = 0; c < loops->number_of_curves; c++)
+        {
+                order[c] = &nesting[c];
+                for (i = loops->offsets[c]; i < loops->offsets[c + 1]; i++)
+                {
+                        point_loop[i] = c;
+                }
+                for (i = loops->offsets[c]; i < loops->offsets[c + 1] - 1; i++)
+                {
+                        p = loops->points + 3 * i;
+                        if (p[1] != p[4])
+                        {
+                                dxf_hatch_fill_grid_add_edge (&grid, p, i);
+                        }
+                }
+        }
+        for (cell = 0; cell < number_of_cells; cell++)
+        {
+                grid.cell_start[cell + 1] += grid.cell_start[cell];
+        }
+        grid.cell_edges = malloc ((grid.cell_start[number_of_cells] + 1) * sizeof (int));
+        if (grid.cell_edges == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (grid.cell_start);
+                free (order);
+                free (point_loop);
+                return (EXIT_FAILURE);
+        }
+        /* Fill the cells, cell_start is shifted by one cell meanwhile. */
+        for (i = 0; i < loops->number_of_points - 1; i++)
+        {
+                p = loops->points + 3 * i;
+                if ((i + 1 < loops->offsets[point_loop[i] + 1]) && (p[1] != p[4]))
+                {
+                        dxf_hatch_fill_grid_add_edge (&grid, p, i);
+                }
+        }
+        for (cell = number_of_cells; cell > 0; cell--)
+        {
+                grid.cell_start[cell] = grid.cell_start[cell - 1];
+        }
+        grid.cell_start[0] = 0;
+        /* Visit the loops from left to right, a hit loop always lies
+         * further to the left and is nested already. */
+        qsort (order, loops->number_of_curves, sizeof (DxfHatchFillLoop *),
+          dxf_hatch_fill_compare_loops);
+        for (j = 0; j < loops->number_of_curves; j++)
+        {
+                loop = order[j];
+                c = (int) (loop - nesting);
+                if (loops->offsets[c + 1] - loops->offsets[c] < 2)
+                {
+                        continue;
+                }
+                for (i = loops->offsets[c]; loops->points[3 * i] != loop->min_x; i++)
+                {
+                }
+                px = loops->points[3 * i];
+                py = loops->points[3 * i + 1];
+                row = dxf_hatch_fill_grid_cell (py, grid.min_y, grid.cell_size, grid.rows);
+                column = dxf_hatch_fill_grid_cell (px, grid.min_x, grid.cell_size, grid.columns);
+                best = -DBL_MAX;
+                hit = -1;
+                for (; column >= 0; column--)
+                {
+                        cell = row * grid.columns + column;
+                        for (i = grid.cell_start[cell]; i < grid.cell_start[cell + 1]; i++)
+                        {
+                                if (point_loop[grid.cell_edges[i]] == c)
+                                {
+                                        continue;
+                                }
+                                p = loops->points + 3 * grid.cell_edges[i];
+                                if ((p[1] > py) == (p[4] > py))
+                                {
+                                        continue;
+                                }
+                                x = p[0] + (py - p[1]) * (p[3] - p[0]) / (p[4] - p[1]);
+                                if ((x < px) && (x > best))
+                                {
+                                        best = x;
+                                        hit = point_loop[grid.cell_edges[i]];
+                                        up = (p[4] > p[1]);
+                                }
+                        }
+                        /* Hits further left can not be nearer, allow
+                         * for rounding at the cell border. */
+                        left = grid.min_x + column * grid.cell_size;
+                        if (best > left + 1e-9 * (fabs (left) + grid.cell_size))
+                        {
+                                break;
+                        }
+                }
+                if (hit == -1)
+                {
+                        continue;
+                }
+                /* Inside a counterclockwise loop the edges to the left
+                 * run downwards. */
+                if ((nesting[hit].area != 0.0) && (up != (nesting[hit].area > 0.0)))
+                {
+                        loop->parent = hit;
+                        loop->depth = nesting[hit].depth + 1;
+                }
+                else
+                {
+                        loop->parent = nesting[hit].parent;
+                        loop->depth = nesting[hit].depth;
+                }
+        }
+        free (grid.cell_start);
+        free (grid.cell_edges);
+        free (order);
+        free (point_loop);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Tessellate the boundary paths of a \c HATCH and compute the
+ * containment tree of the loops.
+ *
+ * \return a pointer to the nesting, or \c NULL when an error occurred.
+ */
+DxfHatchFillNesting *
+dxf_hatch_fill_nesting_new
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        double tolerance,
+                /*!< Chord height tolerance of curved boundary edges,
+                 * \c 0.0 to only use \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per curved boundary
+                 * edge, \c 0 for no limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillNesting *nesting = NULL;
+        DxfHatchBoundaryPath *path;
+        DxfHatchFillLoop *loops;
+        int size;
+        int k;
+
+        /* Do some basic checks. */
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        nesting = calloc (1, sizeof (DxfHatchFillNesting));
+        if (nesting == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        nesting->tessellation = dxf_tessellation_new ();
+        if (nesting->tessellation == NULL)
+        {
+                dxf_hatch_fill_nesting_free (nesting);
+                return (NULL);
+        }
+        /* Tessellate path by path to remember where the loops came
+         * from. */
+        for (path = (DxfHatchBoundaryPath *) hatch->paths, k = 0;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next, k++)
+        {
+                if (dxf_tessellation_add_hatch_boundary_path (nesting->tessellation,
+                  path, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        dxf_hatch_fill_nesting_free (nesting);
+                        return (NULL);
+                }
+                if (nesting->tessellation->number_of_curves > nesting->loops_size)
+                {
+                        size = (nesting->loops_size > 0) ? 2 * nesting->loops_size : 16;
+                        while (size < nesting->tessellation->number_of_curves)
+                        {
+                                size *= 2;
+                        }
+                        loops = realloc (nesting->loops, size * sizeof (DxfHatchFillLoop));
+                        if (loops == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                dxf_hatch_fill_nesting_free (nesting);
+                                return (NULL);
+                        }
+                        nesting->loops = loops;
+                        nesting->loops_size = size;
+                }
+                for (; nesting->number_of_loops < nesting->tessellation->number_of_curves;
+                  nesting->number_of_loops++)
+                {
+                        nesting->loops[nesting->number_of_loops].path = k;
+                }
+        }
+        if (dxf_hatch_fill_nest_loops (nesting->tessellation,
+          nesting->loops) == EXIT_FAILURE)
+        {
+                dxf_hatch_fill_nesting_free (nesting);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (nesting);
+}
+
+
+/*!
+ * \brief Free the allocated memory for the nesting of \c HATCH boundary
+ * loops.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_nesting_free
+(
+        DxfHatchFillNesting *nesting
+                /*!< Nesting of boundary loops. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (nesting == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (nesting->tessellation != NULL)
+        {
+                dxf_tessellation_free (nesting->tessellation);
+        }
+        free (nesting->loops);
+        free (nesting);
+        nesting = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Mark the boundary paths of a \c HATCH after their nesting.
+ *
+ * The \c DXF_HATCH_BOUNDARY_PATH_OUTERMOST bit is set for paths with a
+ * loop which is not contained by another loop and cleared for the
+ * other paths, the \c DXF_HATCH_BOUNDARY_PATH_POLYLINE bit follows the
+ * path data.
+ * Paths without loops keep their outermost bit.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_mark_paths
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        DxfHatchFillNesting *nesting
+                /*!< Nesting of the boundary loops of \c hatch, from
+                 * dxf_hatch_fill_nesting_new (). */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path;
+        int found;
+        int outermost;
+        int i;
+        int k;
+
+        /* Do some basic checks. */
+        if ((hatch == NULL) || (nesting == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* The loops are ordered by path. */
+        i = 0;
+        for (path = (DxfHatchBoundaryPath *) hatch->paths, k = 0;
+          path != NULL;
+          path = (DxfHatchBoundaryPath *) path->next, k++)
+        {
+                found = FALSE;
+                outermost = FALSE;
+                for (; (i < nesting->number_of_loops) && (nesting->loops[i].path == k); i++)
+                {
+                        found = TRUE;
+                        outermost |= (nesting->loops[i].depth == 0);
+                }
+                if (found && outermost)
+                {
+                        path->type |= DXF_HATCH_BOUNDARY_PATH_OUTERMOST;
+                }
+                else if (found)
+                {
+                        path->type &= ~DXF_HATCH_BOUNDARY_PATH_OUTERMOST;
+                }
+                if ((path->edges == NULL) && (path->polylines != NULL))
+                {
+                        path->type |= DXF_HATCH_BOUNDARY_PATH_POLYLINE;
+                }
+                else
+                {
+                        path->type &= ~DXF_HATCH_BOUNDARY_PATH_POLYLINE;
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Mark the outermost boundary paths of a \c HATCH.
+ *
+ * The loops are nested from a coarse tessellation, which is enough to
+ * tell which loops contain others, and the type flags of the boundary
+ * paths are updated with dxf_hatch_fill_mark_paths ().\n
+ * To be called before writing a \c HATCH with changed boundary paths,
+ * dxf_hatch_write () writes the type flags as they are.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_hatch_fill_mark_outermost
+(
+        DxfHatch *hatch
+                /*!< a pointer to a DXF \c HATCH entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchFillNesting *nesting;
+        int result;
+
+        /* Do some basic checks. */
+        if (hatch == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        nesting = dxf_hatch_fill_nesting_new (hatch, 0.0, 16);
+        if (nesting == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_hatch_fill_mark_paths (hatch, nesting);
+        dxf_hatch_fill_nesting_free (nesting);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,239 @@
+/*!
+ * \file hatch_fill.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for filling DXF \c HATCH boundaries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_HATCH_FILL_H
+#define LIBDXF_SRC_HATCH_FILL_H
+
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include "global.h"
+#include "hatch.h"
+#include "tessellate.h"
+#include "util.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_HATCH_FILL_MAX_LINES 1000000
+        /*!< \brief Maximum number of pattern lines of one pattern
+         * definition line crossing a boundary. */
+
+
+/*!
+ * \brief Flat buffer of line segments generated for a hatch.
+ *
+ * Clearing the buffer keeps the allocated memory.
+ */
+typedef struct
+dxf_hatch_fill_segments_struct
+{
+        double *points;
+                /*!< X-, Y- and Z-values of the start and end point of
+                 * every segment, 6 values per segment. */
+        int number_of_segments;
+                /*!< Number of segments. */
+        int size;
+                /*!< Number of segments allocated in \c points. */
+} DxfHatchFillSegments;
+
+
+/*!
+ * \brief Boundary edge in the active edge table of the scanline
+ * clipper, in the coordinates of a pattern line family.
+ */
+typedef struct
+dxf_hatch_fill_edge_struct
+{
+        double u0;
+                /*!< U-value at \c v_min. */
+        double slope;
+                /*!< Change of U per unit of V. */
+        double v_min;
+                /*!< Lowest V-value. */
+        double v_max;
+                /*!< Highest V-value. */
+        int loop;
+                /*!< Index of the boundary loop of the edge. */
+} DxfHatchFillEdge;
+
+
+/*!
+ * \brief Indexed triangles generated for a hatch.
+ *
+ * Clearing the buffer keeps the allocated memory.
+ */
+typedef struct
+dxf_hatch_fill_triangles_struct
+{
+        double *vertices;
+                /*!< X-, Y- and Z-values of the vertices. */
+        int number_of_vertices;
+                /*!< Number of vertices. */
+        int vertices_size;
+                /*!< Number of vertices allocated in \c vertices. */
+        int *indices;
+                /*!< Indices of the vertices of every triangle, 3 per
+                 * triangle, counterclockwise in the OCS of the
+                 * hatch. */
+        int number_of_triangles;
+                /*!< Number of triangles. */
+        int indices_size;
+                /*!< Number of triangles allocated in \c indices. */
+} DxfHatchFillTriangles;
+
+
+/*!
+ * \brief Vertex of the polygon being triangulated, linked in a circular
+ * list.
+ */
+typedef struct
+dxf_hatch_fill_node_struct
+{
+        double x;
+                /*!< X-value. */
+        double y;
+                /*!< Y-value. */
+        int index;
+                /*!< Index of the output vertex. */
+        int prev;
+                /*!< Previous node. */
+        int next;
+                /*!< Next node. */
+} DxfHatchFillNode;
+
+
+/*!
+ * \brief Orientation, bounding box and nesting of a closed \c HATCH
+ * boundary loop.
+ */
+typedef struct
+dxf_hatch_fill_loop_struct
+{
+        double area;
+                /*!< Signed area, positive for a counterclockwise loop. */
+        double min_x;
+                /*!< Minimum X-value of the bounding box. */
+        double min_y;
+                /*!< Minimum Y-value of the bounding box. */
+        double max_x;
+                /*!< Maximum X-value of the bounding box. */
+        double max_y;
+                /*!< Maximum Y-value of the bounding box. */
+        int path;
+                /*!< Index of the boundary path of the loop. */
+        int parent;
+                /*!< Index of the smallest loop containing the loop,
+                 * \c -1 for an outermost loop. */
+        int depth;
+                /*!< Number of loops containing the loop. */
+} DxfHatchFillLoop;
+
+
+/*!
+ * \brief Uniform grid over the edges of closed boundary loops.
+ *
+ * Cells are numbered row by row, the edges crossing cell \c i are
+ * <tt>cell_edges[cell_start[i]]</tt> up to
+ * <tt>cell_edges[cell_start[i + 1] - 1]</tt>.
+ */
+typedef struct
+dxf_hatch_fill_grid_struct
+{
+        double min_x;
+                /*!< Minimum X-value of the grid. */
+        double min_y;
+                /*!< Minimum Y-value of the grid. */
+        double cell_size;
+                /*!< Width and height of a cell. */
+        int columns;
+                /*!< Number of columns. */
+        int rows;
+                /*!< Number of rows. */
+        int *cell_start;
+                /*!< Offset of the first edge of every cell in
+                 * \c cell_edges, <tt>columns * rows + 1</tt> entries. */
+        int *cell_edges;
+                /*!< Edges of all cells, as the index of their first
+                 * point. */
+} DxfHatchFillGrid;
+
+
+/*!
+ * \brief Containment tree of the boundary loops of a \c HATCH.
+ */
+typedef struct
+dxf_hatch_fill_nesting_struct
+{
+        DxfTessellation *tessellation;
+                /*!< Closed boundary loops in the OCS of the hatch. */
+        DxfHatchFillLoop *loops;
+                /*!< Nesting of every loop in \c tessellation. */
+        int number_of_loops;
+                /*!< Number of loops. */
+        int loops_size;
+                /*!< Number of loops allocated in \c loops. */
+} DxfHatchFillNesting;
+
+
+DxfHatchFillSegments *dxf_hatch_fill_segments_new ();
+int dxf_hatch_fill_segments_free (DxfHatchFillSegments *segments);
+int dxf_hatch_fill_segments_clear (DxfHatchFillSegments *segments);
+int dxf_hatch_fill_pattern_loops (DxfTessellation *loops, int hatch_style, DxfHatchPatternDefLine *def_lines, DxfHatchFillSegments *segments);
+int dxf_hatch_fill_pattern (DxfHatch *hatch, double tolerance, int max_segments, DxfHatchFillSegments *segments);
+DxfHatchFillTriangles *dxf_hatch_fill_triangles_new ();
+int dxf_hatch_fill_triangles_free (DxfHatchFillTriangles *triangles);
+int dxf_hatch_fill_triangles_clear (DxfHatchFillTriangles *triangles);
+int dxf_hatch_fill_triangulate_loops (DxfTessellation *loops, int hatch_style, DxfHatchFillTriangles *triangles);
+int dxf_hatch_fill_triangulate (DxfHatch *hatch, double tolerance, int max_segments, DxfHatchFillTriangles *triangles);
+int dxf_hatch_fill_nest_loops (DxfTessellation *loops, DxfHatchFillLoop *nesting);
+DxfHatchFillNesting *dxf_hatch_fill_nesting_new (DxfHatch *hatch, double tolerance, int max_segments);
+int dxf_hatch_fill_nesting_free (DxfHatchFillNesting *nesting);
+int dxf_hatch_fill_mark_paths (DxfHatch *hatch, DxfHatchFillNesting *nesting);
+int dxf_hatch_fill_mark_outermost (DxfHatch *hatch);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_HATCH_FILL_H */
+
+
+/* EOF */
@@ -3248,7 +3248,50 @@ dxf_header_get_dxf_point_variable
         /*!< DXF file handle of input file (or device)  */
         )
 {
-        dxf_point_read(fp, res);
+        int ch;
+        int group_code;
+        char line_in[64];
+
+        /* The coordinates have the group codes 10, 20 and 30, the next
+         * variable (group code 9) or the end of the section (group code
+         * 0) ends the point. */
+        while((ch = fgetc(fp->fp)) != EOF)
+        {
+                /* Skip whitespace */
+                if(ch == '\n')
+                {
+                        fp->line_number++;
+                        continue;
+                }
+                else if(isspace(ch))
+                {
+                        continue;
+                }
+                ungetc(ch, fp->fp);
+                if((ch != '1') && (ch != '2') && (ch != '3'))
+                {
+                        break;
+                }
+                memset(line_in, 0, sizeof(line_in));
+                fgets(line_in, sizeof(line_in), fp->fp);
+                fp->line_number++;
+                sscanf(line_in, "%d", &group_code);
+                memset(line_in, 0, sizeof(line_in));
+                fgets(line_in, sizeof(line_in), fp->fp);
+                fp->line_number++;
+                if(group_code == 10)
+                {
+                        sscanf(line_in, "%lf", &res->x0);
+                }
+                else if(group_code == 20)
+                {
+                        sscanf(line_in, "%lf", &res->y0);
+                }
+                else if(group_code == 30)
+                {
+                        sscanf(line_in, "%lf", &res->z0);
+                }
+        }
 }
 
 /* EOF */
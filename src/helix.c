@@ -175,7 +175,7 @@ dxf_helix_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -183,25 +183,23 @@ dxf_helix_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (helix == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 helix = dxf_helix_init (helix);
         }
         if (helix->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                helix->binary_graphics_data = dxf_binary_graphics_data_init (helix->binary_graphics_data);
+                helix->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (helix->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -212,12 +210,11 @@ dxf_helix_read
         }
         if (helix->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                helix->p0 = dxf_point_init (helix->p0);
+                helix->p0 = dxf_point_init (dxf_point_new ());
                 if (helix->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -228,12 +225,11 @@ dxf_helix_read
         }
         if (helix->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                helix->p1 = dxf_point_init (helix->p1);
+                helix->p1 = dxf_point_init (dxf_point_new ());
                 if (helix->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -244,12 +240,11 @@ dxf_helix_read
         }
         if (helix->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                helix->p2 = dxf_point_init (helix->p2);
+                helix->p2 = dxf_point_init (dxf_point_new ());
                 if (helix->p2 == NULL)
                 {
                         fprintf (stderr,
@@ -258,9 +253,9 @@ dxf_helix_read
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -268,8 +263,6 @@ dxf_helix_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -283,14 +276,12 @@ dxf_helix_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->linetype);
+                        dxf_read_string (&helix->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->layer);
+                        dxf_read_string (&helix->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -436,8 +427,7 @@ dxf_helix_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbSpline") == 0))
                         {
                                 helix->spline = dxf_spline_read (fp, helix->spline);
@@ -445,7 +435,8 @@ dxf_helix_read
                         else if ((strcmp (temp_string, "AcDbEntity") != 0)
                                 && ((strcmp (temp_string, "AcDbHelix") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -482,31 +473,26 @@ dxf_helix_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) helix->binary_graphics_data->next);
-                        helix->binary_graphics_data = (DxfBinaryGraphicsData *) helix->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, helix->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_soft);
+                        dxf_read_string (&helix->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->material);
+                        dxf_read_string (&helix->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->dictionary_owner_hard);
+                        dxf_read_string (&helix->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -519,8 +505,7 @@ dxf_helix_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->plot_style_name);
+                        dxf_read_string (&helix->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -532,8 +517,7 @@ dxf_helix_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, helix->color_name);
+                        dxf_read_string (&helix->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -545,16 +529,20 @@ dxf_helix_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (helix->linetype, "") == 0)
@@ -565,8 +553,6 @@ dxf_helix_read
         {
                 helix->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -595,7 +581,6 @@ dxf_helix_write
         char *dxf_entity_name = strdup ("HELIX");
         int i;
         DxfPoint *iter = NULL;
-        DxfBinaryGraphicsData *iter_310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -705,11 +690,9 @@ dxf_helix_write
 #else
         fprintf (fp->fp, " 92\n%" PRIi32 "\n", helix->graphics_data_size);
 #endif
-        iter_310 = (DxfBinaryGraphicsData *) helix->binary_graphics_data;
-        while (iter_310 != NULL)
+        if (helix->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
-                iter_310 = (DxfBinaryGraphicsData *) iter_310->next;
+                dxf_binary_data_write (fp, helix->binary_graphics_data);
         }
         fprintf (fp->fp, "420\n%" PRIi32 "\n", helix->color_value);
         fprintf (fp->fp, "430\n%s\n", helix->color_name);
@@ -824,7 +807,10 @@ dxf_helix_free
         }
         free (helix->linetype);
         free (helix->layer);
-        dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) helix->binary_graphics_data);
+        if (helix->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (helix->binary_graphics_data);
+        }
         free (helix->dictionary_owner_hard);
         free (helix->material);
         free (helix->dictionary_owner_soft);
@@ -866,6 +852,7 @@ dxf_helix_free_list
         while (helices != NULL)
         {
                 DxfHelix *iter = (DxfHelix *) helices->next;
+                helices->next = NULL;
                 dxf_helix_free (helices);
                 helices = (DxfHelix *) iter;
         }
@@ -4139,9 +4126,6 @@ dxf_helix_get_last
         }
         if (helix->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfHelix *) helix);
         }
         DxfHelix *iter = (DxfHelix *) helix->next;
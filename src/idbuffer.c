@@ -45,6 +45,7 @@
 
 
 #include "idbuffer.h"
+#include "util.h"
 
 
 /*!
@@ -153,7 +154,7 @@ dxf_idbuffer_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         DxfIdbufferEntityPointer *entity_pointer = NULL;
         int iter330;
@@ -164,19 +165,19 @@ dxf_idbuffer_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (idbuffer == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 idbuffer = dxf_idbuffer_init (idbuffer);
@@ -184,17 +185,15 @@ dxf_idbuffer_read
         i = 0;
         entity_pointer = (DxfIdbufferEntityPointer *) dxf_idbuffer_entity_pointer_init (entity_pointer);
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -209,11 +208,11 @@ dxf_idbuffer_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "AcDbIdBuffer") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -225,16 +224,14 @@ dxf_idbuffer_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->dictionary_owner_soft);
+                                dxf_read_string (&idbuffer->dictionary_owner_soft, fp);
                                 i++;
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->object_owner_soft);
+                                dxf_read_string (&idbuffer->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -243,8 +240,7 @@ dxf_idbuffer_read
                 {
                         /* Now follows a string containing a Soft
                          * pointer reference to entity. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, entity_pointer->soft_pointer);
+                        dxf_read_string (&entity_pointer->soft_pointer, fp);
                         dxf_idbuffer_entity_pointer_init ((DxfIdbufferEntityPointer *) entity_pointer->next);
                         entity_pointer = (DxfIdbufferEntityPointer *) entity_pointer->next;
                 }
@@ -252,25 +248,26 @@ dxf_idbuffer_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, idbuffer->dictionary_owner_hard);
+                        dxf_read_string (&idbuffer->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -977,9 +974,6 @@ dxf_idbuffer_get_last
         }
         if (idbuffer->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfIdbuffer *) idbuffer);
         }
         DxfIdbuffer *iter = (DxfIdbuffer *) idbuffer->next;
@@ -1137,6 +1131,7 @@ dxf_idbuffer_entity_pointer_free_list
         while (entity_pointers != NULL)
         {
                 DxfIdbufferEntityPointer *iter = (DxfIdbufferEntityPointer *) entity_pointers->next;
+                entity_pointers->next = NULL;
                 dxf_idbuffer_entity_pointer_free (entity_pointers);
                 entity_pointers = (DxfIdbufferEntityPointer *) iter;
         }
@@ -1343,9 +1338,6 @@ dxf_idbuffer_entity_pointer_get_last
         }
         if (entity_pointer->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfIdbufferEntityPointer *) entity_pointer);
         }
         DxfIdbufferEntityPointer *iter = (DxfIdbufferEntityPointer *) entity_pointer->next;
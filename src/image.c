@@ -46,6 +46,7 @@
 
 
 #include "image.h"
+#include "util.h"
 
 
 /*!
@@ -187,10 +188,9 @@ dxf_image_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfPoint *iter = NULL;
         int next_x4;
-        DxfBinaryData *iter310 = NULL;
         int iter330;
         int iter360;
 
@@ -200,25 +200,23 @@ dxf_image_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (image == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 image = dxf_image_init (image);
         }
         if (image->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                image->binary_graphics_data = dxf_binary_data_init (image->binary_graphics_data);
+                image->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (image->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -229,12 +227,11 @@ dxf_image_read
         }
         if (image->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p0 = dxf_point_init (image->p0);
+                image->p0 = dxf_point_init (dxf_point_new ());
                 if (image->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -245,12 +242,11 @@ dxf_image_read
         }
         if (image->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p1 = dxf_point_init (image->p1);
+                image->p1 = dxf_point_init (dxf_point_new ());
                 if (image->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -261,12 +257,11 @@ dxf_image_read
         }
         if (image->p2 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p2 = dxf_point_init (image->p2);
+                image->p2 = dxf_point_init (dxf_point_new ());
                 if (image->p2 == NULL)
                 {
                         fprintf (stderr,
@@ -277,12 +272,11 @@ dxf_image_read
         }
         if (image->p3 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p3 = dxf_point_init (image->p3);
+                image->p3 = dxf_point_init (dxf_point_new ());
                 if (image->p3 == NULL)
                 {
                         fprintf (stderr,
@@ -293,12 +287,11 @@ dxf_image_read
         }
         if (image->p4 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                image->p4 = dxf_point_init (image->p4);
+                image->p4 = dxf_point_init (dxf_point_new ());
                 if (image->p4 == NULL)
                 {
                         fprintf (stderr,
@@ -309,12 +302,11 @@ dxf_image_read
         }
         iter = (DxfPoint *) image->p4;
         next_x4 = 0;
-        iter310 = (DxfBinaryData *) image->binary_graphics_data;
         iter330 = 0;
         iter360 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -322,8 +314,6 @@ dxf_image_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -337,14 +327,12 @@ dxf_image_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->linetype);
+                        dxf_read_string (&image->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->layer);
+                        dxf_read_string (&image->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -528,12 +516,12 @@ dxf_image_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbRasterImage") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -584,10 +572,8 @@ dxf_image_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, image->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -595,15 +581,13 @@ dxf_image_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->dictionary_owner_soft);
+                                dxf_read_string (&image->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->object_owner_soft);
+                                dxf_read_string (&image->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -611,15 +595,13 @@ dxf_image_read
                 {
                         /* Now follows a string containing a hard
                          * reference to imagedef object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->imagedef_object);
+                        dxf_read_string (&image->imagedef_object, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->material);
+                        dxf_read_string (&image->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
@@ -627,15 +609,13 @@ dxf_image_read
                         {
                                 /* Now follows a string containing a hard-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->dictionary_owner_hard);
+                                dxf_read_string (&image->dictionary_owner_hard, fp);
                         }
                         if (iter360 == 1)
                         {
                                 /* Now follows a string containing a hard
                                  * reference to imagedef_reactor object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->imagedef_reactor_object);
+                                dxf_read_string (&image->imagedef_reactor_object, fp);
                         }
                         iter360++;
                 }
@@ -650,8 +630,7 @@ dxf_image_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->plot_style_name);
+                        dxf_read_string (&image->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -663,8 +642,7 @@ dxf_image_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, image->color_name);
+                        dxf_read_string (&image->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -676,16 +654,20 @@ dxf_image_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (image->linetype, "") == 0)
@@ -696,8 +678,6 @@ dxf_image_read
         {
                 image->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -854,13 +834,7 @@ dxf_image_write
 #endif
                 if (image->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) image->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, image->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -957,7 +931,10 @@ dxf_image_free
         }
         free (image->linetype);
         free (image->layer);
-        dxf_binary_data_free_list (image->binary_graphics_data);
+        if (image->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (image->binary_graphics_data);
+        }
         free (image->dictionary_owner_soft);
         free (image->material);
         free (image->dictionary_owner_hard);
@@ -1004,6 +981,7 @@ dxf_image_free_list
         while (images != NULL)
         {
                 DxfImage *iter = (DxfImage *) images->next;
+                images->next = NULL;
                 dxf_image_free (images);
                 images = (DxfImage *) iter;
         }
@@ -5196,9 +5174,6 @@ dxf_image_get_last
         }
         if (image->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfImage *) image);
         }
         DxfImage *iter = (DxfImage *) image->next;
@@ -45,6 +45,7 @@
 
 
 #include "insert.h"
+#include "util.h"
 
 
 /*!
@@ -180,7 +181,7 @@ dxf_insert_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -188,24 +189,22 @@ dxf_insert_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (insert == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 insert = dxf_insert_init (insert);
         }
         if (insert->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
                 insert->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (insert->binary_graphics_data);
                 if (insert->binary_graphics_data == NULL)
                 {
@@ -217,12 +216,11 @@ dxf_insert_read
         }
         if (insert->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                insert->p0 = dxf_point_init (insert->p0);
+                insert->p0 = dxf_point_init (dxf_point_new ());
                 if (insert->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -231,9 +229,9 @@ dxf_insert_read
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -241,16 +239,13 @@ dxf_insert_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->block_name);
+                        dxf_read_string (&insert->block_name, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -263,14 +258,12 @@ dxf_insert_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->linetype);
+                        dxf_read_string (&insert->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->layer);
+                        dxf_read_string (&insert->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -410,12 +403,12 @@ dxf_insert_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbBlockReference") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -445,29 +438,31 @@ dxf_insert_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->dictionary_owner_soft);
+                        dxf_read_string (&insert->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, insert->dictionary_owner_hard);
+                        dxf_read_string (&insert->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (insert->linetype, "") == 0)
@@ -478,8 +473,6 @@ dxf_insert_read
         {
                 insert->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -764,7 +757,10 @@ dxf_insert_free
         }
         free (insert->linetype);
         free (insert->layer);
-        dxf_binary_data_free_list (insert->binary_graphics_data);
+        if (insert->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (insert->binary_graphics_data);
+        }
         free (insert->dictionary_owner_soft);
         free (insert->material);
         free (insert->dictionary_owner_hard);
@@ -805,6 +801,7 @@ dxf_insert_free_list
         while (inserts != NULL)
         {
                 DxfInsert *iter = (DxfInsert *) inserts->next;
+                inserts->next = NULL;
                 dxf_insert_free (inserts);
                 inserts = (DxfInsert *) iter;
         }
@@ -3917,9 +3914,6 @@ dxf_insert_get_last
         }
         if (insert->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfInsert *) insert);
         }
         DxfInsert *iter = (DxfInsert *) insert->next;
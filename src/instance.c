@@ -0,0 +1,668 @@
+/*!
+ * \file instance.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for instance tables of DXF block references (\c INSERT entities).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "instance.h"
+
+
+/*!
+ * \brief Test if a layer is on and thawed.
+ *
+ * Layers missing from the layer table are visible.
+ */
+static int
+dxf_instance_table_layer_is_visible
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        const char *layer_name
+                /*!< Name of the layer. */
+)
+{
+        DxfLayer *layer;
+
+        if (layer_name == NULL)
+        {
+                return (TRUE);
+        }
+        for (layer = instance_table->layers; layer != NULL; layer = (DxfLayer *) layer->next)
+        {
+                if ((layer->layer_name != NULL)
+                  && (strcasecmp (layer->layer_name, layer_name) == 0))
+                {
+                        return ((layer->color >= 0) && !(layer->flag & 1));
+                }
+        }
+        return (TRUE);
+}
+
+
+/*!
+ * \brief Find the group of a block and visibility, optionally adding
+ * an empty group.
+ *
+ * \return the group, or \c NULL when there is no group or an error
+ * occurred.
+ */
+static DxfInstanceGroup *
+dxf_instance_table_get_group_of_block
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        int block_index,
+                /*!< Index of the block in the explode context. */
+        int visible,
+                /*!< Visibility of the group. */
+        int create
+                /*!< Add a group when there is none yet. */
+)
+{
+        DxfInstanceGroup *groups;
+        DxfInstanceGroup *group;
+        int key;
+        int size;
+
+        key = 2 * block_index + (visible ? 1 : 0);
+        if (instance_table->lookup[key] != -1)
+        {
+                return (&instance_table->groups[instance_table->lookup[key]]);
+        }
+        if (!create)
+        {
+                return (NULL);
+        }
+        if (instance_table->number_of_groups == instance_table->groups_size)
+        {
+                size = (instance_table->groups_size > 0) ? 2 * instance_table->groups_size : 8;
+                groups = realloc (instance_table->groups, size * sizeof (DxfInstanceGroup));
+                if (groups == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                instance_table->groups = groups;
+                instance_table->groups_size = size;
+        }
+        group = &instance_table->groups[instance_table->number_of_groups];
+        group->block = instance_table->explode->blocks[block_index].block;
+        group->geometry = dxf_explode_get_block_geometry (instance_table->explode,
+          group->block->block_name);
+        if (group->geometry == NULL)
+        {
+                return (NULL);
+        }
+        group->visible = visible ? TRUE : FALSE;
+        group->matrices = NULL;
+        group->number_of_instances = 0;
+        group->size = 0;
+        instance_table->lookup[key] = instance_table->number_of_groups;
+        instance_table->number_of_groups++;
+        return (group);
+}
+
+
+/*!
+ * \brief Append a transform to a group.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_instance_group_add_matrix
+(
+        DxfInstanceGroup *group,
+                /*!< Group of instances. */
+        const double *matrix,
+                /*!< Row major 3 x 4 matrix. */
+        int matrix_size
+                /*!< Number of values per stored transform. */
+)
+{
+        double *matrices;
+        double *m;
+        int size;
+
+        if (group->number_of_instances == group->size)
+        {
+                size = (group->size > 0) ? 2 * group->size : 16;
+                matrices = realloc (group->matrices, (size_t) size * matrix_size * sizeof (double));
+                if (matrices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                group->matrices = matrices;
+                group->size = size;
+        }
+        m = group->matrices + (size_t) group->number_of_instances * matrix_size;
+        memcpy (m, matrix, 12 * sizeof (double));
+        if (matrix_size == 16)
+        {
+                m[12] = 0.0;
+                m[13] = 0.0;
+                m[14] = 0.0;
+                m[15] = 1.0;
+        }
+        group->number_of_instances++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the instances of a block reference to an instance table,
+ * recursing into nested block references.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a
+ * reference was skipped or an error occurred.
+ */
+static int
+dxf_instance_table_walk
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        DxfInsert *insert,
+                /*!< Block reference. */
+        const double *parent,
+                /*!< Matrix of the parent block, \c NULL for the
+                 * identity. */
+        int visible,
+                /*!< Visibility of the parent block reference. */
+        int depth
+                /*!< Nesting depth of the reference. */
+)
+{
+        DxfExplodeBlock *entry;
+        DxfEntities *entities;
+        DxfInstanceGroup *group;
+        double matrix[12];
+        int result = EXIT_SUCCESS;
+        int columns;
+        int rows;
+        int column;
+        int row;
+        int i;
+        int j;
+
+        if (insert->block_name == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        i = dxf_explode_find_block_index (instance_table->explode, insert->block_name);
+        if (i == -1)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block %s was not found.\n")),
+                  __FUNCTION__, insert->block_name);
+                return (EXIT_FAILURE);
+        }
+        entry = &instance_table->explode->blocks[i];
+        if (entry->visiting)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block %s references itself.\n")),
+                  __FUNCTION__, insert->block_name);
+                return (EXIT_FAILURE);
+        }
+        if (depth >= DXF_EXPLODE_MAX_DEPTH)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () block references are nested too deep.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Entities on layer 0 inside a block inherit the layer of the
+         * block reference. */
+        if (insert->visibility == 1)
+        {
+                visible = FALSE;
+        }
+        else if ((insert->layer != NULL) && (strcmp (insert->layer, "0") != 0))
+        {
+                visible = visible
+                  && dxf_instance_table_layer_is_visible (instance_table, insert->layer);
+        }
+        group = dxf_instance_table_get_group_of_block (instance_table, i, visible, TRUE);
+        if (group == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        entities = (DxfEntities *) entry->block->entities;
+        columns = (insert->columns > 1) ? insert->columns : 1;
+        rows = (insert->rows > 1) ? insert->rows : 1;
+        entry->visiting = TRUE;
+        for (row = 0; row < rows; row++)
+        {
+                for (column = 0; column < columns; column++)
+                {
+                        if (dxf_explode_get_insert_matrix (insert,
+                          entry->block, column, row, matrix) == EXIT_FAILURE)
+                        {
+                                entry->visiting = FALSE;
+                                return (EXIT_FAILURE);
+                        }
+                        if (parent != NULL)
+                        {
+                                dxf_explode_multiply_matrix (parent, matrix, matrix);
+                        }
+                        /* The group array may have moved while adding
+                         * nested groups. */
+                        group = &instance_table->groups[instance_table->lookup[2 * i + (visible ? 1 : 0)]];
+                        if (dxf_instance_group_add_matrix (group, matrix,
+                          instance_table->matrix_size) == EXIT_FAILURE)
+                        {
+                                entry->visiting = FALSE;
+                                return (EXIT_FAILURE);
+                        }
+                        if (entities == NULL)
+                        {
+                                continue;
+                        }
+                        for (j = 0; j < entities->number_of_sequence_items; j++)
+                        {
+                                if ((entities->sequence[j].type == INSERT)
+                                  && (dxf_instance_table_walk (instance_table,
+                                  (DxfInsert *) entities->sequence[j].entity,
+                                  matrix, visible, depth + 1) == EXIT_FAILURE))
+                                {
+                                        result = EXIT_FAILURE;
+                                }
+                        }
+                }
+        }
+        entry->visiting = FALSE;
+        return (result);
+}
+
+
+/*!
+ * \brief Allocate memory for an empty instance table over the blocks
+ * and layers of a drawing.
+ *
+ * \return a pointer to the instance table, or \c NULL when an error
+ * occurred.
+ */
+static DxfInstanceTable *
+dxf_instance_table_init
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        double tolerance,
+                /*!< Chord height tolerance of the block geometry. */
+        int max_segments,
+                /*!< Maximum number of segments per arc of the block
+                 * geometry. */
+        int matrix_size
+                /*!< \c 12 or \c 16. */
+)
+{
+        DxfInstanceTable *instance_table;
+        int i;
+
+        instance_table = calloc (1, sizeof (DxfInstanceTable));
+        if (instance_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        instance_table->matrix_size = matrix_size;
+        instance_table->explode = dxf_explode_new ((DxfBlock *) drawing->block_list,
+          tolerance, max_segments);
+        if (instance_table->explode == NULL)
+        {
+                free (instance_table);
+                return (NULL);
+        }
+        instance_table->lookup = malloc ((2 * instance_table->explode->number_of_blocks + 1) * sizeof (int));
+        if (instance_table->lookup == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_instance_table_free (instance_table);
+                return (NULL);
+        }
+        for (i = 0; i < 2 * instance_table->explode->number_of_blocks; i++)
+        {
+                instance_table->lookup[i] = -1;
+        }
+        if (drawing->tables_list != NULL)
+        {
+                instance_table->layers = ((DxfTables *) drawing->tables_list)->layers;
+        }
+        return (instance_table);
+}
+
+
+/*!
+ * \brief Build the instance tables of all block references in the
+ * entities section of a drawing.
+ *
+ * Every block gets a group for its visible and one for its hidden
+ * instances (when there are any), holding the tessellated block
+ * geometry once and a transform per instance.\n
+ * Every cell of a \c MINSERT array is an instance of its own.
+ * Nested block references add instances to the group of the nested
+ * block with the composed transform, so no block geometry is
+ * duplicated.\n
+ * An instance is hidden when its \c INSERT is invisible or on a layer
+ * which is off or frozen, block references on layer \c 0 inherit the
+ * visibility of the parent reference.
+ *
+ * \return a pointer to the instance table, or \c NULL when an error
+ * occurred.
+ */
+DxfInstanceTable *
+dxf_instance_table_new
+(
+        DxfDrawing *drawing,
+                /*!< a pointer to a libDXF \c DRAWING. */
+        double tolerance,
+                /*!< Chord height tolerance of the block geometry,
+                 * \c 0.0 to only use \c max_segments. */
+        int max_segments,
+                /*!< Maximum number of segments per arc of the block
+                 * geometry, \c 0 for no limit. */
+        int matrix_size
+                /*!< Number of values per transform, \c 12 for row
+                 * major 3 x 4 matrices or \c 16 for row major 4 x 4
+                 * matrices. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfInstanceTable *instance_table;
+        DxfEntities *entities;
+        int i;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((matrix_size != 12) && (matrix_size != 16))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () invalid matrix size %d was passed.\n")),
+                  __FUNCTION__, matrix_size);
+                return (NULL);
+        }
+        instance_table = dxf_instance_table_init (drawing, tolerance,
+          max_segments, matrix_size);
+        if (instance_table == NULL)
+        {
+                return (NULL);
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        if (entities != NULL)
+        {
+                for (i = 0; i < entities->number_of_sequence_items; i++)
+                {
+                        if (entities->sequence[i].type == INSERT)
+                        {
+                                /* Unresolved references are reported
+                                 * and skipped. */
+                                dxf_instance_table_add_insert (instance_table,
+                                  (DxfInsert *) entities->sequence[i].entity,
+                                  NULL, TRUE);
+                        }
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (instance_table);
+}
+
+
+/*!
+ * \brief Free the allocated memory for an instance table, its groups
+ * and the cached block geometry.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_instance_table_free
+(
+        DxfInstanceTable *instance_table
+                /*!< Instance table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        if (instance_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < instance_table->number_of_groups; i++)
+        {
+                free (instance_table->groups[i].matrices);
+        }
+        free (instance_table->groups);
+        free (instance_table->lookup);
+        if (instance_table->explode != NULL)
+        {
+                dxf_explode_free (instance_table->explode);
+        }
+        free (instance_table);
+        instance_table = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of groups in an instance table.
+ *
+ * \return the number of groups, or \c -1 when an error occurred.
+ */
+int
+dxf_instance_table_get_number_of_groups
+(
+        DxfInstanceTable *instance_table
+                /*!< Instance table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (instance_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (instance_table->number_of_groups);
+}
+
+
+/*!
+ * \brief Get a group of an instance table by index.
+ *
+ * \return the group, or \c NULL when the index is out of range or an
+ * error occurred.
+ */
+DxfInstanceGroup *
+dxf_instance_table_get_group
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        int index
+                /*!< Index of the group. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (instance_table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= instance_table->number_of_groups))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () index %d is out of range.\n")),
+                  __FUNCTION__, index);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&instance_table->groups[index]);
+}
+
+
+/*!
+ * \brief Find the group of a block and visibility in an instance
+ * table.
+ *
+ * \return the group, or \c NULL when the block has no instances with
+ * that visibility or an error occurred.
+ */
+DxfInstanceGroup *
+dxf_instance_table_find_group
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        const char *block_name,
+                /*!< Name of the block, case insensitive. */
+        int visible
+                /*!< \c TRUE for the visible instances, \c FALSE for the
+                 * hidden instances. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((instance_table == NULL) || (block_name == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        i = dxf_explode_find_block_index (instance_table->explode, block_name);
+        if (i == -1)
+        {
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_instance_table_get_group_of_block (instance_table, i, visible, FALSE));
+}
+
+
+/*!
+ * \brief Add the instances of a block reference to an instance table.
+ *
+ * The insert is not copied, nested block references are added too.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a
+ * reference could not be resolved or an error occurred.
+ */
+int
+dxf_instance_table_add_insert
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        DxfInsert *insert,
+                /*!< a pointer to a DXF \c INSERT entity. */
+        const double *matrix,
+                /*!< Row major 3 x 4 matrix applied after the insert
+                 * transform, \c NULL for the identity. */
+        int visible
+                /*!< \c FALSE to add the instances as hidden regardless
+                 * of their layers. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((instance_table == NULL) || (insert == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((insert->layer != NULL) && (strcmp (insert->layer, "0") == 0))
+        {
+                /* Layer 0 is only inherited inside blocks, at the top
+                 * level it is an ordinary layer. */
+                visible = visible
+                  && dxf_instance_table_layer_is_visible (instance_table, insert->layer);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_instance_table_walk (instance_table, insert, matrix,
+          visible, 0));
+}
+
+
+/* EOF */
@@ -0,0 +1,129 @@
+/*!
+ * \file instance.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for instance tables of DXF block references (\c INSERT entities).
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_INSTANCE_H
+#define LIBDXF_SRC_INSTANCE_H
+
+
+#include <string.h>
+#include <strings.h>
+#include "global.h"
+#include "block.h"
+#include "drawing.h"
+#include "entities.h"
+#include "explode.h"
+#include "insert.h"
+#include "layer.h"
+#include "tables.h"
+#include "tessellate.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Instances of one block definition sharing a layer visibility.
+ *
+ * The geometry of the block is stored once, every instance only adds a
+ * transform from block coordinates to the WCS.
+ */
+typedef struct
+dxf_instance_group_struct
+{
+        DxfBlock *block;
+                /*!< Block definition of the instances. */
+        DxfTessellation *geometry;
+                /*!< Tessellated curves of the block in block
+                 * coordinates, excluding nested block references
+                 * (these have groups of their own).\n
+                 * Owned by the instance table. */
+        int visible;
+                /*!< \c TRUE when the instances are on layers which are
+                 * on and thawed. */
+        double *matrices;
+                /*!< Row major transforms of the instances, \c
+                 * matrix_size values per instance. */
+        int number_of_instances;
+                /*!< Number of instances. */
+        int size;
+                /*!< Number of instances allocated in \c matrices. */
+} DxfInstanceGroup;
+
+
+/*!
+ * \brief Instance tables of all block references in a drawing.
+ *
+ * There is at most one group per block and layer visibility.
+ */
+typedef struct
+dxf_instance_table_struct
+{
+        DxfInstanceGroup *groups;
+                /*!< Groups of instances. */
+        int number_of_groups;
+                /*!< Number of groups. */
+        int groups_size;
+                /*!< Number of groups allocated in \c groups. */
+        int *lookup;
+                /*!< Index of the group for every block and visibility,
+                 * \c -1 when there is no group yet. */
+        int matrix_size;
+                /*!< Number of values per transform, \c 12 for 3 x 4
+                 * matrices or \c 16 for 4 x 4 matrices. */
+        DxfExplode *explode;
+                /*!< Block lookup and cached block geometry. */
+        DxfLayer *layers;
+                /*!< Layer table of the drawing, may be \c NULL. */
+} DxfInstanceTable;
+
+
+DxfInstanceTable *dxf_instance_table_new (DxfDrawing *drawing, double tolerance, int max_segments, int matrix_size);
+int dxf_instance_table_free (DxfInstanceTable *instance_table);
+int dxf_instance_table_get_number_of_groups (DxfInstanceTable *instance_table);
+DxfInstanceGroup *dxf_instance_table_get_group (DxfInstanceTable *instance_table, int index);
+DxfInstanceGroup *dxf_instance_table_find_group (DxfInstanceTable *instance_table, const char *block_name, int visible);
+int dxf_instance_table_add_insert (DxfInstanceTable *instance_table, DxfInsert *insert, const double *matrix, int visible);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_INSTANCE_H */
+
+
+/* EOF */
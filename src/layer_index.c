@@ -63,6 +63,10 @@
 #include "layer_index.h"
 
 
+static int dxf_layer_index_sync_lists (DxfLayerIndex *layer_index, DxfFile *fp);
+static void dxf_layer_index_write_idbuffer (DxfFile *fp, DxfLayerIndex *layer_index, DxfLayerIndexBucket *bucket, const char *handle);
+
+
 /*!
  * \brief Allocate memory for a \c DxfLayerIndex.
  *
@@ -136,11 +140,14 @@ dxf_layer_index_init
         layer_index->time_stamp = 0;
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
-        /*! \todo Proper implementation \c number_of_entries and
-         * \c hard_owner_reference required. */ 
         layer_index->layer_name = NULL;
         layer_index->number_of_entries = NULL;
         layer_index->hard_owner_reference = NULL;
+        layer_index->buckets = NULL;
+        layer_index->number_of_buckets = 0;
+        layer_index->buckets_size = 0;
+        layer_index->lookup = NULL;
+        layer_index->lookup_size = 0;
         layer_index->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -154,14 +161,16 @@ dxf_layer_index_init
  *
  * The last line read from file contained the string "LAYER_INDEX". \n
  * Now follows some data for the \c LAYER_INDEX, to be terminated with a
- * "  0" string announcing the following entity, or the end of the
- * \c ENTITY section marker \c ENDSEC. \n
+ * "  0" string announcing the following object. \n
  * While parsing the DXF file store data in \c layer_index. \n
+ * Every layer name (group code 8) is followed by the hard owner
+ * reference to the \c IDBUFFER holding the entities on that layer
+ * (group code 360) and the number of entries in that \c IDBUFFER
+ * (group code 90).\n
+ * The entity buckets are not read from file, they are built with
+ * dxf_layer_index_build () or while loading the entities section.
  *
  * \return a pointer to \c layer_index.
- *
- * \todo Proper implementation \c number_of_entries and
- * \c hard_owner_reference required.
  */
 DxfLayerIndex *
 dxf_layer_index_read
@@ -175,10 +184,13 @@ dxf_layer_index_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfLayerName *iter;
-        int i;
-        int k;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfChar *last_layer_name;
+        DxfChar *last_reference;
+        DxfInt32 *last_number;
+        DxfChar *c;
+        DxfInt32 *n;
+        int in_xdictionary;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -186,37 +198,46 @@ dxf_layer_index_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (layer_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 layer_index = dxf_layer_index_init (layer_index);
+                if (layer_index == NULL)
+                {
+                        return (NULL);
+                }
         }
-        i = 0;
-        k = 0;
-        iter = (DxfLayerName *) layer_index->layer_name; /* Pointer to first entry. */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        last_layer_name = (layer_index->layer_name != NULL)
+          ? dxf_char_get_last ((DxfChar *) layer_index->layer_name)
+          : NULL;
+        last_reference = (layer_index->hard_owner_reference != NULL)
+          ? dxf_char_get_last ((DxfChar *) layer_index->hard_owner_reference)
+          : NULL;
+        last_number = (layer_index->number_of_entries != NULL)
+          ? dxf_int32_get_last ((DxfInt32 *) layer_index->number_of_entries)
+          : NULL;
+        in_xdictionary = FALSE;
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && !feof (fp->fp))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -227,95 +248,134 @@ dxf_layer_index_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", (uint *) &layer_index->id_code);
                 }
-                if (strcmp (temp_string, "8") == 0)
+                else if ((strcmp (temp_string, "8") == 0)
+                  || ((strcmp (temp_string, "360") == 0) && !in_xdictionary))
                 {
-                        /* Now follows a string containing a layer name
-                         * (multiple entries may exist). */
-                        if (i > 0) /* Create a pointer for the next entry. */
+                        /* Now follows a string containing a layer name,
+                         * or a hard owner reference to the IDBUFFER of
+                         * the layer (multiple entries may exist). */
+                        int is_layer_name = (strcmp (temp_string, "8") == 0);
+                        dxf_read_line (temp_string, fp);
+                        c = dxf_char_new ();
+                        if (c == NULL)
                         {
-                                dxf_layer_name_init ((DxfLayerName *) iter->next);
-                                iter = (DxfLayerName *) iter->next;
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        dxf_char_set_value (c, temp_string);
+                        if (is_layer_name)
+                        {
+                                if (last_layer_name == NULL)
+                                {
+                                        layer_index->layer_name = (struct dxf_char_struct *) c;
+                                }
+                                else
+                                {
+                                        last_layer_name->next = (struct DxfChar *) c;
+                                }
+                                last_layer_name = c;
+                        }
+                        else
+                        {
+                                if (last_reference == NULL)
+                                {
+                                        layer_index->hard_owner_reference = (struct dxf_char_struct *) c;
+                                }
+                                else
+                                {
+                                        last_reference->next = (struct DxfChar *) c;
+                                }
+                                last_reference = c;
                         }
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->name);
-                        i++; /* Increase number of entries. */
                 }
-                if (strcmp (temp_string, "40") == 0)
+                else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a string containing a time stamp. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &layer_index->time_stamp);
                 }
-                if (strcmp (temp_string, "90") == 0)
+                else if (strcmp (temp_string, "90") == 0)
                 {
                         /* Now follows a string containing a number of
-                         * entries in the LAYER_INDEX list (multiple
-                         * entries may exist). */
+                         * entries in the IDBUFFER of the layer
+                         * (multiple entries may exist). */
+                        n = dxf_int32_init (dxf_int32_new ());
+                        if (n == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
                         (fp->line_number)++;
-                        /*! \todo Implement reading of \c number_of_entries
-                         * properly.
-                        fscanf (fp->fp, "%d\n", &layer_index->number_of_entries);
-                         */
+                        fscanf (fp->fp, "%" SCNd32 "\n", &n->value);
+                        if (last_number == NULL)
+                        {
+                                layer_index->number_of_entries = (struct dxf_int32_struct *) n;
+                        }
+                        else
+                        {
+                                last_number->next = (struct DxfInt32 *) n;
+                        }
+                        last_number = n;
                 }
                 else if ((fp->acad_version_number >= AutoCAD_13)
                         && (strcmp (temp_string, "100") == 0))
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbIndex") != 0)
                           && (strcmp (temp_string, "AcDbLayerIndex") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
+                else if (strcmp (temp_string, "102") == 0)
+                {
+                        /* Now follows a string containing the start or
+                         * the end of an application-defined group. */
+                        dxf_read_line (temp_string, fp);
+                        in_xdictionary = (strcmp (temp_string, "{ACAD_XDICTIONARY") == 0);
+                }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->dictionary_owner_soft);
+                        dxf_read_line (temp_string, fp);
+                        free (layer_index->dictionary_owner_soft);
+                        layer_index->dictionary_owner_soft = strdup (temp_string);
                 }
-                else if ((strcmp (temp_string, "360") == 0)
-                  && (k == 0))
+                else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->dictionary_owner_hard);
-                        k++;
-                }
-                else if ((strcmp (temp_string, "360") == 0)
-                  && (k > 0))
-                {
-                        /* Now follows a string containing a Hard owner
-                         * reference LAYER_INDEX (multiple entries may
-                         * exist). */
-                        (fp->line_number)++;
-                        /*! \todo Implement reading of \c hard_owner_reference
-                         * properly.
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, layer_index->hard_owner_reference);
-                         */
+                        dxf_read_line (temp_string, fp);
+                        free (layer_index->dictionary_owner_hard);
+                        layer_index->dictionary_owner_hard = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -326,11 +386,17 @@ dxf_layer_index_read
 /*!
  * \brief Write DXF output to a file for a DXF \c LAYER_INDEX object.
  *
+ * Every layer name is followed by the hard owner reference to the
+ * \c IDBUFFER of the layer, when known, and the number of entries on
+ * the layer.\n
+ * When the entity buckets are built the layer names and numbers of
+ * entries are taken from the buckets, a layer without a hard owner
+ * reference gets a new handle, and an \c IDBUFFER object with the
+ * handles of the entities on each layer is written after the
+ * \c LAYER_INDEX object.
+ *
  * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
  * occurred.
- *
- * \todo Proper implementation \c number_of_entries and
- * \c hard_owner_reference required.
  */
 int
 dxf_layer_index_write
@@ -345,7 +411,9 @@ dxf_layer_index_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LAYER_INDEX");
-        DxfLayerName *iter;
+        DxfChar *layer_name;
+        DxfChar *reference;
+        DxfInt32 *number;
         int i;
 
         /* Do some basic checks. */
@@ -379,16 +447,6 @@ dxf_layer_index_write
         {
                 fprintf (fp->fp, "  5\n%x\n", layer_index->id_code);
         }
-        /*!
-         * \todo for version R14.\n
-         * Implementing the start of application-defined group
-         * "{application_name", with Group code 102.\n
-         * For example: "{ACAD_REACTORS" indicates the start of the
-         * AutoCAD persistent reactors group.\n\n
-         * application-defined codes: Group codes and values within the
-         * 102 groups are application defined (optional).\n\n
-         * End of group, "}" (optional), with Group code 102.
-         */
         if ((strcmp (layer_index->dictionary_owner_soft, "") != 0)
           && (fp->acad_version_number >= AutoCAD_14))
         {
@@ -403,27 +461,52 @@ dxf_layer_index_write
                 fprintf (fp->fp, "360\n%s\n", layer_index->dictionary_owner_hard);
                 fprintf (fp->fp, "102\n}\n");
         }
+        if (strcmp (layer_index->dictionary_owner_soft, "") != 0)
+        {
+                fprintf (fp->fp, "330\n%s\n", layer_index->dictionary_owner_soft);
+        }
         if (fp->acad_version_number >= AutoCAD_13)
         {
                 fprintf (fp->fp, "100\nAcDbIndex\n");
         }
-        fprintf (fp->fp, " 40\n%lf\n", layer_index->time_stamp);
-        iter = (DxfLayerName *) layer_index->layer_name;
-        i = 0;
-        while (strlen (iter->name) > 0)
+        fprintf (fp->fp, " 40\n%f\n", layer_index->time_stamp);
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                fprintf (fp->fp, "100\nAcDbLayerIndex\n");
+        }
+        if ((layer_index->number_of_buckets > 0)
+          && (dxf_layer_index_sync_lists (layer_index, fp) == EXIT_FAILURE))
+        {
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
+        }
+        reference = (DxfChar *) layer_index->hard_owner_reference;
+        number = (DxfInt32 *) layer_index->number_of_entries;
+        for (layer_name = (DxfChar *) layer_index->layer_name;
+          layer_name != NULL;
+          layer_name = (DxfChar *) layer_name->next)
         {
-                fprintf (fp->fp, "  8\n%s\n", iter->name);
-                iter = (DxfLayerName *) iter->next;
-                i++;
+                fprintf (fp->fp, "  8\n%s\n", layer_name->value);
+                if ((reference != NULL) && (strcmp (reference->value, "") != 0))
+                {
+                        fprintf (fp->fp, "360\n%s\n", reference->value);
+                }
+                if (number != NULL)
+                {
+                        fprintf (fp->fp, " 90\n%" PRId32 "\n", number->value);
+                }
+                reference = (reference != NULL) ? (DxfChar *) reference->next : NULL;
+                number = (number != NULL) ? (DxfInt32 *) number->next : NULL;
         }
-        /*! \todo Implement reading of \c hard_owner_reference and
-         * \c number_of_entries  properly.
-        while (strlen (layer_index->layer_name->name) > 0)
+        /* The IDBUFFER objects of the layers follow the LAYER_INDEX. */
+        reference = (DxfChar *) layer_index->hard_owner_reference;
+        for (i = 0; i < layer_index->number_of_buckets; i++)
         {
-                fprintf (fp->fp, "360\n%s\n", layer_index->hard_owner_reference);
-                fprintf (fp->fp, " 90\n%d\n", layer_index->number_of_entries);
+                dxf_layer_index_write_idbuffer (fp, layer_index,
+                  &layer_index->buckets[i], reference->value);
+                reference = (DxfChar *) reference->next;
         }
-         */
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -468,8 +551,19 @@ dxf_layer_index_free
         }
         free (layer_index->dictionary_owner_soft);
         free (layer_index->dictionary_owner_hard);
-        dxf_char_free_list (layer_index->layer_name);
-        dxf_char_free_list (layer_index->hard_owner_reference);
+        if (layer_index->layer_name != NULL)
+        {
+                dxf_char_free_list ((DxfChar *) layer_index->layer_name);
+        }
+        if (layer_index->number_of_entries != NULL)
+        {
+                dxf_int32_free_list ((DxfInt32 *) layer_index->number_of_entries);
+        }
+        if (layer_index->hard_owner_reference != NULL)
+        {
+                dxf_char_free_list ((DxfChar *) layer_index->hard_owner_reference);
+        }
+        dxf_layer_index_clear (layer_index);
         free (layer_index);
         layer_index = NULL;
 #if DEBUG
@@ -503,6 +597,7 @@ dxf_layer_index_free_list
         while (layer_indices != NULL)
         {
                 DxfLayerIndex *iter = (DxfLayerIndex *) layer_indices->next;
+                layer_indices->next = NULL;
                 dxf_layer_index_free (layer_indices);
                 layer_indices = (DxfLayerIndex *) iter;
         }
@@ -954,9 +1049,6 @@ dxf_layer_index_get_last
         }
         if (layer_index->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfLayerIndex *) layer_index);
         }
         DxfLayerIndex *iter = (DxfLayerIndex *) layer_index->next;
@@ -971,4 +1063,608 @@ dxf_layer_index_get_last
 }
 
 
+/*!
+ * \brief Compute the hash of a layer name, layer names are case
+ * insensitive.
+ */
+static unsigned int
+dxf_layer_index_hash
+(
+        const char *layer_name
+                /*!< Name of the layer. */
+)
+{
+        unsigned int hash = 2166136261u;
+
+        while (*layer_name != '\0')
+        {
+                hash ^= (unsigned int) toupper ((unsigned char) *layer_name);
+                hash *= 16777619u;
+                layer_name++;
+        }
+        return (hash);
+}
+
+
+/*!
+ * \brief Find the bucket of a layer in a DXF \c LAYER_INDEX object,
+ * optionally adding a new (empty) bucket.
+ *
+ * \return the index of the bucket, or \c -1 when the layer has no
+ * bucket or an error occurred.
+ */
+static int
+dxf_layer_index_find_bucket
+(
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        const char *layer_name,
+                /*!< Name of the layer. */
+        int create
+                /*!< Add a bucket when the layer has no bucket yet. */
+)
+{
+        DxfLayerIndexBucket *buckets;
+        int *lookup;
+        unsigned int mask;
+        unsigned int slot;
+        int size;
+        int i;
+
+        if (layer_index->lookup_size > 0)
+        {
+                mask = (unsigned int) layer_index->lookup_size - 1;
+                slot = dxf_layer_index_hash (layer_name) & mask;
+                while (layer_index->lookup[slot] != -1)
+                {
+                        if (strcasecmp (layer_index->buckets[layer_index->lookup[slot]].layer_name, layer_name) == 0)
+                        {
+                                return (layer_index->lookup[slot]);
+                        }
+                        slot = (slot + 1) & mask;
+                }
+        }
+        if (!create)
+        {
+                return (-1);
+        }
+        /* Keep the hash table at most half full. */
+        if (2 * (layer_index->number_of_buckets + 1) > layer_index->lookup_size)
+        {
+                size = (layer_index->lookup_size > 0) ? 2 * layer_index->lookup_size : 16;
+                lookup = malloc (size * sizeof (int));
+                if (lookup == NULL)
+                {
+                        return (-1);
+                }
+                for (i = 0; i < size; i++)
+                {
+                        lookup[i] = -1;
+                }
+                mask = (unsigned int) size - 1;
+                for (i = 0; i < layer_index->number_of_buckets; i++)
+                {
+                        slot = dxf_layer_index_hash (layer_index->buckets[i].layer_name) & mask;
+                        while (lookup[slot] != -1)
+                        {
+                                slot = (slot + 1) & mask;
+                        }
+                        lookup[slot] = i;
+                }
+                free (layer_index->lookup);
+                layer_index->lookup = lookup;
+                layer_index->lookup_size = size;
+        }
+        if (layer_index->number_of_buckets == layer_index->buckets_size)
+        {
+                size = (layer_index->buckets_size > 0) ? 2 * layer_index->buckets_size : 8;
+                buckets = realloc (layer_index->buckets, size * sizeof (DxfLayerIndexBucket));
+                if (buckets == NULL)
+                {
+                        return (-1);
+                }
+                layer_index->buckets = buckets;
+                layer_index->buckets_size = size;
+        }
+        i = layer_index->number_of_buckets;
+        layer_index->buckets[i].layer_name = strdup (layer_name);
+        if (layer_index->buckets[i].layer_name == NULL)
+        {
+                return (-1);
+        }
+        layer_index->buckets[i].items = NULL;
+        layer_index->buckets[i].number_of_items = 0;
+        layer_index->buckets[i].size = 0;
+        mask = (unsigned int) layer_index->lookup_size - 1;
+        slot = dxf_layer_index_hash (layer_name) & mask;
+        while (layer_index->lookup[slot] != -1)
+        {
+                slot = (slot + 1) & mask;
+        }
+        layer_index->lookup[slot] = i;
+        layer_index->number_of_buckets++;
+        return (i);
+}
+
+
+/*!
+ * \brief Find the hard owner reference to the \c IDBUFFER of a layer in
+ * the parallel lists of layer names and references.
+ *
+ * \return the reference, or \c NULL when the layer has no (or an
+ * empty) reference.
+ */
+static char *
+dxf_layer_index_find_reference
+(
+        DxfChar *layer_name,
+                /*!< First layer name of the list. */
+        DxfChar *reference,
+                /*!< First hard owner reference of the list. */
+        const char *name
+                /*!< Name of the layer, case insensitive. */
+)
+{
+        while ((layer_name != NULL) && (reference != NULL))
+        {
+                if ((strcasecmp (layer_name->value, name) == 0)
+                  && (strcmp (reference->value, "") != 0))
+                {
+                        return (reference->value);
+                }
+                layer_name = (DxfChar *) layer_name->next;
+                reference = (DxfChar *) reference->next;
+        }
+        return (NULL);
+}
+
+
+/*!
+ * \brief Refresh the layer names, numbers of entries and hard owner
+ * references of a DXF \c LAYER_INDEX object from it's buckets.
+ *
+ * A layer keeps the hard owner reference to it's \c IDBUFFER, a layer
+ * without a reference gets a new handle from \c fp, or an empty
+ * reference when \c fp is \c NULL.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_layer_index_sync_lists
+(
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        DxfFile *fp
+                /*!< DXF file pointer handing out new handles, may be
+                 * \c NULL. */
+)
+{
+        DxfChar *old_layer_names;
+        DxfChar *old_references;
+        DxfChar *layer_name;
+        DxfChar *reference;
+        DxfChar *last_layer_name = NULL;
+        DxfChar *last_reference = NULL;
+        DxfInt32 *number;
+        DxfInt32 *last_number = NULL;
+        char handle[DXF_MAX_STRING_LENGTH];
+        char *value;
+        int result = EXIT_SUCCESS;
+        int i;
+
+        old_layer_names = (DxfChar *) layer_index->layer_name;
+        old_references = (DxfChar *) layer_index->hard_owner_reference;
+        if (layer_index->number_of_entries != NULL)
+        {
+                dxf_int32_free_list ((DxfInt32 *) layer_index->number_of_entries);
+        }
+        layer_index->layer_name = NULL;
+        layer_index->number_of_entries = NULL;
+        layer_index->hard_owner_reference = NULL;
+        for (i = 0; i < layer_index->number_of_buckets; i++)
+        {
+                value = dxf_layer_index_find_reference (old_layer_names,
+                  old_references, layer_index->buckets[i].layer_name);
+                if ((value == NULL) && (fp != NULL))
+                {
+                        fp->last_id_code++;
+                        snprintf (handle, sizeof (handle), "%x", fp->last_id_code);
+                        value = handle;
+                }
+                layer_name = dxf_char_new ();
+                reference = dxf_char_new ();
+                number = dxf_int32_init (dxf_int32_new ());
+                if ((layer_name == NULL) || (reference == NULL) || (number == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (layer_name);
+                        free (reference);
+                        free (number);
+                        result = EXIT_FAILURE;
+                        break;
+                }
+                dxf_char_set_value (layer_name, layer_index->buckets[i].layer_name);
+                layer_name->length = strlen (layer_name->value);
+                dxf_char_set_value (reference, (value != NULL) ? value : "");
+                reference->length = strlen (reference->value);
+                number->value = layer_index->buckets[i].number_of_items;
+                if (last_layer_name == NULL)
+                {
+                        layer_index->layer_name = (struct dxf_char_struct *) layer_name;
+                        layer_index->hard_owner_reference = (struct dxf_char_struct *) reference;
+                        layer_index->number_of_entries = (struct dxf_int32_struct *) number;
+                }
+                else
+                {
+                        last_layer_name->next = (struct DxfChar *) layer_name;
+                        last_reference->next = (struct DxfChar *) reference;
+                        last_number->next = (struct DxfInt32 *) number;
+                }
+                last_layer_name = layer_name;
+                last_reference = reference;
+                last_number = number;
+        }
+        if (old_layer_names != NULL)
+        {
+                dxf_char_free_list (old_layer_names);
+        }
+        if (old_references != NULL)
+        {
+                dxf_char_free_list (old_references);
+        }
+        return (result);
+}
+
+
+/*!
+ * \brief Write DXF output to a file for the \c IDBUFFER object holding
+ * the entities of a layer in a DXF \c LAYER_INDEX object.
+ *
+ * The soft pointers of the \c IDBUFFER are the handles of the entities
+ * in the bucket of the layer.
+ */
+static void
+dxf_layer_index_write_idbuffer
+(
+        DxfFile *fp,
+                /*!< DXF file pointer to an output file (or device). */
+        DxfLayerIndex *layer_index,
+                /*!< DXF \c LAYER_INDEX object owning the \c IDBUFFER. */
+        DxfLayerIndexBucket *bucket,
+                /*!< Bucket of the layer. */
+        const char *handle
+                /*!< Handle of the \c IDBUFFER. */
+)
+{
+        int i;
+
+        fprintf (fp->fp, "  0\nIDBUFFER\n");
+        fprintf (fp->fp, "  5\n%s\n", handle);
+        if (fp->acad_version_number >= AutoCAD_14)
+        {
+                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
+                fprintf (fp->fp, "330\n%x\n", layer_index->id_code);
+                fprintf (fp->fp, "102\n}\n");
+        }
+        if (fp->acad_version_number >= AutoCAD_2000)
+        {
+                fprintf (fp->fp, "330\n%x\n", layer_index->id_code);
+        }
+        if (fp->acad_version_number >= AutoCAD_13)
+        {
+                fprintf (fp->fp, "100\nAcDbIdBuffer\n");
+        }
+        for (i = 0; i < bucket->number_of_items; i++)
+        {
+                fprintf (fp->fp, "330\n%x\n",
+                  dxf_entity_get_id_code (bucket->items[i].type,
+                  bucket->items[i].entity));
+        }
+}
+
+
+/*!
+ * \brief Remove all entity buckets from a DXF \c LAYER_INDEX object.
+ *
+ * The layer names, numbers of entries and hard owner references read
+ * from file are kept.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_layer_index_clear
+(
+        DxfLayerIndex *layer_index
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if (layer_index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < layer_index->number_of_buckets; i++)
+        {
+                free (layer_index->buckets[i].layer_name);
+                free (layer_index->buckets[i].items);
+        }
+        free (layer_index->buckets);
+        free (layer_index->lookup);
+        layer_index->buckets = NULL;
+        layer_index->number_of_buckets = 0;
+        layer_index->buckets_size = 0;
+        layer_index->lookup = NULL;
+        layer_index->lookup_size = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an entity to the bucket of it's layer in a DXF
+ * \c LAYER_INDEX object.
+ *
+ * A bucket is added for a layer which was not encountered before.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * entity has no layer or an error occurred.
+ */
+int
+dxf_layer_index_add_entity
+(
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Entity to be added. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLayerIndexBucket *bucket;
+        DxfEntitiesSequenceItem *items;
+        char *layer_name;
+        int index;
+        int size;
+
+        /* Do some basic checks. */
+        if ((layer_index == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        layer_name = dxf_entity_get_layer (type, entity);
+        if (layer_name == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        index = dxf_layer_index_find_bucket (layer_index, layer_name, TRUE);
+        if (index < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        bucket = &layer_index->buckets[index];
+        if (bucket->number_of_items == bucket->size)
+        {
+                size = (bucket->size > 0) ? 2 * bucket->size : 16;
+                items = realloc (bucket->items, size * sizeof (DxfEntitiesSequenceItem));
+                if (items == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                bucket->items = items;
+                bucket->size = size;
+        }
+        bucket->items[bucket->number_of_items].type = type;
+        bucket->items[bucket->number_of_items].entity = entity;
+        bucket->number_of_items++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the entity buckets of a DXF \c LAYER_INDEX object from
+ * the entities in a DXF entities section.
+ *
+ * Previously built buckets are replaced, the layer names and numbers of
+ * entries are refreshed from the buckets, the hard owner references to
+ * the \c IDBUFFER objects are kept for the layers which still have
+ * entities, and the \c time_stamp is set to the current time.
+ *
+ * \return a pointer to \c layer_index, or \c NULL when an error
+ * occurred.
+ */
+DxfLayerIndex *
+dxf_layer_index_build
+(
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        DxfEntities *entities
+                /*!< DXF entities section to be indexed. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int i;
+
+        /* Do some basic checks. */
+        if ((layer_index == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_layer_index_clear (layer_index);
+        for (i = 0; i < entities->number_of_sequence_items; i++)
+        {
+                if ((dxf_entity_get_layer (entities->sequence[i].type,
+                  entities->sequence[i].entity) != NULL)
+                  && (dxf_layer_index_add_entity (layer_index,
+                  entities->sequence[i].type,
+                  entities->sequence[i].entity) == EXIT_FAILURE))
+                {
+                        return (NULL);
+                }
+        }
+        if (dxf_layer_index_sync_lists (layer_index, NULL) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        layer_index->time_stamp = dxf_julian_date_now ();
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (layer_index);
+}
+
+
+/*!
+ * \brief Get the entities on a layer from a DXF \c LAYER_INDEX object.
+ *
+ * The layer is found with a hash lookup, the returned array is owned by
+ * the layer index and remains valid until the next entity is added to
+ * the layer or the buckets are cleared.
+ *
+ * \return the compact array of the entities on the layer, or \c NULL
+ * when the layer has no entities or an error occurred.
+ */
+DxfEntitiesSequenceItem *
+dxf_layer_index_get_entities
+(
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        const char *layer_name,
+                /*!< Name of the layer, case insensitive. */
+        int *number_of_items
+                /*!< Receives the number of entities on the layer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int index;
+
+        /* Do some basic checks. */
+        if ((layer_index == NULL) || (layer_name == NULL)
+          || (number_of_items == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        *number_of_items = 0;
+        index = dxf_layer_index_find_bucket (layer_index, layer_name, FALSE);
+        if (index < 0)
+        {
+                return (NULL);
+        }
+        *number_of_items = layer_index->buckets[index].number_of_items;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (layer_index->buckets[index].items);
+}
+
+
+/*!
+ * \brief Get the number of entity buckets (layers) in a DXF
+ * \c LAYER_INDEX object.
+ *
+ * \return the number of buckets, or \c 0 when an error occurred.
+ */
+int
+dxf_layer_index_get_number_of_buckets
+(
+        DxfLayerIndex *layer_index
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (layer_index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (0);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (layer_index->number_of_buckets);
+}
+
+
+/*!
+ * \brief Get an entity bucket from a DXF \c LAYER_INDEX object.
+ *
+ * \return the bucket, or \c NULL when \c index is out of range or an
+ * error occurred.
+ */
+DxfLayerIndexBucket *
+dxf_layer_index_get_bucket
+(
+        DxfLayerIndex *layer_index,
+                /*!< a pointer to a DXF \c LAYER_INDEX object. */
+        int index
+                /*!< Index of the bucket. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (layer_index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((index < 0) || (index >= layer_index->number_of_buckets))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () index is out of range.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (&layer_index->buckets[index]);
+}
+
+
 /* EOF*/
@@ -67,6 +67,7 @@
 #include "global.h"
 #include "util.h"
 #include "layer_name.h"
+#include "entities.h"
 
 
 #ifdef __cplusplus
@@ -74,6 +75,25 @@ extern "C" {
 #endif
 
 
+/*!
+ * \brief libDXF definition of the entities on a layer in a
+ * \c LAYER_INDEX object.
+ */
+typedef struct
+dxf_layer_index_bucket_struct
+{
+        char *layer_name;
+                /*!< Name of the layer. */
+        DxfEntitiesSequenceItem *items;
+                /*!< Entities on the layer, in the order they were
+                 * added. */
+        int number_of_items;
+                /*!< Number of used items in \c items. */
+        int size;
+                /*!< Number of allocated items in \c items. */
+} DxfLayerIndexBucket;
+
+
 /*!
  * \brief DXF definition of an AutoCAD idbuffer object (\c LAYER_INDEX).
  */
@@ -107,6 +127,19 @@ dxf_layer_index_struct
                 /*!< Hard owner reference to IDBUFFER (multiple entries
                  * may exist).\n
                  * Group code = 360. */
+        DxfLayerIndexBucket *buckets;
+                /*!< Entity buckets, one per layer, in the order in
+                 * which the layers were first encountered. */
+        int number_of_buckets;
+                /*!< Number of used buckets in \c buckets. */
+        int buckets_size;
+                /*!< Number of allocated buckets in \c buckets. */
+        int *lookup;
+                /*!< Open addressing hash table of bucket indices by
+                 * (case insensitive) layer name, \c -1 for an empty
+                 * slot. */
+        int lookup_size;
+                /*!< Number of slots in \c lookup, a power of 2. */
         struct DxfLayerIndex *next;
                 /*!< Pointer to the next DxfLayerIndex.\n
                  * \c NULL in the last DxfLayerIndex. */
@@ -130,6 +163,12 @@ DxfLayerIndex *dxf_layer_index_set_time_stamp (DxfLayerIndex *layer_index, doubl
 DxfLayerIndex *dxf_layer_index_get_next (DxfLayerIndex *layer_index);
 DxfLayerIndex *dxf_layer_index_set_next (DxfLayerIndex *layer_index, DxfLayerIndex *next);
 DxfLayerIndex *dxf_layer_index_get_last (DxfLayerIndex *layer_index);
+int dxf_layer_index_clear (DxfLayerIndex *layer_index);
+int dxf_layer_index_add_entity (DxfLayerIndex *layer_index, DxfEntityType type, void *entity);
+DxfLayerIndex *dxf_layer_index_build (DxfLayerIndex *layer_index, DxfEntities *entities);
+DxfEntitiesSequenceItem *dxf_layer_index_get_entities (DxfLayerIndex *layer_index, const char *layer_name, int *number_of_items);
+int dxf_layer_index_get_number_of_buckets (DxfLayerIndex *layer_index);
+DxfLayerIndexBucket *dxf_layer_index_get_bucket (DxfLayerIndex *layer_index, int index);
 
 
 #ifdef __cplusplus
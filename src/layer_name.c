@@ -188,6 +188,7 @@ dxf_layer_name_free_list
         while (layer_names != NULL)
         {
                 DxfLayerName *iter = (DxfLayerName *) layer_names->next;
+                layer_names->next = NULL;
                 dxf_layer_name_free (layer_names);
                 layer_names = (DxfLayerName *) iter;
         }
@@ -459,9 +460,6 @@ dxf_layer_name_get_last
         }
         if (layer_name->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfLayerName *) layer_name);
         }
         DxfLayerName *iter = (DxfLayerName *) layer_name->next;
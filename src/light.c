@@ -36,6 +36,7 @@
 
 
 #include "light.h"
+#include "util.h"
 
 
 /*!
@@ -180,7 +181,7 @@ dxf_light_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -188,13 +189,12 @@ dxf_light_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (light == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 light = dxf_light_init (light);
@@ -208,12 +208,11 @@ dxf_light_read
         }
         if (light->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                light->binary_graphics_data = dxf_binary_data_init (light->binary_graphics_data);
+                light->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (light->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -224,12 +223,11 @@ dxf_light_read
         }
         if (light->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                light->p0 = dxf_point_init (light->p0);
+                light->p0 = dxf_point_init (dxf_point_new ());
                 if (light->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -240,12 +238,11 @@ dxf_light_read
         }
         if (light->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                light->p1 = dxf_point_init (light->p1);
+                light->p1 = dxf_point_init (dxf_point_new ());
                 if (light->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -254,9 +251,9 @@ dxf_light_read
                         return (NULL);
                 }
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -264,8 +261,6 @@ dxf_light_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -279,14 +274,12 @@ dxf_light_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->linetype);
+                        dxf_read_string (&light->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->layer);
+                        dxf_read_string (&light->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -444,12 +437,12 @@ dxf_light_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                                 && ((strcmp (temp_string, "AcDbLight") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -486,31 +479,26 @@ dxf_light_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->binary_graphics_data->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) light->binary_graphics_data->next);
-                        light->binary_graphics_data = (DxfBinaryData *) light->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, light->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->dictionary_owner_soft);
+                        dxf_read_string (&light->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->material);
+                        dxf_read_string (&light->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->dictionary_owner_hard);
+                        dxf_read_string (&light->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -523,8 +511,7 @@ dxf_light_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->plot_style_name);
+                        dxf_read_string (&light->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -536,8 +523,7 @@ dxf_light_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, light->color_name);
+                        dxf_read_string (&light->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -549,16 +535,20 @@ dxf_light_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (light->linetype, "") == 0)
@@ -569,8 +559,6 @@ dxf_light_read
         {
                 light->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -597,7 +585,6 @@ dxf_light_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("LIGHT");
-        DxfBinaryData *iter_310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -687,11 +674,9 @@ dxf_light_write
 #else
         fprintf (fp->fp, " 92\n%d\n", light->graphics_data_size);
 #endif
-        iter_310 = (DxfBinaryData *) light->binary_graphics_data;
-        while (iter_310 != NULL)
+        if (light->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", iter_310->data_line);
-                iter_310 = (DxfBinaryData *) iter_310->next;
+                dxf_binary_data_write (fp, light->binary_graphics_data);
         }
         fprintf (fp->fp, "420\n%ld\n", light->color_value);
         fprintf (fp->fp, "430\n%s\n", light->color_name);
@@ -765,7 +750,10 @@ dxf_light_free
         }
         free (light->linetype);
         free (light->layer);
-        dxf_binary_data_free_list ((DxfBinaryData *) light->binary_graphics_data);
+        if (light->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (light->binary_graphics_data);
+        }
         free (light->dictionary_owner_hard);
         free (light->material);
         free (light->dictionary_owner_soft);
@@ -807,6 +795,7 @@ dxf_light_free_list
         while (light_list != NULL)
         {
                 DxfLight *iter = (DxfLight *) light_list->next;
+                light_list->next = NULL;
                 dxf_light_free (light_list);
                 light_list = (DxfLight *) iter;
         }
@@ -4269,9 +4258,6 @@ dxf_light_get_last
         }
         if (light->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfLight *) light);
         }
         DxfLight *iter = (DxfLight *) light->next;
@@ -39,9 +39,76 @@
  */
 
 
+/* The checked getters are defined here, also for trusted input. */
+#define DXF_CHECKED_GETTERS 1
+
+
 #include "line.h"
 
 
+/*!
+ * \brief Fields of a DXF \c LINE entity, in the order in which they
+ * are written.
+ */
+static const DxfFieldDescriptor dxf_line_fields[] =
+{
+        {5, DXF_FIELD_HANDLE, offsetof (DxfLine, id_code), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {330, DXF_FIELD_STRING, offsetof (DxfLine, dictionary_owner_soft), AutoCAD_14, 0, DXF_FIELD_OPTIONAL | DXF_FIELD_REACTORS, NULL, 0.0},
+        {360, DXF_FIELD_STRING, offsetof (DxfLine, dictionary_owner_hard), AutoCAD_14, 0, DXF_FIELD_OPTIONAL | DXF_FIELD_XDICTIONARY, NULL, 0.0},
+        {330, DXF_FIELD_STRING, offsetof (DxfLine, object_owner_soft), AutoCAD_2000, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {100, DXF_FIELD_SUBCLASS, 0, AutoCAD_13, 0, 0, "AcDbEntity", 0.0},
+        {67, DXF_FIELD_INT16, offsetof (DxfLine, paperspace), AutoCAD_1_0, 0, DXF_FIELD_OPTIONAL, NULL, DXF_MODELSPACE},
+        {8, DXF_FIELD_STRING, offsetof (DxfLine, layer), AutoCAD_1_0, 0, 0, DXF_DEFAULT_LAYER, 0.0},
+        {6, DXF_FIELD_STRING, offsetof (DxfLine, linetype), AutoCAD_1_0, 0, DXF_FIELD_OPTIONAL, DXF_DEFAULT_LINETYPE, 0.0},
+        {347, DXF_FIELD_STRING, offsetof (DxfLine, material), AutoCAD_2008, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {62, DXF_FIELD_INT16, offsetof (DxfLine, color), AutoCAD_1_0, 0, DXF_FIELD_OPTIONAL, NULL, DXF_COLOR_BYLAYER},
+        {48, DXF_FIELD_DOUBLE, offsetof (DxfLine, linetype_scale), AutoCAD_1_0, 0, DXF_FIELD_OPTIONAL, NULL, DXF_DEFAULT_LINETYPE_SCALE},
+        {370, DXF_FIELD_INT16, offsetof (DxfLine, lineweight), AutoCAD_2000, 0, 0, NULL, 0.0},
+        {38, DXF_FIELD_DOUBLE, offsetof (DxfLine, elevation), AutoCAD_1_0, AutoCAD_11, DXF_FIELD_OPTIONAL | DXF_FIELD_FLATLAND, NULL, 0.0},
+        {60, DXF_FIELD_INT16, offsetof (DxfLine, visibility), AutoCAD_1_0, 0, DXF_FIELD_OPTIONAL, NULL, DXF_DEFAULT_VISIBILITY},
+#ifdef BUILD_64
+        {160, DXF_FIELD_INT32, offsetof (DxfLine, graphics_data_size), AutoCAD_2000, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {92, DXF_FIELD_INT32, offsetof (DxfLine, graphics_data_size), AutoCAD_2000, 0, DXF_FIELD_READ_ONLY, NULL, 0.0},
+#else
+        {92, DXF_FIELD_INT32, offsetof (DxfLine, graphics_data_size), AutoCAD_2000, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {160, DXF_FIELD_INT32, offsetof (DxfLine, graphics_data_size), AutoCAD_2000, 0, DXF_FIELD_READ_ONLY, NULL, 0.0},
+#endif
+        {310, DXF_FIELD_BINARY_DATA, offsetof (DxfLine, binary_graphics_data), AutoCAD_2000, 0, 0, NULL, 0.0},
+        {420, DXF_FIELD_INT32, offsetof (DxfLine, color_value), AutoCAD_2004, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {430, DXF_FIELD_STRING, offsetof (DxfLine, color_name), AutoCAD_2004, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {440, DXF_FIELD_INT32, offsetof (DxfLine, transparency), AutoCAD_2004, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {390, DXF_FIELD_STRING, offsetof (DxfLine, plot_style_name), AutoCAD_2009, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {284, DXF_FIELD_INT16, offsetof (DxfLine, shadow_mode), AutoCAD_2009, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {100, DXF_FIELD_SUBCLASS, 0, AutoCAD_13, 0, 0, "AcDbLine", 0.0},
+        {39, DXF_FIELD_DOUBLE, offsetof (DxfLine, thickness), AutoCAD_1_0, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {10, DXF_FIELD_POINT_X, offsetof (DxfLine, p0), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {20, DXF_FIELD_POINT_Y, offsetof (DxfLine, p0), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {30, DXF_FIELD_POINT_Z, offsetof (DxfLine, p0), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {11, DXF_FIELD_POINT_X, offsetof (DxfLine, p1), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {21, DXF_FIELD_POINT_Y, offsetof (DxfLine, p1), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {31, DXF_FIELD_POINT_Z, offsetof (DxfLine, p1), AutoCAD_1_0, 0, 0, NULL, 0.0},
+        {210, DXF_FIELD_DOUBLE, offsetof (DxfLine, extr_x0), AutoCAD_12, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {220, DXF_FIELD_DOUBLE, offsetof (DxfLine, extr_y0), AutoCAD_12, 0, DXF_FIELD_OPTIONAL, NULL, 0.0},
+        {230, DXF_FIELD_DOUBLE, offsetof (DxfLine, extr_z0), AutoCAD_12, 0, DXF_FIELD_OPTIONAL, NULL, 1.0}
+};
+
+
+/*!
+ * \brief Descriptor of a DXF \c LINE entity.
+ */
+static DxfEntityDescriptor dxf_line_descriptor =
+{
+        "LINE",
+        sizeof (DxfLine),
+        offsetof (DxfLine, next),
+        dxf_line_fields,
+        sizeof (dxf_line_fields) / sizeof (dxf_line_fields[0]),
+        NULL,
+        NULL,
+        DXF_DESCRIPTOR_LOOKUP_NONE
+};
+
+
 /*!
  * \brief Allocate memory for a DXF \c LINE entity.
  *
@@ -115,61 +182,17 @@ dxf_line_init
                 __FUNCTION__);
               return (NULL);
         }
-        /* Initialize new structs for members. */
-        line->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (line->binary_graphics_data);
-        if (line->binary_graphics_data == NULL)
-        {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        line->p0 = (DxfPoint *) dxf_point_init (line->p0);
-        if (line->p0 == NULL)
-        {
-              fprintf (stderr,
-                (_("Error in %s () could not allocate memory.\n")),
-                __FUNCTION__);
-              return (NULL);
-        }
-        line->p1 = (DxfPoint *) dxf_point_init (line->p1);
-        if (line->p1 == NULL)
+        /* Assign the default values of the descriptor to members, the
+         * start point and end point are allocated, the binary graphics
+         * data is allocated when we have content. */
+        line = (DxfLine *) dxf_descriptor_init (&dxf_line_descriptor, line);
+        if (line == NULL)
         {
               fprintf (stderr,
                 (_("Error in %s () could not allocate memory.\n")),
                 __FUNCTION__);
               return (NULL);
         }
-        /* Assign initial values to members. */
-        line->id_code = 0;
-        line->linetype = strdup (DXF_DEFAULT_LINETYPE);
-        line->layer = strdup (DXF_DEFAULT_LAYER);
-        line->elevation = 0.0;
-        line->thickness = 0.0;
-        line->linetype_scale = DXF_DEFAULT_LINETYPE_SCALE;
-        line->visibility = DXF_DEFAULT_VISIBILITY;
-        line->color = DXF_COLOR_BYLAYER;
-        line->paperspace = DXF_MODELSPACE;
-        line->graphics_data_size = 0;
-        line->shadow_mode = 0;
-        line->dictionary_owner_soft = strdup ("");
-        line->object_owner_soft = strdup ("");
-        line->material = strdup ("");
-        line->dictionary_owner_hard = strdup ("");
-        line->lineweight = 0;
-        line->plot_style_name = strdup ("");
-        line->color_value = 0;
-        line->color_name = strdup ("");
-        line->transparency = 0;
-        line->extr_x0 = 0.0;
-        line->extr_y0 = 0.0;
-        line->extr_z0 = 0.0;
-        /* Initialize new structs for the following members later,
-         * when they are required and when we have content. */
-        line->binary_graphics_data = NULL;
-        line->p0 = NULL;
-        line->p1 = NULL;
-        line->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -200,357 +223,38 @@ dxf_line_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
-        int iter330;
-
         /* Do some basic checks. */
         if (fp == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (line == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 line = dxf_line_init (line);
         }
-        if (line->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                line->binary_graphics_data = dxf_binary_data_init (line->binary_graphics_data);
-                if (line->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-        }
-        if (line->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p0 = dxf_point_init (line->p0);
-                if (line->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-        }
-        if (line->p1 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                line->p1 = dxf_point_init (line->p1);
-                if (line->p1 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-        }
-        iter310 = (DxfBinaryData *) line->binary_graphics_data;
-        iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        line = (DxfLine *) dxf_descriptor_read (fp, &dxf_line_descriptor, line);
+        if (line == NULL)
         {
-                if (ferror (fp->fp))
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-                if (strcmp (temp_string, "5") == 0)
-                {
-                        /* Now follows a string containing a sequential
-                         * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &line->id_code);
-                }
-                else if (strcmp (temp_string, "6") == 0)
-                {
-                        /* Now follows a string containing a linetype
-                         * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->linetype);
-                }
-                else if (strcmp (temp_string, "8") == 0)
-                {
-                        /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->layer);
-                }
-                else if (strcmp (temp_string, "10") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->x0);
-                }
-                else if (strcmp (temp_string, "20") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->y0);
-                }
-                else if (strcmp (temp_string, "30") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the start point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p0->z0);
-                }
-                else if (strcmp (temp_string, "11") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->x0);
-                }
-                else if (strcmp (temp_string, "21") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->y0);
-                }
-                else if (strcmp (temp_string, "31") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-coordinate of the end point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->p1->z0);
-                }
-                else if (strcmp (temp_string, "38") == 0)
-                {
-                        /* Now follows a string containing the
-                         * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->elevation);
-                }
-                else if (strcmp (temp_string, "39") == 0)
-                {
-                        /* Now follows a string containing the
-                         * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->thickness);
-                }
-                else if (strcmp (temp_string, "48") == 0)
-                {
-                        /* Now follows a string containing the linetype
-                         * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->linetype_scale);
-                }
-                else if (strcmp (temp_string, "60") == 0)
-                {
-                        /* Now follows a string containing the
-                         * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->visibility);
-                }
-                else if (strcmp (temp_string, "62") == 0)
-                {
-                        /* Now follows a string containing the
-                         * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->color);
-                }
-                else if (strcmp (temp_string, "67") == 0)
-                {
-                        /* Now follows a string containing the
-                         * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->paperspace);
-                }
-                else if (strcmp (temp_string, "92") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "100") == 0)
-                {
-                        /* Now follows a string containing the
-                         * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbEntity") != 0)
-                        && ((strcmp (temp_string, "AcDbLine") != 0)))
-                        {
-                                fprintf (stderr,
-                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
-                                  __FUNCTION__, fp->filename, fp->line_number);
-                        }
-                }
-                else if (strcmp (temp_string, "160") == 0)
-                {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->graphics_data_size);
-                }
-                else if (strcmp (temp_string, "210") == 0)
-                {
-                        /* Now follows a string containing the
-                         * X-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_x0);
-                }
-                else if (strcmp (temp_string, "220") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Y-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_y0);
-                }
-                else if (strcmp (temp_string, "230") == 0)
-                {
-                        /* Now follows a string containing the
-                         * Z-value of the extrusion vector. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &line->extr_z0);
-                }
-                else if (strcmp (temp_string, "284") == 0)
-                {
-                        /* Now follows a string containing the shadow
-                         * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->shadow_mode);
-                }
-                else if (strcmp (temp_string, "310") == 0)
-                {
-                        /* Now follows a string containing binary
-                         * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
-                else if (strcmp (temp_string, "330") == 0)
-                {
-                        if (iter330 == 0)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_soft);
-                        }
-                        if (iter330 == 1)
-                        {
-                                /* Now follows a string containing a soft-pointer
-                                 * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->object_owner_soft);
-                        }
-                        iter330++;
-                }
-                else if (strcmp (temp_string, "347") == 0)
-                {
-                        /* Now follows a string containing a
-                         * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->material);
-                }
-                else if (strcmp (temp_string, "360") == 0)
-                {
-                        /* Now follows a string containing Hard owner
-                         * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->dictionary_owner_hard);
-                }
-                else if (strcmp (temp_string, "370") == 0)
-                {
-                        /* Now follows a string containing the lineweight
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &line->lineweight);
-                }
-                else if (strcmp (temp_string, "390") == 0)
-                {
-                        /* Now follows a string containing a plot style
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->plot_style_name);
-                }
-                else if (strcmp (temp_string, "420") == 0)
-                {
-                        /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->color_value);
-                }
-                else if (strcmp (temp_string, "430") == 0)
-                {
-                        /* Now follows a string containing a color
-                         * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, line->color_name);
-                }
-                else if (strcmp (temp_string, "440") == 0)
-                {
-                        /* Now follows a string containing a transparency
-                         * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%" PRIi32 "\n", &line->transparency);
-                }
-                else if (strcmp (temp_string, "999") == 0)
-                {
-                        /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
-                }
-                else
-                {
-                        fprintf (stderr,
-                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
-                          __FUNCTION__, fp->filename, fp->line_number);
-                }
+                return (NULL);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (line->linetype, "") == 0)
         {
+                free (line->linetype);
                 line->linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
         {
+                free (line->layer);
                 line->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -617,6 +321,7 @@ dxf_line_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
+                free (line->linetype);
                 line->linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (line->layer, "") == 0)
@@ -627,135 +332,15 @@ dxf_line_write
                 fprintf (stderr,
                   (_("    %s entity is relocated to layer 0\n")),
                   dxf_entity_name);
+                free (line->layer);
                 line->layer = strdup (DXF_DEFAULT_LAYER);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
-        if (line->id_code != -1)
-        {
-                fprintf (fp->fp, "  5\n%x\n", line->id_code);
-        }
-        /*!
-         * \todo for version R14.\n
-         * Implementing the start of application-defined group
-         * "{application_name", with Group code 102.\n
-         * For example: "{ACAD_REACTORS" indicates the start of the
-         * AutoCAD persistent reactors group.\n\n
-         * application-defined codes: Group codes and values within the
-         * 102 groups are application defined (optional).\n\n
-         * End of group, "}" (optional), with Group code 102.
-         */
-        if ((strcmp (line->dictionary_owner_soft, "") != 0)
-          && (fp->acad_version_number >= AutoCAD_14))
-        {
-                fprintf (fp->fp, "102\n{ACAD_REACTORS\n");
-                fprintf (fp->fp, "330\n%s\n", line->dictionary_owner_soft);
-                fprintf (fp->fp, "102\n}\n");
-        }
-        if ((strcmp (line->dictionary_owner_hard, "") != 0)
-          && (fp->acad_version_number >= AutoCAD_14))
-        {
-                fprintf (fp->fp, "102\n{ACAD_XDICTIONARY\n");
-                fprintf (fp->fp, "360\n%s\n", line->dictionary_owner_hard);
-                fprintf (fp->fp, "102\n}\n");
-        }
-        if ((strcmp (line->object_owner_soft, "") != 0)
-          && (fp->acad_version_number >= AutoCAD_2000))
-        {
-                fprintf (fp->fp, "330\n%s\n", line->object_owner_soft);
-        }
-        if (fp->acad_version_number >= AutoCAD_13)
-        {
-                fprintf (fp->fp, "100\nAcDbEntity\n");
-        }
-        if (line->paperspace == DXF_PAPERSPACE)
-        {
-                fprintf (fp->fp, " 67\n%hd\n", (int16_t) DXF_PAPERSPACE);
-        }
-        fprintf (fp->fp, "  8\n%s\n", line->layer);
-        if (strcmp (line->linetype, DXF_DEFAULT_LINETYPE) != 0)
-        {
-                fprintf (fp->fp, "  6\n%s\n", line->linetype);
-        }
-        if ((fp->acad_version_number >= AutoCAD_2008)
-          && (strcmp (line->material, "") != 0))
-        {
-                fprintf (fp->fp, "347\n%s\n", line->material);
-        }
-        if (line->color != DXF_COLOR_BYLAYER)
-        {
-                fprintf (fp->fp, " 62\n%hd\n", line->color);
-        }
-        if (fp->acad_version_number >= AutoCAD_2002)
-        {
-                fprintf (fp->fp, "370\n%hd\n", line->lineweight);
-        }
-        if ((fp->acad_version_number <= AutoCAD_11)
-          && DXF_FLATLAND
-          && (line->elevation != 0.0))
-        {
-                fprintf (fp->fp, " 38\n%f\n", line->elevation);
-        }
-        if (line->thickness != 0.0)
-        {
-                fprintf (fp->fp, " 39\n%f\n", line->thickness);
-        }
-        if (line->linetype_scale != 1.0)
-        {
-                fprintf (fp->fp, " 48\n%f\n", line->linetype_scale);
-        }
-        if (line->visibility != 0)
+        if (dxf_descriptor_write (fp, &dxf_line_descriptor, line) == EXIT_FAILURE)
         {
-                fprintf (fp->fp, " 60\n%hd\n", line->visibility);
-        }
-        if ((fp->acad_version_number >= AutoCAD_2000)
-          && (line->graphics_data_size > 0))
-        {
-#ifdef BUILD_64
-                fprintf (fp->fp, "160\n%" PRIi32 "\n", line->graphics_data_size);
-#else
-                fprintf (fp->fp, " 92\n%" PRIi32 "\n", line->graphics_data_size);
-#endif
-                if (line->binary_graphics_data != NULL)
-                {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) line->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
-                }
-        }
-        if (fp->acad_version_number >= AutoCAD_2004)
-        {
-                fprintf (fp->fp, "420\n%" PRIi32 "\n", line->color_value);
-                fprintf (fp->fp, "430\n%s\n", line->color_name);
-                fprintf (fp->fp, "440\n%" PRIi32 "\n", line->transparency);
-        }
-        if (fp->acad_version_number >= AutoCAD_2009)
-        {
-                fprintf (fp->fp, "390\n%s\n", line->plot_style_name);
-                fprintf (fp->fp, "284\n%hd\n", line->shadow_mode);
-        }
-        if (fp->acad_version_number >= AutoCAD_13)
-        {
-                fprintf (fp->fp, "100\nAcDbLine\n");
-        }
-        fprintf (fp->fp, " 10\n%f\n", line->p0->x0);
-        fprintf (fp->fp, " 20\n%f\n", line->p0->y0);
-        fprintf (fp->fp, " 30\n%f\n", line->p0->z0);
-        fprintf (fp->fp, " 11\n%f\n", line->p1->x0);
-        fprintf (fp->fp, " 21\n%f\n", line->p1->y0);
-        fprintf (fp->fp, " 31\n%f\n", line->p1->z0);
-        if ((fp->acad_version_number >= AutoCAD_12)
-                && (line->extr_x0 != 0.0)
-                && (line->extr_y0 != 0.0)
-                && (line->extr_z0 != 1.0))
-        {
-                fprintf (fp->fp, "210\n%f\n", line->extr_x0);
-                fprintf (fp->fp, "220\n%f\n", line->extr_y0);
-                fprintf (fp->fp, "230\n%f\n", line->extr_z0);
+                /* Clean up. */
+                free (dxf_entity_name);
+                return (EXIT_FAILURE);
         }
         /* Clean up. */
         free (dxf_entity_name);
@@ -799,18 +384,10 @@ dxf_line_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (line->linetype);
-        free (line->layer);
-        dxf_binary_data_free_list (line->binary_graphics_data);
-        free (line->dictionary_owner_soft);
-        free (line->object_owner_soft);
-        free (line->material);
-        free (line->dictionary_owner_hard);
-        free (line->plot_style_name);
-        free (line->color_name);
-        dxf_point_free (line->p0);
-        dxf_point_free (line->p1);
-        free (line);
+        if (dxf_descriptor_free (&dxf_line_descriptor, line) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
         line = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -843,6 +420,7 @@ dxf_line_free_list
         while (lines != NULL)
         {
                 DxfLine *iter = (DxfLine *) lines->next;
+                lines->next = NULL;
                 dxf_line_free (lines);
                 lines = (DxfLine *) iter;
         }
@@ -852,6 +430,51 @@ dxf_line_free_list
 }
 
 
+/*!
+ * \brief Make a deep copy of a DXF \c LINE entity.
+ *
+ * \return a pointer to the copy, or \c NULL when an error occurred.
+ */
+DxfLine *
+dxf_line_copy
+(
+        DxfLine *line
+                /*!< DXF \c LINE entity to be copied. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLine *copy = NULL;
+
+        /* Do some basic checks. */
+        if (line == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        copy = (DxfLine *) dxf_descriptor_copy (&dxf_line_descriptor, line);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (copy);
+}
+
+
+/*!
+ * \brief Get the descriptor of a DXF \c LINE entity.
+ *
+ * \return a pointer to the descriptor.
+ */
+DxfEntityDescriptor *
+dxf_line_get_descriptor ()
+{
+        return (&dxf_line_descriptor);
+}
+
+
 /*!
  * \brief Get the ID code from a DXF \c LINE entity.
  *
@@ -3492,9 +3115,6 @@ dxf_line_get_last
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfLine *) line);
         }
         DxfLine *iter = (DxfLine *) line->next;
@@ -46,6 +46,7 @@
 #include "global.h"
 #include "binary_data.h"
 #include "point.h"
+#include "descriptor.h"
 
 
 #ifdef __cplusplus
@@ -218,6 +219,8 @@ DxfLine *dxf_line_read (DxfFile *fp, DxfLine *line);
 int dxf_line_write (DxfFile *fp, DxfLine *line);
 int dxf_line_free (DxfLine *line);
 void dxf_line_free_list (DxfLine *lines);
+DxfLine *dxf_line_copy (DxfLine *line);
+DxfEntityDescriptor *dxf_line_get_descriptor ();
 int dxf_line_get_id_code (DxfLine *line);
 DxfLine *dxf_line_set_id_code (DxfLine *line, int id_code);
 char *dxf_line_get_linetype (DxfLine *line);
@@ -290,6 +293,118 @@ double dxf_line_get_length (DxfLine *line);
 DxfLine *dxf_line_create_from_points (DxfPoint *p1, DxfPoint *p2, int id_code, int inheritance);
 
 
+/*!
+ * \name Unchecked getters.
+ *
+ * Inline getters without checks for use in hot loops, on a \c LINE
+ * entity which passed \c dxf_entities_validate ().
+ */
+/*! \{ */
+
+
+static inline DxfPoint *
+dxf_line_get_p0_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p0);
+}
+
+
+static inline double
+dxf_line_get_x0_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p0->x0);
+}
+
+
+static inline double
+dxf_line_get_y0_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p0->y0);
+}
+
+
+static inline double
+dxf_line_get_z0_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p0->z0);
+}
+
+
+static inline DxfPoint *
+dxf_line_get_p1_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p1);
+}
+
+
+static inline double
+dxf_line_get_x1_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p1->x0);
+}
+
+
+static inline double
+dxf_line_get_y1_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p1->y0);
+}
+
+
+static inline double
+dxf_line_get_z1_unchecked
+(
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+        return (line->p1->z0);
+}
+
+
+/*! \} */
+
+
+#if DXF_TRUSTED_INPUT && !defined (DXF_CHECKED_GETTERS)
+#  define dxf_line_get_p0(line) dxf_line_get_p0_unchecked (line)
+#  define dxf_line_get_x0(line) dxf_line_get_x0_unchecked (line)
+#  define dxf_line_get_y0(line) dxf_line_get_y0_unchecked (line)
+#  define dxf_line_get_z0(line) dxf_line_get_z0_unchecked (line)
+#  define dxf_line_get_p1(line) dxf_line_get_p1_unchecked (line)
+#  define dxf_line_get_x1(line) dxf_line_get_x1_unchecked (line)
+#  define dxf_line_get_y1(line) dxf_line_get_y1_unchecked (line)
+#  define dxf_line_get_z1(line) dxf_line_get_z1_unchecked (line)
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,459 @@
+/*!
+ * \file load_options.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for libDXF load options.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "load_options.h"
+
+
+/*!
+ * \brief Allocate memory for libDXF load options.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfLoadOptions *
+dxf_load_options_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfLoadOptions *options = NULL;
+        size_t size;
+
+        size = sizeof (DxfLoadOptions);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((options = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                options = NULL;
+        }
+        else
+        {
+                memset (options, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in libDXF load
+ * options.
+ *
+ * The initialized options load all entity types on all layers.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfLoadOptions *
+dxf_load_options_init
+(
+        DxfLoadOptions *options
+                /*!< libDXF load options. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Warning in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                options = dxf_load_options_new ();
+        }
+        if (options == NULL)
+        {
+              fprintf (stderr,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        options->entity_types = DXF_ALL_ENTITY_TYPES;
+        options->layer_filter = NULL;
+        options->layer_filter_data = NULL;
+        options->diagnostics = NULL;
+        options->layer_index = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options);
+}
+
+
+/*!
+ * \brief Free the allocated memory for libDXF load options.
+ *
+ * The \c layer_filter_data, \c diagnostics and \c layer_index members
+ * are owned by the caller and are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_load_options_free
+(
+        DxfLoadOptions *options
+                /*!< Pointer to the memory occupied by the libDXF load
+                 * options. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (options);
+        options = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the bitmask of entity types to be loaded from libDXF load
+ * options.
+ *
+ * \return the bitmask of entity types, \c DXF_ALL_ENTITY_TYPES when an
+ * error occurred.
+ */
+uint64_t
+dxf_load_options_get_entity_types
+(
+        DxfLoadOptions *options
+                /*!< libDXF load options. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (DXF_ALL_ENTITY_TYPES);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options->entity_types);
+}
+
+
+/*!
+ * \brief Set the bitmask of entity types to be loaded for libDXF load
+ * options.
+ *
+ * For example, to load only \c LINE, \c ARC and \c LWPOLYLINE entities:
+ * \code
+ * dxf_load_options_set_entity_types (options,
+ *   DXF_ENTITY_TYPE_BIT (LINE)
+ *   | DXF_ENTITY_TYPE_BIT (ARC)
+ *   | DXF_ENTITY_TYPE_BIT (LWPOLYLINE));
+ * \endcode
+ *
+ * \return a pointer to \c options when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLoadOptions *
+dxf_load_options_set_entity_types
+(
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        uint64_t entity_types
+                /*!< Bitmask of entity types to be loaded. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        options->entity_types = entity_types;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options);
+}
+
+
+/*!
+ * \brief Set the layer name predicate for libDXF load options.
+ *
+ * For example, to load only entities on layers matching "WALL*":
+ * \code
+ * dxf_load_options_set_layer_filter (options,
+ *   dxf_load_options_layer_match, "WALL*");
+ * \endcode
+ *
+ * \return a pointer to \c options when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLoadOptions *
+dxf_load_options_set_layer_filter
+(
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        DxfLayerFilter layer_filter,
+                /*!< Layer name predicate, \c NULL for all layers. */
+        void *layer_filter_data
+                /*!< User data passed to \c layer_filter. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        options->layer_filter = layer_filter;
+        options->layer_filter_data = layer_filter_data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options);
+}
+
+
+/*!
+ * \brief Set the diagnostics sink registered on the file while reading.
+ *
+ * \return a pointer to \c options when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLoadOptions *
+dxf_load_options_set_diagnostics
+(
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        DxfDiagnostics *diagnostics
+                /*!< libDXF diagnostics sink, \c NULL discards
+                 * diagnostics. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        options->diagnostics = (struct DxfDiagnostics *) diagnostics;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options);
+}
+
+
+/*!
+ * \brief Set the layer index receiving the loaded entities in the
+ * buckets of their layers.
+ *
+ * \return a pointer to \c options when successful, or \c NULL when an
+ * error occurred.
+ */
+DxfLoadOptions *
+dxf_load_options_set_layer_index
+(
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        struct dxf_layer_index_struct *layer_index
+                /*!< DXF \c LAYER_INDEX object, \c NULL builds no
+                 * buckets. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (options == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        options->layer_index = layer_index;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (options);
+}
+
+
+/*!
+ * \brief Test if an entity type is to be loaded.
+ *
+ * \c NULL options accept all entity types.
+ *
+ * \return \c TRUE when entities of \c type are to be loaded, \c FALSE
+ * when they are to be skipped.
+ */
+int
+dxf_load_options_accept_entity_type
+(
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        DxfEntityType type
+                /*!< Entity type. */
+)
+{
+        if (options == NULL)
+        {
+                return (TRUE);
+        }
+        return ((options->entity_types & DXF_ENTITY_TYPE_BIT (type)) != 0);
+}
+
+
+/*!
+ * \brief Test if the entities on a layer are to be loaded.
+ *
+ * \c NULL options, or options without a layer filter, accept all
+ * layers.
+ *
+ * \return \c TRUE when entities on \c layer are to be loaded, \c FALSE
+ * when they are to be skipped.
+ */
+int
+dxf_load_options_accept_layer
+(
+        DxfLoadOptions *options,
+                /*!< libDXF load options. */
+        const char *layer
+                /*!< Layer name. */
+)
+{
+        if ((options == NULL) || (options->layer_filter == NULL))
+        {
+                return (TRUE);
+        }
+        if (layer == NULL)
+        {
+                layer = DXF_DEFAULT_LAYER;
+        }
+        return (options->layer_filter (layer, options->layer_filter_data) != FALSE);
+}
+
+
+/*!
+ * \brief Layer name predicate matching a wildcard pattern.
+ *
+ * A \c '*' in the pattern matches any sequence of characters, a
+ * \c '?' matches a single character.\n
+ * Matching is case insensitive, as are DXF layer names.
+ *
+ * \return \c TRUE when \c layer matches \c pattern, \c FALSE when not.
+ */
+int
+dxf_load_options_layer_match
+(
+        const char *layer,
+                /*!< Layer name. */
+        void *pattern
+                /*!< Wildcard pattern (a \c char string). */
+)
+{
+        const char *p = (const char *) pattern;
+        const char *star = NULL;
+        const char *retry = NULL;
+
+        if ((layer == NULL) || (p == NULL))
+        {
+                return (FALSE);
+        }
+        while (*layer != '\0')
+        {
+                if (*p == '*')
+                {
+                        /* Remember where to resume when the remainder
+                         * does not match. */
+                        star = ++p;
+                        retry = layer;
+                }
+                else if ((*p == '?')
+                  || (toupper ((unsigned char) *p) == toupper ((unsigned char) *layer)))
+                {
+                        p++;
+                        layer++;
+                }
+                else if (star != NULL)
+                {
+                        p = star;
+                        layer = ++retry;
+                }
+                else
+                {
+                        return (FALSE);
+                }
+        }
+        while (*p == '*')
+        {
+                p++;
+        }
+        return (*p == '\0');
+}
+
+
+/* EOF */
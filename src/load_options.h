@@ -0,0 +1,114 @@
+/*!
+ * \file load_options.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for libDXF load options.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_LOAD_OPTIONS_H
+#define LIBDXF_SRC_LOAD_OPTIONS_H
+
+
+#include "global.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_ENTITY_TYPE_BIT(type) ((uint64_t) 1 << (type))
+        /*!< \brief Bit for an entity type in the \c entity_types
+         * bitmask of a \c DxfLoadOptions. */
+
+#define DXF_ALL_ENTITY_TYPES (~((uint64_t) 0))
+        /*!< \brief Bitmask for loading all entity types. */
+
+
+/*!
+ * \brief Layer name predicate.
+ *
+ * \return \c TRUE when entities on \c layer are to be loaded, \c FALSE
+ * when they are to be skipped.
+ */
+typedef int (*DxfLayerFilter) (const char *layer, void *data);
+
+
+/*!
+ * \brief libDXF definition of the options for loading a DXF file.
+ *
+ * Entities rejected by the options are skipped while parsing, without
+ * allocating memory for them or converting their values.
+ */
+typedef struct
+dxf_load_options_struct
+{
+        uint64_t entity_types;
+                /*!< Bitmask of the entity types to be loaded, one bit
+                 * per \c DxfEntityType (see \c DXF_ENTITY_TYPE_BIT).\n
+                 * Defaults to \c DXF_ALL_ENTITY_TYPES. */
+        DxfLayerFilter layer_filter;
+                /*!< Predicate for the layer names of the entities to
+                 * be loaded.\n
+                 * \c NULL loads entities on all layers. */
+        void *layer_filter_data;
+                /*!< User data passed to \c layer_filter, for
+                 * \c dxf_load_options_layer_match this is the pattern. */
+        struct DxfDiagnostics *diagnostics;
+                /*!< Diagnostics sink registered on the file while
+                 * reading, \c NULL discards diagnostics. */
+        struct dxf_layer_index_struct *layer_index;
+                /*!< Layer index receiving every loaded entity in the
+                 * bucket of it's layer, \c NULL builds no buckets. */
+} DxfLoadOptions;
+
+
+DxfLoadOptions *dxf_load_options_new ();
+DxfLoadOptions *dxf_load_options_init (DxfLoadOptions *options);
+int dxf_load_options_free (DxfLoadOptions *options);
+uint64_t dxf_load_options_get_entity_types (DxfLoadOptions *options);
+DxfLoadOptions *dxf_load_options_set_entity_types (DxfLoadOptions *options, uint64_t entity_types);
+DxfLoadOptions *dxf_load_options_set_layer_filter (DxfLoadOptions *options, DxfLayerFilter layer_filter, void *layer_filter_data);
+DxfLoadOptions *dxf_load_options_set_diagnostics (DxfLoadOptions *options, DxfDiagnostics *diagnostics);
+DxfLoadOptions *dxf_load_options_set_layer_index (DxfLoadOptions *options, struct dxf_layer_index_struct *layer_index);
+int dxf_load_options_accept_entity_type (DxfLoadOptions *options, DxfEntityType type);
+int dxf_load_options_accept_layer (DxfLoadOptions *options, const char *layer);
+int dxf_load_options_layer_match (const char *layer, void *pattern);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_LOAD_OPTIONS_H */
+
+
+/* EOF */
@@ -161,7 +161,7 @@ dxf_ltype_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int element;
 
         /* Do some basic checks. */
@@ -170,21 +170,35 @@ dxf_ltype_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ltype == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ltype = dxf_ltype_init (ltype);
         }
         element = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (ltype->complex_text_string == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                ltype->complex_text_string = dxf_char_init (dxf_char_new ());
+                if (ltype->complex_text_string == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -192,8 +206,6 @@ dxf_ltype_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -207,23 +219,20 @@ dxf_ltype_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
                         /*! \todo add code for proper implementation. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->linetype_name);
+                        dxf_read_string (&ltype->linetype_name, fp);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a description. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->description);
+                        dxf_read_string (&ltype->description, fp);
                 }
                 else if (strcmp (temp_string, "9") == 0)
                 {
                         /* Now follows a string containing a complex
                          * text string (multiple entries possible). */
-                        (fp->line_number)++;
                         /*! \todo add code for proper implementation. */
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->complex_text_string->value);
+                        dxf_read_string (&ltype->complex_text_string->value, fp);
                 }
                 else if (strcmp (temp_string, "40") == 0)
                 {
@@ -321,8 +330,7 @@ dxf_ltype_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->dictionary_owner_soft);
+                        dxf_read_string (&ltype->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
@@ -336,22 +344,25 @@ dxf_ltype_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ltype->dictionary_owner_hard);
+                        dxf_read_string (&ltype->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ltype->linetype_name, "") == 0)
@@ -367,8 +378,6 @@ dxf_ltype_read
         {
                 ltype->alignment = 65;
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -650,6 +659,7 @@ dxf_ltype_free_list
         while (ltypes != NULL)
         {
                 DxfLType *iter = (DxfLType *) ltypes->next;
+                ltypes->next = NULL;
                 dxf_ltype_free (ltypes);
                 ltypes = (DxfLType *) iter;
         }
@@ -2326,9 +2336,6 @@ dxf_ltype_get_last
         }
         if (ltype->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfLType *) ltype);
         }
         DxfLType *iter = (DxfLType *) ltype->next;
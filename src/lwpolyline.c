@@ -44,6 +44,7 @@
 
 
 #include "lwpolyline.h"
+#include "util.h"
 
 
 /*!
@@ -178,8 +179,9 @@ dxf_lwpolyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfVertex *iter = NULL;
+        DxfVertex *vertex = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -187,25 +189,23 @@ dxf_lwpolyline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (lwpolyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lwpolyline = dxf_lwpolyline_init (lwpolyline);
         }
         if (lwpolyline->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                lwpolyline->binary_graphics_data = dxf_binary_data_init (lwpolyline->binary_graphics_data);
+                lwpolyline->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (lwpolyline->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -214,26 +214,15 @@ dxf_lwpolyline_read
                         return (NULL);
                 }
         }
-        if (lwpolyline->vertices == NULL)
+        /* Vertices are appended after the last vertex. */
+        iter = (DxfVertex *) lwpolyline->vertices;
+        while ((iter != NULL) && (iter->next != NULL))
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfVertex struct.\n")));
-                lwpolyline->vertices = (struct DxfVertex *) dxf_vertex_init ((DxfVertex *) lwpolyline->vertices);
-                if (lwpolyline->vertices == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
+                iter = (DxfVertex *) iter->next;
         }
-        iter = (DxfVertex *) lwpolyline->vertices;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -254,30 +243,45 @@ dxf_lwpolyline_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->linetype);
+                        dxf_read_string (&lwpolyline->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->layer);
+                        dxf_read_string (&lwpolyline->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
-                        * X-coordinate of a vertex. */
+                         * X-coordinate of a vertex, which starts a new
+                         * vertex. */
+                        vertex = dxf_vertex_init (dxf_vertex_new ());
+                        if (vertex == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        if (iter == NULL)
+                        {
+                                lwpolyline->vertices = (struct DxfVertex *) vertex;
+                        }
+                        else
+                        {
+                                iter->next = (struct DxfVertex *) vertex;
+                        }
+                        iter = vertex;
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->p0->x0);
-                        /*! \todo Create a pointer to the next DxfVertex if and when required. */
                 }
-                else if (strcmp (temp_string, "20") == 0)
+                else if ((strcmp (temp_string, "20") == 0)
+                  && (iter != NULL))
                 {
                         /* Now follows a string containing the
-                        * Y-coordinate of a vertex. */
+                         * Y-coordinate of a vertex. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->p0->y0);
-                        /*! \todo Create a pointer to the next DxfVertex if and when required. */
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -295,31 +299,29 @@ dxf_lwpolyline_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &lwpolyline->thickness);
                 }
-                else if (strcmp (temp_string, "40") == 0)
+                else if ((strcmp (temp_string, "40") == 0)
+                  && (iter != NULL))
                 {
                         /* Now follows a string containing the
                          * start width of the vertex. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->start_width);
                 }
-                else if (strcmp (temp_string, "41") == 0)
+                else if ((strcmp (temp_string, "41") == 0)
+                  && (iter != NULL))
                 {
                         /* Now follows a string containing the
-                         * start width of the vertex. */
+                         * end width of the vertex. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->end_width);
                 }
-                else if (strcmp (temp_string, "42") == 0)
+                else if ((strcmp (temp_string, "42") == 0)
+                  && (iter != NULL))
                 {
                         /* Now follows a string containing the bulge of
                          * the vertex. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &iter->bulge);
-                        /* The last member of the vertex is read.\n */
-                        /*! \todo The pointer administration needs to be checked for functionality. */
-                         /* Increment iter to next DxfVertex. */
-                        iter->next = (struct DxfVertex *) dxf_vertex_new ();
-                        iter = (DxfVertex *) iter->next;
                 }
                 else if (strcmp (temp_string, "43") == 0)
                 {
@@ -378,8 +380,7 @@ dxf_lwpolyline_read
                          * version should probably be added here.
                          * Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                 }
                 else if (strcmp (temp_string, "210") == 0)
                 {
@@ -406,34 +407,32 @@ dxf_lwpolyline_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_soft);
+                        dxf_read_string (&lwpolyline->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, lwpolyline->dictionary_owner_hard);
+                        dxf_read_string (&lwpolyline->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /*! \todo Free memory to the last (unused) vertex in the linked list. */
-
-        /* Set the pointer to the last (unused) vertex in the linked list to NULL. */
-        iter->next = NULL;
         /* Handle omitted members and/or illegal values. */
         if (strcmp (lwpolyline->linetype, "") == 0)
         {
@@ -443,8 +442,6 @@ dxf_lwpolyline_read
         {
                 lwpolyline->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -717,6 +714,7 @@ dxf_lwpolyline_free_list
         while (lwpolylines != NULL)
         {
                 DxfLWPolyline *iter = (DxfLWPolyline *) lwpolylines->next;
+                lwpolylines->next = NULL;
                 dxf_lwpolyline_free (lwpolylines);
                 lwpolylines = (DxfLWPolyline *) iter;
         }
@@ -2898,9 +2896,6 @@ dxf_lwpolyline_get_last
         }
         if (lwpolyline->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfLWPolyline *) lwpolyline);
         }
         DxfLWPolyline *iter = (DxfLWPolyline *) lwpolyline->next;
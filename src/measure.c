@@ -0,0 +1,846 @@
+/*!
+ * \file measure.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the area, perimeter and centroid of closed boundaries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "measure.h"
+
+
+/*!
+ * \brief Compute <tt>x - sin (x)</tt> without cancellation for small
+ * angles.
+ */
+static double
+dxf_measure_x_minus_sin
+(
+        double x
+)
+{
+        double x2;
+
+        if (fabs (x) > 1.0e-2)
+        {
+                return (x - sin (x));
+        }
+        x2 = x * x;
+        return (x * x2 / 6.0 * (1.0 - x2 / 20.0 * (1.0 - x2 / 42.0 * (1.0 - x2 / 72.0))));
+}
+
+
+/*!
+ * \brief Add a straight or bulged segment to the area, perimeter and
+ * first moments in \c measure.
+ *
+ * A bulged segment adds the circular segment between it's chord and
+ * it's arc, both computed analytically.
+ */
+static void
+dxf_measure_add_segment
+(
+        DxfMeasure *measure,
+        double x0,
+                /*!< X-value of the start point, relative to the origin. */
+        double y0,
+                /*!< Y-value of the start point, relative to the origin. */
+        double x1,
+                /*!< X-value of the end point, relative to the origin. */
+        double y1,
+                /*!< Y-value of the end point, relative to the origin. */
+        double bulge
+                /*!< Bulge of the segment. */
+)
+{
+        double dx = x1 - x0;
+        double dy = y1 - y0;
+        double chord;
+        double cross;
+        double theta;
+        double alpha;
+        double radius;
+        double area;
+        double offset;
+        double ux;
+        double uy;
+
+        cross = x0 * y1 - x1 * y0;
+        measure->area += 0.5 * cross;
+        measure->centroid_x += (x0 + x1) * cross / 6.0;
+        measure->centroid_y += (y0 + y1) * cross / 6.0;
+        chord = sqrt (dx * dx + dy * dy);
+        if ((bulge == 0.0) || (chord == 0.0))
+        {
+                measure->perimeter += chord;
+                return;
+        }
+        /* A positive bulge runs counterclockwise, the arc lies on the
+         * right side of the chord. */
+        theta = 4.0 * atan (bulge);
+        alpha = 0.5 * fabs (theta);
+        radius = chord / (2.0 * sin (alpha));
+        measure->perimeter += fabs (theta) * radius;
+        area = 0.5 * radius * radius * dxf_measure_x_minus_sin (theta);
+        ux = ((bulge > 0.0) ? dy : -dy) / chord;
+        uy = ((bulge > 0.0) ? -dx : dx) / chord;
+        /* Distance from the chord to the centroid of the segment. */
+        offset = 4.0 * radius * pow (sin (alpha), 3.0)
+          / (3.0 * dxf_measure_x_minus_sin (2.0 * alpha))
+          - radius * cos (alpha);
+        measure->area += area;
+        measure->centroid_x += area * (0.5 * (x0 + x1) + offset * ux);
+        measure->centroid_y += area * (0.5 * (y0 + y1) + offset * uy);
+}
+
+
+/*!
+ * \brief Turn the first moments in \c measure into a centroid and
+ * transform it from the OCS to the WCS.
+ */
+static void
+dxf_measure_finish
+(
+        DxfMeasure *measure,
+        double origin_x,
+                /*!< X-value of the origin of the moments (in OCS). */
+        double origin_y,
+                /*!< Y-value of the origin of the moments (in OCS). */
+        double elevation,
+        double extr_x0,
+        double extr_y0,
+        double extr_z0
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double x = origin_x;
+        double y = origin_y;
+
+        if (measure->area != 0.0)
+        {
+                x += measure->centroid_x / measure->area;
+                y += measure->centroid_y / measure->area;
+        }
+        dxf_ocs_axes (extr_x0, extr_y0, extr_z0, ax, ay, az);
+        measure->centroid_x = x * ax[0] + y * ay[0] + elevation * az[0];
+        measure->centroid_y = x * ax[1] + y * ay[1] + elevation * az[1];
+        measure->centroid_z = x * ax[2] + y * ay[2] + elevation * az[2];
+}
+
+
+/*!
+ * \brief Measure a closed list of 2D polyline vertices.
+ *
+ * The moments are taken relative to the first vertex, which keeps
+ * the precision for coordinates far away from the origin.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when there are
+ * no vertices.
+ */
+static int
+dxf_measure_vertices
+(
+        DxfVertex *vertices,
+        double elevation,
+        double extr_x0,
+        double extr_y0,
+        double extr_z0,
+        DxfMeasure *measure
+)
+{
+        DxfVertex *first = NULL;
+        DxfVertex *prev = NULL;
+        DxfVertex *vertex;
+
+        memset (measure, 0, sizeof (DxfMeasure));
+        for (vertex = vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                if (vertex->p0 == NULL)
+                {
+                        continue;
+                }
+                if (first == NULL)
+                {
+                        first = vertex;
+                }
+                else
+                {
+                        dxf_measure_add_segment (measure,
+                          prev->p0->x0 - first->p0->x0, prev->p0->y0 - first->p0->y0,
+                          vertex->p0->x0 - first->p0->x0, vertex->p0->y0 - first->p0->y0,
+                          prev->bulge);
+                }
+                prev = vertex;
+        }
+        if (first == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_measure_add_segment (measure,
+          prev->p0->x0 - first->p0->x0, prev->p0->y0 - first->p0->y0,
+          0.0, 0.0, prev->bulge);
+        dxf_measure_finish (measure, first->p0->x0, first->p0->y0,
+          elevation, extr_x0, extr_y0, extr_z0);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the area, perimeter and centroid of a closed DXF
+ * \c LWPOLYLINE entity.
+ *
+ * Bulged segments are measured as exact circular arcs.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline is open or an error occurred.
+ */
+int
+dxf_measure_lwpolyline
+(
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        DxfMeasure *measure
+                /*!< Area, perimeter and centroid of the polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((lwpolyline == NULL) || (measure == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!(lwpolyline->flag & 1))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an open polyline was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_measure_vertices ((DxfVertex *) lwpolyline->vertices,
+          lwpolyline->elevation, lwpolyline->extr_x0,
+          lwpolyline->extr_y0, lwpolyline->extr_z0, measure));
+}
+
+
+/*!
+ * \brief Compute the area, perimeter and centroid of a closed 2D DXF
+ * \c POLYLINE entity.
+ *
+ * Bulged segments are measured as exact circular arcs, 3D polylines
+ * and meshes are refused.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline is open, not a 2D polyline or an error occurred.
+ */
+int
+dxf_measure_polyline
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        DxfMeasure *measure
+                /*!< Area, perimeter and centroid of the polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (measure == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & (8 | 16 | 64))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a 3D polyline or mesh was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!(polyline->flag & 1))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an open polyline was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_measure_vertices (polyline->vertices,
+          (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation,
+          polyline->extr_x0, polyline->extr_y0, polyline->extr_z0,
+          measure));
+}
+
+
+/*!
+ * \brief Compute the area, perimeter and centroid of a DXF \c HATCH
+ * boundary path polyline.
+ *
+ * A boundary path is always closed, bulged segments are measured as
+ * exact circular arcs.\n
+ * As in the other \c HATCH boundary kernels the bulge of a vertex is
+ * used as it is, the \c has_bulge flag only matters for writing.\n
+ * The centroid is in the OCS of the \c HATCH, with a Z-value of
+ * \c 0.0.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_measure_hatch_boundary_path_polyline
+(
+        DxfHatchBoundaryPathPolyline *polyline,
+                /*!< a pointer to a DXF \c HATCH boundary path
+                 * polyline. */
+        DxfMeasure *measure
+                /*!< Area, perimeter and centroid of the polyline. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolylineVertex *first;
+        DxfHatchBoundaryPathPolylineVertex *prev;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (measure == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        if (first == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a polyline without vertices was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (measure, 0, sizeof (DxfMeasure));
+        prev = first;
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) first->next;
+          vertex != NULL;
+          vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                dxf_measure_add_segment (measure,
+                  prev->x0 - first->x0, prev->y0 - first->y0,
+                  vertex->x0 - first->x0, vertex->y0 - first->y0,
+                  prev->bulge);
+                prev = vertex;
+        }
+        dxf_measure_add_segment (measure,
+          prev->x0 - first->x0, prev->y0 - first->y0,
+          0.0, 0.0, prev->bulge);
+        dxf_measure_finish (measure, first->x0, first->y0, 0.0,
+          0.0, 0.0, 1.0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the area, perimeter and centroid of a DXF \c CIRCLE
+ * entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_measure_circle
+(
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        DxfMeasure *measure
+                /*!< Area, perimeter and centroid of the circle. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((circle == NULL) || (measure == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (circle->p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        memset (measure, 0, sizeof (DxfMeasure));
+        measure->area = M_PI * circle->radius * circle->radius;
+        measure->perimeter = 2.0 * M_PI * fabs (circle->radius);
+        dxf_measure_finish (measure, circle->p0->x0, circle->p0->y0,
+          circle->p0->z0, circle->extr_x0, circle->extr_y0,
+          circle->extr_z0);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the area, perimeter and centroid of a full DXF
+ * \c ELLIPSE entity.
+ *
+ * The perimeter is the complete elliptic integral of the second kind,
+ * evaluated with the arithmetic-geometric mean to full precision.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * ellipse is not closed or an error occurred.
+ */
+int
+dxf_measure_ellipse
+(
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        DxfMeasure *measure
+                /*!< Area, perimeter and centroid of the ellipse. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double sweep;
+        double a;
+        double b;
+        double an;
+        double bn;
+        double cn;
+        double sum;
+        double weight;
+        int i;
+
+        /* Do some basic checks. */
+        if ((ellipse == NULL) || (measure == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+        if (sweep < 0.0)
+        {
+                sweep += 2.0 * M_PI;
+        }
+        if ((sweep > 1.0e-9) && (sweep < 2.0 * M_PI - 1.0e-9))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an elliptical arc was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        a = sqrt (ellipse->p1->x0 * ellipse->p1->x0
+          + ellipse->p1->y0 * ellipse->p1->y0
+          + ellipse->p1->z0 * ellipse->p1->z0);
+        b = fabs (ellipse->ratio) * a;
+        memset (measure, 0, sizeof (DxfMeasure));
+        measure->area = M_PI * a * b;
+        /* P = 2 pi / AGM (a, b) * (a^2 - sum 2^(n - 1) c_n^2). */
+        an = a;
+        bn = b;
+        sum = 0.5 * (a * a - b * b);
+        weight = 0.5;
+        for (i = 0; (i < 32) && (fabs (an - bn) > 1.0e-15 * an); i++)
+        {
+                cn = 0.5 * (an - bn);
+                bn = sqrt (an * bn);
+                an = an - cn;
+                weight *= 2.0;
+                sum += weight * cn * cn;
+        }
+        measure->perimeter = (an > 0.0) ? 2.0 * M_PI * (a * a - sum) / (an + bn) * 2.0 : 0.0;
+        measure->centroid_x = ellipse->p0->x0;
+        measure->centroid_y = ellipse->p0->y0;
+        measure->centroid_z = ellipse->p0->z0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compute the area, perimeter and centroid of a closed entity.
+ *
+ * Closed \c LWPOLYLINE and 2D \c POLYLINE entities, \c CIRCLE
+ * entities and full \c ELLIPSE entities are supported.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * is not a closed boundary or an error occurred.
+ */
+int
+dxf_measure_entity
+(
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity,
+                /*!< The entity. */
+        DxfMeasure *measure
+                /*!< Area, perimeter and centroid of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        switch (type)
+        {
+                case LWPOLYLINE:
+                        return (dxf_measure_lwpolyline ((DxfLWPolyline *) entity, measure));
+                case POLYLINE:
+                        return (dxf_measure_polyline ((DxfPolyline *) entity, measure));
+                case CIRCLE:
+                        return (dxf_measure_circle ((DxfCircle *) entity, measure));
+                case ELLIPSE:
+                        return (dxf_measure_ellipse ((DxfEllipse *) entity, measure));
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () an unsupported entity type was passed.\n")),
+                          __FUNCTION__);
+                        break;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Test if an entity is a closed boundary which can be measured,
+ * without reporting the entities which are not.
+ */
+static int
+dxf_measure_is_closed
+(
+        DxfEntityType type,
+        void *entity
+)
+{
+        DxfEllipse *ellipse;
+        double sweep;
+
+        switch (type)
+        {
+                case LWPOLYLINE:
+                        return ((((DxfLWPolyline *) entity)->flag & 1) != 0);
+                case POLYLINE:
+                        return ((((DxfPolyline *) entity)->flag & (1 | 8 | 16 | 64)) == 1);
+                case CIRCLE:
+                        return (((DxfCircle *) entity)->p0 != NULL);
+                case ELLIPSE:
+                        ellipse = (DxfEllipse *) entity;
+                        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+                        {
+                                return (FALSE);
+                        }
+                        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+                        if (sweep < 0.0)
+                        {
+                                sweep += 2.0 * M_PI;
+                        }
+                        return ((sweep <= 1.0e-9) || (sweep >= 2.0 * M_PI - 1.0e-9));
+                default:
+                        return (FALSE);
+        }
+}
+
+
+/*!
+ * \brief Get the handle of an entity which can be measured.
+ */
+static int
+dxf_measure_get_id_code
+(
+        DxfEntityType type,
+        void *entity
+)
+{
+        switch (type)
+        {
+                case LWPOLYLINE:
+                        return (((DxfLWPolyline *) entity)->id_code);
+                case POLYLINE:
+                        return (((DxfPolyline *) entity)->id_code);
+                case CIRCLE:
+                        return (((DxfCircle *) entity)->id_code);
+                case ELLIPSE:
+                        return (((DxfEllipse *) entity)->id_code);
+                default:
+                        return (0);
+        }
+}
+
+
+/*!
+ * \brief Compare two measure table entries by handle.
+ */
+static int
+dxf_measure_compare_entries
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfMeasureEntry *entry_a = (const DxfMeasureEntry *) a;
+        const DxfMeasureEntry *entry_b = (const DxfMeasureEntry *) b;
+
+        return ((entry_a->id_code > entry_b->id_code)
+          - (entry_a->id_code < entry_b->id_code));
+}
+
+
+/*!
+ * \brief Measure all closed boundaries in the entities section of a
+ * drawing.
+ *
+ * Every closed \c LWPOLYLINE, 2D \c POLYLINE, \c CIRCLE and full
+ * \c ELLIPSE gets an entry, the entries are sorted by handle for
+ * lookups with dxf_measure_table_find ().\n
+ * Drawings with at least \c DXF_MEASURE_PARALLEL_TABLE entities are
+ * measured in parallel when built with OpenMP, every entity is
+ * measured into its own slot and the slots are gathered in file order,
+ * so the table and the total area do not depend on the number of
+ * threads.
+ *
+ * \return a pointer to the table, or \c NULL when an error occurred.
+ */
+DxfMeasureTable *
+dxf_measure_table_new
+(
+        DxfDrawing *drawing
+                /*!< DXF drawing. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMeasureTable *table = NULL;
+        DxfMeasureEntry *entry;
+        DxfEntities *entities;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if (drawing == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        table = calloc (1, sizeof (DxfMeasureTable));
+        if (table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        entities = (DxfEntities *) drawing->entities_list;
+        if ((entities == NULL) || (entities->number_of_sequence_items == 0))
+        {
+                return (table);
+        }
+        table->entries = malloc (entities->number_of_sequence_items * sizeof (DxfMeasureEntry));
+        if (table->entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (table);
+                return (NULL);
+        }
+        n = entities->number_of_sequence_items;
+        /* Measure every entity into the slot of its sequence item, an
+         * entity without measure leaves its slot empty. */
+#ifdef _OPENMP
+#pragma omp parallel for private (entry) schedule (dynamic, 256) if (n >= DXF_MEASURE_PARALLEL_TABLE)
+#endif
+        for (i = 0; i < n; i++)
+        {
+                entry = &table->entries[i];
+                entry->entity = NULL;
+                if (!dxf_measure_is_closed (entities->sequence[i].type,
+                  entities->sequence[i].entity))
+                {
+                        continue;
+                }
+                if (dxf_measure_entity (entities->sequence[i].type,
+                  entities->sequence[i].entity, &entry->measure) == EXIT_FAILURE)
+                {
+                        continue;
+                }
+                entry->id_code = dxf_measure_get_id_code (entities->sequence[i].type,
+                  entities->sequence[i].entity);
+                entry->type = entities->sequence[i].type;
+                entry->entity = entities->sequence[i].entity;
+        }
+        /* Gather the filled slots in file order. */
+        for (i = 0; i < n; i++)
+        {
+                if (table->entries[i].entity == NULL)
+                {
+                        continue;
+                }
+                table->entries[table->number_of_entries] = table->entries[i];
+                table->total_area += fabs (table->entries[i].measure.area);
+                table->number_of_entries++;
+        }
+        qsort (table->entries, table->number_of_entries,
+          sizeof (DxfMeasureEntry), dxf_measure_compare_entries);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (table);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a measure table.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_measure_table_free
+(
+        DxfMeasureTable *table
+                /*!< Measure table. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (table->entries);
+        free (table);
+        table = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the entry of an entity in a measure table by handle.
+ *
+ * \return a pointer to the entry, or \c NULL when the entity is not in
+ * the table.
+ */
+DxfMeasureEntry *
+dxf_measure_table_find
+(
+        DxfMeasureTable *table,
+                /*!< Measure table. */
+        int id_code
+                /*!< Handle of the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int low;
+        int high;
+        int middle;
+
+        /* Do some basic checks. */
+        if (table == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        low = 0;
+        high = table->number_of_entries - 1;
+        while (low <= high)
+        {
+                middle = low + (high - low) / 2;
+                if (table->entries[middle].id_code < id_code)
+                {
+                        low = middle + 1;
+                }
+                else if (table->entries[middle].id_code > id_code)
+                {
+                        high = middle - 1;
+                }
+                else
+                {
+                        return (&table->entries[middle]);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (NULL);
+}
+
+
+/* EOF */
@@ -0,0 +1,136 @@
+/*!
+ * \file measure.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the area, perimeter and centroid of closed boundaries.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_MEASURE_H
+#define LIBDXF_SRC_MEASURE_H
+
+
+#include <math.h>
+#include <string.h>
+#include "global.h"
+#include "circle.h"
+#include "drawing.h"
+#include "ellipse.h"
+#include "entities.h"
+#include "entity.h"
+#include "hatch.h"
+#include "lwpolyline.h"
+#include "polyline.h"
+#include "util.h"
+#include "vertex.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_MEASURE_PARALLEL_TABLE 4096
+        /*!< \brief Number of entities from which a measure table is
+         * built in parallel. */
+
+
+/*!
+ * \brief Area, perimeter and centroid of a closed boundary.
+ */
+typedef struct
+dxf_measure_struct
+{
+        double area;
+                /*!< Signed area, positive when the boundary runs
+                 * counterclockwise seen from it's extrusion
+                 * direction. */
+        double perimeter;
+                /*!< Length of the boundary. */
+        double centroid_x;
+                /*!< X-value of the centroid (in WCS). */
+        double centroid_y;
+                /*!< Y-value of the centroid (in WCS). */
+        double centroid_z;
+                /*!< Z-value of the centroid (in WCS). */
+} DxfMeasure;
+
+
+/*!
+ * \brief Measure of one entity in a measure table.
+ */
+typedef struct
+dxf_measure_entry_struct
+{
+        int id_code;
+                /*!< Handle of the entity. */
+        DxfEntityType type;
+                /*!< Type of the entity. */
+        void *entity;
+                /*!< The entity. */
+        DxfMeasure measure;
+                /*!< Area, perimeter and centroid of the entity. */
+} DxfMeasureEntry;
+
+
+/*!
+ * \brief Measures of all closed entities of a drawing, sorted by handle.
+ */
+typedef struct
+dxf_measure_table_struct
+{
+        DxfMeasureEntry *entries;
+                /*!< Entries, in ascending order of handle. */
+        int number_of_entries;
+                /*!< Number of entries. */
+        double total_area;
+                /*!< Sum of the absolute areas of all entries. */
+} DxfMeasureTable;
+
+
+int dxf_measure_lwpolyline (DxfLWPolyline *lwpolyline, DxfMeasure *measure);
+int dxf_measure_polyline (DxfPolyline *polyline, DxfMeasure *measure);
+int dxf_measure_hatch_boundary_path_polyline (DxfHatchBoundaryPathPolyline *polyline, DxfMeasure *measure);
+int dxf_measure_circle (DxfCircle *circle, DxfMeasure *measure);
+int dxf_measure_ellipse (DxfEllipse *ellipse, DxfMeasure *measure);
+int dxf_measure_entity (DxfEntityType type, void *entity, DxfMeasure *measure);
+DxfMeasureTable *dxf_measure_table_new (DxfDrawing *drawing);
+int dxf_measure_table_free (DxfMeasureTable *table);
+DxfMeasureEntry *dxf_measure_table_find (DxfMeasureTable *table, int id_code);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_MEASURE_H */
+
+
+/* EOF */
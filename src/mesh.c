@@ -129,17 +129,8 @@ dxf_mesh_init
         mesh->color_value = 0;
         mesh->color_name = strdup ("");
         mesh->transparency = 0;
-        mesh->p0 = dxf_point_new ();
-        mesh->p0 = dxf_point_init (mesh->p0);
-        mesh->p0->x0 = 0.0;
-        mesh->p0->y0 = 0.0;
-        mesh->p0->z0 = 0.0;
-        mesh->version = 0;
+        mesh->version = 2;
         mesh->blend_crease_property = 0;
-        mesh->face_list_item = dxf_int32_new ();
-        mesh->face_list_item = dxf_int32_init (mesh->face_list_item);
-        mesh->edge_vertex_index = dxf_int32_new ();
-        mesh->edge_vertex_index = dxf_int32_init (mesh->edge_vertex_index);
         mesh->number_of_property_overridden_sub_entities = 0;
         mesh->property_type = 0;
         mesh->subdivision_level = 0;
@@ -149,10 +140,12 @@ dxf_mesh_init
         mesh->face_list_size_level_0 = 0;
         mesh->edge_count_level_0 = 0;
         mesh->edge_crease_count_level_0 = 0;
-        mesh->edge_create_value = dxf_double_new ();
-        mesh->edge_create_value = dxf_double_init (mesh->edge_create_value);
         /* Initialize new structs for the following members later,
          * when they are required and when we have content. */
+        mesh->vertices = NULL;
+        mesh->face_list_item = NULL;
+        mesh->edge_vertex_index = NULL;
+        mesh->edge_create_value = NULL;
         mesh->binary_graphics_data = NULL;
         mesh->next = NULL;
 #if DEBUG
@@ -171,6 +164,11 @@ dxf_mesh_init
  * section marker \c ENDSEC. \n
  * While parsing the DXF file store data in \c mesh. \n
  *
+ * The group codes 90, 91 and 92 are used for more than one member, the
+ * member is found from the counts read so far: the vertices, face list,
+ * edges and edge creases are stored in arrays allocated when their
+ * count (group codes 92, 93, 94 and 95) is read.
+ *
  * \return a pointer to \c mesh.
  */
 DxfMesh *
@@ -185,9 +183,19 @@ dxf_mesh_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
+        int subclass_found;
+        int vertex_count_found;
+        int face_list_size_found;
+        int edge_count_found;
+        int overridden_found;
+        int32_t i10;
+        int32_t i20;
+        int32_t i30;
+        int32_t i_face;
+        int32_t i_edge;
+        int32_t i_crease;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -195,213 +203,378 @@ dxf_mesh_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mesh == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mesh = dxf_mesh_init (mesh);
-        }
-        if (mesh->binary_graphics_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                mesh->binary_graphics_data = dxf_binary_data_init (mesh->binary_graphics_data);
-                if (mesh->binary_graphics_data == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
-                        return (NULL);
-                }
-        }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                mesh->p0 = dxf_point_init (mesh->p0);
-                if (mesh->p0 == NULL)
+                if (mesh == NULL)
                 {
                         fprintf (stderr,
                           (_("Error in %s () could not allocate memory.\n")),
                           __FUNCTION__);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
         }
-        iter310 = (DxfBinaryData *) mesh->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
+        subclass_found = FALSE;
+        vertex_count_found = FALSE;
+        face_list_size_found = FALSE;
+        edge_count_found = FALSE;
+        overridden_found = FALSE;
+        i10 = i20 = i30 = 0;
+        i_face = 0;
+        i_edge = 0;
+        i_crease = 0;
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
         while (strcmp (temp_string, "0") != 0)
         {
-                if (ferror (fp->fp))
+                if (ferror (fp->fp) || feof (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%x\n", (uint *) &mesh->id_code);
+                        dxf_read_line (temp_string, fp);
+                        mesh->id_code = (int) strtol (temp_string, NULL, 16);
                 }
                 else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->linetype);
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->linetype);
+                        mesh->linetype = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->layer);
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->layer);
+                        mesh->layer = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
                         /* Now follows a string containing the
-                         * X-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->x0);
+                         * X-coordinate of a vertex. */
+                        dxf_read_line (temp_string, fp);
+                        if (i10 < mesh->vertex_count_level_0)
+                        {
+                                mesh->vertices[3 * i10] = strtod (temp_string, NULL);
+                                i10++;
+                        }
                 }
                 else if (strcmp (temp_string, "20") == 0)
                 {
                         /* Now follows a string containing the
-                         * Y-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->y0);
+                         * Y-coordinate of a vertex. */
+                        dxf_read_line (temp_string, fp);
+                        if (i20 < mesh->vertex_count_level_0)
+                        {
+                                mesh->vertices[3 * i20 + 1] = strtod (temp_string, NULL);
+                                i20++;
+                        }
                 }
                 else if (strcmp (temp_string, "30") == 0)
                 {
                         /* Now follows a string containing the
-                         * Z-coordinate of the center point. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->p0->z0);
+                         * Z-coordinate of a vertex. */
+                        dxf_read_line (temp_string, fp);
+                        if (i30 < mesh->vertex_count_level_0)
+                        {
+                                mesh->vertices[3 * i30 + 2] = strtod (temp_string, NULL);
+                                i30++;
+                        }
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0))
                 {
                         /* Now follows a string containing the
                          * elevation. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->elevation);
+                        dxf_read_line (temp_string, fp);
+                        mesh->elevation = strtod (temp_string, NULL);
                 }
                 else if (strcmp (temp_string, "39") == 0)
                 {
                         /* Now follows a string containing the
                          * thickness. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->thickness);
+                        dxf_read_line (temp_string, fp);
+                        mesh->thickness = strtod (temp_string, NULL);
                 }
                 else if (strcmp (temp_string, "48") == 0)
                 {
                         /* Now follows a string containing the linetype
                          * scale. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%lf\n", &mesh->linetype_scale);
+                        dxf_read_line (temp_string, fp);
+                        mesh->linetype_scale = strtod (temp_string, NULL);
                 }
                 else if (strcmp (temp_string, "60") == 0)
                 {
                         /* Now follows a string containing the
                          * visibility value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->visibility);
+                        dxf_read_line (temp_string, fp);
+                        mesh->visibility = (int16_t) atoi (temp_string);
                 }
                 else if (strcmp (temp_string, "62") == 0)
                 {
                         /* Now follows a string containing the
                          * color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->color);
+                        dxf_read_line (temp_string, fp);
+                        mesh->color = atoi (temp_string);
                 }
                 else if (strcmp (temp_string, "67") == 0)
                 {
                         /* Now follows a string containing the
                          * paperspace value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->paperspace);
+                        dxf_read_line (temp_string, fp);
+                        mesh->paperspace = atoi (temp_string);
+                }
+                else if (strcmp (temp_string, "71") == 0)
+                {
+                        /* Now follows a string containing the version
+                         * number. */
+                        dxf_read_line (temp_string, fp);
+                        mesh->version = (int16_t) atoi (temp_string);
+                }
+                else if (strcmp (temp_string, "72") == 0)
+                {
+                        /* Now follows a string containing the "blend
+                         * crease" property. */
+                        dxf_read_line (temp_string, fp);
+                        mesh->blend_crease_property = (int16_t) atoi (temp_string);
+                }
+                else if (strcmp (temp_string, "90") == 0)
+                {
+                        /* Now follows a string containing a face list
+                         * item, an edge vertex index, the number of
+                         * property overridden sub-entities or a
+                         * property type. */
+                        dxf_read_line (temp_string, fp);
+                        if (face_list_size_found
+                          && (i_face < mesh->face_list_size_level_0))
+                        {
+                                mesh->face_list_item[i_face] = (int32_t) atol (temp_string);
+                                i_face++;
+                        }
+                        else if (edge_count_found
+                          && (i_edge < 2 * mesh->edge_count_level_0))
+                        {
+                                mesh->edge_vertex_index[i_edge] = (int32_t) atol (temp_string);
+                                i_edge++;
+                        }
+                        else if (!overridden_found)
+                        {
+                                mesh->number_of_property_overridden_sub_entities = (int32_t) atol (temp_string);
+                                overridden_found = TRUE;
+                        }
+                        else
+                        {
+                                mesh->property_type = (int32_t) atol (temp_string);
+                        }
+                }
+                else if (strcmp (temp_string, "91") == 0)
+                {
+                        /* Now follows a string containing the number of
+                         * subdivision levels or a sub-entity marker. */
+                        dxf_read_line (temp_string, fp);
+                        if (!vertex_count_found)
+                        {
+                                mesh->subdivision_level = (int32_t) atol (temp_string);
+                        }
+                        else
+                        {
+                                mesh->sub_entity_marker = (int32_t) atol (temp_string);
+                        }
                 }
-                /*! \todo Implement Group codes 90 - 95 in a proper way. */
                 else if (strcmp (temp_string, "92") == 0)
                 {
-                        /* Now follows a string containing the
-                         * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->graphics_data_size);
+                        /* Now follows a string containing the graphics
+                         * data size, the vertex count of level 0 or the
+                         * count of overridden properties. */
+                        dxf_read_line (temp_string, fp);
+                        if (!subclass_found)
+                        {
+                                mesh->graphics_data_size = atoi (temp_string);
+                        }
+                        else if (!vertex_count_found)
+                        {
+                                free (mesh->vertices);
+                                mesh->vertex_count_level_0 = (int32_t) atol (temp_string);
+                                if (mesh->vertex_count_level_0 < 0)
+                                {
+                                        mesh->vertex_count_level_0 = 0;
+                                }
+                                mesh->vertices = calloc (3 * (size_t) mesh->vertex_count_level_0 + 1, sizeof (double));
+                                if (mesh->vertices == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                vertex_count_found = TRUE;
+                        }
+                        else
+                        {
+                                mesh->count_of_property_overridden = (int32_t) atol (temp_string);
+                        }
+                }
+                else if (strcmp (temp_string, "93") == 0)
+                {
+                        /* Now follows a string containing the size of
+                         * the face list of level 0. */
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->face_list_item);
+                        mesh->face_list_size_level_0 = (int32_t) atol (temp_string);
+                        if (mesh->face_list_size_level_0 < 0)
+                        {
+                                mesh->face_list_size_level_0 = 0;
+                        }
+                        mesh->face_list_item = calloc ((size_t) mesh->face_list_size_level_0 + 1, sizeof (int32_t));
+                        if (mesh->face_list_item == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        face_list_size_found = TRUE;
+                        i_face = 0;
                 }
-                else if ((fp->acad_version_number >= AutoCAD_13)
-                        && (strcmp (temp_string, "100") == 0))
+                else if (strcmp (temp_string, "94") == 0)
+                {
+                        /* Now follows a string containing the edge
+                         * count of level 0. */
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->edge_vertex_index);
+                        mesh->edge_count_level_0 = (int32_t) atol (temp_string);
+                        if (mesh->edge_count_level_0 < 0)
+                        {
+                                mesh->edge_count_level_0 = 0;
+                        }
+                        mesh->edge_vertex_index = calloc (2 * (size_t) mesh->edge_count_level_0 + 1, sizeof (int32_t));
+                        if (mesh->edge_vertex_index == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        /* The face list is complete when the edges
+                         * follow. */
+                        face_list_size_found = FALSE;
+                        edge_count_found = TRUE;
+                        i_edge = 0;
+                }
+                else if (strcmp (temp_string, "95") == 0)
+                {
+                        /* Now follows a string containing the edge
+                         * crease count of level 0. */
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->edge_create_value);
+                        mesh->edge_crease_count_level_0 = (int32_t) atol (temp_string);
+                        if (mesh->edge_crease_count_level_0 < 0)
+                        {
+                                mesh->edge_crease_count_level_0 = 0;
+                        }
+                        mesh->edge_create_value = calloc ((size_t) mesh->edge_crease_count_level_0 + 1, sizeof (double));
+                        if (mesh->edge_create_value == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        face_list_size_found = FALSE;
+                        edge_count_found = FALSE;
+                        i_crease = 0;
+                }
+                else if (strcmp (temp_string, "100") == 0)
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbSubMesh") != 0)
+                        dxf_read_line (temp_string, fp);
+                        if (strcmp (temp_string, "AcDbSubDMesh") == 0)
                         {
-                                fprintf (stderr,
+                                subclass_found = TRUE;
+                        }
+                        else if (strcmp (temp_string, "AcDbEntity") != 0)
+                        {
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
+                else if (strcmp (temp_string, "140") == 0)
+                {
+                        /* Now follows a string containing an edge
+                         * crease value. */
+                        dxf_read_line (temp_string, fp);
+                        if (i_crease < mesh->edge_crease_count_level_0)
+                        {
+                                mesh->edge_create_value[i_crease] = strtod (temp_string, NULL);
+                                i_crease++;
+                        }
+                }
                 else if (strcmp (temp_string, "160") == 0)
                 {
                         /* Now follows a string containing the
                          * graphics data size value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%d\n", &mesh->graphics_data_size);
+                        dxf_read_line (temp_string, fp);
+                        mesh->graphics_data_size = atoi (temp_string);
                 }
                 else if (strcmp (temp_string, "284") == 0)
                 {
                         /* Now follows a string containing the shadow
                          * mode value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->shadow_mode);
+                        dxf_read_line (temp_string, fp);
+                        mesh->shadow_mode = (int16_t) atoi (temp_string);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        if (mesh->binary_graphics_data == NULL)
+                        {
+                                mesh->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                                if (mesh->binary_graphics_data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                        }
+                        dxf_binary_data_append_hex (fp, mesh->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
+                        dxf_read_line (temp_string, fp);
                         if (iter330 == 0)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->dictionary_owner_soft);
+                                free (mesh->dictionary_owner_soft);
+                                mesh->dictionary_owner_soft = strdup (temp_string);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->object_owner_soft);
+                                free (mesh->object_owner_soft);
+                                mesh->object_owner_soft = strdup (temp_string);
                         }
                         iter330++;
                 }
@@ -409,75 +582,92 @@ dxf_mesh_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->material);
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->material);
+                        mesh->material = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->dictionary_owner_hard);
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->dictionary_owner_hard);
+                        mesh->dictionary_owner_hard = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
                         /* Now follows a string containing the lineweight
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%hd\n", &mesh->lineweight);
+                        dxf_read_line (temp_string, fp);
+                        mesh->lineweight = (int16_t) atoi (temp_string);
                 }
                 else if (strcmp (temp_string, "390") == 0)
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->plot_style_name);
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->plot_style_name);
+                        mesh->plot_style_name = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
                         /* Now follows a string containing a color value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mesh->color_value);
+                        dxf_read_line (temp_string, fp);
+                        mesh->color_value = atol (temp_string);
                 }
                 else if (strcmp (temp_string, "430") == 0)
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mesh->color_name);
+                        dxf_read_line (temp_string, fp);
+                        free (mesh->color_name);
+                        mesh->color_name = strdup (temp_string);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
                         /* Now follows a string containing a transparency
                          * value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%ld\n", &mesh->transparency);
+                        dxf_read_line (temp_string, fp);
+                        mesh->transparency = atol (temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        dxf_read_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
+        if ((i10 < mesh->vertex_count_level_0)
+          || (i_face < mesh->face_list_size_level_0)
+          || (i_edge < 2 * mesh->edge_count_level_0)
+          || (i_crease < mesh->edge_crease_count_level_0))
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () less items than counted found in: %s in line: %d.\n")),
+                  __FUNCTION__, fp->filename, fp->line_number);
+        }
         if (strcmp (mesh->linetype, "") == 0)
         {
+                free (mesh->linetype);
                 mesh->linetype = strdup (DXF_DEFAULT_LINETYPE);
         }
         if (strcmp (mesh->layer, "") == 0)
         {
+                free (mesh->layer);
                 mesh->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -504,6 +694,7 @@ dxf_mesh_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("MESH");
+        int32_t i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -524,7 +715,10 @@ dxf_mesh_write
                 free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (mesh->p0 == NULL)
+        if (((mesh->vertex_count_level_0 > 0) && (mesh->vertices == NULL))
+          || ((mesh->face_list_size_level_0 > 0) && (mesh->face_list_item == NULL))
+          || ((mesh->edge_count_level_0 > 0) && (mesh->edge_vertex_index == NULL))
+          || ((mesh->edge_crease_count_level_0 > 0) && (mesh->edge_create_value == NULL)))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was found.\n")),
@@ -637,13 +831,7 @@ dxf_mesh_write
 #endif
                 if (mesh->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = (DxfBinaryData *) mesh->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, mesh->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -663,56 +851,32 @@ dxf_mesh_write
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
-                fprintf (fp->fp, "100\nAcDbSubMesh\n");
+                fprintf (fp->fp, "100\nAcDbSubDMesh\n");
         }
         fprintf (fp->fp, " 71\n%d\n", mesh->version);
         fprintf (fp->fp, " 72\n%d\n", mesh->blend_crease_property);
         fprintf (fp->fp, " 91\n%d\n", mesh->subdivision_level);
         fprintf (fp->fp, " 92\n%d\n", mesh->vertex_count_level_0);
-        if (mesh->p0 != NULL)
+        for (i = 0; i < mesh->vertex_count_level_0; i++)
         {
-                DxfPoint *p0_iter;
-                p0_iter = (DxfPoint *) mesh->p0;
-                while (p0_iter != NULL)
-                {
-                        fprintf (fp->fp, " 10\n%f\n", mesh->p0->x0);
-                        fprintf (fp->fp, " 20\n%f\n", mesh->p0->y0);
-                        fprintf (fp->fp, " 30\n%f\n", mesh->p0->z0);
-                        p0_iter = (DxfPoint *) p0_iter->next;
-                }
+                fprintf (fp->fp, " 10\n%f\n", mesh->vertices[3 * i]);
+                fprintf (fp->fp, " 20\n%f\n", mesh->vertices[3 * i + 1]);
+                fprintf (fp->fp, " 30\n%f\n", mesh->vertices[3 * i + 2]);
         }
         fprintf (fp->fp, " 93\n%d\n", mesh->face_list_size_level_0);
-        if (mesh->face_list_item != NULL)
+        for (i = 0; i < mesh->face_list_size_level_0; i++)
         {
-                DxfInt32 *face_list_item_iter;
-                face_list_item_iter = (DxfInt32 *) mesh->face_list_item;
-                while (face_list_item_iter != NULL)
-                {
-                        fprintf (fp->fp, " 90\n%d\n", face_list_item_iter->value);
-                        face_list_item_iter = (DxfInt32 *) face_list_item_iter->next;
-                }
+                fprintf (fp->fp, " 90\n%d\n", mesh->face_list_item[i]);
         }
         fprintf (fp->fp, " 94\n%d\n", mesh->edge_count_level_0);
-        if (mesh->edge_vertex_index != NULL)
+        for (i = 0; i < 2 * mesh->edge_count_level_0; i++)
         {
-                DxfInt32 *edge_vertex_index_iter;
-                edge_vertex_index_iter = (DxfInt32 *) mesh->edge_vertex_index;
-                while (edge_vertex_index_iter != NULL)
-                {
-                        fprintf (fp->fp, " 90\n%d\n", edge_vertex_index_iter->value);
-                        edge_vertex_index_iter = (DxfInt32 *) edge_vertex_index_iter->next;
-                }
+                fprintf (fp->fp, " 90\n%d\n", mesh->edge_vertex_index[i]);
         }
         fprintf (fp->fp, " 95\n%d\n", mesh->edge_crease_count_level_0);
-        if (mesh->edge_create_value != NULL)
+        for (i = 0; i < mesh->edge_crease_count_level_0; i++)
         {
-                DxfDouble *edge_create_value_iter;
-                edge_create_value_iter = (DxfDouble *) mesh->edge_create_value;
-                while (edge_create_value_iter != NULL)
-                {
-                        fprintf (fp->fp, "140\n%f\n", mesh->edge_create_value->value);
-                        edge_create_value_iter = (DxfDouble *) edge_create_value_iter->next;
-                }
+                fprintf (fp->fp, "140\n%f\n", mesh->edge_create_value[i]);
         }
         fprintf (fp->fp, " 90\n%d\n", mesh->number_of_property_overridden_sub_entities);
         fprintf (fp->fp, " 91\n%d\n", mesh->sub_entity_marker);
@@ -762,17 +926,20 @@ dxf_mesh_free
         }
         free (mesh->linetype);
         free (mesh->layer);
-        dxf_binary_data_free_list (mesh->binary_graphics_data);
+        if (mesh->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (mesh->binary_graphics_data);
+        }
         free (mesh->dictionary_owner_soft);
         free (mesh->object_owner_soft);
         free (mesh->material);
         free (mesh->dictionary_owner_hard);
         free (mesh->plot_style_name);
         free (mesh->color_name);
-        dxf_point_free_list (mesh->p0);
-        dxf_int32_free_list (mesh->face_list_item);
-        dxf_int32_free_list (mesh->edge_vertex_index);
-        dxf_double_free_list (mesh->edge_create_value);
+        free (mesh->vertices);
+        free (mesh->face_list_item);
+        free (mesh->edge_vertex_index);
+        free (mesh->edge_create_value);
         free (mesh);
         mesh = NULL;
 #if DEBUG
@@ -806,6 +973,7 @@ dxf_mesh_free_list
         while (meshes != NULL)
         {
                 DxfMesh *iter = (DxfMesh *) meshes->next;
+                meshes->next = NULL;
                 dxf_mesh_free (meshes);
                 meshes = (DxfMesh *) iter;
         }
@@ -2470,140 +2638,19 @@ dxf_mesh_set_transparency
 
 
 /*!
- * \brief Get the vertex position \c p0 of a DXF \c MESH entity.
+ * \brief Get the vertices of level 0 from a DXF \c MESH entity.
  *
- * \return the vertex position \c p0.
+ * \return a pointer to the X-, Y- and Z-values of the
+ * \c vertex_count_level_0 vertices, 3 values per vertex.
  */
-DxfPoint *
-dxf_mesh_get_p0
+double *
+dxf_mesh_get_vertices
 (
         DxfMesh *mesh
                 /*!< a pointer to a DXF \c MESH entity. */
 )
 {
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (mesh == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (mesh->p0);
-}
-
-
-/*!
- * \brief Set the vertex position \c p0 of a DXF \c MESH entity.
- *
- * \return a pointer to \c mesh when successful, or \c NULL when an error
- * occurred.
- */
-DxfMesh *
-dxf_mesh_set_p0
-(
-        DxfMesh *mesh,
-                /*!< a pointer to a DXF \c MESH entity. */
-        DxfPoint *p0
-                /*!< a pointer to a DXF \c POINT entity. */
-)
-{
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (mesh == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        mesh->p0 = p0;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (mesh);
-}
-
-
-/*!
- * \brief Get the X-value of the vertex position \c x0 of a DXF \c MESH
- * entity.
- *
- * \return the X-value of the vertex position \c x0.
- */
-double
-dxf_mesh_get_x0
-(
-        DxfMesh *mesh
-                /*!< a pointer to a DXF \c MESH entity. */
-)
-{
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-
-        /* Do some basic checks. */
-        if (mesh == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
 #if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (mesh->p0->x0);
-}
-
-
-/*!
- * \brief Set the X-value of the vertex position \c x0 of a DXF \c MESH
- * entity.
- *
- * \return a pointer to \c mesh when successful, or \c NULL when an error
- * occurred.
- */
-DxfMesh *
-dxf_mesh_set_x0
-(
-        DxfMesh *mesh,
-                /*!< a pointer to a DXF \c MESH entity. */
-        double x0
-                /*!< the X-value of the vertex position \c x0 of a DXF
-                 * \c MESH entity. */
-)
-{
-#ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2614,178 +2661,32 @@ dxf_mesh_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                mesh->p0 = dxf_point_init (mesh->p0);
-                if (mesh->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        mesh->p0->x0 = x0;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (mesh);
+        return (mesh->vertices);
 }
 
 
 /*!
- * \brief Get the Y-value of the vertex position \c y0 of a DXF \c MESH
- * entity.
+ * \brief Set the vertices of level 0 for a DXF \c MESH entity.
  *
- * \return the Y-value of the vertex position \c y0.
- */
-double
-dxf_mesh_get_y0
-(
-        DxfMesh *mesh
-                /*!< a pointer to a DXF \c MESH entity. */
-)
-{
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-
-        /* Do some basic checks. */
-        if (mesh == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (mesh->p0->y0);
-}
-
-
-/*!
- * \brief Set the Y-value of the vertex position \c y0 of a DXF \c MESH
- * entity.
+ * The array holds the X-, Y- and Z-values of \c vertex_count_level_0
+ * vertices and is freed together with the entity.
  *
  * \return a pointer to \c mesh when successful, or \c NULL when an error
  * occurred.
  */
 DxfMesh *
-dxf_mesh_set_y0
+dxf_mesh_set_vertices
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        double y0
-                /*!< the Y-value of the vertex position \c y0 of a DXF
-                 * \c MESH entity. */
+        double *vertices
+                /*!< a pointer to an array of 3 values per vertex. */
 )
 {
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (mesh == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                mesh->p0 = dxf_point_init (mesh->p0);
-                if (mesh->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        mesh->p0->y0 = y0;
 #if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (mesh);
-}
-
-
-/*!
- * \brief Get the Z-value of the vertex position \c z0 of a DXF \c MESH
- * entity.
- *
- * \return the Z-value of the vertex position \c z0.
- */
-double
-dxf_mesh_get_z0
-(
-        DxfMesh *mesh
-                /*!< a pointer to a DXF \c MESH entity. */
-)
-{
-#ifdef DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-
-        /* Do some basic checks. */
-        if (mesh == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (mesh->p0->z0);
-}
-
-
-/*!
- * \brief Set the Z-value of the vertex position \c z0 of a DXF \c MESH
- * entity.
- *
- * \return a pointer to \c mesh when successful, or \c NULL when an error
- * occurred.
- */
-DxfMesh *
-dxf_mesh_set_z0
-(
-        DxfMesh *mesh,
-                /*!< a pointer to a DXF \c MESH entity. */
-        double z0
-                /*!< the Z-value of the vertex position \c z0 of a DXF
-                 * \c MESH entity. */
-)
-{
-#ifdef DEBUG
         DXF_DEBUG_BEGIN
 #endif
         /* Do some basic checks. */
@@ -2796,23 +2697,7 @@ dxf_mesh_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
-        if (mesh->p0 == NULL)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                mesh->p0 = dxf_point_init (mesh->p0);
-                if (mesh->p0 == NULL)
-                {
-                        fprintf (stderr,
-                          (_("Error in %s () could not allocate memory.\n")),
-                          __FUNCTION__);
-                        return (NULL);
-                }
-        }
-        mesh->p0->z0 = z0;
+        mesh->vertices = vertices;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2986,12 +2871,12 @@ dxf_mesh_set_blend_crease_property
 
 
 /*!
- * \brief Get the pointer to a linked list of \c face_list_item from a
- * DXF \c MESH entity.
+ * \brief Get the face list of level 0 from a DXF \c MESH entity.
  *
- * \return \c face_list_item.
+ * \return a pointer to the \c face_list_size_level_0 face list items,
+ * the number of vertices of a face followed by their indices.
  */
-DxfInt32 *
+int32_t *
 dxf_mesh_get_face_list_item
 (
         DxfMesh *mesh
@@ -3012,13 +2897,15 @@ dxf_mesh_get_face_list_item
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfInt32 *) mesh->face_list_item);
+        return (mesh->face_list_item);
 }
 
 
 /*!
- * \brief Set the pointer to a linked list of \c face_list_item for a
- * DXF \c MESH entity.
+ * \brief Set the face list of level 0 for a DXF \c MESH entity.
+ *
+ * The array holds \c face_list_size_level_0 items and is freed together
+ * with the entity.
  *
  * \return a pointer to \c mesh when successful, or \c NULL when an
  * error occurred.
@@ -3028,7 +2915,7 @@ dxf_mesh_set_face_list_item
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        DxfInt32 *face_list_item
+        int32_t *face_list_item
                 /*!< the \c face_list_item to be set for the
                  * entity. */
 )
@@ -3055,9 +2942,10 @@ dxf_mesh_set_face_list_item
 /*!
  * \brief Get the \c edge_vertex_index from a DXF \c MESH entity.
  *
- * \return \c edge_vertex_index.
+ * \return a pointer to the vertex indices of the
+ * \c edge_count_level_0 edges, 2 indices per edge.
  */
-DxfInt32 *
+int32_t *
 dxf_mesh_get_edge_vertex_index
 (
         DxfMesh *mesh
@@ -3085,6 +2973,9 @@ dxf_mesh_get_edge_vertex_index
 /*!
  * \brief Set the \c edge_vertex_index for a DXF \c MESH entity.
  *
+ * The array holds 2 indices for each of the \c edge_count_level_0
+ * edges and is freed together with the entity.
+ *
  * \return a pointer to \c mesh when successful, or \c NULL when an
  * error occurred.
  */
@@ -3093,7 +2984,7 @@ dxf_mesh_set_edge_vertex_index
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        DxfInt32 *edge_vertex_index
+        int32_t *edge_vertex_index
                 /*!< the \c edge_vertex_index to be set for the
                  * entity. */
 )
@@ -3109,7 +3000,7 @@ dxf_mesh_set_edge_vertex_index
                   __FUNCTION__);
                 return (NULL);
         }
-        mesh->edge_vertex_index = (DxfInt32 *) edge_vertex_index;
+        mesh->edge_vertex_index = edge_vertex_index;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3730,9 +3621,10 @@ dxf_mesh_set_edge_crease_count_level_0
 /*!
  * \brief Get the \c edge_create_value of a DXF \c MESH entity.
  *
- * \return \c edge_create_value.
+ * \return a pointer to the \c edge_crease_count_level_0 edge crease
+ * values.
  */
-DxfDouble *
+double *
 dxf_mesh_get_edge_create_value
 (
         DxfMesh *mesh
@@ -3754,13 +3646,16 @@ dxf_mesh_get_edge_create_value
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfDouble *) mesh->edge_create_value);
+        return (mesh->edge_create_value);
 }
 
 
 /*!
  * \brief Set the \c edge_create_value of a DXF \c MESH entity.
  *
+ * The array holds \c edge_crease_count_level_0 values and is freed
+ * together with the entity.
+ *
  * \return a pointer to \c mesh when successful, or \c NULL when an error
  * occurred.
  */
@@ -3769,7 +3664,7 @@ dxf_mesh_set_edge_create_value
 (
         DxfMesh *mesh,
                 /*!< a pointer to a DXF \c MESH entity. */
-        DxfDouble *edge_create_value
+        double *edge_create_value
                 /*!< the \c edge_create_value of a DXF \c MESH entity. */
 )
 {
@@ -3902,9 +3797,6 @@ dxf_mesh_get_last
         }
         if (mesh->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMesh *) mesh);
         }
         DxfMesh *iter = (DxfMesh *) mesh->next;
@@ -185,8 +185,10 @@ dxf_mesh_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF mesh. */
-        DxfPoint *p0;
-                /*!< Vertex position.\n
+        double *vertices;
+                /*!< X-, Y- and Z-values of the vertices of level 0,
+                 * 3 values per vertex, \c vertex_count_level_0
+                 * vertices.\n
                  * Group codes = 10, 20 and 30.*/
         int16_t version;
                 /*!< Version number.\n
@@ -198,18 +200,20 @@ dxf_mesh_struct
                  *   <li value=1>Turn on.</li>
                  * </ol>
                  * Group code = 72. */
-        DxfInt32 *face_list_item;
-                /*!< Face list item.\n
+        int32_t *face_list_item;
+                /*!< Face list of level 0, \c face_list_size_level_0
+                 * items.\n
+                 * Every face is stored as the number of it's vertices
+                 * followed by the vertex indices.\n
+                 * Group code = 90. */
+        int32_t *edge_vertex_index;
+                /*!< Vertex indices of the edges of level 0, 2 indices
+                 * for each of the \c edge_count_level_0 edges.\n
                  * Group code = 90. */
-        DxfInt32 *edge_vertex_index;
-                /*!< Vertex index of each edge (multiple entries ?).\n
-                 * Group code = 90.
-                 * \todo Solve multiple group code issue. */
         int32_t number_of_property_overridden_sub_entities;
                 /*!< Count of sub-entity which property has been
                  * overridden.\n
-                 * Group code = 90.
-                 * \todo Solve multiple group code issue. */
+                 * Group code = 90. */
         int32_t property_type;
                 /*!< Property type:
                  * <ol>
@@ -218,22 +222,19 @@ dxf_mesh_struct
                  *   <li value=2>Transparency.</li>
                  *   <li value=3>Material mapper.</li>
                  * </ol>
-                 * Group code = 90.
-                 * \todo Solve multiple group code issue. */
+                 * Group code = 90. */
         int32_t subdivision_level;
                 /*!< Number of subdivision level.\n
                  * Group code = 91. */
         int32_t sub_entity_marker;
                 /*!< Sub-entity marker.\n
-                 * Group code = 91.
-                 * \todo Solve multiple group code issue. */
+                 * Group code = 91. */
         int32_t vertex_count_level_0;
                 /*!< Vertex count of level 0.\n
                  * Group code = 92. */
         int32_t count_of_property_overridden;
                 /*!< Count of property was overridden.\n
-                 * Group code = 92.
-                 * \todo Solve multiple group code issue. */
+                 * Group code = 92. */
         int32_t face_list_size_level_0;
                 /*!< Size of face list of level 0.\n
                  * Group code = 93. */
@@ -243,8 +244,10 @@ dxf_mesh_struct
         int32_t edge_crease_count_level_0;
                 /*!< Edge crease count of level 0.\n
                  * Group code = 95. */
-        DxfDouble *edge_create_value;
-                /*!< Edge create value.\n
+        double *edge_create_value;
+                /*!< Edge crease values, one for each of the
+                 * \c edge_crease_count_level_0 first edges, \c -1 for an
+                 * always sharp edge.\n
                  * Group code = 140. */
         struct DxfMesh *next;
                 /*!< Pointer to the next DxfMesh.\n
@@ -300,22 +303,16 @@ char *dxf_mesh_get_color_name (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_color_name (DxfMesh *mesh, char *color_name);
 long dxf_mesh_get_transparency (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_transparency (DxfMesh *mesh, long transparency);
-DxfPoint *dxf_mesh_get_p0 (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_p0 (DxfMesh *mesh, DxfPoint *p0);
-double dxf_mesh_get_x0 (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_x0 (DxfMesh *mesh, double x0);
-double dxf_mesh_get_y0 (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_y0 (DxfMesh *mesh, double y0);
-double dxf_mesh_get_z0 (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_z0 (DxfMesh *mesh, double z0);
+double *dxf_mesh_get_vertices (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_vertices (DxfMesh *mesh, double *vertices);
 int16_t dxf_mesh_get_version (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_version (DxfMesh *mesh, int16_t version);
 int16_t dxf_mesh_get_blend_crease_property (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_blend_crease_property (DxfMesh *mesh, int16_t blend_crease_property);
-DxfInt32 *dxf_mesh_get_face_list_item (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_face_list_item (DxfMesh *mesh, DxfInt32 *face_list_item);
-DxfInt32 *dxf_mesh_get_edge_vertex_index (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_edge_vertex_index (DxfMesh *mesh, DxfInt32 *edge_vertex_index);
+int32_t *dxf_mesh_get_face_list_item (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_face_list_item (DxfMesh *mesh, int32_t *face_list_item);
+int32_t *dxf_mesh_get_edge_vertex_index (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_edge_vertex_index (DxfMesh *mesh, int32_t *edge_vertex_index);
 int32_t dxf_mesh_get_number_of_property_overridden_sub_entities (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_number_of_property_overridden_sub_entities (DxfMesh *mesh, int32_t number_of_property_overridden_sub_entities);
 int32_t dxf_mesh_get_property_type (DxfMesh *mesh);
@@ -334,8 +331,8 @@ int32_t dxf_mesh_get_edge_count_level_0 (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_edge_count_level_0 (DxfMesh *mesh, int32_t edge_count_level_0);
 int32_t dxf_mesh_get_edge_crease_count_level_0 (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_edge_crease_count_level_0 (DxfMesh *mesh, int32_t edge_crease_count_level_0);
-DxfDouble *dxf_mesh_get_edge_create_value (DxfMesh *mesh);
-DxfMesh *dxf_mesh_set_edge_create_value (DxfMesh *mesh, DxfDouble *edge_create_value);
+double *dxf_mesh_get_edge_create_value (DxfMesh *mesh);
+DxfMesh *dxf_mesh_set_edge_create_value (DxfMesh *mesh, double *edge_create_value);
 DxfMesh *dxf_mesh_get_next (DxfMesh *mesh);
 DxfMesh *dxf_mesh_set_next (DxfMesh *mesh, DxfMesh *next);
 DxfMesh *dxf_mesh_get_last (DxfMesh *mesh);
@@ -0,0 +1,1272 @@
+/*!
+ * \file mesh_triangulate.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for converting DXF \c MESH entities into indexed triangles.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "mesh_triangulate.h"
+
+
+/*!
+ * \brief Allocate memory for a buffer of mesh triangles.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfMeshTriangles *
+dxf_mesh_triangles_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMeshTriangles *triangles = NULL;
+
+        triangles = calloc (1, sizeof (DxfMeshTriangles));
+        if (triangles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (triangles);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a buffer of mesh triangles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_mesh_triangles_free
+(
+        DxfMeshTriangles *triangles
+                /*!< Buffer of mesh triangles. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (triangles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (triangles->vertices);
+        free (triangles->indices);
+        free (triangles);
+        triangles = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all vertices and triangles from a buffer of mesh
+ * triangles, keeping the allocated memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_mesh_triangles_clear
+(
+        DxfMeshTriangles *triangles
+                /*!< Buffer of mesh triangles. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (triangles == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        triangles->number_of_vertices = 0;
+        triangles->number_of_triangles = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a triangle to a buffer of mesh triangles.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_mesh_triangles_add_triangle
+(
+        DxfMeshTriangles *triangles,
+        int a,
+        int b,
+        int c
+)
+{
+        int *indices;
+        int size;
+
+        if (triangles->number_of_triangles == triangles->indices_size)
+        {
+                size = (triangles->indices_size > 0) ? 2 * triangles->indices_size : 256;
+                indices = realloc (triangles->indices, 3 * (size_t) size * sizeof (int));
+                if (indices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                triangles->indices = indices;
+                triangles->indices_size = size;
+        }
+        triangles->indices[3 * triangles->number_of_triangles] = a;
+        triangles->indices[3 * triangles->number_of_triangles + 1] = b;
+        triangles->indices[3 * triangles->number_of_triangles + 2] = c;
+        triangles->number_of_triangles++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the start of every face in the face list of a mesh.
+ *
+ * \c face_start receives the position of the vertex count of every face
+ * in \c face_list_item, it is to be freed by the caller.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the face
+ * list is invalid or no memory could be allocated.
+ */
+static int
+dxf_mesh_index_faces
+(
+        DxfMesh *mesh,
+        int32_t **face_start,
+        int32_t *number_of_faces,
+        int32_t *number_of_corners
+)
+{
+        int32_t *start;
+        int32_t position;
+        int32_t n;
+        int32_t i;
+
+        *face_start = NULL;
+        *number_of_faces = 0;
+        *number_of_corners = 0;
+        if ((mesh->vertex_count_level_0 > 0) && (mesh->vertices == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mesh->face_list_size_level_0 <= 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (mesh->face_list_item == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* A face takes at least 4 items. */
+        start = malloc (((size_t) mesh->face_list_size_level_0 / 4 + 1) * sizeof (int32_t));
+        if (start == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        position = 0;
+        while (position < mesh->face_list_size_level_0)
+        {
+                n = mesh->face_list_item[position];
+                if ((n < 3) || (n >= mesh->face_list_size_level_0 - position))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () invalid face found at face list item %d.\n")),
+                          __FUNCTION__, position);
+                        free (start);
+                        return (EXIT_FAILURE);
+                }
+                for (i = 1; i <= n; i++)
+                {
+                        if ((mesh->face_list_item[position + i] < 0)
+                          || (mesh->face_list_item[position + i] >= mesh->vertex_count_level_0))
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () invalid vertex index found at face list item %d.\n")),
+                                  __FUNCTION__, position + i);
+                                free (start);
+                                return (EXIT_FAILURE);
+                        }
+                }
+                start[*number_of_faces] = position;
+                (*number_of_faces)++;
+                *number_of_corners += n;
+                position += n + 1;
+        }
+        *face_start = start;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Order half edges by their vertices, and by their position in
+ * the face list for equal vertices.
+ */
+static int
+dxf_mesh_compare_half_edges
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfMeshHalfEdge *p = (const DxfMeshHalfEdge *) a;
+        const DxfMeshHalfEdge *q = (const DxfMeshHalfEdge *) b;
+
+        if (p->v0 != q->v0)
+        {
+                return ((p->v0 < q->v0) ? -1 : 1);
+        }
+        if (p->v1 != q->v1)
+        {
+                return ((p->v1 < q->v1) ? -1 : 1);
+        }
+        return ((p->corner < q->corner) ? -1 : (p->corner > q->corner));
+}
+
+
+/*!
+ * \brief Order edges by their vertices.
+ */
+static int
+dxf_mesh_compare_edges
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfMeshEdge *p = (const DxfMeshEdge *) a;
+        const DxfMeshEdge *q = (const DxfMeshEdge *) b;
+
+        if (p->v0 != q->v0)
+        {
+                return ((p->v0 < q->v0) ? -1 : 1);
+        }
+        return ((p->v1 < q->v1) ? -1 : (p->v1 > q->v1));
+}
+
+
+/*!
+ * \brief Find the unique edges of the faces of a mesh.
+ *
+ * The edges are sorted by their vertices, \c corner_edge receives the
+ * edge from every face vertex to the next vertex of the face.\n
+ * The crease values of the edges listed in the mesh are copied to the
+ * matching face edges.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_mesh_index_edges
+(
+        DxfMesh *mesh,
+        int32_t *face_start,
+        int32_t number_of_faces,
+        int32_t number_of_corners,
+        DxfMeshEdge **edges,
+        int32_t *number_of_edges,
+        int32_t **corner_edge
+)
+{
+        DxfMeshHalfEdge *half_edges;
+        DxfMeshEdge *edge;
+        DxfMeshEdge key;
+        const int32_t *face;
+        int32_t number_of_creases;
+        int32_t corner;
+        int32_t f;
+        int32_t i;
+        int32_t n;
+
+        *edges = malloc (((size_t) number_of_corners + 1) * sizeof (DxfMeshEdge));
+        *corner_edge = malloc (((size_t) number_of_corners + 1) * sizeof (int32_t));
+        half_edges = malloc (((size_t) number_of_corners + 1) * sizeof (DxfMeshHalfEdge));
+        if ((*edges == NULL) || (*corner_edge == NULL) || (half_edges == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (*edges);
+                free (*corner_edge);
+                free (half_edges);
+                *edges = NULL;
+                *corner_edge = NULL;
+                return (EXIT_FAILURE);
+        }
+        corner = 0;
+        for (f = 0; f < number_of_faces; f++)
+        {
+                face = mesh->face_list_item + face_start[f];
+                n = face[0];
+                for (i = 1; i <= n; i++)
+                {
+                        half_edges[corner].v0 = face[i];
+                        half_edges[corner].v1 = face[(i < n) ? i + 1 : 1];
+                        if (half_edges[corner].v0 > half_edges[corner].v1)
+                        {
+                                half_edges[corner].v0 = half_edges[corner].v1;
+                                half_edges[corner].v1 = face[i];
+                        }
+                        half_edges[corner].face = f;
+                        half_edges[corner].corner = corner;
+                        corner++;
+                }
+        }
+        qsort (half_edges, (size_t) number_of_corners, sizeof (DxfMeshHalfEdge),
+          dxf_mesh_compare_half_edges);
+        *number_of_edges = 0;
+        for (i = 0; i < number_of_corners; i++)
+        {
+                if ((i > 0)
+                  && (half_edges[i].v0 == half_edges[i - 1].v0)
+                  && (half_edges[i].v1 == half_edges[i - 1].v1))
+                {
+                        edge = *edges + *number_of_edges - 1;
+                        if (edge->number_of_faces == 1)
+                        {
+                                edge->face1 = half_edges[i].face;
+                        }
+                        edge->number_of_faces++;
+                }
+                else
+                {
+                        edge = *edges + *number_of_edges;
+                        edge->v0 = half_edges[i].v0;
+                        edge->v1 = half_edges[i].v1;
+                        edge->face0 = half_edges[i].face;
+                        edge->face1 = -1;
+                        edge->number_of_faces = 1;
+                        edge->crease = 0.0;
+                        (*number_of_edges)++;
+                }
+                (*corner_edge)[half_edges[i].corner] = *number_of_edges - 1;
+        }
+        free (half_edges);
+        /* Copy the crease values of the listed edges. */
+        number_of_creases = mesh->edge_crease_count_level_0;
+        if (number_of_creases > mesh->edge_count_level_0)
+        {
+                number_of_creases = mesh->edge_count_level_0;
+        }
+        if ((mesh->edge_vertex_index == NULL) || (mesh->edge_create_value == NULL))
+        {
+                number_of_creases = 0;
+        }
+        for (i = 0; i < number_of_creases; i++)
+        {
+                key.v0 = mesh->edge_vertex_index[2 * i];
+                key.v1 = mesh->edge_vertex_index[2 * i + 1];
+                if (key.v0 > key.v1)
+                {
+                        key.v0 = key.v1;
+                        key.v1 = mesh->edge_vertex_index[2 * i];
+                }
+                edge = bsearch (&key, *edges, (size_t) *number_of_edges,
+                  sizeof (DxfMeshEdge), dxf_mesh_compare_edges);
+                if (edge != NULL)
+                {
+                        edge->crease = mesh->edge_create_value[i];
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Sharpness of an edge in one subdivision step, \c 0.0 for a
+ * smooth edge and \c 1.0 for a sharp edge.
+ *
+ * Boundary and non-manifold edges are always sharp.
+ */
+static double
+dxf_mesh_edge_sharpness
+(
+        const DxfMeshEdge *edge
+)
+{
+        if ((edge->number_of_faces != 2)
+          || (edge->crease < 0.0)
+          || (edge->crease >= 1.0))
+        {
+                return (1.0);
+        }
+        return (edge->crease);
+}
+
+
+/*!
+ * \brief Allocate a mesh holding a copy of the level 0 geometry of
+ * \c mesh.
+ *
+ * \return a pointer to the new mesh, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfMesh *
+dxf_mesh_copy_geometry
+(
+        DxfMesh *mesh
+)
+{
+        DxfMesh *copy;
+        int32_t number_of_creases;
+
+        copy = dxf_mesh_init (dxf_mesh_new ());
+        if (copy == NULL)
+        {
+                return (NULL);
+        }
+        number_of_creases = (mesh->edge_create_value != NULL) ? mesh->edge_crease_count_level_0 : 0;
+        copy->vertices = malloc ((3 * (size_t) mesh->vertex_count_level_0 + 1) * sizeof (double));
+        copy->face_list_item = malloc (((size_t) mesh->face_list_size_level_0 + 1) * sizeof (int32_t));
+        copy->edge_vertex_index = malloc ((2 * (size_t) mesh->edge_count_level_0 + 1) * sizeof (int32_t));
+        copy->edge_create_value = malloc (((size_t) number_of_creases + 1) * sizeof (double));
+        if ((copy->vertices == NULL)
+          || (copy->face_list_item == NULL)
+          || (copy->edge_vertex_index == NULL)
+          || (copy->edge_create_value == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                dxf_mesh_free (copy);
+                return (NULL);
+        }
+        if (mesh->vertex_count_level_0 > 0)
+        {
+                memcpy (copy->vertices, mesh->vertices,
+                  3 * (size_t) mesh->vertex_count_level_0 * sizeof (double));
+        }
+        if (mesh->face_list_size_level_0 > 0)
+        {
+                memcpy (copy->face_list_item, mesh->face_list_item,
+                  (size_t) mesh->face_list_size_level_0 * sizeof (int32_t));
+        }
+        if ((mesh->edge_count_level_0 > 0) && (mesh->edge_vertex_index != NULL))
+        {
+                memcpy (copy->edge_vertex_index, mesh->edge_vertex_index,
+                  2 * (size_t) mesh->edge_count_level_0 * sizeof (int32_t));
+                copy->edge_count_level_0 = mesh->edge_count_level_0;
+        }
+        if (number_of_creases > 0)
+        {
+                memcpy (copy->edge_create_value, mesh->edge_create_value,
+                  (size_t) number_of_creases * sizeof (double));
+                copy->edge_crease_count_level_0 = number_of_creases;
+        }
+        copy->vertex_count_level_0 = mesh->vertex_count_level_0;
+        copy->face_list_size_level_0 = mesh->face_list_size_level_0;
+        copy->blend_crease_property = mesh->blend_crease_property;
+        return (copy);
+}
+
+
+/*!
+ * \brief Apply one Catmull-Clark subdivision step to the level 0
+ * geometry of a mesh.
+ *
+ * \return a pointer to the subdivided mesh, or \c NULL when an error
+ * occurred.
+ */
+static DxfMesh *
+dxf_mesh_subdivide_once
+(
+        DxfMesh *mesh
+)
+{
+        DxfMesh *result = NULL;
+        DxfMeshEdge *edges = NULL;
+        DxfMeshEdge *edge;
+        int32_t *face_start = NULL;
+        int32_t *corner_edge = NULL;
+        int32_t *face_count = NULL;
+        int32_t *edge_count = NULL;
+        int32_t *sharp_count = NULL;
+        double *face_sum = NULL;
+        double *mid_sum = NULL;
+        double *sharp_sum = NULL;
+        double *sharp_weight = NULL;
+        const double *a;
+        const double *b;
+        const double *p;
+        double *v;
+        double smooth[3];
+        double crease[3];
+        double w;
+        const int32_t *face;
+        int32_t number_of_faces;
+        int32_t number_of_corners;
+        int32_t number_of_edges;
+        int32_t nv;
+        int32_t n;
+        int32_t e;
+        int32_t f;
+        int32_t i;
+        int32_t j;
+        int32_t k;
+        int32_t corner;
+        int32_t *item;
+        int32_t *pair;
+        int has_creases;
+
+        if (dxf_mesh_index_faces (mesh, &face_start, &number_of_faces, &number_of_corners) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        if (dxf_mesh_index_edges (mesh, face_start, number_of_faces,
+          number_of_corners, &edges, &number_of_edges, &corner_edge) == EXIT_FAILURE)
+        {
+                free (face_start);
+                return (NULL);
+        }
+        nv = mesh->vertex_count_level_0;
+        if ((double) nv + number_of_faces + number_of_edges > INT32_MAX / 3
+          || 5.0 * number_of_corners > INT32_MAX
+          || 4.0 * number_of_edges + 2.0 * number_of_corners > INT32_MAX)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the subdivided mesh is too large.\n")),
+                  __FUNCTION__);
+                free (face_start);
+                free (edges);
+                free (corner_edge);
+                return (NULL);
+        }
+        result = dxf_mesh_init (dxf_mesh_new ());
+        face_count = calloc ((size_t) nv + 1, sizeof (int32_t));
+        edge_count = calloc ((size_t) nv + 1, sizeof (int32_t));
+        sharp_count = calloc ((size_t) nv + 1, sizeof (int32_t));
+        face_sum = calloc (3 * (size_t) nv + 1, sizeof (double));
+        mid_sum = calloc (3 * (size_t) nv + 1, sizeof (double));
+        sharp_sum = calloc (3 * (size_t) nv + 1, sizeof (double));
+        sharp_weight = calloc ((size_t) nv + 1, sizeof (double));
+        if ((result == NULL)
+          || (face_count == NULL)
+          || (edge_count == NULL)
+          || (sharp_count == NULL)
+          || (face_sum == NULL)
+          || (mid_sum == NULL)
+          || (sharp_sum == NULL)
+          || (sharp_weight == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                if (result != NULL)
+                {
+                        dxf_mesh_free (result);
+                }
+                result = NULL;
+        }
+        else
+        {
+                result->vertex_count_level_0 = nv + number_of_faces + number_of_edges;
+                result->face_list_size_level_0 = 5 * number_of_corners;
+                result->edge_count_level_0 = 2 * number_of_edges + number_of_corners;
+                result->blend_crease_property = mesh->blend_crease_property;
+                result->vertices = malloc ((3 * (size_t) result->vertex_count_level_0 + 1) * sizeof (double));
+                result->face_list_item = malloc (((size_t) result->face_list_size_level_0 + 1) * sizeof (int32_t));
+                result->edge_vertex_index = malloc ((2 * (size_t) result->edge_count_level_0 + 1) * sizeof (int32_t));
+                result->edge_create_value = malloc ((2 * (size_t) number_of_edges + 1) * sizeof (double));
+                if ((result->vertices == NULL)
+                  || (result->face_list_item == NULL)
+                  || (result->edge_vertex_index == NULL)
+                  || (result->edge_create_value == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        dxf_mesh_free (result);
+                        result = NULL;
+                }
+        }
+        if (result != NULL)
+        {
+                /* Face points are the centroids of the face
+                 * vertices. */
+                for (f = 0; f < number_of_faces; f++)
+                {
+                        face = mesh->face_list_item + face_start[f];
+                        n = face[0];
+                        v = result->vertices + 3 * (nv + f);
+                        v[0] = v[1] = v[2] = 0.0;
+                        for (i = 1; i <= n; i++)
+                        {
+                                p = mesh->vertices + 3 * face[i];
+                                v[0] += p[0];
+                                v[1] += p[1];
+                                v[2] += p[2];
+                        }
+                        v[0] /= n;
+                        v[1] /= n;
+                        v[2] /= n;
+                        for (i = 1; i <= n; i++)
+                        {
+                                for (k = 0; k < 3; k++)
+                                {
+                                        face_sum[3 * face[i] + k] += v[k];
+                                }
+                                face_count[face[i]]++;
+                        }
+                }
+                /* Edge points average the edge ends and the
+                 * neighbouring face points, sharp edges keep their
+                 * midpoint. */
+                has_creases = FALSE;
+                for (e = 0; e < number_of_edges; e++)
+                {
+                        edge = edges + e;
+                        a = mesh->vertices + 3 * edge->v0;
+                        b = mesh->vertices + 3 * edge->v1;
+                        v = result->vertices + 3 * (nv + number_of_faces + e);
+                        w = dxf_mesh_edge_sharpness (edge);
+                        for (k = 0; k < 3; k++)
+                        {
+                                v[k] = 0.5 * (a[k] + b[k]);
+                                mid_sum[3 * edge->v0 + k] += v[k];
+                                mid_sum[3 * edge->v1 + k] += v[k];
+                        }
+                        edge_count[edge->v0]++;
+                        edge_count[edge->v1]++;
+                        if (w < 1.0)
+                        {
+                                for (k = 0; k < 3; k++)
+                                {
+                                        smooth[k] = 0.25 * (a[k] + b[k]
+                                          + result->vertices[3 * (nv + edge->face0) + k]
+                                          + result->vertices[3 * (nv + edge->face1) + k]);
+                                        v[k] = (1.0 - w) * smooth[k] + w * v[k];
+                                }
+                        }
+                        if (w > 0.0)
+                        {
+                                for (k = 0; k < 3; k++)
+                                {
+                                        sharp_sum[3 * edge->v0 + k] += b[k];
+                                        sharp_sum[3 * edge->v1 + k] += a[k];
+                                }
+                                sharp_count[edge->v0]++;
+                                sharp_count[edge->v1]++;
+                                sharp_weight[edge->v0] += w;
+                                sharp_weight[edge->v1] += w;
+                        }
+                        if ((edge->number_of_faces == 2) && (edge->crease != 0.0))
+                        {
+                                has_creases = TRUE;
+                        }
+                }
+                /* Vertex points, with the crease rule for vertices on
+                 * two sharp edges and the corner rule for vertices on
+                 * more sharp edges. */
+                for (i = 0; i < nv; i++)
+                {
+                        p = mesh->vertices + 3 * i;
+                        v = result->vertices + 3 * i;
+                        n = edge_count[i];
+                        for (k = 0; k < 3; k++)
+                        {
+                                v[k] = p[k];
+                                smooth[k] = p[k];
+                        }
+                        /* Boundary and non-manifold vertices are
+                         * handled by the rules for sharp edges. */
+                        if ((face_count[i] > 0) && (n >= 3) && (face_count[i] == n))
+                        {
+                                for (k = 0; k < 3; k++)
+                                {
+                                        smooth[k] = (face_sum[3 * i + k] / face_count[i]
+                                          + 2.0 * mid_sum[3 * i + k] / n
+                                          + (n - 3) * p[k]) / n;
+                                }
+                        }
+                        if (face_count[i] == 0)
+                        {
+                                continue;
+                        }
+                        w = (sharp_count[i] > 0) ? sharp_weight[i] / sharp_count[i] : 0.0;
+                        for (k = 0; k < 3; k++)
+                        {
+                                if (sharp_count[i] == 2)
+                                {
+                                        crease[k] = 0.125 * (6.0 * p[k] + sharp_sum[3 * i + k]);
+                                }
+                                else
+                                {
+                                        crease[k] = p[k];
+                                }
+                                v[k] = (sharp_count[i] < 2) ? smooth[k] : (1.0 - w) * smooth[k] + w * crease[k];
+                        }
+                }
+                /* Every face is split into quadrilaterals around it's
+                 * face point. */
+                item = result->face_list_item;
+                corner = 0;
+                for (f = 0; f < number_of_faces; f++)
+                {
+                        face = mesh->face_list_item + face_start[f];
+                        n = face[0];
+                        for (i = 0; i < n; i++)
+                        {
+                                j = (i > 0) ? corner + i - 1 : corner + n - 1;
+                                *item++ = 4;
+                                *item++ = face[i + 1];
+                                *item++ = nv + number_of_faces + corner_edge[corner + i];
+                                *item++ = nv + f;
+                                *item++ = nv + number_of_faces + corner_edge[j];
+                        }
+                        corner += n;
+                }
+                /* Edges, the halves of the old edges come first and
+                 * inherit the crease values. */
+                pair = result->edge_vertex_index;
+                for (e = 0; e < number_of_edges; e++)
+                {
+                        edge = edges + e;
+                        *pair++ = edge->v0;
+                        *pair++ = nv + number_of_faces + e;
+                        *pair++ = nv + number_of_faces + e;
+                        *pair++ = edge->v1;
+                        if (edge->crease < 0.0)
+                        {
+                                w = -1.0;
+                        }
+                        else
+                        {
+                                w = (edge->crease > 1.0) ? edge->crease - 1.0 : 0.0;
+                        }
+                        result->edge_create_value[2 * e] = w;
+                        result->edge_create_value[2 * e + 1] = w;
+                }
+                result->edge_crease_count_level_0 = has_creases ? 2 * number_of_edges : 0;
+                corner = 0;
+                for (f = 0; f < number_of_faces; f++)
+                {
+                        n = mesh->face_list_item[face_start[f]];
+                        for (i = 0; i < n; i++)
+                        {
+                                *pair++ = nv + number_of_faces + corner_edge[corner + i];
+                                *pair++ = nv + f;
+                        }
+                        corner += n;
+                }
+        }
+        free (face_start);
+        free (edges);
+        free (corner_edge);
+        free (face_count);
+        free (edge_count);
+        free (sharp_count);
+        free (face_sum);
+        free (mid_sum);
+        free (sharp_sum);
+        free (sharp_weight);
+        return (result);
+}
+
+
+/*!
+ * \brief Subdivide the level 0 geometry of a DXF \c MESH entity with
+ * the Catmull-Clark scheme.
+ *
+ * Every step splits each face with \c n vertices into \c n
+ * quadrilaterals.\n
+ * Boundary edges and edges with a crease value of \c -1 stay sharp,
+ * an edge with a positive crease value stays sharp for that many steps,
+ * with fractional values blended between smooth and sharp.\n
+ * The returned mesh only holds geometry: the vertices, faces, edges and
+ * crease values of the subdivided mesh as it's level 0, it is to be
+ * freed with dxf_mesh_free ().
+ *
+ * \return a pointer to the subdivided mesh, a copy of the geometry when
+ * \c levels is \c 0, or \c NULL when an error occurred.
+ */
+DxfMesh *
+dxf_mesh_subdivide
+(
+        DxfMesh *mesh,
+                /*!< a pointer to a DXF \c MESH entity. */
+        int levels
+                /*!< Number of subdivision steps. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMesh *result;
+        DxfMesh *next;
+        int32_t *face_start;
+        int32_t number_of_faces;
+        int32_t number_of_corners;
+        int i;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (levels < 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative number of levels was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (levels == 0)
+        {
+                /* Validate the faces as a subdivision step would. */
+                if (dxf_mesh_index_faces (mesh, &face_start, &number_of_faces, &number_of_corners) == EXIT_FAILURE)
+                {
+                        return (NULL);
+                }
+                free (face_start);
+                return (dxf_mesh_copy_geometry (mesh));
+        }
+        result = dxf_mesh_subdivide_once (mesh);
+        for (i = 1; (i < levels) && (result != NULL); i++)
+        {
+                next = dxf_mesh_subdivide_once (result);
+                dxf_mesh_free (result);
+                result = next;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Test if the point \c p lies inside or on the edges of the
+ * counterclockwise triangle \c a, \c b, \c c.
+ *
+ * A point coinciding with a corner of the triangle is not inside, so
+ * that repeated vertices do not block an ear.
+ */
+static int
+dxf_mesh_in_triangle
+(
+        const double *a,
+        const double *b,
+        const double *c,
+        const double *p
+)
+{
+        if (((p[0] == a[0]) && (p[1] == a[1]))
+          || ((p[0] == b[0]) && (p[1] == b[1]))
+          || ((p[0] == c[0]) && (p[1] == c[1])))
+        {
+                return (FALSE);
+        }
+        return (((b[0] - a[0]) * (p[1] - a[1]) - (b[1] - a[1]) * (p[0] - a[0]) >= 0.0)
+          && ((c[0] - b[0]) * (p[1] - b[1]) - (c[1] - b[1]) * (p[0] - b[0]) >= 0.0)
+          && ((a[0] - c[0]) * (p[1] - c[1]) - (a[1] - c[1]) * (p[0] - c[0]) >= 0.0));
+}
+
+
+/*!
+ * \brief Split a face with more than 3 vertices into triangles.
+ *
+ * The face is projected on the coordinate plane most perpendicular to
+ * it's normal.\n
+ * Convex faces are split as a fan, quadrilaterals along their shortest
+ * diagonal, other faces by clipping ears.\n
+ * \c ring and \c uv are scratch buffers for \c n vertices.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_mesh_triangulate_face
+(
+        const double *vertices,
+        const int32_t *face,
+        int32_t n,
+        int first,
+        int *ring,
+        double *uv,
+        DxfMeshTriangles *triangles
+)
+{
+        const double *p;
+        const double *q;
+        double normal[3];
+        double sign;
+        double cross;
+        double d02;
+        double d13;
+        int convex;
+        int axis;
+        int found;
+        int m;
+        int i;
+        int j;
+        int k;
+
+        /* Newell's method for the normal of a non planar face. */
+        normal[0] = normal[1] = normal[2] = 0.0;
+        for (i = 0; i < n; i++)
+        {
+                p = vertices + 3 * face[i];
+                q = vertices + 3 * face[(i + 1) % n];
+                normal[0] += (p[1] - q[1]) * (p[2] + q[2]);
+                normal[1] += (p[2] - q[2]) * (p[0] + q[0]);
+                normal[2] += (p[0] - q[0]) * (p[1] + q[1]);
+        }
+        axis = 2;
+        if ((fabs (normal[0]) >= fabs (normal[1])) && (fabs (normal[0]) >= fabs (normal[2])))
+        {
+                axis = 0;
+        }
+        else if (fabs (normal[1]) >= fabs (normal[2]))
+        {
+                axis = 1;
+        }
+        sign = (normal[axis] < 0.0) ? -1.0 : 1.0;
+        for (i = 0; i < n; i++)
+        {
+                p = vertices + 3 * face[i];
+                uv[2 * i] = p[(axis + 1) % 3];
+                uv[2 * i + 1] = sign * p[(axis + 2) % 3];
+                ring[i] = i;
+        }
+        convex = (normal[axis] != 0.0);
+        for (i = 0; (i < n) && convex; i++)
+        {
+                j = (i + 1) % n;
+                k = (i + 2) % n;
+                cross = (uv[2 * j] - uv[2 * i]) * (uv[2 * k + 1] - uv[2 * i + 1])
+                  - (uv[2 * j + 1] - uv[2 * i + 1]) * (uv[2 * k] - uv[2 * i]);
+                convex = (cross >= 0.0);
+        }
+        if (convex && (n == 4))
+        {
+                p = vertices + 3 * face[0];
+                q = vertices + 3 * face[2];
+                d02 = (p[0] - q[0]) * (p[0] - q[0]) + (p[1] - q[1]) * (p[1] - q[1]) + (p[2] - q[2]) * (p[2] - q[2]);
+                p = vertices + 3 * face[1];
+                q = vertices + 3 * face[3];
+                d13 = (p[0] - q[0]) * (p[0] - q[0]) + (p[1] - q[1]) * (p[1] - q[1]) + (p[2] - q[2]) * (p[2] - q[2]);
+                if (d13 < d02)
+                {
+                        if ((dxf_mesh_triangles_add_triangle (triangles,
+                          first + face[0], first + face[1], first + face[3]) == EXIT_FAILURE)
+                          || (dxf_mesh_triangles_add_triangle (triangles,
+                          first + face[1], first + face[2], first + face[3]) == EXIT_FAILURE))
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (EXIT_SUCCESS);
+                }
+        }
+        m = n;
+        if (!convex)
+        {
+                /* Clip ears until a triangle remains, when no ear is
+                 * found the face is degenerate and the rest is split
+                 * as a fan. */
+                while (m > 3)
+                {
+                        found = FALSE;
+                        for (i = 0; (i < m) && !found; i++)
+                        {
+                                const double *a = uv + 2 * ring[(i + m - 1) % m];
+                                const double *b = uv + 2 * ring[i];
+                                const double *c = uv + 2 * ring[(i + 1) % m];
+
+                                if ((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]) <= 0.0)
+                                {
+                                        continue;
+                                }
+                                found = TRUE;
+                                for (j = 0; (j < m) && found; j++)
+                                {
+                                        if ((j != i)
+                                          && (j != (i + m - 1) % m)
+                                          && (j != (i + 1) % m)
+                                          && dxf_mesh_in_triangle (a, b, c, uv + 2 * ring[j]))
+                                        {
+                                                found = FALSE;
+                                        }
+                                }
+                                if (found)
+                                {
+                                        if (dxf_mesh_triangles_add_triangle (triangles,
+                                          first + face[ring[(i + m - 1) % m]],
+                                          first + face[ring[i]],
+                                          first + face[ring[(i + 1) % m]]) == EXIT_FAILURE)
+                                        {
+                                                return (EXIT_FAILURE);
+                                        }
+                                        memmove (ring + i, ring + i + 1, (size_t) (m - i - 1) * sizeof (int));
+                                        m--;
+                                }
+                        }
+                        if (!found)
+                        {
+                                break;
+                        }
+                }
+        }
+        for (i = 1; i < m - 1; i++)
+        {
+                if (dxf_mesh_triangles_add_triangle (triangles,
+                  first + face[ring[0]], first + face[ring[i]],
+                  first + face[ring[i + 1]]) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Split the faces of the level 0 geometry of a DXF \c MESH
+ * entity into triangles.
+ *
+ * The vertices are appended to \c triangles, triangles and
+ * quadrilaterals are emitted directly, other convex faces are split as a
+ * fan and concave faces by ear clipping.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the face
+ * list is invalid or an error occurred.
+ */
+int
+dxf_mesh_triangulate_faces
+(
+        DxfMesh *mesh,
+                /*!< a pointer to a DXF \c MESH entity. */
+        DxfMeshTriangles *triangles
+                /*!< Buffer receiving the triangles. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const int32_t *face;
+        int32_t *face_start;
+        int32_t number_of_faces;
+        int32_t number_of_corners;
+        int32_t max_n;
+        int32_t f;
+        int *ring;
+        double *uv;
+        double *vertices;
+        int first;
+        int size;
+        int result;
+
+        /* Do some basic checks. */
+        if ((mesh == NULL) || (triangles == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (dxf_mesh_index_faces (mesh, &face_start, &number_of_faces, &number_of_corners) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        if (mesh->vertex_count_level_0 > INT_MAX - triangles->number_of_vertices)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () too many vertices.\n")),
+                  __FUNCTION__);
+                free (face_start);
+                return (EXIT_FAILURE);
+        }
+        first = triangles->number_of_vertices;
+        if (first + mesh->vertex_count_level_0 > triangles->vertices_size)
+        {
+                size = (triangles->vertices_size > 0) ? triangles->vertices_size : 256;
+                while (size < first + mesh->vertex_count_level_0)
+                {
+                        size = (size > INT_MAX / 2) ? first + mesh->vertex_count_level_0 : 2 * size;
+                }
+                vertices = realloc (triangles->vertices, 3 * (size_t) size * sizeof (double));
+                if (vertices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        free (face_start);
+                        return (EXIT_FAILURE);
+                }
+                triangles->vertices = vertices;
+                triangles->vertices_size = size;
+        }
+        if (mesh->vertex_count_level_0 > 0)
+        {
+                memcpy (triangles->vertices + 3 * first, mesh->vertices,
+                  3 * (size_t) mesh->vertex_count_level_0 * sizeof (double));
+        }
+        triangles->number_of_vertices += mesh->vertex_count_level_0;
+        max_n = 3;
+        for (f = 0; f < number_of_faces; f++)
+        {
+                if (mesh->face_list_item[face_start[f]] > max_n)
+                {
+                        max_n = mesh->face_list_item[face_start[f]];
+                }
+        }
+        ring = malloc ((size_t) max_n * sizeof (int));
+        uv = malloc (2 * (size_t) max_n * sizeof (double));
+        if ((ring == NULL) || (uv == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (face_start);
+                free (ring);
+                free (uv);
+                return (EXIT_FAILURE);
+        }
+        result = EXIT_SUCCESS;
+        for (f = 0; (f < number_of_faces) && (result == EXIT_SUCCESS); f++)
+        {
+                face = mesh->face_list_item + face_start[f];
+                if (face[0] == 3)
+                {
+                        result = dxf_mesh_triangles_add_triangle (triangles,
+                          first + face[1], first + face[2], first + face[3]);
+                }
+                else
+                {
+                        result = dxf_mesh_triangulate_face (mesh->vertices,
+                          face + 1, face[0], first, ring, uv, triangles);
+                }
+        }
+        free (face_start);
+        free (ring);
+        free (uv);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Convert a DXF \c MESH entity into indexed triangles.
+ *
+ * The mesh is subdivided \c levels times with the Catmull-Clark scheme,
+ * see dxf_mesh_subdivide (), with \c levels limited to the
+ * \c subdivision_level of the mesh, and the faces are split into
+ * triangles, see dxf_mesh_triangulate_faces ().\n
+ * The vertices are appended to \c triangles in the WCS.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_mesh_triangulate
+(
+        DxfMesh *mesh,
+                /*!< a pointer to a DXF \c MESH entity. */
+        int levels,
+                /*!< Number of subdivision steps, \c 0 for the level 0
+                 * faces. */
+        DxfMeshTriangles *triangles
+                /*!< Buffer receiving the triangles. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfMesh *subdivided;
+        int result;
+
+        /* Do some basic checks. */
+        if ((mesh == NULL) || (triangles == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (levels > mesh->subdivision_level)
+        {
+                levels = mesh->subdivision_level;
+        }
+        if (levels <= 0)
+        {
+                return (dxf_mesh_triangulate_faces (mesh, triangles));
+        }
+        subdivided = dxf_mesh_subdivide (mesh, levels);
+        if (subdivided == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        result = dxf_mesh_triangulate_faces (subdivided, triangles);
+        dxf_mesh_free (subdivided);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/* EOF */
@@ -0,0 +1,134 @@
+/*!
+ * \file mesh_triangulate.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for converting DXF \c MESH entities into indexed triangles.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_MESH_TRIANGULATE_H
+#define LIBDXF_SRC_MESH_TRIANGULATE_H
+
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+#include "global.h"
+#include "mesh.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Indexed triangles generated for a mesh.
+ *
+ * Clearing the buffer keeps the allocated memory.
+ */
+typedef struct
+dxf_mesh_triangles_struct
+{
+        double *vertices;
+                /*!< X-, Y- and Z-values of the vertices. */
+        int number_of_vertices;
+                /*!< Number of vertices. */
+        int vertices_size;
+                /*!< Number of vertices allocated in \c vertices. */
+        int *indices;
+                /*!< Indices of the vertices of every triangle, 3 per
+                 * triangle, in the order of the vertices of the face
+                 * the triangle was split from. */
+        int number_of_triangles;
+                /*!< Number of triangles. */
+        int indices_size;
+                /*!< Number of triangles allocated in \c indices. */
+} DxfMeshTriangles;
+
+
+/*!
+ * \brief Edge of a mesh with the faces on either side, used while
+ * subdividing.
+ */
+typedef struct
+dxf_mesh_edge_struct
+{
+        int32_t v0;
+                /*!< Index of the lowest vertex. */
+        int32_t v1;
+                /*!< Index of the highest vertex. */
+        int32_t face0;
+                /*!< First face using the edge. */
+        int32_t face1;
+                /*!< Second face using the edge, \c -1 for a boundary
+                 * edge. */
+        int32_t number_of_faces;
+                /*!< Number of faces using the edge, more than 2 for a
+                 * non-manifold edge. */
+        double crease;
+                /*!< Crease value, \c -1 for an always sharp edge. */
+} DxfMeshEdge;
+
+
+/*!
+ * \brief Half edge of a face, used for sorting the face edges into
+ * unique edges.
+ */
+typedef struct
+dxf_mesh_half_edge_struct
+{
+        int32_t v0;
+                /*!< Index of the lowest vertex. */
+        int32_t v1;
+                /*!< Index of the highest vertex. */
+        int32_t face;
+                /*!< Face of the half edge. */
+        int32_t corner;
+                /*!< Index of the half edge over all faces. */
+} DxfMeshHalfEdge;
+
+
+DxfMeshTriangles *dxf_mesh_triangles_new ();
+int dxf_mesh_triangles_free (DxfMeshTriangles *triangles);
+int dxf_mesh_triangles_clear (DxfMeshTriangles *triangles);
+DxfMesh *dxf_mesh_subdivide (DxfMesh *mesh, int levels);
+int dxf_mesh_triangulate_faces (DxfMesh *mesh, DxfMeshTriangles *triangles);
+int dxf_mesh_triangulate (DxfMesh *mesh, int levels, DxfMeshTriangles *triangles);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_MESH_TRIANGULATE_H */
+
+
+/* EOF */
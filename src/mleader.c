@@ -36,6 +36,7 @@
 
 
 #include "mleader.h"
+#include "util.h"
 
 
 /*!
@@ -119,8 +120,8 @@ dxf_mleader_init
         mleader->paperspace = DXF_MODELSPACE;
         mleader->graphics_data_size = 0;
         mleader->shadow_mode = 0;
-        mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        mleader->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleader->binary_graphics_data);
+        mleader->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
+        mleader->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (mleader->binary_graphics_data);
         mleader->dictionary_owner_soft = strdup ("");
         mleader->object_owner_soft = strdup ("");
         mleader->material = strdup ("");
@@ -197,8 +198,7 @@ dxf_mleader_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter92;
         int iter330;
 
@@ -208,23 +208,21 @@ dxf_mleader_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mleader == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mleader = dxf_mleader_init (mleader);
         }
-        iter310 = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
         iter92 = 0;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -232,8 +230,6 @@ dxf_mleader_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -247,14 +243,12 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->linetype);
+                        dxf_read_string (&mleader->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->layer);
+                        dxf_read_string (&mleader->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -531,17 +525,14 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a
                          * Block attribute text string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_attribute_text_string);
+                        dxf_read_string (&mleader->block_attribute_text_string, fp);
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, mleader->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -549,22 +540,19 @@ dxf_mleader_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->dictionary_owner_soft);
+                                dxf_read_string (&mleader->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->object_owner_soft);
+                                dxf_read_string (&mleader->object_owner_soft, fp);
                         }
                         if (iter330 == 2)
                         {
                                 /* Now follows a string containing a
                                  * Block attribute ID. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_attribute_id);
+                                dxf_read_string (&mleader->block_attribute_id, fp);
                         }
                         iter330++;
                 }
@@ -572,57 +560,49 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a
                          * Leader style ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->leader_style_id);
+                        dxf_read_string (&mleader->leader_style_id, fp);
                 }
                 else if (strcmp (temp_string, "341") == 0)
                 {
                         /* Now follows a string containing a
                          * Leader linetype ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->leader_linetype_id);
+                        dxf_read_string (&mleader->leader_linetype_id, fp);
                 }
                 else if (strcmp (temp_string, "342") == 0)
                 {
                         /* Now follows a string containing a
                          * Arrowhead ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->arrowhead_id);
+                        dxf_read_string (&mleader->arrowhead_id, fp);
                 }
                 else if (strcmp (temp_string, "343") == 0)
                 {
                         /* Now follows a string containing a
                          * Text style ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->text_style_id);
+                        dxf_read_string (&mleader->text_style_id, fp);
                 }
                 else if (strcmp (temp_string, "344") == 0)
                 {
                         /* Now follows a string containing a
                          * Block content ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->block_content_id);
+                        dxf_read_string (&mleader->block_content_id, fp);
                 }
                 else if (strcmp (temp_string, "345") == 0)
                 {
                         /* Now follows a string containing a
                          * Arrow head ID. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->arrow_head_id);
+                        dxf_read_string (&mleader->arrow_head_id, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->material);
+                        dxf_read_string (&mleader->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->dictionary_owner_hard);
+                        dxf_read_string (&mleader->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -635,8 +615,7 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->plot_style_name);
+                        dxf_read_string (&mleader->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -648,8 +627,7 @@ dxf_mleader_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleader->color_name);
+                        dxf_read_string (&mleader->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -661,16 +639,20 @@ dxf_mleader_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mleader->linetype, "") == 0)
@@ -681,8 +663,6 @@ dxf_mleader_read
         {
                 mleader->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -838,13 +818,7 @@ dxf_mleader_write
 #endif
                 if (mleader->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) mleader->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                                iter = (DxfBinaryGraphicsData *) iter->next;
-                        }
+                        dxf_binary_data_write (fp, mleader->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -902,7 +876,10 @@ dxf_mleader_free
         }
         free (mleader->linetype);
         free (mleader->layer);
-        dxf_binary_graphics_data_free_list (mleader->binary_graphics_data);
+        if (mleader->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (mleader->binary_graphics_data);
+        }
         free (mleader->dictionary_owner_soft);
         free (mleader->object_owner_soft);
         free (mleader->material);
@@ -950,6 +927,7 @@ dxf_mleader_free_list
         while (mleaders != NULL)
         {
                 DxfMLeader *iter = (DxfMLeader *) mleaders->next;
+                mleaders->next = NULL;
                 dxf_mleader_free (mleaders);
                 mleaders = (DxfMLeader *) iter;
         }
@@ -5418,9 +5396,6 @@ dxf_mleader_get_last
         }
         if (mleader->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMLeader *) mleader);
         }
         DxfMLeader *iter = (DxfMLeader *) mleader->next;
@@ -5645,6 +5620,7 @@ dxf_mleader_context_data_free_list
         while (datas != NULL)
         {
                 DxfMLeaderContextData *iter = (DxfMLeaderContextData *) datas->next;
+                datas->next = NULL;
                 dxf_mleader_context_data_free (datas);
                 datas = (DxfMLeaderContextData *) iter;
         }
@@ -10588,9 +10564,6 @@ dxf_mleader_context_data_get_last
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMLeaderContextData *) data);
         }
         DxfMLeaderContextData *iter = (DxfMLeaderContextData *) data->next;
@@ -10769,6 +10742,7 @@ dxf_mleader_leader_node_free_list
         while (nodes != NULL)
         {
                 DxfMLeaderLeaderNode *iter = (DxfMLeaderLeaderNode *) nodes->next;
+                nodes->next = NULL;
                 dxf_mleader_leader_node_free (nodes);
                 nodes = (DxfMLeaderLeaderNode *) iter;
         }
@@ -12477,9 +12451,6 @@ dxf_mleader_leader_node_get_last
         }
         if (node->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMLeaderLeaderNode *) node);
         }
         DxfMLeaderLeaderNode *iter = (DxfMLeaderLeaderNode *) node->next;
@@ -12653,6 +12624,7 @@ dxf_mleader_leader_line_free_list
         while (lines != NULL)
         {
                 DxfMLeaderLeaderLine *iter = (DxfMLeaderLeaderLine *) lines->next;
+                lines->next = NULL;
                 dxf_mleader_leader_line_free (lines);
                 lines = (DxfMLeaderLeaderLine *) iter;
         }
@@ -13895,9 +13867,6 @@ dxf_mleader_leader_line_get_last
         }
         if (line->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMLeaderLeaderLine *) line);
         }
         DxfMLeaderLeaderLine *iter = (DxfMLeaderLeaderLine *) line->next;
@@ -36,6 +36,7 @@
 
 
 #include "mleaderstyle.h"
+#include "util.h"
 
 
 /*!
@@ -119,8 +120,8 @@ dxf_mleaderstyle_init
         mleaderstyle->paperspace = DXF_MODELSPACE;
         mleaderstyle->graphics_data_size = 0;
         mleaderstyle->shadow_mode = 0;
-        mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        mleaderstyle->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init (mleaderstyle->binary_graphics_data);
+        mleaderstyle->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
+        mleaderstyle->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init (mleaderstyle->binary_graphics_data);
         mleaderstyle->dictionary_owner_soft = strdup ("");
         mleaderstyle->object_owner_soft = strdup ("");
         mleaderstyle->material = strdup ("");
@@ -203,8 +204,7 @@ dxf_mleaderstyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryGraphicsData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
 
         /* Do some basic checks. */
@@ -213,22 +213,20 @@ dxf_mleaderstyle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mleaderstyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mleaderstyle = dxf_mleaderstyle_init (mleaderstyle);
         }
-        iter310 = (DxfBinaryGraphicsData *) mleaderstyle->binary_graphics_data;
         iter330 = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -236,8 +234,6 @@ dxf_mleaderstyle_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -251,14 +247,12 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->linetype);
+                        dxf_read_string (&mleaderstyle->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->layer);
+                        dxf_read_string (&mleaderstyle->layer, fp);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0))
@@ -335,10 +329,8 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) iter310->next);
-                        iter310 = (DxfBinaryGraphicsData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, mleaderstyle->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -346,15 +338,13 @@ dxf_mleaderstyle_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->dictionary_owner_soft);
+                                dxf_read_string (&mleaderstyle->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->object_owner_soft);
+                                dxf_read_string (&mleaderstyle->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -362,15 +352,13 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->material);
+                        dxf_read_string (&mleaderstyle->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->dictionary_owner_hard);
+                        dxf_read_string (&mleaderstyle->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -383,8 +371,7 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->plot_style_name);
+                        dxf_read_string (&mleaderstyle->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -396,8 +383,7 @@ dxf_mleaderstyle_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mleaderstyle->color_name);
+                        dxf_read_string (&mleaderstyle->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -409,16 +395,20 @@ dxf_mleaderstyle_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mleaderstyle->linetype, "") == 0)
@@ -429,8 +419,6 @@ dxf_mleaderstyle_read
         {
                 mleaderstyle->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -504,7 +492,10 @@ dxf_mleaderstyle_free
         }
         free (mleaderstyle->linetype);
         free (mleaderstyle->layer);
-        dxf_binary_graphics_data_free_list (mleaderstyle->binary_graphics_data);
+        if (mleaderstyle->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (mleaderstyle->binary_graphics_data);
+        }
         free (mleaderstyle->dictionary_owner_soft);
         free (mleaderstyle->object_owner_soft);
         free (mleaderstyle->material);
@@ -550,6 +541,7 @@ dxf_mleaderstyle_free_list
         while (mleaderstyles != NULL)
         {
                 DxfMLeaderstyle *iter = (DxfMLeaderstyle *) mleaderstyles->next;
+                mleaderstyles->next = NULL;
                 dxf_mleaderstyle_free (mleaderstyles);
                 mleaderstyles = (DxfMLeaderstyle *) iter;
         }
@@ -5250,9 +5242,6 @@ dxf_mleaderstyle_get_last
         }
         if (mleaderstyle->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMLeaderstyle *) mleaderstyle);
         }
         DxfMLeaderstyle *iter = (DxfMLeaderstyle *) mleaderstyle->next;
@@ -42,6 +42,7 @@
 
 
 #include "mline.h"
+#include "util.h"
 
 
 /*!
@@ -126,8 +127,8 @@ dxf_mline_init
         dxf_mline_set_paperspace (mline, DXF_MODELSPACE);
         dxf_mline_set_graphics_data_size (mline, 0);
         dxf_mline_set_shadow_mode (mline, 0);
-        dxf_mline_set_binary_graphics_data (mline, dxf_binary_graphics_data_new ());
-        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline));
+        dxf_mline_set_binary_graphics_data (mline, dxf_binary_data_new ());
+        dxf_binary_data_init ((DxfBinaryData *) dxf_mline_get_binary_graphics_data (mline));
         dxf_mline_set_dictionary_owner_soft (mline, strdup (""));
         dxf_mline_set_material (mline, strdup (""));
         dxf_mline_set_dictionary_owner_hard (mline, strdup (""));
@@ -191,7 +192,7 @@ dxf_mline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         int j;
         int k;
@@ -207,13 +208,12 @@ dxf_mline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mline = dxf_mline_init (mline);
@@ -225,10 +225,25 @@ dxf_mline_read
         j = 0; /* Number of found direction vectors in linked list p2. */
         iter_p2 = (DxfPoint *) mline->p2; /* Pointer to first direction vector p2. */
         k = 0;
+        if (mline->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                mline->p0 = dxf_point_init (dxf_point_new ());
+                if (mline->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
         iter_p3 = (DxfPoint *) mline->p3; /* Pointer to first direction vector p3. */
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -236,8 +251,6 @@ dxf_mline_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
@@ -245,10 +258,9 @@ dxf_mline_read
                         /* Now follows a string containing a string of
                          * up to 32 characters with the name of the
                          * style used for this mline. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->style_name);
+                        dxf_read_string (&mline->style_name, fp);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -259,14 +271,12 @@ dxf_mline_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->linetype);
+                        dxf_read_string (&mline->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->layer);
+                        dxf_read_string (&mline->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -509,12 +519,12 @@ dxf_mline_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbMline") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -544,36 +554,37 @@ dxf_mline_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->dictionary_owner_soft);
+                        dxf_read_string (&mline->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "340") == 0)
                 {
                         /* Now follows a string containing a
                          * Pointer-handle/ID of MLINESTYLE dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->mlinestyle_dictionary);
+                        dxf_read_string (&mline->mlinestyle_dictionary, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mline->dictionary_owner_hard);
+                        dxf_read_string (&mline->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_mline_get_linetype (mline), "") == 0)
@@ -584,8 +595,6 @@ dxf_mline_read
         {
                 dxf_mline_set_layer (mline, strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -770,11 +779,9 @@ dxf_mline_write
 #else
                 fprintf (fp->fp, " 92\n%d\n", dxf_mline_get_graphics_data_size (mline));
 #endif
-                DxfBinaryGraphicsData *bgd_iter = (DxfBinaryGraphicsData *) dxf_mline_get_binary_graphics_data (mline);
-                while (dxf_binary_graphics_data_get_data_line (bgd_iter) != NULL)
+                if (mline->binary_graphics_data != NULL)
                 {
-                        fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (bgd_iter));
-                        bgd_iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (bgd_iter);
+                        dxf_binary_data_write (fp, mline->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -917,7 +924,10 @@ dxf_mline_free
         }
         free (mline->linetype);
         free (mline->layer);
-        dxf_binary_graphics_data_free_list (mline->binary_graphics_data);
+        if (mline->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (mline->binary_graphics_data);
+        }
         free (mline->dictionary_owner_soft);
         free (mline->material);
         free (mline->dictionary_owner_hard);
@@ -962,6 +972,7 @@ dxf_mline_free_list
         while (mlines != NULL)
         {
                 DxfMline *iter = (DxfMline *) mlines->next;
+                mlines->next = NULL;
                 dxf_mline_free (mlines);
                 mlines = (DxfMline *) iter;
         }
@@ -5141,9 +5152,6 @@ dxf_mline_get_last
         }
         if (mline->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMline *) mline);
         }
         DxfMline *iter = (DxfMline *) mline->next;
@@ -42,6 +42,7 @@
 
 
 #include "mlinestyle.h"
+#include "util.h"
 
 
 /*!
@@ -163,7 +164,7 @@ dxf_mlinestyle_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
@@ -172,35 +173,33 @@ dxf_mlinestyle_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (mlinestyle == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mlinestyle = dxf_mlinestyle_init (mlinestyle);
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -208,53 +207,50 @@ dxf_mlinestyle_read
                 {
                         /* Now follows a string containing a mlinestyle
                          * name string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->name);
+                        dxf_read_string (&mlinestyle->name, fp);
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing a description
                          * string. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->description);
+                        dxf_read_string (&mlinestyle->description, fp);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", (uint *) &mlinestyle->id_code);
                 }
-                if (strcmp (temp_string, "6") == 0)
+                else if (strcmp (temp_string, "6") == 0)
                 {
                         /* Now follows a string containing an element
                          * linetype. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->element_linetype[i]);
+                        dxf_read_string (&mlinestyle->element_linetype[i], fp);
                         i++;
                 }
-                if (strcmp (temp_string, "49") == 0)
+                else if (strcmp (temp_string, "49") == 0)
                 {
                         /* Now follows a string containing an element
                          * offset value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->element_offset[i]);
                 }
-                if (strcmp (temp_string, "51") == 0)
+                else if (strcmp (temp_string, "51") == 0)
                 {
                         /* Now follows a string containing a start angle
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->start_angle);
                 }
-                if (strcmp (temp_string, "52") == 0)
+                else if (strcmp (temp_string, "52") == 0)
                 {
                         /* Now follows a string containing a end angle
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &mlinestyle->end_angle);
                 }
-                if ((strcmp (temp_string, "62") == 0)
+                else if ((strcmp (temp_string, "62") == 0)
                   && (i == 0))
                 {
                         /* Now follows a string containing a fill color
@@ -263,7 +259,7 @@ dxf_mlinestyle_read
                         fscanf (fp->fp, "%d\n", &mlinestyle->color);
                         i++;
                 }
-                if ((strcmp (temp_string, "62") == 0)
+                else if ((strcmp (temp_string, "62") == 0)
                   && (i > 0))
                 {
                         /* Now follows a string containing an element
@@ -271,14 +267,14 @@ dxf_mlinestyle_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &mlinestyle->element_color[i]);
                 }
-                if (strcmp (temp_string, "70") == 0)
+                else if (strcmp (temp_string, "70") == 0)
                 {
                         /* Now follows a string containing a flags
                          * value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &mlinestyle->flags);
                 }
-                if (strcmp (temp_string, "71") == 0)
+                else if (strcmp (temp_string, "71") == 0)
                 {
                         /* Now follows a string containing a number of
                          * elements value. */
@@ -290,11 +286,11 @@ dxf_mlinestyle_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "AcDbMlineStyle") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -303,32 +299,32 @@ dxf_mlinestyle_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->dictionary_owner_soft);
+                        dxf_read_string (&mlinestyle->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mlinestyle->dictionary_owner_hard);
+                        dxf_read_string (&mlinestyle->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -529,6 +525,7 @@ dxf_mlinestyle_free_list
         while (mlinestyles != NULL)
         {
                 DxfMlinestyle *iter = (DxfMlinestyle *) mlinestyles->next;
+                mlinestyles->next = NULL;
                 dxf_mlinestyle_free (mlinestyles);
                 mlinestyles = (DxfMlinestyle *) iter;
         }
@@ -2035,9 +2032,6 @@ dxf_mlinestyle_get_last
         }
         if (mlinestyle->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMlinestyle *) mlinestyle);
         }
         DxfMlinestyle *iter = (DxfMlinestyle *) mlinestyle->next;
@@ -42,6 +42,7 @@
 
 
 #include "mtext.h"
+#include "util.h"
 
 
 /*!
@@ -121,12 +122,6 @@ dxf_mtext_init
         mtext->linetype = strdup (DXF_DEFAULT_LINETYPE);
         mtext->text_style = strdup ("");
         mtext->layer = strdup (DXF_DEFAULT_LAYER);
-        mtext->p0->x0 = 0.0;
-        mtext->p0->y0 = 0.0;
-        mtext->p0->z0 = 0.0;
-        mtext->p1->x0 = 0.0;
-        mtext->p1->y0 = 0.0;
-        mtext->p1->z0 = 0.0;
         mtext->elevation = 0.0;
         mtext->thickness = 0.0;
         mtext->height = 0.0;
@@ -156,6 +151,8 @@ dxf_mtext_init
         mtext->background_color_rgb = 0;
         mtext->background_color_name = strdup ("");
         mtext->background_transparency = 0;
+        mtext->p0 = NULL;
+        mtext->p1 = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -187,7 +184,7 @@ dxf_mtext_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -195,20 +192,49 @@ dxf_mtext_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (mtext == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 mtext = dxf_mtext_init (mtext);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (mtext->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                mtext->p0 = dxf_point_init (dxf_point_new ());
+                if (mtext->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (mtext->p1 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                mtext->p1 = dxf_point_init (dxf_point_new ());
+                if (mtext->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -216,15 +242,12 @@ dxf_mtext_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_value);
+                        dxf_read_string (&mtext->text_value, fp);
                 }
                 else if (strcmp (temp_string, "3") == 0)
                 {
@@ -245,21 +268,18 @@ dxf_mtext_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->linetype);
+                        dxf_read_string (&mtext->linetype, fp);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->text_style);
+                        dxf_read_string (&mtext->text_style, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, mtext->layer);
+                        dxf_read_string (&mtext->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -388,8 +408,9 @@ dxf_mtext_read
                 {
                         /* Can follows a string containing the
                          * rotation angle or column heights. */
-                        (fp->line_number)++;
-                /*!< Add more code here, I'm stop because the double use of group code 50*/
+                        /*! \todo Add code for the column heights,
+                         * for now the value is skipped. */
+                        dxf_read_value_line (temp_string, fp);
                 }
                 else if (strcmp (temp_string, "63") == 0)
                 {
@@ -459,12 +480,12 @@ dxf_mtext_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbMText") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -493,17 +514,21 @@ dxf_mtext_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
 
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (mtext->linetype, "") == 0)
@@ -514,12 +539,10 @@ dxf_mtext_read
         {
                 mtext->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (EXIT_SUCCESS);
+        return (mtext);
 }
 
 
@@ -791,6 +814,7 @@ dxf_mtext_free_list
         while (mtexts != NULL)
         {
                 DxfMtext *iter = (DxfMtext *) mtexts->next;
+                mtexts->next = NULL;
                 dxf_mtext_free (mtexts);
                 mtexts = (DxfMtext *) iter;
         }
@@ -5214,9 +5238,6 @@ dxf_mtext_get_last
         }
         if (mtext->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfMtext *) mtext);
         }
         DxfMtext *iter = (DxfMtext *) mtext->next;
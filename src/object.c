@@ -210,6 +210,7 @@ dxf_object_free_list
         while (objects != NULL)
         {
                 DxfObject *iter = (DxfObject *) objects->next;
+                objects->next = NULL;
                 dxf_object_free (objects);
                 objects = (DxfObject *) iter;
         }
@@ -403,9 +404,6 @@ dxf_object_get_last
         }
         if (object->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfObject *) object);
         }
         DxfObject *iter = (DxfObject *) object->next;
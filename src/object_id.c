@@ -179,6 +179,7 @@ dxf_object_id_free_list
         while (object_ids != NULL)
         {
                 DxfObjectId *iter = (DxfObjectId *) object_ids->next;
+                object_ids->next = NULL;
                 dxf_object_id_free (object_ids);
                 object_ids = (DxfObjectId *) iter;
         }
@@ -533,9 +534,6 @@ dxf_object_id_get_last
         }
         if (object_id->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfObjectId *) object_id);
         }
         DxfObjectId *iter = (DxfObjectId *) object_id->next;
@@ -42,6 +42,7 @@
 
 
 #include "object_ptr.h"
+#include "util.h"
 
 
 /*!
@@ -114,9 +115,7 @@ dxf_object_ptr_init
         object_ptr->id_code = 0;
         object_ptr->dictionary_owner_soft = strdup ("");
         object_ptr->dictionary_owner_hard = strdup ("");
-        object_ptr->xdata->value = NULL;
-        object_ptr->xdata->length = 0;
-        object_ptr->xdata->next = NULL;
+        object_ptr->xdata = NULL;
         object_ptr->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -148,7 +147,7 @@ dxf_object_ptr_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -156,34 +155,47 @@ dxf_object_ptr_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (object_ptr == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 object_ptr = dxf_object_ptr_init (object_ptr);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (object_ptr->xdata == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                object_ptr->xdata = dxf_char_init (dxf_char_new ());
+                if (object_ptr->xdata == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -198,41 +210,40 @@ dxf_object_ptr_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->dictionary_owner_soft);
+                        dxf_read_string (&object_ptr->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->dictionary_owner_hard);
+                        dxf_read_string (&object_ptr->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else if (strcmp (temp_string, "1001") == 0)
                 {
                         /* Now follows a string containing extended data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, object_ptr->xdata->value);
+                        dxf_read_string (&object_ptr->xdata->value, fp);
                         object_ptr->xdata->length = strlen (object_ptr->xdata->value);
                         /*! \todo Set pointer to xdata->next for
                          * following xdata object. */
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -411,6 +422,7 @@ dxf_object_ptr_free_list
         while (objectptrs != NULL)
         {
                 DxfObjectPtr *iter = (DxfObjectPtr *) objectptrs->next;
+                objectptrs->next = NULL;
                 dxf_object_ptr_free (objectptrs);
                 objectptrs = (DxfObjectPtr *) iter;
         }
@@ -765,9 +777,6 @@ dxf_object_ptr_get_last
         }
         if (object_ptr->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfObjectPtr *) object_ptr);
         }
         DxfObjectPtr *iter = (DxfObjectPtr *) object_ptr->next;
@@ -126,14 +126,8 @@ dxf_ole2frame_init
         ole2frame->length_of_binary_data = strdup ("");
         dxf_ole2frame_set_p0 (ole2frame, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_ole2frame_get_p0 (ole2frame));
-        ole2frame->p0->x0 = 0.0;
-        ole2frame->p0->y0 = 0.0;
-        ole2frame->p0->z0 = 0.0;
         dxf_ole2frame_set_p1 (ole2frame, dxf_point_new ());
         dxf_point_init ((DxfPoint *) dxf_ole2frame_get_p1 (ole2frame));
-        ole2frame->p1->x0 = 0.0;
-        ole2frame->p1->y0 = 0.0;
-        ole2frame->p1->z0 = 0.0;
         ole2frame->ole_version_number = 1;
         ole2frame->ole_object_type = 0;
         ole2frame->tilemode_descriptor = 0;
@@ -143,6 +137,8 @@ dxf_ole2frame_init
         ole2frame->binary_data->value = strdup ("");
         ole2frame->binary_data->length = 0;
         ole2frame->binary_data->next = NULL;
+        ole2frame->p0 = NULL;
+        ole2frame->p1 = NULL;
         ole2frame->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -174,7 +170,7 @@ dxf_ole2frame_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -183,21 +179,49 @@ dxf_ole2frame_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (ole2frame == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 ole2frame = dxf_ole2frame_init (ole2frame);
         }
-        iter = (DxfChar *) ole2frame->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (ole2frame->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                ole2frame->p0 = dxf_point_init (dxf_point_new ());
+                if (ole2frame->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (ole2frame->p1 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                ole2frame->p1 = dxf_point_init (dxf_point_new ());
+                if (ole2frame->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -205,31 +229,28 @@ dxf_ole2frame_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a End of Ole
                          * data marker. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "OLE") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_INVALID_ENTITY,
                                   (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                if (strcmp (temp_string, "3") == 0)
+                else if (strcmp (temp_string, "3") == 0)
                 {
                         /* Now follows a string containing the length of
                          * binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->length_of_binary_data);
+                        dxf_read_string (&ole2frame->length_of_binary_data, fp);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -240,14 +261,12 @@ dxf_ole2frame_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->linetype);
+                        dxf_read_string (&ole2frame->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->layer);
+                        dxf_read_string (&ole2frame->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -367,12 +386,12 @@ dxf_ole2frame_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbOle2Frame") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -380,38 +399,62 @@ dxf_ole2frame_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
+                        dxf_read_line (temp_string, fp);
+                        if (iter == NULL)
+                        {
+                                /* The first line goes in the (empty) head
+                                 * of the list. */
+                                if (ole2frame->binary_data == NULL)
+                                {
+                                        ole2frame->binary_data = dxf_char_init (dxf_char_new ());
+                                }
+                                iter = (DxfChar *) ole2frame->binary_data;
+                        }
+                        else
+                        {
+                                iter->next = (struct DxfChar *) dxf_char_init (dxf_char_new ());
+                                iter = (DxfChar *) iter->next;
+                        }
+                        if (iter == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        free (iter->value);
+                        iter->value = strdup (temp_string);
+                        iter->length = strlen (temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->dictionary_owner_soft);
+                        dxf_read_string (&ole2frame->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, ole2frame->dictionary_owner_hard);
+                        dxf_read_string (&ole2frame->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (ole2frame->linetype, "") == 0)
@@ -422,8 +465,6 @@ dxf_ole2frame_read
         {
                 ole2frame->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -639,10 +680,14 @@ dxf_ole2frame_free
         free (ole2frame->layer);
         free (ole2frame->dictionary_owner_soft);
         free (ole2frame->dictionary_owner_hard);
-        free (ole2frame->binary_data->value);
-        /*! \todo Needs a proper implementation. */
-        free (ole2frame->binary_data);
-        /*! \todo Needs a proper implementation. */
+        if (ole2frame->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (ole2frame->binary_graphics_data);
+        }
+        if (ole2frame->binary_data != NULL)
+        {
+                dxf_char_free_list (ole2frame->binary_data);
+        }
         free (ole2frame);
         ole2frame = NULL;
 #if DEBUG
@@ -676,6 +721,7 @@ dxf_ole2frame_free_list
         while (ole2frames != NULL)
         {
                 DxfOle2Frame *iter = (DxfOle2Frame *) ole2frames->next;
+                ole2frames->next = NULL;
                 dxf_ole2frame_free (ole2frames);
                 ole2frames = (DxfOle2Frame *) iter;
         }
@@ -3529,9 +3575,6 @@ dxf_ole2frame_get_last
         }
         if (ole2frame->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfOle2Frame *) ole2frame);
         }
         DxfOle2Frame *iter = (DxfOle2Frame *) ole2frame->next;
@@ -158,7 +158,7 @@ dxf_oleframe_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -167,21 +167,19 @@ dxf_oleframe_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (oleframe == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 oleframe = dxf_oleframe_init (oleframe);
         }
-        iter = (DxfChar *) oleframe->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -189,24 +187,22 @@ dxf_oleframe_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a End of Ole
                          * data marker. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "OLE") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_INVALID_ENTITY,
                                   (_("Warning in %s () found a bad End of Ole data marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -217,14 +213,12 @@ dxf_oleframe_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->linetype);
+                        dxf_read_string (&oleframe->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->layer);
+                        dxf_read_string (&oleframe->layer, fp);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -289,12 +283,12 @@ dxf_oleframe_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbOleFrame") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -302,38 +296,62 @@ dxf_oleframe_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
-                        iter->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter->next);
-                        iter = (DxfChar *) iter->next;
+                        dxf_read_line (temp_string, fp);
+                        if (iter == NULL)
+                        {
+                                /* The first line goes in the (empty) head
+                                 * of the list. */
+                                if (oleframe->binary_data == NULL)
+                                {
+                                        oleframe->binary_data = dxf_char_init (dxf_char_new ());
+                                }
+                                iter = (DxfChar *) oleframe->binary_data;
+                        }
+                        else
+                        {
+                                iter->next = (struct DxfChar *) dxf_char_init (dxf_char_new ());
+                                iter = (DxfChar *) iter->next;
+                        }
+                        if (iter == NULL)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () could not allocate memory.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        free (iter->value);
+                        iter->value = strdup (temp_string);
+                        iter->length = strlen (temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->dictionary_owner_soft);
+                        dxf_read_string (&oleframe->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, oleframe->dictionary_owner_hard);
+                        dxf_read_string (&oleframe->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (oleframe->linetype, "") == 0)
@@ -344,8 +362,6 @@ dxf_oleframe_read
         {
                 oleframe->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -550,7 +566,14 @@ dxf_oleframe_free
         free (oleframe->layer);
         free (oleframe->dictionary_owner_soft);
         free (oleframe->dictionary_owner_hard);
-        dxf_char_free_list (oleframe->binary_data);
+        if (oleframe->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (oleframe->binary_graphics_data);
+        }
+        if (oleframe->binary_data != NULL)
+        {
+                dxf_char_free_list (oleframe->binary_data);
+        }
         free (oleframe);
         oleframe = NULL;
 #if DEBUG
@@ -584,6 +607,7 @@ dxf_oleframe_free_list
         while (oleframes != NULL)
         {
                 DxfOleFrame *iter = (DxfOleFrame *) oleframes->next;
+                oleframes->next = NULL;
                 dxf_oleframe_free (oleframes);
                 oleframes = (DxfOleFrame *) iter;
         }
@@ -2456,9 +2480,6 @@ dxf_oleframe_get_last
         }
         if (oleframe->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfOleFrame *) oleframe);
         }
         DxfOleFrame *iter = (DxfOleFrame *) oleframe->next;
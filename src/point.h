@@ -268,6 +268,58 @@ DxfPoint *dxf_point_set_next (DxfPoint *point, DxfPoint *next);
 DxfPoint *dxf_point_get_last (DxfPoint *point);
 
 
+/*!
+ * \name Unchecked getters.
+ *
+ * Inline getters without checks for use in hot loops, on a \c POINT
+ * entity which passed \c dxf_entities_validate ().
+ */
+/*! \{ */
+
+
+static inline double
+dxf_point_get_x0_unchecked
+(
+        DxfPoint *point
+                /*!< a pointer to a DXF \c POINT entity. */
+)
+{
+        return (point->x0);
+}
+
+
+static inline double
+dxf_point_get_y0_unchecked
+(
+        DxfPoint *point
+                /*!< a pointer to a DXF \c POINT entity. */
+)
+{
+        return (point->y0);
+}
+
+
+static inline double
+dxf_point_get_z0_unchecked
+(
+        DxfPoint *point
+                /*!< a pointer to a DXF \c POINT entity. */
+)
+{
+        return (point->z0);
+}
+
+
+/*! \} */
+
+
+#if DXF_TRUSTED_INPUT && !defined (DXF_CHECKED_GETTERS)
+#  define dxf_point_get_x0(point) dxf_point_get_x0_unchecked (point)
+#  define dxf_point_get_y0(point) dxf_point_get_y0_unchecked (point)
+#  define dxf_point_get_z0(point) dxf_point_get_z0_unchecked (point)
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -42,6 +42,7 @@
 
 
 #include "polyline.h"
+#include "util.h"
 
 
 /*!
@@ -121,7 +122,7 @@ dxf_polyline_init
         dxf_polyline_set_paperspace (polyline, DXF_MODELSPACE);
         dxf_polyline_set_graphics_data_size (polyline, 0);
         dxf_polyline_set_shadow_mode (polyline, 0);
-        dxf_polyline_set_binary_graphics_data (polyline, (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ());
+        dxf_polyline_set_binary_graphics_data (polyline, (DxfBinaryData *) dxf_binary_data_new ());
         dxf_polyline_set_dictionary_owner_soft (polyline, strdup (""));
         dxf_polyline_set_material (polyline, strdup (""));
         dxf_polyline_set_dictionary_owner_hard (polyline, strdup (""));
@@ -147,9 +148,9 @@ dxf_polyline_init
         dxf_polyline_set_extr_x0 (polyline, 0.0);
         dxf_polyline_set_extr_y0 (polyline, 0.0);
         dxf_polyline_set_extr_z0 (polyline, 0.0);
-        dxf_polyline_set_vertices (polyline, (DxfVertex *) dxf_vertex_new ());
-        dxf_vertex_init ((DxfVertex *) dxf_polyline_get_vertices (polyline));
-        dxf_polyline_set_next (polyline, NULL);
+        /* The vertices are appended while reading. */
+        polyline->vertices = NULL;
+        polyline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -182,7 +183,7 @@ dxf_polyline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -190,20 +191,34 @@ dxf_polyline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (polyline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 polyline = dxf_polyline_init (polyline);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (polyline->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                polyline->p0 = dxf_point_init (dxf_point_new ());
+                if (polyline->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -211,8 +226,6 @@ dxf_polyline_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -226,14 +239,12 @@ dxf_polyline_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->linetype);
+                        dxf_read_string (&polyline->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->layer);
+                        dxf_read_string (&polyline->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -368,8 +379,7 @@ dxf_polyline_read
                          * version should probably be added here.
                          * Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                 }
                 else if (strcmp (temp_string, "210") == 0)
                 {
@@ -396,29 +406,31 @@ dxf_polyline_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_soft);
+                        dxf_read_string (&polyline->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, polyline->dictionary_owner_hard);
+                        dxf_read_string (&polyline->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (dxf_polyline_get_linetype (polyline), "") == 0)
@@ -429,8 +441,6 @@ dxf_polyline_read
         {
                 dxf_polyline_set_layer (polyline, strdup (DXF_DEFAULT_LAYER));
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -625,7 +635,7 @@ dxf_polyline_write
                 fprintf (fp->fp, "230\n%f\n", dxf_polyline_get_extr_z0 (polyline));
         }
         /* Start of writing (multiple) vertices. */
-        iter = (DxfVertex *) dxf_polyline_get_vertices (polyline);
+        iter = (DxfVertex *) polyline->vertices;
         while (iter != NULL)
         {
                 dxf_vertex_write (fp, iter);
@@ -676,14 +686,20 @@ dxf_polyline_free
         }
         free (dxf_polyline_get_linetype (polyline));
         free (dxf_polyline_get_layer (polyline));
-        dxf_binary_graphics_data_free_list (dxf_polyline_get_binary_graphics_data (polyline));
+        if (polyline->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (polyline->binary_graphics_data);
+        }
         free (dxf_polyline_get_dictionary_owner_soft (polyline));
         free (dxf_polyline_get_material (polyline));
         free (dxf_polyline_get_dictionary_owner_hard (polyline));
         free (dxf_polyline_get_plot_style_name (polyline));
         free (dxf_polyline_get_color_name (polyline));
         dxf_point_free (dxf_polyline_get_p0 (polyline));
-        dxf_vertex_free_list (dxf_polyline_get_vertices (polyline));
+        if (polyline->vertices != NULL)
+        {
+                dxf_vertex_free_list ((DxfVertex *) polyline->vertices);
+        }
         free (polyline);
         polyline = NULL;
 #if DEBUG
@@ -717,6 +733,7 @@ dxf_polyline_free_list
         while (polylines != NULL)
         {
                 DxfPolyline *iter = (DxfPolyline *) polylines->next;
+                polylines->next = NULL;
                 dxf_polyline_free (polylines);
                 polylines = (DxfPolyline *) iter;
         }
@@ -3730,9 +3747,6 @@ dxf_polyline_get_last
         }
         if (polyline->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfPolyline *) polyline);
         }
         DxfPolyline *iter = (DxfPolyline *) polyline->next;
@@ -0,0 +1,831 @@
+/*!
+ * \file polyline_mesh.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the conversion of polyface mesh and polygon mesh
+ * \c POLYLINE entities to indexed geometry.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "polyline_mesh.h"
+
+
+/*!
+ * \brief Allocate memory for a polyline mesh buffer.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfPolylineMesh *
+dxf_polyline_mesh_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPolylineMesh *mesh = NULL;
+
+        mesh = calloc (1, sizeof (DxfPolylineMesh));
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (mesh);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a polyline mesh buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_mesh_free
+(
+        DxfPolylineMesh *mesh
+                /*!< Polyline mesh buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (mesh->vertices);
+        free (mesh->faces);
+        free (mesh->invisible_edges);
+        free (mesh);
+        mesh = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all vertices and faces from a polyline mesh buffer,
+ * keeping the allocated memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_mesh_clear
+(
+        DxfPolylineMesh *mesh
+                /*!< Polyline mesh buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        mesh->number_of_vertices = 0;
+        mesh->number_of_faces = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a vertex to a polyline mesh buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_mesh_add_vertex
+(
+        DxfPolylineMesh *mesh,
+                /*!< Polyline mesh buffer. */
+        double x,
+                /*!< X-value of the vertex. */
+        double y,
+                /*!< Y-value of the vertex. */
+        double z
+                /*!< Z-value of the vertex. */
+)
+{
+        double *vertices;
+        int size;
+
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mesh->number_of_vertices == mesh->vertices_size)
+        {
+                size = (mesh->vertices_size > 0) ? 2 * mesh->vertices_size : 256;
+                vertices = realloc (mesh->vertices, 3 * (size_t) size * sizeof (double));
+                if (vertices == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                mesh->vertices = vertices;
+                mesh->vertices_size = size;
+        }
+        mesh->vertices[3 * mesh->number_of_vertices] = x;
+        mesh->vertices[3 * mesh->number_of_vertices + 1] = y;
+        mesh->vertices[3 * mesh->number_of_vertices + 2] = z;
+        mesh->number_of_vertices++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a face to a polyline mesh buffer.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_mesh_add_face
+(
+        DxfPolylineMesh *mesh,
+                /*!< Polyline mesh buffer. */
+        int a,
+                /*!< Index of the first vertex. */
+        int b,
+                /*!< Index of the second vertex. */
+        int c,
+                /*!< Index of the third vertex. */
+        int d,
+                /*!< Index of the fourth vertex, \c -1 for a triangle. */
+        int invisible_edges
+                /*!< Invisible edges, bit \c i set for the edge starting
+                 * at vertex \c i. */
+)
+{
+        int *faces;
+        unsigned char *flags;
+        int size;
+
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (mesh->number_of_faces == mesh->faces_size)
+        {
+                size = (mesh->faces_size > 0) ? 2 * mesh->faces_size : 256;
+                faces = realloc (mesh->faces, 4 * (size_t) size * sizeof (int));
+                if (faces == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                mesh->faces = faces;
+                flags = realloc (mesh->invisible_edges, (size_t) size);
+                if (flags == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                mesh->invisible_edges = flags;
+                mesh->faces_size = size;
+        }
+        mesh->faces[4 * mesh->number_of_faces] = a;
+        mesh->faces[4 * mesh->number_of_faces + 1] = b;
+        mesh->faces[4 * mesh->number_of_faces + 2] = c;
+        mesh->faces[4 * mesh->number_of_faces + 3] = (d < 0) ? -1 : d;
+        mesh->invisible_edges[mesh->number_of_faces] = (unsigned char) (invisible_edges & ((d < 0) ? 7 : 15));
+        mesh->number_of_faces++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Order welded vertices by their X-value.
+ */
+static int
+dxf_polyline_mesh_compare_weld
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfPolylineMeshWeld *p = (const DxfPolylineMeshWeld *) a;
+        const DxfPolylineMeshWeld *q = (const DxfPolylineMeshWeld *) b;
+
+        if (p->x != q->x)
+        {
+                return ((p->x < q->x) ? -1 : 1);
+        }
+        return ((p->index < q->index) ? -1 : (p->index > q->index));
+}
+
+
+/*!
+ * \brief Weld the vertices from \c first_vertex on and remap the faces
+ * from \c first_face on.
+ *
+ * A vertex is merged into the first vertex (in X-order) within the
+ * tolerance, repeated vertices are removed from the faces, keeping the
+ * visibility of the edge that remains, and faces with less than 3
+ * distinct vertices are removed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_polyline_mesh_weld_range
+(
+        DxfPolylineMesh *mesh,
+        int first_vertex,
+        int first_face,
+        double tolerance
+)
+{
+        DxfPolylineMeshWeld *order;
+        int *remap;
+        const double *p;
+        const double *q;
+        double dx;
+        double dy;
+        double dz;
+        int index[4];
+        int n;
+        int m;
+        int count;
+        int flags;
+        int new_flags;
+        int a;
+        int f;
+        int i;
+        int j;
+        int k;
+
+        count = mesh->number_of_vertices - first_vertex;
+        if (count <= 1)
+        {
+                return (EXIT_SUCCESS);
+        }
+        order = malloc ((size_t) count * sizeof (DxfPolylineMeshWeld));
+        remap = malloc ((size_t) count * sizeof (int));
+        if ((order == NULL) || (remap == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (order);
+                free (remap);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < count; i++)
+        {
+                order[i].x = mesh->vertices[3 * (first_vertex + i)];
+                order[i].index = i;
+                remap[i] = i;
+        }
+        qsort (order, (size_t) count, sizeof (DxfPolylineMeshWeld),
+          dxf_polyline_mesh_compare_weld);
+        for (i = 0; i < count; i++)
+        {
+                a = order[i].index;
+                if (remap[a] != a)
+                {
+                        continue;
+                }
+                p = mesh->vertices + 3 * (first_vertex + a);
+                for (j = i + 1; (j < count) && (order[j].x - order[i].x <= tolerance); j++)
+                {
+                        if (remap[order[j].index] != order[j].index)
+                        {
+                                continue;
+                        }
+                        q = mesh->vertices + 3 * (first_vertex + order[j].index);
+                        dx = q[0] - p[0];
+                        dy = q[1] - p[1];
+                        dz = q[2] - p[2];
+                        if (dx * dx + dy * dy + dz * dz <= tolerance * tolerance)
+                        {
+                                remap[order[j].index] = a;
+                        }
+                }
+        }
+        free (order);
+        /* Compact the vertices, the kept vertices stay in their
+         * original order. */
+        n = 0;
+        for (i = 0; i < count; i++)
+        {
+                if (remap[i] == i)
+                {
+                        memmove (mesh->vertices + 3 * (first_vertex + n),
+                          mesh->vertices + 3 * (first_vertex + i), 3 * sizeof (double));
+                        remap[i] = n;
+                        n++;
+                }
+                else
+                {
+                        remap[i] = remap[remap[i]];
+                }
+        }
+        mesh->number_of_vertices = first_vertex + n;
+        /* Remap the faces and drop repeated vertices, an edge to a
+         * repeated vertex vanishes and the next edge keeps it's
+         * visibility. */
+        m = first_face;
+        for (f = first_face; f < mesh->number_of_faces; f++)
+        {
+                n = (mesh->faces[4 * f + 3] < 0) ? 3 : 4;
+                flags = mesh->invisible_edges[f];
+                k = 0;
+                new_flags = 0;
+                for (i = 0; i < n; i++)
+                {
+                        j = mesh->faces[4 * f + i];
+                        if (j >= first_vertex)
+                        {
+                                j = first_vertex + remap[j - first_vertex];
+                        }
+                        if ((k > 0) && (index[k - 1] == j))
+                        {
+                                /* Keep the visibility of the edge
+                                 * starting at the repeated vertex. */
+                                new_flags = (new_flags & ~(1 << (k - 1))) | (((flags >> i) & 1) << (k - 1));
+                                continue;
+                        }
+                        index[k] = j;
+                        new_flags |= ((flags >> i) & 1) << k;
+                        k++;
+                }
+                while ((k > 1) && (index[k - 1] == index[0]))
+                {
+                        new_flags = (new_flags & ~(1 << (k - 2))) | (((new_flags >> (k - 1)) & 1) << (k - 2));
+                        new_flags &= ~(1 << (k - 1));
+                        k--;
+                }
+                if (k < 3)
+                {
+                        continue;
+                }
+                mesh->faces[4 * m] = index[0];
+                mesh->faces[4 * m + 1] = index[1];
+                mesh->faces[4 * m + 2] = index[2];
+                mesh->faces[4 * m + 3] = (k == 4) ? index[3] : -1;
+                mesh->invisible_edges[m] = (unsigned char) new_flags;
+                m++;
+        }
+        mesh->number_of_faces = m;
+        free (remap);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Weld the vertices of a polyline mesh buffer that are within
+ * \c tolerance of each other.
+ *
+ * See dxf_polyline_mesh_convert () for the details.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_polyline_mesh_weld
+(
+        DxfPolylineMesh *mesh,
+                /*!< Polyline mesh buffer. */
+        double tolerance
+                /*!< Distance within which vertices are merged. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (tolerance < 0.0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a negative tolerance was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_polyline_mesh_weld_range (mesh, 0, 0, tolerance));
+}
+
+
+/*!
+ * \brief Append the vertices and faces of a polyface mesh \c POLYLINE.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when a face
+ * refers to a missing vertex or an error occurred.
+ */
+static int
+dxf_polyline_mesh_convert_polyface
+(
+        DxfPolyline *polyline,
+        DxfPolylineMesh *mesh
+)
+{
+        DxfVertex *vertex;
+        int first;
+        int index[4];
+        int flags;
+        int n;
+        int i;
+
+        first = mesh->number_of_vertices;
+        for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                if (((vertex->flag & 192) != 192) || (vertex->p0 == NULL))
+                {
+                        continue;
+                }
+                if (dxf_polyline_mesh_add_vertex (mesh, vertex->p0->x0,
+                  vertex->p0->y0, vertex->p0->z0) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                if ((vertex->flag & 192) != 128)
+                {
+                        continue;
+                }
+                index[0] = vertex->polyface_mesh_vertex_index_1;
+                index[1] = vertex->polyface_mesh_vertex_index_2;
+                index[2] = vertex->polyface_mesh_vertex_index_3;
+                index[3] = vertex->polyface_mesh_vertex_index_4;
+                /* The first zero index ends the face, a negative index
+                 * makes the edge starting at that vertex invisible. */
+                flags = 0;
+                for (n = 0; (n < 4) && (index[n] != 0); n++)
+                {
+                        if (index[n] < 0)
+                        {
+                                index[n] = -index[n];
+                                flags |= 1 << n;
+                        }
+                        if (index[n] > mesh->number_of_vertices - first)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () a face refers to the missing vertex %d.\n")),
+                                  __FUNCTION__, index[n]);
+                                return (EXIT_FAILURE);
+                        }
+                        index[n] += first - 1;
+                }
+                if (n < 3)
+                {
+                        /* Points and lines are no faces. */
+                        continue;
+                }
+                for (i = n; i < 4; i++)
+                {
+                        index[i] = -1;
+                }
+                if (dxf_polyline_mesh_add_face (mesh, index[0], index[1],
+                  index[2], index[3], flags) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append the vertices and faces of a polygon mesh \c POLYLINE.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the number
+ * of vertices does not match the mesh size or an error occurred.
+ */
+static int
+dxf_polyline_mesh_convert_polygon_mesh
+(
+        DxfPolyline *polyline,
+        DxfPolylineMesh *mesh
+)
+{
+        DxfVertex *vertex;
+        int smoothed;
+        int first;
+        int m;
+        int n;
+        int rows;
+        int columns;
+        int i;
+        int j;
+
+        /* A smoothed mesh carries the control points (flag 16) and the
+         * fitted surface (flag 8) of the surface density. */
+        smoothed = (polyline->flag & 4)
+          && (polyline->smooth_M_surface_density > 1)
+          && (polyline->smooth_N_surface_density > 1);
+        m = smoothed ? polyline->smooth_M_surface_density : polyline->polygon_mesh_M_vertex_count;
+        n = smoothed ? polyline->smooth_N_surface_density : polyline->polygon_mesh_N_vertex_count;
+        first = mesh->number_of_vertices;
+        for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                if (!(vertex->flag & 64)
+                  || (vertex->p0 == NULL)
+                  || (smoothed && !(vertex->flag & 8))
+                  || (!smoothed && (vertex->flag & 16)))
+                {
+                        continue;
+                }
+                if (dxf_polyline_mesh_add_vertex (mesh, vertex->p0->x0,
+                  vertex->p0->y0, vertex->p0->z0) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if ((m < 1) || (n < 1) || ((double) m * n != mesh->number_of_vertices - first))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () found %d vertices for a %d by %d polygon mesh.\n")),
+                  __FUNCTION__, mesh->number_of_vertices - first, m, n);
+                return (EXIT_FAILURE);
+        }
+        rows = ((polyline->flag & 1) && (m > 2)) ? m : m - 1;
+        columns = ((polyline->flag & 32) && (n > 2)) ? n : n - 1;
+        for (i = 0; i < rows; i++)
+        {
+                for (j = 0; j < columns; j++)
+                {
+                        if (dxf_polyline_mesh_add_face (mesh,
+                          first + i * n + j,
+                          first + i * n + (j + 1) % n,
+                          first + ((i + 1) % m) * n + (j + 1) % n,
+                          first + ((i + 1) % m) * n + j, 0) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Convert a polyface mesh or polygon mesh \c POLYLINE into
+ * indexed faces.
+ *
+ * The vertices and faces are appended to \c mesh.\n
+ * Polyface meshes (flag 64) give a face for every face record with 3
+ * or 4 vertices, the edges starting at a negative vertex index are
+ * marked invisible.\n
+ * Polygon meshes (flag 16) give a quadrilateral for every cell of the
+ * M by N vertex grid, wrapping around when the mesh is closed in the M
+ * (flag 1) or N (flag 32) direction, for a smoothed mesh (flag 4) the
+ * fitted surface is used.\n
+ * When \c tolerance is positive the appended vertices within that
+ * distance of each other are welded, repeated vertices are removed from
+ * the faces and faces with less than 3 distinct vertices are
+ * dropped.\n
+ * On failure the buffer is left as it was.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the
+ * polyline is no mesh, the mesh is invalid or an error occurred.
+ */
+int
+dxf_polyline_mesh_convert
+(
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        double tolerance,
+                /*!< Weld distance, \c 0.0 to keep all vertices. */
+        DxfPolylineMesh *mesh
+                /*!< Polyline mesh buffer receiving the faces. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int first_vertex;
+        int first_face;
+        int result;
+
+        /* Do some basic checks. */
+        if ((polyline == NULL) || (mesh == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        first_vertex = mesh->number_of_vertices;
+        first_face = mesh->number_of_faces;
+        if (polyline->flag & 64)
+        {
+                result = dxf_polyline_mesh_convert_polyface (polyline, mesh);
+        }
+        else if (polyline->flag & 16)
+        {
+                result = dxf_polyline_mesh_convert_polygon_mesh (polyline, mesh);
+        }
+        else
+        {
+                fprintf (stderr,
+                  (_("Error in %s () the POLYLINE entity with id-code: %x is no mesh.\n")),
+                  __FUNCTION__, polyline->id_code);
+                return (EXIT_FAILURE);
+        }
+        if ((result == EXIT_SUCCESS) && (tolerance > 0.0))
+        {
+                result = dxf_polyline_mesh_weld_range (mesh, first_vertex,
+                  first_face, tolerance);
+        }
+        if (result == EXIT_FAILURE)
+        {
+                mesh->number_of_vertices = first_vertex;
+                mesh->number_of_faces = first_face;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Create a polyface mesh \c POLYLINE from a polyline mesh
+ * buffer.
+ *
+ * The vertices are written as vertex records (flags 128 and 64)
+ * followed by a face record (flag 128) for every face, with the indices
+ * of the vertices starting the invisible edges negated.\n
+ * The polyline and it's vertices are on the default layer.
+ *
+ * \return a pointer to the new \c POLYLINE, or \c NULL when the mesh
+ * exceeds the 32767 vertices or faces of a polyface mesh or an error
+ * occurred.
+ */
+DxfPolyline *
+dxf_polyline_mesh_to_polyface
+(
+        DxfPolylineMesh *mesh
+                /*!< Polyline mesh buffer. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfPolyline *polyline;
+        DxfVertex *vertex;
+        DxfVertex *last;
+        int index[4];
+        int i;
+        int j;
+        int k;
+
+        /* Do some basic checks. */
+        if (mesh == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if ((mesh->number_of_vertices > INT16_MAX)
+          || (mesh->number_of_faces > INT16_MAX))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () too many vertices or faces for a polyface mesh.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        polyline = dxf_polyline_init (dxf_polyline_new ());
+        if (polyline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (polyline->vertices != NULL)
+        {
+                dxf_vertex_free_list (polyline->vertices);
+                polyline->vertices = NULL;
+        }
+        polyline->flag = 64;
+        polyline->polygon_mesh_M_vertex_count = mesh->number_of_vertices;
+        polyline->polygon_mesh_N_vertex_count = mesh->number_of_faces;
+        last = NULL;
+        for (i = 0; i < mesh->number_of_vertices + mesh->number_of_faces; i++)
+        {
+                vertex = dxf_vertex_init (dxf_vertex_new ());
+                if ((vertex == NULL) || (vertex->p0 == NULL))
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        if (vertex != NULL)
+                        {
+                                dxf_vertex_free (vertex);
+                        }
+                        dxf_polyline_free (polyline);
+                        return (NULL);
+                }
+                if (i < mesh->number_of_vertices)
+                {
+                        vertex->flag = 192;
+                        vertex->p0->x0 = mesh->vertices[3 * i];
+                        vertex->p0->y0 = mesh->vertices[3 * i + 1];
+                        vertex->p0->z0 = mesh->vertices[3 * i + 2];
+                }
+                else
+                {
+                        j = i - mesh->number_of_vertices;
+                        vertex->flag = 128;
+                        for (k = 0; k < 4; k++)
+                        {
+                                index[k] = mesh->faces[4 * j + k] + 1;
+                                if ((index[k] > 0) && ((mesh->invisible_edges[j] >> k) & 1))
+                                {
+                                        index[k] = -index[k];
+                                }
+                        }
+                        vertex->polyface_mesh_vertex_index_1 = index[0];
+                        vertex->polyface_mesh_vertex_index_2 = index[1];
+                        vertex->polyface_mesh_vertex_index_3 = index[2];
+                        vertex->polyface_mesh_vertex_index_4 = index[3];
+                }
+                if (last == NULL)
+                {
+                        polyline->vertices = vertex;
+                }
+                else
+                {
+                        last->next = (struct DxfVertex *) vertex;
+                }
+                last = vertex;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (polyline);
+}
+
+
+/* EOF */
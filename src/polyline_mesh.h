@@ -0,0 +1,112 @@
+/*!
+ * \file polyline_mesh.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the conversion of polyface mesh and polygon mesh
+ * \c POLYLINE entities to indexed geometry.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_POLYLINE_MESH_H
+#define LIBDXF_SRC_POLYLINE_MESH_H
+
+
+#include <math.h>
+#include <string.h>
+#include "global.h"
+#include "polyline.h"
+#include "vertex.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Indexed faces of a polyface mesh or polygon mesh \c POLYLINE.
+ *
+ * Clearing the buffer keeps the allocated memory.
+ */
+typedef struct
+dxf_polyline_mesh_struct
+{
+        double *vertices;
+                /*!< X-, Y- and Z-values of the vertices in the WCS. */
+        int number_of_vertices;
+                /*!< Number of vertices. */
+        int vertices_size;
+                /*!< Number of vertices allocated in \c vertices. */
+        int *faces;
+                /*!< Zero based indices of the vertices of every face, 4
+                 * per face, the fourth index of a triangle is \c -1. */
+        unsigned char *invisible_edges;
+                /*!< Invisible edges of every face, bit \c i is set when
+                 * the edge starting at vertex \c i of the face is
+                 * invisible. */
+        int number_of_faces;
+                /*!< Number of faces. */
+        int faces_size;
+                /*!< Number of faces allocated in \c faces and
+                 * \c invisible_edges. */
+} DxfPolylineMesh;
+
+
+/*!
+ * \brief Vertex sorted by it's X-value while welding.
+ */
+typedef struct
+dxf_polyline_mesh_weld_struct
+{
+        double x;
+                /*!< X-value of the vertex. */
+        int index;
+                /*!< Index of the vertex. */
+} DxfPolylineMeshWeld;
+
+
+DxfPolylineMesh *dxf_polyline_mesh_new ();
+int dxf_polyline_mesh_free (DxfPolylineMesh *mesh);
+int dxf_polyline_mesh_clear (DxfPolylineMesh *mesh);
+int dxf_polyline_mesh_add_vertex (DxfPolylineMesh *mesh, double x, double y, double z);
+int dxf_polyline_mesh_add_face (DxfPolylineMesh *mesh, int a, int b, int c, int d, int invisible_edges);
+int dxf_polyline_mesh_weld (DxfPolylineMesh *mesh, double tolerance);
+int dxf_polyline_mesh_convert (DxfPolyline *polyline, double tolerance, DxfPolylineMesh *mesh);
+DxfPolyline *dxf_polyline_mesh_to_polyface (DxfPolylineMesh *mesh);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_POLYLINE_MESH_H */
+
+
+/* EOF */
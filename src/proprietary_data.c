@@ -179,6 +179,7 @@ dxf_proprietary_data_free_list
         while (datas != NULL)
         {
                 DxfProprietaryData *iter = (DxfProprietaryData *) datas->next;
+                datas->next = NULL;
                 dxf_proprietary_data_free (datas);
                 datas = (DxfProprietaryData *) iter;
         }
@@ -610,9 +611,6 @@ dxf_proprietary_data_get_last
         }
         if (data->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfProprietaryData *) data);
         }
         DxfProprietaryData *iter = (DxfProprietaryData *) data->next;
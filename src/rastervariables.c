@@ -42,6 +42,7 @@
 
 
 #include "rastervariables.h"
+#include "util.h"
 
 
 /*!
@@ -149,7 +150,7 @@ dxf_rastervariables_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
 
         /* Do some basic checks. */
@@ -158,35 +159,33 @@ dxf_rastervariables_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (rastervariables == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rastervariables = dxf_rastervariables_init (rastervariables);
         }
         i = 0;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -197,21 +196,21 @@ dxf_rastervariables_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", (uint *) &rastervariables->id_code);
                 }
-                if (strcmp (temp_string, "70") == 0)
+                else if (strcmp (temp_string, "70") == 0)
                 {
                         /* Now follows a string containing a display
                          * image frame flag value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &rastervariables->display_image_frame);
                 }
-                if (strcmp (temp_string, "71") == 0)
+                else if (strcmp (temp_string, "71") == 0)
                 {
                         /* Now follows a string containing a display
                          * quality flag value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &rastervariables->display_quality);
                 }
-                if (strcmp (temp_string, "72") == 0)
+                else if (strcmp (temp_string, "72") == 0)
                 {
                         /* Now follows a string containing a units
                          * value. */
@@ -230,11 +229,11 @@ dxf_rastervariables_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "AcDbIdBuffer") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -243,33 +242,33 @@ dxf_rastervariables_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rastervariables->dictionary_owner_soft);
+                        dxf_read_string (&rastervariables->dictionary_owner_soft, fp);
                         i++;
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rastervariables->dictionary_owner_hard);
+                        dxf_read_string (&rastervariables->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -437,6 +436,7 @@ dxf_rastervariables_free_list
         while (rastervariables != NULL)
         {
                 DxfRasterVariables *iter = (DxfRasterVariables *) rastervariables->next;
+                rastervariables->next = NULL;
                 dxf_rastervariables_free (rastervariables);
                 rastervariables = (DxfRasterVariables *) iter;
         }
@@ -1132,9 +1132,6 @@ dxf_rastervariables_get_last
         }
         if (rastervariables->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfRasterVariables *) rastervariables);
         }
         DxfRasterVariables *iter = (DxfRasterVariables *) rastervariables->next;
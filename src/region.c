@@ -122,16 +122,7 @@ dxf_region_init
         region->color = DXF_COLOR_BYLAYER;
         region->paperspace = DXF_MODELSPACE;
         region->modeler_format_version_number = 1;
-        dxf_char_new (region->proprietary_data);
-        region->proprietary_data = dxf_char_init (region->proprietary_data);
-        region->proprietary_data->value = strdup ("");
-        region->proprietary_data->length = 0;
-        region->proprietary_data->next = NULL;
-        dxf_char_new (region->additional_proprietary_data);
-        region->additional_proprietary_data = dxf_char_init (region->additional_proprietary_data);
-        region->additional_proprietary_data->value = strdup ("");
-        region->additional_proprietary_data->length = 0;
-        region->additional_proprietary_data->next = NULL;
+        region->acis_data = NULL;
         region->dictionary_owner_soft = strdup ("");
         region->dictionary_owner_hard = strdup ("");
         region->next = NULL;
@@ -166,9 +157,8 @@ dxf_region_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfChar *iter1 = NULL;
-        DxfChar *iter2 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -176,22 +166,19 @@ dxf_region_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (region == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 region = dxf_region_init (region);
         }
-        iter1 = (DxfChar *) region->proprietary_data;
-        iter2 = (DxfChar *) region->additional_proprietary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -199,29 +186,30 @@ dxf_region_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter1->value);
-                        iter1->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter1->next);
-                        iter1 = (DxfChar *) iter1->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter2->value);
-                        iter2->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter2->next);
-                        iter2 = (DxfChar *) iter2->next;
+                         * data, group code 3 lines continue the
+                         * previous line. */
+                        group_code = (temp_string[0] == '1') ? 1 : 3;
+                        dxf_read_value_line (temp_string, fp);
+                        if (region->acis_data == NULL)
+                        {
+                                region->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                                if (region->acis_data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                        }
+                        dxf_acis_data_append_line (region->acis_data, group_code, temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -232,14 +220,12 @@ dxf_region_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->linetype);
+                        dxf_read_string (&region->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->layer);
+                        dxf_read_string (&region->layer, fp);
                 }
                 else if ((fp->acad_version_number <= AutoCAD_11)
                         && (strcmp (temp_string, "38") == 0)
@@ -298,41 +284,45 @@ dxf_region_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if (strcmp (temp_string, "AcDbModelerGeometry") != 0)
+                        dxf_read_line (temp_string, fp);
+                        if ((strcmp (temp_string, "AcDbEntity") != 0)
+                          && (strcmp (temp_string, "AcDbModelerGeometry") != 0))
                         {
-                                fprintf (stderr, "Error in dxf_region_read () found a bad subclass marker in: %s in line: %d.\n",
-                                        fp->filename, fp->line_number);
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
+                                  (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
                         }
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_soft);
+                        dxf_read_string (&region->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, region->dictionary_owner_hard);
+                        dxf_read_string (&region->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (region->linetype, "") == 0)
@@ -343,8 +333,6 @@ dxf_region_read
         {
                 region->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -371,8 +359,6 @@ dxf_region_write
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("REGION");
-        DxfChar *iter1 = NULL;
-        DxfChar *iter2 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -492,32 +478,14 @@ dxf_region_write
         {
                 fprintf (fp->fp, " 70\n%d\n", region->modeler_format_version_number);
         }
-        if (region->proprietary_data != NULL)
+        if (region->acis_data != NULL)
         {
-                iter1 = (DxfChar*) region->proprietary_data;
-                while ((iter1 != NULL) && (iter1->value != NULL))
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter1->value);
-                        iter1 = (DxfChar*) iter1->next;
-                }
+                dxf_acis_data_write (fp, region->acis_data);
         }
         else
         {
                 fprintf (fp->fp, "  1\n\n");
         }
-        if (region->additional_proprietary_data != NULL)
-        {
-                iter2 = (DxfChar*) region->additional_proprietary_data;
-                while ((iter2 != NULL) && (iter2->value != NULL))
-                {
-                        fprintf (fp->fp, "  3\n%s\n", iter2->value);
-                        iter2 = (DxfChar*) iter2->next;
-                }
-        }
-        else
-        {
-                fprintf (fp->fp, "  3\n\n");
-        }
         /* Clean up. */
         free (dxf_entity_name);
 #if DEBUG
@@ -562,14 +530,19 @@ dxf_region_free
         }
         free (region->linetype);
         free (region->layer);
-        dxf_binary_graphics_data_free_list (region->binary_graphics_data);
+        if (region->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (region->binary_graphics_data);
+        }
         free (region->dictionary_owner_soft);
         free (region->material);
         free (region->dictionary_owner_hard);
         free (region->plot_style_name);
         free (region->color_name);
-        dxf_char_free_list (region->proprietary_data);
-        dxf_char_free_list (region->additional_proprietary_data);
+        if (region->acis_data != NULL)
+        {
+                dxf_acis_data_free (region->acis_data);
+        }
         free (region);
         region = NULL;
 #if DEBUG
@@ -603,6 +576,7 @@ dxf_region_free_list
         while (regions != NULL)
         {
                 DxfRegion *iter = (DxfRegion *) regions->next;
+                regions->next = NULL;
                 dxf_region_free (regions);
                 regions = (DxfRegion *) iter;
         }
@@ -2163,13 +2137,14 @@ dxf_region_set_transparency
 
 
 /*!
- * \brief Get the \c proprietary_data from a DXF \c REGION entity.
+ * \brief Get the pointer to the proprietary (ACIS) data from a DXF
+ * \c REGION entity.
  *
- * \return \c proprietary_data when sucessful, or \c NULL when an error
- * occurred.
+ * \return pointer to the \c acis_data, \c NULL when the entity has no
+ * proprietary data or an error occurred.
  */
-DxfChar *
-dxf_region_get_proprietary_data
+DxfAcisData *
+dxf_region_get_acis_data
 (
         DxfRegion *region
                 /*!< a pointer to a DXF \c REGION entity. */
@@ -2186,32 +2161,216 @@ dxf_region_get_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->proprietary_data ==  NULL)
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region->acis_data);
+}
+
+
+/*!
+ * \brief Set the pointer to the proprietary (ACIS) data for a DXF
+ * \c REGION entity.
+ */
+DxfRegion *
+dxf_region_set_acis_data
+(
+        DxfRegion *region,
+                /*!< a pointer to a DXF \c REGION entity. */
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data to be set for
+                 * the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->proprietary_data->value ==  NULL)
+        if (acis_data == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        region->acis_data = acis_data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (region);
+}
+
+
+/*!
+ * \brief Get the lines with group code \c group_code from the
+ * proprietary (ACIS) data of a DXF \c REGION entity.
+ *
+ * \return a newly allocated single linked list of \c DxfChar objects,
+ * or \c NULL when there are no such lines or an error occurred.
+ */
+static DxfChar *
+dxf_region_get_lines
+(
+        DxfAcisData *acis_data,
+        int group_code
+)
+{
+        DxfProprietaryData *lines;
+        DxfProprietaryData *iter;
+        DxfChar *chars = NULL;
+        DxfChar *last = NULL;
+        DxfChar *c;
+
+        lines = dxf_acis_data_get_lines (acis_data, group_code);
+        for (iter = lines; iter != NULL; iter = (DxfProprietaryData *) iter->next)
+        {
+                c = dxf_char_new ();
+                if (c == NULL)
+                {
+                        if (chars != NULL)
+                        {
+                                dxf_char_free_list (chars);
+                        }
+                        chars = NULL;
+                        break;
+                }
+                /* Hand the line over to the DxfChar. */
+                c->value = iter->line;
+                c->length = iter->length;
+                iter->line = NULL;
+                if (last == NULL)
+                {
+                        chars = c;
+                }
+                else
+                {
+                        last->next = (struct DxfChar *) c;
+                }
+                last = c;
+        }
+        if (lines != NULL)
+        {
+                dxf_proprietary_data_free_list (lines);
+        }
+        return (chars);
+}
+
+
+/*!
+ * \brief Set the lines with group code \c group_code for the
+ * proprietary (ACIS) data of a DXF \c REGION entity.
+ *
+ * \return a pointer to \c acis_data, or \c NULL when an error occurred.
+ */
+static DxfAcisData *
+dxf_region_set_lines
+(
+        DxfAcisData *acis_data,
+        int group_code,
+        DxfChar *chars
+)
+{
+        DxfProprietaryData *lines = NULL;
+        DxfProprietaryData *last = NULL;
+        DxfProprietaryData *line;
+        DxfChar *iter;
+
+        for (iter = chars; iter != NULL; iter = (DxfChar *) iter->next)
+        {
+                if (iter->value == NULL)
+                {
+                        continue;
+                }
+                line = dxf_proprietary_data_new ();
+                if (line == NULL)
+                {
+                        acis_data = NULL;
+                        break;
+                }
+                /* Borrow the value, it is handed back before freeing. */
+                line->line = iter->value;
+                if (last == NULL)
+                {
+                        lines = line;
+                }
+                else
+                {
+                        last->next = (struct DxfProprietaryData *) line;
+                }
+                last = line;
+        }
+        if ((acis_data != NULL) && (lines != NULL))
+        {
+                acis_data = dxf_acis_data_set_lines (acis_data, group_code, lines);
+        }
+        for (line = lines; line != NULL; line = (DxfProprietaryData *) line->next)
+        {
+                line->line = NULL;
+        }
+        if (lines != NULL)
+        {
+                dxf_proprietary_data_free_list (lines);
+        }
+        return (acis_data);
+}
+
+
+/*!
+ * \brief Get the \c proprietary_data from a DXF \c REGION entity.
+ *
+ * The group code 1 lines of the proprietary (ACIS) data are
+ * returned.
+ *
+ * \return a newly allocated list with the \c proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_char_free_list ().
+ */
+DxfChar *
+dxf_region_get_proprietary_data
+(
+        DxfRegion *region
+                /*!< a pointer to a DXF \c REGION entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (region == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        if (region->acis_data == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->proprietary_data);
+        return (dxf_region_get_lines (region->acis_data, 1));
 }
 
 
 /*!
  * \brief Set the \c proprietary_data for a DXF \c REGION entity.
  *
- * \return a pointer to \c region when successful, or \c NULL when an
- * error occurred.
+ * The group code 1 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c proprietary_data.
  */
 DxfRegion *
 dxf_region_set_proprietary_data
@@ -2219,8 +2378,8 @@ dxf_region_set_proprietary_data
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
         DxfChar *proprietary_data
-                /*!< a pointer containing the \c proprietary_data for the
-                 * entity. */
+                /*!< a pointer to a single linked list with the
+                 * \c proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2241,14 +2400,21 @@ dxf_region_set_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (proprietary_data->value == NULL)
+        if (region->acis_data == NULL)
+        {
+                region->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (region->acis_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (dxf_region_set_lines (region->acis_data, 1, proprietary_data) == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
-        region->proprietary_data = proprietary_data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2257,11 +2423,16 @@ dxf_region_set_proprietary_data
 
 
 /*!
- * \brief Get the \c additional_proprietary_data from a DXF \c REGION
- * entity.
+ * \brief Get the \c additional_proprietary_data from a DXF \c REGION entity.
  *
- * \return \c additional_proprietary_data when sucessful, or \c NULL
- * when an error occurred.
+ * The group code 3 lines of the proprietary (ACIS) data are
+ * returned.
+ *
+ * \return a newly allocated list with the \c additional_proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_char_free_list ().
  */
 DxfChar *
 dxf_region_get_additional_proprietary_data
@@ -2281,33 +2452,25 @@ dxf_region_get_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (region->additional_proprietary_data ==  NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (region->additional_proprietary_data->value ==  NULL)
+        if (region->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (region->additional_proprietary_data);
+        return (dxf_region_get_lines (region->acis_data, 3));
 }
 
 
 /*!
- * \brief Set the \c additional_proprietary_data for a DXF \c REGION
- * entity.
+ * \brief Set the \c additional_proprietary_data for a DXF \c REGION entity.
  *
- * \return a pointer to \c region when successful, or \c NULL when an
- * error occurred.
+ * The group code 3 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c additional_proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c additional_proprietary_data.
  */
 DxfRegion *
 dxf_region_set_additional_proprietary_data
@@ -2315,8 +2478,8 @@ dxf_region_set_additional_proprietary_data
         DxfRegion *region,
                 /*!< a pointer to a DXF \c REGION entity. */
         DxfChar *additional_proprietary_data
-                /*!< a pointer containing the
-                 * \c additional_proprietary_data for the entity. */
+                /*!< a pointer to a single linked list with the
+                 * \c additional_proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2337,14 +2500,21 @@ dxf_region_set_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (additional_proprietary_data->value == NULL)
+        if (region->acis_data == NULL)
+        {
+                region->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (region->acis_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (dxf_region_set_lines (region->acis_data, 3, additional_proprietary_data) == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
-        region->additional_proprietary_data = additional_proprietary_data;
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2535,9 +2705,6 @@ dxf_region_get_last
         }
         if (region->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfRegion *) region);
         }
         DxfRegion *iter = (DxfRegion *) region->next;
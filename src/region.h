@@ -46,6 +46,7 @@
 
 
 #include "global.h"
+#include "acis_data.h"
 #include "point.h"
 #include "binary_graphics_data.h"
 #include "util.h"
@@ -187,15 +188,10 @@ dxf_region_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF region. */
-        DxfChar *proprietary_data;
-                /*!< Proprietary data (multiple lines < 255 characters
-                 * each).\n
-                 * Group code = 1. */
-        DxfChar *additional_proprietary_data;
-                /*!< Additional lines of proprietary data if previous
-                 * group 1 string is greater than 255 characters
-                 * (optional).\n
-                 * Group code = 3. */
+        DxfAcisData *acis_data;
+                /*!< Proprietary (ACIS) data, kept as read from the DXF
+                 * file and only decoded on request.\n
+                 * Group codes = 1 and 3. */
         int modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -251,6 +247,8 @@ char *dxf_region_get_color_name (DxfRegion *region);
 DxfRegion *dxf_region_set_color_name (DxfRegion *region, char *color_name);
 long dxf_region_get_transparency (DxfRegion *region);
 DxfRegion *dxf_region_set_transparency (DxfRegion *region, long transparency);
+DxfAcisData *dxf_region_get_acis_data (DxfRegion *region);
+DxfRegion *dxf_region_set_acis_data (DxfRegion *region, DxfAcisData *acis_data);
 DxfChar *dxf_region_get_proprietary_data (DxfRegion *region);
 DxfRegion *dxf_region_set_proprietary_data (DxfRegion *region, DxfChar *proprietary_data);
 DxfChar *dxf_region_get_additional_proprietary_data (DxfRegion *region);
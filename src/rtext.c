@@ -41,6 +41,7 @@
 
 
 #include "rtext.h"
+#include "util.h"
 
 
 /*!
@@ -120,8 +121,8 @@ dxf_rtext_init
         rtext->paperspace = DXF_MODELSPACE;
         rtext->graphics_data_size = 0;
         rtext->shadow_mode = 0;
-        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data);
+        rtext->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
+        rtext->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init ((DxfBinaryData *) rtext->binary_graphics_data);
         rtext->dictionary_owner_soft = strdup ("");
         rtext->material = strdup ("");
         rtext->dictionary_owner_hard = strdup ("");
@@ -176,7 +177,7 @@ dxf_rtext_read
         DXF_DEBUG_BEGIN
 #endif
         char *dxf_entity_name = strdup ("RTEXT");
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,20 +185,49 @@ dxf_rtext_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (rtext == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 rtext = dxf_rtext_init (rtext);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (rtext->binary_graphics_data == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                rtext->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                if (rtext->binary_graphics_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (rtext->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                rtext->p0 = dxf_point_init (dxf_point_new ());
+                if (rtext->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -205,15 +235,12 @@ dxf_rtext_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "1") == 0)
                 {
                         /* Now follows a string containing a text value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->text_value);
+                        dxf_read_string (&rtext->text_value, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -226,21 +253,18 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->linetype);
+                        dxf_read_string (&rtext->linetype, fp);
                 }
                 else if (strcmp (temp_string, "7") == 0)
                 {
                         /* Now follows a string containing a text style
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->text_style);
+                        dxf_read_string (&rtext->text_style, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->layer);
+                        dxf_read_string (&rtext->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -340,12 +364,12 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbRText") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -389,31 +413,26 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) rtext->binary_graphics_data->next);
-                        rtext->binary_graphics_data = (DxfBinaryGraphicsData *) rtext->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, rtext->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->dictionary_owner_soft);
+                        dxf_read_string (&rtext->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->material);
+                        dxf_read_string (&rtext->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->dictionary_owner_hard);
+                        dxf_read_string (&rtext->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -426,8 +445,7 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->plot_style_name);
+                        dxf_read_string (&rtext->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -439,8 +457,7 @@ dxf_rtext_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, rtext->color_name);
+                        dxf_read_string (&rtext->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -452,16 +469,20 @@ dxf_rtext_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning: in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (rtext->text_value, "") == 0)
@@ -480,8 +501,6 @@ dxf_rtext_read
         {
                 rtext->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -638,13 +657,7 @@ dxf_rtext_write
 #endif
                 if (rtext->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = rtext->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_data_write (fp, rtext->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -739,7 +752,10 @@ dxf_rtext_free
         }
         free (rtext->linetype);
         free (rtext->layer);
-        dxf_binary_graphics_data_free_list (rtext->binary_graphics_data);
+        if (rtext->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (rtext->binary_graphics_data);
+        }
         free (rtext->dictionary_owner_soft);
         free (rtext->material);
         free (rtext->dictionary_owner_hard);
@@ -781,6 +797,7 @@ dxf_rtext_free_list
         while (rtexts != NULL)
         {
                 DxfRText *iter = (DxfRText *) rtexts->next;
+                rtexts->next = NULL;
                 dxf_rtext_free (rtexts);
                 rtexts = (DxfRText *) iter;
         }
@@ -3439,9 +3456,6 @@ dxf_rtext_get_last
         }
         if (rtext->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfRText *) rtext);
         }
         DxfRText *iter = (DxfRText *) rtext->next;
@@ -0,0 +1,1207 @@
+/*!
+ * \file rtree.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for a libDXF R-tree over entity bounding boxes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "rtree.h"
+
+
+#define DXF_RTREE_MIN_ENTRIES (DXF_RTREE_MAX_ENTRIES / 4)
+        /*!< \brief Minimum number of entries in each half of a split
+         * node. */
+
+
+/*!
+ * \brief Allocate memory for an R-tree node.
+ *
+ * \return a pointer to the node, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfRTreeNode *
+dxf_rtree_node_new
+(
+        int level
+                /*!< Height of the node above the leaves. */
+)
+{
+        DxfRTreeNode *node;
+
+        node = malloc (sizeof (DxfRTreeNode));
+        if (node == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        node->level = level;
+        node->count = 0;
+        return (node);
+}
+
+
+/*!
+ * \brief Free an R-tree node and all it's descendants.
+ */
+static void
+dxf_rtree_node_free
+(
+        DxfRTreeNode *node
+                /*!< R-tree node. */
+)
+{
+        int i;
+
+        if (node == NULL)
+        {
+                return;
+        }
+        if (node->level > 0)
+        {
+                for (i = 0; i < node->count; i++)
+                {
+                        dxf_rtree_node_free ((DxfRTreeNode *) node->entries[i].child);
+                }
+        }
+        free (node);
+}
+
+
+/*!
+ * \brief Compute the bounding box of all entries of a node.
+ */
+static void
+dxf_rtree_node_extents
+(
+        DxfRTreeNode *node,
+                /*!< R-tree node. */
+        DxfExtents *extents
+                /*!< Bounding box receiving the extents. */
+)
+{
+        int i;
+
+        dxf_extents_set_empty (extents);
+        for (i = 0; i < node->count; i++)
+        {
+                dxf_extents_add_extents (extents, &node->entries[i].extents);
+        }
+}
+
+
+/*!
+ * \brief Area of the XY projection of a bounding box.
+ */
+static double
+dxf_rtree_area
+(
+        DxfExtents *extents
+                /*!< Bounding box. */
+)
+{
+        return ((extents->max_x - extents->min_x)
+          * (extents->max_y - extents->min_y));
+}
+
+
+/*!
+ * \brief Area of the XY projection of the union of two bounding boxes.
+ */
+static double
+dxf_rtree_union_area
+(
+        DxfExtents *a,
+                /*!< First bounding box. */
+        DxfExtents *b
+                /*!< Second bounding box. */
+)
+{
+        DxfExtents u = *a;
+
+        dxf_extents_add_extents (&u, b);
+        return (dxf_rtree_area (&u));
+}
+
+
+/*!
+ * \brief Compare the X-values of the centers of two entries.
+ */
+static int
+dxf_rtree_compare_x
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfRTreeEntry *ea = (const DxfRTreeEntry *) a;
+        const DxfRTreeEntry *eb = (const DxfRTreeEntry *) b;
+        double ca = ea->extents.min_x + ea->extents.max_x;
+        double cb = eb->extents.min_x + eb->extents.max_x;
+
+        return ((ca < cb) ? -1 : ((ca > cb) ? 1 : 0));
+}
+
+
+/*!
+ * \brief Compare the Y-values of the centers of two entries.
+ */
+static int
+dxf_rtree_compare_y
+(
+        const void *a,
+        const void *b
+)
+{
+        const DxfRTreeEntry *ea = (const DxfRTreeEntry *) a;
+        const DxfRTreeEntry *eb = (const DxfRTreeEntry *) b;
+        double ca = ea->extents.min_y + ea->extents.max_y;
+        double cb = eb->extents.min_y + eb->extents.max_y;
+
+        return ((ca < cb) ? -1 : ((ca > cb) ? 1 : 0));
+}
+
+
+/*!
+ * \brief Pack one level of entries into nodes with the Sort-Tile-
+ * Recursive algorithm.
+ *
+ * The entries are sorted in place into vertical slices by the X-value
+ * of their centers, and every slice by the Y-value of their centers,
+ * before they are packed into full nodes.\n
+ * \c parents receives one entry for every node.\n
+ * When a node can not be allocated the nodes already made for this
+ * level are freed, the children they were given are still referred to
+ * by \c entries.
+ *
+ * \return the number of nodes, or \c -1 when no memory could be
+ * allocated.
+ */
+static int
+dxf_rtree_pack
+(
+        DxfRTreeEntry *entries,
+                /*!< Entries of the level to be packed. */
+        int number_of_entries,
+                /*!< Number of entries. */
+        int level,
+                /*!< Level of the nodes to be created. */
+        DxfRTreeEntry *parents
+                /*!< Array receiving the entries of the new nodes. */
+)
+{
+        DxfRTreeNode *node;
+        int number_of_nodes;
+        int number_of_slices;
+        int slice_size;
+        int slice;
+        int count;
+        int n;
+        int i;
+
+        number_of_nodes = (number_of_entries + DXF_RTREE_MAX_ENTRIES - 1) / DXF_RTREE_MAX_ENTRIES;
+        number_of_slices = (int) ceil (sqrt ((double) number_of_nodes));
+        slice_size = number_of_slices * DXF_RTREE_MAX_ENTRIES;
+        qsort (entries, number_of_entries, sizeof (DxfRTreeEntry), dxf_rtree_compare_x);
+        n = 0;
+        for (slice = 0; slice < number_of_entries; slice += slice_size)
+        {
+                count = number_of_entries - slice;
+                if (count > slice_size) count = slice_size;
+                qsort (entries + slice, count, sizeof (DxfRTreeEntry), dxf_rtree_compare_y);
+                for (i = 0; i < count; i += DXF_RTREE_MAX_ENTRIES)
+                {
+                        node = dxf_rtree_node_new (level);
+                        if (node == NULL)
+                        {
+                                while (n > 0)
+                                {
+                                        free (parents[--n].child);
+                                }
+                                return (-1);
+                        }
+                        node->count = count - i;
+                        if (node->count > DXF_RTREE_MAX_ENTRIES)
+                                node->count = DXF_RTREE_MAX_ENTRIES;
+                        memcpy (node->entries, entries + slice + i,
+                          node->count * sizeof (DxfRTreeEntry));
+                        dxf_rtree_node_extents (node, &parents[n].extents);
+                        parents[n].child = (struct DxfRTreeNode *) node;
+                        parents[n].entity = NULL;
+                        parents[n].type = 0;
+                        n++;
+                }
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Split an overflowing set of entries over two nodes with the
+ * quadratic split algorithm.
+ *
+ * \c node keeps the first group, \c sibling receives the second group.
+ */
+static void
+dxf_rtree_split
+(
+        DxfRTreeNode *node,
+                /*!< Node to be split, holds all entries but one. */
+        DxfRTreeEntry *extra,
+                /*!< Entry which did not fit in \c node. */
+        DxfRTreeNode *sibling
+                /*!< Empty node receiving the second group. */
+)
+{
+        DxfRTreeEntry all[DXF_RTREE_MAX_ENTRIES + 1];
+        int assigned[DXF_RTREE_MAX_ENTRIES + 1];
+        DxfExtents box[2];
+        DxfRTreeNode *group[2];
+        double worst;
+        double waste;
+        double d0;
+        double d1;
+        int total;
+        int remaining;
+        int seed0 = 0;
+        int seed1 = 1;
+        int best;
+        int g;
+        int i;
+        int j;
+
+        total = node->count + 1;
+        memcpy (all, node->entries, node->count * sizeof (DxfRTreeEntry));
+        all[node->count] = *extra;
+        /* Pick the pair of seeds wasting the most area together. */
+        worst = -DBL_MAX;
+        for (i = 0; i < total; i++)
+        {
+                for (j = i + 1; j < total; j++)
+                {
+                        waste = dxf_rtree_union_area (&all[i].extents, &all[j].extents)
+                          - dxf_rtree_area (&all[i].extents)
+                          - dxf_rtree_area (&all[j].extents);
+                        if (waste > worst)
+                        {
+                                worst = waste;
+                                seed0 = i;
+                                seed1 = j;
+                        }
+                }
+        }
+        memset (assigned, 0, sizeof (assigned));
+        group[0] = node;
+        group[1] = sibling;
+        node->count = 0;
+        sibling->count = 0;
+        group[0]->entries[group[0]->count++] = all[seed0];
+        group[1]->entries[group[1]->count++] = all[seed1];
+        box[0] = all[seed0].extents;
+        box[1] = all[seed1].extents;
+        assigned[seed0] = TRUE;
+        assigned[seed1] = TRUE;
+        remaining = total - 2;
+        while (remaining > 0)
+        {
+                /* Give the remaining entries to a group which needs them
+                 * to reach the minimum fill. */
+                for (g = 0; g < 2; g++)
+                {
+                        if (group[g]->count + remaining <= DXF_RTREE_MIN_ENTRIES)
+                        {
+                                break;
+                        }
+                }
+                if (g < 2)
+                {
+                        for (i = 0; i < total; i++)
+                        {
+                                if (!assigned[i])
+                                {
+                                        group[g]->entries[group[g]->count++] = all[i];
+                                        assigned[i] = TRUE;
+                                }
+                        }
+                        break;
+                }
+                /* Pick the entry with the strongest preference. */
+                best = -1;
+                worst = -1.0;
+                for (i = 0; i < total; i++)
+                {
+                        if (assigned[i]) continue;
+                        d0 = dxf_rtree_union_area (&box[0], &all[i].extents) - dxf_rtree_area (&box[0]);
+                        d1 = dxf_rtree_union_area (&box[1], &all[i].extents) - dxf_rtree_area (&box[1]);
+                        if (fabs (d0 - d1) > worst)
+                        {
+                                worst = fabs (d0 - d1);
+                                best = i;
+                        }
+                }
+                d0 = dxf_rtree_union_area (&box[0], &all[best].extents) - dxf_rtree_area (&box[0]);
+                d1 = dxf_rtree_union_area (&box[1], &all[best].extents) - dxf_rtree_area (&box[1]);
+                g = (d0 < d1) ? 0 : ((d1 < d0) ? 1 : (group[0]->count <= group[1]->count ? 0 : 1));
+                group[g]->entries[group[g]->count++] = all[best];
+                dxf_extents_add_extents (&box[g], &all[best].extents);
+                assigned[best] = TRUE;
+                remaining--;
+        }
+}
+
+
+/*!
+ * \brief Insert an entry at a level of the subtree of a node.
+ *
+ * \return the new sibling of \c node when it was split, \c node when
+ * the entry was inserted without a split, or \c NULL when no memory
+ * could be allocated.
+ */
+static DxfRTreeNode *
+dxf_rtree_node_insert
+(
+        DxfRTreeNode *node,
+                /*!< Root of the subtree. */
+        DxfRTreeEntry *entry,
+                /*!< Entry to be inserted. */
+        int level
+                /*!< Level of the node receiving the entry. */
+)
+{
+        DxfRTreeNode *child;
+        DxfRTreeNode *split;
+        DxfRTreeNode *sibling;
+        DxfRTreeEntry extra;
+        double enlargement;
+        double best_enlargement;
+        double area;
+        double best_area;
+        int best;
+        int i;
+
+        if (node->level > level)
+        {
+                /* Choose the child needing the least enlargement. */
+                best = 0;
+                best_enlargement = DBL_MAX;
+                best_area = DBL_MAX;
+                for (i = 0; i < node->count; i++)
+                {
+                        area = dxf_rtree_area (&node->entries[i].extents);
+                        enlargement = dxf_rtree_union_area (&node->entries[i].extents, &entry->extents) - area;
+                        if ((enlargement < best_enlargement)
+                          || ((enlargement == best_enlargement) && (area < best_area)))
+                        {
+                                best = i;
+                                best_enlargement = enlargement;
+                                best_area = area;
+                        }
+                }
+                child = (DxfRTreeNode *) node->entries[best].child;
+                split = dxf_rtree_node_insert (child, entry, level);
+                if (split == NULL)
+                {
+                        return (NULL);
+                }
+                dxf_rtree_node_extents (child, &node->entries[best].extents);
+                if (split == child)
+                {
+                        return (node);
+                }
+                dxf_rtree_node_extents (split, &extra.extents);
+                extra.child = (struct DxfRTreeNode *) split;
+                extra.entity = NULL;
+                extra.type = 0;
+                entry = &extra;
+        }
+        if (node->count < DXF_RTREE_MAX_ENTRIES)
+        {
+                node->entries[node->count++] = *entry;
+                return (node);
+        }
+        sibling = dxf_rtree_node_new (node->level);
+        if (sibling == NULL)
+        {
+                return (NULL);
+        }
+        extra = *entry;
+        dxf_rtree_split (node, &extra, sibling);
+        return (sibling);
+}
+
+
+/*!
+ * \brief Delete an entity from the subtree of a node.
+ *
+ * Nodes which become empty are removed from their parent.
+ *
+ * \return \c TRUE when the entity was found and deleted, \c FALSE
+ * otherwise.
+ */
+static int
+dxf_rtree_node_delete
+(
+        DxfRTreeNode *node,
+                /*!< Root of the subtree. */
+        DxfExtents *extents,
+                /*!< Bounding box of the entity when it was indexed. */
+        void *entity
+                /*!< Entity to be deleted. */
+)
+{
+        DxfRTreeNode *child;
+        int i;
+
+        for (i = 0; i < node->count; i++)
+        {
+                if (!dxf_extents_intersect (&node->entries[i].extents, extents))
+                {
+                        continue;
+                }
+                if (node->level == 0)
+                {
+                        if (node->entries[i].entity != entity)
+                        {
+                                continue;
+                        }
+                        node->entries[i] = node->entries[--node->count];
+                        return (TRUE);
+                }
+                child = (DxfRTreeNode *) node->entries[i].child;
+                if (dxf_rtree_node_delete (child, extents, entity))
+                {
+                        if (child->count == 0)
+                        {
+                                free (child);
+                                node->entries[i] = node->entries[--node->count];
+                        }
+                        else
+                        {
+                                dxf_rtree_node_extents (child, &node->entries[i].extents);
+                        }
+                        return (TRUE);
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Report the entities in the subtree of a node intersecting a
+ * window.
+ *
+ * \return \c TRUE when the callback stopped the query, \c FALSE
+ * otherwise.
+ */
+static int
+dxf_rtree_node_query
+(
+        DxfRTreeNode *node,
+                /*!< Root of the subtree. */
+        DxfExtents *window,
+                /*!< Query window. */
+        DxfRTreeCallback callback,
+                /*!< Callback receiving the entities found. */
+        void *data,
+                /*!< User data passed to \c callback. */
+        int *found
+                /*!< Number of entities found. */
+)
+{
+        int i;
+
+        for (i = 0; i < node->count; i++)
+        {
+                if (!dxf_extents_intersect (&node->entries[i].extents, window))
+                {
+                        continue;
+                }
+                if (node->level > 0)
+                {
+                        if (dxf_rtree_node_query ((DxfRTreeNode *) node->entries[i].child,
+                          window, callback, data, found))
+                        {
+                                return (TRUE);
+                        }
+                        continue;
+                }
+                (*found)++;
+                if ((callback != NULL)
+                  && (callback (node->entries[i].type, node->entries[i].entity, data) != 0))
+                {
+                        return (TRUE);
+                }
+        }
+        return (FALSE);
+}
+
+
+/*!
+ * \brief Squared distance in the XY plane from a point to a bounding
+ * box, \c 0 for points inside the box.
+ */
+static double
+dxf_rtree_distance2
+(
+        DxfExtents *extents,
+                /*!< Bounding box. */
+        double x,
+                /*!< X-value of the point. */
+        double y
+                /*!< Y-value of the point. */
+)
+{
+        double dx = 0.0;
+        double dy = 0.0;
+
+        if (x < extents->min_x) dx = extents->min_x - x;
+        else if (x > extents->max_x) dx = x - extents->max_x;
+        if (y < extents->min_y) dy = extents->min_y - y;
+        else if (y > extents->max_y) dy = y - extents->max_y;
+        return (dx * dx + dy * dy);
+}
+
+
+/*!
+ * \brief Allocate memory for an R-tree.
+ *
+ * Fill the memory contents with zeros.
+ */
+DxfRTree *
+dxf_rtree_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRTree *rtree = NULL;
+        size_t size;
+
+        size = sizeof (DxfRTree);
+        /* avoid malloc of 0 bytes */
+        if (size == 0) size = 1;
+        if ((rtree = malloc (size)) == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                rtree = NULL;
+        }
+        else
+        {
+                memset (rtree, 0, size);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (rtree);
+}
+
+
+/*!
+ * \brief Allocate memory and initialize data fields in an empty
+ * R-tree.
+ *
+ * \return \c NULL when no memory was allocated, a pointer to the
+ * allocated memory when successful.
+ */
+DxfRTree *
+dxf_rtree_init
+(
+        DxfRTree *rtree
+                /*!< R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                rtree = dxf_rtree_new ();
+        }
+        if (rtree == NULL)
+        {
+              fprintf (stderr,
+                (_("Error in %s () could not allocate memory.\n")),
+                __FUNCTION__);
+              return (NULL);
+        }
+        rtree->root = NULL;
+        rtree->number_of_entities = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (rtree);
+}
+
+
+/*!
+ * \brief Remove all entities from an R-tree.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_rtree_clear
+(
+        DxfRTree *rtree
+                /*!< R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_rtree_node_free (rtree->root);
+        rtree->root = NULL;
+        rtree->number_of_entities = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Free the allocated memory for an R-tree and all it's nodes.
+ *
+ * The indexed entities are not freed.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_rtree_free
+(
+        DxfRTree *rtree
+                /*!< Pointer to the memory occupied by the R-tree. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (rtree == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_rtree_node_free (rtree->root);
+        free (rtree);
+        rtree = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Replace the contents of an R-tree by a packed tree over a set
+ * of entities.
+ *
+ * The tree is built bottom up with the Sort-Tile-Recursive algorithm,
+ * which fills every node and keeps the overlap between nodes low, in
+ * O(n log n) time.\n
+ * The \c child members of \c entries are ignored, the array is
+ * reordered.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_rtree_bulk_load
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        DxfRTreeEntry *entries,
+                /*!< Entities with their bounding boxes. */
+        int number_of_entries
+                /*!< Number of entries. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRTreeEntry *level_entries;
+        DxfRTreeEntry *parents;
+        int number_of_entities_loaded;
+        int number_of_parents;
+        int level;
+        int i;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL) || ((entries == NULL) && (number_of_entries > 0)))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_rtree_clear (rtree);
+        if (number_of_entries <= 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        for (i = 0; i < number_of_entries; i++)
+        {
+                entries[i].child = NULL;
+        }
+        number_of_entities_loaded = number_of_entries;
+        level_entries = entries;
+        level = 0;
+        do
+        {
+                parents = malloc (((number_of_entries + DXF_RTREE_MAX_ENTRIES - 1)
+                  / DXF_RTREE_MAX_ENTRIES) * sizeof (DxfRTreeEntry));
+                if (parents == NULL)
+                {
+                        number_of_parents = -1;
+                }
+                else
+                {
+                        number_of_parents = dxf_rtree_pack (level_entries,
+                          number_of_entries, level, parents);
+                }
+                if (number_of_parents < 0)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        /* Clean up the nodes of the lower levels, the
+                         * entities are not ours. */
+                        if (level_entries != entries)
+                        {
+                                for (i = 0; i < number_of_entries; i++)
+                                {
+                                        dxf_rtree_node_free ((DxfRTreeNode *) level_entries[i].child);
+                                }
+                                free (level_entries);
+                        }
+                        free (parents);
+                        return (EXIT_FAILURE);
+                }
+                if (level_entries != entries)
+                {
+                        free (level_entries);
+                }
+                level_entries = parents;
+                number_of_entries = number_of_parents;
+                level++;
+        }
+        while (number_of_entries > 1);
+        rtree->root = (DxfRTreeNode *) level_entries[0].child;
+        free (level_entries);
+        rtree->number_of_entities = number_of_entities_loaded;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Insert an entity into an R-tree.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_rtree_insert
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        DxfExtents *extents,
+                /*!< Bounding box of the entity. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRTreeEntry entry;
+        DxfRTreeNode *split;
+        DxfRTreeNode *root;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL) || (extents == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (rtree->root == NULL)
+        {
+                rtree->root = dxf_rtree_node_new (0);
+                if (rtree->root == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        entry.extents = *extents;
+        entry.child = NULL;
+        entry.entity = entity;
+        entry.type = type;
+        split = dxf_rtree_node_insert (rtree->root, &entry, 0);
+        if (split == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (split != rtree->root)
+        {
+                /* The root was split, grow the tree by one level. */
+                root = dxf_rtree_node_new (rtree->root->level + 1);
+                if (root == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                dxf_rtree_node_extents (rtree->root, &root->entries[0].extents);
+                root->entries[0].child = (struct DxfRTreeNode *) rtree->root;
+                root->entries[0].entity = NULL;
+                dxf_rtree_node_extents (split, &root->entries[1].extents);
+                root->entries[1].child = (struct DxfRTreeNode *) split;
+                root->entries[1].entity = NULL;
+                root->count = 2;
+                rtree->root = root;
+        }
+        rtree->number_of_entities++;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Delete an entity from an R-tree.
+ *
+ * \c extents has to intersect the bounding box with which the entity
+ * was indexed, only the branches intersecting it are searched.\n
+ * Nodes are not rebalanced, empty nodes are removed and a root with a
+ * single child is replaced by that child.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * was not found or an error occurred.
+ */
+int
+dxf_rtree_delete
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        DxfExtents *extents,
+                /*!< Bounding box of the entity when it was indexed. */
+        void *entity
+                /*!< Entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRTreeNode *root;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL) || (extents == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((rtree->root == NULL)
+          || (!dxf_rtree_node_delete (rtree->root, extents, entity)))
+        {
+                return (EXIT_FAILURE);
+        }
+        rtree->number_of_entities--;
+        while ((rtree->root->level > 0) && (rtree->root->count == 1))
+        {
+                root = (DxfRTreeNode *) rtree->root->entries[0].child;
+                free (rtree->root);
+                rtree->root = root;
+        }
+        if (rtree->root->count == 0)
+        {
+                free (rtree->root);
+                rtree->root = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Find the entities with a bounding box intersecting a window.
+ *
+ * For a 2D query use a window spanning all Z-values.
+ *
+ * \return the number of entities found, or \c -1 when an error
+ * occurred.
+ */
+int
+dxf_rtree_query_window
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        DxfExtents *window,
+                /*!< Query window. */
+        DxfRTreeCallback callback,
+                /*!< Callback receiving the entities found, \c NULL
+                 * only counts them. */
+        void *data
+                /*!< User data passed to \c callback. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        int found = 0;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL) || (window == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if (rtree->root != NULL)
+        {
+                dxf_rtree_node_query (rtree->root, window, callback, data, &found);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (found);
+}
+
+
+/*!
+ * \brief Find the entities with a bounding box containing a point.
+ *
+ * \return the number of entities found, or \c -1 when an error
+ * occurred.
+ */
+int
+dxf_rtree_query_point
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        double z,
+                /*!< Z-value of the point. */
+        DxfRTreeCallback callback,
+                /*!< Callback receiving the entities found, \c NULL
+                 * only counts them. */
+        void *data
+                /*!< User data passed to \c callback. */
+)
+{
+        DxfExtents window;
+
+        window.min_x = window.max_x = x;
+        window.min_y = window.max_y = y;
+        window.min_z = window.max_z = z;
+        return (dxf_rtree_query_window (rtree, &window, callback, data));
+}
+
+
+/*!
+ * \brief Find the \c k entities with a bounding box nearest to a point
+ * in the XY plane.
+ *
+ * The tree is searched best first, visiting nodes in order of their
+ * distance to the point, so only the branches which can hold one of
+ * the \c k nearest entities are visited.\n
+ * The results are sorted by increasing distance.
+ *
+ * \return the number of entities found, at most \c k, or \c -1 when an
+ * error occurred.
+ */
+int
+dxf_rtree_query_nearest
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        double x,
+                /*!< X-value of the point. */
+        double y,
+                /*!< Y-value of the point. */
+        int k,
+                /*!< Number of entities to be found. */
+        DxfEntityType *types,
+                /*!< Array of \c k types receiving the types of the
+                 * entities found, may be \c NULL. */
+        void **entities,
+                /*!< Array of \c k pointers receiving the entities
+                 * found. */
+        double *distances
+                /*!< Array of \c k distances receiving the distances
+                 * from the point to the bounding boxes, may be
+                 * \c NULL. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRTreeEntry *heap = NULL;
+        double *keys = NULL;
+        DxfRTreeEntry top;
+        DxfRTreeEntry swap_entry;
+        DxfRTreeNode *node;
+        double swap_key;
+        double top_key;
+        int heap_size = 0;
+        int heap_capacity = 0;
+        int found = 0;
+        int parent;
+        int child;
+        int i;
+
+        /* Do some basic checks. */
+        if ((rtree == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (-1);
+        }
+        if ((rtree->root == NULL) || (k <= 0))
+        {
+                return (0);
+        }
+        /* The heap holds entries of nodes and entities, keyed on the
+         * squared distance to their bounding box.  A node is pushed as
+         * an entry with it's child set and no entity. */
+        top.child = (struct DxfRTreeNode *) rtree->root;
+        top.entity = NULL;
+        top_key = 0.0;
+        for (;;)
+        {
+                if (top.entity != NULL)
+                {
+                        /* No node or entity left on the heap is nearer. */
+                        if (types != NULL) types[found] = top.type;
+                        entities[found] = top.entity;
+                        if (distances != NULL) distances[found] = sqrt (top_key);
+                        if (++found == k) break;
+                }
+                else
+                {
+                        node = (DxfRTreeNode *) top.child;
+                        if (heap_size + node->count > heap_capacity)
+                        {
+                                DxfRTreeEntry *new_heap;
+                                double *new_keys;
+
+                                heap_capacity = 2 * (heap_size + node->count);
+                                new_heap = realloc (heap, heap_capacity * sizeof (DxfRTreeEntry));
+                                if (new_heap != NULL) heap = new_heap;
+                                new_keys = realloc (keys, heap_capacity * sizeof (double));
+                                if (new_keys != NULL) keys = new_keys;
+                                if ((new_heap == NULL) || (new_keys == NULL))
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        free (heap);
+                                        free (keys);
+                                        return (-1);
+                                }
+                        }
+                        for (i = 0; i < node->count; i++)
+                        {
+                                /* Sift up. */
+                                child = heap_size++;
+                                heap[child] = node->entries[i];
+                                keys[child] = dxf_rtree_distance2 (&node->entries[i].extents, x, y);
+                                while (child > 0)
+                                {
+                                        parent = (child - 1) / 2;
+                                        if (keys[parent] <= keys[child]) break;
+                                        swap_entry = heap[parent]; heap[parent] = heap[child]; heap[child] = swap_entry;
+                                        swap_key = keys[parent]; keys[parent] = keys[child]; keys[child] = swap_key;
+                                        child = parent;
+                                }
+                        }
+                }
+                if (heap_size == 0)
+                {
+                        break;
+                }
+                /* Pop the nearest entry and sift down. */
+                top = heap[0];
+                top_key = keys[0];
+                heap_size--;
+                heap[0] = heap[heap_size];
+                keys[0] = keys[heap_size];
+                parent = 0;
+                for (;;)
+                {
+                        child = 2 * parent + 1;
+                        if (child >= heap_size) break;
+                        if ((child + 1 < heap_size) && (keys[child + 1] < keys[child])) child++;
+                        if (keys[parent] <= keys[child]) break;
+                        swap_entry = heap[parent]; heap[parent] = heap[child]; heap[child] = swap_entry;
+                        swap_key = keys[parent]; keys[parent] = keys[child]; keys[child] = swap_key;
+                        parent = child;
+                }
+        }
+        free (heap);
+        free (keys);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (found);
+}
+
+
+/* EOF */
@@ -0,0 +1,138 @@
+/*!
+ * \file rtree.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for a libDXF R-tree over entity bounding boxes.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_RTREE_H
+#define LIBDXF_SRC_RTREE_H
+
+
+#include <float.h>
+#include <math.h>
+#include "global.h"
+#include "entity.h"
+#include "extents.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DXF_RTREE_MAX_ENTRIES 16
+        /*!< \brief Maximum number of entries in a node of an R-tree. */
+
+
+/*!
+ * \brief libDXF definition of an entry in a node of an R-tree.
+ *
+ * Entries of leaf nodes refer to an entity, entries of internal nodes
+ * refer to a child node.
+ */
+typedef struct
+dxf_rtree_entry_struct
+{
+        DxfExtents extents;
+                /*!< Bounding box of the entity or child node. */
+        struct DxfRTreeNode *child;
+                /*!< Child node, \c NULL in leaf nodes. */
+        void *entity;
+                /*!< Entity, \c NULL in internal nodes. */
+        DxfEntityType type;
+                /*!< Type of the entity. */
+} DxfRTreeEntry;
+
+
+/*!
+ * \brief libDXF definition of a node of an R-tree.
+ */
+typedef struct
+dxf_rtree_node_struct
+{
+        int level;
+                /*!< Height of the node above the leaves, \c 0 for a
+                 * leaf node. */
+        int count;
+                /*!< Number of used entries. */
+        DxfRTreeEntry entries[DXF_RTREE_MAX_ENTRIES];
+                /*!< Entries of the node. */
+} DxfRTreeNode;
+
+
+/*!
+ * \brief libDXF definition of an R-tree over the bounding boxes of
+ * entities.
+ */
+typedef struct
+dxf_rtree_struct
+{
+        DxfRTreeNode *root;
+                /*!< Root node, \c NULL for an empty tree. */
+        int number_of_entities;
+                /*!< Number of indexed entities. */
+} DxfRTree;
+
+
+/*!
+ * \brief Callback receiving the entities found by a query.
+ *
+ * \return \c 0 to continue the query, any other value to stop it.
+ */
+typedef int (*DxfRTreeCallback)
+(
+        DxfEntityType type,
+        void *entity,
+        void *data
+);
+
+
+DxfRTree *dxf_rtree_new ();
+DxfRTree *dxf_rtree_init (DxfRTree *rtree);
+int dxf_rtree_free (DxfRTree *rtree);
+int dxf_rtree_clear (DxfRTree *rtree);
+int dxf_rtree_bulk_load (DxfRTree *rtree, DxfRTreeEntry *entries, int number_of_entries);
+int dxf_rtree_insert (DxfRTree *rtree, DxfExtents *extents, DxfEntityType type, void *entity);
+int dxf_rtree_delete (DxfRTree *rtree, DxfExtents *extents, void *entity);
+int dxf_rtree_query_window (DxfRTree *rtree, DxfExtents *window, DxfRTreeCallback callback, void *data);
+int dxf_rtree_query_point (DxfRTree *rtree, double x, double y, double z, DxfRTreeCallback callback, void *data);
+int dxf_rtree_query_nearest (DxfRTree *rtree, double x, double y, int k, DxfEntityType *types, void **entities, double *distances);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_RTREE_H */
+
+
+/* EOF */
@@ -38,6 +38,7 @@
 
 
 #include "section.h"
+#include "drawing.h"
 
 
 /*!
@@ -54,9 +55,10 @@ dxf_section_read
         DXF_DEBUG_BEGIN
 #endif
         char temp_string[DXF_MAX_STRING_LENGTH];
-        DxfHeader dxf_header;
-        DxfBlock dxf_block;
-        char *dxf_entities_list = NULL;
+        DxfHeader *dxf_header = NULL;
+        DxfBlock *dxf_blocks = NULL;
+        DxfEntities *dxf_entities = NULL;
+        DxfThumbnail *dxf_thumbnail = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -77,7 +79,35 @@ dxf_section_read
                         if (strcmp (temp_string, "HEADER") == 0)
                         {
                                 /* We have found the begin of the HEADER section. */
-                                dxf_header_read (fp, &dxf_header);
+                                dxf_header = dxf_header_new ();
+                                if (dxf_header == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory for a DxfHeader struct.\n")),
+                                          __FUNCTION__);
+                                        return (EXIT_FAILURE);
+                                }
+                                dxf_header_read (fp, dxf_header);
+                                /* Let the entity readers follow the
+                                 * version of the file being read. */
+                                if (dxf_header->_AcadVer > 0)
+                                {
+                                        fp->acad_version_number = dxf_header->_AcadVer;
+                                }
+                                if (fp->drawing != NULL)
+                                {
+                                        /* Hand the header over to the
+                                         * drawing. */
+                                        if (((DxfDrawing *) fp->drawing)->header != NULL)
+                                        {
+                                                dxf_header_free ((DxfHeader *) ((DxfDrawing *) fp->drawing)->header);
+                                        }
+                                        dxf_drawing_set_header ((DxfDrawing *) fp->drawing, dxf_header);
+                                }
+                                else
+                                {
+                                        dxf_header_free (dxf_header);
+                                }
                         }
                         else if (strcmp (temp_string, "CLASSES") == 0)
                         {
@@ -92,38 +122,77 @@ dxf_section_read
                         else if (strcmp (temp_string, "BLOCKS") == 0)
                         {
                                 /* We have found the begin of the BLOCKS sction. */
-
-                                /*! \todo Experimental usage of block_read */
-//                                dxf_read_blocks
-//                                (
-//                                        fp->fp,
-//                                        &dxf_blocks_list,
-//                                        dxf_header._AcadVer
-//                                );
+                                dxf_blocks = dxf_block_read_table (fp);
+                                if ((dxf_blocks != NULL)
+                                  && (fp->drawing != NULL))
+                                {
+                                        /* Hand the block definitions
+                                         * over to the drawing. */
+                                        if (((DxfDrawing *) fp->drawing)->block_list != NULL)
+                                        {
+                                                dxf_block_free_list ((DxfBlock *) ((DxfDrawing *) fp->drawing)->block_list);
+                                        }
+                                        dxf_drawing_set_block_list ((DxfDrawing *) fp->drawing, dxf_blocks);
+                                }
+                                else if (dxf_blocks != NULL)
+                                {
+                                        dxf_block_free_list (dxf_blocks);
+                                }
+                                dxf_blocks = NULL;
                         }
                         else if (strcmp (temp_string, "ENTITIES") == 0)
                         {
                                 /* We have found the begin of the ENTITIES sction. */
-                                dxf_entities_read_table (fp->filename,
-                                                   fp->fp,
-                                                   fp->line_number,
-                                                   dxf_entities_list,
-                                                   dxf_header._AcadVer);                        }
+                                dxf_entities = dxf_entities_read (fp, dxf_entities_new ());
+                                if ((dxf_entities != NULL)
+                                  && (fp->drawing != NULL))
+                                {
+                                        /* Hand the entities over to the
+                                         * drawing. */
+                                        if (((DxfDrawing *) fp->drawing)->entities_list != NULL)
+                                        {
+                                                dxf_entities_free ((DxfEntities *) ((DxfDrawing *) fp->drawing)->entities_list);
+                                        }
+                                        dxf_drawing_set_entities_list ((DxfDrawing *) fp->drawing, dxf_entities);
+                                }
+                                else if (dxf_entities != NULL)
+                                {
+                                        dxf_entities_free (dxf_entities);
+                                }
+                                dxf_entities = NULL;
+                        }
                         else if (strcmp (temp_string, "OBJECTS") == 0)
                         {
                                 /* We have found the begin of the OBJECTS sction. */
                                 /*! \todo Invoke a function for parsing the \c OBJECTS section. */ 
                         }
-                        else if (strcmp (temp_string, "THUMBNAIL") == 0)
+                        else if (strcmp (temp_string, "THUMBNAILIMAGE") == 0)
                         {
-                                /* We have found the begin of the THUMBNAIL sction. */
-                                /*! \todo Invoke a function for parsing the \c THUMBNAIL section. */ 
+                                /* We have found the begin of the THUMBNAILIMAGE sction. */
+                                dxf_thumbnail = dxf_thumbnail_read (fp, dxf_thumbnail_new ());
+                                if ((dxf_thumbnail != NULL)
+                                  && (fp->drawing != NULL))
+                                {
+                                        /* Hand the thumbnail over to
+                                         * the drawing. */
+                                        if (((DxfDrawing *) fp->drawing)->thumbnail != NULL)
+                                        {
+                                                dxf_thumbnail_free ((DxfThumbnail *) ((DxfDrawing *) fp->drawing)->thumbnail);
+                                        }
+                                        dxf_drawing_set_thumbnail ((DxfDrawing *) fp->drawing, dxf_thumbnail);
+                                }
+                                else if (dxf_thumbnail != NULL)
+                                {
+                                        dxf_thumbnail_free (dxf_thumbnail);
+                                }
+                                dxf_thumbnail = NULL;
                         }
                 }
         }
         else
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                   (_("Warning in %s () unexpected string encountered while reading line %d from: %s.\n")),
                   __FUNCTION__, fp->line_number, fp->filename);
         }
@@ -44,6 +44,7 @@
 #include "header.h"
 #include "util.h"
 #include "block.h"
+#include "thumbnail.h"
 
 
 #ifdef __cplusplus
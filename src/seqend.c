@@ -42,6 +42,7 @@
 
 
 #include "seqend.h"
+#include "util.h"
 
 
 /*!
@@ -125,8 +126,8 @@ dxf_seqend_init
         seqend->paperspace = DXF_MODELSPACE;
         seqend->graphics_data_size = 0;
         seqend->shadow_mode = 0;
-        seqend->binary_graphics_data = dxf_binary_graphics_data_new ();
-        seqend->binary_graphics_data = dxf_binary_graphics_data_init (seqend->binary_graphics_data);
+        seqend->binary_graphics_data = dxf_binary_data_new ();
+        seqend->binary_graphics_data = dxf_binary_data_init (seqend->binary_graphics_data);
         seqend->dictionary_owner_soft = strdup ("");
         seqend->material = strdup ("");
         seqend->dictionary_owner_hard = strdup ("");
@@ -166,7 +167,7 @@ dxf_seqend_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -174,20 +175,34 @@ dxf_seqend_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (seqend == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 seqend = dxf_seqend_init (seqend);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (seqend->binary_graphics_data == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                seqend->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                if (seqend->binary_graphics_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -195,16 +210,13 @@ dxf_seqend_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing an application
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->app_name);
+                        dxf_read_string (&seqend->app_name, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -217,14 +229,12 @@ dxf_seqend_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->linetype);
+                        dxf_read_string (&seqend->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->layer);
+                        dxf_read_string (&seqend->layer, fp);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -280,11 +290,11 @@ dxf_seqend_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "AcDbEntity") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -300,31 +310,26 @@ dxf_seqend_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) seqend->binary_graphics_data->next);
-                        seqend->binary_graphics_data = (DxfBinaryGraphicsData *) seqend->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, seqend->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_soft);
+                        dxf_read_string (&seqend->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->material);
+                        dxf_read_string (&seqend->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->dictionary_owner_hard);
+                        dxf_read_string (&seqend->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -337,8 +342,7 @@ dxf_seqend_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->plot_style_name);
+                        dxf_read_string (&seqend->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -350,8 +354,7 @@ dxf_seqend_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, seqend->color_name);
+                        dxf_read_string (&seqend->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -363,16 +366,20 @@ dxf_seqend_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (seqend->linetype, "") == 0)
@@ -383,8 +390,6 @@ dxf_seqend_read
         {
                 seqend->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -544,13 +549,7 @@ dxf_seqend_write
 #endif
                 if (seqend->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) seqend->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_data_write (fp, seqend->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -601,7 +600,10 @@ dxf_seqend_free
         }
         free (seqend->linetype);
         free (seqend->layer);
-        dxf_binary_graphics_data_free_list (seqend->binary_graphics_data);
+        if (seqend->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (seqend->binary_graphics_data);
+        }
         free (seqend->dictionary_owner_soft);
         free (seqend->material);
         free (seqend->dictionary_owner_hard);
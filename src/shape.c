@@ -42,6 +42,7 @@
 
 
 #include "shape.h"
+#include "util.h"
 
 
 /*!
@@ -125,8 +126,8 @@ dxf_shape_init
         shape->paperspace = DXF_MODELSPACE;
         shape->graphics_data_size = 0;
         shape->shadow_mode = 0;
-        shape->binary_graphics_data = dxf_binary_graphics_data_new ();
-        shape->binary_graphics_data = dxf_binary_graphics_data_init (shape->binary_graphics_data);
+        shape->binary_graphics_data = dxf_binary_data_new ();
+        shape->binary_graphics_data = dxf_binary_data_init (shape->binary_graphics_data);
         shape->dictionary_owner_soft = strdup ("");
         shape->material = strdup ("");
         shape->dictionary_owner_hard = strdup ("");
@@ -136,9 +137,6 @@ dxf_shape_init
         shape->color_name = strdup ("");
         shape->transparency = 0;
         shape->shape_name = strdup ("");
-        shape->p0->x0 = 0.0;
-        shape->p0->y0 = 0.0;
-        shape->p0->z0 = 0.0;
         shape->size = 0.0;
         shape->rel_x_scale = 0.0;
         shape->rot_angle = 0.0;
@@ -146,6 +144,7 @@ dxf_shape_init
         shape->extr_x0 = 0.0;
         shape->extr_y0 = 0.0;
         shape->extr_z0 = 0.0;
+        shape->p0 = NULL;
         shape->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -176,7 +175,7 @@ dxf_shape_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         char *dxf_entity_name = strdup ("SHAPE");
 
         /* Do some basic checks. */
@@ -185,20 +184,49 @@ dxf_shape_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (shape == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 shape = dxf_shape_init (shape);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (shape->binary_graphics_data == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                shape->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                if (shape->binary_graphics_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (shape->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                shape->p0 = dxf_point_init (dxf_point_new ());
+                if (shape->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -206,16 +234,13 @@ dxf_shape_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a shape
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->shape_name);
+                        dxf_read_string (&shape->shape_name, fp);
                 }
                 else if (strcmp (temp_string, "5") == 0)
                 {
@@ -228,14 +253,12 @@ dxf_shape_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->linetype);
+                        dxf_read_string (&shape->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->layer);
+                        dxf_read_string (&shape->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -340,12 +363,12 @@ dxf_shape_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbShape") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -382,31 +405,26 @@ dxf_shape_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) shape->binary_graphics_data->next);
-                        shape->binary_graphics_data = (DxfBinaryGraphicsData *) shape->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, shape->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->dictionary_owner_soft);
+                        dxf_read_string (&shape->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->material);
+                        dxf_read_string (&shape->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->dictionary_owner_hard);
+                        dxf_read_string (&shape->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -419,8 +437,7 @@ dxf_shape_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->plot_style_name);
+                        dxf_read_string (&shape->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -432,8 +449,7 @@ dxf_shape_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, shape->color_name);
+                        dxf_read_string (&shape->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -445,16 +461,20 @@ dxf_shape_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (shape->shape_name, "") == 0)
@@ -472,8 +492,6 @@ dxf_shape_read
         {
                 shape->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -646,13 +664,7 @@ dxf_shape_write
 #endif
                 if (shape->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = (DxfBinaryGraphicsData *) shape->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_data_write (fp, shape->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -744,7 +756,10 @@ dxf_shape_free
         }
         free (shape->linetype);
         free (shape->layer);
-        dxf_binary_graphics_data_free_list (shape->binary_graphics_data);
+        if (shape->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (shape->binary_graphics_data);
+        }
         free (shape->dictionary_owner_soft);
         free (shape->material);
         free (shape->dictionary_owner_hard);
@@ -785,6 +800,7 @@ dxf_shape_free_list
         while (shapes != NULL)
         {
                 DxfShape *iter = (DxfShape *) shapes->next;
+                shapes->next = NULL;
                 dxf_shape_free (shapes);
                 shapes = (DxfShape *) iter;
         }
@@ -3225,9 +3241,6 @@ dxf_shape_get_last
         }
         if (shape->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfShape *) shape);
         }
         DxfShape *iter = (DxfShape *) shape->next;
@@ -0,0 +1,148 @@
+/*!
+ * \file simd.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Functions for the detection and selection of the SIMD
+ * instruction sets used by the libDXF kernels.
+ *
+ * The kernels in clash.c and binary_data.c dispatch on dxf_simd_get ().
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include "simd.h"
+
+
+static int dxf_simd_supported = -1;
+        /*!< \brief Best instruction set supported by the processor,
+         * -1 until detected. */
+static int dxf_simd_active = -1;
+        /*!< \brief Instruction set in use, -1 until the first call. */
+
+
+/*!
+ * \brief Best instruction set supported by the running processor.
+ */
+static int
+dxf_simd_detect ()
+{
+#ifdef DXF_SIMD_X86
+        __builtin_cpu_init ();
+        if (__builtin_cpu_supports ("avx2"))
+                return (DXF_SIMD_AVX2);
+        if (__builtin_cpu_supports ("sse2"))
+                return (DXF_SIMD_SSE2);
+#endif
+        return (DXF_SIMD_NONE);
+}
+
+
+/*!
+ * \brief Get the best SIMD instruction set supported by the processor.
+ *
+ * The processor is queried on the first call, threads racing on the
+ * first call all store the same result.
+ *
+ * \return one of the \c DxfSimd values.
+ */
+int
+dxf_simd_get_supported ()
+{
+        int supported;
+
+        supported = __atomic_load_n (&dxf_simd_supported, __ATOMIC_ACQUIRE);
+        if (supported < 0)
+        {
+                supported = dxf_simd_detect ();
+                __atomic_store_n (&dxf_simd_supported, supported, __ATOMIC_RELEASE);
+        }
+        return (supported);
+}
+
+
+/*!
+ * \brief Get the SIMD instruction set used by the kernels.
+ *
+ * Until dxf_simd_set () is called this is the best instruction set
+ * supported by the processor.
+ *
+ * \return one of the \c DxfSimd values.
+ */
+int
+dxf_simd_get ()
+{
+        int simd;
+        int unset = -1;
+
+        simd = __atomic_load_n (&dxf_simd_active, __ATOMIC_ACQUIRE);
+        if (simd < 0)
+        {
+                simd = dxf_simd_get_supported ();
+                /* Keep the value of a concurrent dxf_simd_set (). */
+                if (!__atomic_compare_exchange_n (&dxf_simd_active, &unset,
+                  simd, FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                {
+                        simd = unset;
+                }
+        }
+        return (simd);
+}
+
+
+/*!
+ * \brief Set the SIMD instruction set used by the kernels.
+ *
+ * Requests for an instruction set the processor does not support fall
+ * back to the best supported one, \c DXF_SIMD_NONE forces the scalar
+ * code.\n
+ * Kernels running in other threads finish with the instruction set they
+ * started with.
+ *
+ * \return the instruction set now in use.
+ */
+int
+dxf_simd_set
+(
+        int simd
+                /*!< One of the \c DxfSimd values. */
+)
+{
+        int supported;
+
+        supported = dxf_simd_get_supported ();
+        if ((simd < DXF_SIMD_NONE) || (simd > supported))
+        {
+                simd = supported;
+        }
+        __atomic_store_n (&dxf_simd_active, simd, __ATOMIC_RELEASE);
+        return (simd);
+}
+
+
+/* EOF */
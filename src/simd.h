@@ -0,0 +1,84 @@
+/*!
+ * \file simd.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the detection and selection of the SIMD
+ * instruction sets used by the libDXF kernels.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#ifndef LIBDXF_SRC_SIMD_H
+#define LIBDXF_SRC_SIMD_H
+
+
+#include "global.h"
+
+
+#if (defined (__GNUC__) || defined (__clang__)) && (defined (__x86_64__) || defined (__i386__))
+#  define DXF_SIMD_X86 1
+        /*!< \brief SIMD kernels for x86 processors are compiled in. */
+#  include <immintrin.h>
+#endif
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief SIMD instruction sets used by the libDXF kernels.
+ */
+typedef enum
+dxf_simd_enum
+{
+        DXF_SIMD_NONE = 0,
+                /*!< Portable scalar code. */
+        DXF_SIMD_SSE2 = 1,
+                /*!< SSE2, 128 bit vectors. */
+        DXF_SIMD_AVX2 = 2
+                /*!< AVX2, 256 bit vectors. */
+} DxfSimd;
+
+
+int dxf_simd_get_supported ();
+int dxf_simd_get ();
+int dxf_simd_set (int simd);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_SIMD_H */
+
+
+/* EOF */
@@ -125,7 +125,7 @@ dxf_sortentstable_init
         sortentstable->dictionary_owner_hard = strdup ("");
         sortentstable->block_owner = strdup ("");
         sortentstable->entity_owner = dxf_char_init (sortentstable->entity_owner);
-        sortentstable->sort_handle->value = 0;
+        sortentstable->sort_handle = NULL;
         sortentstable->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -157,7 +157,7 @@ dxf_sortentstable_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         int j;
         int k;
@@ -170,19 +170,19 @@ dxf_sortentstable_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (sortentstable == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 sortentstable = dxf_sortentstable_init (sortentstable);
@@ -192,17 +192,15 @@ dxf_sortentstable_read
         k = 0;
         iter_5 = (DxfInt *) sortentstable->sort_handle;
         iter_331 = (DxfChar *) sortentstable->entity_owner;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -214,7 +212,7 @@ dxf_sortentstable_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", (uint *) &sortentstable->id_code);
                 }
-                if ((strcmp (temp_string, "5") == 0)
+                else if ((strcmp (temp_string, "5") == 0)
                   && (i > 0))
                 {
                         /* Now follows a string containing a Sort handle
@@ -229,11 +227,11 @@ dxf_sortentstable_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "AcDbSortentsTable") != 0)
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -243,8 +241,7 @@ dxf_sortentstable_read
                 {
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->dictionary_owner_soft);
+                        dxf_read_string (&sortentstable->dictionary_owner_soft, fp);
                         j++;
                 }
                 else if ((strcmp (temp_string, "330") == 0)
@@ -253,8 +250,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing a soft pointer
                          * ID/handle to owner (currently only the
                          * *MODEL_SPACE or *PAPER_SPACE blocks). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->block_owner);
+                        dxf_read_string (&sortentstable->block_owner, fp);
                         j++;
                         /*! \todo Check for overrun of array index. */
                 }
@@ -263,8 +259,7 @@ dxf_sortentstable_read
                         /* Now follows a string containing a soft pointer
                          * ID/handle to an entity (zero or more entries
                          * may exist). */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter_331->value);
+                        dxf_read_string (&iter_331->value, fp);
                         iter_331->next = (struct DxfChar *) dxf_char_init ((DxfChar *) iter_331->next);
                         iter_331 = (DxfChar *) iter_331->next;
                 }
@@ -272,25 +267,26 @@ dxf_sortentstable_read
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, sortentstable->dictionary_owner_hard);
+                        dxf_read_string (&sortentstable->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -477,6 +473,7 @@ dxf_sortentstable_free_list
         while (sortentstables != NULL)
         {
                 DxfSortentsTable *iter = (DxfSortentsTable *) sortentstables->next;
+                sortentstables->next = NULL;
                 dxf_sortentstable_free (sortentstables);
                 sortentstables = (DxfSortentsTable *) iter;
         }
@@ -920,9 +917,6 @@ dxf_sortentstable_get_last_entity_owner
         }
         if (entity_owner->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfChar *) entity_owner);
         }
         DxfChar *iter = (DxfChar *) entity_owner->next;
@@ -1406,9 +1400,6 @@ dxf_sortentstable_get_last_sort_handle
         }
         if (sort_handle->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfInt *) sort_handle);
         }
         DxfInt *iter = (DxfInt *) sort_handle->next;
@@ -1531,9 +1522,6 @@ dxf_sortentstable_get_last
         }
         if (sortentstable->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfSortentsTable *) sortentstable);
         }
         DxfSortentsTable *iter = (DxfSortentsTable *) sortentstable->next;
@@ -99,8 +99,6 @@ dxf_spatial_index_init
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        time_t now;
-
         /* Do some basic checks. */
         if (spatial_index == NULL)
         {
@@ -119,19 +117,8 @@ dxf_spatial_index_init
         spatial_index->id_code = 0;
         spatial_index->dictionary_owner_soft = strdup ("");
         spatial_index->dictionary_owner_hard = strdup ("");
-        if (time (&now) != (time_t)(-1))
-        {
-                float fraction_day;
-                int JD;
-                struct tm *current_time = localtime (&now);
-
-                /* Transform the current local gregorian date in a julian date.*/
-                JD = current_time->tm_mday - 32075 + 1461 * (current_time->tm_year + 6700 + (current_time->tm_mon - 13) / 12) / 4 + 367 * (current_time->tm_mon - 1 - (current_time->tm_mon - 13) / 12 * 12) / 12 - 3 * ((current_time->tm_year + 6800 + (current_time->tm_mon - 13) / 12) / 100) / 4;
-                /* Transform the current local clock time in fraction of day.*/
-                fraction_day = (current_time->tm_hour + (current_time->tm_min / 60.0) + (current_time->tm_sec / 3600.0)) / 24.0;
-                spatial_index->time_stamp = (double) (JD + fraction_day);
-        }
-        else spatial_index->time_stamp = 0.0;
+        spatial_index->time_stamp = dxf_julian_date_now ();
+        spatial_index->rtree = NULL;
         spatial_index->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -163,7 +150,7 @@ dxf_spatial_index_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -171,34 +158,32 @@ dxf_spatial_index_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_14)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (spatial_index == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spatial_index = dxf_spatial_index_init (spatial_index);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -209,7 +194,7 @@ dxf_spatial_index_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%x\n", (uint *) &spatial_index->id_code);
                 }
-                if (strcmp (temp_string, "40") == 0)
+                else if (strcmp (temp_string, "40") == 0)
                 {
                         /* Now follows a string containing a timestamp
                          * (Julian date). */
@@ -221,12 +206,12 @@ dxf_spatial_index_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbIndex") != 0)
                           && (strcmp (temp_string, "AcDbSpatialIndex") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -235,32 +220,32 @@ dxf_spatial_index_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_index->dictionary_owner_soft);
+                        dxf_read_string (&spatial_index->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spatial_index->dictionary_owner_hard);
+                        dxf_read_string (&spatial_index->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -399,6 +384,10 @@ dxf_spatial_index_free
         }
         free (spatial_index->dictionary_owner_soft);
         free (spatial_index->dictionary_owner_hard);
+        if (spatial_index->rtree != NULL)
+        {
+                dxf_rtree_free (spatial_index->rtree);
+        }
         free (spatial_index);
         spatial_index = NULL;
 #if DEBUG
@@ -432,6 +421,7 @@ dxf_spatial_index_free_list
         while (spatial_indices != NULL)
         {
                 DxfSpatialIndex *iter = (DxfSpatialIndex *) spatial_indices->next;
+                spatial_indices->next = NULL;
                 dxf_spatial_index_free (spatial_indices);
                 spatial_indices = (DxfSpatialIndex *) iter;
         }
@@ -852,9 +842,6 @@ dxf_spatial_index_get_last
         }
         if (spatial_index->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfSpatialIndex *) spatial_index);
         }
         DxfSpatialIndex *iter = (DxfSpatialIndex *) spatial_index->next;
@@ -869,4 +856,226 @@ dxf_spatial_index_get_last
 }
 
 
+/*!
+ * \brief Get the R-tree from a DXF \c SPATIAL_INDEX object.
+ *
+ * \return the R-tree, \c NULL when the index was not built.
+ */
+DxfRTree *
+dxf_spatial_index_get_rtree
+(
+        DxfSpatialIndex *spatial_index
+                /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (spatial_index == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (spatial_index->rtree);
+}
+
+
+/*!
+ * \brief Build the R-tree of a DXF \c SPATIAL_INDEX object over the
+ * bounding boxes of the entities in a DXF entities section.
+ *
+ * The tree is bulk loaded with the Sort-Tile-Recursive algorithm,
+ * replacing a previously built tree, and the \c time_stamp is set to
+ * the current time.\n
+ * Entities for which no bounding box can be computed are not indexed.\n
+ * The index is a snapshot of the entities section, the caller keeps it
+ * up to date with dxf_spatial_index_insert_entity () and
+ * dxf_spatial_index_delete_entity () when entities are added, removed
+ * or modified.
+ *
+ * \return a pointer to \c spatial_index, or \c NULL when an error
+ * occurred.
+ */
+DxfSpatialIndex *
+dxf_spatial_index_build
+(
+        DxfSpatialIndex *spatial_index,
+                /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
+        DxfEntities *entities
+                /*!< DXF entities section to be indexed. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfRTreeEntry *entries;
+        int number_of_entries;
+        int i;
+
+        /* Do some basic checks. */
+        if ((spatial_index == NULL) || (entities == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (spatial_index->rtree == NULL)
+        {
+                spatial_index->rtree = dxf_rtree_init (NULL);
+                if (spatial_index->rtree == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        entries = malloc ((entities->number_of_sequence_items + 1) * sizeof (DxfRTreeEntry));
+        if (entries == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        number_of_entries = 0;
+        for (i = 0; i < entities->number_of_sequence_items; i++)
+        {
+                if (dxf_entity_get_extents (entities->sequence[i].type,
+                  entities->sequence[i].entity,
+                  &entries[number_of_entries].extents) == EXIT_FAILURE)
+                {
+                        continue;
+                }
+                entries[number_of_entries].type = entities->sequence[i].type;
+                entries[number_of_entries].entity = entities->sequence[i].entity;
+                number_of_entries++;
+        }
+        if (dxf_rtree_bulk_load (spatial_index->rtree, entries, number_of_entries) == EXIT_FAILURE)
+        {
+                free (entries);
+                return (NULL);
+        }
+        free (entries);
+        spatial_index->time_stamp = dxf_julian_date_now ();
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (spatial_index);
+}
+
+
+/*!
+ * \brief Add an entity to the R-tree of a DXF \c SPATIAL_INDEX object.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no
+ * bounding box can be computed for the entity or an error occurred.
+ */
+int
+dxf_spatial_index_insert_entity
+(
+        DxfSpatialIndex *spatial_index,
+                /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Entity to be added. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExtents extents;
+
+        /* Do some basic checks. */
+        if ((spatial_index == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (spatial_index->rtree == NULL)
+        {
+                spatial_index->rtree = dxf_rtree_init (NULL);
+                if (spatial_index->rtree == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (dxf_entity_get_extents (type, entity, &extents) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_rtree_insert (spatial_index->rtree, &extents, type, entity));
+}
+
+
+/*!
+ * \brief Remove an entity from the R-tree of a DXF \c SPATIAL_INDEX
+ * object.
+ *
+ * The entity is looked up by it's current bounding box, when it was
+ * modified after it was indexed the whole tree is searched.\n
+ * Call this before the entity is freed, and delete and insert a
+ * modified entity to index it's new bounding box.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the entity
+ * was not indexed or an error occurred.
+ */
+int
+dxf_spatial_index_delete_entity
+(
+        DxfSpatialIndex *spatial_index,
+                /*!< a pointer to a DXF \c SPATIAL_INDEX object. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity
+                /*!< Entity to be removed. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfExtents extents;
+
+        /* Do some basic checks. */
+        if ((spatial_index == NULL) || (entity == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (spatial_index->rtree == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        if ((dxf_entity_get_extents (type, entity, &extents) == EXIT_SUCCESS)
+          && (dxf_rtree_delete (spatial_index->rtree, &extents, entity) == EXIT_SUCCESS))
+        {
+                return (EXIT_SUCCESS);
+        }
+        extents.min_x = extents.min_y = extents.min_z = -DBL_MAX;
+        extents.max_x = extents.max_y = extents.max_z = DBL_MAX;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_rtree_delete (spatial_index->rtree, &extents, entity));
+}
+
+
 /* EOF*/
@@ -49,6 +49,8 @@
 
 
 #include "global.h"
+#include "entities.h"
+#include "rtree.h"
 
 
 #ifdef __cplusplus
@@ -78,6 +80,15 @@ dxf_spatial_index_struct
         double time_stamp;
                 /*!< Timestamp (Julian date).\n
                  * Group code = 40. */
+        DxfRTree *rtree;
+                /*!< R-tree over the bounding boxes of the indexed
+                 * entities, \c NULL when the index was not built.\n
+                 * The tree is not updated when entities are added to,
+                 * removed from or moved in the entities section, use
+                 * dxf_spatial_index_insert_entity () and
+                 * dxf_spatial_index_delete_entity (), or rebuild it
+                 * with dxf_spatial_index_build ().\n
+                 * Not stored in the DXF file. */
         struct DxfSpatialIndex *next;
                 /*!< Pointer to the next DxfSpatialIndex.\n
                  * \c NULL in the last DxfSpatialIndex. */
@@ -101,6 +112,10 @@ DxfSpatialIndex *dxf_spatial_index_set_time_stamp (DxfSpatialIndex *spatial_inde
 DxfSpatialIndex *dxf_spatial_index_get_next (DxfSpatialIndex *spatial_index);
 DxfSpatialIndex *dxf_spatial_index_set_next (DxfSpatialIndex *spatial_index, DxfSpatialIndex *next);
 DxfSpatialIndex *dxf_spatial_index_get_last (DxfSpatialIndex *spatial_index);
+DxfRTree *dxf_spatial_index_get_rtree (DxfSpatialIndex *spatial_index);
+DxfSpatialIndex *dxf_spatial_index_build (DxfSpatialIndex *spatial_index, DxfEntities *entities);
+int dxf_spatial_index_insert_entity (DxfSpatialIndex *spatial_index, DxfEntityType type, void *entity);
+int dxf_spatial_index_delete_entity (DxfSpatialIndex *spatial_index, DxfEntityType type, void *entity);
 
 
 #ifdef __cplusplus
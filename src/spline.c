@@ -314,7 +314,7 @@ dxf_spline_init
         spline->paperspace = DXF_MODELSPACE;
         spline->graphics_data_size = 0;
         spline->shadow_mode = 0;
-        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
+        spline->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
         spline->dictionary_owner_soft = strdup ("");
         spline->material = strdup ("");
         spline->dictionary_owner_hard = strdup ("");
@@ -348,6 +348,7 @@ dxf_spline_init
         spline->number_of_knots = 0;
         spline->number_of_control_points = 0;
         spline->number_of_fit_points = 0;
+        spline->cache = NULL;
         spline->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -379,8 +380,7 @@ dxf_spline_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryGraphicsData *binary_graphics_data = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
         DxfPoint *p2 = NULL;
@@ -394,27 +394,25 @@ dxf_spline_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (spline == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 spline = dxf_spline_init (spline);
         }
-        binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
         p2 = (DxfPoint *) spline->p2;
         p3 = (DxfPoint *) spline->p3;
         kv = (DxfDouble *) spline->knot_value;
         wv = (DxfDouble *) spline->weight_value;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -422,8 +420,6 @@ dxf_spline_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -437,14 +433,12 @@ dxf_spline_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->linetype);
+                        dxf_read_string (&spline->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->layer);
+                        dxf_read_string (&spline->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -670,31 +664,26 @@ dxf_spline_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) binary_graphics_data->next);
-                        binary_graphics_data = (DxfBinaryGraphicsData *) binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, spline->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a
                          * soft-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_soft);
+                        dxf_read_string (&spline->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->material);
+                        dxf_read_string (&spline->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->dictionary_owner_hard);
+                        dxf_read_string (&spline->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -707,8 +696,7 @@ dxf_spline_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->plot_style_name);
+                        dxf_read_string (&spline->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -720,8 +708,7 @@ dxf_spline_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, spline->color_name);
+                        dxf_read_string (&spline->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -733,16 +720,20 @@ dxf_spline_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (spline->linetype, "") == 0)
@@ -753,8 +744,6 @@ dxf_spline_read
         {
                 spline->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -782,7 +771,6 @@ dxf_spline_write
 #endif
         char *dxf_entity_name = strdup ("SPLINE");
         int i;
-        DxfBinaryGraphicsData *binary_graphics_data = NULL;
         DxfPoint *p0 = NULL;
         DxfPoint *p1 = NULL;
         DxfPoint *p2 = NULL;
@@ -834,7 +822,6 @@ dxf_spline_write
                 spline->layer = DXF_DEFAULT_LAYER;
         }
         /* Start writing output. */
-        binary_graphics_data = (DxfBinaryGraphicsData *) spline->binary_graphics_data;
         p0 = (DxfPoint *) spline->p0;
         p1 = (DxfPoint *) spline->p1;
         p2 = (DxfPoint *) spline->p2;
@@ -910,10 +897,9 @@ dxf_spline_write
         /*!
          * \todo On 64 bit machines use group code 160.
          */
-        while (binary_graphics_data != NULL)
+        if (spline->binary_graphics_data != NULL)
         {
-                fprintf (fp->fp, "310\n%s\n", binary_graphics_data->data_line);
-                binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (binary_graphics_data);
+                dxf_binary_data_write (fp, spline->binary_graphics_data);
         }
         fprintf (fp->fp, "420\n%" PRIi32 "\n", spline->color_value);
         fprintf (fp->fp, "430\n%s\n", spline->color_name);
@@ -1014,7 +1000,10 @@ dxf_spline_free
         }
         free (spline->linetype);
         free (spline->layer);
-        dxf_binary_graphics_data_free_list ((DxfBinaryGraphicsData *) spline->binary_graphics_data);
+        if (spline->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (spline->binary_graphics_data);
+        }
         free (spline->dictionary_owner_soft);
         free (spline->material);
         free (spline->dictionary_owner_hard);
@@ -1026,6 +1015,7 @@ dxf_spline_free
         dxf_point_free (spline->p3);
         dxf_double_free_list (spline->knot_value);
         dxf_double_free_list (spline->weight_value);
+        dxf_spline_invalidate_cache (spline);
         free (spline);
         spline = NULL;
 #if DEBUG
@@ -1059,6 +1049,7 @@ dxf_spline_free_list
         while (splines != NULL)
         {
                 DxfSpline *iter = (DxfSpline *) splines->next;
+                splines->next = NULL;
                 dxf_spline_free (splines);
                 splines = (DxfSpline *) iter;
         }
@@ -2737,6 +2728,7 @@ dxf_spline_set_p0
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->p0 = (DxfPoint *) p0;
 #if DEBUG
         DXF_DEBUG_END
@@ -2819,6 +2811,7 @@ dxf_spline_set_x0
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->p0->x0 = x0;
 #if DEBUG
         DXF_DEBUG_END
@@ -2901,6 +2894,7 @@ dxf_spline_set_y0
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->p0->y0 = y0;
 #if DEBUG
         DXF_DEBUG_END
@@ -2983,6 +2977,7 @@ dxf_spline_set_z0
                   __FUNCTION__);
                 return (NULL);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->p0->z0 = z0;
 #if DEBUG
         DXF_DEBUG_END
@@ -4249,6 +4244,7 @@ dxf_spline_set_flag
                   (_("Warning in %s () an out of range value was passed.\n")),
                   __FUNCTION__);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->flag = flag;
 #if DEBUG
         DXF_DEBUG_END
@@ -4325,6 +4321,7 @@ dxf_spline_set_degree
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->degree = degree;
 #if DEBUG
         DXF_DEBUG_END
@@ -4401,6 +4398,7 @@ dxf_spline_set_number_of_knots
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->number_of_knots = number_of_knots;
 #if DEBUG
         DXF_DEBUG_END
@@ -4478,6 +4476,7 @@ dxf_spline_set_number_of_control_points
                   (_("Warning in %s () a negative value was passed.\n")),
                   __FUNCTION__);
         }
+        dxf_spline_invalidate_cache (spline);
         spline->number_of_control_points = number_of_control_points;
 #if DEBUG
         DXF_DEBUG_END
@@ -4998,9 +4997,6 @@ dxf_spline_get_last
         }
         if (spline->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfSpline *) spline);
         }
         DxfSpline *iter = (DxfSpline *) spline->next;
@@ -5015,4 +5011,940 @@ dxf_spline_get_last
 }
 
 
+/*!
+ * \brief Get the knot values \c knot_value from a DXF \c SPLINE entity.
+ *
+ * \return pointer to the first knot value.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+DxfDouble *
+dxf_spline_get_knot_value
+(
+        DxfSpline *spline
+                /*!< a pointer to a DXF \c SPLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfDouble *) spline->knot_value);
+}
+
+
+/*!
+ * \brief Set the knot values \c knot_value for a DXF \c SPLINE entity.
+ *
+ * \return \c spline when successful or \c NULL when an error occurred.
+ */
+DxfSpline *
+dxf_spline_set_knot_value
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        DxfDouble *knot_value
+                /*!< a pointer to the first knot value. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (knot_value == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_spline_invalidate_cache (spline);
+        spline->knot_value = (DxfDouble *) knot_value;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (spline);
+}
+
+
+/*!
+ * \brief Get the weight values \c weight_value from a DXF \c SPLINE
+ * entity.
+ *
+ * \return pointer to the first weight value.
+ *
+ * \warning No checks are performed on the returned pointer.
+ */
+DxfDouble *
+dxf_spline_get_weight_value
+(
+        DxfSpline *spline
+                /*!< a pointer to a DXF \c SPLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return ((DxfDouble *) spline->weight_value);
+}
+
+
+/*!
+ * \brief Set the weight values \c weight_value for a DXF \c SPLINE
+ * entity.
+ *
+ * \return \c spline when successful or \c NULL when an error occurred.
+ */
+DxfSpline *
+dxf_spline_set_weight_value
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        DxfDouble *weight_value
+                /*!< a pointer to the first weight value. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (weight_value == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        dxf_spline_invalidate_cache (spline);
+        spline->weight_value = (DxfDouble *) weight_value;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (spline);
+}
+
+
+/*!
+ * \brief Drop the evaluation cache of a DXF \c SPLINE entity.
+ *
+ * The setters do this, call it after changing the control points, knots
+ * or weights of a spline in place.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_spline_invalidate_cache
+(
+        DxfSpline *spline
+                /*!< a pointer to a DXF \c SPLINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (spline == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (spline->cache != NULL)
+        {
+                free (spline->cache->knots);
+                free (spline->cache->control_points);
+                free (spline->cache->points);
+                free (spline->cache);
+                spline->cache = NULL;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the evaluation cache of a DXF \c SPLINE entity, gathering
+ * the knots and homogeneous control points when not cached yet.
+ *
+ * The counts of the spline take precedence over the length of the
+ * linked lists, which may end with an unused entry after reading.\n
+ * A missing or inconsistent knot vector is replaced by a clamped
+ * uniform one, weights are only used for rational splines.
+ *
+ * \return the cache, or \c NULL when the spline can not be evaluated.
+ */
+static DxfSplineCache *
+dxf_spline_get_cache
+(
+        DxfSpline *spline
+                /*!< a pointer to a DXF \c SPLINE entity. */
+)
+{
+        DxfSplineCache *cache;
+        DxfPoint *point;
+        DxfDouble *value;
+        int degree;
+        int n;
+        int k;
+        int i;
+        double w;
+
+        if (spline->cache != NULL)
+        {
+                return (spline->cache);
+        }
+        degree = spline->degree;
+        n = spline->number_of_control_points;
+        if (n <= 0)
+        {
+                for (point = spline->p0; point != NULL; point = (DxfPoint *) point->next)
+                {
+                        n++;
+                }
+        }
+        if ((degree < 1) || (degree > DXF_SPLINE_MAX_DEGREE) || (n < degree + 1))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () invalid degree or number of control points.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cache = calloc (1, sizeof (DxfSplineCache));
+        if (cache == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cache->degree = degree;
+        cache->number_of_control_points = n;
+        cache->number_of_knots = n + degree + 1;
+        cache->knots = malloc (cache->number_of_knots * sizeof (double));
+        cache->control_points = malloc (4 * n * sizeof (double));
+        if ((cache->knots == NULL) || (cache->control_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (cache->knots);
+                free (cache->control_points);
+                free (cache);
+                return (NULL);
+        }
+        /* Knots, checked to be nondecreasing with a nonempty domain. */
+        k = 0;
+        for (value = spline->knot_value; (value != NULL) && (k < cache->number_of_knots); value = (DxfDouble *) value->next)
+        {
+                if ((k > 0) && (value->value < cache->knots[k - 1]))
+                {
+                        break;
+                }
+                cache->knots[k++] = value->value;
+        }
+        if ((k < cache->number_of_knots)
+          || ((spline->number_of_knots > 0) && (spline->number_of_knots != cache->number_of_knots))
+          || (cache->knots[degree] >= cache->knots[n]))
+        {
+                for (i = 0; i < cache->number_of_knots; i++)
+                {
+                        cache->knots[i] = (i <= degree)
+                          ? 0.0
+                          : ((i >= n) ? (double) (n - degree) : (double) (i - degree));
+                }
+        }
+        /* Control points times their weight, followed by the weight. */
+        point = spline->p0;
+        value = (spline->flag & 4) ? spline->weight_value : NULL;
+        for (i = 0; i < n; i++)
+        {
+                w = 1.0;
+                if (value != NULL)
+                {
+                        if (value->value > 0.0)
+                        {
+                                w = value->value;
+                        }
+                        value = (DxfDouble *) value->next;
+                }
+                cache->control_points[4 * i] = (point != NULL) ? w * point->x0 : 0.0;
+                cache->control_points[4 * i + 1] = (point != NULL) ? w * point->y0 : 0.0;
+                cache->control_points[4 * i + 2] = (point != NULL) ? w * point->z0 : 0.0;
+                cache->control_points[4 * i + 3] = w;
+                if (point != NULL)
+                {
+                        point = (DxfPoint *) point->next;
+                }
+        }
+        spline->cache = cache;
+        return (cache);
+}
+
+
+/*!
+ * \brief Find the knot span holding a parameter, clamped to the domain
+ * of the spline.
+ *
+ * \return the index \c i of the span
+ * <tt>knots[i] <= u < knots[i + 1]</tt>.
+ */
+static int
+dxf_spline_find_span
+(
+        const DxfSplineCache *cache,
+        double u
+)
+{
+        const double *knots = cache->knots;
+        int low;
+        int high;
+        int middle;
+
+        low = cache->degree;
+        high = cache->number_of_control_points;
+        if (u >= knots[high])
+        {
+                /* The end of the domain belongs to the last nonempty
+                 * span. */
+                middle = high - 1;
+                while ((middle > low) && (knots[middle] >= knots[high]))
+                {
+                        middle--;
+                }
+                return (middle);
+        }
+        if (u <= knots[low])
+        {
+                while ((low < high - 1) && (knots[low + 1] <= knots[low]))
+                {
+                        low++;
+                }
+                return (low);
+        }
+        while (high - low > 1)
+        {
+                middle = (low + high) / 2;
+                if (u < knots[middle])
+                        high = middle;
+                else
+                        low = middle;
+        }
+        return (low);
+}
+
+
+/*!
+ * \brief Evaluate a point with de Boor's algorithm on the homogeneous
+ * control points.
+ */
+static void
+dxf_spline_de_boor
+(
+        const DxfSplineCache *cache,
+        double u,
+        double *point
+)
+{
+        double d[DXF_SPLINE_MAX_DEGREE + 1][4];
+        const double *knots = cache->knots;
+        int p = cache->degree;
+        int span;
+        int r;
+        int j;
+        int c;
+        double alpha;
+        double denominator;
+
+        span = dxf_spline_find_span (cache, u);
+        for (j = 0; j <= p; j++)
+        {
+                for (c = 0; c < 4; c++)
+                {
+                        d[j][c] = cache->control_points[4 * (span - p + j) + c];
+                }
+        }
+        for (r = 1; r <= p; r++)
+        {
+                for (j = p; j >= r; j--)
+                {
+                        denominator = knots[j + 1 + span - r] - knots[j + span - p];
+                        alpha = (denominator != 0.0)
+                          ? (u - knots[j + span - p]) / denominator
+                          : 0.0;
+                        for (c = 0; c < 4; c++)
+                        {
+                                d[j][c] = (1.0 - alpha) * d[j - 1][c] + alpha * d[j][c];
+                        }
+                }
+        }
+        point[0] = d[p][0] / d[p][3];
+        point[1] = d[p][1] / d[p][3];
+        point[2] = d[p][2] / d[p][3];
+}
+
+
+/*!
+ * \brief Compute the nonzero basis functions and their derivatives up to
+ * \c order in a knot span.
+ *
+ * Algorithm A2.3 of "The NURBS Book" by Les Piegl and Wayne Tiller.
+ */
+static void
+dxf_spline_basis_derivatives
+(
+        const DxfSplineCache *cache,
+        int span,
+        double u,
+        int order,
+                /*!< Highest derivative, at most the degree. */
+        double ders[][DXF_SPLINE_MAX_DEGREE + 1]
+                /*!< Receives <tt>ders[k][j]</tt>, the \c k-th derivative
+                 * of basis function <tt>span - degree + j</tt>. */
+)
+{
+        double ndu[DXF_SPLINE_MAX_DEGREE + 1][DXF_SPLINE_MAX_DEGREE + 1];
+        double a[2][DXF_SPLINE_MAX_DEGREE + 1];
+        double left[DXF_SPLINE_MAX_DEGREE + 1];
+        double right[DXF_SPLINE_MAX_DEGREE + 1];
+        const double *knots = cache->knots;
+        int p = cache->degree;
+        double saved;
+        double temp;
+        double d;
+        int s1;
+        int s2;
+        int j1;
+        int j2;
+        int rk;
+        int pk;
+        int r;
+        int j;
+        int k;
+
+        ndu[0][0] = 1.0;
+        for (j = 1; j <= p; j++)
+        {
+                left[j] = u - knots[span + 1 - j];
+                right[j] = knots[span + j] - u;
+                saved = 0.0;
+                for (r = 0; r < j; r++)
+                {
+                        ndu[j][r] = right[r + 1] + left[j - r];
+                        temp = (ndu[j][r] != 0.0) ? ndu[r][j - 1] / ndu[j][r] : 0.0;
+                        ndu[r][j] = saved + right[r + 1] * temp;
+                        saved = left[j - r] * temp;
+                }
+                ndu[j][j] = saved;
+        }
+        for (j = 0; j <= p; j++)
+        {
+                ders[0][j] = ndu[j][p];
+        }
+        for (r = 0; r <= p; r++)
+        {
+                s1 = 0;
+                s2 = 1;
+                a[0][0] = 1.0;
+                for (k = 1; k <= order; k++)
+                {
+                        d = 0.0;
+                        rk = r - k;
+                        pk = p - k;
+                        if (r >= k)
+                        {
+                                a[s2][0] = (ndu[pk + 1][rk] != 0.0) ? a[s1][0] / ndu[pk + 1][rk] : 0.0;
+                                d = a[s2][0] * ndu[rk][pk];
+                        }
+                        j1 = (rk >= -1) ? 1 : -rk;
+                        j2 = (r - 1 <= pk) ? k - 1 : p - r;
+                        for (j = j1; j <= j2; j++)
+                        {
+                                a[s2][j] = (ndu[pk + 1][rk + j] != 0.0)
+                                  ? (a[s1][j] - a[s1][j - 1]) / ndu[pk + 1][rk + j]
+                                  : 0.0;
+                                d += a[s2][j] * ndu[rk + j][pk];
+                        }
+                        if (r <= pk)
+                        {
+                                a[s2][k] = (ndu[pk + 1][r] != 0.0) ? -a[s1][k - 1] / ndu[pk + 1][r] : 0.0;
+                                d += a[s2][k] * ndu[r][pk];
+                        }
+                        ders[k][r] = d;
+                        j = s1;
+                        s1 = s2;
+                        s2 = j;
+                }
+        }
+        r = p;
+        for (k = 1; k <= order; k++)
+        {
+                for (j = 0; j <= p; j++)
+                {
+                        ders[k][j] *= r;
+                }
+                r *= (p - k);
+        }
+}
+
+
+/*!
+ * \brief Get the parameter domain of a DXF \c SPLINE entity.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * can not be evaluated or an error occurred.
+ */
+int
+dxf_spline_get_domain
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double *u_min,
+                /*!< Receives the first parameter of the curve. */
+        double *u_max
+                /*!< Receives the last parameter of the curve. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSplineCache *cache;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (u_min == NULL) || (u_max == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        cache = dxf_spline_get_cache (spline);
+        if (cache == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        *u_min = cache->knots[cache->degree];
+        *u_max = cache->knots[cache->number_of_control_points];
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Evaluate a point on a DXF \c SPLINE entity.
+ *
+ * Uses de Boor's algorithm on the control points, rational splines
+ * (flag bit 4) are evaluated in homogeneous coordinates.\n
+ * Parameters outside the domain (see dxf_spline_get_domain ()) are
+ * evaluated on the first or last knot span.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * can not be evaluated or an error occurred.
+ */
+int
+dxf_spline_evaluate
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double u,
+                /*!< Parameter of the point. */
+        double *point
+                /*!< Receives the X-, Y- and Z-value of the point. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSplineCache *cache;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (point == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        cache = dxf_spline_get_cache (spline);
+        if (cache == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_spline_de_boor (cache, u, point);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Evaluate a point and it's derivatives on a DXF \c SPLINE
+ * entity.
+ *
+ * The derivatives of the weighted curve and of the weight function are
+ * combined with the quotient rule (algorithm A4.2 of "The NURBS Book"),
+ * so rational splines give exact derivatives too.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * can not be evaluated or an error occurred.
+ */
+int
+dxf_spline_evaluate_derivatives
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double u,
+                /*!< Parameter of the point. */
+        int order,
+                /*!< Highest derivative, at most
+                 * \c DXF_SPLINE_MAX_DEGREE. */
+        double *derivatives
+                /*!< Receives 3 * (\c order + 1) values, the point
+                 * followed by the first up to the \c order-th
+                 * derivative. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double ders[DXF_SPLINE_MAX_DEGREE + 1][DXF_SPLINE_MAX_DEGREE + 1];
+        double homogeneous[DXF_SPLINE_MAX_DEGREE + 1][4];
+        DxfSplineCache *cache;
+        const double *cp;
+        double binomial;
+        int span;
+        int p;
+        int k;
+        int i;
+        int j;
+        int c;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (derivatives == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((order < 0) || (order > DXF_SPLINE_MAX_DEGREE))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () an invalid value was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        cache = dxf_spline_get_cache (spline);
+        if (cache == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        p = cache->degree;
+        span = dxf_spline_find_span (cache, u);
+        dxf_spline_basis_derivatives (cache, span, u, (order < p) ? order : p, ders);
+        /* Derivatives of the homogeneous curve, those above the degree
+         * vanish. */
+        for (k = 0; k <= order; k++)
+        {
+                for (c = 0; c < 4; c++)
+                {
+                        homogeneous[k][c] = 0.0;
+                }
+                if (k > p)
+                {
+                        continue;
+                }
+                for (j = 0; j <= p; j++)
+                {
+                        cp = &cache->control_points[4 * (span - p + j)];
+                        for (c = 0; c < 4; c++)
+                        {
+                                homogeneous[k][c] += ders[k][j] * cp[c];
+                        }
+                }
+        }
+        /* Quotient rule. */
+        for (k = 0; k <= order; k++)
+        {
+                for (c = 0; c < 3; c++)
+                {
+                        derivatives[3 * k + c] = homogeneous[k][c];
+                }
+                binomial = 1.0;
+                for (i = 1; i <= k; i++)
+                {
+                        binomial = binomial * (k - i + 1) / i;
+                        for (c = 0; c < 3; c++)
+                        {
+                                derivatives[3 * k + c] -= binomial
+                                  * homogeneous[i][3]
+                                  * derivatives[3 * (k - i) + c];
+                        }
+                }
+                for (c = 0; c < 3; c++)
+                {
+                        derivatives[3 * k + c] /= homogeneous[0][3];
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a point to the tessellation of a spline cache.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spline_tessellate_add
+(
+        DxfSplineCache *cache,
+        const double *point
+)
+{
+        double *points;
+        int size;
+
+        if (cache->number_of_points == cache->points_size)
+        {
+                size = (cache->points_size > 0) ? 2 * cache->points_size : 64;
+                points = realloc (cache->points, 3 * size * sizeof (double));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (EXIT_FAILURE);
+                }
+                cache->points = points;
+                cache->points_size = size;
+        }
+        cache->points[3 * cache->number_of_points] = point[0];
+        cache->points[3 * cache->number_of_points + 1] = point[1];
+        cache->points[3 * cache->number_of_points + 2] = point[2];
+        cache->number_of_points++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Distance from a point to the chord between two points.
+ */
+static double
+dxf_spline_chord_distance
+(
+        const double *point,
+        const double *p0,
+        const double *p1
+)
+{
+        double d[3];
+        double v[3];
+        double length2;
+        double t;
+        int c;
+
+        length2 = 0.0;
+        t = 0.0;
+        for (c = 0; c < 3; c++)
+        {
+                d[c] = p1[c] - p0[c];
+                v[c] = point[c] - p0[c];
+                length2 += d[c] * d[c];
+                t += d[c] * v[c];
+        }
+        t = (length2 > 0.0) ? t / length2 : 0.0;
+        t = (t < 0.0) ? 0.0 : ((t > 1.0) ? 1.0 : t);
+        return (sqrt ((v[0] - t * d[0]) * (v[0] - t * d[0])
+          + (v[1] - t * d[1]) * (v[1] - t * d[1])
+          + (v[2] - t * d[2]) * (v[2] - t * d[2])));
+}
+
+
+/*!
+ * \brief Tessellate the parameter interval from \c a to \c b, appending
+ * the points after the one at \c a.
+ *
+ * The interval is halved until the curve at a quarter, half and three
+ * quarters of it lies within \c tolerance of the chord.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_spline_tessellate_interval
+(
+        DxfSplineCache *cache,
+        double a,
+        const double *pa,
+        double b,
+        const double *pb,
+        double tolerance,
+        int depth
+)
+{
+        double pm[3];
+        double q1[3];
+        double q3[3];
+        double m;
+
+        m = 0.5 * (a + b);
+        dxf_spline_de_boor (cache, m, pm);
+        if (depth < DXF_SPLINE_TESSELLATE_MAX_DEPTH)
+        {
+                dxf_spline_de_boor (cache, 0.5 * (a + m), q1);
+                dxf_spline_de_boor (cache, 0.5 * (m + b), q3);
+                if ((dxf_spline_chord_distance (pm, pa, pb) > tolerance)
+                  || (dxf_spline_chord_distance (q1, pa, pb) > tolerance)
+                  || (dxf_spline_chord_distance (q3, pa, pb) > tolerance))
+                {
+                        if (dxf_spline_tessellate_interval (cache, a, pa, m, pm, tolerance, depth + 1) == EXIT_FAILURE)
+                        {
+                                return (EXIT_FAILURE);
+                        }
+                        return (dxf_spline_tessellate_interval (cache, m, pm, b, pb, tolerance, depth + 1));
+                }
+        }
+        return (dxf_spline_tessellate_add (cache, pb));
+}
+
+
+/*!
+ * \brief Tessellate a DXF \c SPLINE entity into a polyline.
+ *
+ * Every nonempty knot span is subdivided adaptively until the curve
+ * lies within the chord height \c tolerance of the polyline.\n
+ * The points are stored in the evaluation cache of the spline, a
+ * second call with the same tolerance returns them without evaluating
+ * the curve again.
+ *
+ * \return a pointer to 3 * \c number_of_points coordinates owned by the
+ * spline, valid until the spline is changed or freed, or \c NULL when
+ * the spline can not be evaluated or an error occurred.
+ */
+const double *
+dxf_spline_tessellate
+(
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double tolerance,
+                /*!< Maximum distance between the curve and the
+                 * polyline, must be positive. */
+        int *number_of_points
+                /*!< Receives the number of points. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfSplineCache *cache;
+        double pa[3];
+        double pb[3];
+        int i;
+
+        /* Do some basic checks. */
+        if ((spline == NULL) || (number_of_points == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (tolerance <= 0.0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a tolerance of zero or less was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        cache = dxf_spline_get_cache (spline);
+        if (cache == NULL)
+        {
+                return (NULL);
+        }
+        if ((cache->points != NULL) && (cache->tolerance == tolerance))
+        {
+                *number_of_points = cache->number_of_points;
+                return (cache->points);
+        }
+        cache->number_of_points = 0;
+        cache->tolerance = tolerance;
+        dxf_spline_de_boor (cache, cache->knots[cache->degree], pa);
+        if (dxf_spline_tessellate_add (cache, pa) == EXIT_FAILURE)
+        {
+                return (NULL);
+        }
+        for (i = cache->degree; i < cache->number_of_control_points; i++)
+        {
+                if (cache->knots[i + 1] <= cache->knots[i])
+                {
+                        continue;
+                }
+                dxf_spline_de_boor (cache, cache->knots[i + 1], pb);
+                if (dxf_spline_tessellate_interval (cache, cache->knots[i], pa,
+                  cache->knots[i + 1], pb, tolerance, 0) == EXIT_FAILURE)
+                {
+                        cache->number_of_points = 0;
+                        free (cache->points);
+                        cache->points = NULL;
+                        cache->points_size = 0;
+                        return (NULL);
+                }
+                pa[0] = pb[0];
+                pa[1] = pb[1];
+                pa[2] = pb[2];
+        }
+        *number_of_points = cache->number_of_points;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (cache->points);
+}
+
+
 /* EOF */
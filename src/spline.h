@@ -57,6 +57,46 @@ extern "C" {
 #define DXF_SPLINE_KNOT_TOLERANCE_DEFAULT 0.0000001
 #define DXF_SPLINE_CONTROL_POINT_TOLERANCE_DEFAULT 0.0000001
 #define DXF_SPLINE_FIT_TOLERANCE_DEFAULT 0.0000000001
+#define DXF_SPLINE_MAX_DEGREE 15
+        /*!< \brief Highest degree of a spline that can be evaluated. */
+#define DXF_SPLINE_TESSELLATE_MAX_DEPTH 16
+        /*!< \brief Maximum number of times a knot span is halved during
+         * tessellation. */
+
+
+/*!
+ * \brief Evaluation cache of a \c SPLINE entity.
+ *
+ * Holds the knots and homogeneous control points gathered from the
+ * linked lists of a spline, and the last tessellation.\n
+ * The cache is built on demand and dropped by the setters of the
+ * spline.
+ */
+typedef struct
+dxf_spline_cache_struct
+{
+        int degree;
+                /*!< Degree of the spline curve. */
+        int number_of_control_points;
+                /*!< Number of control points. */
+        int number_of_knots;
+                /*!< Number of knots, \c number_of_control_points +
+                 * \c degree + 1. */
+        double *knots;
+                /*!< Knot vector. */
+        double *control_points;
+                /*!< Control points multiplied by their weight, followed
+                 * by the weight (4 values per control point). */
+        double tolerance;
+                /*!< Chord height tolerance of the tessellation. */
+        double *points;
+                /*!< Tessellated points (3 values per point), \c NULL
+                 * until tessellated. */
+        int number_of_points;
+                /*!< Number of tessellated points. */
+        int points_size;
+                /*!< Number of points allocated in \c points. */
+} DxfSplineCache;
 
 
 /*!
@@ -236,6 +276,11 @@ dxf_spline_struct
                 /*!< Z-value of the extrusion vector.\n
                  * Defaults to 1.0 if omitted in the DXF file.\n
                  * Group code = 230. */
+        DxfSplineCache *cache;
+                /*!< Evaluation cache, \c NULL when not evaluated.\n
+                 * Dropped by the setters, call
+                 * dxf_spline_invalidate_cache () after changing the
+                 * control points, knots or weights in place. */
         struct DxfSpline *next;
                 /*!< Pointer to the next DxfSpline.\n
                  * \c NULL in the last DxfSpline. */
@@ -348,6 +393,15 @@ DxfSpline *dxf_spline_set_extr_z0 (DxfSpline *spline, double extr_z0);
 DxfSpline *dxf_spline_get_next (DxfSpline *spline);
 DxfSpline *dxf_spline_set_next (DxfSpline *spline, DxfSpline *next);
 DxfSpline *dxf_spline_get_last (DxfSpline *spline);
+DxfDouble *dxf_spline_get_knot_value (DxfSpline *spline);
+DxfSpline *dxf_spline_set_knot_value (DxfSpline *spline, DxfDouble *knot_value);
+DxfDouble *dxf_spline_get_weight_value (DxfSpline *spline);
+DxfSpline *dxf_spline_set_weight_value (DxfSpline *spline, DxfDouble *weight_value);
+int dxf_spline_invalidate_cache (DxfSpline *spline);
+int dxf_spline_get_domain (DxfSpline *spline, double *u_min, double *u_max);
+int dxf_spline_evaluate (DxfSpline *spline, double u, double *point);
+int dxf_spline_evaluate_derivatives (DxfSpline *spline, double u, int order, double *derivatives);
+const double *dxf_spline_tessellate (DxfSpline *spline, double tolerance, int *number_of_points);
 
 
 #ifdef __cplusplus
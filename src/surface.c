@@ -122,22 +122,7 @@ dxf_surface_init
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->proprietary_data = (DxfProprietaryData *) dxf_proprietary_data_init (surface->proprietary_data);
-        if (surface->proprietary_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () could not allocate memory.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        surface->additional_proprietary_data = (DxfProprietaryData *) dxf_proprietary_data_init (surface->additional_proprietary_data);
-        if (surface->additional_proprietary_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () could not allocate memory.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
+        surface->acis_data = NULL;
         /* Assign initial values to members. */
         surface->id_code = 0;
         surface->linetype = strdup (DXF_DEFAULT_LINETYPE);
@@ -194,10 +179,9 @@ dxf_surface_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int iter330;
-        int i;
+        int group_code;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -205,63 +189,58 @@ dxf_surface_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (surface == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 surface = dxf_surface_init (surface);
         }
-        iter310 = (DxfBinaryData *) surface->binary_graphics_data;
         iter330 = 0;
-        i = 1;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
-                else if (strcmp (temp_string, "  1") == 0)
+                else if ((strcmp (temp_string, "1") == 0)
+                  || (strcmp (temp_string, "3") == 0))
                 {
                         /* Now follows a string containing proprietary
-                         * data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->proprietary_data->line);
-                        surface->proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) surface->proprietary_data->next);
-                        surface->proprietary_data = (DxfProprietaryData *) surface->proprietary_data->next;
-                }
-                else if (strcmp (temp_string, "  3") == 0)
-                {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->additional_proprietary_data->line);
-                        surface->additional_proprietary_data->order = i;
-                        i++;
-                        dxf_proprietary_data_init ((DxfProprietaryData *) surface->additional_proprietary_data->next);
-                        surface->additional_proprietary_data = (DxfProprietaryData *) surface->additional_proprietary_data->next;
+                         * data, group code 3 lines continue the
+                         * previous line. */
+                        group_code = (temp_string[0] == '1') ? 1 : 3;
+                        dxf_read_value_line (temp_string, fp);
+                        if (surface->acis_data == NULL)
+                        {
+                                surface->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                                if (surface->acis_data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                        }
+                        dxf_acis_data_append_line (surface->acis_data, group_code, temp_string);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -272,14 +251,12 @@ dxf_surface_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->linetype);
+                        dxf_read_string (&surface->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->layer);
+                        dxf_read_string (&surface->layer, fp);
                 }
                 else if (strcmp (temp_string, "38") == 0)
                 {
@@ -355,9 +332,9 @@ dxf_surface_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        if ((strcmp (temp_string, "AcDbModelerGeometry") == 0)
+                        dxf_read_line (temp_string, fp);
+                        if ((strcmp (temp_string, "AcDbEntity") == 0)
+                          || (strcmp (temp_string, "AcDbModelerGeometry") == 0)
                           || (strcmp (temp_string, "AcDbSurface") == 0))
                         {
                                 /* Do nothing. */
@@ -370,7 +347,6 @@ dxf_surface_read
                                         surface->extruded_surface = (struct DxfSurfaceExtruded *) dxf_surface_extruded_new ();
                                 }
 //                                surface->extruded_surface = dxf_surface_extruded_read (fp, surface->extruded_surface);
-                                return (surface);
                         }
                         else if ((strcmp (temp_string, "AcDbLoftedSurface") == 0))
                         {
@@ -380,7 +356,6 @@ dxf_surface_read
                                         surface->lofted_surface = (struct DxfSurfaceLofted *) dxf_surface_lofted_new ();
                                 }
 //                                surface->lofted_surface = dxf_surface_lofted_read (fp, surface->lofted_surface);
-                                return (surface);
                         }
                         else if ((strcmp (temp_string, "AcDbRevolvedSurface") == 0))
                         {
@@ -390,7 +365,6 @@ dxf_surface_read
                                         surface->revolved_surface = (struct DxfSurfaceRevolved *) dxf_surface_revolved_new ();
                                 }
 //                                surface->revolved_surface = dxf_surface_revolved_read (fp, surface->revolved_surface);
-                                return (surface);
                         }
                         else if ((strcmp (temp_string, "AcDbSweptSurface") == 0))
                         {
@@ -400,15 +374,13 @@ dxf_surface_read
                                         surface->swept_surface = (struct DxfSurfaceSwept *) dxf_surface_swept_new ();
                                 }
 //                                surface->swept_surface = dxf_surface_swept_read (fp, surface->swept_surface);
-                                return (surface);
                         }
                         else
                         {
-                                surface->type = NO_TYPE;
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
-                                return (surface);
                         }
                 }
                 else if (strcmp (temp_string, "160") == 0)
@@ -429,10 +401,8 @@ dxf_surface_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, surface->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
@@ -440,15 +410,13 @@ dxf_surface_read
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner dictionary. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_soft);
+                                dxf_read_string (&surface->dictionary_owner_soft, fp);
                         }
                         if (iter330 == 1)
                         {
                                 /* Now follows a string containing a soft-pointer
                                  * ID/handle to owner object. */
-                                (fp->line_number)++;
-                                fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->object_owner_soft);
+                                dxf_read_string (&surface->object_owner_soft, fp);
                         }
                         iter330++;
                 }
@@ -456,15 +424,13 @@ dxf_surface_read
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->material);
+                        dxf_read_string (&surface->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->dictionary_owner_hard);
+                        dxf_read_string (&surface->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -477,8 +443,7 @@ dxf_surface_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->plot_style_name);
+                        dxf_read_string (&surface->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -490,8 +455,7 @@ dxf_surface_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, surface->color_name);
+                        dxf_read_string (&surface->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -503,16 +467,20 @@ dxf_surface_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (surface->linetype, "") == 0)
@@ -523,8 +491,6 @@ dxf_surface_read
         {
                 surface->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -658,13 +624,7 @@ dxf_surface_write
 #endif
                 if (surface->binary_graphics_data != NULL)
                 {
-                        DxfBinaryData *iter;
-                        iter = surface->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_data_get_data_line (iter));
-                                iter = (DxfBinaryData *) dxf_binary_data_get_next (iter);
-                        }
+                        dxf_binary_data_write (fp, surface->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -690,25 +650,9 @@ dxf_surface_write
         {
                 fprintf (fp->fp, " 70\n%hd\n", surface->modeler_format_version_number);
         }
-        if (surface->proprietary_data != NULL)
+        if (surface->acis_data != NULL)
         {
-                DxfProprietaryData *iter1a;
-                iter1a = (DxfProprietaryData *) surface->proprietary_data;
-                while (iter1a != NULL)
-                {
-                        fprintf (fp->fp, "  1\n%s\n", iter1a->line);
-                        iter1a = (DxfProprietaryData *) iter1a->next;
-                }
-        }
-        if (surface->additional_proprietary_data != NULL)
-        {
-                DxfProprietaryData *iter3a;
-                iter3a = (DxfProprietaryData *) surface->additional_proprietary_data;
-                while (iter3a != NULL)
-                {
-                        fprintf (fp->fp, "  3\n%s\n", iter3a->line);
-                        iter3a = (DxfProprietaryData *) iter3a->next;
-                }
+                dxf_acis_data_write (fp, surface->acis_data);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -797,8 +741,14 @@ dxf_surface_free
         free (surface->dictionary_owner_hard);
         free (surface->plot_style_name);
         free (surface->color_name);
-        dxf_proprietary_data_free_list (surface->proprietary_data);
-        dxf_proprietary_data_free_list (surface->additional_proprietary_data);
+        if (surface->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (surface->binary_graphics_data);
+        }
+        if (surface->acis_data != NULL)
+        {
+                dxf_acis_data_free (surface->acis_data);
+        }
         free (surface);
         surface = NULL;
 #if DEBUG
@@ -832,6 +782,7 @@ dxf_surface_free_list
         while (surfaces != NULL)
         {
                 DxfSurface *iter = (DxfSurface *) surfaces->next;
+                surfaces->next = NULL;
                 dxf_surface_free (surfaces);
                 surfaces = (DxfSurface *) iter;
         }
@@ -2522,12 +2473,88 @@ dxf_surface_set_transparency
 
 
 /*!
- * \brief Get the pointer to the \c proprietary_data from a DXF \c
- * SURFACE entity.
+ * \brief Get the pointer to the proprietary (ACIS) data from a DXF
+ * \c SURFACE entity.
+ *
+ * \return pointer to the \c acis_data, \c NULL when the entity has no
+ * proprietary data or an error occurred.
+ */
+DxfAcisData *
+dxf_surface_get_acis_data
+(
+        DxfSurface *surface
+                /*!< a pointer to a DXF \c SURFACE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (surface == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (surface->acis_data);
+}
+
+
+/*!
+ * \brief Set the pointer to the proprietary (ACIS) data for a DXF
+ * \c SURFACE entity.
+ */
+DxfSurface *
+dxf_surface_set_acis_data
+(
+        DxfSurface *surface,
+                /*!< a pointer to a DXF \c SURFACE entity. */
+        DxfAcisData *acis_data
+                /*!< a pointer to the proprietary data to be set for
+                 * the entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (surface == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        if (acis_data == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        surface->acis_data = acis_data;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (surface);
+}
+
+
+/*!
+ * \brief Get the \c proprietary_data from a DXF \c SURFACE entity.
  *
- * \return pointer to the \c proprietary_data.
+ * The group code 1 lines of the proprietary (ACIS) data are
+ * returned.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return a newly allocated list with the \c proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_proprietary_data_free_list ().
  */
 DxfProprietaryData *
 dxf_surface_get_proprietary_data
@@ -2547,25 +2574,25 @@ dxf_surface_get_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->proprietary_data ==  NULL)
+        if (surface->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfProprietaryData *) surface->proprietary_data);
+        return (dxf_acis_data_get_lines (surface->acis_data, 1));
 }
 
 
 /*!
- * \brief Set the proprietary data for a DXF \c SURFACE entity.
+ * \brief Set the \c proprietary_data for a DXF \c SURFACE entity.
  *
- * \return a pointer to \c surface when successful, or \c NULL when an
- * error occurred.
+ * The group code 1 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c proprietary_data.
  */
 DxfSurface *
 dxf_surface_set_proprietary_data
@@ -2573,8 +2600,8 @@ dxf_surface_set_proprietary_data
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
         DxfProprietaryData *proprietary_data
-                /*!< a pointer to a linked list containing the
-                 * \c proprietary_data for the entity. */
+                /*!< a pointer to a single linked list with the
+                 * \c proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2595,7 +2622,21 @@ dxf_surface_set_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->proprietary_data = proprietary_data;
+        if (surface->acis_data == NULL)
+        {
+                surface->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (surface->acis_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (dxf_acis_data_set_lines (surface->acis_data, 1, proprietary_data) == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -2604,12 +2645,16 @@ dxf_surface_set_proprietary_data
 
 
 /*!
- * \brief Get the \c additional_proprietary_data from a DXF \c SURFACE
- * entity.
+ * \brief Get the \c additional_proprietary_data from a DXF \c SURFACE entity.
  *
- * \return pointer to the \c additional_proprietary_data.
+ * The group code 3 lines of the proprietary (ACIS) data are
+ * returned.
  *
- * \warning No checks are performed on the returned pointer (string).
+ * \return a newly allocated list with the \c additional_proprietary_data, or
+ * \c NULL when the entity has none or an error occurred.
+ *
+ * \warning The caller frees the returned list with
+ * dxf_proprietary_data_free_list ().
  */
 DxfProprietaryData *
 dxf_surface_get_additional_proprietary_data
@@ -2629,23 +2674,25 @@ dxf_surface_get_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (surface->additional_proprietary_data ==  NULL)
+        if (surface->acis_data == NULL)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return (NULL);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfProprietaryData *) surface->additional_proprietary_data);
+        return (dxf_acis_data_get_lines (surface->acis_data, 3));
 }
 
 
 /*!
- * \brief Set the pointer to the additional proprietary data for a DXF
- * \c SURFACE entity.
+ * \brief Set the \c additional_proprietary_data for a DXF \c SURFACE entity.
+ *
+ * The group code 3 lines of the proprietary (ACIS) data are replaced
+ * by the lines in \c additional_proprietary_data.
+ *
+ * \warning The lines are copied, the caller keeps ownership of
+ * \c additional_proprietary_data.
  */
 DxfSurface *
 dxf_surface_set_additional_proprietary_data
@@ -2653,8 +2700,8 @@ dxf_surface_set_additional_proprietary_data
         DxfSurface *surface,
                 /*!< a pointer to a DXF \c SURFACE entity. */
         DxfProprietaryData *additional_proprietary_data
-                /*!< an array containing the additional proprietary data
-                 * for the entity. */
+                /*!< a pointer to a single linked list with the
+                 * \c additional_proprietary_data to be set for the entity. */
 )
 {
 #if DEBUG
@@ -2668,14 +2715,28 @@ dxf_surface_set_additional_proprietary_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (additional_proprietary_data ==  NULL)
+        if (additional_proprietary_data == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        surface->additional_proprietary_data = additional_proprietary_data;
+        if (surface->acis_data == NULL)
+        {
+                surface->acis_data = dxf_acis_data_init (dxf_acis_data_new ());
+                if (surface->acis_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (dxf_acis_data_set_lines (surface->acis_data, 3, additional_proprietary_data) == NULL)
+        {
+                return (NULL);
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3037,9 +3098,6 @@ dxf_surface_get_last
         }
         if (surface->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfSurface *) surface);
         }
         DxfSurface *iter = (DxfSurface *) surface->next;
@@ -3222,12 +3280,11 @@ dxf_surface_extruded_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfDouble *iter40 = NULL;
         DxfDouble *iter46 = NULL;
         DxfDouble *iter47 = NULL;
         int iter90;
-        DxfBinaryData *iter310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -3235,39 +3292,66 @@ dxf_surface_extruded_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (extruded_surface == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 extruded_surface = dxf_surface_extruded_init (extruded_surface);
         }
+        if (extruded_surface->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                extruded_surface->p0 = dxf_point_init (dxf_point_new ());
+                if (extruded_surface->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (extruded_surface->p1 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                extruded_surface->p1 = dxf_point_init (dxf_point_new ());
+                if (extruded_surface->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
         iter40 = (DxfDouble *) extruded_surface->transform_matrix;
         iter46 = (DxfDouble *) extruded_surface->sweep_matrix;
         iter47 = (DxfDouble *) extruded_surface->path_matrix;
         iter90 = 0;
-        iter310 = (DxfBinaryData *) extruded_surface->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -3455,27 +3539,27 @@ dxf_surface_extruded_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, extruded_surface->binary_data, temp_string);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, (_("DXF comment: %s\n")), temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, (_("DXF comment: %s\n")), temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -3521,13 +3605,7 @@ dxf_surface_extruded_write
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", extruded_surface->binary_data_size);
         if (extruded_surface->binary_data != NULL)
         {
-                DxfBinaryData *iter310;
-                iter310 = (DxfBinaryData *) extruded_surface->binary_data;
-                while (iter310 != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
+                dxf_binary_data_write (fp, extruded_surface->binary_data);
         }
         fprintf (fp->fp, " 10\n%f\n", extruded_surface->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", extruded_surface->p0->y0);
@@ -3623,7 +3701,10 @@ dxf_surface_extruded_free
         dxf_double_free_list (extruded_surface->transform_matrix);
         dxf_double_free_list (extruded_surface->sweep_matrix);
         dxf_double_free_list (extruded_surface->path_matrix);
-        dxf_binary_data_free_list (extruded_surface->binary_data);
+        if (extruded_surface->binary_data != NULL)
+        {
+                dxf_binary_data_free_list (extruded_surface->binary_data);
+        }
         free (extruded_surface);
         extruded_surface = NULL;
 #if DEBUG
@@ -3657,6 +3738,7 @@ dxf_surface_extruded_free_list
         while (extruded_surfaces != NULL)
         {
                 DxfSurfaceExtruded *iter = (DxfSurfaceExtruded *) extruded_surfaces->next;
+                extruded_surfaces->next = NULL;
                 dxf_surface_extruded_free (extruded_surfaces);
                 extruded_surfaces = (DxfSurfaceExtruded *) iter;
         }
@@ -5816,9 +5898,6 @@ dxf_surface_extruded_get_last
         }
         if (extruded_surface->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfSurfaceExtruded *) extruded_surface);
         }
         DxfSurfaceExtruded *iter = (DxfSurfaceExtruded *) extruded_surface->next;
@@ -5959,7 +6038,7 @@ dxf_surface_lofted_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfDouble *iter40 = NULL;
 
         /* Do some basic checks. */
@@ -5968,35 +6047,33 @@ dxf_surface_lofted_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (lofted_surface == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 lofted_surface = dxf_surface_lofted_init (lofted_surface);
         }
         iter40 = (DxfDouble *) lofted_surface->transform_matrix;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -6100,9 +6177,8 @@ dxf_surface_lofted_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &lofted_surface->virtual_guide_flag);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -6243,6 +6319,7 @@ dxf_surface_lofted_free_list
         while (lofted_surfaces != NULL)
         {
                 DxfSurfaceLofted *iter = (DxfSurfaceLofted *) lofted_surfaces->next;
+                lofted_surfaces->next = NULL;
                 dxf_surface_lofted_free (lofted_surfaces);
                 lofted_surfaces = (DxfSurfaceLofted *) iter;
         }
@@ -7310,9 +7387,6 @@ dxf_surface_lofted_get_last
         }
         if (lofted_surface->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfSurfaceLofted *) lofted_surface);
         }
         DxfSurfaceLofted *iter = (DxfSurfaceLofted *) lofted_surface->next;
@@ -7474,10 +7548,9 @@ dxf_surface_revolved_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfDouble *iter42 = NULL;
         int iter90;
-        DxfBinaryData *iter310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -7485,37 +7558,64 @@ dxf_surface_revolved_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (revolved_surface == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 revolved_surface = dxf_surface_revolved_init (revolved_surface);
         }
+        if (revolved_surface->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                revolved_surface->p0 = dxf_point_init (dxf_point_new ());
+                if (revolved_surface->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (revolved_surface->p1 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                revolved_surface->p1 = dxf_point_init (dxf_point_new ());
+                if (revolved_surface->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
         iter42 = (DxfDouble *) revolved_surface->transform_matrix;
         iter90 = 0;
-        iter310 = (DxfBinaryData *) revolved_surface->binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -7647,14 +7747,11 @@ dxf_surface_revolved_read
                 else if (strcmp (temp_string, "310") == 0)
                 {
                         /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, revolved_surface->binary_data, temp_string);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -7700,13 +7797,7 @@ dxf_surface_revolved_write
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", revolved_surface->binary_data_size);
         if (revolved_surface->binary_data != NULL)
         {
-                DxfBinaryData *iter310;
-                iter310 = (DxfBinaryData *) revolved_surface->binary_data;
-                while (iter310 != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
+                dxf_binary_data_write (fp, revolved_surface->binary_data);
         }
         fprintf (fp->fp, " 10\n%f\n", revolved_surface->p0->x0);
         fprintf (fp->fp, " 20\n%f\n", revolved_surface->p0->y0);
@@ -7775,7 +7866,10 @@ dxf_surface_revolved_free
         dxf_point_free (revolved_surface->p0);
         dxf_point_free (revolved_surface->p1);
         dxf_double_free_list (revolved_surface->transform_matrix);
-        dxf_binary_data_free_list (revolved_surface->binary_data);
+        if (revolved_surface->binary_data != NULL)
+        {
+                dxf_binary_data_free_list (revolved_surface->binary_data);
+        }
         free (revolved_surface);
         revolved_surface = NULL;
 #if DEBUG
@@ -7809,6 +7903,7 @@ dxf_surface_revolved_free_list
         while (revolved_surfaces != NULL)
         {
                 DxfSurfaceRevolved *iter = (DxfSurfaceRevolved *) revolved_surfaces->next;
+                revolved_surfaces->next = NULL;
                 dxf_surface_revolved_free (revolved_surfaces);
                 revolved_surfaces = (DxfSurfaceRevolved *) iter;
         }
@@ -9406,9 +9501,6 @@ dxf_surface_revolved_get_last
         }
         if (revolved_surface->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfSurfaceRevolved *) revolved_surface);
         }
         DxfSurfaceRevolved *iter = (DxfSurfaceRevolved *) revolved_surface->next;
@@ -9601,13 +9693,12 @@ dxf_surface_swept_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfDouble *iter40 = NULL;
         DxfDouble *iter41 = NULL;
         DxfDouble *iter46 = NULL;
         DxfDouble *iter47 = NULL;
         int iter90;
-        DxfBinaryData *iter310 = NULL;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -9615,40 +9706,52 @@ dxf_surface_swept_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (fp->acad_version_number < AutoCAD_2007)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
         if (swept_surface == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 swept_surface = dxf_surface_swept_init (swept_surface);
         }
+        if (swept_surface->p1 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                swept_surface->p1 = dxf_point_init (dxf_point_new ());
+                if (swept_surface->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
         iter40 = (DxfDouble *) swept_surface->transform_sweep_matrix;
         iter41 = (DxfDouble *) swept_surface->transform_path_matrix;
         iter46 = (DxfDouble *) swept_surface->transform_sweep_matrix2;
         iter47 = (DxfDouble *) swept_surface->transform_path_matrix2;
         iter90 = 0;
-        iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        /* Clean up. */
-                        free (temp_string);
                         fclose (fp->fp);
                         return (NULL);
                 }
@@ -9839,14 +9942,11 @@ dxf_surface_swept_read
                 {
                         /*! \todo Fix the parsing of binary data. */
                         /* Now follows a string containing binary data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, swept_surface->sweep_binary_data, temp_string);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -9892,13 +9992,7 @@ dxf_surface_swept_write
         fprintf (fp->fp, " 90\n%" PRIi32 "\n", swept_surface->sweep_binary_data_size);
         if (swept_surface->sweep_binary_data != NULL)
         {
-                DxfBinaryData *iter310;
-                iter310 = (DxfBinaryData *) swept_surface->sweep_binary_data;
-                while (iter310 != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter310->data_line);
-                        iter310 = (DxfBinaryData *) iter310->next;
-                }
+                dxf_binary_data_write (fp, swept_surface->sweep_binary_data);
         }
 
 
@@ -9947,8 +10041,14 @@ dxf_surface_swept_free
         dxf_double_free_list (swept_surface->transform_path_matrix);
         dxf_double_free_list (swept_surface->transform_sweep_matrix2);
         dxf_double_free_list (swept_surface->transform_path_matrix2);
-        dxf_binary_data_free_list (swept_surface->sweep_binary_data);
-        dxf_binary_data_free_list (swept_surface->path_binary_data);
+        if (swept_surface->sweep_binary_data != NULL)
+        {
+                dxf_binary_data_free_list (swept_surface->sweep_binary_data);
+        }
+        if (swept_surface->path_binary_data != NULL)
+        {
+                dxf_binary_data_free_list (swept_surface->path_binary_data);
+        }
         free (swept_surface);
         swept_surface = NULL;
 #if DEBUG
@@ -9982,6 +10082,7 @@ dxf_surface_swept_free_list
         while (swept_surfaces != NULL)
         {
                 DxfSurfaceSwept *iter = (DxfSurfaceSwept *) swept_surfaces->next;
+                swept_surfaces->next = NULL;
                 dxf_surface_swept_free (swept_surfaces);
                 swept_surfaces = (DxfSurfaceSwept *) iter;
         }
@@ -12003,9 +12104,6 @@ dxf_surface_swept_get_last
         }
         if (swept_surface->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found in the next member.\n")),
-                  __FUNCTION__);
                 return ((DxfSurfaceSwept *) swept_surface);
         }
         DxfSurfaceSwept *iter = (DxfSurfaceSwept *) swept_surface->next;
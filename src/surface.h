@@ -45,10 +45,10 @@
 
 
 #include "global.h"
+#include "acis_data.h"
 #include "util.h"
 #include "point.h"
 #include "binary_data.h"
-#include "proprietary_data.h"
 
 
 #ifdef __cplusplus
@@ -201,15 +201,10 @@ dxf_surface_struct
                  * Group code = 440.\n
                  * \since Introduced in version R2004. */
         /* Specific members for a DXF surface. */
-        DxfProprietaryData *proprietary_data;
-                /*!< Proprietary data (multiple lines < 255 characters
-                 * each).\n
-                 * Group code = 1. */
-        DxfProprietaryData *additional_proprietary_data;
-                /*!< Additional lines of proprietary data if previous
-                 * group 1 string is greater than 255 characters
-                 * (optional).\n
-                 * Group code = 3. */
+        DxfAcisData *acis_data;
+                /*!< Proprietary (ACIS) data, kept as read from the DXF
+                 * file and only decoded on request.\n
+                 * Group codes = 1 and 3. */
         int16_t modeler_format_version_number;
                 /*!< Modeler format version number (currently = 1).\n
                  * Group code = 70. */
@@ -596,6 +591,8 @@ char *dxf_surface_get_color_name (DxfSurface *surface);
 DxfSurface *dxf_surface_set_color_name (DxfSurface *surface, char *color_name);
 int32_t dxf_surface_get_transparency (DxfSurface *surface);
 DxfSurface *dxf_surface_set_transparency (DxfSurface *surface, int32_t transparency);
+DxfAcisData *dxf_surface_get_acis_data (DxfSurface *surface);
+DxfSurface *dxf_surface_set_acis_data (DxfSurface *surface, DxfAcisData *acis_data);
 DxfProprietaryData *dxf_surface_get_proprietary_data (DxfSurface *surface);
 DxfSurface *dxf_surface_set_proprietary_data (DxfSurface *surface, DxfProprietaryData *proprietary_data);
 DxfProprietaryData *dxf_surface_get_additional_proprietary_data (DxfSurface *surface);
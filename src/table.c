@@ -45,6 +45,7 @@
 
 
 #include "table.h"
+#include "util.h"
 
 
 /*!
@@ -327,6 +328,7 @@ dxf_table_cell_free_list
         while (cells != NULL)
         {
                 DxfTableCell *iter = (DxfTableCell *) cells->next;
+                cells->next = NULL;
                 dxf_table_cell_free (cells);
                 cells = (DxfTableCell *) iter;
         }
@@ -488,8 +490,7 @@ dxf_table_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
-        DxfBinaryData *iter310 = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         int i;
         int k;
         int l;
@@ -500,13 +501,12 @@ dxf_table_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (table == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 table = dxf_table_new ();
@@ -514,12 +514,11 @@ dxf_table_read
         }
         if (table->binary_graphics_data == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfBinaryData struct.\n")));
-                table->binary_graphics_data = dxf_binary_data_init (table->binary_graphics_data);
+                table->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
                 if (table->binary_graphics_data == NULL)
                 {
                         fprintf (stderr,
@@ -530,12 +529,11 @@ dxf_table_read
         }
         if (table->p0 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                table->p0 = dxf_point_init (table->p0);
+                table->p0 = dxf_point_init (dxf_point_new ());
                 if (table->p0 == NULL)
                 {
                         fprintf (stderr,
@@ -546,12 +544,11 @@ dxf_table_read
         }
         if (table->p1 == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                fprintf (stderr,
-                  (_("Initializing a DxfPoint.\n")));
-                table->p1 = dxf_point_init (table->p1);
+                table->p1 = dxf_point_init (dxf_point_new ());
                 if (table->p1 == NULL)
                 {
                         fprintf (stderr,
@@ -563,10 +560,9 @@ dxf_table_read
         i = 0;
         k = 0;
         l = 0;
-        iter310 = (DxfBinaryData *) table->binary_graphics_data;
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -574,17 +570,15 @@ dxf_table_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "2") == 0)
                 {
                         /* Now follows a string containing a block name;
                          * an anonymous block begins with a *T value. */
-                        fscanf (fp->fp, "%s\n", table->block_name);
+                        dxf_read_string (&table->block_name, fp);
                 }
-                if (strcmp (temp_string, "5") == 0)
+                else if (strcmp (temp_string, "5") == 0)
                 {
                         /* Now follows a string containing a sequential
                          * id number. */
@@ -700,13 +694,13 @@ dxf_table_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbBlockReference") != 0))
                         && ((strcmp (temp_string, "AcDbBlockTable") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -731,55 +725,51 @@ dxf_table_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter310->data_line);
-                        dxf_binary_data_init ((DxfBinaryData *) iter310->next);
-                        iter310 = (DxfBinaryData *) iter310->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, table->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing a soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_soft);
+                        dxf_read_string (&table->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "342") == 0)
                 {
                         /* Now follows a string containing a hard pointer
                          * ID of the TABLESTYLE object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->tablestyle_object_pointer);
+                        dxf_read_string (&table->tablestyle_object_pointer, fp);
                 }
                 else if (strcmp (temp_string, "343") == 0)
                 {
                         /* Now follows a string containing a hard pointer
                          * ID of the owning BLOCK record. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->owning_block_pointer);
+                        dxf_read_string (&table->owning_block_pointer, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing a hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", table->dictionary_owner_hard);
+                        dxf_read_string (&table->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, "%s\n", temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -885,13 +875,7 @@ dxf_table_write
         }
         else
         {
-                DxfBinaryData *iter;
-                iter = (DxfBinaryData *) table->binary_graphics_data;
-                while (iter != NULL)
-                {
-                        fprintf (fp->fp, "310\n%s\n", iter->data_line);
-                        iter = (DxfBinaryData *) iter->next;
-                }
+                dxf_binary_data_write (fp, table->binary_graphics_data);
         }
         if (fp->acad_version_number >= AutoCAD_13)
         {
@@ -990,7 +974,10 @@ dxf_table_free
         }
         free (table->linetype);
         free (table->layer);
-        dxf_binary_data_free_list (table->binary_graphics_data);
+        if (table->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (table->binary_graphics_data);
+        }
         free (table->dictionary_owner_soft);
         free (table->dictionary_owner_hard);
         free (table->block_name);
@@ -4233,9 +4220,6 @@ dxf_table_get_last
         }
         if (table->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfTable *) table);
         }
         DxfTable *iter = (DxfTable *) table->next;
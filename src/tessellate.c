@@ -0,0 +1,2342 @@
+/*!
+ * \file tessellate.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Tessellation of curved entities into polylines.
+ *
+ * Arcs, circles, ellipses, helices and bulged polylines are approximated
+ * by polylines within a chord height tolerance, in the World Coordinate
+ * System.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include "tessellate.h"
+
+
+/*!
+ * \brief Allocate memory for a tessellation.
+ *
+ * \return a pointer to an empty tessellation, or \c NULL when no memory
+ * could be allocated.
+ */
+DxfTessellation *
+dxf_tessellation_new ()
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfTessellation *tessellation;
+
+        tessellation = calloc (1, sizeof (DxfTessellation));
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (NULL);
+        }
+        tessellation->offsets = malloc (sizeof (int));
+        if (tessellation->offsets == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                free (tessellation);
+                return (NULL);
+        }
+        tessellation->offsets[0] = 0;
+        tessellation->offsets_size = 1;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (tessellation);
+}
+
+
+/*!
+ * \brief Free the allocated memory for a tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_free
+(
+        DxfTessellation *tessellation
+                /*!< Pointer to the memory occupied by the
+                 * tessellation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (tessellation->points);
+        free (tessellation->offsets);
+        free (tessellation);
+        tessellation = NULL;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Remove all curves from a tessellation, keeping the allocated
+ * memory.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_clear
+(
+        DxfTessellation *tessellation
+                /*!< Tessellation. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if (tessellation == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        tessellation->number_of_points = 0;
+        tessellation->number_of_curves = 0;
+        tessellation->offsets[0] = 0;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Get the number of segments approximating a circular arc.
+ *
+ * A segment spanning an angle \f$ \delta \f$ deviates
+ * \f$ r (1 - \cos (\delta / 2)) \f$ from the arc, the smallest number
+ * of segments keeping this within \c tolerance is used, limited to
+ * \c max_segments.
+ *
+ * \return the number of segments, at least \c 1, or \c 0 when neither a
+ * tolerance nor a maximum number of segments was given.
+ */
+int
+dxf_tessellation_get_number_of_segments
+(
+        double radius,
+                /*!< Radius of the arc. */
+        double sweep,
+                /*!< Angle of the arc in radians. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+        double n;
+        int segments;
+
+        sweep = fabs (sweep);
+        radius = fabs (radius);
+        if (tolerance > 0.0)
+        {
+                if (tolerance >= radius)
+                {
+                        n = 1.0;
+                }
+                else
+                {
+                        n = ceil (sweep / (2.0 * acos (1.0 - tolerance / radius)));
+                }
+                if ((max_segments > 0) && (n > max_segments))
+                {
+                        n = max_segments;
+                }
+                /* Guard against overflow for tiny tolerances. */
+                segments = (n > INT_MAX / 2) ? INT_MAX / 2 : (int) n;
+        }
+        else if (max_segments > 0)
+        {
+                segments = max_segments;
+        }
+        else
+        {
+                return (0);
+        }
+        return ((segments < 1) ? 1 : segments);
+}
+
+
+/*!
+ * \brief Make room for a curve of \c n points in a tessellation.
+ *
+ * \return a pointer to the first point of the new curve, or \c NULL when
+ * no memory could be allocated.
+ */
+static double *
+dxf_tessellation_begin_curve
+(
+        DxfTessellation *tessellation,
+        int n
+)
+{
+        double *points;
+        int *offsets;
+        int size;
+
+        if (tessellation->number_of_points + n > tessellation->points_size)
+        {
+                size = (tessellation->points_size > 0) ? tessellation->points_size : 256;
+                while (size < tessellation->number_of_points + n)
+                {
+                        size *= 2;
+                }
+                points = realloc (tessellation->points, 3 * (size_t) size * sizeof (double));
+                if (points == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                tessellation->points = points;
+                tessellation->points_size = size;
+        }
+        if (tessellation->number_of_curves + 2 > tessellation->offsets_size)
+        {
+                size = 2 * tessellation->offsets_size + 16;
+                offsets = realloc (tessellation->offsets, size * sizeof (int));
+                if (offsets == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+                tessellation->offsets = offsets;
+                tessellation->offsets_size = size;
+        }
+        return (tessellation->points + 3 * tessellation->number_of_points);
+}
+
+
+/*!
+ * \brief Commit a curve of \c n points started with
+ * dxf_tessellation_begin_curve ().
+ */
+static void
+dxf_tessellation_end_curve
+(
+        DxfTessellation *tessellation,
+        int n
+)
+{
+        tessellation->number_of_points += n;
+        tessellation->number_of_curves++;
+        tessellation->offsets[tessellation->number_of_curves] = tessellation->number_of_points;
+}
+
+
+/*!
+ * \brief Generate the points \f$ c + u \cos t + v \sin t \f$ for
+ * \c segments + 1 equally spaced parameters \c t from \c start over
+ * \c sweep, rising \c rise along \c w over the whole sweep.
+ *
+ * The cosine and sine are advanced by a rotation per segment, only the
+ * start and the step are computed with trigonometric functions.
+ */
+static void
+dxf_tessellation_generate
+(
+        double *points,
+                /*!< Receives 3 * (\c segments + 1) values. */
+        const double c[3],
+                /*!< Center. */
+        const double u[3],
+                /*!< Vector at parameter \c 0. */
+        const double v[3],
+                /*!< Vector at parameter \f$ \pi / 2 \f$. */
+        const double w[3],
+                /*!< Unit direction of the rise. */
+        double rise,
+                /*!< Rise over the whole sweep. */
+        double start,
+                /*!< Start parameter in radians. */
+        double sweep,
+                /*!< Sweep in radians. */
+        int segments
+                /*!< Number of segments. */
+)
+{
+        double cos_t;
+        double sin_t;
+        double cos_d;
+        double sin_d;
+        double temp;
+        double h;
+        int i;
+        int k;
+
+        cos_t = cos (start);
+        sin_t = sin (start);
+        cos_d = cos (sweep / segments);
+        sin_d = sin (sweep / segments);
+        for (i = 0; i <= segments; i++)
+        {
+                if (i == segments)
+                {
+                        /* Avoid drift at the end point. */
+                        cos_t = cos (start + sweep);
+                        sin_t = sin (start + sweep);
+                }
+                h = rise * i / segments;
+                for (k = 0; k < 3; k++)
+                {
+                        points[3 * i + k] = c[k] + cos_t * u[k] + sin_t * v[k] + h * w[k];
+                }
+                temp = cos_t * cos_d - sin_t * sin_d;
+                sin_t = sin_t * cos_d + cos_t * sin_d;
+                cos_t = temp;
+        }
+}
+
+
+/*!
+ * \brief Add a circular arc given in an OCS to a tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_tessellation_add_ocs_arc
+(
+        DxfTessellation *tessellation,
+        DxfPoint *p0,
+                /*!< Center in OCS. */
+        double radius,
+        double start,
+                /*!< Start angle in radians. */
+        double sweep,
+                /*!< Sweep in radians. */
+        double extr_x0,
+        double extr_y0,
+        double extr_z0,
+        double tolerance,
+        int max_segments
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double c[3];
+        double u[3];
+        double v[3];
+        double *points;
+        int segments;
+        int k;
+
+        if (p0 == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        segments = dxf_tessellation_get_number_of_segments (radius, sweep,
+          tolerance, max_segments);
+        if (segments == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no tolerance and no maximum number of segments were passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, segments + 1);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_axes (extr_x0, extr_y0, extr_z0, ax, ay, az);
+        for (k = 0; k < 3; k++)
+        {
+                c[k] = p0->x0 * ax[k] + p0->y0 * ay[k] + p0->z0 * az[k];
+                u[k] = radius * ax[k];
+                v[k] = radius * ay[k];
+        }
+        dxf_tessellation_generate (points, c, u, v, az, 0.0, start, sweep, segments);
+        dxf_tessellation_end_curve (tessellation, segments + 1);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an \c ARC entity to a tessellation.
+ *
+ * The arc runs counterclockwise from the start angle to the end angle
+ * in it's OCS, the points are transformed to the WCS.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_arc
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfArc *arc,
+                /*!< a pointer to a DXF \c ARC entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double sweep;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (arc == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        sweep = fmod (arc->end_angle - arc->start_angle, 360.0);
+        if (sweep <= 0.0)
+        {
+                sweep += 360.0;
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_tessellation_add_ocs_arc (tessellation, arc->p0,
+          arc->radius, arc->start_angle * M_PI / 180.0,
+          sweep * M_PI / 180.0, arc->extr_x0, arc->extr_y0,
+          arc->extr_z0, tolerance, max_segments));
+}
+
+
+/*!
+ * \brief Add a linked list of \c ARC entities to a tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_arcs
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfArc *arcs,
+                /*!< a pointer to the first DXF \c ARC entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+        DxfArc *iter;
+
+        for (iter = arcs; iter != NULL; iter = (DxfArc *) iter->next)
+        {
+                if (dxf_tessellation_add_arc (tessellation, iter, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a \c CIRCLE entity to a tessellation.
+ *
+ * The circle becomes a closed polyline starting and ending at the point
+ * on the OCS X-axis, the points are transformed to the WCS.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_circle
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfCircle *circle,
+                /*!< a pointer to a DXF \c CIRCLE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (circle == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_tessellation_add_ocs_arc (tessellation, circle->p0,
+          circle->radius, 0.0, 2.0 * M_PI, circle->extr_x0,
+          circle->extr_y0, circle->extr_z0, tolerance, max_segments));
+}
+
+
+/*!
+ * \brief Add a linked list of \c CIRCLE entities to a tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_circles
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfCircle *circles,
+                /*!< a pointer to the first DXF \c CIRCLE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+        DxfCircle *iter;
+
+        for (iter = circles; iter != NULL; iter = (DxfCircle *) iter->next)
+        {
+                if (dxf_tessellation_add_circle (tessellation, iter, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an \c ELLIPSE entity to a tessellation.
+ *
+ * The ellipse runs from the start parameter to the end parameter
+ * (radians), the minor axis is the extrusion vector cross the major axis
+ * scaled by the ratio.\n
+ * An ellipse is an affine image of a circle with the radius of the
+ * major axis, so the number of segments of that circle keeps the
+ * ellipse within the tolerance.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_ellipse
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfEllipse *ellipse,
+                /*!< a pointer to a DXF \c ELLIPSE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double c[3];
+        double u[3];
+        double v[3];
+        double major;
+        double sweep;
+        double *points;
+        int segments;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (ellipse == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((ellipse->p0 == NULL) || (ellipse->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_axes (ellipse->extr_x0, ellipse->extr_y0, ellipse->extr_z0, ax, ay, az);
+        c[0] = ellipse->p0->x0;
+        c[1] = ellipse->p0->y0;
+        c[2] = ellipse->p0->z0;
+        u[0] = ellipse->p1->x0;
+        u[1] = ellipse->p1->y0;
+        u[2] = ellipse->p1->z0;
+        v[0] = ellipse->ratio * (az[1] * u[2] - az[2] * u[1]);
+        v[1] = ellipse->ratio * (az[2] * u[0] - az[0] * u[2]);
+        v[2] = ellipse->ratio * (az[0] * u[1] - az[1] * u[0]);
+        major = sqrt (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+        sweep = fmod (ellipse->end_angle - ellipse->start_angle, 2.0 * M_PI);
+        if (sweep <= 0.0)
+        {
+                sweep += 2.0 * M_PI;
+        }
+        segments = dxf_tessellation_get_number_of_segments (major, sweep,
+          tolerance, max_segments);
+        if (segments == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no tolerance and no maximum number of segments were passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, segments + 1);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_generate (points, c, u, v, az, 0.0,
+          ellipse->start_angle, sweep, segments);
+        dxf_tessellation_end_curve (tessellation, segments + 1);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a linked list of \c ELLIPSE entities to a tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_ellipses
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfEllipse *ellipses,
+                /*!< a pointer to the first DXF \c ELLIPSE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+        DxfEllipse *iter;
+
+        for (iter = ellipses; iter != NULL; iter = (DxfEllipse *) iter->next)
+        {
+                if (dxf_tessellation_add_ellipse (tessellation, iter, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a \c HELIX entity to a tessellation.
+ *
+ * The helix winds around the axis through the axis base point along the
+ * axis vector, starting at the start point, for the number of turns,
+ * rising the turn height every turn.\n
+ * A right handed helix turns counterclockwise seen from the tip of the
+ * axis vector, a left handed one clockwise.\n
+ * The radius is the distance of the start point to the axis, or the
+ * \c radius member when the start point lies on the axis.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_helix
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfHelix *helix,
+                /*!< a pointer to a DXF \c HELIX entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double c[3];
+        double u[3];
+        double v[3];
+        double radius;
+        double along;
+        double sweep;
+        double *points;
+        int segments;
+        int k;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (helix == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((helix->p0 == NULL) || (helix->p1 == NULL) || (helix->p2 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* The axis becomes the Z-axis of an arbitrary axis system. */
+        dxf_ocs_axes (helix->p2->x0, helix->p2->y0, helix->p2->z0, ax, ay, az);
+        c[0] = helix->p0->x0;
+        c[1] = helix->p0->y0;
+        c[2] = helix->p0->z0;
+        u[0] = helix->p1->x0 - c[0];
+        u[1] = helix->p1->y0 - c[1];
+        u[2] = helix->p1->z0 - c[2];
+        along = u[0] * az[0] + u[1] * az[1] + u[2] * az[2];
+        for (k = 0; k < 3; k++)
+        {
+                c[k] += along * az[k];
+                u[k] -= along * az[k];
+        }
+        radius = sqrt (u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+        if (radius == 0.0)
+        {
+                radius = helix->radius;
+                for (k = 0; k < 3; k++)
+                {
+                        u[k] = radius * ax[k];
+                }
+        }
+        /* v is u turned a quarter turn about the axis in the direction
+         * of the helix. */
+        v[0] = az[1] * u[2] - az[2] * u[1];
+        v[1] = az[2] * u[0] - az[0] * u[2];
+        v[2] = az[0] * u[1] - az[1] * u[0];
+        if (helix->handedness == 0)
+        {
+                for (k = 0; k < 3; k++)
+                {
+                        v[k] = -v[k];
+                }
+        }
+        sweep = 2.0 * M_PI * fabs (helix->number_of_turns);
+        segments = dxf_tessellation_get_number_of_segments (radius, sweep,
+          tolerance, max_segments);
+        if (segments == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no tolerance and no maximum number of segments were passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, segments + 1);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_generate (points, c, u, v, az,
+          fabs (helix->number_of_turns) * helix->turn_height, 0.0, sweep,
+          segments);
+        dxf_tessellation_end_curve (tessellation, segments + 1);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a linked list of \c HELIX entities to a tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_helices
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfHelix *helices,
+                /*!< a pointer to the first DXF \c HELIX entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments, \c 0 for no limit. */
+)
+{
+        DxfHelix *iter;
+
+        for (iter = helices; iter != NULL; iter = (DxfHelix *) iter->next)
+        {
+                if (dxf_tessellation_add_helix (tessellation, iter, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Expand the vertices of a 2D polyline into a center line in it's
+ * OCS, tessellating the bulged segments.
+ *
+ * Every point gets three values: the X- and Y-value in the OCS and the
+ * width of the polyline at the point, interpolated along the segment
+ * from the start width to the end width of it's first vertex.\n
+ * Vertices without widths use the default widths.
+ *
+ * \return the number of points, written to \c points unless it is
+ * \c NULL.
+ */
+static int
+dxf_tessellation_expand_vertices
+(
+        DxfVertex *vertices,
+                /*!< First vertex. */
+        int closed,
+                /*!< Connect the last vertex to the first one. */
+        double default_start_width,
+                /*!< Start width of vertices without widths. */
+        double default_end_width,
+                /*!< End width of vertices without widths. */
+        double tolerance,
+                /*!< Chord height tolerance. */
+        int max_segments,
+                /*!< Maximum number of segments per bulge. */
+        double *points
+                /*!< Receives 3 values per point, or \c NULL to count
+                 * the points. */
+)
+{
+        DxfVertex *vertex;
+        DxfVertex *first;
+        DxfVertex *next;
+        double dx;
+        double dy;
+        double chord;
+        double factor;
+        double cx;
+        double cy;
+        double radius;
+        double sweep;
+        double cos_t;
+        double sin_t;
+        double cos_d;
+        double sin_d;
+        double temp;
+        double start_width;
+        double end_width;
+        int segments;
+        int n;
+        int i;
+
+        for (first = vertices; (first != NULL) && (first->p0 == NULL); first = (DxfVertex *) first->next);
+        if (first == NULL)
+        {
+                return (0);
+        }
+        if (points != NULL)
+        {
+                points[0] = first->p0->x0;
+                points[1] = first->p0->y0;
+                points[2] = ((first->start_width == 0.0) && (first->end_width == 0.0))
+                  ? default_start_width
+                  : first->start_width;
+        }
+        n = 1;
+        for (vertex = first; vertex != NULL; vertex = next)
+        {
+                for (next = (DxfVertex *) vertex->next; (next != NULL) && (next->p0 == NULL); next = (DxfVertex *) next->next);
+                if (next == NULL)
+                {
+                        if (!closed || (vertex == first)
+                          || ((vertex->p0->x0 == first->p0->x0) && (vertex->p0->y0 == first->p0->y0)))
+                        {
+                                break;
+                        }
+                        next = first;
+                }
+                if ((vertex->start_width == 0.0) && (vertex->end_width == 0.0))
+                {
+                        start_width = default_start_width;
+                        end_width = default_end_width;
+                }
+                else
+                {
+                        start_width = vertex->start_width;
+                        end_width = vertex->end_width;
+                }
+                dx = next->p0->x0 - vertex->p0->x0;
+                dy = next->p0->y0 - vertex->p0->y0;
+                chord = sqrt (dx * dx + dy * dy);
+                segments = 1;
+                if ((vertex->bulge != 0.0) && (chord > 0.0))
+                {
+                        radius = chord * (1.0 + vertex->bulge * vertex->bulge) / (4.0 * fabs (vertex->bulge));
+                        sweep = 4.0 * atan (vertex->bulge);
+                        segments = dxf_tessellation_get_number_of_segments (radius,
+                          sweep, tolerance, max_segments);
+                        if ((points != NULL) && (segments > 1))
+                        {
+                                factor = (1.0 - vertex->bulge * vertex->bulge) / (4.0 * vertex->bulge);
+                                cx = 0.5 * (vertex->p0->x0 + next->p0->x0) - factor * dy;
+                                cy = 0.5 * (vertex->p0->y0 + next->p0->y0) + factor * dx;
+                                cos_t = (vertex->p0->x0 - cx) / radius;
+                                sin_t = (vertex->p0->y0 - cy) / radius;
+                                cos_d = cos (sweep / segments);
+                                sin_d = sin (sweep / segments);
+                                for (i = 1; i < segments; i++)
+                                {
+                                        temp = cos_t * cos_d - sin_t * sin_d;
+                                        sin_t = sin_t * cos_d + cos_t * sin_d;
+                                        cos_t = temp;
+                                        points[3 * (n + i - 1)] = cx + radius * cos_t;
+                                        points[3 * (n + i - 1) + 1] = cy + radius * sin_t;
+                                        points[3 * (n + i - 1) + 2] = start_width
+                                          + (end_width - start_width) * i / segments;
+                                }
+                        }
+                }
+                if (segments < 1)
+                {
+                        segments = 1;
+                }
+                if (points != NULL)
+                {
+                        /* The end point is the vertex itself. */
+                        points[3 * (n + segments - 1)] = next->p0->x0;
+                        points[3 * (n + segments - 1) + 1] = next->p0->y0;
+                        points[3 * (n + segments - 1) + 2] = end_width;
+                }
+                n += segments;
+                if (next == first)
+                {
+                        break;
+                }
+        }
+        return (n);
+}
+
+
+/*!
+ * \brief Add the center line or the width strip of a 2D polyline to a
+ * tessellation.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_tessellation_add_vertices
+(
+        DxfTessellation *tessellation,
+        DxfVertex *vertices,
+        int closed,
+        double elevation,
+        double extr_x0,
+        double extr_y0,
+        double extr_z0,
+        double default_start_width,
+        double default_end_width,
+        int strip,
+                /*!< Add the width strip instead of the center line. */
+        double tolerance,
+        int max_segments
+)
+{
+        double ax[3];
+        double ay[3];
+        double az[3];
+        double *points;
+        double *center;
+        double x;
+        double y;
+        double w;
+        double x_next;
+        double y_next;
+        double nx0;
+        double ny0;
+        double nx1;
+        double ny1;
+        double first_nx;
+        double first_ny;
+        double mx;
+        double my;
+        double length;
+        double scale;
+        int n;
+        int i;
+        int k;
+
+        if ((tolerance <= 0.0) && (max_segments <= 0))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no tolerance and no maximum number of segments were passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        n = dxf_tessellation_expand_vertices (vertices, closed,
+          default_start_width, default_end_width, tolerance,
+          max_segments, NULL);
+        if (n == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no vertices were found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, strip ? 2 * n : n);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_ocs_axes (extr_x0, extr_y0, extr_z0, ax, ay, az);
+        /* The center line of a strip is built in the upper half of the
+         * reserved points, pair i of the strip only overwrites center
+         * points up to i. */
+        center = strip ? points + 3 * n : points;
+        dxf_tessellation_expand_vertices (vertices, closed,
+          default_start_width, default_end_width, tolerance,
+          max_segments, center);
+        if (!strip)
+        {
+                for (i = 0; i < n; i++)
+                {
+                        x = center[3 * i];
+                        y = center[3 * i + 1];
+                        for (k = 0; k < 3; k++)
+                        {
+                                points[3 * i + k] = x * ax[k] + y * ay[k] + elevation * az[k];
+                        }
+                }
+                dxf_tessellation_end_curve (tessellation, n);
+                return (EXIT_SUCCESS);
+        }
+        /* Normals of the first segment and of the segment ending at
+         * the first point. */
+        first_nx = 0.0;
+        first_ny = 0.0;
+        if (n > 1)
+        {
+                first_nx = center[1] - center[4];
+                first_ny = center[3] - center[0];
+                length = sqrt (first_nx * first_nx + first_ny * first_ny);
+                if (length > 0.0)
+                {
+                        first_nx /= length;
+                        first_ny /= length;
+                }
+        }
+        nx0 = 0.0;
+        ny0 = 0.0;
+        if (closed && (n > 2))
+        {
+                nx0 = center[3 * (n - 2) + 1] - center[3 * (n - 1) + 1];
+                ny0 = center[3 * (n - 1)] - center[3 * (n - 2)];
+                length = sqrt (nx0 * nx0 + ny0 * ny0);
+                if (length > 0.0)
+                {
+                        nx0 /= length;
+                        ny0 /= length;
+                }
+        }
+        for (i = 0; i < n; i++)
+        {
+                x = center[3 * i];
+                y = center[3 * i + 1];
+                w = 0.5 * center[3 * i + 2];
+                /* Normal of the segment starting at this point. */
+                nx1 = nx0;
+                ny1 = ny0;
+                if (i + 1 < n)
+                {
+                        x_next = center[3 * (i + 1)];
+                        y_next = center[3 * (i + 1) + 1];
+                        length = sqrt ((x_next - x) * (x_next - x) + (y_next - y) * (y_next - y));
+                        if (length > 0.0)
+                        {
+                                nx1 = (y - y_next) / length;
+                                ny1 = (x_next - x) / length;
+                        }
+                }
+                else if (closed && (n > 2))
+                {
+                        /* The last point is the first one. */
+                        nx1 = first_nx;
+                        ny1 = first_ny;
+                }
+                if ((i == 0) && !(closed && (n > 2)))
+                {
+                        nx0 = nx1;
+                        ny0 = ny1;
+                }
+                if ((i == n - 1) && !(closed && (n > 2)))
+                {
+                        nx1 = nx0;
+                        ny1 = ny0;
+                }
+                /* Miter the join, limited to four times the half
+                 * width. */
+                mx = nx0 + nx1;
+                my = ny0 + ny1;
+                length = sqrt (mx * mx + my * my);
+                if (length > 0.0)
+                {
+                        mx /= length;
+                        my /= length;
+                        scale = mx * nx1 + my * ny1;
+                        scale = (scale > 0.25) ? w / scale : 4.0 * w;
+                }
+                else
+                {
+                        mx = nx1;
+                        my = ny1;
+                        scale = w;
+                }
+                for (k = 0; k < 3; k++)
+                {
+                        points[6 * i + k] = (x + scale * mx) * ax[k]
+                          + (y + scale * my) * ay[k] + elevation * az[k];
+                        points[6 * i + 3 + k] = (x - scale * mx) * ax[k]
+                          + (y - scale * my) * ay[k] + elevation * az[k];
+                }
+                nx0 = nx1;
+                ny0 = ny1;
+        }
+        dxf_tessellation_end_curve (tessellation, 2 * n);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an \c LWPOLYLINE entity to a tessellation.
+ *
+ * The vertices are connected by straight segments, or by arcs
+ * tessellated to the tolerance where they have a bulge, and transformed
+ * from the OCS to the WCS.\n
+ * A closed polyline (flag bit 1) ends with it's first point again.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_lwpolyline
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per bulge, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (lwpolyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_tessellation_add_vertices (tessellation,
+          (DxfVertex *) lwpolyline->vertices, lwpolyline->flag & 1,
+          lwpolyline->elevation, lwpolyline->extr_x0,
+          lwpolyline->extr_y0, lwpolyline->extr_z0,
+          lwpolyline->constant_width, lwpolyline->constant_width,
+          FALSE, tolerance, max_segments));
+}
+
+
+/*!
+ * \brief Add the width strip of an \c LWPOLYLINE entity to a
+ * tessellation.
+ *
+ * The strip has two points, left and right of the center line, for
+ * every point of the center line (see
+ * dxf_tessellation_add_lwpolyline ()), to be drawn as a triangle strip.
+ * \n
+ * The width varies linearly from the start width to the end width of
+ * every vertex, vertices without widths use the constant width.\n
+ * Joins are mitered, limited to four times the half width.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_lwpolyline_strip
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfLWPolyline *lwpolyline,
+                /*!< a pointer to a DXF \c LWPOLYLINE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per bulge, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (lwpolyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_tessellation_add_vertices (tessellation,
+          (DxfVertex *) lwpolyline->vertices, lwpolyline->flag & 1,
+          lwpolyline->elevation, lwpolyline->extr_x0,
+          lwpolyline->extr_y0, lwpolyline->extr_z0,
+          lwpolyline->constant_width, lwpolyline->constant_width,
+          TRUE, tolerance, max_segments));
+}
+
+
+/*!
+ * \brief Add a \c POLYLINE entity to a tessellation.
+ *
+ * 2D polylines are expanded like an \c LWPOLYLINE (see
+ * dxf_tessellation_add_lwpolyline ()), with the elevation taken from
+ * the Z-value of the polyline.\n
+ * 3D polylines (flag bit 8) have their vertices in the WCS and no
+ * bulges, they are added as they are.\n
+ * Polygon and polyface meshes are not curves and are refused.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_polyline
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per bulge, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfVertex *vertex;
+        DxfVertex *first;
+        double *points;
+        int n;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (polyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & (16 | 64))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a mesh was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (!(polyline->flag & 8))
+        {
+                return (dxf_tessellation_add_vertices (tessellation,
+                  polyline->vertices, polyline->flag & 1,
+                  (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation,
+                  polyline->extr_x0, polyline->extr_y0, polyline->extr_z0,
+                  polyline->start_width, polyline->end_width,
+                  FALSE, tolerance, max_segments));
+        }
+        n = 0;
+        first = NULL;
+        for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                if (vertex->p0 != NULL)
+                {
+                        first = (first == NULL) ? vertex : first;
+                        n++;
+                }
+        }
+        if (n == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no vertices were found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if ((polyline->flag & 1) && (n > 1))
+        {
+                n++;
+        }
+        points = dxf_tessellation_begin_curve (tessellation, n);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        n = 0;
+        for (vertex = polyline->vertices; vertex != NULL; vertex = (DxfVertex *) vertex->next)
+        {
+                if (vertex->p0 != NULL)
+                {
+                        points[3 * n] = vertex->p0->x0;
+                        points[3 * n + 1] = vertex->p0->y0;
+                        points[3 * n + 2] = vertex->p0->z0;
+                        n++;
+                }
+        }
+        if ((polyline->flag & 1) && (n > 1))
+        {
+                points[3 * n] = first->p0->x0;
+                points[3 * n + 1] = first->p0->y0;
+                points[3 * n + 2] = first->p0->z0;
+                n++;
+        }
+        dxf_tessellation_end_curve (tessellation, n);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add the width strip of a 2D \c POLYLINE entity to a
+ * tessellation.
+ *
+ * See dxf_tessellation_add_lwpolyline_strip (), vertices without widths
+ * use the default start and end width of the polyline.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_polyline_strip
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfPolyline *polyline,
+                /*!< a pointer to a DXF \c POLYLINE entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per bulge, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (polyline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        if (polyline->flag & (8 | 16 | 64))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a 3D polyline or mesh was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (dxf_tessellation_add_vertices (tessellation,
+          polyline->vertices, polyline->flag & 1,
+          (polyline->p0 != NULL) ? polyline->p0->z0 : polyline->elevation,
+          polyline->extr_x0, polyline->extr_y0, polyline->extr_z0,
+          polyline->start_width, polyline->end_width,
+          TRUE, tolerance, max_segments));
+}
+
+
+/*!
+ * \brief Default chord height tolerance of a spline, a thousandth of
+ * the diagonal of the bounding box of it's control points.
+ */
+static double
+dxf_tessellation_spline_tolerance
+(
+        DxfSpline *spline
+)
+{
+        double min[3] = {DBL_MAX, DBL_MAX, DBL_MAX};
+        double max[3] = {-DBL_MAX, -DBL_MAX, -DBL_MAX};
+        DxfPoint *p;
+        double d;
+
+        for (p = spline->p0; p != NULL; p = (DxfPoint *) p->next)
+        {
+                min[0] = (p->x0 < min[0]) ? p->x0 : min[0];
+                min[1] = (p->y0 < min[1]) ? p->y0 : min[1];
+                min[2] = (p->z0 < min[2]) ? p->z0 : min[2];
+                max[0] = (p->x0 > max[0]) ? p->x0 : max[0];
+                max[1] = (p->y0 > max[1]) ? p->y0 : max[1];
+                max[2] = (p->z0 > max[2]) ? p->z0 : max[2];
+        }
+        if (min[0] > max[0])
+        {
+                return (1.0e-3);
+        }
+        d = sqrt ((max[0] - min[0]) * (max[0] - min[0])
+          + (max[1] - min[1]) * (max[1] - min[1])
+          + (max[2] - min[2]) * (max[2] - min[2]));
+        return ((d > 0.0) ? 1.0e-3 * d : 1.0e-3);
+}
+
+
+/*!
+ * \brief Add a \c LINE entity to a tessellation as a curve of two
+ * points.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_line
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfLine *line
+                /*!< a pointer to a DXF \c LINE entity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *points;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (line == NULL)
+          || (line->p0 == NULL) || (line->p1 == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, 2);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        points[0] = line->p0->x0;
+        points[1] = line->p0->y0;
+        points[2] = line->p0->z0;
+        points[3] = line->p1->x0;
+        points[4] = line->p1->y0;
+        points[5] = line->p1->z0;
+        dxf_tessellation_end_curve (tessellation, 2);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a \c SPLINE entity to a tessellation.
+ *
+ * The points are taken from dxf_spline_tessellate (), so a spline
+ * tessellated before with the same tolerance is not evaluated again.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * can not be evaluated or an error occurred.
+ */
+int
+dxf_tessellation_add_spline
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfSpline *spline,
+                /*!< a pointer to a DXF \c SPLINE entity. */
+        double tolerance
+                /*!< Chord height tolerance, must be positive. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        const double *source;
+        double *points;
+        int n;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (spline == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        source = dxf_spline_tessellate (spline, tolerance, &n);
+        if (source == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, n);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        memcpy (points, source, 3 * (size_t) n * sizeof (double));
+        dxf_tessellation_end_curve (tessellation, n);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an entity of any curve type to a tessellation.
+ *
+ * \c LINE, \c ARC, \c CIRCLE, \c ELLIPSE, \c HELIX, \c LWPOLYLINE,
+ * \c POLYLINE and \c SPLINE entities are supported, for a \c SPLINE a
+ * \c tolerance of \c 0.0 is replaced by a thousandth of the size of
+ * it's control polygon.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the type
+ * is not supported or an error occurred.
+ */
+int
+dxf_tessellation_add_entity
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfEntityType type,
+                /*!< Type of the entity. */
+        void *entity,
+                /*!< Entity to be added. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per arc, \c 0 for no
+                 * limit. */
+)
+{
+        switch (type)
+        {
+                case LINE:
+                        return (dxf_tessellation_add_line (tessellation,
+                          (DxfLine *) entity));
+                case ARC:
+                        return (dxf_tessellation_add_arc (tessellation,
+                          (DxfArc *) entity, tolerance, max_segments));
+                case CIRCLE:
+                        return (dxf_tessellation_add_circle (tessellation,
+                          (DxfCircle *) entity, tolerance, max_segments));
+                case ELLIPSE:
+                        return (dxf_tessellation_add_ellipse (tessellation,
+                          (DxfEllipse *) entity, tolerance, max_segments));
+                case HELIX:
+                        return (dxf_tessellation_add_helix (tessellation,
+                          (DxfHelix *) entity, tolerance, max_segments));
+                case LWPOLYLINE:
+                        return (dxf_tessellation_add_lwpolyline (tessellation,
+                          (DxfLWPolyline *) entity, tolerance, max_segments));
+                case POLYLINE:
+                        return (dxf_tessellation_add_polyline (tessellation,
+                          (DxfPolyline *) entity, tolerance, max_segments));
+                case SPLINE:
+                        if ((tolerance <= 0.0) && (entity != NULL))
+                        {
+                                tolerance = dxf_tessellation_spline_tolerance
+                                  ((DxfSpline *) entity);
+                        }
+                        return (dxf_tessellation_add_spline (tessellation,
+                          (DxfSpline *) entity, tolerance));
+                default:
+                        return (EXIT_FAILURE);
+        }
+}
+
+
+/*!
+ * \brief Append the curves of a tessellation to another one, transformed
+ * by an affine matrix.
+ *
+ * The matrix has 3 rows of 4 values, a point \c p is mapped to
+ * \f$ M_{i0} p_x + M_{i1} p_y + M_{i2} p_z + M_{i3} \f$.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_append
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation to append to. */
+        DxfTessellation *source,
+                /*!< Tessellation to be appended, must differ from
+                 * \c tessellation. */
+        const double *matrix
+                /*!< Row major 3 x 4 matrix, \c NULL for the identity. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        double *points;
+        const double *p;
+        int n;
+        int i;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (source == NULL)
+          || (tessellation == source))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (i = 0; i < source->number_of_curves; i++)
+        {
+                n = source->offsets[i + 1] - source->offsets[i];
+                points = dxf_tessellation_begin_curve (tessellation, n);
+                if (points == NULL)
+                {
+                        return (EXIT_FAILURE);
+                }
+                p = source->points + 3 * source->offsets[i];
+                if (matrix == NULL)
+                {
+                        memcpy (points, p, 3 * (size_t) n * sizeof (double));
+                }
+                else
+                {
+                        for (; points < tessellation->points
+                          + 3 * (tessellation->number_of_points + n);
+                          points += 3, p += 3)
+                        {
+                                points[0] = matrix[0] * p[0] + matrix[1] * p[1] + matrix[2] * p[2] + matrix[3];
+                                points[1] = matrix[4] * p[0] + matrix[5] * p[1] + matrix[6] * p[2] + matrix[7];
+                                points[2] = matrix[8] * p[0] + matrix[9] * p[1] + matrix[10] * p[2] + matrix[11];
+                        }
+                }
+                dxf_tessellation_end_curve (tessellation, n);
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Append a point to the open curve at the end of a tessellation.
+ *
+ * The curve is committed with dxf_tessellation_end_curve () and a
+ * count of \c 0.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_push_point
+(
+        DxfTessellation *tessellation,
+        double x,
+        double y,
+        double z
+)
+{
+        double *points;
+
+        points = dxf_tessellation_begin_curve (tessellation, 1);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        points[0] = x;
+        points[1] = y;
+        points[2] = z;
+        tessellation->number_of_points++;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add an arc of a hatch boundary edge as a separate curve.
+ *
+ * Clockwise edges store their angles mirrored about the X-axis, so
+ * they run clockwise from minus the start angle to minus the end angle.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_tessellation_add_hatch_edge_arc
+(
+        DxfTessellation *tessellation,
+        double cx,
+                /*!< X-value of the center. */
+        double cy,
+                /*!< Y-value of the center. */
+        double ux,
+                /*!< X-value of the major axis. */
+        double uy,
+                /*!< Y-value of the major axis. */
+        double ratio,
+                /*!< Ratio of the minor axis to the major axis. */
+        double start_angle,
+                /*!< Start angle in degrees. */
+        double end_angle,
+                /*!< End angle in degrees. */
+        int is_ccw,
+        double tolerance,
+        int max_segments
+)
+{
+        double c[3] = {cx, cy, 0.0};
+        double u[3] = {ux, uy, 0.0};
+        double v[3] = {-ratio * uy, ratio * ux, 0.0};
+        double w[3] = {0.0, 0.0, 1.0};
+        double *points;
+        double sweep;
+        int segments;
+
+        sweep = fmod (end_angle - start_angle, 360.0);
+        if (sweep <= 0.0)
+        {
+                sweep += 360.0;
+        }
+        if (!is_ccw)
+        {
+                start_angle = -start_angle;
+                sweep = -sweep;
+        }
+        segments = dxf_tessellation_get_number_of_segments (sqrt (ux * ux + uy * uy),
+          sweep * M_PI / 180.0, tolerance, max_segments);
+        if (segments == 0)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () no tolerance and no maximum number of segments were passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        points = dxf_tessellation_begin_curve (tessellation, segments + 1);
+        if (points == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_tessellation_generate (points, c, u, v, w, 0.0,
+          start_angle * M_PI / 180.0, sweep * M_PI / 180.0, segments);
+        dxf_tessellation_end_curve (tessellation, segments + 1);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a spline of a hatch boundary edge as a separate curve.
+ *
+ * Every nonempty knot span is sampled with a number of points derived
+ * from the tolerance and the length of the control polygon of the span.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when the spline
+ * is invalid or an error occurred.
+ */
+static int
+dxf_tessellation_add_hatch_edge_spline
+(
+        DxfTessellation *tessellation,
+        DxfHatchBoundaryPathEdgeSpline *spline,
+        double tolerance,
+        int max_segments
+)
+{
+        DxfHatchBoundaryPathEdgeSplineCp *cp;
+        double *control = NULL;
+        double d[3 * (DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS + 1)];
+        double *knots;
+        double length;
+        double alpha;
+        double u;
+        int degree;
+        int n;
+        int segments;
+        int span;
+        int i;
+        int j;
+        int r;
+
+        degree = spline->degree;
+        knots = spline->knots;
+        n = 0;
+        for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; cp != NULL; cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+        {
+                n++;
+        }
+        if ((degree < 1) || (n <= degree)
+          || (spline->number_of_knots != n + degree + 1)
+          || (n + degree + 1 > DXF_MAX_HATCH_BOUNDARY_PATH_EDGE_SPLINE_KNOTS))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () invalid spline edge found.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        /* Homogeneous control points. */
+        control = malloc (3 * n * sizeof (double));
+        if (control == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        i = 0;
+        for (cp = (DxfHatchBoundaryPathEdgeSplineCp *) spline->control_points; cp != NULL; cp = (DxfHatchBoundaryPathEdgeSplineCp *) cp->next)
+        {
+                control[3 * i + 2] = (spline->rational && (cp->weight > 0.0)) ? cp->weight : 1.0;
+                control[3 * i] = cp->x0 * control[3 * i + 2];
+                control[3 * i + 1] = cp->y0 * control[3 * i + 2];
+                i++;
+        }
+        for (span = degree; span < n; span++)
+        {
+                if (knots[span + 1] <= knots[span])
+                {
+                        continue;
+                }
+                length = 0.0;
+                for (i = span - degree; i < span; i++)
+                {
+                        length += hypot (control[3 * i + 3] / control[3 * i + 5] - control[3 * i] / control[3 * i + 2],
+                          control[3 * i + 4] / control[3 * i + 5] - control[3 * i + 1] / control[3 * i + 2]);
+                }
+                segments = (tolerance > 0.0) ? (int) ceil (sqrt (length / (8.0 * tolerance))) : max_segments;
+                if ((max_segments > 0) && (segments > max_segments))
+                {
+                        segments = max_segments;
+                }
+                if (segments < 1)
+                {
+                        segments = 1;
+                }
+                /* The first span starts the curve, the others continue
+                 * it from their second point. */
+                for (j = (tessellation->number_of_points > tessellation->offsets[tessellation->number_of_curves]) ? 1 : 0; j <= segments; j++)
+                {
+                        u = knots[span] + (knots[span + 1] - knots[span]) * j / segments;
+                        /* de Boor's algorithm. */
+                        for (i = 0; i <= degree; i++)
+                        {
+                                d[3 * i] = control[3 * (span - degree + i)];
+                                d[3 * i + 1] = control[3 * (span - degree + i) + 1];
+                                d[3 * i + 2] = control[3 * (span - degree + i) + 2];
+                        }
+                        for (r = 1; r <= degree; r++)
+                        {
+                                for (i = degree; i >= r; i--)
+                                {
+                                        alpha = (u - knots[span - degree + i])
+                                          / (knots[span + 1 + i - r] - knots[span - degree + i]);
+                                        d[3 * i] = (1.0 - alpha) * d[3 * (i - 1)] + alpha * d[3 * i];
+                                        d[3 * i + 1] = (1.0 - alpha) * d[3 * (i - 1) + 1] + alpha * d[3 * i + 1];
+                                        d[3 * i + 2] = (1.0 - alpha) * d[3 * (i - 1) + 2] + alpha * d[3 * i + 2];
+                                }
+                        }
+                        if (dxf_tessellation_push_point (tessellation,
+                          d[3 * degree] / d[3 * degree + 2],
+                          d[3 * degree + 1] / d[3 * degree + 2], 0.0) == EXIT_FAILURE)
+                        {
+                                free (control);
+                                return (EXIT_FAILURE);
+                        }
+                }
+        }
+        free (control);
+        dxf_tessellation_end_curve (tessellation, 0);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Join the curves of a tessellation into one closed curve
+ * appended to another tessellation.
+ *
+ * Starting with the first curve, the curve with an end point nearest
+ * to the end of the joined curve is appended next (reversed when
+ * needed), so the edges of a boundary path may be stored in any order
+ * and direction.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+dxf_tessellation_join_curves
+(
+        DxfTessellation *tessellation,
+        DxfTessellation *pieces
+)
+{
+        char *used;
+        const double *p;
+        double x;
+        double y;
+        double d;
+        double best;
+        int best_piece;
+        int reversed;
+        int count;
+        int first;
+        int last;
+        int i;
+        int j;
+
+        if (pieces->number_of_curves == 0)
+        {
+                return (EXIT_SUCCESS);
+        }
+        used = calloc (pieces->number_of_curves, 1);
+        if (used == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        best_piece = 0;
+        reversed = FALSE;
+        for (count = 0; count < pieces->number_of_curves; count++)
+        {
+                used[best_piece] = TRUE;
+                first = pieces->offsets[best_piece];
+                last = pieces->offsets[best_piece + 1] - 1;
+                for (i = 0; i <= last - first; i++)
+                {
+                        /* Skip the first point of a piece continuing
+                         * the joined curve. */
+                        if ((i == 0) && (count > 0))
+                        {
+                                continue;
+                        }
+                        p = pieces->points + 3 * (reversed ? last - i : first + i);
+                        if (dxf_tessellation_push_point (tessellation, p[0], p[1], p[2]) == EXIT_FAILURE)
+                        {
+                                free (used);
+                                return (EXIT_FAILURE);
+                        }
+                }
+                x = tessellation->points[3 * tessellation->number_of_points - 3];
+                y = tessellation->points[3 * tessellation->number_of_points - 2];
+                best = DBL_MAX;
+                for (j = 0; j < pieces->number_of_curves; j++)
+                {
+                        if (used[j])
+                        {
+                                continue;
+                        }
+                        p = pieces->points + 3 * pieces->offsets[j];
+                        d = (p[0] - x) * (p[0] - x) + (p[1] - y) * (p[1] - y);
+                        if (d < best)
+                        {
+                                best = d;
+                                best_piece = j;
+                                reversed = FALSE;
+                        }
+                        p = pieces->points + 3 * (pieces->offsets[j + 1] - 1);
+                        d = (p[0] - x) * (p[0] - x) + (p[1] - y) * (p[1] - y);
+                        if (d < best)
+                        {
+                                best = d;
+                                best_piece = j;
+                                reversed = TRUE;
+                        }
+                }
+        }
+        free (used);
+        /* Close the curve. */
+        p = tessellation->points + 3 * tessellation->offsets[tessellation->number_of_curves];
+        if ((p[0] != tessellation->points[3 * tessellation->number_of_points - 3])
+          || (p[1] != tessellation->points[3 * tessellation->number_of_points - 2]))
+        {
+                if (dxf_tessellation_push_point (tessellation, p[0], p[1], p[2]) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        dxf_tessellation_end_curve (tessellation, 0);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a \c HATCH boundary path polyline to a tessellation as a
+ * closed curve.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+static int
+dxf_tessellation_add_hatch_polyline
+(
+        DxfTessellation *tessellation,
+        DxfHatchBoundaryPathPolyline *polyline,
+        double tolerance,
+        int max_segments
+)
+{
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *next;
+        DxfHatchBoundaryPathPolylineVertex *first;
+        double dx;
+        double dy;
+        double chord;
+        double factor;
+        double cx;
+        double cy;
+        double radius;
+        double sweep;
+        double cos_t;
+        double sin_t;
+        double cos_d;
+        double sin_d;
+        double temp;
+        int segments;
+        int i;
+
+        first = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+        if (first == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        if (dxf_tessellation_push_point (tessellation, first->x0, first->y0, 0.0) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (vertex = first; vertex != NULL; vertex = next)
+        {
+                /* Boundary paths are always closed. */
+                next = (DxfHatchBoundaryPathPolylineVertex *) vertex->next;
+                if (next == NULL)
+                {
+                        if ((vertex == first)
+                          || ((vertex->x0 == first->x0) && (vertex->y0 == first->y0)))
+                        {
+                                break;
+                        }
+                        next = first;
+                }
+                dx = next->x0 - vertex->x0;
+                dy = next->y0 - vertex->y0;
+                chord = sqrt (dx * dx + dy * dy);
+                if ((vertex->bulge != 0.0) && (chord > 0.0))
+                {
+                        radius = chord * (1.0 + vertex->bulge * vertex->bulge) / (4.0 * fabs (vertex->bulge));
+                        sweep = 4.0 * atan (vertex->bulge);
+                        segments = dxf_tessellation_get_number_of_segments (radius,
+                          sweep, tolerance, max_segments);
+                        if (segments < 1)
+                        {
+                                segments = 1;
+                        }
+                        factor = (1.0 - vertex->bulge * vertex->bulge) / (4.0 * vertex->bulge);
+                        cx = 0.5 * (vertex->x0 + next->x0) - factor * dy;
+                        cy = 0.5 * (vertex->y0 + next->y0) + factor * dx;
+                        cos_t = (vertex->x0 - cx) / radius;
+                        sin_t = (vertex->y0 - cy) / radius;
+                        cos_d = cos (sweep / segments);
+                        sin_d = sin (sweep / segments);
+                        for (i = 1; i < segments; i++)
+                        {
+                                temp = cos_t * cos_d - sin_t * sin_d;
+                                sin_t = sin_t * cos_d + cos_t * sin_d;
+                                cos_t = temp;
+                                if (dxf_tessellation_push_point (tessellation,
+                                  cx + radius * cos_t, cy + radius * sin_t, 0.0) == EXIT_FAILURE)
+                                {
+                                        return (EXIT_FAILURE);
+                                }
+                        }
+                }
+                if (dxf_tessellation_push_point (tessellation, next->x0, next->y0, 0.0) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+                if (next == first)
+                {
+                        break;
+                }
+        }
+        dxf_tessellation_end_curve (tessellation, 0);
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Add a \c HATCH boundary path to a tessellation as closed
+ * curves.
+ *
+ * Unlike the other entities, boundary paths are added in the OCS of
+ * the hatch with Z-values of \c 0.0, ready for 2D processing.\n
+ * Every polyline of the path becomes a closed curve (ending with it's
+ * first point again), bulges are tessellated to the tolerance.
+ * The line, arc, ellipse and spline edges of the path are tessellated
+ * and joined end to end into one more closed curve, regardless of the
+ * order and direction in which they are stored.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_hatch_boundary_path
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfHatchBoundaryPath *path,
+                /*!< a pointer to a DXF \c HATCH boundary path. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per arc, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchBoundaryPathEdgeLine *line;
+        DxfHatchBoundaryPathEdgeArc *arc;
+        DxfHatchBoundaryPathEdgeEllipse *ellipse;
+        DxfHatchBoundaryPathEdgeSpline *spline;
+        DxfTessellation *pieces;
+        double *points;
+        int result = EXIT_SUCCESS;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (path == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (polyline = (DxfHatchBoundaryPathPolyline *) path->polylines; polyline != NULL; polyline = (DxfHatchBoundaryPathPolyline *) polyline->next)
+        {
+                if (dxf_tessellation_add_hatch_polyline (tessellation,
+                  polyline, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        if (path->edges == NULL)
+        {
+                return (EXIT_SUCCESS);
+        }
+        pieces = dxf_tessellation_new ();
+        if (pieces == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        for (edge = (DxfHatchBoundaryPathEdge *) path->edges; (edge != NULL) && (result == EXIT_SUCCESS); edge = (DxfHatchBoundaryPathEdge *) edge->next)
+        {
+                for (line = (DxfHatchBoundaryPathEdgeLine *) edge->lines; (line != NULL) && (result == EXIT_SUCCESS); line = (DxfHatchBoundaryPathEdgeLine *) line->next)
+                {
+                        points = dxf_tessellation_begin_curve (pieces, 2);
+                        if (points == NULL)
+                        {
+                                result = EXIT_FAILURE;
+                                break;
+                        }
+                        points[0] = line->x0;
+                        points[1] = line->y0;
+                        points[2] = 0.0;
+                        points[3] = line->x1;
+                        points[4] = line->y1;
+                        points[5] = 0.0;
+                        dxf_tessellation_end_curve (pieces, 2);
+                }
+                for (arc = (DxfHatchBoundaryPathEdgeArc *) edge->arcs; (arc != NULL) && (result == EXIT_SUCCESS); arc = (DxfHatchBoundaryPathEdgeArc *) arc->next)
+                {
+                        result = dxf_tessellation_add_hatch_edge_arc (pieces,
+                          arc->x0, arc->y0, arc->radius, 0.0, 1.0,
+                          arc->start_angle, arc->end_angle, arc->is_ccw,
+                          tolerance, max_segments);
+                }
+                for (ellipse = (DxfHatchBoundaryPathEdgeEllipse *) edge->ellipses; (ellipse != NULL) && (result == EXIT_SUCCESS); ellipse = (DxfHatchBoundaryPathEdgeEllipse *) ellipse->next)
+                {
+                        result = dxf_tessellation_add_hatch_edge_arc (pieces,
+                          ellipse->x0, ellipse->y0, ellipse->x1, ellipse->y1,
+                          ellipse->ratio, ellipse->start_angle,
+                          ellipse->end_angle, ellipse->is_ccw,
+                          tolerance, max_segments);
+                }
+                for (spline = (DxfHatchBoundaryPathEdgeSpline *) edge->splines; (spline != NULL) && (result == EXIT_SUCCESS); spline = (DxfHatchBoundaryPathEdgeSpline *) spline->next)
+                {
+                        result = dxf_tessellation_add_hatch_edge_spline (pieces,
+                          spline, tolerance, max_segments);
+                }
+        }
+        if (result == EXIT_SUCCESS)
+        {
+                result = dxf_tessellation_join_curves (tessellation, pieces);
+        }
+        dxf_tessellation_free (pieces);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (result);
+}
+
+
+/*!
+ * \brief Add all boundary paths of a \c HATCH entity to a tessellation
+ * as closed curves in the OCS of the hatch.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when an error
+ * occurred.
+ */
+int
+dxf_tessellation_add_hatch_boundary
+(
+        DxfTessellation *tessellation,
+                /*!< Tessellation. */
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        double tolerance,
+                /*!< Chord height tolerance, \c 0.0 to only use
+                 * \c max_segments. */
+        int max_segments
+                /*!< Maximum number of segments per arc, \c 0 for no
+                 * limit. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfHatchBoundaryPath *path;
+
+        /* Do some basic checks. */
+        if ((tessellation == NULL) || (hatch == NULL))
+        {
+                fprintf (stderr,
+                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        for (path = (DxfHatchBoundaryPath *) hatch->paths; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                if (dxf_tessellation_add_hatch_boundary_path (tessellation,
+                  path, tolerance, max_segments) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
+/* EOF */
@@ -0,0 +1,121 @@
+/*!
+ * \file tessellate.h
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Header file for the tessellation of curved entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#ifndef LIBDXF_SRC_TESSELLATE_H
+#define LIBDXF_SRC_TESSELLATE_H
+
+
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include "global.h"
+#include "arc.h"
+#include "circle.h"
+#include "ellipse.h"
+#include "hatch.h"
+#include "helix.h"
+#include "line.h"
+#include "lwpolyline.h"
+#include "polyline.h"
+#include "spline.h"
+#include "vertex.h"
+#include "entity.h"
+#include "util.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*!
+ * \brief Polylines approximating curved entities.
+ *
+ * The points of all curves are stored one after the other, curve \c i
+ * has the points \c offsets[i] up to \c offsets[i + 1] - 1.\n
+ * Clearing a tessellation keeps the allocated memory, so a tessellation
+ * can be refilled every frame without allocating.
+ */
+typedef struct
+dxf_tessellation_struct
+{
+        double *points;
+                /*!< X-, Y- and Z-values of the points in WCS. */
+        int number_of_points;
+                /*!< Number of points. */
+        int points_size;
+                /*!< Number of points allocated in \c points. */
+        int *offsets;
+                /*!< Index of the first point of every curve, followed
+                 * by \c number_of_points. */
+        int number_of_curves;
+                /*!< Number of curves. */
+        int offsets_size;
+                /*!< Number of entries allocated in \c offsets. */
+} DxfTessellation;
+
+
+DxfTessellation *dxf_tessellation_new ();
+int dxf_tessellation_free (DxfTessellation *tessellation);
+int dxf_tessellation_clear (DxfTessellation *tessellation);
+int dxf_tessellation_get_number_of_segments (double radius, double sweep, double tolerance, int max_segments);
+int dxf_tessellation_add_arc (DxfTessellation *tessellation, DxfArc *arc, double tolerance, int max_segments);
+int dxf_tessellation_add_arcs (DxfTessellation *tessellation, DxfArc *arcs, double tolerance, int max_segments);
+int dxf_tessellation_add_circle (DxfTessellation *tessellation, DxfCircle *circle, double tolerance, int max_segments);
+int dxf_tessellation_add_circles (DxfTessellation *tessellation, DxfCircle *circles, double tolerance, int max_segments);
+int dxf_tessellation_add_ellipse (DxfTessellation *tessellation, DxfEllipse *ellipse, double tolerance, int max_segments);
+int dxf_tessellation_add_ellipses (DxfTessellation *tessellation, DxfEllipse *ellipses, double tolerance, int max_segments);
+int dxf_tessellation_add_helix (DxfTessellation *tessellation, DxfHelix *helix, double tolerance, int max_segments);
+int dxf_tessellation_add_helices (DxfTessellation *tessellation, DxfHelix *helices, double tolerance, int max_segments);
+int dxf_tessellation_add_lwpolyline (DxfTessellation *tessellation, DxfLWPolyline *lwpolyline, double tolerance, int max_segments);
+int dxf_tessellation_add_lwpolyline_strip (DxfTessellation *tessellation, DxfLWPolyline *lwpolyline, double tolerance, int max_segments);
+int dxf_tessellation_add_polyline (DxfTessellation *tessellation, DxfPolyline *polyline, double tolerance, int max_segments);
+int dxf_tessellation_add_polyline_strip (DxfTessellation *tessellation, DxfPolyline *polyline, double tolerance, int max_segments);
+int dxf_tessellation_add_line (DxfTessellation *tessellation, DxfLine *line);
+int dxf_tessellation_add_spline (DxfTessellation *tessellation, DxfSpline *spline, double tolerance);
+int dxf_tessellation_add_entity (DxfTessellation *tessellation, DxfEntityType type, void *entity, double tolerance, int max_segments);
+int dxf_tessellation_add_hatch_boundary_path (DxfTessellation *tessellation, DxfHatchBoundaryPath *path, double tolerance, int max_segments);
+int dxf_tessellation_add_hatch_boundary (DxfTessellation *tessellation, DxfHatch *hatch, double tolerance, int max_segments);
+int dxf_tessellation_append (DxfTessellation *tessellation, DxfTessellation *source, const double *matrix);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* LIBDXF_SRC_TESSELLATE_H */
+
+
+/* EOF */
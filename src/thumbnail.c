@@ -129,8 +129,6 @@ dxf_thumbnail_init
         }
         thumbnail->number_of_bytes = 0;
         thumbnail->preview_image_data = NULL;
-        thumbnail->preview_image_data->length = 0;
-        thumbnail->preview_image_data->value = strdup ("");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -143,8 +141,10 @@ dxf_thumbnail_init
  *
  * The last line read from file contained the string "THUMBNAILIMAGE". \n
  * Now follows some data for the \c THUMBNAILIMAGE, to be terminated
- * with a "  0" string announcing the following entity, or the end of
- * the \c ENTITY section marker \c ENDSEC. \n
+ * with a "  0" string announcing the end of the \c THUMBNAILIMAGE
+ * section marker \c ENDSEC. \n
+ * The hexadecimal 310 records are decoded into one buffer of
+ * \c number_of_bytes bytes, allocated from the group code 90 value. \n
  * While parsing the DXF file store data in \c thumbnail. \n
  *
  * \return a pointer to \c thumbnail.
@@ -161,7 +161,12 @@ dxf_thumbnail_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        unsigned char *data;
+        int size;
+        int length;
+        int n;
+        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -169,35 +174,41 @@ dxf_thumbnail_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (thumbnail == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 thumbnail = dxf_thumbnail_init (thumbnail);
+                if (thumbnail == NULL)
+                {
+                        return (NULL);
+                }
         }
         if (fp->acad_version_number < AutoCAD_2000)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_ILLEGAL_VERSION,
                   (_("Warning in %s () illegal DXF version for this entity.\n")),
                   __FUNCTION__);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        free (thumbnail->preview_image_data);
+        thumbnail->preview_image_data = NULL;
+        thumbnail->number_of_bytes = 0;
+        size = 0;
+        length = 0;
+        memset (temp_string, 0, sizeof (temp_string));
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0) && !feof (fp->fp))
         {
                 if (ferror (fp->fp))
                 {
                         fprintf (stderr,
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
-                        fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 else if (strcmp (temp_string, "90") == 0)
@@ -206,33 +217,87 @@ dxf_thumbnail_read
                          * number of bytes value. */
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &thumbnail->number_of_bytes);
+                        if ((thumbnail->number_of_bytes > size)
+                          && (thumbnail->number_of_bytes <= INT_MAX / 2))
+                        {
+                                data = realloc (thumbnail->preview_image_data,
+                                  (size_t) thumbnail->number_of_bytes);
+                                if (data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                thumbnail->preview_image_data = data;
+                                size = thumbnail->number_of_bytes;
+                        }
                 }
                 else if (strcmp (temp_string, "310") == 0)
                 {
-                        /* Now follows a string containing additional
-                         * proprietary data. */
+                        /* Now follows a string containing a chunk of
+                         * the image in hexadecimal digits. */
                         (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, thumbnail->preview_image_data->value);
-                        /*! \todo preview_image_data needs a proper implementation. */
+                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        n = (int) strlen (temp_string) / 2;
+                        if (length + n > size)
+                        {
+                                /* The image is larger than announced,
+                                 * or the group code 90 is missing. */
+                                size = (2 * size > length + n) ? 2 * size : length + n + 4096;
+                                data = realloc (thumbnail->preview_image_data, (size_t) size);
+                                if (data == NULL)
+                                {
+                                        fprintf (stderr,
+                                          (_("Error in %s () could not allocate memory.\n")),
+                                          __FUNCTION__);
+                                        return (NULL);
+                                }
+                                thumbnail->preview_image_data = data;
+                        }
+                        i = dxf_binary_data_decode_hex (temp_string,
+                          thumbnail->preview_image_data + length, n);
+                        if ((i != n) || (strlen (temp_string) % 2))
+                        {
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_INVALID_BINARY_DATA,
+                                  (_("Warning in %s () invalid hexadecimal data found while reading from: %s in line: %d.\n")),
+                                  __FUNCTION__, fp->filename, fp->line_number);
+                        }
+                        length += i;
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
                         (fp->line_number)++;
                         fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                 }
+                memset (temp_string, 0, sizeof (temp_string));
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
-        /*! \todo preview_image_data needs a proper checking for data length. */
-        /* Clean up. */
-        free (temp_string);
+        if (length != thumbnail->number_of_bytes)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_INVALID_ENTITY,
+                  (_("Warning in %s () found %d bytes of image data instead of %d while reading from: %s.\n")),
+                  __FUNCTION__, length, thumbnail->number_of_bytes, fp->filename);
+                thumbnail->number_of_bytes = length;
+        }
+        if (length == 0)
+        {
+                free (thumbnail->preview_image_data);
+                thumbnail->preview_image_data = NULL;
+        }
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -241,7 +306,111 @@ dxf_thumbnail_read
 
 
 /*!
- * \brief Write a thumbnail to a DXF file.
+ * \brief Read the \c THUMBNAILIMAGE section of a DXF file.
+ *
+ * The file is scanned line by line for the start of the
+ * \c THUMBNAILIMAGE section, without parsing the other sections.
+ *
+ * \return a pointer to the thumbnail, or \c NULL when the file has no
+ * thumbnail or an error occurred.
+ */
+DxfThumbnail *
+dxf_thumbnail_read_file
+(
+        const char *filename
+                /*!< Filename of the DXF file. */
+)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        DxfFile *fp;
+        DxfThumbnail *thumbnail;
+        char line[DXF_MAX_STRING_LENGTH];
+        char *s;
+        size_t n;
+        int state;
+        int complete;
+
+        fp = dxf_read_init (filename);
+        if (fp == NULL)
+        {
+                return (NULL);
+        }
+        /* The section exists since AutoCAD 2000. */
+        fp->acad_version_number = AutoCAD_2000;
+        fp->last_id_code = 0;
+        fp->follow_strict_version_rules = 0;
+        thumbnail = NULL;
+        /* The number of lines matched of "0", "SECTION", "2" and
+         * "THUMBNAILIMAGE", a value "SECTION" always follows a group
+         * code 0. */
+        state = 0;
+        complete = 1;
+        while (fgets (line, sizeof (line), fp->fp) != NULL)
+        {
+                n = strlen (line);
+                if (complete)
+                {
+                        fp->line_number++;
+                }
+                /* Only the start of a long line is compared. */
+                if (!complete)
+                {
+                        complete = (n > 0) && (line[n - 1] == '\n');
+                        state = 0;
+                        continue;
+                }
+                complete = (n > 0) && (line[n - 1] == '\n');
+                while ((n > 0) && isspace ((unsigned char) line[n - 1]))
+                {
+                        line[--n] = '\0';
+                }
+                s = line;
+                while (*s == ' ')
+                {
+                        s++;
+                }
+                if ((state == 3) && (strcmp (s, "THUMBNAILIMAGE") == 0))
+                {
+                        /* Skip the indentation of the next group
+                         * code, as dxf_read_line () does. */
+                        fscanf (fp->fp, " ");
+                        thumbnail = dxf_thumbnail_new ();
+                        if ((thumbnail != NULL)
+                          && (dxf_thumbnail_read (fp, thumbnail) == NULL))
+                        {
+                                dxf_thumbnail_free (thumbnail);
+                                thumbnail = NULL;
+                        }
+                        break;
+                }
+                if ((state == 1) && (strcmp (s, "SECTION") == 0))
+                {
+                        state = 2;
+                }
+                else if ((state == 2) && (strcmp (s, "2") == 0))
+                {
+                        state = 3;
+                }
+                else
+                {
+                        state = (strcmp (s, "0") == 0);
+                }
+        }
+        dxf_read_close (fp);
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (thumbnail);
+}
+
+
+/*!
+ * \brief Write a \c THUMBNAILIMAGE section to a DXF file.
+ *
+ * The image is written in 310 records of 127 bytes in hexadecimal
+ * digits.
  */
 int
 dxf_thumbnail_write
@@ -255,7 +424,10 @@ dxf_thumbnail_write
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *dxf_entity_name = strdup ("THUMBNAILIMAGE");
+        char line[2 * DXF_THUMBNAIL_CHUNK_SIZE + 1];
+        const unsigned char *data;
+        int n;
+        int i;
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -263,8 +435,6 @@ dxf_thumbnail_write
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (thumbnail == NULL)
@@ -272,17 +442,14 @@ dxf_thumbnail_write
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
-        if (thumbnail->number_of_bytes < 1)
+        if ((thumbnail->number_of_bytes < 1)
+          || (thumbnail->preview_image_data == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () number of bytes was 0 or less.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (dxf_entity_name);
                 return (EXIT_FAILURE);
         }
         if (fp->acad_version_number < AutoCAD_2000)
@@ -292,12 +459,20 @@ dxf_thumbnail_write
                   __FUNCTION__);
         }
         /* Start writing output. */
-        fprintf (fp->fp, "  0\n%s\n", dxf_entity_name);
+        fprintf (fp->fp, "  0\nSECTION\n  2\nTHUMBNAILIMAGE\n");
         fprintf (fp->fp, " 90\n%d\n", thumbnail->number_of_bytes);
-        fprintf (fp->fp, "310\n%s\n", thumbnail->preview_image_data->value);
-        /*! \todo preview_image_data needs a proper implementation. */
-        /* Clean up. */
-        free (dxf_entity_name);
+        data = thumbnail->preview_image_data;
+        for (i = 0; i < thumbnail->number_of_bytes; i += DXF_THUMBNAIL_CHUNK_SIZE)
+        {
+                n = thumbnail->number_of_bytes - i;
+                if (n > DXF_THUMBNAIL_CHUNK_SIZE)
+                {
+                        n = DXF_THUMBNAIL_CHUNK_SIZE;
+                }
+                dxf_binary_data_encode_hex (data + i, n, line);
+                fprintf (fp->fp, "310\n%s\n", line);
+        }
+        fprintf (fp->fp, "  0\nENDSEC\n");
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -331,9 +506,7 @@ dxf_thumbnail_free
                   __FUNCTION__);
                 return (EXIT_FAILURE);
         }
-        free (thumbnail->preview_image_data->value);
         free (thumbnail->preview_image_data);
-        /*! \todo preview_image_data needs a proper implementation. */
         free (thumbnail);
         thumbnail = NULL;
 #if DEBUG
@@ -420,10 +593,10 @@ dxf_thumbnail_set_number_of_bytes
  * \brief Get the \c preview_image_data from a DXF \c THUMBNAILIMAGE
  * object.
  *
- * \return \c preview_image_data when sucessful, \c NULL when an error
- * occurred.
+ * \return the \c number_of_bytes bytes of the image when sucessful,
+ * \c NULL when an error occurred.
  */
-DxfChar *
+unsigned char *
 dxf_thumbnail_get_preview_image_data
 (
         DxfThumbnail *thumbnail
@@ -458,20 +631,26 @@ dxf_thumbnail_get_preview_image_data
 /*!
  * \brief Set the \c preview_image_data for a DXF \c THUMBNAILIMAGE
  * object.
+ *
+ * The image is copied and \c number_of_bytes is set.
  */
 DxfThumbnail *
 dxf_thumbnail_set_preview_image_data
 (
         DxfThumbnail *thumbnail,
                 /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
-        DxfChar *preview_image_data
+        const unsigned char *preview_image_data,
                 /*!< a pointer to the \c preview_image_data to be set
                  * for the object. */
+        int number_of_bytes
+                /*!< the number of bytes in \c preview_image_data. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        unsigned char *data;
+
         /* Do some basic checks. */
         if (thumbnail == NULL)
         {
@@ -480,293 +659,227 @@ dxf_thumbnail_set_preview_image_data
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        thumbnail->preview_image_data = preview_image_data;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (thumbnail);
-}
-
-
-/*!
- * \brief Get the \c preview_image_data value from a DXF
- * \c THUMBNAILIMAGE object.
- *
- * \return \c preview_image_data value when sucessful, \c NULL when an
- * error occurred.
- */
-char *
-dxf_thumbnail_get_preview_image_data_value
-(
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object. */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data ==  NULL)
+        if ((preview_image_data == NULL) || (number_of_bytes < 1))
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
+                  (_("Error in %s () no image data was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data->value ==  NULL)
+        data = malloc ((size_t) number_of_bytes);
+        if (data == NULL)
         {
                 fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
+        memcpy (data, preview_image_data, (size_t) number_of_bytes);
+        free (thumbnail->preview_image_data);
+        thumbnail->preview_image_data = data;
+        thumbnail->number_of_bytes = number_of_bytes;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (preview_image_data->value);
+        return (thumbnail);
 }
 
 
 /*!
- * \brief Set the \c value for a DXF \c preview_image_data of a DXF
- * \c THUMBNAILIMAGE object.
+ * \brief Read a little endian unsigned 32 bit value.
  */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_value
+static uint32_t
+dxf_thumbnail_get_uint32
 (
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        char *value
-                /*!< a pointer to the \c preview_image_data value to be
-                 * set for the object. */
+        const unsigned char *data
 )
 {
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (value == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        preview_image_data->value = value;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data);
+        return ((uint32_t) data[0]
+          | ((uint32_t) data[1] << 8)
+          | ((uint32_t) data[2] << 16)
+          | ((uint32_t) data[3] << 24));
 }
 
 
 /*!
- * \brief Get the \c length of a \c preview_image_data \c value from a
- * DXF \c THUMBNAILIMAGE object.
+ * \brief Get the format of the image in a DXF \c THUMBNAILIMAGE object.
  *
- * \return \c length when sucessful, \c NULL when an error occurred.
- */
-int
-dxf_thumbnail_get_preview_image_data_length
-(
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object
-                 * (linked list). */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
-        {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (EXIT_FAILURE);
-        }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data->length);
-}
-
-
-/*!
- * \brief Set the \c length of the \c value for a DXF
- * \c preview_image_data of a DXF \c THUMBNAILIMAGE object.
+ * AutoCAD stores a device independent bitmap without a file header,
+ * newer releases may store a PNG image.
+ *
+ * \return the format of the image, \c DXF_THUMBNAIL_FORMAT_UNKNOWN when
+ * the format is not recognized or an error occurred.
  */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_length
+DxfThumbnailFormat
+dxf_thumbnail_get_format
 (
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        int length
-                /*!< the \c length of the \c preview_image_data value to
-                 * be set for the object. */
+        DxfThumbnail *thumbnail
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        static const unsigned char png_signature[8] =
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        if (length < 0)
-        {
-                fprintf (stderr,
-                  (_("Warning in %s () a negative value was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
-        }
-        preview_image_data->length = length;
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return (preview_image_data);
-}
+                0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+        };
+        const unsigned char *data;
+        uint32_t header_size;
 
-
-/*!
- * \brief Get the \c next \c preview_image_data \c (linked list) from a
- * DXF \c THUMBNAILIMAGE object.
- *
- * \return \c next when sucessful, \c NULL when an error occurred.
- */
-DxfChar *
-dxf_thumbnail_get_preview_image_data_next
-(
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object
-                 * (linked list). */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if (thumbnail == NULL)
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
-                return (NULL);
+                return (DXF_THUMBNAIL_FORMAT_UNKNOWN);
         }
-        if (preview_image_data->next == NULL)
+        data = thumbnail->preview_image_data;
+        if ((data == NULL) || (thumbnail->number_of_bytes < 12))
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (DXF_THUMBNAIL_FORMAT_UNKNOWN);
         }
-#if DEBUG
-        DXF_DEBUG_END
-#endif
-        return ((DxfChar *) preview_image_data->next);
-}
-
-
-/*!
- * \brief Set the pointer to the \c next DXF \c preview_image_data
- * (linked list) for a DXF \c THUMBNAILIMAGE object.
- */
-DxfChar *
-dxf_thumbnail_set_preview_image_data_next
-(
-        DxfChar *preview_image_data,
-                /*!< a pointer to a DXF \c preview_image_data. */
-        DxfChar *next
-                /*!< a pointer to the the \c next \c preview_image_data
-                 * to be set for the object. */
-)
-{
-#if DEBUG
-        DXF_DEBUG_BEGIN
-#endif
-        /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if (memcmp (data, png_signature, sizeof (png_signature)) == 0)
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (DXF_THUMBNAIL_FORMAT_PNG);
         }
-        if (next == NULL)
+        /* A device independent bitmap starts with the size of it's
+         * BITMAPCOREHEADER, BITMAPINFOHEADER, BITMAPV4HEADER or
+         * BITMAPV5HEADER. */
+        header_size = dxf_thumbnail_get_uint32 (data);
+        if (((header_size == 12) || (header_size == 40)
+          || (header_size == 108) || (header_size == 124))
+          && (header_size <= (uint32_t) thumbnail->number_of_bytes))
         {
-                fprintf (stderr,
-                  (_("Error in %s () a NULL pointer was passed.\n")),
-                  __FUNCTION__);
-                return (NULL);
+                return (DXF_THUMBNAIL_FORMAT_BMP);
         }
-        preview_image_data->next = (struct DxfChar *) next;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return (preview_image_data);
+        return (DXF_THUMBNAIL_FORMAT_UNKNOWN);
 }
 
 
 /*!
- * \brief Get the pointer to the last \c preview_image_data object from a linked list
- * of DXF \c preview_image_data objects.
+ * \brief Get the image of a DXF \c THUMBNAILIMAGE object as the
+ * contents of an image file.
  *
- * \return pointer to the last \c preview_image_data object.
+ * A PNG image is copied as is, a bitmap is preceded by the
+ * BITMAPFILEHEADER of a BMP file.\n
+ * The returned memory is to be freed by the caller.
  *
- * \warning No checks are performed on the returned pointer.
+ * \return the contents of the image file, or \c NULL when the format
+ * is not recognized or an error occurred.
  */
-DxfChar *
-dxf_thumbnail_get_preview_image_data_last
+unsigned char *
+dxf_thumbnail_get_image
 (
-        DxfChar *preview_image_data
-                /*!< a pointer to a DXF \c preview_image_data object. */
+        DxfThumbnail *thumbnail,
+                /*!< a pointer to a DXF \c THUMBNAILIMAGE object. */
+        int *size
+                /*!< Receives the size of the image file in bytes. */
 )
 {
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
+        const unsigned char *data;
+        unsigned char *image;
+        uint32_t header_size;
+        uint32_t bit_count;
+        uint32_t colors;
+        uint32_t offset;
+        uint32_t file_size;
+        int header_length;
+        int i;
+
         /* Do some basic checks. */
-        if (preview_image_data == NULL)
+        if ((thumbnail == NULL) || (size == NULL))
         {
                 fprintf (stderr,
                   (_("Error in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 return (NULL);
         }
-        if (preview_image_data->next == NULL)
+        *size = 0;
+        switch (dxf_thumbnail_get_format (thumbnail))
+        {
+                case DXF_THUMBNAIL_FORMAT_PNG:
+                        header_length = 0;
+                        offset = 0;
+                        break;
+                case DXF_THUMBNAIL_FORMAT_BMP:
+                        header_length = 14;
+                        if (thumbnail->number_of_bytes > INT_MAX - header_length)
+                        {
+                                fprintf (stderr,
+                                  (_("Error in %s () the image is too large.\n")),
+                                  __FUNCTION__);
+                                return (NULL);
+                        }
+                        data = thumbnail->preview_image_data;
+                        header_size = dxf_thumbnail_get_uint32 (data);
+                        /* The pixels follow the header and the color
+                         * table. */
+                        if (header_size == 12)
+                        {
+                                bit_count = (uint32_t) data[10] | ((uint32_t) data[11] << 8);
+                                colors = (bit_count <= 8) ? (1u << bit_count) : 0;
+                                offset = header_size + 3 * colors;
+                        }
+                        else
+                        {
+                                bit_count = (uint32_t) data[14] | ((uint32_t) data[15] << 8);
+                                colors = (thumbnail->number_of_bytes >= 36) ? dxf_thumbnail_get_uint32 (data + 32) : 0;
+                                if ((colors == 0) && (bit_count <= 8))
+                                {
+                                        colors = 1u << bit_count;
+                                }
+                                offset = header_size + 4 * (colors & 0xffff);
+                                /* BI_BITFIELDS masks follow a
+                                 * BITMAPINFOHEADER. */
+                                if ((header_size == 40)
+                                  && (dxf_thumbnail_get_uint32 (data + 16) == 3))
+                                {
+                                        offset += 12;
+                                }
+                        }
+                        offset += (uint32_t) header_length;
+                        break;
+                default:
+                        fprintf (stderr,
+                          (_("Error in %s () the image format is not recognized.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+        }
+        image = malloc ((size_t) (thumbnail->number_of_bytes + header_length));
+        if (image == NULL)
         {
                 fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  (_("Error in %s () could not allocate memory.\n")),
                   __FUNCTION__);
-                return ((DxfChar *) preview_image_data);
+                return (NULL);
         }
-        DxfChar *iter = (DxfChar *) preview_image_data->next;
-        while (iter->next != NULL)
+        if (header_length > 0)
         {
-                iter = (DxfChar *) iter->next;
+                file_size = (uint32_t) (thumbnail->number_of_bytes + header_length);
+                image[0] = 'B';
+                image[1] = 'M';
+                for (i = 0; i < 4; i++)
+                {
+                        image[2 + i] = (unsigned char) (file_size >> (8 * i));
+                        image[6 + i] = 0;
+                        image[10 + i] = (unsigned char) (offset >> (8 * i));
+                }
         }
+        memcpy (image + header_length, thumbnail->preview_image_data,
+          (size_t) thumbnail->number_of_bytes);
+        *size = thumbnail->number_of_bytes + header_length;
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ((DxfChar *) iter);
+        return (image);
 }
 
 
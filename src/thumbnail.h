@@ -59,6 +59,8 @@
 
 
 #include "global.h"
+#include "binary_data.h"
+#include "util.h"
 
 
 #ifdef __cplusplus
@@ -66,8 +68,29 @@ extern "C" {
 #endif
 
 
+#define DXF_THUMBNAIL_CHUNK_SIZE 127
+        /*!< \brief Number of bytes written in a 310 record of a
+         * \c THUMBNAILIMAGE. */
+
+
+/*!
+ * \brief Formats of the image in a DXF \c THUMBNAILIMAGE.
+ */
+typedef enum
+dxf_thumbnail_format
+{
+        DXF_THUMBNAIL_FORMAT_UNKNOWN,
+                /*!< No image, or an image of an unknown format. */
+        DXF_THUMBNAIL_FORMAT_BMP,
+                /*!< Device independent bitmap, without the
+                 * BITMAPFILEHEADER of a BMP file. */
+        DXF_THUMBNAIL_FORMAT_PNG
+                /*!< PNG image. */
+} DxfThumbnailFormat;
+
+
 /*!
- * \brief DXF definition of an AutoCAD arc entity (\c THUMBNAILIMAGE).
+ * \brief DXF definition of an AutoCAD thumbnail image (\c THUMBNAILIMAGE).
  */
 typedef struct
 dxf_thumbnail_struct
@@ -76,8 +99,10 @@ dxf_thumbnail_struct
                 /*!< The number of bytes in the image (and subsequent
                  * binary chunk records).\n
                  * Group code = 90. */
-        DxfChar *preview_image_data;
-                /*!< Multiple lines (256 characters maximum per line).\n
+        unsigned char *preview_image_data;
+                /*!< The \c number_of_bytes bytes of the image, decoded
+                 * from multiple lines of hexadecimal digits (256
+                 * characters maximum per line).\n
                  * Group code = 310. */
 } DxfThumbnail;
 
@@ -85,19 +110,15 @@ dxf_thumbnail_struct
 DxfThumbnail *dxf_thumbnail_new ();
 DxfThumbnail *dxf_thumbnail_init (DxfThumbnail *thumbnail);
 DxfThumbnail *dxf_thumbnail_read (DxfFile *fp, DxfThumbnail *thumbnail);
+DxfThumbnail *dxf_thumbnail_read_file (const char *filename);
 int dxf_thumbnail_write (DxfFile *fp, DxfThumbnail *thumbnail);
 int dxf_thumbnail_free (DxfThumbnail *thumbnail);
 int dxf_thumbnail_get_number_of_bytes (DxfThumbnail *thumbnail);
 DxfThumbnail *dxf_thumbnail_set_number_of_bytes (DxfThumbnail *thumbnail, int number_of_bytes);
-DxfChar *dxf_thumbnail_get_preview_image_data (DxfThumbnail *thumbnail);
-DxfThumbnail *dxf_thumbnail_set_preview_image_data (DxfThumbnail *thumbnail, DxfChar *preview_image_data);
-char *dxf_thumbnail_get_preview_image_data_value (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_value (DxfChar *preview_image_data, char *value);
-int dxf_thumbnail_get_preview_image_data_length (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_length (DxfChar *preview_image_data, int length);
-DxfChar *dxf_thumbnail_get_preview_image_data_next (DxfChar *preview_image_data);
-DxfChar *dxf_thumbnail_set_preview_image_data_next (DxfChar *preview_image_data, DxfChar *next);
-DxfChar *dxf_thumbnail_get_preview_image_data_last (DxfChar *preview_image_data);
+unsigned char *dxf_thumbnail_get_preview_image_data (DxfThumbnail *thumbnail);
+DxfThumbnail *dxf_thumbnail_set_preview_image_data (DxfThumbnail *thumbnail, const unsigned char *preview_image_data, int number_of_bytes);
+DxfThumbnailFormat dxf_thumbnail_get_format (DxfThumbnail *thumbnail);
+unsigned char *dxf_thumbnail_get_image (DxfThumbnail *thumbnail, int *size);
 
 
 #ifdef __cplusplus
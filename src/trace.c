@@ -42,6 +42,7 @@
 
 
 #include "trace.h"
+#include "util.h"
 
 
 /*!
@@ -125,8 +126,8 @@ dxf_trace_init
         trace->paperspace = DXF_MODELSPACE;
         trace->graphics_data_size = 0;
         trace->shadow_mode = 0;
-        trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        trace->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data);
+        trace->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
+        trace->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init ((DxfBinaryData *) trace->binary_graphics_data);
         trace->dictionary_owner_soft = strdup ("");
         trace->material = strdup ("");
         trace->dictionary_owner_hard = strdup ("");
@@ -135,21 +136,13 @@ dxf_trace_init
         trace->color_value = 0;
         trace->color_name = strdup ("");
         trace->transparency = 0;
-        trace->p0->x0 = 0.0;
-        trace->p0->y0 = 0.0;
-        trace->p0->z0 = 0.0;
-        trace->p1->x0 = 0.0;
-        trace->p1->y0 = 0.0;
-        trace->p1->z0 = 0.0;
-        trace->p2->x0 = 0.0;
-        trace->p2->y0 = 0.0;
-        trace->p2->z0 = 0.0;
-        trace->p3->x0 = 0.0;
-        trace->p3->y0 = 0.0;
-        trace->p3->z0 = 0.0;
         trace->extr_x0 = 0.0;
         trace->extr_y0 = 0.0;
         trace->extr_z0 = 0.0;
+        trace->p0 = NULL;
+        trace->p1 = NULL;
+        trace->p2 = NULL;
+        trace->p3 = NULL;
         trace->next = NULL;
 #if DEBUG
         DXF_DEBUG_END
@@ -179,7 +172,7 @@ dxf_trace_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -187,20 +180,94 @@ dxf_trace_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (trace == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 trace = dxf_trace_init (trace);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (trace->binary_graphics_data == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                trace->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                if (trace->binary_graphics_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (trace->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                trace->p0 = dxf_point_init (dxf_point_new ());
+                if (trace->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (trace->p1 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                trace->p1 = dxf_point_init (dxf_point_new ());
+                if (trace->p1 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (trace->p2 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                trace->p2 = dxf_point_init (dxf_point_new ());
+                if (trace->p2 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (trace->p3 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                trace->p3 = dxf_point_init (dxf_point_new ());
+                if (trace->p3 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -208,8 +275,6 @@ dxf_trace_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -223,14 +288,12 @@ dxf_trace_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->linetype);
+                        dxf_read_string (&trace->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->layer);
+                        dxf_read_string (&trace->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -372,12 +435,12 @@ dxf_trace_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && ((strcmp (temp_string, "AcDbTrace") != 0)))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -421,31 +484,26 @@ dxf_trace_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) trace->binary_graphics_data->next);
-                        trace->binary_graphics_data = (DxfBinaryGraphicsData *) trace->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, trace->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->dictionary_owner_soft);
+                        dxf_read_string (&trace->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->material);
+                        dxf_read_string (&trace->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->dictionary_owner_hard);
+                        dxf_read_string (&trace->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -458,8 +516,7 @@ dxf_trace_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->plot_style_name);
+                        dxf_read_string (&trace->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -471,8 +528,7 @@ dxf_trace_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, trace->color_name);
+                        dxf_read_string (&trace->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -484,16 +540,20 @@ dxf_trace_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (trace->linetype, "") == 0)
@@ -504,8 +564,6 @@ dxf_trace_read
         {
                 trace->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -652,13 +710,7 @@ dxf_trace_write
 #endif
                 if (trace->binary_graphics_data != NULL)
                 {
-                        DxfBinaryGraphicsData *iter;
-                        iter = trace->binary_graphics_data;
-                        while (iter != NULL)
-                        {
-                                fprintf (fp->fp, "310\n%s\n", dxf_binary_graphics_data_get_data_line (iter));
-                                iter = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_get_next (iter);
-                        }
+                        dxf_binary_data_write (fp, trace->binary_graphics_data);
                 }
         }
         if (fp->acad_version_number >= AutoCAD_2004)
@@ -745,7 +797,10 @@ dxf_trace_free
         }
         free (trace->linetype);
         free (trace->layer);
-        dxf_binary_graphics_data_free_list (trace->binary_graphics_data);
+        if (trace->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (trace->binary_graphics_data);
+        }
         free (trace->dictionary_owner_soft);
         free (trace->material);
         free (trace->dictionary_owner_hard);
@@ -788,6 +843,7 @@ dxf_trace_free_list
         while (traces != NULL)
         {
                 DxfTrace *iter = (DxfTrace *) traces->next;
+                traces->next = NULL;
                 dxf_trace_free (traces);
                 traces = (DxfTrace *) iter;
         }
@@ -4058,9 +4114,6 @@ dxf_trace_get_last
         }
         if (trace->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfTrace *) trace);
         }
         DxfTrace *iter = (DxfTrace *) trace->next;
@@ -36,6 +36,7 @@
 
 
 #include <stdarg.h>
+#include <ctype.h>
 #include "util.h"
 
 
@@ -383,9 +384,6 @@ dxf_char_get_last
         }
         if (c->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfChar *) c);
         }
         DxfChar *iter = (DxfChar *) c->next;
@@ -468,6 +466,7 @@ dxf_char_free_list
         while (chars != NULL)
         {
                 DxfChar *iter = (DxfChar *) chars->next;
+                chars->next = NULL;
                 dxf_char_free (chars);
                 chars = (DxfChar *) iter;
         }
@@ -726,9 +725,6 @@ dxf_double_get_last
         }
         if (d->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfDouble *) d);
         }
         DxfDouble *iter = (DxfDouble *) d->next;
@@ -810,6 +806,7 @@ dxf_double_free_list
         while (doubles != NULL)
         {
                 DxfDouble *iter = (DxfDouble *) doubles->next;
+                doubles->next = NULL;
                 dxf_double_free (doubles);
                 doubles = (DxfDouble *) iter;
         }
@@ -1068,9 +1065,6 @@ dxf_int_get_last
         }
         if (i->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfInt *) i);
         }
         DxfInt *iter = (DxfInt *) i->next;
@@ -1152,6 +1146,7 @@ dxf_int_free_list
         while (ints != NULL)
         {
                 DxfInt *iter = (DxfInt *) ints->next;
+                ints->next = NULL;
                 dxf_int_free (ints);
                 ints = (DxfInt *) iter;
         }
@@ -1410,9 +1405,6 @@ dxf_int16_get_last
         }
         if (i->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfInt16 *) i);
         }
         DxfInt16 *iter = (DxfInt16 *) i->next;
@@ -1494,6 +1486,7 @@ dxf_int16_free_list
         while (ints != NULL)
         {
                 DxfInt16 *iter = (DxfInt16 *) ints->next;
+                ints->next = NULL;
                 dxf_int16_free (ints);
                 ints = (DxfInt16 *) iter;
         }
@@ -1752,9 +1745,6 @@ dxf_int32_get_last
         }
         if (i->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfInt32 *) i);
         }
         DxfInt32 *iter = (DxfInt32 *) i->next;
@@ -1836,6 +1826,7 @@ dxf_int32_free_list
         while (ints != NULL)
         {
                 DxfInt32 *iter = (DxfInt32 *) ints->next;
+                ints->next = NULL;
                 dxf_int32_free (ints);
                 ints = (DxfInt32 *) iter;
         }
@@ -2094,9 +2085,6 @@ dxf_int64_get_last
         }
         if (i->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfInt64 *) i);
         }
         DxfInt64 *iter = (DxfInt64 *) i->next;
@@ -2353,6 +2341,12 @@ dxf_read_init
         file->fp = fp;
         file->filename = strdup(filename);
         file->line_number = 0;
+        file->last_id_code = 0;
+        file->acad_version_number = 0;
+        file->follow_strict_version_rules = FALSE;
+        file->load_options = NULL;
+        file->diagnostics = NULL;
+        file->drawing = NULL;
         /*! \todo FIXME: dxf header and blocks need initialized ?
         dxf_header_init (file->dxf_header);
         dxf_block_init (file->dxf_block);
@@ -2393,11 +2387,72 @@ dxf_read_close
 }
 
 
+/*!
+ * \brief Reads a value line from a file.
+ *
+ * Reads the next line from \c fp file and stores it into the
+ * temp_string, without the line terminator (\c LF or \c CR \c LF).\n
+ * The value is kept as is, an empty line yields an empty string.\n
+ * The part of a line that does not fit in \c DXF_MAX_STRING_LENGTH
+ * characters is skipped.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file or when an error occurred.
+ */
+int
+dxf_read_value_line (char * temp_string, DxfFile *fp)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        size_t length;
+        int ch;
+
+        temp_string[0] = '\0';
+        if (fgets (temp_string, DXF_MAX_STRING_LENGTH, fp->fp) == NULL)
+        {
+                temp_string[0] = '\0';
+                if (ferror (fp->fp))
+                {
+                        fprintf (stderr,
+                          (_("Error: while reading from: %s in line: %d.\n")),
+                          fp->filename, fp->line_number);
+                }
+                return (EXIT_FAILURE);
+        }
+        fp->line_number++;
+        length = strlen (temp_string);
+        if ((length > 0) && (temp_string[length - 1] != '\n'))
+        {
+                /* Skip the remainder of a line that is too long. */
+                do
+                {
+                        ch = fgetc (fp->fp);
+                }
+                while ((ch != EOF) && (ch != '\n'));
+        }
+        while ((length > 0)
+          && ((temp_string[length - 1] == '\n')
+          || (temp_string[length - 1] == '\r')))
+        {
+                temp_string[--length] = '\0';
+        }
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
+}
+
+
 /*!
  * \brief Reads a line from a file.
- * 
- * Reads the next line from \c fp file and stores it into the temp_string.
- * 
+ *
+ * Reads the next line from \c fp file and stores it into the
+ * temp_string, without the line terminator and without leading and
+ * trailing white space, as used for group codes and names.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file or when an error occurred.
  */
 int
 dxf_read_line (char * temp_string, DxfFile *fp)
@@ -2405,24 +2460,70 @@ dxf_read_line (char * temp_string, DxfFile *fp)
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        int ret;
+        size_t length;
+        size_t first;
 
-        ret = fscanf (fp->fp, "%[^\n]\n", temp_string);
-        if (ferror (fp->fp))
+        if (dxf_read_value_line (temp_string, fp) == EXIT_FAILURE)
         {
-                fprintf (stderr,
-                  (_("Error: while reading from: %s in line: %d.\n")),
-                  fp->filename, fp->line_number);
                 return (EXIT_FAILURE);
         }
-        if (ret)
+        length = strlen (temp_string);
+        while ((length > 0) && (isspace ((unsigned char) temp_string[length - 1])))
         {
-                fp->line_number++;
+                temp_string[--length] = '\0';
+        }
+        first = 0;
+        while (isspace ((unsigned char) temp_string[first]))
+        {
+                first++;
+        }
+        if (first > 0)
+        {
+                memmove (temp_string, temp_string + first, length - first + 1);
         }
 #if DEBUG
         DXF_DEBUG_END
 #endif
-        return ret;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Reads a string value from a file.
+ *
+ * Reads the next line from \c fp file like dxf_read_value_line ()
+ * and replaces \c string with a copy of it.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file or when an error occurred.
+ */
+int
+dxf_read_string (char ** string, DxfFile *fp)
+{
+#if DEBUG
+        DXF_DEBUG_BEGIN
+#endif
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        char *value;
+
+        if (dxf_read_value_line (temp_string, fp) == EXIT_FAILURE)
+        {
+                return (EXIT_FAILURE);
+        }
+        value = strdup (temp_string);
+        if (value == NULL)
+        {
+                fprintf (stderr,
+                  (_("Error in %s () could not allocate memory.\n")),
+                  __FUNCTION__);
+                return (EXIT_FAILURE);
+        }
+        free (*string);
+        *string = value;
+#if DEBUG
+        DXF_DEBUG_END
+#endif
+        return (EXIT_SUCCESS);
 }
 
 /*!
@@ -2472,4 +2573,96 @@ dxf_read_scanf (DxfFile *fp, const char *template, ...)
 }
 
 
+/*!
+ * \brief Get the current local time as a julian date, as used for the
+ * time stamps of index objects.
+ *
+ * \return the julian date, or \c 0.0 when the time is not available.
+ */
+double
+dxf_julian_date_now ()
+{
+        time_t now;
+        float fraction_day;
+        int JD;
+        struct tm *current_time;
+
+        if (time (&now) == (time_t)(-1))
+        {
+                return (0.0);
+        }
+        current_time = localtime (&now);
+        /* Transform the current local gregorian date in a julian date.*/
+        JD = current_time->tm_mday - 32075 + 1461 * (current_time->tm_year + 6700 + (current_time->tm_mon - 13) / 12) / 4 + 367 * (current_time->tm_mon - 1 - (current_time->tm_mon - 13) / 12 * 12) / 12 - 3 * ((current_time->tm_year + 6800 + (current_time->tm_mon - 13) / 12) / 100) / 4;
+        /* Transform the current local clock time in fraction of day.*/
+        fraction_day = (current_time->tm_hour + (current_time->tm_min / 60.0) + (current_time->tm_sec / 3600.0)) / 24.0;
+        return ((double) (JD + fraction_day));
+}
+
+
+/*!
+ * \brief Compute the axes of an Object Coordinate System (OCS) with the
+ * arbitrary axis algorithm.
+ *
+ * A zero length extrusion vector yields the World Coordinate System.\n
+ * A point (x, y, z) in the OCS is x * \c ax + y * \c ay + z * \c az
+ * in the WCS.
+ */
+void
+dxf_ocs_axes
+(
+        double extr_x0,
+                /*!< X-value of the extrusion vector. */
+        double extr_y0,
+                /*!< Y-value of the extrusion vector. */
+        double extr_z0,
+                /*!< Z-value of the extrusion vector. */
+        double ax[3],
+                /*!< OCS X-axis in WCS. */
+        double ay[3],
+                /*!< OCS Y-axis in WCS. */
+        double az[3]
+                /*!< OCS Z-axis in WCS. */
+)
+{
+        double length;
+
+        length = sqrt (extr_x0 * extr_x0 + extr_y0 * extr_y0 + extr_z0 * extr_z0);
+        if (length == 0.0)
+        {
+                az[0] = 0.0;
+                az[1] = 0.0;
+                az[2] = 1.0;
+        }
+        else
+        {
+                az[0] = extr_x0 / length;
+                az[1] = extr_y0 / length;
+                az[2] = extr_z0 / length;
+        }
+        if ((fabs (az[0]) < (1.0 / 64.0)) && (fabs (az[1]) < (1.0 / 64.0)))
+        {
+                /* Ax = Wy x N */
+                ax[0] = az[2];
+                ax[1] = 0.0;
+                ax[2] = -az[0];
+        }
+        else
+        {
+                /* Ax = Wz x N */
+                ax[0] = -az[1];
+                ax[1] = az[0];
+                ax[2] = 0.0;
+        }
+        length = sqrt (ax[0] * ax[0] + ax[1] * ax[1] + ax[2] * ax[2]);
+        ax[0] /= length;
+        ax[1] /= length;
+        ax[2] /= length;
+        /* Ay = N x Ax */
+        ay[0] = az[1] * ax[2] - az[2] * ax[1];
+        ay[1] = az[2] * ax[0] - az[0] * ax[2];
+        ay[2] = az[0] * ax[1] - az[1] * ax[0];
+}
+
+
 /* EOF */
@@ -124,10 +124,14 @@ int dxf_read_is_int16_t (int type);
 int dxf_read_is_int32_t (int type);
 int dxf_read_is_int64_t (int type);
 int dxf_read_is_string (int type);
+int dxf_read_value_line (char * temp_string, DxfFile *fp);
 int dxf_read_line (char * temp_string, DxfFile *fp);
+int dxf_read_string (char ** string, DxfFile *fp);
 int dxf_read_scanf (DxfFile *fp, const char *template, ...);
 DxfFile *dxf_read_init (const char *filename);
 void dxf_read_close (DxfFile *file);
+double dxf_julian_date_now ();
+void dxf_ocs_axes (double extr_x0, double extr_y0, double extr_z0, double ax[3], double ay[3], double az[3]);
 
 
 #ifdef __cplusplus
@@ -42,6 +42,7 @@
 
 
 #include "vertex.h"
+#include "util.h"
 
 
 /*!
@@ -121,8 +122,8 @@ dxf_vertex_init
         vertex->paperspace = DXF_MODELSPACE;
         vertex->graphics_data_size = 0;
         vertex->shadow_mode = 0;
-        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_new ();
-        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data);
+        vertex->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_new ();
+        vertex->binary_graphics_data = (DxfBinaryData *) dxf_binary_data_init ((DxfBinaryData *) vertex->binary_graphics_data);
         vertex->dictionary_owner_soft = strdup ("");
         vertex->material = strdup ("");
         vertex->dictionary_owner_hard = strdup ("");
@@ -176,7 +177,7 @@ dxf_vertex_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -184,20 +185,49 @@ dxf_vertex_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vertex == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vertex = dxf_vertex_init (vertex);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (vertex->binary_graphics_data == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                vertex->binary_graphics_data = dxf_binary_data_init (dxf_binary_data_new ());
+                if (vertex->binary_graphics_data == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (vertex->p0 == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                vertex->p0 = dxf_point_init (dxf_point_new ());
+                if (vertex->p0 == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -205,8 +235,6 @@ dxf_vertex_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -220,14 +248,12 @@ dxf_vertex_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->linetype);
+                        dxf_read_string (&vertex->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->layer);
+                        dxf_read_string (&vertex->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -369,14 +395,14 @@ dxf_vertex_read
                 {
                         /* Now follows a string containing the
                          * subclass marker value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if ((strcmp (temp_string, "AcDbEntity") != 0)
                         && (strcmp (temp_string, "AcDbVertex") != 0)
                         && (strcmp (temp_string, "AcDb2dVertex") != 0)
                         && (strcmp (temp_string, "AcDb3dPolylineVertex") != 0))
                         {
-                                fprintf (stderr,
+                                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                                  DXF_DIAGNOSTIC_BAD_SUBCLASS_MARKER,
                                   (_("Warning in %s () found a bad subclass marker in: %s in line: %d.\n")),
                                   __FUNCTION__, fp->filename, fp->line_number);
                         }
@@ -399,31 +425,26 @@ dxf_vertex_read
                 {
                         /* Now follows a string containing binary
                          * graphics data. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->binary_graphics_data->data_line);
-                        dxf_binary_graphics_data_init ((DxfBinaryGraphicsData *) vertex->binary_graphics_data->next);
-                        vertex->binary_graphics_data = (DxfBinaryGraphicsData *) vertex->binary_graphics_data->next;
+                        dxf_read_line (temp_string, fp);
+                        dxf_binary_data_append_hex (fp, vertex->binary_graphics_data, temp_string);
                 }
                 else if (strcmp (temp_string, "330") == 0)
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_soft);
+                        dxf_read_string (&vertex->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "347") == 0)
                 {
                         /* Now follows a string containing a
                          * hard-pointer ID/handle to material object. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->material);
+                        dxf_read_string (&vertex->material, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->dictionary_owner_hard);
+                        dxf_read_string (&vertex->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "370") == 0)
                 {
@@ -436,8 +457,7 @@ dxf_vertex_read
                 {
                         /* Now follows a string containing a plot style
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->plot_style_name);
+                        dxf_read_string (&vertex->plot_style_name, fp);
                 }
                 else if (strcmp (temp_string, "420") == 0)
                 {
@@ -449,8 +469,7 @@ dxf_vertex_read
                 {
                         /* Now follows a string containing a color
                          * name value. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vertex->color_name);
+                        dxf_read_string (&vertex->color_name, fp);
                 }
                 else if (strcmp (temp_string, "440") == 0)
                 {
@@ -462,16 +481,20 @@ dxf_vertex_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (vertex->linetype, "") == 0)
@@ -482,8 +505,6 @@ dxf_vertex_read
         {
                 vertex->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -712,7 +733,10 @@ dxf_vertex_free
         }
         free (vertex->linetype);
         free (vertex->layer);
-        dxf_binary_graphics_data_free_list (vertex->binary_graphics_data);
+        if (vertex->binary_graphics_data != NULL)
+        {
+                dxf_binary_data_free_list (vertex->binary_graphics_data);
+        }
         free (vertex->dictionary_owner_soft);
         free (vertex->material);
         free (vertex->dictionary_owner_hard);
@@ -752,6 +776,7 @@ dxf_vertex_free_list
         while (vertices != NULL)
         {
                 DxfVertex *iter = (DxfVertex *) vertices->next;
+                vertices->next = NULL;
                 dxf_vertex_free (vertices);
                 vertices = (DxfVertex *) iter;
         }
@@ -3368,9 +3393,6 @@ dxf_vertex_get_last
         }
         if (vertex->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfVertex *) vertex);
         }
         DxfVertex *iter = (DxfVertex *) vertex->next;
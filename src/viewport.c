@@ -214,7 +214,7 @@ dxf_viewport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
         DxfChar *iter = NULL;
 
         /* Do some basic checks. */
@@ -223,20 +223,109 @@ dxf_viewport_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (viewport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 viewport = dxf_viewport_init (viewport);
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        if (viewport->center == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                viewport->center = dxf_point_init (dxf_point_new ());
+                if (viewport->center == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (viewport->direction == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                viewport->direction = dxf_point_init (dxf_point_new ());
+                if (viewport->direction == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (viewport->snap_base == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                viewport->snap_base = dxf_point_init (dxf_point_new ());
+                if (viewport->snap_base == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (viewport->snap_spacing == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                viewport->snap_spacing = dxf_point_init (dxf_point_new ());
+                if (viewport->snap_spacing == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (viewport->target == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                viewport->target = dxf_point_init (dxf_point_new ());
+                if (viewport->target == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        if (viewport->view_center == NULL)
+        {
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
+                  (_("Warning in %s () a NULL pointer was found.\n")),
+                  __FUNCTION__);
+                viewport->view_center = dxf_point_init (dxf_point_new ());
+                if (viewport->view_center == NULL)
+                {
+                        fprintf (stderr,
+                          (_("Error in %s () could not allocate memory.\n")),
+                          __FUNCTION__);
+                        return (NULL);
+                }
+        }
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -244,8 +333,6 @@ dxf_viewport_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -259,14 +346,12 @@ dxf_viewport_read
                 {
                         /* Now follows a string containing a linetype
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->linetype);
+                        dxf_read_string (&viewport->linetype, fp);
                 }
                 else if (strcmp (temp_string, "8") == 0)
                 {
                         /* Now follows a string containing a layer name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->layer);
+                        dxf_read_string (&viewport->layer, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -366,17 +451,16 @@ dxf_viewport_read
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
                 else if (strcmp (temp_string, "1001") == 0)
                 {
                         /* Now follows a sequence of ordered data fields. */
                         /* Now follows a string containing the appname,
                          * always "ACAD". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->app_name);
+                        dxf_read_string (&viewport->app_name, fp);
                         if (strcmp (viewport->app_name, "ACAD") == 1)
                         {
                                 fprintf (stderr,
@@ -387,8 +471,7 @@ dxf_viewport_read
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1000") == 1)
                         {
                                 fprintf (stderr,
@@ -400,8 +483,7 @@ dxf_viewport_read
                         }
                         /* Now follows a string containing the viewport
                          * data, always "MVIEW". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->viewport_data);
+                        dxf_read_string (&viewport->viewport_data, fp);
                         if (strcmp (viewport->viewport_data, "MVIEW") == 1)
                         {
                                 fprintf (stderr,
@@ -412,8 +494,7 @@ dxf_viewport_read
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1002") == 1)
                         {
                                 fprintf (stderr,
@@ -425,8 +506,7 @@ dxf_viewport_read
                         }
                         /* Now follows a string containing the window
                          * begin descriptor, always "{". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_begin);
+                        dxf_read_string (&viewport->window_descriptor_begin, fp);
                         if (strcmp (viewport->window_descriptor_begin, "{") == 1)
                         {
                                 fprintf (stderr,
@@ -436,8 +516,7 @@ dxf_viewport_read
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -452,8 +531,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->extended_entity_data_version);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1010") == 1)
                         {
                                 fprintf (stderr,
@@ -467,8 +545,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->target->x0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1020") == 1)
                         {
                                 fprintf (stderr,
@@ -482,8 +559,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->target->y0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1030") == 1)
                         {
                                 fprintf (stderr,
@@ -497,8 +573,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->target->z0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1010") == 1)
                         {
                                 fprintf (stderr,
@@ -512,8 +587,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->direction->x0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1020") == 1)
                         {
                                 fprintf (stderr,
@@ -527,8 +601,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->direction->y0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1030") == 1)
                         {
                                 fprintf (stderr,
@@ -542,8 +615,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->direction->z0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -558,8 +630,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->view_twist_angle);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -574,8 +645,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->view_height);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -590,8 +660,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->view_center->x0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -606,8 +675,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->view_center->y0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -622,8 +690,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->perspective_lens_length);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -638,8 +705,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->front_plane_offset);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -654,8 +720,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->back_plane_offset);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -669,8 +734,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->view_mode);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -685,8 +749,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->circle_zoom_percent);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -701,8 +764,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->fast_zoom_setting);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -717,8 +779,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->UCSICON_setting);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -733,8 +794,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->snap_on);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -749,8 +809,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->grid_on);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -765,8 +824,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->snap_style);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -781,8 +839,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->snap_isopair);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -797,8 +854,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->snap_rotation_angle);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -813,8 +869,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->snap_base->x0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -829,8 +884,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->snap_base->y0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -845,8 +899,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->snap_spacing->x0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1040") == 1)
                         {
                                 fprintf (stderr,
@@ -861,8 +914,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%lf\n", &viewport->snap_spacing->y0);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1070") == 1)
                         {
                                 fprintf (stderr,
@@ -876,8 +928,7 @@ dxf_viewport_read
                         (fp->line_number)++;
                         fscanf (fp->fp, "%d\n", &viewport->plot_flag);
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1002") == 1)
                         {
                                 fprintf (stderr,
@@ -889,8 +940,7 @@ dxf_viewport_read
                         }
                         /* Now follows a string containing the frozen
                          * layer list begin descriptor, always "{". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_begin);
+                        dxf_read_string (&viewport->frozen_layer_list_begin, fp);
                         if (strcmp (viewport->frozen_layer_list_begin, "{") == 1)
                         {
                                 fprintf (stderr,
@@ -902,8 +952,7 @@ dxf_viewport_read
                         }
                         /* Now follows a string containing a group code
                          * value of "1003". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1003") == 0)
                         {
                                 /* Start a loop reading all frozen layer
@@ -913,11 +962,9 @@ dxf_viewport_read
                                 iter = (DxfChar *) viewport->frozen_layers;
                                 do
                                 {
-                                        (fp->line_number)++;
-                                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, iter->value);
+                                        dxf_read_string (&iter->value, fp);
                                         /* Now follows a string containing a group code. */
-                                        (fp->line_number)++;
-                                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                                        dxf_read_line (temp_string, fp);
                                         iter->next = (DxfChar *) dxf_char_init ((DxfChar *) iter->next);
                                         iter = (DxfChar *) iter->next;
                                 }
@@ -953,8 +1000,7 @@ dxf_viewport_read
                         }
                         /* Now follows a string containing the frozen
                          * layer list end descriptor, always "}". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->frozen_layer_list_end);
+                        dxf_read_string (&viewport->frozen_layer_list_end, fp);
                         if (strcmp (viewport->frozen_layer_list_end, "}") == 1)
                         {
                                 fprintf (stderr,
@@ -965,8 +1011,7 @@ dxf_viewport_read
                                 return (NULL);
                         }
                         /* Now follows a string containing a group code. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
+                        dxf_read_line (temp_string, fp);
                         if (strcmp (temp_string, "1002") == 1)
                         {
                                 fprintf (stderr,
@@ -978,8 +1023,7 @@ dxf_viewport_read
                         }
                         /* Now follows a string containing the window
                          * end descriptor, always "}". */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, viewport->window_descriptor_end);
+                        dxf_read_string (&viewport->window_descriptor_end, fp);
                         if (strcmp (viewport->window_descriptor_end, "}") == 1)
                         {
                                 fprintf (stderr,
@@ -993,10 +1037,14 @@ dxf_viewport_read
                 /* End of sequential ordered data fields. */
                 else 
                 {
-                        fprintf (stderr,
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
                           (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
                 }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if (strcmp (viewport->linetype, "") == 0)
@@ -1007,8 +1055,6 @@ dxf_viewport_read
         {
                 viewport->layer = strdup (DXF_DEFAULT_LAYER);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -1284,6 +1330,7 @@ dxf_viewport_free_list
         while (viewports != NULL)
         {
                 DxfViewport *iter = (DxfViewport *) viewports->next;
+                viewports->next = NULL;
                 dxf_viewport_free (viewports);
                 viewports = (DxfViewport *) iter;
         }
@@ -6674,9 +6721,6 @@ dxf_viewport_get_last
         }
         if (viewport->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfViewport *) viewport);
         }
         DxfViewport *iter = (DxfViewport *) viewport->next;
@@ -46,6 +46,7 @@
 
 
 #include "vport.h"
+#include "util.h"
 
 
 /*!
@@ -203,7 +204,7 @@ dxf_vport_read
 #if DEBUG
         DXF_DEBUG_BEGIN
 #endif
-        char *temp_string = NULL;
+        char temp_string[DXF_MAX_STRING_LENGTH];
 
         /* Do some basic checks. */
         if (fp == NULL)
@@ -211,77 +212,84 @@ dxf_vport_read
                 fprintf (stderr,
                   (_("Error in %s () a NULL file pointer was passed.\n")),
                   __FUNCTION__);
-                /* Clean up. */
-                free (temp_string);
                 return (NULL);
         }
         if (vport == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_NULL_POINTER,
                   (_("Warning in %s () a NULL pointer was passed.\n")),
                   __FUNCTION__);
                 vport = dxf_vport_init (vport);
         }
         if (vport->min == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->min = dxf_point_init (vport->min);
+                vport->min = dxf_point_init (dxf_point_new ());
         }
         if (vport->max == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->max = dxf_point_init (vport->max);
+                vport->max = dxf_point_init (dxf_point_new ());
         }
         if (vport->center == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->center = dxf_point_init (vport->center);
+                vport->center = dxf_point_init (dxf_point_new ());
         }
         if (vport->snap_base == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->snap_base = dxf_point_init (vport->snap_base);
+                vport->snap_base = dxf_point_init (dxf_point_new ());
         }
         if (vport->snap_spacing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->snap_spacing = dxf_point_init (vport->snap_spacing);
+                vport->snap_spacing = dxf_point_init (dxf_point_new ());
         }
         if (vport->grid_spacing == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->grid_spacing = dxf_point_init (vport->grid_spacing);
+                vport->grid_spacing = dxf_point_init (dxf_point_new ());
         }
         if (vport->direction == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
-                vport->direction = dxf_point_init (vport->direction);
+                vport->direction = dxf_point_init (dxf_point_new ());
         }
         if (vport->target == NULL)
         {
-                fprintf (stderr,
+                dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_MISSING_MEMBER,
                   (_("Warning in %s () a NULL pointer was found.\n")),
                   __FUNCTION__);
                 vport->target = dxf_point_new ();
-                vport->target = dxf_point_init (vport->target);
+                vport->target = dxf_point_init (dxf_point_new ());
         }
-        (fp->line_number)++;
-        fscanf (fp->fp, "%[^\n]", temp_string);
-        while (strcmp (temp_string, "0") != 0)
+        dxf_read_line (temp_string, fp);
+        while ((strcmp (temp_string, "0") != 0)
+          && (!feof (fp->fp)))
         {
                 if (ferror (fp->fp))
                 {
@@ -289,8 +297,6 @@ dxf_vport_read
                           (_("Error in %s () while reading from: %s in line: %d.\n")),
                           __FUNCTION__, fp->filename, fp->line_number);
                         fclose (fp->fp);
-                        /* Clean up. */
-                        free (temp_string);
                         return (NULL);
                 }
                 if (strcmp (temp_string, "5") == 0)
@@ -304,8 +310,7 @@ dxf_vport_read
                 {
                         /* Now follows a string containing a viewport
                          * name. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->viewport_name);
+                        dxf_read_string (&vport->viewport_name, fp);
                 }
                 else if (strcmp (temp_string, "10") == 0)
                 {
@@ -563,24 +568,31 @@ dxf_vport_read
                 {
                         /* Now follows a string containing Soft-pointer
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->dictionary_owner_soft);
+                        dxf_read_string (&vport->dictionary_owner_soft, fp);
                 }
                 else if (strcmp (temp_string, "360") == 0)
                 {
                         /* Now follows a string containing Hard owner
                          * ID/handle to owner dictionary. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, vport->dictionary_owner_hard);
+                        dxf_read_string (&vport->dictionary_owner_hard, fp);
                 }
                 else if (strcmp (temp_string, "999") == 0)
                 {
                         /* Now follows a string containing a comment. */
-                        (fp->line_number)++;
-                        fscanf (fp->fp, DXF_MAX_STRING_FORMAT, temp_string);
-                        fprintf (stdout, "DXF comment: %s\n", temp_string);
+                        dxf_read_line (temp_string, fp);
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_INFO,
+                          DXF_DIAGNOSTIC_COMMENT, "DXF comment: %s\n", temp_string);
                 }
-
+                else
+                {
+                        dxf_diagnostic_report (fp, DXF_DIAGNOSTIC_WARNING,
+                          DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE,
+                          (_("Warning in %s () unknown string tag found while reading from: %s in line: %d.\n")),
+                          __FUNCTION__, fp->filename, fp->line_number);
+                        /* Skip the value of the group code. */
+                        dxf_read_value_line (temp_string, fp);
+                }
+                dxf_read_line (temp_string, fp);
         }
         /* Handle omitted members and/or illegal values. */
         if ((strcmp (vport->viewport_name, "") == 0)
@@ -591,8 +603,6 @@ dxf_vport_read
                   __FUNCTION__, fp->filename, fp->line_number);
                 return (NULL);
         }
-        /* Clean up. */
-        free (temp_string);
 #if DEBUG
         DXF_DEBUG_END
 #endif
@@ -880,6 +890,7 @@ dxf_vport_free_list
         while (vports != NULL)
         {
                 DxfVPort *iter = (DxfVPort *) vports->next;
+                vports->next = NULL;
                 dxf_vport_free (vports);
                 vports = (DxfVPort *) iter;
         }
@@ -4696,9 +4707,6 @@ dxf_vport_get_last
         }
         if (vport->next == NULL)
         {
-                fprintf (stderr,
-                  (_("Warning in %s () a NULL pointer was found.\n")),
-                  __FUNCTION__);
                 return ((DxfVPort *) vport);
         }
         DxfVPort *iter = (DxfVPort *) vport->next;
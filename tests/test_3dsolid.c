@@ -0,0 +1,210 @@
+/*!
+ * \file test_3dsolid.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the verbatim round trip of the proprietary
+ * (ACIS) data of a DXF \c 3DSOLID entity.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A \c 3DSOLID entity as written by libDXF for AutoCAD 2000,
+ * the name of the entity was read already.
+ *
+ * The proprietary data holds the encoded SAT records "400 0 1 0",
+ * "body $-1 -1 $-1 $2 $-1 $-1 #" and "lump $-1 -1 $-1 $-1 $3 $1 #",
+ * the last one split over a group code 1 line ending in a space and a
+ * group code 3 line.
+ */
+static const char *test_3dsolid_entity =
+        "  5\n2a\n"
+        "100\nAcDbEntity\n"
+        "  8\nSolids\n"
+#ifdef BUILD_64
+        "160\n0\n"
+#else
+        " 92\n0\n"
+#endif
+        "100\nAcDbModelerGeometry\n"
+        " 70\n1\n"
+        "  1\nkoo o n o\n"
+        "  1\n=0;& {rn rn {rn {m {rn {rn |\n"
+        "  1\n3*2/ {rn rn {rn \n"
+        "  3\n{rn {l {n |\n"
+        "  0\nEOF\n";
+
+
+/*!
+ * \brief Decoded SAT text of the proprietary data of
+ * \c test_3dsolid_entity.
+ */
+static const char *test_3dsolid_sat =
+        "400 0 1 0\n"
+        "body $-1 -1 $-1 $2 $-1 $-1 #\n"
+        "lump $-1 -1 $-1 $-1 $3 $1 #\n";
+
+
+/*!
+ * \brief Read a DXF \c 3DSOLID entity from a string.
+ *
+ * \return a pointer to the entity, or \c NULL when an error occurred.
+ */
+static Dxf3dsolid *
+test_3dsolid_read
+(
+        const char *entity
+                /*!< Group code and value lines of the entity following
+                 * it's name. */
+)
+{
+        DxfFile file;
+        Dxf3dsolid *solid;
+
+        memset (&file, 0, sizeof (file));
+        file.fp = tmpfile ();
+        file.filename = "test_3dsolid";
+        file.acad_version_number = AutoCAD_2000;
+        if (file.fp == NULL)
+        {
+                return (NULL);
+        }
+        fputs (entity, file.fp);
+        rewind (file.fp);
+        solid = dxf_3dsolid_read (&file, dxf_3dsolid_init (dxf_3dsolid_new ()));
+        fclose (file.fp);
+        return (solid);
+}
+
+
+/*!
+ * \brief Write a DXF \c 3DSOLID entity to a string.
+ *
+ * \return a newly allocated string with the entity, without the lines
+ * announcing it, or \c NULL when an error occurred.
+ */
+static char *
+test_3dsolid_write
+(
+        Dxf3dsolid *solid
+                /*!< DXF \c 3DSOLID entity. */
+)
+{
+        DxfFile file;
+        char *written;
+        long length;
+
+        memset (&file, 0, sizeof (file));
+        file.fp = tmpfile ();
+        file.filename = "test_3dsolid";
+        file.acad_version_number = AutoCAD_2000;
+        if (file.fp == NULL)
+        {
+                return (NULL);
+        }
+        dxf_3dsolid_write (&file, solid);
+        /* Terminate the entity as it is in the input. */
+        fprintf (file.fp, "  0\nEOF\n");
+        length = ftell (file.fp);
+        written = malloc ((size_t) length + 1);
+        rewind (file.fp);
+        if ((written != NULL)
+          && (fread (written, 1, (size_t) length, file.fp) != (size_t) length))
+        {
+                free (written);
+                written = NULL;
+        }
+        fclose (file.fp);
+        if (written == NULL)
+        {
+                return (NULL);
+        }
+        written[length] = '\0';
+        /* Skip the "0" and "3DSOLID" lines announcing the entity. */
+        if (strncmp (written, "  0\n3DSOLID\n", 12) != 0)
+        {
+                free (written);
+                return (NULL);
+        }
+        memmove (written, written + 12, (size_t) length - 12 + 1);
+        return (written);
+}
+
+
+/*!
+ * \brief Test that the proprietary data of a \c 3DSOLID entity which
+ * is not accessed is written back byte for byte, and that it is decoded
+ * on request.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_3dsolid ()
+{
+        Dxf3dsolid *solid;
+        char *written;
+        char *sat;
+        int failures = 0;
+
+        solid = test_3dsolid_read (test_3dsolid_entity);
+        if ((solid == NULL) || (solid->acis_data == NULL)
+          || (dxf_acis_data_get_number_of_lines (solid->acis_data) != 4))
+        {
+                fprintf (stderr, "TESTS: the proprietary data of a 3DSOLID was not read.\n");
+                if (solid != NULL)
+                {
+                        dxf_3dsolid_free (solid);
+                }
+                return (failures + 1);
+        }
+        written = test_3dsolid_write (solid);
+        if ((written == NULL) || (strcmp (written, test_3dsolid_entity) != 0))
+        {
+                fprintf (stderr, "TESTS: a 3DSOLID was not written back byte for byte:\n%s",
+                  (written != NULL) ? written : "(null)\n");
+                failures++;
+        }
+        free (written);
+        sat = dxf_acis_data_get_sat (solid->acis_data);
+        if ((sat == NULL) || (strcmp (sat, test_3dsolid_sat) != 0))
+        {
+                fprintf (stderr, "TESTS: the SAT text of a 3DSOLID was decoded wrongly.\n");
+                failures++;
+        }
+        free (sat);
+        dxf_3dsolid_free (solid);
+        return (failures);
+}
+
+
+/* EOF */
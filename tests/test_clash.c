@@ -0,0 +1,283 @@
+/*!
+ * \file test_clash.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the batch point classification and
+ * distance kernels.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include <ctype.h>
+#include "includes.h"
+
+
+#define TEST_CLASH_NUMBER_OF_POINTS 203
+        /*!< \brief Number of points, not a multiple of the SIMD width. */
+#define TEST_CLASH_NUMBER_OF_SHAPES 4
+        /*!< \brief Number of circles, arcs and segments. */
+#define TEST_CLASH_NUMBER_OF_BYTES 127
+        /*!< \brief Number of bytes in a hexadecimal string, the length
+         * of a binary chunk record. */
+
+
+/*!
+ * \brief Results of all kernels for one instruction set.
+ */
+typedef struct
+test_clash_results_struct
+{
+        char circles[TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS];
+        double circle_distances[TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS];
+        char arcs[TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS];
+        double arc_distances[TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS];
+        char segments[TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS];
+        double segment_distances[TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS];
+} TestClashResults;
+
+
+/*!
+ * \brief Run all kernels with the active instruction set.
+ */
+static void
+test_clash_run
+(
+        const double *x,
+        const double *y,
+        TestClashResults *results
+)
+{
+        /* Circles and arcs, a full circle, a quarter, a half and three
+         * quarters crossing the X-axis. */
+        const double cx[TEST_CLASH_NUMBER_OF_SHAPES] = {0.0, 1.0, -1.0, 0.5};
+        const double cy[TEST_CLASH_NUMBER_OF_SHAPES] = {0.0, 1.0, 0.5, -1.0};
+        const double radius[TEST_CLASH_NUMBER_OF_SHAPES] = {2.0, 1.5, 3.0, 2.5};
+        const double start_angle[TEST_CLASH_NUMBER_OF_SHAPES] = {30.0, 0.0, 90.0, 315.0};
+        const double end_angle[TEST_CLASH_NUMBER_OF_SHAPES] = {30.0, 90.0, 270.0, 225.0};
+        /* Segments, the last one degenerate. */
+        const double x0[TEST_CLASH_NUMBER_OF_SHAPES] = {-3.0, 0.0, 2.0, 1.0};
+        const double y0[TEST_CLASH_NUMBER_OF_SHAPES] = {-3.0, 2.0, -1.0, 1.0};
+        const double x1[TEST_CLASH_NUMBER_OF_SHAPES] = {3.0, 0.0, -2.5, 1.0};
+        const double y1[TEST_CLASH_NUMBER_OF_SHAPES] = {3.0, -2.0, 0.5, 1.0};
+
+        dxf_clash_classify_circles (x, y, TEST_CLASH_NUMBER_OF_POINTS,
+          cx, cy, radius, TEST_CLASH_NUMBER_OF_SHAPES, 0.25,
+          results->circles);
+        dxf_clash_distance_circles (x, y, TEST_CLASH_NUMBER_OF_POINTS,
+          cx, cy, radius, TEST_CLASH_NUMBER_OF_SHAPES,
+          results->circle_distances);
+        dxf_clash_classify_arcs (x, y, TEST_CLASH_NUMBER_OF_POINTS,
+          cx, cy, radius, start_angle, end_angle,
+          TEST_CLASH_NUMBER_OF_SHAPES, 0.25, results->arcs);
+        dxf_clash_distance_arcs (x, y, TEST_CLASH_NUMBER_OF_POINTS,
+          cx, cy, radius, start_angle, end_angle,
+          TEST_CLASH_NUMBER_OF_SHAPES, results->arc_distances);
+        dxf_clash_classify_segments (x, y, TEST_CLASH_NUMBER_OF_POINTS,
+          x0, y0, x1, y1, TEST_CLASH_NUMBER_OF_SHAPES, 0.25,
+          results->segments);
+        dxf_clash_distance_segments (x, y, TEST_CLASH_NUMBER_OF_POINTS,
+          x0, y0, x1, y1, TEST_CLASH_NUMBER_OF_SHAPES,
+          results->segment_distances);
+}
+
+
+/*!
+ * \brief Compare two arrays of distances.
+ *
+ * \return \c EXIT_SUCCESS when the distances are equal within 1e-12,
+ * or \c EXIT_FAILURE when they are not.
+ */
+static int
+test_clash_compare_distances
+(
+        const double *expected,
+        const double *distances
+)
+{
+        int i;
+
+        for (i = 0; i < TEST_CLASH_NUMBER_OF_SHAPES * TEST_CLASH_NUMBER_OF_POINTS; i++)
+        {
+                if (fabs (expected[i] - distances[i]) > 1e-12)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Check some results of the scalar kernels by hand.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_clash_scalar ()
+{
+        const double x[3] = {0.0, 2.1, 2.0};
+        const double y[3] = {0.0, 0.0, -2.0};
+        const double cx[1] = {0.0};
+        const double cy[1] = {0.0};
+        const double radius[1] = {2.0};
+        const double start_angle[1] = {0.0};
+        const double end_angle[1] = {90.0};
+        char results[3];
+        double distances[3];
+        int failures = 0;
+
+        dxf_clash_classify_circles (x, y, 3, cx, cy, radius, 1, 0.25, results);
+        if ((results[0] != INSIDE) || (results[1] != ON_EDGE)
+          || (results[2] != OUTSIDE))
+        {
+                fprintf (stderr, "TESTS: wrong classification of points against a circle.\n");
+                failures++;
+        }
+        /* The point (2, -2) is nearest to the start point (2, 0) of
+         * the quarter arc. */
+        dxf_clash_distance_arcs (x, y, 3, cx, cy, radius, start_angle,
+          end_angle, 1, distances);
+        if ((fabs (distances[0] - 2.0) > 1e-12)
+          || (fabs (distances[1] - 0.1) > 1e-12)
+          || (fabs (distances[2] - 2.0) > 1e-12))
+        {
+                fprintf (stderr, "TESTS: wrong distances of points to an arc.\n");
+                failures++;
+        }
+        return (failures);
+}
+
+
+/*!
+ * \brief Decode hexadecimal strings with the active instruction set.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_clash_hex ()
+{
+        unsigned char bytes[TEST_CLASH_NUMBER_OF_BYTES];
+        unsigned char decoded[TEST_CLASH_NUMBER_OF_BYTES];
+        char hex[2 * TEST_CLASH_NUMBER_OF_BYTES + 1];
+        int failures = 0;
+        int i;
+
+        for (i = 0; i < TEST_CLASH_NUMBER_OF_BYTES; i++)
+        {
+                bytes[i] = (unsigned char) (i * 37 + 11);
+        }
+        dxf_binary_data_encode_hex (bytes, TEST_CLASH_NUMBER_OF_BYTES, hex);
+        if ((dxf_binary_data_decode_hex (hex, decoded, TEST_CLASH_NUMBER_OF_BYTES) != TEST_CLASH_NUMBER_OF_BYTES)
+          || (memcmp (bytes, decoded, TEST_CLASH_NUMBER_OF_BYTES) != 0))
+        {
+                fprintf (stderr, "TESTS: wrong decoding of upper case hexadecimal digits.\n");
+                failures++;
+        }
+        for (i = 0; hex[i] != '\0'; i++)
+        {
+                hex[i] = (char) tolower ((unsigned char) hex[i]);
+        }
+        memset (decoded, 0, sizeof (decoded));
+        if ((dxf_binary_data_decode_hex (hex, decoded, TEST_CLASH_NUMBER_OF_BYTES) != TEST_CLASH_NUMBER_OF_BYTES)
+          || (memcmp (bytes, decoded, TEST_CLASH_NUMBER_OF_BYTES) != 0))
+        {
+                fprintf (stderr, "TESTS: wrong decoding of lower case hexadecimal digits.\n");
+                failures++;
+        }
+        /* The low digit of byte 38 is invalid, the bytes before it are
+         * decoded. */
+        hex[77] = 'g';
+        memset (decoded, 0, sizeof (decoded));
+        if ((dxf_binary_data_decode_hex (hex, decoded, TEST_CLASH_NUMBER_OF_BYTES) != 38)
+          || (memcmp (bytes, decoded, 38) != 0))
+        {
+                fprintf (stderr, "TESTS: wrong decoding of invalid hexadecimal digits.\n");
+                failures++;
+        }
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for the clash kernels, the SIMD
+ * kernels must give the results of the scalar kernels.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_clash ()
+{
+        double x[TEST_CLASH_NUMBER_OF_POINTS];
+        double y[TEST_CLASH_NUMBER_OF_POINTS];
+        TestClashResults *expected;
+        TestClashResults *results;
+        int supported;
+        int simd;
+        int failures = 0;
+        int i;
+
+        /* A spiral of points through all shapes. */
+        for (i = 0; i < TEST_CLASH_NUMBER_OF_POINTS; i++)
+        {
+                x[i] = 0.025 * i * cos (0.37 * i);
+                y[i] = 0.025 * i * sin (0.37 * i);
+        }
+        expected = malloc (sizeof (TestClashResults));
+        results = malloc (sizeof (TestClashResults));
+        supported = dxf_simd_get ();
+        dxf_simd_set (DXF_SIMD_NONE);
+        failures += test_clash_scalar ();
+        failures += test_clash_hex ();
+        test_clash_run (x, y, expected);
+        for (simd = DXF_SIMD_SSE2; simd <= supported; simd++)
+        {
+                dxf_simd_set (simd);
+                test_clash_run (x, y, results);
+                if ((memcmp (expected->circles, results->circles, sizeof (expected->circles)) != 0)
+                  || (memcmp (expected->arcs, results->arcs, sizeof (expected->arcs)) != 0)
+                  || (memcmp (expected->segments, results->segments, sizeof (expected->segments)) != 0)
+                  || (test_clash_compare_distances (expected->circle_distances, results->circle_distances) == EXIT_FAILURE)
+                  || (test_clash_compare_distances (expected->arc_distances, results->arc_distances) == EXIT_FAILURE)
+                  || (test_clash_compare_distances (expected->segment_distances, results->segment_distances) == EXIT_FAILURE))
+                {
+                        fprintf (stderr, "TESTS: clash kernels of SIMD level %d differ from the scalar kernels.\n",
+                          simd);
+                        failures++;
+                }
+                failures += test_clash_hex ();
+        }
+        dxf_simd_set (supported);
+        free (expected);
+        free (results);
+        return (failures);
+}
+
+
+/* EOF */
@@ -0,0 +1,167 @@
+/*!
+ * \file test_diagnostic.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the rate limiting and the deduplication of
+ * a diagnostics sink.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Diagnostic callback counting the diagnostics passed to it.
+ */
+static void
+test_diagnostic_callback
+(
+        DxfDiagnosticSeverity severity,
+                /*!< Severity of the diagnostic. */
+        DxfDiagnosticCode code,
+                /*!< Diagnostic code. */
+        const char *filename,
+                /*!< Name of the file being read. */
+        int line_number,
+                /*!< Line number in the file being read. */
+        const char *message,
+                /*!< Diagnostic message. */
+        void *data
+                /*!< Counter of the diagnostics passed. */
+)
+{
+        (void) severity;
+        (void) code;
+        (void) filename;
+        (void) line_number;
+        (void) message;
+        (*(int *) data)++;
+}
+
+
+/*!
+ * \brief Test the counting, the rate limiting per code and the
+ * deduplication of identical messages of a diagnostics sink.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_diagnostic ()
+{
+        DxfDiagnostics *diagnostics;
+        DxfFile file;
+        int passed = 0;
+        int failures = 0;
+        int i;
+
+        diagnostics = dxf_diagnostics_init (dxf_diagnostics_new ());
+        if (diagnostics == NULL)
+        {
+                return (1);
+        }
+        memset (&file, 0, sizeof (file));
+        file.filename = "test_diagnostic";
+        /* Without a sink a report is discarded. */
+        dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+          DXF_DIAGNOSTIC_COMMENT, "comment %d\n", 0);
+        dxf_diagnostics_register (&file, diagnostics);
+        /* Without a callback diagnostics are counted only. */
+        dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+          DXF_DIAGNOSTIC_COMMENT, "comment %d\n", 1);
+        if (dxf_diagnostics_get_count (diagnostics, DXF_DIAGNOSTIC_COMMENT) != 1)
+        {
+                fprintf (stderr, "TESTS: a diagnostic without a callback was not counted once.\n");
+                failures++;
+        }
+        dxf_diagnostics_reset_counts (diagnostics);
+        dxf_diagnostics_set_callback (diagnostics, test_diagnostic_callback, &passed);
+        dxf_diagnostics_set_max_reports_per_code (diagnostics, 2);
+        /* Identical messages are passed once. */
+        for (i = 0; i < 3; i++)
+        {
+                dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE, "unknown group code %d\n", 1071);
+        }
+        if ((passed != 1)
+          || (dxf_diagnostics_get_duplicates (diagnostics) != 2)
+          || (dxf_diagnostics_get_count (diagnostics, DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE) != 3))
+        {
+                fprintf (stderr, "TESTS: identical diagnostics were not deduplicated.\n");
+                failures++;
+        }
+        /* Distinct messages are passed up to the limit of their code,
+         * other codes have a limit of their own. */
+        for (i = 0; i < 3; i++)
+        {
+                dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE, "unknown group code %d\n", i);
+        }
+        dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_ERROR,
+          DXF_DIAGNOSTIC_INVALID_ENTITY, "invalid entity\n");
+        if ((passed != 3)
+          || (dxf_diagnostics_get_count (diagnostics, DXF_DIAGNOSTIC_UNKNOWN_GROUP_CODE) != 6)
+          || (dxf_diagnostics_get_count (diagnostics, DXF_DIAGNOSTIC_INVALID_ENTITY) != 1))
+        {
+                fprintf (stderr, "TESTS: the diagnostics were not limited per code.\n");
+                failures++;
+        }
+        /* Without deduplication and limit every diagnostic is passed. */
+        dxf_diagnostics_reset_counts (diagnostics);
+        dxf_diagnostics_set_deduplicate (diagnostics, FALSE);
+        dxf_diagnostics_set_max_reports_per_code (diagnostics, 0);
+        passed = 0;
+        for (i = 0; i < 12; i++)
+        {
+                dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+                  DXF_DIAGNOSTIC_COMMENT, "comment\n");
+        }
+        if ((passed != 12)
+          || (dxf_diagnostics_get_duplicates (diagnostics) != 0))
+        {
+                fprintf (stderr, "TESTS: undeduplicated diagnostics were not all passed.\n");
+                failures++;
+        }
+        /* A code out of range is discarded. */
+        dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+          DXF_NUMBER_OF_DIAGNOSTIC_CODES, "out of range\n");
+        dxf_diagnostic_report (&file, DXF_DIAGNOSTIC_WARNING,
+          (DxfDiagnosticCode) -1, "out of range\n");
+        if (passed != 12)
+        {
+                fprintf (stderr, "TESTS: a diagnostic code out of range was passed.\n");
+                failures++;
+        }
+        dxf_diagnostics_free (diagnostics);
+        return (failures);
+}
+
+
+/* EOF */
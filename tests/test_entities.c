@@ -0,0 +1,515 @@
+/*!
+ * \file test_entities.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for reading the \c ENTITIES section of the
+ * example DXF files into a drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+#ifndef DXF_EXAMPLES_DIR
+#define DXF_EXAMPLES_DIR "../../examples"
+#endif
+
+
+/*!
+ * \brief Definition of an expected result of reading an example file.
+ */
+typedef struct
+test_entities_example_struct
+{
+        char *filename;
+                /*!< Name of the example file. */
+        int number_of_entities;
+                /*!< Number of entities (in file order) the reader
+                 * should return. */
+        DxfEntityType first_type;
+                /*!< Type of the first entity. */
+        DxfEntityType last_type;
+                /*!< Type of the last entity. */
+        int number_of_blocks;
+                /*!< Number of block definitions in the \c BLOCKS
+                 * section. */
+        int number_of_block_entities;
+                /*!< Number of entities in all block definitions. */
+} TestEntitiesExample;
+
+
+/*!
+ * \brief Expected results for the example files.
+ *
+ * The \c 3DLINE entity of all_R10_entities.dxf has no reader and is
+ * skipped, \c VERTEX entities belong to their \c POLYLINE.
+ */
+static TestEntitiesExample test_entities_examples[] =
+{
+        {"all_R10_entities.dxf", 14, DFACE, TRACE, 9, 39},
+        {"blender-monkey_head_example_R12.dxf", 1, POLYLINE, POLYLINE, 0, 0},
+        {"parametric_constraints_R2010.dxf", 9, LINE, VIEWPORT, 4, 4},
+        {"parametric_constraints_collinear_R2010.dxf", 2, LINE, LINE, 3, 0},
+        {"parametric_constraints_concentric_R2010.dxf", 2, CIRCLE, CIRCLE, 3, 0},
+        {"parametric_constraints_horizontal_R2010.dxf", 1, LINE, LINE, 3, 0},
+        {"parametric_constraints_parallel_R2010.dxf", 2, LINE, LINE, 3, 0},
+        {"parametric_constraints_perpendicular_R2010.dxf", 2, LINE, LINE, 3, 0},
+        {"parametric_constraints_tangent_R2010.dxf", 2, LINE, CIRCLE, 3, 0},
+        {"parametric_constraints_vertical_R2010.dxf", 1, LINE, LINE, 3, 0},
+        {"qcad-example_R12.dxf", 30, LINE, TEXT, 0, 0},
+        {"qcad-example_R2000.dxf", 14, LINE, DIMENSION, 3, 0},
+        {"zcad-teapot_R2000.dxf", 1152, DFACE, DFACE, 2, 0},
+        {NULL, 0, UNKNOWN_ENTITY, UNKNOWN_ENTITY, 0, 0}
+};
+
+
+/*!
+ * \brief Read an example file into a drawing, traverse it's entities
+ * in file order with a cursor and count it's block definitions.
+ *
+ * \return \c EXIT_SUCCESS when the entities match the expected result,
+ * or \c EXIT_FAILURE when they do not.
+ */
+static int
+test_entities_read_example
+(
+        TestEntitiesExample *example
+                /*!< Expected result of reading the example file. */
+)
+{
+        char filename[DXF_MAX_STRING_LENGTH];
+        DxfDrawing *drawing;
+        DxfEntities *entities;
+        DxfBlock *block;
+        DxfEntitiesCursor cursor;
+        DxfEntityType type;
+        DxfEntityType first_type = UNKNOWN_ENTITY;
+        DxfEntityType last_type = UNKNOWN_ENTITY;
+        void *entity;
+        int count = 0;
+        int number_of_blocks = 0;
+        int number_of_block_entities = 0;
+        int result = EXIT_SUCCESS;
+
+        snprintf (filename, sizeof (filename), "%s/%s",
+          DXF_EXAMPLES_DIR, example->filename);
+        drawing = dxf_drawing_read (filename, NULL, NULL);
+        if (drawing == NULL)
+        {
+                fprintf (stderr, "TESTS: could not read: %s.\n", filename);
+                return (EXIT_FAILURE);
+        }
+        entities = dxf_drawing_get_entities_list (drawing);
+        if (entities == NULL)
+        {
+                fprintf (stderr, "TESTS: no entities were read from: %s.\n",
+                  filename);
+                dxf_drawing_free (drawing);
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_cursor_init (&cursor, entities);
+        while ((entity = dxf_entities_cursor_next (&cursor, &type)) != NULL)
+        {
+                if (count == 0)
+                {
+                        first_type = type;
+                }
+                last_type = type;
+                if ((type == LINE)
+                  && (((DxfLine *) entity)->p0 == NULL))
+                {
+                        fprintf (stderr, "TESTS: LINE without start point in: %s.\n",
+                          filename);
+                        result = EXIT_FAILURE;
+                }
+                if ((type == POLYLINE)
+                  && (((DxfPolyline *) entity)->vertices == NULL))
+                {
+                        fprintf (stderr, "TESTS: POLYLINE without vertices in: %s.\n",
+                          filename);
+                        result = EXIT_FAILURE;
+                }
+                count++;
+        }
+        if ((count != example->number_of_entities)
+          || (count != dxf_entities_get_number_of_sequence_items (entities)))
+        {
+                fprintf (stderr, "TESTS: %d entities were read from: %s, %d were expected.\n",
+                  count, filename, example->number_of_entities);
+                result = EXIT_FAILURE;
+        }
+        if ((first_type != example->first_type)
+          || (last_type != example->last_type))
+        {
+                fprintf (stderr, "TESTS: unexpected first or last entity type in: %s.\n",
+                  filename);
+                result = EXIT_FAILURE;
+        }
+        for (block = (DxfBlock *) drawing->block_list; block != NULL; block = (DxfBlock *) block->next)
+        {
+                number_of_blocks++;
+                if (block->entities != NULL)
+                {
+                        number_of_block_entities += dxf_entities_get_number_of_sequence_items ((DxfEntities *) block->entities);
+                }
+        }
+        if ((number_of_blocks != example->number_of_blocks)
+          || (number_of_block_entities != example->number_of_block_entities))
+        {
+                fprintf (stderr, "TESTS: %d block definitions with %d entities were read from: %s, %d with %d were expected.\n",
+                  number_of_blocks, number_of_block_entities, filename,
+                  example->number_of_blocks, example->number_of_block_entities);
+                result = EXIT_FAILURE;
+        }
+        dxf_drawing_free (drawing);
+        return (result);
+}
+
+
+/*!
+ * \brief \c ENTITIES section with a \c HATCH with a polyline boundary
+ * path, a \c HATCH with an edge boundary path and a \c POLYLINE.
+ *
+ * The section marker was already read.
+ */
+static const char *test_entities_section =
+        "  0\nLINE\n  8\n0\n 10\n0.0\n 20\n0.0\n 30\n0.0\n 11\n4.0\n 21\n0.0\n 31\n0.0\n"
+        "  0\nHATCH\n  5\n2A\n  8\nHATCHES\n100\nAcDbEntity\n100\nAcDbHatch\n"
+        " 10\n0.0\n 20\n0.0\n 30\n0.0\n210\n0.0\n220\n0.0\n230\n1.0\n"
+        "  2\nSOLID\n 70\n1\n 71\n0\n 91\n1\n"
+        " 92\n2\n 72\n1\n 73\n1\n 93\n3\n"
+        " 10\n0.0\n 20\n0.0\n 42\n0.0\n"
+        " 10\n10.0\n 20\n0.0\n 42\n0.5\n"
+        " 10\n10.0\n 20\n10.0\n 42\n0.0\n"
+        " 97\n0\n 75\n0\n 76\n1\n 98\n1\n 10\n5.0\n 20\n5.0\n"
+        "  0\nCIRCLE\n  8\n0\n 10\n1.0\n 20\n1.0\n 30\n0.0\n 40\n2.0\n"
+        "  0\nHATCH\n  8\nHATCHES\n100\nAcDbHatch\n"
+        " 10\n0.0\n 20\n0.0\n 30\n0.0\n  2\nANSI31\n 70\n0\n 71\n0\n 91\n1\n"
+        " 92\n1\n 93\n2\n"
+        " 72\n1\n 10\n1.0\n 20\n1.0\n 11\n2.0\n 21\n1.0\n"
+        " 72\n2\n 10\n5.0\n 20\n5.0\n 40\n1.0\n 50\n0.0\n 51\n180.0\n 73\n1\n"
+        " 97\n0\n 75\n1\n 76\n1\n 52\n45.0\n 41\n2.0\n 77\n0\n 78\n1\n"
+        " 53\n45.0\n 43\n0.0\n 44\n0.0\n 45\n-2.245\n 46\n2.245\n 79\n2\n 49\n1.0\n 49\n-0.5\n"
+        " 98\n0\n"
+        "  0\nPOLYLINE\n  8\n0\n 66\n1\n 10\n0.0\n 20\n0.0\n 30\n0.0\n 70\n0\n"
+        "  0\nVERTEX\n  8\n0\n 10\n1.0\n 20\n2.0\n 30\n0.0\n"
+        "  0\nVERTEX\n  8\n0\n 10\n3.0\n 20\n4.0\n 30\n0.0\n"
+        "  0\nSEQEND\n  8\n0\n"
+        "  0\nENDSEC\n";
+
+
+/*!
+ * \brief Read the entities of an \c ENTITIES section from a temporary
+ * file.
+ *
+ * \return the entities, or \c NULL when they could not be read.
+ */
+static DxfEntities *
+test_entities_read_section
+(
+        FILE *stream
+                /*!< Stream positioned after the section marker. */
+)
+{
+        DxfFile file;
+
+        memset (&file, 0, sizeof (file));
+        file.fp = stream;
+        file.filename = "test_entities";
+        file.acad_version_number = AutoCAD_2000;
+        return (dxf_entities_read (&file, dxf_entities_init (dxf_entities_new ())));
+}
+
+
+/*!
+ * \brief Test that a polyline \c HATCH boundary path was read with it's
+ * vertices and seed point.
+ *
+ * \return \c EXIT_SUCCESS when the \c HATCH matches, or
+ * \c EXIT_FAILURE when it does not.
+ */
+static int
+test_entities_check_hatch
+(
+        DxfHatch *hatch
+                /*!< \c HATCH with a polyline boundary path. */
+)
+{
+        DxfHatchBoundaryPath *path;
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchPatternSeedPoint *seed_point;
+        int count = 0;
+
+        path = (DxfHatchBoundaryPath *) hatch->paths;
+        if ((path == NULL) || (path->next != NULL)
+          || (path->polylines == NULL)
+          || (strcmp (hatch->layer, "HATCHES") != 0)
+          || (strcmp (hatch->pattern_name, "SOLID") != 0)
+          || (hatch->solid_fill != 1))
+        {
+                return (EXIT_FAILURE);
+        }
+        polyline = (DxfHatchBoundaryPathPolyline *) path->polylines;
+        for (vertex = (DxfHatchBoundaryPathPolylineVertex *) polyline->vertices;
+          vertex != NULL;
+          vertex = (DxfHatchBoundaryPathPolylineVertex *) vertex->next)
+        {
+                if ((count == 1)
+                  && ((vertex->x0 != 10.0) || (vertex->bulge != 0.5)))
+                {
+                        return (EXIT_FAILURE);
+                }
+                count++;
+        }
+        seed_point = (DxfHatchPatternSeedPoint *) hatch->seed_points;
+        if ((count != 3)
+          || (!polyline->is_closed)
+          || (seed_point == NULL)
+          || (seed_point->x0 != 5.0)
+          || (seed_point->y0 != 5.0))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test reading \c HATCH entities, writing the entities in file
+ * order and reading them back.
+ *
+ * The \c HATCH with an edge boundary path can not be written and is
+ * left out, the other entities keep their order.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_entities_write_sequence ()
+{
+        const DxfEntityType read_types[] = {LINE, HATCH, CIRCLE, HATCH, POLYLINE};
+        const DxfEntityType written_types[] = {LINE, HATCH, CIRCLE, POLYLINE};
+        DxfEntities *entities;
+        DxfEntities *written = NULL;
+        DxfEntitiesCursor cursor;
+        DxfHatch *hatch;
+        DxfHatchBoundaryPathEdge *edge;
+        DxfHatchPatternDefLine *def_line;
+        DxfEntityType type;
+        DxfFile file;
+        FILE *stream;
+        char line[DXF_MAX_STRING_LENGTH];
+        void *entity;
+        int failures = 0;
+        int i;
+
+        stream = tmpfile ();
+        fputs (test_entities_section, stream);
+        rewind (stream);
+        entities = test_entities_read_section (stream);
+        fclose (stream);
+        if (entities == NULL)
+        {
+                fprintf (stderr, "TESTS: the ENTITIES section was not read.\n");
+                return (1);
+        }
+        dxf_entities_cursor_init (&cursor, entities);
+        for (i = 0; (entity = dxf_entities_cursor_next (&cursor, &type)) != NULL; i++)
+        {
+                if ((i >= 5) || (type != read_types[i]))
+                {
+                        break;
+                }
+        }
+        if ((i != 5) || (entity != NULL))
+        {
+                fprintf (stderr, "TESTS: the entities were not read in file order.\n");
+                failures++;
+        }
+        hatch = (DxfHatch *) entities->hatch_list;
+        if ((hatch == NULL)
+          || (test_entities_check_hatch (hatch) != EXIT_SUCCESS))
+        {
+                fprintf (stderr, "TESTS: the polyline boundary path of a HATCH was not read.\n");
+                failures++;
+        }
+        hatch = (hatch != NULL) ? (DxfHatch *) hatch->next : NULL;
+        edge = (hatch != NULL) ? (DxfHatchBoundaryPathEdge *) ((DxfHatchBoundaryPath *) hatch->paths)->edges : NULL;
+        def_line = (hatch != NULL) ? (DxfHatchPatternDefLine *) hatch->def_lines : NULL;
+        if ((edge == NULL)
+          || (edge->lines == NULL)
+          || (((DxfHatchBoundaryPathEdgeLine *) edge->lines)->x1 != 2.0)
+          || (edge->arcs == NULL)
+          || (((DxfHatchBoundaryPathEdgeArc *) edge->arcs)->end_angle != 180.0)
+          || (def_line == NULL)
+          || (def_line->dashes == NULL)
+          || (((DxfHatchPatternDefLineDash *) def_line->dashes)->next == NULL)
+          || (hatch->pattern_scale != 2.0))
+        {
+                fprintf (stderr, "TESTS: the edge boundary path of a HATCH was not read.\n");
+                failures++;
+        }
+        /* Write the entities and read them back. */
+        memset (&file, 0, sizeof (file));
+        file.fp = tmpfile ();
+        file.acad_version_number = AutoCAD_2000;
+        if (dxf_entities_write (&file, entities) != EXIT_FAILURE)
+        {
+                fprintf (stderr, "TESTS: a HATCH with an edge boundary path was written.\n");
+                failures++;
+        }
+        rewind (file.fp);
+        /* Skip the section marker. */
+        for (i = 0; i < 4; i++)
+        {
+                fgets (line, sizeof (line), file.fp);
+        }
+        if (strncmp (line, "ENTITIES", 8) == 0)
+        {
+                written = test_entities_read_section (file.fp);
+        }
+        fclose (file.fp);
+        if (written == NULL)
+        {
+                fprintf (stderr, "TESTS: the written ENTITIES section was not read.\n");
+                dxf_entities_free (entities);
+                return (failures + 1);
+        }
+        dxf_entities_cursor_init (&cursor, written);
+        for (i = 0; (entity = dxf_entities_cursor_next (&cursor, &type)) != NULL; i++)
+        {
+                if ((i >= 4) || (type != written_types[i]))
+                {
+                        break;
+                }
+        }
+        if ((i != 4) || (entity != NULL)
+          || (test_entities_check_hatch ((DxfHatch *) written->hatch_list) != EXIT_SUCCESS)
+          || (((DxfPolyline *) written->polyline_list)->vertices == NULL))
+        {
+                fprintf (stderr, "TESTS: the entities were not written in file order.\n");
+                failures++;
+        }
+        /* A cursor is never allocated. */
+        if (dxf_entities_cursor_init (NULL, entities) != NULL)
+        {
+                fprintf (stderr, "TESTS: a cursor was initialized without a cursor.\n");
+                failures++;
+        }
+        dxf_entities_free (written);
+        dxf_entities_free (entities);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test that the entities read are validated, unless libDXF is
+ * built with \c DXF_TRUSTED_INPUT.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_entities_validate_read ()
+{
+        DxfDiagnostics *diagnostics;
+        DxfEntities *entities;
+        DxfFile file;
+        int expected;
+        int failures = 0;
+
+        diagnostics = dxf_diagnostics_init (dxf_diagnostics_new ());
+        memset (&file, 0, sizeof (file));
+        file.fp = tmpfile ();
+        file.filename = "test_entities";
+        file.acad_version_number = AutoCAD_2000;
+        if ((diagnostics == NULL) || (file.fp == NULL))
+        {
+                fprintf (stderr, "TESTS: could not set up the validation test.\n");
+                return (1);
+        }
+        dxf_diagnostics_register (&file, diagnostics);
+        fputs ("  0\nCIRCLE\n  8\n0\n 10\n1.0\n 20\n1.0\n 30\n0.0\n 40\n-2.0\n"
+          "  0\nARC\n  8\n0\n 10\n1.0\n 20\n1.0\n 30\n0.0\n 40\n2.0\n 50\n0.0\n 51\n90.0\n"
+          "  0\nENDSEC\n", file.fp);
+        rewind (file.fp);
+        entities = dxf_entities_read (&file, dxf_entities_init (dxf_entities_new ()));
+        fclose (file.fp);
+#if DXF_TRUSTED_INPUT
+        /* Trusted input is not validated. */
+        expected = 0;
+#else
+        expected = 1;
+#endif
+        if ((entities == NULL)
+          || (dxf_diagnostics_get_count (diagnostics,
+          DXF_DIAGNOSTIC_INVALID_ENTITY) != expected))
+        {
+                fprintf (stderr, "TESTS: %d invalid entities were reported instead of %d.\n",
+                  dxf_diagnostics_get_count (diagnostics, DXF_DIAGNOSTIC_INVALID_ENTITY),
+                  expected);
+                failures++;
+        }
+        if (entities != NULL)
+        {
+                dxf_entities_free (entities);
+        }
+        dxf_diagnostics_free (diagnostics);
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for reading the \c ENTITIES section of
+ * the example DXF files, and for reading and writing an \c ENTITIES
+ * section in file order.
+ *
+ * \return the number of example files which were not read as
+ * expected.
+ */
+int
+test_entities ()
+{
+        int i;
+        int failures = 0;
+
+        for (i = 0; test_entities_examples[i].filename != NULL; i++)
+        {
+                if (test_entities_read_example (&test_entities_examples[i]) != EXIT_SUCCESS)
+                {
+                        failures++;
+                }
+        }
+        failures += test_entities_write_sequence ();
+        failures += test_entities_validate_read ();
+        return (failures);
+}
+
+
+/* EOF */
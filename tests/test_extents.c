@@ -0,0 +1,276 @@
+/*!
+ * \file test_extents.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the extents of entities and drawings.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Compare extents with the expected values.
+ *
+ * \return \c EXIT_SUCCESS when the values are equal within 1e-9, or
+ * \c EXIT_FAILURE when they are not.
+ */
+static int
+test_extents_check
+(
+        const char *name,
+                /*!< Name of the extents. */
+        DxfExtents *extents,
+                /*!< Computed extents. */
+        double min_x,
+                /*!< Expected minimum X-value. */
+        double min_y,
+                /*!< Expected minimum Y-value. */
+        double max_x,
+                /*!< Expected maximum X-value. */
+        double max_y
+                /*!< Expected maximum Y-value. */
+)
+{
+        if ((extents == NULL)
+          || (fabs (extents->min_x - min_x) > 1e-9)
+          || (fabs (extents->min_y - min_y) > 1e-9)
+          || (fabs (extents->max_x - max_x) > 1e-9)
+          || (fabs (extents->max_y - max_y) > 1e-9)
+          || (fabs (extents->min_z) > 1e-9)
+          || (fabs (extents->max_z) > 1e-9))
+        {
+                fprintf (stderr, "TESTS: unexpected extents of %s, expected (%g, %g) - (%g, %g).\n",
+                  name, min_x, min_y, max_x, max_y);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Initialize an \c INSERT of a block at a point.
+ */
+static void
+test_extents_insert
+(
+        DxfInsert *insert,
+                /*!< Insert to initialize. */
+        DxfPoint *point,
+                /*!< Insertion point. */
+        char *block_name,
+                /*!< Name of the inserted block. */
+        double x,
+                /*!< X-value of the insertion point. */
+        double y
+                /*!< Y-value of the insertion point. */
+)
+{
+        memset (insert, 0, sizeof (DxfInsert));
+        memset (point, 0, sizeof (DxfPoint));
+        point->x0 = x;
+        point->y0 = y;
+        insert->p0 = point;
+        insert->block_name = block_name;
+        insert->rel_x_scale = 1.0;
+        insert->rel_y_scale = 1.0;
+        insert->rel_z_scale = 1.0;
+        insert->extr_z0 = 1.0;
+}
+
+
+/*!
+ * \brief Test the extents of a drawing with nested and circular block
+ * references.
+ *
+ * Block INNER holds a circle of radius 1 at the origin, block OUTER
+ * holds a line from the origin to (1, 1) and INNER scaled by 2 at
+ * (10, 0), block LOOP references itself at (5, 5).\n
+ * The drawing holds OUTER rotated by 90 degrees at (100, 0), a 3 by 2
+ * array of OUTER at (0, -50) and LOOP at the origin.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_extents_nested_blocks ()
+{
+        DxfDrawing drawing;
+        DxfBlock inner;
+        DxfBlock outer;
+        DxfBlock loop;
+        DxfEntities inner_entities;
+        DxfEntities outer_entities;
+        DxfEntities loop_entities;
+        DxfEntities entities;
+        DxfCircle circle;
+        DxfLine line;
+        DxfInsert inner_insert;
+        DxfInsert loop_insert;
+        DxfInsert inserts[3];
+        DxfPoint points[7];
+        DxfBlockExtents *block_extents;
+        DxfBlock *block = NULL;
+        DxfExtents extents;
+        int failures = 0;
+
+        memset (&drawing, 0, sizeof (DxfDrawing));
+        memset (&inner, 0, sizeof (DxfBlock));
+        memset (&outer, 0, sizeof (DxfBlock));
+        memset (&loop, 0, sizeof (DxfBlock));
+        memset (&inner_entities, 0, sizeof (DxfEntities));
+        memset (&outer_entities, 0, sizeof (DxfEntities));
+        memset (&loop_entities, 0, sizeof (DxfEntities));
+        memset (&entities, 0, sizeof (DxfEntities));
+        memset (&circle, 0, sizeof (DxfCircle));
+        memset (&line, 0, sizeof (DxfLine));
+        /* Block INNER. */
+        memset (&points[0], 0, sizeof (DxfPoint));
+        circle.p0 = &points[0];
+        circle.radius = 1.0;
+        circle.extr_z0 = 1.0;
+        dxf_entities_append_sequence_item (&inner_entities, CIRCLE, &circle);
+        inner.block_name = "INNER";
+        inner.entities = (struct DxfEntities *) &inner_entities;
+        /* Block OUTER. */
+        memset (&points[1], 0, sizeof (DxfPoint));
+        memset (&points[2], 0, sizeof (DxfPoint));
+        points[2].x0 = 1.0;
+        points[2].y0 = 1.0;
+        line.p0 = &points[1];
+        line.p1 = &points[2];
+        line.extr_z0 = 1.0;
+        test_extents_insert (&inner_insert, &points[3], "inner", 10.0, 0.0);
+        inner_insert.rel_x_scale = 2.0;
+        inner_insert.rel_y_scale = 2.0;
+        dxf_entities_append_sequence_item (&outer_entities, LINE, &line);
+        dxf_entities_append_sequence_item (&outer_entities, INSERT, &inner_insert);
+        outer.block_name = "OUTER";
+        outer.entities = (struct DxfEntities *) &outer_entities;
+        /* Block LOOP. */
+        test_extents_insert (&loop_insert, &points[4], "LOOP", 5.0, 5.0);
+        dxf_entities_append_sequence_item (&loop_entities, INSERT, &loop_insert);
+        loop.block_name = "LOOP";
+        loop.entities = (struct DxfEntities *) &loop_entities;
+        inner.next = (struct DxfBlock *) &outer;
+        outer.next = (struct DxfBlock *) &loop;
+        /* The drawing. */
+        test_extents_insert (&inserts[0], &points[5], "OUTER", 100.0, 0.0);
+        inserts[0].rot_angle = 90.0;
+        test_extents_insert (&inserts[1], &points[6], "OUTER", 0.0, -50.0);
+        inserts[1].columns = 3;
+        inserts[1].column_spacing = 20.0;
+        inserts[1].rows = 2;
+        inserts[1].row_spacing = 10.0;
+        test_extents_insert (&inserts[2], &points[0], "LOOP", 0.0, 0.0);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[0]);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[1]);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[2]);
+        drawing.block_list = (struct DxfBlock *) &inner;
+        drawing.entities_list = (struct DxfEntities *) &entities;
+
+        block_extents = dxf_block_extents_new (&inner);
+        if (block_extents == NULL)
+        {
+                failures++;
+        }
+        else
+        {
+                failures += test_extents_check ("block INNER",
+                  dxf_block_extents_get (block_extents, "Inner", &block),
+                  -1.0, -1.0, 1.0, 1.0);
+                if (block != &inner)
+                {
+                        fprintf (stderr, "TESTS: block INNER was not found.\n");
+                        failures++;
+                }
+                failures += test_extents_check ("block OUTER",
+                  dxf_block_extents_get (block_extents, "OUTER", NULL),
+                  0.0, -2.0, 12.0, 2.0);
+                failures += test_extents_check ("block LOOP",
+                  dxf_block_extents_get (block_extents, "LOOP", NULL),
+                  5.0, 5.0, 5.0, 5.0);
+                if (dxf_block_extents_get (block_extents, "MISSING", NULL) != NULL)
+                {
+                        fprintf (stderr, "TESTS: block MISSING was found.\n");
+                        failures++;
+                }
+                if ((dxf_entity_get_extents_with_blocks (INSERT, &inserts[0], block_extents, &extents) == EXIT_FAILURE)
+                  || (test_extents_check ("rotated INSERT", &extents,
+                  98.0, 0.0, 102.0, 12.0) == EXIT_FAILURE))
+                {
+                        failures++;
+                }
+                if ((dxf_entity_get_extents_with_blocks (INSERT, &inserts[1], block_extents, &extents) == EXIT_FAILURE)
+                  || (test_extents_check ("MINSERT", &extents,
+                  0.0, -52.0, 52.0, -38.0) == EXIT_FAILURE))
+                {
+                        failures++;
+                }
+                dxf_block_extents_free (block_extents);
+        }
+        /* Without blocks an INSERT only has its insertion point. */
+        if ((dxf_entity_get_extents (INSERT, &inserts[0], &extents) == EXIT_FAILURE)
+          || (test_extents_check ("INSERT without blocks", &extents,
+          100.0, 0.0, 100.0, 0.0) == EXIT_FAILURE))
+        {
+                failures++;
+        }
+        if ((dxf_drawing_compute_extents (&drawing, &extents) == EXIT_FAILURE)
+          || (test_extents_check ("the drawing", &extents,
+          0.0, -52.0, 102.0, 12.0) == EXIT_FAILURE))
+        {
+                failures++;
+        }
+        free (inner_entities.sequence);
+        free (outer_entities.sequence);
+        free (loop_entities.sequence);
+        free (entities.sequence);
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for the extents of entities and
+ * drawings.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_extents ()
+{
+        int failures = 0;
+
+        failures += test_extents_nested_blocks ();
+        return (failures);
+}
+
+
+/* EOF */
@@ -0,0 +1,349 @@
+/*!
+ * \file test_face_soup.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the face soups of \c 3DFACE, \c SOLID and
+ * \c TRACE entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+#define TEST_FACE_SOUP_NUMBER_OF_FACES (2 * DXF_FACE_SOUP_CHUNK_SIZE + 1000)
+        /*!< \brief Number of faces in the chunked face soup test, enough
+         * for three chunks. */
+
+
+/*!
+ * \brief Create a \c 3DFACE entity.
+ *
+ * \return a pointer to the face, to be freed with dxf_3dface_free ()
+ * together with it's corners.
+ */
+static Dxf3dface *
+test_face_soup_3dface_new
+(
+        const double *corners,
+                /*!< X, Y and Z-value of the four corners. */
+        int flag
+                /*!< Invisible edge flags. */
+)
+{
+        Dxf3dface *face;
+
+        face = dxf_3dface_init (dxf_3dface_new ());
+        face->p0 = dxf_point_init (dxf_point_new ());
+        face->p1 = dxf_point_init (dxf_point_new ());
+        face->p2 = dxf_point_init (dxf_point_new ());
+        face->p3 = dxf_point_init (dxf_point_new ());
+        face->p0->x0 = corners[0];
+        face->p0->y0 = corners[1];
+        face->p0->z0 = corners[2];
+        face->p1->x0 = corners[3];
+        face->p1->y0 = corners[4];
+        face->p1->z0 = corners[5];
+        face->p2->x0 = corners[6];
+        face->p2->y0 = corners[7];
+        face->p2->z0 = corners[8];
+        face->p3->x0 = corners[9];
+        face->p3->y0 = corners[10];
+        face->p3->z0 = corners[11];
+        face->flag = flag;
+        return (face);
+}
+
+
+/*!
+ * \brief Free a \c 3DFACE entity taken from a list.
+ */
+static void
+test_face_soup_3dface_free
+(
+        Dxf3dface *face
+)
+{
+        face->next = NULL;
+        dxf_3dface_free (face);
+}
+
+
+/*!
+ * \brief Compute the sum of the triangle areas of a face soup.
+ */
+static double
+test_face_soup_area
+(
+        DxfFaceSoup *soup
+)
+{
+        const double *a;
+        const double *b;
+        const double *c;
+        double n[3];
+        double area = 0.0;
+        int i;
+
+        for (i = 0; i < soup->number_of_triangles; i++)
+        {
+                a = soup->vertices + 3 * soup->indices[3 * i];
+                b = soup->vertices + 3 * soup->indices[3 * i + 1];
+                c = soup->vertices + 3 * soup->indices[3 * i + 2];
+                n[0] = (b[1] - a[1]) * (c[2] - a[2]) - (b[2] - a[2]) * (c[1] - a[1]);
+                n[1] = (b[2] - a[2]) * (c[0] - a[0]) - (b[0] - a[0]) * (c[2] - a[2]);
+                n[2] = (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+                area += 0.5 * sqrt (n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        }
+        return (area);
+}
+
+
+/*!
+ * \brief Test shared vertices, repeated corners, edge visibility and
+ * dropped faces without area.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_face_soup_3dfaces ()
+{
+        const double corners[4][12] =
+        {
+                /* A unit square. */
+                {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0},
+                /* The adjacent square. */
+                {1.0, 0.0, 0.0, 2.0, 0.0, 0.0, 2.0, 1.0, 0.0, 1.0, 1.0, 0.0},
+                /* A triangle with a repeated last corner. */
+                {2.0, 0.0, 0.0, 3.0, 0.0, 0.0, 2.0, 1.0, 0.0, 2.0, 1.0, 0.0},
+                /* Corners on a line. */
+                {0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 2.0, 0.0, 1.0, 3.0, 0.0, 1.0}
+        };
+        Dxf3dface *faces[4];
+        DxfFaceSoup *soup;
+        int failures = 0;
+        int i;
+
+        soup = dxf_face_soup_new ();
+        for (i = 0; i < 4; i++)
+        {
+                faces[i] = test_face_soup_3dface_new (corners[i], (i == 2) ? 1 : 0);
+                if (dxf_face_soup_add_entity (soup, DFACE, faces[i]) == EXIT_FAILURE)
+                {
+                        fprintf (stderr, "TESTS: could not add a 3DFACE to the face soup.\n");
+                        failures++;
+                }
+        }
+        if ((soup->number_of_vertices != 7)
+          || (soup->number_of_triangles != 5)
+          || (fabs (test_face_soup_area (soup) - 2.5) > 1e-12))
+        {
+                fprintf (stderr, "TESTS: face soup has %d vertices and %d triangles.\n",
+                  soup->number_of_vertices, soup->number_of_triangles);
+                failures++;
+        }
+        else
+        {
+                for (i = 0; i < 4; i++)
+                {
+                        if (soup->entities[i] != faces[i / 2])
+                        {
+                                fprintf (stderr, "TESTS: face soup triangle %d refers to the wrong entity.\n", i);
+                                failures++;
+                        }
+                }
+                /* The split diagonal and the first edge of the triangle
+                 * are invisible. */
+                if ((soup->entities[4] != faces[2])
+                  || (soup->invisible_edges[0] != 4)
+                  || (soup->invisible_edges[1] != 1)
+                  || (soup->invisible_edges[4] != 1))
+                {
+                        fprintf (stderr, "TESTS: wrong edge visibility in the face soup.\n");
+                        failures++;
+                }
+        }
+        dxf_face_soup_free (soup);
+        for (i = 0; i < 4; i++)
+        {
+                test_face_soup_3dface_free (faces[i]);
+        }
+        return (failures);
+}
+
+
+/*!
+ * \brief Test a \c SOLID entity in an OCS with a negative extrusion
+ * direction.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_face_soup_solid ()
+{
+        DxfSolid *solid;
+        DxfFaceSoup *soup;
+        int failures = 0;
+        int i;
+
+        solid = dxf_solid_init (dxf_solid_new ());
+        solid->p1->x0 = 2.0;
+        solid->p2->y0 = 1.0;
+        solid->p3->x0 = 2.0;
+        solid->p3->y0 = 1.0;
+        solid->extr_z0 = -1.0;
+        soup = dxf_face_soup_new ();
+        if ((dxf_face_soup_add_entity (soup, SOLID, solid) == EXIT_FAILURE)
+          || (soup->number_of_vertices != 4)
+          || (soup->number_of_triangles != 2)
+          || (fabs (test_face_soup_area (soup) - 2.0) > 1e-12))
+        {
+                fprintf (stderr, "TESTS: wrong face soup of a SOLID.\n");
+                failures++;
+        }
+        else
+        {
+                /* The OCS X-axis of the extrusion direction (0, 0, -1)
+                 * points along the negative WCS X-axis. */
+                for (i = 0; i < soup->number_of_vertices; i++)
+                {
+                        if (soup->vertices[3 * i] > 0.0)
+                        {
+                                fprintf (stderr, "TESTS: SOLID corners are not in the WCS.\n");
+                                failures++;
+                                break;
+                        }
+                }
+        }
+        dxf_face_soup_free (soup);
+        dxf_solid_free (solid);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test that adding the faces of an entities section in chunks
+ * gives the same soup as adding them one by one.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_face_soup_chunks ()
+{
+        DxfEntities entities;
+        Dxf3dface *face;
+        Dxf3dface *last = NULL;
+        Dxf3dface *next;
+        DxfFaceSoup *direct;
+        DxfFaceSoup *chunked;
+        double corners[12];
+        int failures = 0;
+        int i;
+
+        memset (&entities, 0, sizeof (entities));
+        direct = dxf_face_soup_new ();
+        /* A strip of squares in a wave, the squares share their edges
+         * across the chunk boundaries. */
+        for (i = 0; i < TEST_FACE_SOUP_NUMBER_OF_FACES; i++)
+        {
+                corners[0] = i;
+                corners[1] = 0.0;
+                corners[2] = sin (0.01 * i);
+                corners[3] = i + 1;
+                corners[4] = 0.0;
+                corners[5] = sin (0.01 * (i + 1));
+                corners[6] = i + 1;
+                corners[7] = 1.0;
+                corners[8] = corners[5];
+                corners[9] = i;
+                corners[10] = 1.0;
+                corners[11] = corners[2];
+                face = test_face_soup_3dface_new (corners, i % 16);
+                if (last == NULL)
+                {
+                        entities.dface_list = (struct Dxf3dface *) face;
+                }
+                else
+                {
+                        last->next = (struct Dxf3dface *) face;
+                }
+                last = face;
+                dxf_face_soup_add_entity (direct, DFACE, face);
+        }
+        chunked = dxf_face_soup_new ();
+        if ((dxf_face_soup_add_entities (chunked, &entities) == EXIT_FAILURE)
+          || (chunked->number_of_vertices != direct->number_of_vertices)
+          || (chunked->number_of_triangles != direct->number_of_triangles)
+          || (memcmp (chunked->vertices, direct->vertices,
+            3 * (size_t) direct->number_of_vertices * sizeof (double)) != 0)
+          || (memcmp (chunked->indices, direct->indices,
+            3 * (size_t) direct->number_of_triangles * sizeof (int)) != 0)
+          || (memcmp (chunked->invisible_edges, direct->invisible_edges,
+            (size_t) direct->number_of_triangles) != 0)
+          || (memcmp (chunked->entities, direct->entities,
+            (size_t) direct->number_of_triangles * sizeof (void *)) != 0))
+        {
+                fprintf (stderr, "TESTS: chunked face soup differs from the direct face soup.\n");
+                failures++;
+        }
+        if (direct->number_of_vertices != 2 * (TEST_FACE_SOUP_NUMBER_OF_FACES + 1))
+        {
+                fprintf (stderr, "TESTS: face soup does not share the vertices of adjacent faces.\n");
+                failures++;
+        }
+        dxf_face_soup_free (chunked);
+        dxf_face_soup_free (direct);
+        for (face = (Dxf3dface *) entities.dface_list; face != NULL; face = next)
+        {
+                next = (Dxf3dface *) face->next;
+                test_face_soup_3dface_free (face);
+        }
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for face soups.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_face_soup ()
+{
+        int failures = 0;
+
+        failures += test_face_soup_3dfaces ();
+        failures += test_face_soup_solid ();
+        failures += test_face_soup_chunks ();
+        return (failures);
+}
+
+
+/* EOF */
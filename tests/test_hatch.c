@@ -0,0 +1,824 @@
+/*!
+ * \file test_hatch.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the \c HATCH boundary classification,
+ * pattern line, triangulation and nesting functions.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Point of a classification test with it's expected result.
+ */
+typedef struct
+test_hatch_point_struct
+{
+        double x;
+                /*!< X-value of the point. */
+        double y;
+                /*!< Y-value of the point. */
+        int expected;
+                /*!< \c INSIDE, \c OUTSIDE or \c ON_EDGE. */
+} TestHatchPoint;
+
+
+/*!
+ * \brief Build a \c HATCH boundary polyline from an array of vertices.
+ *
+ * \return a pointer to the polyline, or \c NULL when no memory could be
+ * allocated.
+ */
+static DxfHatchBoundaryPathPolyline *
+test_hatch_polyline
+(
+        const double *vertices,
+                /*!< X-value, Y-value and bulge of every vertex, the
+                 * bulge applies to the edge to the next vertex. */
+        int number_of_vertices
+                /*!< Number of vertices. */
+)
+{
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *last = NULL;
+        int i;
+
+        polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+        if (polyline == NULL)
+        {
+                return (NULL);
+        }
+        polyline->is_closed = 1;
+        for (i = 0; i < number_of_vertices; i++)
+        {
+                vertex = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+                if (vertex == NULL)
+                {
+                        break;
+                }
+                vertex->x0 = vertices[3 * i];
+                vertex->y0 = vertices[3 * i + 1];
+                vertex->bulge = vertices[3 * i + 2];
+                vertex->has_bulge = (vertex->bulge != 0.0);
+                if (last == NULL)
+                {
+                        polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+                }
+                else
+                {
+                        last->next = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+                }
+                last = vertex;
+                polyline->number_of_vertices++;
+        }
+        return (polyline);
+}
+
+
+/*!
+ * \brief Free a \c HATCH boundary polyline built by
+ * test_hatch_polyline ().
+ */
+static void
+test_hatch_polyline_free
+(
+        DxfHatchBoundaryPathPolyline *polyline
+)
+{
+        dxf_hatch_boundary_path_polyline_vertex_free_list ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        polyline->vertices = NULL;
+        dxf_hatch_boundary_path_polyline_free (polyline);
+}
+
+
+/*!
+ * \brief Classify points against a boundary one by one, as a batch and
+ * with a boundary grid, and compare the results with the expected
+ * ones.
+ *
+ * \return the number of points classified wrong.
+ */
+static int
+test_hatch_classify
+(
+        const char *name,
+                /*!< Name of the boundary. */
+        const double *vertices,
+                /*!< X-value, Y-value and bulge of every vertex. */
+        int number_of_vertices,
+                /*!< Number of vertices. */
+        TestHatchPoint *points,
+                /*!< Points with their expected result. */
+        int number_of_points,
+                /*!< Number of points. */
+        double tolerance
+                /*!< Tolerance for points on the boundary. */
+)
+{
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryGrid *grid;
+        double x[16];
+        double y[16];
+        int batch[16];
+        int gridded[16];
+        int result;
+        int failures = 0;
+        int i;
+
+        polyline = test_hatch_polyline (vertices, number_of_vertices);
+        grid = dxf_hatch_boundary_grid_new (polyline, 4, tolerance);
+        if ((polyline == NULL) || (grid == NULL) || (number_of_points > 16))
+        {
+                fprintf (stderr, "TESTS: could not build the %s boundary.\n", name);
+                return (number_of_points);
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                x[i] = points[i].x;
+                y[i] = points[i].y;
+        }
+        dxf_hatch_boundary_path_polyline_classify_points (polyline, x, y,
+          number_of_points, tolerance, batch);
+        dxf_hatch_boundary_grid_classify_points (grid, x, y,
+          number_of_points, gridded);
+        for (i = 0; i < number_of_points; i++)
+        {
+                result = dxf_hatch_boundary_path_polyline_classify_point (polyline,
+                  x[i], y[i], tolerance);
+                if ((result != points[i].expected)
+                  || (batch[i] != points[i].expected)
+                  || (gridded[i] != points[i].expected)
+                  || (dxf_hatch_boundary_grid_classify_point (grid, x[i], y[i]) != points[i].expected))
+                {
+                        fprintf (stderr, "TESTS: point (%g, %g) of the %s boundary classified as %d, %d, %d where %d was expected.\n",
+                          x[i], y[i], name, result, batch[i], gridded[i],
+                          points[i].expected);
+                        failures++;
+                }
+        }
+        dxf_hatch_boundary_grid_free (grid);
+        test_hatch_polyline_free (polyline);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test the classification of points against boundaries with
+ * straight and bulged edges.
+ *
+ * \return the number of points classified wrong.
+ */
+static int
+test_hatch_classify_boundaries ()
+{
+        /* Square from (0, 0) to (10, 10), counterclockwise. */
+        double square[] =
+        {
+                0.0, 0.0, 0.0,
+                10.0, 0.0, 0.0,
+                10.0, 10.0, 0.0,
+                0.0, 10.0, 0.0
+        };
+        TestHatchPoint square_points[] =
+        {
+                {5.0, 5.0, INSIDE},
+                {15.0, 5.0, OUTSIDE},
+                {-5.0, 5.0, OUTSIDE},
+                {5.0, 15.0, OUTSIDE},
+                {10.0, 5.0, ON_EDGE},
+                {5.0, 0.0, ON_EDGE},
+                {0.0, 0.0, ON_EDGE},
+                {10.0, 10.0, ON_EDGE},
+                {5.0, -1e-12, ON_EDGE}
+        };
+        /* The right edge bulges outward as a half circle around
+         * (10, 5) with radius 5. */
+        double outward[] =
+        {
+                0.0, 0.0, 0.0,
+                10.0, 0.0, 1.0,
+                10.0, 10.0, 0.0,
+                0.0, 10.0, 0.0
+        };
+        TestHatchPoint outward_points[] =
+        {
+                {5.0, 5.0, INSIDE},
+                {13.0, 5.0, INSIDE},
+                {14.9, 5.0, INSIDE},
+                {15.0, 5.0, ON_EDGE},
+                {10.0 + 2.5 * M_SQRT2, 5.0 + 2.5 * M_SQRT2, ON_EDGE},
+                {14.0, 9.0, OUTSIDE},
+                {15.1, 5.0, OUTSIDE},
+                {10.0, 5.0, INSIDE}
+        };
+        /* The right edge bulges inward as a half circle around (10, 5)
+         * with radius 5. */
+        double inward[] =
+        {
+                0.0, 0.0, 0.0,
+                10.0, 0.0, -1.0,
+                10.0, 10.0, 0.0,
+                0.0, 10.0, 0.0
+        };
+        TestHatchPoint inward_points[] =
+        {
+                {4.0, 5.0, INSIDE},
+                {5.0, 5.0, ON_EDGE},
+                {6.0, 5.0, OUTSIDE},
+                {2.0, 9.0, INSIDE},
+                {9.5, 9.9, OUTSIDE},
+                {12.0, 5.0, OUTSIDE},
+                {10.0, 0.0, ON_EDGE}
+        };
+        /* The outward bulged square clockwise: the winding number is
+         * negative inside. */
+        double clockwise[] =
+        {
+                0.0, 0.0, 0.0,
+                0.0, 10.0, 0.0,
+                10.0, 10.0, -1.0,
+                10.0, 0.0, 0.0
+        };
+        TestHatchPoint clockwise_points[] =
+        {
+                {5.0, 5.0, INSIDE},
+                {14.9, 5.0, INSIDE},
+                {15.0, 5.0, ON_EDGE},
+                {15.1, 5.0, OUTSIDE},
+                {-1.0, 5.0, OUTSIDE}
+        };
+        int failures = 0;
+
+        failures += test_hatch_classify ("square", square, 4,
+          square_points, 9, 1e-9);
+        failures += test_hatch_classify ("outward bulged", outward, 4,
+          outward_points, 8, 1e-9);
+        failures += test_hatch_classify ("inward bulged", inward, 4,
+          inward_points, 7, 1e-9);
+        failures += test_hatch_classify ("clockwise bulged", clockwise, 4,
+          clockwise_points, 5, 1e-9);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test that a boundary grid classifies many points the same as
+ * the direct test, for several numbers of bands.
+ *
+ * The boundary is a star with bulged and straight edges, the points lie
+ * on a grid covering the star, including points on the vertices.
+ *
+ * \return the number of points classified differently.
+ */
+static int
+test_hatch_grid_equivalence ()
+{
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryGrid *grid;
+        double star[3 * 16];
+        double *x;
+        double *y;
+        int *direct;
+        int *gridded;
+        int number_of_points;
+        int bands[] = {1, 3, 17, 256};
+        int failures = 0;
+        double r;
+        double a;
+        int i;
+        int j;
+        int b;
+
+        for (i = 0; i < 16; i++)
+        {
+                r = (i % 2) ? 4.0 : 10.0;
+                a = 2.0 * M_PI * i / 16;
+                star[3 * i] = r * cos (a);
+                star[3 * i + 1] = r * sin (a);
+                star[3 * i + 2] = (i % 4 == 0) ? 0.5 : ((i % 4 == 2) ? -0.3 : 0.0);
+        }
+        polyline = test_hatch_polyline (star, 16);
+        number_of_points = 61 * 61;
+        x = malloc (number_of_points * sizeof (double));
+        y = malloc (number_of_points * sizeof (double));
+        direct = malloc (number_of_points * sizeof (int));
+        gridded = malloc (number_of_points * sizeof (int));
+        if ((polyline == NULL) || (x == NULL) || (y == NULL)
+          || (direct == NULL) || (gridded == NULL))
+        {
+                fprintf (stderr, "TESTS: could not allocate memory.\n");
+                return (1);
+        }
+        for (i = 0; i < 61; i++)
+        {
+                for (j = 0; j < 61; j++)
+                {
+                        x[61 * i + j] = -15.0 + 0.5 * j;
+                        y[61 * i + j] = -15.0 + 0.5 * i;
+                }
+        }
+        /* Add the vertices themselves. */
+        for (i = 0; i < 16; i++)
+        {
+                x[i] = star[3 * i];
+                y[i] = star[3 * i + 1];
+        }
+        dxf_hatch_boundary_path_polyline_classify_points (polyline, x, y,
+          number_of_points, 1e-9, direct);
+        for (b = 0; b < 4; b++)
+        {
+                grid = dxf_hatch_boundary_grid_new (polyline, bands[b], 1e-9);
+                if (grid == NULL)
+                {
+                        failures++;
+                        continue;
+                }
+                dxf_hatch_boundary_grid_classify_points (grid, x, y,
+                  number_of_points, gridded);
+                for (i = 0; i < number_of_points; i++)
+                {
+                        if (gridded[i] != direct[i])
+                        {
+                                fprintf (stderr, "TESTS: point (%g, %g) classified as %d with %d bands, as %d directly.\n",
+                                  x[i], y[i], gridded[i], bands[b], direct[i]);
+                                failures++;
+                        }
+                }
+                dxf_hatch_boundary_grid_free (grid);
+        }
+        for (i = 0; i < 16; i++)
+        {
+                if (direct[i] != ON_EDGE)
+                {
+                        fprintf (stderr, "TESTS: vertex %d of the star classified as %d.\n",
+                          i, direct[i]);
+                        failures++;
+                }
+        }
+        free (x);
+        free (y);
+        free (direct);
+        free (gridded);
+        test_hatch_polyline_free (polyline);
+        return (failures);
+}
+
+
+/*!
+ * \brief Append a closed loop to a tessellation, ending with it's first
+ * point.
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE when no memory
+ * could be allocated.
+ */
+static int
+test_hatch_add_loop
+(
+        DxfTessellation *loops,
+                /*!< Tessellation receiving the loop. */
+        const double *points,
+                /*!< X-value and Y-value of every point. */
+        int number_of_points
+                /*!< Number of points, without the closing point. */
+)
+{
+        double *p;
+        int *offsets;
+        int n;
+        int i;
+
+        n = loops->number_of_points + number_of_points + 1;
+        p = realloc (loops->points, 3 * n * sizeof (double));
+        if (p == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        loops->points = p;
+        loops->points_size = n;
+        offsets = realloc (loops->offsets, (loops->number_of_curves + 2) * sizeof (int));
+        if (offsets == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        loops->offsets = offsets;
+        loops->offsets_size = loops->number_of_curves + 2;
+        loops->offsets[loops->number_of_curves] = loops->number_of_points;
+        for (i = 0; i <= number_of_points; i++)
+        {
+                p = loops->points + 3 * (loops->number_of_points + i);
+                p[0] = points[2 * (i % number_of_points)];
+                p[1] = points[2 * (i % number_of_points) + 1];
+                p[2] = 0.0;
+        }
+        loops->number_of_points = n;
+        loops->number_of_curves++;
+        loops->offsets[loops->number_of_curves] = n;
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Build the loops of a 10 by 10 square with a 4 by 4 square
+ * hole and a 2 by 2 square island in the hole.
+ *
+ * \return a pointer to the loops, or \c NULL when an error occurred.
+ */
+static DxfTessellation *
+test_hatch_nested_squares ()
+{
+        double outer[] = {0.0, 0.0, 10.0, 0.0, 10.0, 10.0, 0.0, 10.0};
+        double hole[] = {3.0, 3.0, 3.0, 7.0, 7.0, 7.0, 7.0, 3.0};
+        double island[] = {4.0, 4.0, 6.0, 4.0, 6.0, 6.0, 4.0, 6.0};
+        DxfTessellation *loops;
+
+        loops = dxf_tessellation_new ();
+        if ((loops == NULL)
+          || (test_hatch_add_loop (loops, outer, 4) == EXIT_FAILURE)
+          || (test_hatch_add_loop (loops, hole, 4) == EXIT_FAILURE)
+          || (test_hatch_add_loop (loops, island, 4) == EXIT_FAILURE))
+        {
+                fprintf (stderr, "TESTS: could not build the nested squares.\n");
+                return (NULL);
+        }
+        return (loops);
+}
+
+
+/*!
+ * \brief Test the pattern lines of a horizontal pattern with a spacing
+ * of 1 and dashes of 0.5 and -0.5 in the nested squares, for every
+ * hatch style.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_hatch_pattern ()
+{
+        DxfTessellation *loops;
+        DxfHatchPatternDefLine *def_line;
+        DxfHatchPatternDefLineDash *dash;
+        DxfHatchPatternDefLineDash *gap;
+        DxfHatchFillSegments *segments;
+        /* Filled length of the lines at y = 0.5, 1.5, .. 9.5 per style:
+         * normal skips the hole but fills the island, outer skips the
+         * hole and the island, ignore fills everything. */
+        double expected[3] = {100.0 - 16.0 + 4.0, 100.0 - 16.0, 100.0};
+        double length;
+        const double *p;
+        int failures = 0;
+        int style;
+        int i;
+
+        loops = test_hatch_nested_squares ();
+        def_line = dxf_hatch_pattern_def_line_init (dxf_hatch_pattern_def_line_new ());
+        segments = dxf_hatch_fill_segments_new ();
+        if ((loops == NULL) || (def_line == NULL) || (segments == NULL))
+        {
+                return (1);
+        }
+        def_line->angle = 0.0;
+        def_line->x0 = 0.0;
+        def_line->y0 = 0.5;
+        def_line->x1 = 0.0;
+        def_line->y1 = 1.0;
+        for (style = 0; style < 3; style++)
+        {
+                dxf_hatch_fill_segments_clear (segments);
+                if (dxf_hatch_fill_pattern_loops (loops, style, def_line,
+                  segments) == EXIT_FAILURE)
+                {
+                        failures++;
+                        continue;
+                }
+                length = 0.0;
+                for (i = 0; i < segments->number_of_segments; i++)
+                {
+                        p = segments->points + 6 * i;
+                        length += fabs (p[3] - p[0]);
+                        if ((p[1] != p[4])
+                          || (p[0] < -1e-9) || (p[3] > 10.0 + 1e-9)
+                          || (p[0] > p[3]))
+                        {
+                                fprintf (stderr, "TESTS: bad pattern segment (%g, %g) - (%g, %g) for hatch style %d.\n",
+                                  p[0], p[1], p[3], p[4], style);
+                                failures++;
+                                break;
+                        }
+                }
+                if (fabs (length - expected[style]) > 1e-9)
+                {
+                        fprintf (stderr, "TESTS: pattern length %g for hatch style %d, %g was expected.\n",
+                          length, style, expected[style]);
+                        failures++;
+                }
+        }
+        /* Dashes halve the filled length of the ignore style. */
+        dash = dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+        gap = dxf_hatch_pattern_def_line_dash_init (dxf_hatch_pattern_def_line_dash_new ());
+        dash->length = 0.5;
+        gap->length = -0.5;
+        dash->next = (struct DxfHatchPatternDefLineDash *) gap;
+        def_line->dashes = (struct DxfHatchPatternDefLineDash *) dash;
+        def_line->number_of_dash_items = 2;
+        dxf_hatch_fill_segments_clear (segments);
+        dxf_hatch_fill_pattern_loops (loops, 2, def_line, segments);
+        length = 0.0;
+        for (i = 0; i < segments->number_of_segments; i++)
+        {
+                p = segments->points + 6 * i;
+                length += fabs (p[3] - p[0]);
+        }
+        if (fabs (length - 50.0) > 1e-9)
+        {
+                fprintf (stderr, "TESTS: dashed pattern length %g, 50 was expected.\n",
+                  length);
+                failures++;
+        }
+        dxf_hatch_fill_segments_free (segments);
+        dxf_tessellation_free (loops);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test the triangulation of the nested squares for every hatch
+ * style by the total area of the triangles.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_hatch_triangulate ()
+{
+        DxfTessellation *loops;
+        DxfHatchFillTriangles *triangles;
+        double expected[3] = {100.0 - 16.0 + 4.0, 100.0 - 16.0, 100.0};
+        double area;
+        const double *a;
+        const double *b;
+        const double *c;
+        int failures = 0;
+        int style;
+        int i;
+
+        loops = test_hatch_nested_squares ();
+        triangles = dxf_hatch_fill_triangles_new ();
+        if ((loops == NULL) || (triangles == NULL))
+        {
+                return (1);
+        }
+        for (style = 0; style < 3; style++)
+        {
+                dxf_hatch_fill_triangles_clear (triangles);
+                if (dxf_hatch_fill_triangulate_loops (loops, style, triangles) == EXIT_FAILURE)
+                {
+                        failures++;
+                        continue;
+                }
+                area = 0.0;
+                for (i = 0; i < triangles->number_of_triangles; i++)
+                {
+                        a = triangles->vertices + 3 * triangles->indices[3 * i];
+                        b = triangles->vertices + 3 * triangles->indices[3 * i + 1];
+                        c = triangles->vertices + 3 * triangles->indices[3 * i + 2];
+                        /* Counterclockwise triangles have a positive
+                         * area. */
+                        if ((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]) < 0.0)
+                        {
+                                fprintf (stderr, "TESTS: clockwise triangle for hatch style %d.\n",
+                                  style);
+                                failures++;
+                        }
+                        area += 0.5 * fabs ((b[0] - a[0]) * (c[1] - a[1])
+                          - (b[1] - a[1]) * (c[0] - a[0]));
+                }
+                if (fabs (area - expected[style]) > 1e-9)
+                {
+                        fprintf (stderr, "TESTS: triangulated area %g for hatch style %d, %g was expected.\n",
+                          area, style, expected[style]);
+                        failures++;
+                }
+        }
+        dxf_hatch_fill_triangles_free (triangles);
+        dxf_tessellation_free (loops);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test the containment tree of the nested squares.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_hatch_nesting ()
+{
+        DxfTessellation *loops;
+        DxfHatchFillLoop nesting[3];
+        int parents[3] = {-1, 0, 1};
+        int failures = 0;
+        int i;
+
+        loops = test_hatch_nested_squares ();
+        if ((loops == NULL)
+          || (dxf_hatch_fill_nest_loops (loops, nesting) == EXIT_FAILURE))
+        {
+                return (1);
+        }
+        for (i = 0; i < 3; i++)
+        {
+                if ((nesting[i].parent != parents[i])
+                  || (nesting[i].depth != i))
+                {
+                        fprintf (stderr, "TESTS: loop %d nested in %d at depth %d.\n",
+                          i, nesting[i].parent, nesting[i].depth);
+                        failures++;
+                }
+        }
+        /* The outer square and the island run counterclockwise, the
+         * hole clockwise. */
+        if ((fabs (nesting[0].area - 100.0) > 1e-9)
+          || (fabs (nesting[1].area + 16.0) > 1e-9)
+          || (fabs (nesting[2].area - 4.0) > 1e-9))
+        {
+                fprintf (stderr, "TESTS: wrong loop areas %g, %g and %g.\n",
+                  nesting[0].area, nesting[1].area, nesting[2].area);
+                failures++;
+        }
+        if ((nesting[1].min_x != 3.0) || (nesting[1].max_y != 7.0))
+        {
+                fprintf (stderr, "TESTS: wrong bounding box of the hole.\n");
+                failures++;
+        }
+        dxf_tessellation_free (loops);
+        return (failures);
+}
+
+
+/*!
+ * \brief Write a \c HATCH and collect the boundary path type flags
+ * (group code 92) from the output.
+ *
+ * \return the number of type flags found, or \c -1 when the \c HATCH
+ * was not written.
+ */
+static int
+test_hatch_write_types
+(
+        DxfHatch *hatch,
+                /*!< a pointer to a DXF \c HATCH entity. */
+        int32_t *types,
+                /*!< Receives the type flags. */
+        int size,
+                /*!< Size of \c types. */
+        long *length
+                /*!< Receives the length of the output. */
+)
+{
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        DxfFile file;
+        int count = 0;
+
+        memset (&file, 0, sizeof (file));
+        file.fp = tmpfile ();
+        file.acad_version_number = AutoCAD_2000;
+        if (dxf_hatch_write (&file, hatch) == EXIT_FAILURE)
+        {
+                count = -1;
+        }
+        *length = ftell (file.fp);
+        rewind (file.fp);
+        while ((count >= 0)
+          && (fgets (code, sizeof (code), file.fp) != NULL)
+          && (fgets (value, sizeof (value), file.fp) != NULL))
+        {
+                if ((atoi (code) == 92) && (count < size))
+                {
+                        types[count++] = atoi (value);
+                }
+        }
+        fclose (file.fp);
+        return (count);
+}
+
+
+/*!
+ * \brief Test that writing a \c HATCH leaves the boundary path type
+ * flags alone, that dxf_hatch_fill_mark_outermost () marks them and
+ * that edge boundary paths are refused.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_hatch_write ()
+{
+        const double outer[] = {0.0, 0.0, 0.0, 10.0, 0.0, 0.0, 10.0, 10.0, 0.0, 0.0, 10.0, 0.0};
+        const double inner[] = {3.0, 3.0, 0.0, 7.0, 3.0, 0.0, 7.0, 7.0, 0.0, 3.0, 7.0, 0.0};
+        DxfHatch *hatch;
+        DxfHatchBoundaryPath *paths[2];
+        DxfHatchBoundaryPath *path;
+        int32_t types[4];
+        long length;
+        int failures = 0;
+        int i;
+
+        hatch = dxf_hatch_init (dxf_hatch_new ());
+        hatch->p0 = dxf_point_init (dxf_point_new ());
+        for (i = 0; i < 2; i++)
+        {
+                paths[i] = dxf_hatch_boundary_path_init (dxf_hatch_boundary_path_new ());
+                paths[i]->polylines = (struct DxfHatchBoundaryPathPolyline *)
+                  test_hatch_polyline ((i == 0) ? inner : outer, 4);
+        }
+        /* The inner square comes first and is wrongly marked. */
+        paths[0]->type = DXF_HATCH_BOUNDARY_PATH_OUTERMOST;
+        paths[0]->next = (struct DxfHatchBoundaryPath *) paths[1];
+        hatch->paths = (struct DxfHatchBoundaryPath *) paths[0];
+        hatch->number_of_boundary_paths = 2;
+        if ((test_hatch_write_types (hatch, types, 4, &length) != 2)
+          || (types[0] != (DXF_HATCH_BOUNDARY_PATH_OUTERMOST | DXF_HATCH_BOUNDARY_PATH_POLYLINE))
+          || (types[1] != DXF_HATCH_BOUNDARY_PATH_POLYLINE)
+          || (paths[0]->type != DXF_HATCH_BOUNDARY_PATH_OUTERMOST)
+          || (paths[1]->type != 0))
+        {
+                fprintf (stderr, "TESTS: writing a HATCH changed or misreported the boundary path types.\n");
+                failures++;
+        }
+        if ((dxf_hatch_fill_mark_outermost (hatch) == EXIT_FAILURE)
+          || (test_hatch_write_types (hatch, types, 4, &length) != 2)
+          || (types[0] != DXF_HATCH_BOUNDARY_PATH_POLYLINE)
+          || (types[1] != (DXF_HATCH_BOUNDARY_PATH_OUTERMOST | DXF_HATCH_BOUNDARY_PATH_POLYLINE)))
+        {
+                fprintf (stderr, "TESTS: wrong outermost HATCH boundary paths.\n");
+                failures++;
+        }
+        /* An edge boundary path can not be written. */
+        paths[1]->edges = (struct DxfHatchBoundaryPathEdge *) dxf_hatch_boundary_path_edge_new ();
+        if ((test_hatch_write_types (hatch, types, 4, &length) != -1)
+          || (length != 0))
+        {
+                fprintf (stderr, "TESTS: a HATCH with an edge boundary path was written.\n");
+                failures++;
+        }
+        for (path = paths[0]; path != NULL; path = (DxfHatchBoundaryPath *) path->next)
+        {
+                test_hatch_polyline_free ((DxfHatchBoundaryPathPolyline *) path->polylines);
+                path->polylines = NULL;
+        }
+        dxf_hatch_free (hatch);
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for the \c HATCH boundary functions.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_hatch ()
+{
+        int failures = 0;
+
+        failures += test_hatch_classify_boundaries ();
+        failures += test_hatch_grid_equivalence ();
+        failures += test_hatch_pattern ();
+        failures += test_hatch_triangulate ();
+        failures += test_hatch_nesting ();
+        failures += test_hatch_write ();
+        return (failures);
+}
+
+
+/* EOF */
@@ -0,0 +1,269 @@
+/*!
+ * \file test_instance.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the instance tables of block references.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Initialize an \c INSERT of a block at a point.
+ */
+static void
+test_instance_insert
+(
+        DxfInsert *insert,
+                /*!< Insert to initialize. */
+        DxfPoint *point,
+                /*!< Insertion point. */
+        char *block_name,
+                /*!< Name of the inserted block. */
+        double x,
+                /*!< X-value of the insertion point. */
+        double y
+                /*!< Y-value of the insertion point. */
+)
+{
+        memset (insert, 0, sizeof (DxfInsert));
+        memset (point, 0, sizeof (DxfPoint));
+        point->x0 = x;
+        point->y0 = y;
+        insert->p0 = point;
+        insert->block_name = block_name;
+        insert->layer = "0";
+        insert->rel_x_scale = 1.0;
+        insert->rel_y_scale = 1.0;
+        insert->rel_z_scale = 1.0;
+        insert->extr_z0 = 1.0;
+}
+
+
+/*!
+ * \brief Test the number of instances of a group and the translation
+ * of it's first instance.
+ *
+ * \return \c EXIT_SUCCESS when the group is as expected, or
+ * \c EXIT_FAILURE when it is not.
+ */
+static int
+test_instance_check_group
+(
+        DxfInstanceTable *instance_table,
+                /*!< Instance table. */
+        const char *block_name,
+                /*!< Name of the block. */
+        int visible,
+                /*!< Visibility of the group. */
+        int number_of_instances,
+                /*!< Expected number of instances. */
+        double x,
+                /*!< Expected X-value of the translation of the first
+                 * instance. */
+        double y
+                /*!< Expected Y-value of the translation of the first
+                 * instance. */
+)
+{
+        DxfInstanceGroup *group;
+        int n;
+
+        group = dxf_instance_table_find_group (instance_table, block_name, visible);
+        n = instance_table->matrix_size;
+        if ((group == NULL)
+          || (group->number_of_instances != number_of_instances)
+          || (group->geometry == NULL)
+          || (fabs (group->matrices[3] - x) > 1e-9)
+          || (fabs (group->matrices[7] - y) > 1e-9)
+          || ((n == 16) && (group->matrices[15] != 1.0)))
+        {
+                fprintf (stderr, "TESTS: unexpected %s instances of block %s.\n",
+                  visible ? "visible" : "hidden", block_name);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test the instance tables of a drawing with nested, hidden and
+ * circular block references.
+ *
+ * Block INNER holds a circle of radius 1 at the origin, block OUTER
+ * holds a line from the origin to (1, 1) and INNER scaled by 2 at
+ * (10, 0), block LOOP references itself at (5, 5).\n
+ * The drawing holds OUTER at (100, 0), a 3 by 2 array of OUTER at
+ * (0, -50), OUTER at (0, 200) on layer OFF which is off, and LOOP at
+ * the origin.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_instance ()
+{
+        DxfDrawing drawing;
+        DxfTables tables;
+        DxfLayer layer;
+        DxfBlock inner;
+        DxfBlock outer;
+        DxfBlock loop;
+        DxfEntities inner_entities;
+        DxfEntities outer_entities;
+        DxfEntities loop_entities;
+        DxfEntities entities;
+        DxfCircle circle;
+        DxfLine line;
+        DxfInsert inner_insert;
+        DxfInsert loop_insert;
+        DxfInsert inserts[4];
+        DxfPoint points[8];
+        DxfInstanceTable *instance_table;
+        DxfInstanceGroup *visible_inner;
+        DxfInstanceGroup *hidden_inner;
+        int matrix_size;
+        int failures = 0;
+
+        memset (&drawing, 0, sizeof (DxfDrawing));
+        memset (&tables, 0, sizeof (DxfTables));
+        memset (&layer, 0, sizeof (DxfLayer));
+        memset (&inner, 0, sizeof (DxfBlock));
+        memset (&outer, 0, sizeof (DxfBlock));
+        memset (&loop, 0, sizeof (DxfBlock));
+        memset (&inner_entities, 0, sizeof (DxfEntities));
+        memset (&outer_entities, 0, sizeof (DxfEntities));
+        memset (&loop_entities, 0, sizeof (DxfEntities));
+        memset (&entities, 0, sizeof (DxfEntities));
+        memset (&circle, 0, sizeof (DxfCircle));
+        memset (&line, 0, sizeof (DxfLine));
+        /* Block INNER. */
+        memset (&points[0], 0, sizeof (DxfPoint));
+        circle.p0 = &points[0];
+        circle.radius = 1.0;
+        circle.extr_z0 = 1.0;
+        dxf_entities_append_sequence_item (&inner_entities, CIRCLE, &circle);
+        inner.block_name = "INNER";
+        inner.entities = (struct DxfEntities *) &inner_entities;
+        /* Block OUTER, the nested reference has no layer and inherits
+         * the visibility of the reference to OUTER. */
+        memset (&points[1], 0, sizeof (DxfPoint));
+        memset (&points[2], 0, sizeof (DxfPoint));
+        points[2].x0 = 1.0;
+        points[2].y0 = 1.0;
+        line.p0 = &points[1];
+        line.p1 = &points[2];
+        line.extr_z0 = 1.0;
+        test_instance_insert (&inner_insert, &points[3], "inner", 10.0, 0.0);
+        inner_insert.layer = NULL;
+        inner_insert.rel_x_scale = 2.0;
+        inner_insert.rel_y_scale = 2.0;
+        dxf_entities_append_sequence_item (&outer_entities, LINE, &line);
+        dxf_entities_append_sequence_item (&outer_entities, INSERT, &inner_insert);
+        outer.block_name = "OUTER";
+        outer.entities = (struct DxfEntities *) &outer_entities;
+        /* Block LOOP. */
+        test_instance_insert (&loop_insert, &points[4], "LOOP", 5.0, 5.0);
+        dxf_entities_append_sequence_item (&loop_entities, INSERT, &loop_insert);
+        loop.block_name = "LOOP";
+        loop.entities = (struct DxfEntities *) &loop_entities;
+        inner.next = (struct DxfBlock *) &outer;
+        outer.next = (struct DxfBlock *) &loop;
+        /* Layer OFF is off (negative color). */
+        layer.layer_name = "OFF";
+        layer.color = -7;
+        tables.layers = &layer;
+        /* The drawing. */
+        test_instance_insert (&inserts[0], &points[5], "OUTER", 100.0, 0.0);
+        test_instance_insert (&inserts[1], &points[6], "OUTER", 0.0, -50.0);
+        inserts[1].columns = 3;
+        inserts[1].column_spacing = 20.0;
+        inserts[1].rows = 2;
+        inserts[1].row_spacing = 10.0;
+        test_instance_insert (&inserts[2], &points[7], "OUTER", 0.0, 200.0);
+        inserts[2].layer = "off";
+        test_instance_insert (&inserts[3], &points[0], "LOOP", 0.0, 0.0);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[0]);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[1]);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[2]);
+        dxf_entities_append_sequence_item (&entities, INSERT, &inserts[3]);
+        drawing.block_list = (struct DxfBlock *) &inner;
+        drawing.tables_list = (struct DxfTables *) &tables;
+        drawing.entities_list = (struct DxfEntities *) &entities;
+
+        if (dxf_instance_table_new (&drawing, 0.0, 16, 9) != NULL)
+        {
+                fprintf (stderr, "TESTS: an instance table with 9 values per transform was built.\n");
+                failures++;
+        }
+        for (matrix_size = 12; matrix_size <= 16; matrix_size += 4)
+        {
+                instance_table = dxf_instance_table_new (&drawing, 0.0, 16, matrix_size);
+                if (instance_table == NULL)
+                {
+                        failures++;
+                        continue;
+                }
+                /* Every array cell is an instance, the self reference
+                 * of LOOP is skipped. */
+                if ((dxf_instance_table_get_number_of_groups (instance_table) != 5)
+                  || (test_instance_check_group (instance_table, "OUTER", TRUE, 7, 100.0, 0.0) == EXIT_FAILURE)
+                  || (test_instance_check_group (instance_table, "OUTER", FALSE, 1, 0.0, 200.0) == EXIT_FAILURE)
+                  || (test_instance_check_group (instance_table, "INNER", TRUE, 7, 110.0, 0.0) == EXIT_FAILURE)
+                  || (test_instance_check_group (instance_table, "INNER", FALSE, 1, 10.0, 200.0) == EXIT_FAILURE)
+                  || (test_instance_check_group (instance_table, "LOOP", TRUE, 1, 0.0, 0.0) == EXIT_FAILURE)
+                  || (dxf_instance_table_find_group (instance_table, "LOOP", FALSE) != NULL))
+                {
+                        failures++;
+                }
+                /* The block geometry is shared, the nested transform
+                 * is composed. */
+                visible_inner = dxf_instance_table_find_group (instance_table, "INNER", TRUE);
+                hidden_inner = dxf_instance_table_find_group (instance_table, "INNER", FALSE);
+                if ((visible_inner != NULL) && (hidden_inner != NULL)
+                  && ((visible_inner->geometry != hidden_inner->geometry)
+                  || (fabs (visible_inner->matrices[0] - 2.0) > 1e-9)
+                  || (fabs (visible_inner->matrices[5] - 2.0) > 1e-9)))
+                {
+                        fprintf (stderr, "TESTS: the instances of block INNER do not share their geometry.\n");
+                        failures++;
+                }
+                dxf_instance_table_free (instance_table);
+        }
+        free (inner_entities.sequence);
+        free (outer_entities.sequence);
+        free (loop_entities.sequence);
+        free (entities.sequence);
+        return (failures);
+}
+
+
+/* EOF */
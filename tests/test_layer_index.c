@@ -0,0 +1,232 @@
+/*!
+ * \file test_layer_index.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the per layer index of the entities of a
+ * drawing.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief A drawing with entities on three layers, the layer names of the
+ * walls differ in case only.
+ */
+static const char *test_layer_index_drawing =
+        "  0\nSECTION\n  2\nENTITIES\n"
+        "  0\nLINE\n  5\n1A\n  8\nWalls\n 10\n0.0\n 20\n0.0\n 30\n0.0\n 11\n4.0\n 21\n0.0\n 31\n0.0\n"
+        "  0\nLINE\n  5\n1B\n  8\n0\n 10\n0.0\n 20\n1.0\n 30\n0.0\n 11\n4.0\n 21\n1.0\n 31\n0.0\n"
+        "  0\nCIRCLE\n  5\n1C\n  8\nWALLS\n 10\n1.0\n 20\n1.0\n 30\n0.0\n 40\n2.0\n"
+        "  0\nARC\n  5\n1D\n  8\nDoors\n 10\n2.0\n 20\n2.0\n 30\n0.0\n 40\n1.0\n 50\n0.0\n 51\n90.0\n"
+        "  0\nENDSEC\n  0\nEOF\n";
+
+
+/*!
+ * \brief Write the \c LAYER_INDEX object with it's \c IDBUFFER objects
+ * and test that every 360 handle of a layer names an \c IDBUFFER.
+ *
+ * \return the number of hard owner references which name an
+ * \c IDBUFFER, or -1 when the output is inconsistent.
+ */
+static int
+test_layer_index_write
+(
+        DxfLayerIndex *layer_index,
+                /*!< Layer index to be written. */
+        char references[][DXF_MAX_STRING_LENGTH]
+                /*!< Receives the 360 handles, at least 8 entries. */
+)
+{
+        DxfFile file;
+        char code[DXF_MAX_STRING_LENGTH];
+        char value[DXF_MAX_STRING_LENGTH];
+        int number_of_references = 0;
+        int number_of_buffers = 0;
+        int in_buffer = FALSE;
+        int number_of_items = 0;
+        int i;
+
+        memset (&file, 0, sizeof (file));
+        file.fp = tmpfile ();
+        file.acad_version_number = AutoCAD_2000;
+        file.last_id_code = 0x100;
+        if ((file.fp == NULL)
+          || (dxf_layer_index_write (&file, layer_index) != EXIT_SUCCESS))
+        {
+                return (-1);
+        }
+        rewind (file.fp);
+        while ((fgets (code, sizeof (code), file.fp) != NULL)
+          && (fgets (value, sizeof (value), file.fp) != NULL))
+        {
+                code[strcspn (code, "\r\n")] = '\0';
+                value[strcspn (value, "\r\n")] = '\0';
+                if (strcmp (code, "  0") == 0)
+                {
+                        in_buffer = (strcmp (value, "IDBUFFER") == 0);
+                }
+                else if ((strcmp (code, "360") == 0) && (!in_buffer)
+                  && (number_of_references < 8))
+                {
+                        strcpy (references[number_of_references++], value);
+                }
+                else if ((strcmp (code, "  5") == 0) && (in_buffer))
+                {
+                        /* The buffers follow in the order of the layers. */
+                        if ((number_of_buffers >= number_of_references)
+                          || (strcmp (references[number_of_buffers], value) != 0))
+                        {
+                                fclose (file.fp);
+                                return (-1);
+                        }
+                        number_of_buffers++;
+                }
+                else if ((strcmp (code, "330") == 0) && (in_buffer)
+                  && ((strcmp (value, "1a") == 0) || (strcmp (value, "1b") == 0)
+                  || (strcmp (value, "1c") == 0) || (strcmp (value, "1d") == 0)))
+                {
+                        number_of_items++;
+                }
+        }
+        fclose (file.fp);
+        if ((number_of_buffers != number_of_references)
+          || (number_of_items != 4))
+        {
+                return (-1);
+        }
+        for (i = 1; i < number_of_references; i++)
+        {
+                if (strcmp (references[i - 1], references[i]) == 0)
+                {
+                        return (-1);
+                }
+        }
+        return (number_of_references);
+}
+
+
+/*!
+ * \brief Test the per layer queries of the layer index built while a
+ * drawing is read.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_layer_index ()
+{
+        DxfDrawing *drawing;
+        DxfLayerIndex *layer_index;
+        DxfEntitiesSequenceItem *items;
+        char filename[] = "/tmp/test_layer_index_XXXXXX";
+        char references[8][DXF_MAX_STRING_LENGTH];
+        char rebuilt[8][DXF_MAX_STRING_LENGTH];
+        FILE *stream;
+        int number_of_items;
+        int failures = 0;
+        int fd;
+        int i;
+
+        fd = mkstemp (filename);
+        if ((fd < 0) || ((stream = fdopen (fd, "w")) == NULL))
+        {
+                fprintf (stderr, "TESTS: could not create: %s.\n", filename);
+                return (1);
+        }
+        fputs (test_layer_index_drawing, stream);
+        fclose (stream);
+        drawing = dxf_drawing_read (filename, NULL, NULL);
+        unlink (filename);
+        if (drawing == NULL)
+        {
+                fprintf (stderr, "TESTS: could not read: %s.\n", filename);
+                return (1);
+        }
+        layer_index = dxf_drawing_get_layer_index (drawing);
+        if ((layer_index == NULL)
+          || (dxf_layer_index_get_number_of_buckets (layer_index) != 3))
+        {
+                fprintf (stderr, "TESTS: the layer index was not built while reading.\n");
+                dxf_drawing_free (drawing);
+                return (1);
+        }
+        /* Layer names are case insensitive. */
+        items = dxf_layer_index_get_entities (layer_index, "walls", &number_of_items);
+        if ((items == NULL) || (number_of_items != 2)
+          || (items[0].type != LINE) || (items[1].type != CIRCLE))
+        {
+                fprintf (stderr, "TESTS: the entities on layer walls were not found.\n");
+                failures++;
+        }
+        for (i = 0; (items != NULL) && (i < number_of_items); i++)
+        {
+                if (strcasecmp (dxf_entity_get_layer (items[i].type,
+                  items[i].entity), "WALLS") != 0)
+                {
+                        fprintf (stderr, "TESTS: an entity was indexed on the wrong layer.\n");
+                        failures++;
+                }
+        }
+        items = dxf_layer_index_get_entities (layer_index, "DOORS", &number_of_items);
+        if ((items == NULL) || (number_of_items != 1) || (items[0].type != ARC))
+        {
+                fprintf (stderr, "TESTS: the entities on layer Doors were not found.\n");
+                failures++;
+        }
+        if (dxf_layer_index_get_entities (layer_index, "Windows", &number_of_items) != NULL)
+        {
+                fprintf (stderr, "TESTS: entities were found on an empty layer.\n");
+                failures++;
+        }
+        /* The IDBUFFER handles survive a rebuild. */
+        if (test_layer_index_write (layer_index, references) != 3)
+        {
+                fprintf (stderr, "TESTS: the IDBUFFER objects do not match the layer index.\n");
+                failures++;
+        }
+        else if ((dxf_layer_index_build (layer_index,
+          dxf_drawing_get_entities_list (drawing)) == NULL)
+          || (test_layer_index_write (layer_index, rebuilt) != 3)
+          || (strcmp (references[0], rebuilt[0]) != 0)
+          || (strcmp (references[1], rebuilt[1]) != 0)
+          || (strcmp (references[2], rebuilt[2]) != 0))
+        {
+                fprintf (stderr, "TESTS: the IDBUFFER handles changed in a rebuild.\n");
+                failures++;
+        }
+        dxf_drawing_free (drawing);
+        return (failures);
+}
+
+
+/* EOF */
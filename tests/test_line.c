@@ -0,0 +1,408 @@
+/*!
+ * \file test_line.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for reading and writing a DXF \c LINE entity
+ * against the golden files.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+#ifndef DXF_GOLDEN_DIR
+#define DXF_GOLDEN_DIR "golden"
+#endif
+
+
+/*!
+ * \brief Golden file of a DXF \c LINE entity.
+ */
+typedef struct
+test_line_golden_struct
+{
+        char *filename;
+                /*!< Name of the golden file. */
+        int acad_version_number;
+                /*!< AutoCAD version the golden file was written for. */
+} TestLineGolden;
+
+
+/*!
+ * \brief Golden files of a DXF \c LINE entity.
+ *
+ * Every golden file holds the same line from (20, 30, 0) to
+ * (50, 60, 0) with a thickness of 0.25 on layer "0", as written by
+ * the AutoCAD version of the file.
+ */
+static TestLineGolden test_line_goldens[] =
+{
+        {"line_R12.dxf", AutoCAD_12},
+        {"line_R2000.dxf", AutoCAD_2000},
+        {"line_R2004.dxf", AutoCAD_2004},
+        {"line_R2007.dxf", AutoCAD_2007},
+        {"line_R2010.dxf", AutoCAD_2010},
+        {NULL, 0}
+};
+
+
+/*!
+ * \brief Copy a file to a temporary file, followed by a \c EOF marker
+ * which terminates the entity in it.
+ *
+ * \return a pointer to the rewound temporary file, or \c NULL when an
+ * error occurred.
+ */
+static FILE *
+test_line_terminate
+(
+        FILE *in
+                /*!< File holding one entity. */
+)
+{
+        FILE *out;
+        int ch;
+
+        out = tmpfile ();
+        if (out == NULL)
+        {
+                return (NULL);
+        }
+        rewind (in);
+        while ((ch = fgetc (in)) != EOF)
+        {
+                fputc (ch, out);
+        }
+        fprintf (out, "  0\nEOF\n");
+        rewind (out);
+        return (out);
+}
+
+
+/*!
+ * \brief Read a DXF \c LINE entity from a file holding one entity.
+ *
+ * \return a pointer to the line, or \c NULL when an error occurred.
+ */
+static DxfLine *
+test_line_read
+(
+        FILE *in,
+                /*!< File holding one \c LINE entity. */
+        int acad_version_number
+                /*!< AutoCAD version of the file. */
+)
+{
+        char temp_string[DXF_MAX_STRING_LENGTH];
+        DxfFile file;
+        DxfLine *line = NULL;
+
+        memset (&file, 0, sizeof (file));
+        file.fp = test_line_terminate (in);
+        file.filename = "golden";
+        file.acad_version_number = acad_version_number;
+        if (file.fp == NULL)
+        {
+                return (NULL);
+        }
+        /* Skip the "0" and "LINE" lines announcing the entity. */
+        dxf_read_line (temp_string, &file);
+        dxf_read_line (temp_string, &file);
+        if (strcmp (temp_string, "LINE") == 0)
+        {
+                line = dxf_line_read (&file, dxf_line_init (dxf_line_new ()));
+        }
+        fclose (file.fp);
+        return (line);
+}
+
+
+/*!
+ * \brief Compare two values of a group, numbers by value, other values
+ * (handles) regardless of case.
+ *
+ * \return \c TRUE when the values are equal, \c FALSE when they are
+ * not.
+ */
+static int
+test_line_equal_values
+(
+        const char *value_1,
+        const char *value_2
+)
+{
+        char *end_1;
+        char *end_2;
+        double number_1;
+        double number_2;
+
+        number_1 = strtod (value_1, &end_1);
+        number_2 = strtod (value_2, &end_2);
+        if ((end_1 != value_1) && (*end_1 == '\0')
+          && (end_2 != value_2) && (*end_2 == '\0'))
+        {
+                return (number_1 == number_2);
+        }
+        return (strcasecmp (value_1, value_2) == 0);
+}
+
+
+/*!
+ * \brief Read the next group code from a file, skipping empty lines
+ * (the golden files end with one).
+ *
+ * \return \c EXIT_SUCCESS when done, or \c EXIT_FAILURE at the end of
+ * the file.
+ */
+static int
+test_line_read_group_code
+(
+        char *temp_string,
+        DxfFile *fp
+)
+{
+        do
+        {
+                if (dxf_read_line (temp_string, fp) == EXIT_FAILURE)
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        while (temp_string[0] == '\0');
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare the groups of two files, ignoring the formatting of
+ * group codes and values.
+ *
+ * \return \c EXIT_SUCCESS when all groups are equal, or
+ * \c EXIT_FAILURE when they are not.
+ */
+static int
+test_line_compare_groups
+(
+        FILE *golden,
+                /*!< Golden file. */
+        FILE *written,
+                /*!< File written by libDXF. */
+        const char *filename
+                /*!< Name of the golden file. */
+)
+{
+        char golden_string[DXF_MAX_STRING_LENGTH];
+        char written_string[DXF_MAX_STRING_LENGTH];
+        DxfFile golden_file;
+        DxfFile written_file;
+        int golden_code;
+        int written_code;
+
+        memset (&golden_file, 0, sizeof (golden_file));
+        memset (&written_file, 0, sizeof (written_file));
+        golden_file.fp = golden;
+        golden_file.filename = (char *) filename;
+        written_file.fp = written;
+        written_file.filename = "written";
+        rewind (golden);
+        rewind (written);
+        for (;;)
+        {
+                if (test_line_read_group_code (golden_string, &golden_file) == EXIT_FAILURE)
+                {
+                        /* All groups of the golden file were found, the
+                         * written file must end here too. */
+                        if (test_line_read_group_code (written_string, &written_file) == EXIT_SUCCESS)
+                        {
+                                fprintf (stderr, "TESTS: extra group code %s written for: %s.\n",
+                                  written_string, filename);
+                                return (EXIT_FAILURE);
+                        }
+                        return (EXIT_SUCCESS);
+                }
+                if (test_line_read_group_code (written_string, &written_file) == EXIT_FAILURE)
+                {
+                        fprintf (stderr, "TESTS: group code %s was not written for: %s.\n",
+                          golden_string, filename);
+                        return (EXIT_FAILURE);
+                }
+                golden_code = atoi (golden_string);
+                written_code = atoi (written_string);
+                if (golden_code != written_code)
+                {
+                        fprintf (stderr, "TESTS: group code %d written where %d was expected for: %s.\n",
+                          written_code, golden_code, filename);
+                        return (EXIT_FAILURE);
+                }
+                dxf_read_line (golden_string, &golden_file);
+                dxf_read_line (written_string, &written_file);
+                if (!test_line_equal_values (golden_string, written_string))
+                {
+                        fprintf (stderr, "TESTS: value %s of group code %d written where %s was expected for: %s.\n",
+                          written_string, golden_code, golden_string, filename);
+                        return (EXIT_FAILURE);
+                }
+        }
+}
+
+
+/*!
+ * \brief Compare the values of a DXF \c LINE entity with the values of
+ * the golden files.
+ *
+ * \return \c EXIT_SUCCESS when the values are equal, or
+ * \c EXIT_FAILURE when they are not.
+ */
+static int
+test_line_check_values
+(
+        DxfLine *line,
+                /*!< DXF \c LINE entity. */
+        const char *filename
+                /*!< Name of the file the entity was read from. */
+)
+{
+        if ((line->p0 == NULL)
+          || (line->p1 == NULL)
+          || (line->p0->x0 != 20.0)
+          || (line->p0->y0 != 30.0)
+          || (line->p0->z0 != 0.0)
+          || (line->p1->x0 != 50.0)
+          || (line->p1->y0 != 60.0)
+          || (line->p1->z0 != 0.0)
+          || (line->thickness != 0.25)
+          || (line->color != 1)
+          || (line->id_code != 0x21C)
+          || (strcmp (line->layer, "0") != 0))
+        {
+                fprintf (stderr, "TESTS: unexpected LINE values read from: %s.\n",
+                  filename);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Read the \c LINE of a golden file, write it for the same
+ * AutoCAD version and read it back again.
+ *
+ * \return \c EXIT_SUCCESS when the written file holds the groups of the
+ * golden file and reads back to the same values, or \c EXIT_FAILURE
+ * when it does not.
+ */
+static int
+test_line_round_trip
+(
+        TestLineGolden *golden
+                /*!< Golden file. */
+)
+{
+        char filename[DXF_MAX_STRING_LENGTH];
+        DxfFile out;
+        DxfLine *line = NULL;
+        DxfLine *reread = NULL;
+        FILE *in;
+        int result = EXIT_FAILURE;
+
+        snprintf (filename, sizeof (filename), "%s/%s",
+          DXF_GOLDEN_DIR, golden->filename);
+        in = fopen (filename, "r");
+        if (in == NULL)
+        {
+                fprintf (stderr, "TESTS: could not open: %s.\n", filename);
+                return (EXIT_FAILURE);
+        }
+        memset (&out, 0, sizeof (out));
+        out.fp = tmpfile ();
+        out.filename = "written";
+        out.acad_version_number = golden->acad_version_number;
+        if (out.fp == NULL)
+        {
+                fclose (in);
+                return (EXIT_FAILURE);
+        }
+        line = test_line_read (in, golden->acad_version_number);
+        if (line == NULL)
+        {
+                fprintf (stderr, "TESTS: could not read the LINE from: %s.\n",
+                  filename);
+        }
+        else if ((test_line_check_values (line, filename) == EXIT_SUCCESS)
+          && (dxf_line_write (&out, line) == EXIT_SUCCESS)
+          && (test_line_compare_groups (in, out.fp, filename) == EXIT_SUCCESS))
+        {
+                reread = test_line_read (out.fp, golden->acad_version_number);
+                if (reread == NULL)
+                {
+                        fprintf (stderr, "TESTS: could not read back the LINE written for: %s.\n",
+                          filename);
+                }
+                else
+                {
+                        result = test_line_check_values (reread, filename);
+                        dxf_line_free (reread);
+                }
+        }
+        if (line != NULL)
+        {
+                dxf_line_free (line);
+        }
+        fclose (out.fp);
+        fclose (in);
+        return (result);
+}
+
+
+/*!
+ * \brief Perform round trip tests of a DXF \c LINE entity for the
+ * golden files.
+ *
+ * \return the number of golden files which did not round trip.
+ */
+int
+test_line ()
+{
+        int i;
+        int failures = 0;
+
+        for (i = 0; test_line_goldens[i].filename != NULL; i++)
+        {
+                if (test_line_round_trip (&test_line_goldens[i]) != EXIT_SUCCESS)
+                {
+                        failures++;
+                }
+        }
+        return (failures);
+}
+
+
+/* EOF */
@@ -0,0 +1,267 @@
+/*!
+ * \file test_load_options.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the entity type mask and the layer filter
+ * of the load options.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include <unistd.h>
+#include "includes.h"
+
+
+/*!
+ * \brief An \c ENTITIES section with entities on several layers, the
+ * name of the section was read already.
+ */
+static const char *test_load_options_section =
+        "  0\nLINE\n  5\n1A\n  8\nWalls\n 10\n0.0\n 20\n0.0\n 30\n0.0\n 11\n4.0\n 21\n0.0\n 31\n0.0\n"
+        "  0\nCIRCLE\n  8\n0\n 10\n1.0\n 20\n1.0\n 30\n0.0\n 40\n2.0\n"
+        "  0\nARC\n  8\nWALLS-2\n 10\n2.0\n 20\n2.0\n 30\n0.0\n 40\n1.5\n 50\n0.0\n 51\n90.0\n"
+        "  0\nPOLYLINE\n  8\nDoors\n 66\n1\n 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+        "  0\nVERTEX\n  8\nDoors\n 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+        "  0\nVERTEX\n  8\nDoors\n 10\n1.0\n 20\n0.0\n 30\n0.0\n"
+        "  0\nSEQEND\n  8\nDoors\n"
+        "  0\nPOLYLINE\n  8\nwalls\n 66\n1\n 10\n0.0\n 20\n0.0\n 30\n0.0\n"
+        "  0\nVERTEX\n  8\nwalls\n 10\n5.0\n 20\n0.0\n 30\n0.0\n"
+        "  0\nSEQEND\n  8\nwalls\n"
+        "  0\nLINE\n  8\n0\n 10\n1.0\n 20\n1.0\n 30\n0.0\n 11\n2.0\n 21\n2.0\n 31\n0.0\n"
+        "  0\nENDSEC\n";
+
+
+/*!
+ * \brief A layer name, a wildcard pattern and the expected result.
+ */
+typedef struct
+test_load_options_match_struct
+{
+        const char *layer;
+                /*!< Layer name. */
+        const char *pattern;
+                /*!< Wildcard pattern. */
+        int expected;
+                /*!< Expected result of the match. */
+} TestLoadOptionsMatch;
+
+
+/*!
+ * \brief Wildcard patterns with matching and non matching layer names.
+ */
+static const TestLoadOptionsMatch test_load_options_matches[] =
+{
+        {"Walls", "WALL*", TRUE},
+        {"WAL", "WALL*", FALSE},
+        {"walls-2", "wall?-?", TRUE},
+        {"walls-23", "wall?-?", FALSE},
+        {"", "*", TRUE},
+        {"", "?", FALSE},
+        {"aXbYbZc", "a*b*c", TRUE},
+        {"aXbYbZ", "a*b*c", FALSE},
+        {"Doors", "doors", TRUE},
+        {"Doors", "Door", FALSE},
+        {"0", NULL, FALSE}
+};
+
+
+/*!
+ * \brief Read the test section from a pipe with load options, so the
+ * reader can not seek in it's input.
+ *
+ * \return the entities read, or \c NULL when an error occurred.
+ */
+static DxfEntities *
+test_load_options_read
+(
+        DxfLoadOptions *options
+                /*!< Load options. */
+)
+{
+        DxfFile file;
+        DxfEntities *entities;
+        int fd[2];
+
+        if (pipe (fd) != 0)
+        {
+                return (NULL);
+        }
+        /* The section fits in the buffer of the pipe. */
+        if (write (fd[1], test_load_options_section, strlen (test_load_options_section))
+          != (ssize_t) strlen (test_load_options_section))
+        {
+                close (fd[0]);
+                close (fd[1]);
+                return (NULL);
+        }
+        close (fd[1]);
+        memset (&file, 0, sizeof (file));
+        file.fp = fdopen (fd[0], "r");
+        file.filename = "test_load_options";
+        file.acad_version_number = AutoCAD_2000;
+        file.load_options = (struct DxfLoadOptions *) options;
+        if (file.fp == NULL)
+        {
+                close (fd[0]);
+                return (NULL);
+        }
+        entities = dxf_entities_read (&file, dxf_entities_init (dxf_entities_new ()));
+        fclose (file.fp);
+        return (entities);
+}
+
+
+/*!
+ * \brief Test if the entities read are of the expected types, in file
+ * order.
+ *
+ * \return \c EXIT_SUCCESS when the types match, or \c EXIT_FAILURE
+ * when they do not.
+ */
+static int
+test_load_options_check_types
+(
+        DxfEntities *entities,
+                /*!< Entities read. */
+        const DxfEntityType *types,
+                /*!< Expected types. */
+        int number_of_types
+                /*!< Number of expected types. */
+)
+{
+        DxfEntitiesCursor cursor;
+        DxfEntityType type;
+        int i;
+
+        if (entities == NULL)
+        {
+                return (EXIT_FAILURE);
+        }
+        dxf_entities_cursor_init (&cursor, entities);
+        for (i = 0; dxf_entities_cursor_next (&cursor, &type) != NULL; i++)
+        {
+                if ((i >= number_of_types) || (type != types[i]))
+                {
+                        return (EXIT_FAILURE);
+                }
+        }
+        return ((i == number_of_types) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Test the entity type mask, the wildcard layer matcher and the
+ * layer filter of the load options.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_load_options ()
+{
+        static const DxfEntityType masked_types[] = {LINE, CIRCLE, LINE};
+        static const DxfEntityType filtered_types[] = {LINE, ARC, POLYLINE};
+        DxfLoadOptions *options;
+        DxfEntities *entities;
+        DxfPolyline *polyline;
+        DxfLine *line;
+        int failures = 0;
+        int i;
+
+        for (i = 0; i < (int) (sizeof (test_load_options_matches) / sizeof (test_load_options_matches[0])); i++)
+        {
+                if (dxf_load_options_layer_match (test_load_options_matches[i].layer,
+                  (void *) test_load_options_matches[i].pattern)
+                  != test_load_options_matches[i].expected)
+                {
+                        fprintf (stderr, "TESTS: layer %s was matched wrongly against pattern %s.\n",
+                          test_load_options_matches[i].layer,
+                          (test_load_options_matches[i].pattern != NULL)
+                          ? test_load_options_matches[i].pattern : "(null)");
+                        failures++;
+                }
+        }
+        options = dxf_load_options_init (dxf_load_options_new ());
+        if (options == NULL)
+        {
+                return (failures + 1);
+        }
+        /* The entity type mask. */
+        dxf_load_options_set_entity_types (options,
+          DXF_ENTITY_TYPE_BIT (LINE) | DXF_ENTITY_TYPE_BIT (CIRCLE));
+        if ((!dxf_load_options_accept_entity_type (options, LINE))
+          || (dxf_load_options_accept_entity_type (options, ARC))
+          || (!dxf_load_options_accept_entity_type (NULL, ARC)))
+        {
+                fprintf (stderr, "TESTS: the entity type mask accepts the wrong types.\n");
+                failures++;
+        }
+        entities = test_load_options_read (options);
+        if (test_load_options_check_types (entities, masked_types, 3) != EXIT_SUCCESS)
+        {
+                fprintf (stderr, "TESTS: the entity type mask loaded the wrong entities.\n");
+                failures++;
+        }
+        if (entities != NULL)
+        {
+                dxf_entities_free (entities);
+        }
+        /* The layer filter, on input which can not be rewound. */
+        dxf_load_options_set_entity_types (options, DXF_ALL_ENTITY_TYPES);
+        dxf_load_options_set_layer_filter (options,
+          dxf_load_options_layer_match, "WALL*");
+        if ((!dxf_load_options_accept_layer (options, "walls"))
+          || (dxf_load_options_accept_layer (options, NULL)))
+        {
+                fprintf (stderr, "TESTS: the layer filter accepts the wrong layers.\n");
+                failures++;
+        }
+        entities = test_load_options_read (options);
+        line = (entities != NULL) ? (DxfLine *) entities->line_list : NULL;
+        polyline = (entities != NULL) ? (DxfPolyline *) entities->polyline_list : NULL;
+        if ((test_load_options_check_types (entities, filtered_types, 3) != EXIT_SUCCESS)
+          || (line == NULL) || (line->p1 == NULL) || (line->p1->x0 != 4.0)
+          || (strcmp (line->layer, "Walls") != 0)
+          || (polyline == NULL) || (polyline->vertices == NULL)
+          || (((DxfVertex *) polyline->vertices)->p0->x0 != 5.0)
+          || (((DxfVertex *) polyline->vertices)->next != NULL))
+        {
+                fprintf (stderr, "TESTS: the layer filter loaded the wrong entities from a pipe.\n");
+                failures++;
+        }
+        if (entities != NULL)
+        {
+                dxf_entities_free (entities);
+        }
+        dxf_load_options_free (options);
+        return (failures);
+}
+
+
+/* EOF */
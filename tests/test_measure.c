@@ -0,0 +1,320 @@
+/*!
+ * \file test_measure.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the area, perimeter and centroid
+ * functions.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+#define TEST_MEASURE_NUMBER_OF_CIRCLES 5000
+        /*!< \brief Number of circles in the measure table test. */
+
+
+/*!
+ * \brief Compare a measure with the expected values.
+ *
+ * \return \c EXIT_SUCCESS when the values are equal within 1e-9, or
+ * \c EXIT_FAILURE when they are not.
+ */
+static int
+test_measure_check
+(
+        const char *name,
+                /*!< Name of the measured entity. */
+        DxfMeasure *measure,
+                /*!< Measured values. */
+        double area,
+                /*!< Expected signed area. */
+        double perimeter,
+                /*!< Expected perimeter. */
+        double centroid_x,
+                /*!< Expected X-value of the centroid. */
+        double centroid_y
+                /*!< Expected Y-value of the centroid. */
+)
+{
+        if ((fabs (measure->area - area) > 1e-9)
+          || (fabs (measure->perimeter - perimeter) > 1e-9)
+          || (fabs (measure->centroid_x - centroid_x) > 1e-9)
+          || (fabs (measure->centroid_y - centroid_y) > 1e-9))
+        {
+                fprintf (stderr, "TESTS: %s measured area %.12g, perimeter %.12g, centroid (%.12g, %.12g), expected %.12g, %.12g, (%.12g, %.12g).\n",
+                  name, measure->area, measure->perimeter,
+                  measure->centroid_x, measure->centroid_y,
+                  area, perimeter, centroid_x, centroid_y);
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Test a \c HATCH boundary polyline: a 10 by 10 square with the
+ * right edge bulged outward as a half circle.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_measure_hatch_boundary ()
+{
+        DxfHatchBoundaryPathPolyline *polyline;
+        DxfHatchBoundaryPathPolylineVertex *vertex;
+        DxfHatchBoundaryPathPolylineVertex *last = NULL;
+        DxfMeasure measure;
+        double vertices[] = {0.0, 0.0, 0.0, 10.0, 0.0, 1.0, 10.0, 10.0, 0.0, 0.0, 10.0, 0.0};
+        double half_circle;
+        double area;
+        int result;
+        int i;
+
+        polyline = dxf_hatch_boundary_path_polyline_init (dxf_hatch_boundary_path_polyline_new ());
+        polyline->is_closed = 1;
+        for (i = 0; i < 4; i++)
+        {
+                vertex = dxf_hatch_boundary_path_polyline_vertex_init (dxf_hatch_boundary_path_polyline_vertex_new ());
+                vertex->x0 = vertices[3 * i];
+                vertex->y0 = vertices[3 * i + 1];
+                vertex->bulge = vertices[3 * i + 2];
+                vertex->has_bulge = (vertex->bulge != 0.0);
+                if (last == NULL)
+                        polyline->vertices = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+                else
+                        last->next = (struct DxfHatchBoundaryPathPolylineVertex *) vertex;
+                last = vertex;
+        }
+        half_circle = 0.5 * M_PI * 25.0;
+        area = 100.0 + half_circle;
+        dxf_measure_hatch_boundary_path_polyline (polyline, &measure);
+        result = test_measure_check ("HATCH boundary", &measure,
+          area, 30.0 + 5.0 * M_PI,
+          (100.0 * 5.0 + half_circle * (10.0 + 20.0 / (3.0 * M_PI))) / area,
+          5.0);
+        dxf_hatch_boundary_path_polyline_vertex_free_list ((DxfHatchBoundaryPathPolylineVertex *) polyline->vertices);
+        polyline->vertices = NULL;
+        dxf_hatch_boundary_path_polyline_free (polyline);
+        return (result == EXIT_FAILURE);
+}
+
+
+/*!
+ * \brief Test a closed \c LWPOLYLINE of two half circles, clockwise
+ * and counterclockwise.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_measure_lwpolyline ()
+{
+        DxfLWPolyline *lwpolyline;
+        DxfVertex *v0;
+        DxfVertex *v1;
+        DxfMeasure measure;
+        int failures = 0;
+
+        lwpolyline = dxf_lwpolyline_init (dxf_lwpolyline_new ());
+        v0 = dxf_vertex_init (dxf_vertex_new ());
+        v1 = dxf_vertex_init (dxf_vertex_new ());
+        v0->p0->x0 = 1.0;
+        v0->p0->y0 = 3.0;
+        v1->p0->x0 = 5.0;
+        v1->p0->y0 = 3.0;
+        v0->bulge = 1.0;
+        v1->bulge = 1.0;
+        v0->next = (struct DxfVertex *) v1;
+        lwpolyline->vertices = (struct DxfVertex *) v0;
+        lwpolyline->number_vertices = 2;
+        lwpolyline->flag = 1;
+        dxf_measure_lwpolyline (lwpolyline, &measure);
+        if (test_measure_check ("counterclockwise LWPOLYLINE circle",
+          &measure, 4.0 * M_PI, 4.0 * M_PI, 3.0, 3.0) == EXIT_FAILURE)
+        {
+                failures++;
+        }
+        v0->bulge = -1.0;
+        v1->bulge = -1.0;
+        dxf_measure_lwpolyline (lwpolyline, &measure);
+        if (test_measure_check ("clockwise LWPOLYLINE circle",
+          &measure, -4.0 * M_PI, 4.0 * M_PI, 3.0, 3.0) == EXIT_FAILURE)
+        {
+                failures++;
+        }
+        lwpolyline->vertices = NULL;
+        dxf_vertex_free (v1);
+        v0->next = NULL;
+        dxf_vertex_free (v0);
+        dxf_lwpolyline_free (lwpolyline);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test a \c CIRCLE and an \c ELLIPSE.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_measure_circle_ellipse ()
+{
+        DxfCircle *circle;
+        DxfEllipse *ellipse;
+        DxfMeasure measure;
+        int failures = 0;
+
+        circle = dxf_circle_init (dxf_circle_new ());
+        circle->p0 = dxf_point_init (dxf_point_new ());
+        circle->p0->x0 = 1.0;
+        circle->p0->y0 = 2.0;
+        circle->radius = 2.0;
+        dxf_measure_circle (circle, &measure);
+        if (test_measure_check ("CIRCLE", &measure, 4.0 * M_PI, 4.0 * M_PI,
+          1.0, 2.0) == EXIT_FAILURE)
+        {
+                failures++;
+        }
+        dxf_circle_free (circle);
+        ellipse = dxf_ellipse_init (dxf_ellipse_new ());
+        ellipse->p0 = dxf_point_init (dxf_point_new ());
+        ellipse->p1 = dxf_point_init (dxf_point_new ());
+        ellipse->p0->x0 = -1.0;
+        ellipse->p0->y0 = 4.0;
+        ellipse->p1->x0 = 0.0;
+        ellipse->p1->y0 = 2.0;
+        ellipse->ratio = 0.5;
+        ellipse->start_angle = 0.0;
+        ellipse->end_angle = 2.0 * M_PI;
+        dxf_measure_ellipse (ellipse, &measure);
+        /* The perimeter of an ellipse with semi axes 2 and 1. */
+        if (test_measure_check ("ELLIPSE", &measure, 2.0 * M_PI,
+          9.688448220547675, -1.0, 4.0) == EXIT_FAILURE)
+        {
+                failures++;
+        }
+        dxf_ellipse_free (ellipse);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test the measure table of a drawing holding circles with
+ * handles in descending order.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_measure_table ()
+{
+        DxfDrawing drawing;
+        DxfEntities *entities;
+        DxfCircle *circles[TEST_MEASURE_NUMBER_OF_CIRCLES];
+        DxfMeasureTable *table;
+        DxfMeasureEntry *entry;
+        double total_area = 0.0;
+        int failures = 0;
+        int i;
+
+        memset (&drawing, 0, sizeof (drawing));
+        entities = dxf_entities_new ();
+        for (i = 0; i < TEST_MEASURE_NUMBER_OF_CIRCLES; i++)
+        {
+                circles[i] = dxf_circle_init (dxf_circle_new ());
+                circles[i]->p0 = dxf_point_init (dxf_point_new ());
+                circles[i]->id_code = TEST_MEASURE_NUMBER_OF_CIRCLES - i;
+                circles[i]->radius = 1.0 + (i % 10);
+                total_area += M_PI * circles[i]->radius * circles[i]->radius;
+                dxf_entities_append_sequence_item (entities, CIRCLE, circles[i]);
+        }
+        drawing.entities_list = (struct DxfEntities *) entities;
+        table = dxf_measure_table_new (&drawing);
+        if ((table == NULL)
+          || (table->number_of_entries != TEST_MEASURE_NUMBER_OF_CIRCLES)
+          || (fabs (table->total_area - total_area) > 1e-9 * total_area))
+        {
+                fprintf (stderr, "TESTS: wrong measure table of the circles.\n");
+                failures++;
+        }
+        else
+        {
+                for (i = 0; i < table->number_of_entries; i++)
+                {
+                        if (table->entries[i].id_code != i + 1)
+                        {
+                                fprintf (stderr, "TESTS: measure table is not sorted by handle.\n");
+                                failures++;
+                                break;
+                        }
+                }
+                entry = dxf_measure_table_find (table, 17);
+                if ((entry == NULL)
+                  || (entry->entity != circles[TEST_MEASURE_NUMBER_OF_CIRCLES - 17])
+                  || (dxf_measure_table_find (table, TEST_MEASURE_NUMBER_OF_CIRCLES + 1) != NULL))
+                {
+                        fprintf (stderr, "TESTS: wrong measure table entry found by handle.\n");
+                        failures++;
+                }
+        }
+        if (table != NULL)
+        {
+                dxf_measure_table_free (table);
+        }
+        for (i = 0; i < TEST_MEASURE_NUMBER_OF_CIRCLES; i++)
+        {
+                dxf_circle_free (circles[i]);
+        }
+        free (entities->sequence);
+        free (entities);
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for the area, perimeter and centroid
+ * functions.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_measure ()
+{
+        int failures = 0;
+
+        failures += test_measure_hatch_boundary ();
+        failures += test_measure_lwpolyline ();
+        failures += test_measure_circle_ellipse ();
+        failures += test_measure_table ();
+        return (failures);
+}
+
+
+/* EOF */
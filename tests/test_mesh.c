@@ -0,0 +1,330 @@
+/*!
+ * \file test_mesh.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the triangulation and subdivision of
+ * \c MESH entities and the polyline mesh buffers.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Create a \c MESH entity from vertices and a face list.
+ *
+ * \return a pointer to the mesh, to be freed with dxf_mesh_free ().
+ */
+static DxfMesh *
+test_mesh_new
+(
+        const double *vertices,
+                /*!< X, Y and Z-value of every vertex. */
+        int number_of_vertices,
+                /*!< Number of vertices. */
+        const int32_t *face_list,
+                /*!< Face list, the number of vertices of each face
+                 * followed by the vertex indices. */
+        int face_list_size
+                /*!< Number of items in the face list. */
+)
+{
+        DxfMesh *mesh;
+
+        mesh = dxf_mesh_init (dxf_mesh_new ());
+        mesh->vertices = malloc (3 * (size_t) number_of_vertices * sizeof (double));
+        mesh->face_list_item = malloc ((size_t) face_list_size * sizeof (int32_t));
+        memcpy (mesh->vertices, vertices, 3 * (size_t) number_of_vertices * sizeof (double));
+        memcpy (mesh->face_list_item, face_list, (size_t) face_list_size * sizeof (int32_t));
+        mesh->vertex_count_level_0 = number_of_vertices;
+        mesh->face_list_size_level_0 = face_list_size;
+        return (mesh);
+}
+
+
+/*!
+ * \brief Compute six times the signed volume enclosed by triangles.
+ */
+static double
+test_mesh_volume
+(
+        DxfMeshTriangles *triangles
+)
+{
+        const double *a;
+        const double *b;
+        const double *c;
+        double volume = 0.0;
+        int i;
+
+        for (i = 0; i < triangles->number_of_triangles; i++)
+        {
+                a = triangles->vertices + 3 * triangles->indices[3 * i];
+                b = triangles->vertices + 3 * triangles->indices[3 * i + 1];
+                c = triangles->vertices + 3 * triangles->indices[3 * i + 2];
+                volume += a[0] * (b[1] * c[2] - b[2] * c[1])
+                  + a[1] * (b[2] * c[0] - b[0] * c[2])
+                  + a[2] * (b[0] * c[1] - b[1] * c[0]);
+        }
+        return (volume);
+}
+
+
+/*!
+ * \brief Test the triangulation and subdivision of a cube with sides
+ * of 2 around the origin.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_mesh_cube ()
+{
+        const double vertices[] =
+        {
+                -1.0, -1.0, -1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, -1.0, 1.0, -1.0,
+                -1.0, -1.0, 1.0, 1.0, -1.0, 1.0, 1.0, 1.0, 1.0, -1.0, 1.0, 1.0
+        };
+        const int32_t faces[] =
+        {
+                4, 0, 3, 2, 1, 4, 4, 5, 6, 7, 4, 0, 1, 5, 4,
+                4, 1, 2, 6, 5, 4, 2, 3, 7, 6, 4, 3, 0, 4, 7
+        };
+        DxfMesh *mesh;
+        DxfMesh *subdivided;
+        DxfMeshTriangles *triangles;
+        double volume;
+        int failures = 0;
+        int i;
+
+        mesh = test_mesh_new (vertices, 8, faces, 30);
+        triangles = dxf_mesh_triangles_new ();
+        if ((dxf_mesh_triangulate_faces (mesh, triangles) == EXIT_FAILURE)
+          || (triangles->number_of_triangles != 12)
+          || (fabs (test_mesh_volume (triangles) - 48.0) > 1e-9))
+        {
+                fprintf (stderr, "TESTS: wrong triangulation of the cube.\n");
+                failures++;
+        }
+        subdivided = dxf_mesh_subdivide (mesh, 1);
+        if ((subdivided == NULL)
+          || (subdivided->vertex_count_level_0 != 26)
+          || (subdivided->face_list_size_level_0 != 24 * 5))
+        {
+                fprintf (stderr, "TESTS: wrong subdivision of the cube.\n");
+                failures++;
+        }
+        else
+        {
+                for (i = 0; i < 3 * subdivided->vertex_count_level_0; i++)
+                {
+                        if (fabs (subdivided->vertices[i]) > 1.0)
+                        {
+                                fprintf (stderr, "TESTS: subdivided cube exceeds the control cage.\n");
+                                failures++;
+                                break;
+                        }
+                }
+        }
+        if (subdivided != NULL)
+        {
+                dxf_mesh_free (subdivided);
+        }
+        /* The subdivision level of the entity limits the steps. */
+        mesh->subdivision_level = 1;
+        dxf_mesh_triangles_clear (triangles);
+        if ((dxf_mesh_triangulate (mesh, 3, triangles) == EXIT_FAILURE)
+          || (triangles->number_of_vertices != 26)
+          || (triangles->number_of_triangles != 48))
+        {
+                fprintf (stderr, "TESTS: wrong triangulation of the subdivided cube.\n");
+                failures++;
+        }
+        else
+        {
+                volume = test_mesh_volume (triangles);
+                if ((volume <= 0.0) || (volume >= 48.0))
+                {
+                        fprintf (stderr, "TESTS: subdivided cube has a volume of %g.\n",
+                          volume / 6.0);
+                        failures++;
+                }
+        }
+        dxf_mesh_triangles_free (triangles);
+        dxf_mesh_free (mesh);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test the ear clipping of a concave L-shaped face.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_mesh_concave_face ()
+{
+        const double vertices[] =
+        {
+                0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 2.0, 1.0, 0.0,
+                1.0, 1.0, 0.0, 1.0, 2.0, 0.0, 0.0, 2.0, 0.0
+        };
+        const int32_t faces[] = {6, 0, 1, 2, 3, 4, 5};
+        DxfMesh *mesh;
+        DxfMeshTriangles *triangles;
+        const double *a;
+        const double *b;
+        const double *c;
+        double area;
+        double total = 0.0;
+        int failures = 0;
+        int i;
+
+        mesh = test_mesh_new (vertices, 6, faces, 7);
+        triangles = dxf_mesh_triangles_new ();
+        if ((dxf_mesh_triangulate_faces (mesh, triangles) == EXIT_FAILURE)
+          || (triangles->number_of_triangles != 4))
+        {
+                fprintf (stderr, "TESTS: wrong triangulation of the concave face.\n");
+                failures++;
+        }
+        else
+        {
+                for (i = 0; i < triangles->number_of_triangles; i++)
+                {
+                        a = triangles->vertices + 3 * triangles->indices[3 * i];
+                        b = triangles->vertices + 3 * triangles->indices[3 * i + 1];
+                        c = triangles->vertices + 3 * triangles->indices[3 * i + 2];
+                        area = 0.5 * ((b[0] - a[0]) * (c[1] - a[1])
+                          - (c[0] - a[0]) * (b[1] - a[1]));
+                        if (area <= 0.0)
+                        {
+                                fprintf (stderr, "TESTS: concave face gives a flipped or empty triangle.\n");
+                                failures++;
+                                break;
+                        }
+                        total += area;
+                }
+                if (fabs (total - 3.0) > 1e-12)
+                {
+                        fprintf (stderr, "TESTS: concave face triangles cover %g instead of 3.\n",
+                          total);
+                        failures++;
+                }
+        }
+        dxf_mesh_triangles_free (triangles);
+        dxf_mesh_free (mesh);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test welding a polyline mesh and the round trip through a
+ * polyface mesh \c POLYLINE.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_mesh_polyface ()
+{
+        DxfPolylineMesh *mesh;
+        DxfPolylineMesh *converted;
+        DxfPolyline *polyline;
+        int failures = 0;
+
+        /* Two quadrilaterals sharing an edge and a triangle, each with
+         * it's own vertices. */
+        mesh = dxf_polyline_mesh_new ();
+        dxf_polyline_mesh_add_vertex (mesh, 0.0, 0.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 1.0, 0.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 1.0, 1.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 0.0, 1.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 1.0, 0.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 2.0, 0.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 2.0, 1.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 1.0 + 1e-9, 1.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 2.0, 1.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 3.0, 1.0, 0.0);
+        dxf_polyline_mesh_add_vertex (mesh, 2.0, 2.0, 0.0);
+        dxf_polyline_mesh_add_face (mesh, 0, 1, 2, 3, 0);
+        dxf_polyline_mesh_add_face (mesh, 4, 5, 6, 7, 0);
+        dxf_polyline_mesh_add_face (mesh, 8, 9, 10, -1, 2);
+        if ((dxf_polyline_mesh_weld (mesh, 1e-6) == EXIT_FAILURE)
+          || (mesh->number_of_vertices != 8)
+          || (mesh->number_of_faces != 3))
+        {
+                fprintf (stderr, "TESTS: wrong welding of the polyline mesh.\n");
+                failures++;
+        }
+        polyline = dxf_polyline_mesh_to_polyface (mesh);
+        converted = dxf_polyline_mesh_new ();
+        if ((polyline == NULL)
+          || (dxf_polyline_mesh_convert (polyline, 0.0, converted) == EXIT_FAILURE)
+          || (converted->number_of_vertices != mesh->number_of_vertices)
+          || (converted->number_of_faces != mesh->number_of_faces)
+          || (memcmp (converted->vertices, mesh->vertices,
+            3 * (size_t) mesh->number_of_vertices * sizeof (double)) != 0)
+          || (memcmp (converted->faces, mesh->faces,
+            4 * (size_t) mesh->number_of_faces * sizeof (int)) != 0)
+          || (memcmp (converted->invisible_edges, mesh->invisible_edges,
+            (size_t) mesh->number_of_faces) != 0))
+        {
+                fprintf (stderr, "TESTS: wrong polyface mesh round trip.\n");
+                failures++;
+        }
+        if (polyline != NULL)
+        {
+                dxf_polyline_free (polyline);
+        }
+        dxf_polyline_mesh_free (converted);
+        dxf_polyline_mesh_free (mesh);
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for \c MESH entities and polyline
+ * meshes.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_mesh ()
+{
+        int failures = 0;
+
+        failures += test_mesh_cube ();
+        failures += test_mesh_concave_face ();
+        failures += test_mesh_polyface ();
+        return (failures);
+}
+
+
+/* EOF */
@@ -0,0 +1,384 @@
+/*!
+ * \file test_rtree.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for bulk loading, inserting, deleting and
+ * querying an R-tree.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+#define TEST_RTREE_GRID 40
+        /*!< \brief Number of boxes along each side of the test grid. */
+#define TEST_RTREE_NUMBER_OF_BOXES (TEST_RTREE_GRID * TEST_RTREE_GRID)
+        /*!< \brief Number of boxes in the test grid. */
+
+
+/*!
+ * \brief Entities of the test grid, only their addresses are indexed.
+ */
+static int test_rtree_ids[TEST_RTREE_NUMBER_OF_BOXES];
+
+
+/*!
+ * \brief Bounding box of a unit box of the test grid, the boxes are
+ * 1.0 apart.
+ */
+static void
+test_rtree_box
+(
+        int index,
+                /*!< Index of the box in the grid. */
+        DxfExtents *extents
+                /*!< Receives the bounding box. */
+)
+{
+        extents->min_x = 2.0 * (index % TEST_RTREE_GRID);
+        extents->min_y = 2.0 * (index / TEST_RTREE_GRID);
+        extents->min_z = 0.0;
+        extents->max_x = extents->min_x + 1.0;
+        extents->max_y = extents->min_y + 1.0;
+        extents->max_z = 0.0;
+}
+
+
+/*!
+ * \brief Callback remembering the last entity found, an entity of
+ * another type than \c LINE stops the query.
+ */
+static int
+test_rtree_remember
+(
+        DxfEntityType type,
+        void *entity,
+        void *data
+)
+{
+        *(void **) data = entity;
+        return (type != LINE);
+}
+
+
+/*!
+ * \brief Test the structure of the subtree of a node.
+ *
+ * \return the number of entities in the subtree, or -1 when a node is
+ * empty, overfull, on the wrong level, or not contained in the bounding
+ * box of it's parent entry.
+ */
+static int
+test_rtree_check_node
+(
+        DxfRTreeNode *node,
+                /*!< Root of the subtree. */
+        int level,
+                /*!< Expected level of the node. */
+        DxfExtents *parent
+                /*!< Bounding box of the parent entry, or \c NULL. */
+)
+{
+        DxfExtents extents;
+        int number_of_entities = 0;
+        int count;
+        int i;
+
+        if ((node->level != level) || (node->count <= 0)
+          || (node->count > DXF_RTREE_MAX_ENTRIES))
+        {
+                return (-1);
+        }
+        dxf_extents_set_empty (&extents);
+        for (i = 0; i < node->count; i++)
+        {
+                dxf_extents_add_extents (&extents, &node->entries[i].extents);
+                if (level == 0)
+                {
+                        number_of_entities++;
+                        continue;
+                }
+                count = test_rtree_check_node ((DxfRTreeNode *) node->entries[i].child,
+                  level - 1, &node->entries[i].extents);
+                if (count < 0)
+                {
+                        return (-1);
+                }
+                number_of_entities += count;
+        }
+        if ((parent != NULL)
+          && ((extents.min_x != parent->min_x) || (extents.min_y != parent->min_y)
+          || (extents.max_x != parent->max_x) || (extents.max_y != parent->max_y)))
+        {
+                return (-1);
+        }
+        return (number_of_entities);
+}
+
+
+/*!
+ * \brief Test the structure of an R-tree and the number of entities in
+ * it.
+ *
+ * \return \c EXIT_SUCCESS when the tree is consistent, or
+ * \c EXIT_FAILURE when it is not.
+ */
+static int
+test_rtree_check
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        int number_of_entities
+                /*!< Expected number of entities. */
+)
+{
+        if (rtree->root == NULL)
+        {
+                return ((number_of_entities == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        if ((rtree->number_of_entities != number_of_entities)
+          || (test_rtree_check_node (rtree->root, rtree->root->level, NULL)
+          != number_of_entities))
+        {
+                return (EXIT_FAILURE);
+        }
+        return (EXIT_SUCCESS);
+}
+
+
+/*!
+ * \brief Compare window, point and nearest neighbour queries with a
+ * brute force search over the boxes still in the tree.
+ *
+ * \return the number of failed queries.
+ */
+static int
+test_rtree_queries
+(
+        DxfRTree *rtree,
+                /*!< R-tree. */
+        const char *in_tree
+                /*!< Flags of the boxes in the tree. */
+)
+{
+        DxfExtents window;
+        DxfExtents box;
+        DxfEntityType types[4];
+        void *entities[4];
+        void *entity;
+        double distances[4];
+        double expected[4];
+        double d;
+        double dx;
+        double dy;
+        int failures = 0;
+        int count;
+        int found;
+        int i;
+        int j;
+
+        /* Windows of growing size through the grid. */
+        for (j = 0; j < 8; j++)
+        {
+                window.min_x = 3.5 * j - 0.5;
+                window.min_y = 2.5 * j;
+                window.min_z = -1.0;
+                window.max_x = window.min_x + 1.5 * j + 0.2;
+                window.max_y = window.min_y + 0.9 * j;
+                window.max_z = 1.0;
+                count = 0;
+                for (i = 0; i < TEST_RTREE_NUMBER_OF_BOXES; i++)
+                {
+                        test_rtree_box (i, &box);
+                        if ((in_tree[i]) && (dxf_extents_intersect (&box, &window)))
+                        {
+                                count++;
+                        }
+                }
+                if (dxf_rtree_query_window (rtree, &window, NULL, NULL) != count)
+                {
+                        fprintf (stderr, "TESTS: R-tree window query %d found the wrong entities.\n", j);
+                        failures++;
+                }
+        }
+        /* A point inside box 41 and a point in the gap between boxes. */
+        entity = NULL;
+        found = dxf_rtree_query_point (rtree, 2.5, 2.5, 0.0, test_rtree_remember, &entity);
+        if ((found != in_tree[41])
+          || ((in_tree[41]) && (entity != &test_rtree_ids[41])))
+        {
+                fprintf (stderr, "TESTS: R-tree point query found the wrong entity.\n");
+                failures++;
+        }
+        if (dxf_rtree_query_point (rtree, 1.5, 1.5, 0.0, NULL, NULL) != 0)
+        {
+                fprintf (stderr, "TESTS: R-tree point query found an entity in a gap.\n");
+                failures++;
+        }
+        /* The four nearest boxes to a point off the grid corner. */
+        for (i = 0; i < 4; i++)
+        {
+                expected[i] = DBL_MAX;
+        }
+        for (i = 0; i < TEST_RTREE_NUMBER_OF_BOXES; i++)
+        {
+                if (!in_tree[i])
+                {
+                        continue;
+                }
+                test_rtree_box (i, &box);
+                dx = (box.min_x > 3.3) ? box.min_x - 3.3 : ((box.max_x < 3.3) ? 3.3 - box.max_x : 0.0);
+                dy = (box.min_y > -2.0) ? box.min_y + 2.0 : 0.0;
+                d = sqrt (dx * dx + dy * dy);
+                for (j = 3; (j >= 0) && (d < expected[j]); j--)
+                {
+                        if (j < 3) expected[j + 1] = expected[j];
+                        expected[j] = d;
+                }
+        }
+        found = dxf_rtree_query_nearest (rtree, 3.3, -2.0, 4, types, entities, distances);
+        for (i = 0; i < found; i++)
+        {
+                if ((types[i] != LINE) || (fabs (distances[i] - expected[i]) > 1e-9))
+                {
+                        break;
+                }
+        }
+        if ((found != ((rtree->number_of_entities < 4) ? rtree->number_of_entities : 4))
+          || (i != found))
+        {
+                fprintf (stderr, "TESTS: R-tree nearest neighbour query found the wrong entities.\n");
+                failures++;
+        }
+        return (failures);
+}
+
+
+/*!
+ * \brief Test bulk loading, inserting with node splits, deleting with
+ * pruning of the tree, and querying an R-tree.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_rtree ()
+{
+        DxfRTree *loaded;
+        DxfRTree *inserted;
+        DxfRTreeEntry *entries;
+        DxfExtents extents;
+        char in_tree[TEST_RTREE_NUMBER_OF_BOXES];
+        int failures = 0;
+        int i;
+
+        entries = malloc (TEST_RTREE_NUMBER_OF_BOXES * sizeof (DxfRTreeEntry));
+        loaded = dxf_rtree_init (NULL);
+        inserted = dxf_rtree_init (NULL);
+        if ((entries == NULL) || (loaded == NULL) || (inserted == NULL))
+        {
+                fprintf (stderr, "TESTS: could not allocate the R-trees.\n");
+                return (1);
+        }
+        for (i = 0; i < TEST_RTREE_NUMBER_OF_BOXES; i++)
+        {
+                test_rtree_box (i, &entries[i].extents);
+                entries[i].type = LINE;
+                entries[i].entity = &test_rtree_ids[i];
+                in_tree[i] = TRUE;
+        }
+        /* Sort-Tile-Recursive bulk load. */
+        if ((dxf_rtree_bulk_load (loaded, entries, TEST_RTREE_NUMBER_OF_BOXES) != EXIT_SUCCESS)
+          || (test_rtree_check (loaded, TEST_RTREE_NUMBER_OF_BOXES) != EXIT_SUCCESS)
+          || (loaded->root->level != 2))
+        {
+                fprintf (stderr, "TESTS: the bulk loaded R-tree is inconsistent.\n");
+                failures++;
+        }
+        failures += test_rtree_queries (loaded, in_tree);
+        /* One by one, splitting the nodes. */
+        for (i = 0; i < TEST_RTREE_NUMBER_OF_BOXES; i++)
+        {
+                test_rtree_box (i, &extents);
+                if (dxf_rtree_insert (inserted, &extents, LINE, &test_rtree_ids[i]) != EXIT_SUCCESS)
+                {
+                        break;
+                }
+        }
+        if ((i != TEST_RTREE_NUMBER_OF_BOXES)
+          || (test_rtree_check (inserted, TEST_RTREE_NUMBER_OF_BOXES) != EXIT_SUCCESS)
+          || (inserted->root->level < 2))
+        {
+                fprintf (stderr, "TESTS: the R-tree built by inserting is inconsistent.\n");
+                failures++;
+        }
+        failures += test_rtree_queries (inserted, in_tree);
+        /* Delete all but the last box, the tree shrinks to a leaf. */
+        for (i = 0; i < TEST_RTREE_NUMBER_OF_BOXES - 1; i++)
+        {
+                test_rtree_box (i, &extents);
+                if (dxf_rtree_delete (inserted, &extents, &test_rtree_ids[i]) != EXIT_SUCCESS)
+                {
+                        break;
+                }
+                in_tree[i] = FALSE;
+                if ((i % 400 == 0)
+                  && ((test_rtree_check (inserted, TEST_RTREE_NUMBER_OF_BOXES - i - 1) != EXIT_SUCCESS)
+                  || (test_rtree_queries (inserted, in_tree) != 0)))
+                {
+                        break;
+                }
+        }
+        test_rtree_box (0, &extents);
+        if ((i != TEST_RTREE_NUMBER_OF_BOXES - 1)
+          || (test_rtree_check (inserted, 1) != EXIT_SUCCESS)
+          || (inserted->root->level != 0)
+          || (dxf_rtree_delete (inserted, &extents, &test_rtree_ids[0]) != EXIT_FAILURE))
+        {
+                fprintf (stderr, "TESTS: deleting from an R-tree did not prune it.\n");
+                failures++;
+        }
+        test_rtree_box (TEST_RTREE_NUMBER_OF_BOXES - 1, &extents);
+        if ((dxf_rtree_delete (inserted, &extents,
+          &test_rtree_ids[TEST_RTREE_NUMBER_OF_BOXES - 1]) != EXIT_SUCCESS)
+          || (inserted->root != NULL)
+          || (inserted->number_of_entities != 0))
+        {
+                fprintf (stderr, "TESTS: deleting the last entity did not empty the R-tree.\n");
+                failures++;
+        }
+        free (entries);
+        dxf_rtree_free (loaded);
+        dxf_rtree_free (inserted);
+        return (failures);
+}
+
+
+/* EOF */
@@ -0,0 +1,309 @@
+/*!
+ * \file test_spline.c
+ *
+ * \author Copyright (C) 2026 by Bert Timmerman <bert.timmerman@xs4all.nl>.
+ *
+ * \brief Testing program for the evaluation and tessellation of DXF
+ * \c SPLINE entities.
+ *
+ * <hr>
+ * <h1><b>Copyright Notices.</b></h1>\n
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License,
+ * or (at your option) any later version.\n\n
+ * This program is distributed in the hope that it will be useful, but
+ * <b>WITHOUT ANY WARRANTY</b>; without even the implied warranty of
+ * <b>MERCHANTABILITY</b> or <b>FITNESS FOR A PARTICULAR PURPOSE</b>.\n
+ * See the GNU General Public License for more details.\n\n
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to:\n
+ * Free Software Foundation, Inc.,\n
+ * 59 Temple Place,\n
+ * Suite 330,\n
+ * Boston,\n
+ * MA 02111 USA.\n
+ * \n
+ * Drawing eXchange Format (DXF) is a defacto industry standard for the
+ * exchange of drawing files between various Computer Aided Drafting
+ * programs.\n
+ * DXF is an industry standard designed by Autodesk(TM).\n
+ * For more details see http://www.autodesk.com.
+ * <hr>
+ */
+
+
+
+#include <stdio.h>
+#include "includes.h"
+
+
+/*!
+ * \brief Build a list of doubles from an array.
+ *
+ * \return a pointer to the first double of the list.
+ */
+static DxfDouble *
+test_spline_doubles
+(
+        const double *values,
+        int number_of_values
+)
+{
+        DxfDouble *first = NULL;
+        DxfDouble *last = NULL;
+        DxfDouble *value;
+        int i;
+
+        for (i = 0; i < number_of_values; i++)
+        {
+                value = dxf_double_init (dxf_double_new ());
+                value->value = values[i];
+                if (last == NULL)
+                        first = value;
+                else
+                        last->next = (struct DxfDouble *) value;
+                last = value;
+        }
+        return (first);
+}
+
+
+/*!
+ * \brief Build a spline from it's control points, weights and knots.
+ *
+ * \return a pointer to the spline, or \c NULL when an error occurred.
+ */
+static DxfSpline *
+test_spline_new
+(
+        int degree,
+                /*!< Degree of the spline. */
+        const double *control_points,
+                /*!< X-, Y- and Z-values of the control points. */
+        const double *weights,
+                /*!< Weights of the control points, \c NULL for a non
+                 * rational spline. */
+        int number_of_control_points,
+                /*!< Number of control points. */
+        const double *knots
+                /*!< Knot vector, \c number_of_control_points + \c degree
+                 * + 1 values. */
+)
+{
+        DxfSpline *spline;
+        DxfPoint *point;
+        DxfPoint *last = NULL;
+        int i;
+
+        spline = dxf_spline_init (dxf_spline_new ());
+        if (spline == NULL)
+        {
+                return (NULL);
+        }
+        dxf_point_free_list (spline->p0);
+        spline->p0 = NULL;
+        for (i = 0; i < number_of_control_points; i++)
+        {
+                point = dxf_point_init (dxf_point_new ());
+                point->x0 = control_points[3 * i];
+                point->y0 = control_points[3 * i + 1];
+                point->z0 = control_points[3 * i + 2];
+                if (last == NULL)
+                        spline->p0 = point;
+                else
+                        last->next = (struct DxfPoint *) point;
+                last = point;
+        }
+        dxf_spline_set_knot_value (spline, test_spline_doubles (knots,
+          number_of_control_points + degree + 1));
+        if (weights != NULL)
+        {
+                dxf_spline_set_weight_value (spline,
+                  test_spline_doubles (weights, number_of_control_points));
+                spline->flag |= 4;
+        }
+        spline->degree = degree;
+        spline->number_of_control_points = number_of_control_points;
+        spline->number_of_knots = number_of_control_points + degree + 1;
+        return (spline);
+}
+
+
+/*!
+ * \brief Test if two points are within \c tolerance of each other.
+ */
+static int
+test_spline_near
+(
+        const double *p,
+        double x,
+        double y,
+        double z,
+        double tolerance
+)
+{
+        return ((fabs (p[0] - x) <= tolerance)
+          && (fabs (p[1] - y) <= tolerance)
+          && (fabs (p[2] - z) <= tolerance));
+}
+
+
+/*!
+ * \brief Test a quadratic Bezier curve: the end points, the midpoint,
+ * the derivatives and the cache invalidation by a setter.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_spline_bezier ()
+{
+        double control_points[] = {0.0, 0.0, 0.0, 1.0, 2.0, 0.0, 2.0, 0.0, 1.0};
+        double knots[] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+        double derivatives[9];
+        double point[3];
+        double u_min;
+        double u_max;
+        DxfSpline *spline;
+        int failures = 0;
+
+        spline = test_spline_new (2, control_points, NULL, 3, knots);
+        if ((spline == NULL)
+          || (dxf_spline_get_domain (spline, &u_min, &u_max) == EXIT_FAILURE)
+          || (u_min != 0.0) || (u_max != 1.0))
+        {
+                fprintf (stderr, "TESTS: wrong domain of the Bezier spline.\n");
+                return (1);
+        }
+        dxf_spline_evaluate (spline, 0.0, point);
+        failures += !test_spline_near (point, 0.0, 0.0, 0.0, 1e-12);
+        dxf_spline_evaluate (spline, 1.0, point);
+        failures += !test_spline_near (point, 2.0, 0.0, 1.0, 1e-12);
+        /* B(1/2) = P0 / 4 + P1 / 2 + P2 / 4. */
+        dxf_spline_evaluate (spline, 0.5, point);
+        failures += !test_spline_near (point, 1.0, 1.0, 0.25, 1e-12);
+        /* B'(u) = 2 (1 - u) (P1 - P0) + 2 u (P2 - P1),
+         * B'' = 2 (P2 - 2 P1 + P0). */
+        dxf_spline_evaluate_derivatives (spline, 0.25, 2, derivatives);
+        failures += !test_spline_near (derivatives + 3, 2.0, 2.0, 0.5, 1e-12);
+        failures += !test_spline_near (derivatives + 6, 0.0, -8.0, 2.0, 1e-12);
+        /* Moving the first control point must invalidate the cache. */
+        dxf_spline_set_x0 (spline, 4.0);
+        dxf_spline_evaluate (spline, 0.0, point);
+        failures += !test_spline_near (point, 4.0, 0.0, 0.0, 1e-12);
+        if (failures > 0)
+        {
+                fprintf (stderr, "TESTS: wrong points or derivatives of the Bezier spline.\n");
+        }
+        dxf_spline_free (spline);
+        return (failures);
+}
+
+
+/*!
+ * \brief Test a rational quadratic spline describing a quarter of the
+ * unit circle: points and the tessellation must lie on the circle.
+ *
+ * \return the number of failed tests.
+ */
+static int
+test_spline_rational ()
+{
+        double control_points[] = {1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0};
+        double weights[] = {1.0, M_SQRT1_2, 1.0};
+        double knots[] = {0.0, 0.0, 0.0, 1.0, 1.0, 1.0};
+        double tolerance = 1e-4;
+        double derivatives[6];
+        double point[3];
+        const double *points;
+        DxfSpline *spline;
+        double r;
+        double mx;
+        double my;
+        int number_of_points;
+        int failures = 0;
+        int i;
+
+        spline = test_spline_new (2, control_points, weights, 3, knots);
+        if (spline == NULL)
+        {
+                return (1);
+        }
+        for (i = 0; i <= 10; i++)
+        {
+                dxf_spline_evaluate (spline, i / 10.0, point);
+                r = sqrt (point[0] * point[0] + point[1] * point[1]);
+                if (fabs (r - 1.0) > 1e-12)
+                {
+                        fprintf (stderr, "TESTS: rational spline point at %g has radius %.17g.\n",
+                          i / 10.0, r);
+                        failures++;
+                }
+        }
+        /* The tangent is perpendicular to the radius. */
+        dxf_spline_evaluate_derivatives (spline, 0.3, 1, derivatives);
+        if (fabs (derivatives[0] * derivatives[3] + derivatives[1] * derivatives[4]) > 1e-12)
+        {
+                fprintf (stderr, "TESTS: rational spline tangent is not perpendicular to the radius.\n");
+                failures++;
+        }
+        points = dxf_spline_tessellate (spline, tolerance, &number_of_points);
+        if ((points == NULL) || (number_of_points < 3)
+          || !test_spline_near (points, 1.0, 0.0, 0.0, 1e-12)
+          || !test_spline_near (points + 3 * (number_of_points - 1), 0.0, 1.0, 0.0, 1e-12))
+        {
+                fprintf (stderr, "TESTS: wrong tessellation of the rational spline.\n");
+                dxf_spline_free (spline);
+                return (failures + 1);
+        }
+        for (i = 0; i < number_of_points; i++)
+        {
+                r = sqrt (points[3 * i] * points[3 * i] + points[3 * i + 1] * points[3 * i + 1]);
+                if (fabs (r - 1.0) > 1e-12)
+                {
+                        fprintf (stderr, "TESTS: tessellated point %d is not on the circle.\n", i);
+                        failures++;
+                }
+                if (i > 0)
+                {
+                        /* The sagitta of a chord must be within the
+                         * tolerance. */
+                        mx = 0.5 * (points[3 * i] + points[3 * i - 3]);
+                        my = 0.5 * (points[3 * i + 1] + points[3 * i - 2]);
+                        if (1.0 - sqrt (mx * mx + my * my) > tolerance)
+                        {
+                                fprintf (stderr, "TESTS: chord %d deviates more than the tolerance.\n", i);
+                                failures++;
+                        }
+                }
+        }
+        /* A second call with the same tolerance returns the cached
+         * points. */
+        if (dxf_spline_tessellate (spline, tolerance, &i) != points)
+        {
+                fprintf (stderr, "TESTS: the tessellation was not cached.\n");
+                failures++;
+        }
+        dxf_spline_free (spline);
+        return (failures);
+}
+
+
+/*!
+ * \brief Perform test functions for the evaluation of DXF \c SPLINE
+ * entities.
+ *
+ * \return the number of failed tests.
+ */
+int
+test_spline ()
+{
+        int failures = 0;
+
+        failures += test_spline_bezier ();
+        failures += test_spline_rational ();
+        return (failures);
+}
+
+
+/* EOF */
@@ -36,17 +36,144 @@
 #include <string.h>
 #include "includes.h"
 
+
+int test_3dsolid ();
+int test_clash ();
+int test_diagnostic ();
+int test_entities ();
+int test_extents ();
+int test_face_soup ();
+int test_hatch ();
+int test_instance ();
+int test_layer_index ();
+int test_line ();
+int test_load_options ();
+int test_measure ();
+int test_mesh ();
+int test_rtree ();
+int test_spline ();
+
+
 /*!
  * \brief Reads a dxf file using libdxf form examples dir.
  *
+ * \return the number of failed tests.
+ *
  * \version According to DXF R2000.
  */
 int main (void)
 {
+    int failures = 0;
+
     if (dxf_file_read ("../../examples/qcad-example_R2000.dxf"))
         fprintf (stdout, "TESTS: R2000 exited with error\n");
     else
         fprintf (stdout, "TESTS: R2000 exited with no error\n");
-    
-    return 1;
+    if (test_entities ())
+    {
+        fprintf (stdout, "TESTS: reading the entities of the examples failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: reading the entities of the examples passed\n");
+    if (test_extents ())
+    {
+        fprintf (stdout, "TESTS: computing extents with nested blocks failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: computing extents with nested blocks passed\n");
+    if (test_line ())
+    {
+        fprintf (stdout, "TESTS: round trip of the LINE golden files failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: round trip of the LINE golden files passed\n");
+    if (test_clash ())
+    {
+        fprintf (stdout, "TESTS: SIMD clash kernels failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: SIMD clash kernels passed\n");
+    if (test_hatch ())
+    {
+        fprintf (stdout, "TESTS: classifying points in HATCH boundaries failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: classifying points in HATCH boundaries passed\n");
+    if (test_spline ())
+    {
+        fprintf (stdout, "TESTS: evaluating SPLINE entities failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: evaluating SPLINE entities passed\n");
+    if (test_measure ())
+    {
+        fprintf (stdout, "TESTS: measuring areas, perimeters and centroids failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: measuring areas, perimeters and centroids passed\n");
+    if (test_mesh ())
+    {
+        fprintf (stdout, "TESTS: triangulating MESH entities and polyline meshes failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: triangulating MESH entities and polyline meshes passed\n");
+    if (test_face_soup ())
+    {
+        fprintf (stdout, "TESTS: building face soups failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: building face soups passed\n");
+    if (test_layer_index ())
+    {
+        fprintf (stdout, "TESTS: querying the layer index of a drawing failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: querying the layer index of a drawing passed\n");
+    if (test_rtree ())
+    {
+        fprintf (stdout, "TESTS: loading, updating and querying R-trees failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: loading, updating and querying R-trees passed\n");
+    if (test_load_options ())
+    {
+        fprintf (stdout, "TESTS: filtering entities on type and layer failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: filtering entities on type and layer passed\n");
+    if (test_diagnostic ())
+    {
+        fprintf (stdout, "TESTS: rate limiting and deduplicating diagnostics failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: rate limiting and deduplicating diagnostics passed\n");
+    if (test_3dsolid ())
+    {
+        fprintf (stdout, "TESTS: round trip of the proprietary data of a 3DSOLID failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: round trip of the proprietary data of a 3DSOLID passed\n");
+    if (test_instance ())
+    {
+        fprintf (stdout, "TESTS: building instance tables of block references failed\n");
+        failures++;
+    }
+    else
+        fprintf (stdout, "TESTS: building instance tables of block references passed\n");
+
+    return (failures);
 }